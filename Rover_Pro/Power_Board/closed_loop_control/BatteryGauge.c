@@ -0,0 +1,161 @@
+/*==============================================================================
+File: BatteryGauge.c
+Notes:
+  - 1 uAh = 3.6 mA*s = 3600000 / tick_us mA*ticks; the fraction of a uAh
+    left over from each integration is carried to the next one
+  - the draw is averaged over one-second windows, and the window means go
+    through a first-order filter:  avg += (mean - avg) / average_s
+==============================================================================*/
+//---------------------------Dependencies---------------------------------------
+#include "BatteryGauge.h"
+
+//---------------------------Macros and Definitions-----------------------------
+#define MA_US_PER_UAH           3600000L
+#define US_PER_S                1000000L
+#define AVERAGE_FRACTION_BITS   8
+#define MIN_RUNTIME_CURRENT     50        // [mA], idle below this
+#define MAX_RUNTIME             0xfffe    // [s]
+
+typedef struct {
+  uint16_t capacity_mAh;
+  int32_t charge_uAh;
+  int32_t residual;           // [mA * ticks], less than one uAh
+  int32_t ticks_per_uAh;
+  int32_t ticks_per_s;
+  int32_t window_sum;         // [mA * ticks] over the present window
+  int32_t window_ticks;
+  int32_t average_current;    // [mA], with fraction bits
+  uint16_t average_s;
+  uint8_t correction_gain;
+  bool is_known;
+} gauge_t;
+
+//---------------------------Module Variables-----------------------------------
+static gauge_t gauges[MAX_NUM_GAUGES];
+
+//---------------------------Helper Function Prototypes-------------------------
+static int32_t Limit(const int32_t x, const int32_t low, const int32_t high);
+
+//---------------------------Public Function Definitions------------------------
+void GAUGE_Init(const uint8_t i, const uint16_t capacity_mAh,
+                const uint16_t tick_us, const uint8_t correction_gain,
+                const uint16_t average_s) {
+  gauge_t *g = &gauges[i];
+  const uint16_t tick = (tick_us == 0) ? 1 : tick_us;
+
+  g->capacity_mAh = (capacity_mAh == 0) ? 1 : capacity_mAh;
+  g->ticks_per_uAh = MA_US_PER_UAH / tick;
+  g->ticks_per_s = US_PER_S / tick;
+  g->average_s = (average_s == 0) ? 1 : average_s;
+  g->correction_gain = correction_gain;
+  g->charge_uAh = 0;
+  g->residual = 0;
+  g->window_sum = 0;
+  g->window_ticks = 0;
+  g->average_current = 0;
+  g->is_known = false;
+}
+
+
+void GAUGE_SetCapacity(const uint8_t i, const uint16_t capacity_mAh) {
+  gauge_t *g = &gauges[i];
+  const uint16_t old = g->capacity_mAh;
+
+  if (capacity_mAh == 0 || capacity_mAh == old) return;
+
+  // keep the state of charge: charge * new / old, split to stay in 32 bits
+  g->charge_uAh = (g->charge_uAh / old) * capacity_mAh +
+                  (int32_t)(((uint32_t)(g->charge_uAh % old) * capacity_mAh) / old);
+  g->capacity_mAh = capacity_mAh;
+  g->charge_uAh = Limit(g->charge_uAh, 0, (int32_t)capacity_mAh * 1000);
+}
+
+
+void GAUGE_Integrate(const uint8_t i, const int16_t current_mA,
+                     const uint16_t ticks) {
+  gauge_t *g = &gauges[i];
+  int32_t drawn, mean;
+
+  g->residual += (int32_t)current_mA * ticks;
+  drawn = g->residual / g->ticks_per_uAh;
+  g->residual -= drawn * g->ticks_per_uAh;
+  g->charge_uAh = Limit(g->charge_uAh - drawn, 0,
+                        (int32_t)g->capacity_mAh * 1000);
+
+  g->window_sum += (int32_t)current_mA * ticks;
+  g->window_ticks += ticks;
+  if (g->ticks_per_s <= g->window_ticks) {
+    mean = g->window_sum / g->window_ticks;
+    g->average_current +=
+        ((mean << AVERAGE_FRACTION_BITS) - g->average_current) / g->average_s;
+    g->window_sum = 0;
+    g->window_ticks = 0;
+  }
+}
+
+
+void GAUGE_Correct(const uint8_t i, const uint8_t percent) {
+  gauge_t *g = &gauges[i];
+  int32_t unit = (int32_t)g->capacity_mAh * 10;   // 1% [uAh]
+  int32_t low, high, error = 0;
+
+  if (100 < percent) return;
+
+  low = unit * percent;
+  high = low + unit - 1;
+  if (!g->is_known) {
+    // first reading, start in the middle of the band
+    g->charge_uAh = Limit(low + unit / 2, 0, (int32_t)g->capacity_mAh * 1000);
+    g->residual = 0;
+    g->is_known = true;
+    return;
+  }
+
+  if (g->charge_uAh < low) error = low - g->charge_uAh;
+  else if (high < g->charge_uAh) error = high - g->charge_uAh;
+  // error * gain could overflow, the error is at most the capacity
+  g->charge_uAh += (error / 256) * g->correction_gain +
+                   ((error % 256) * g->correction_gain) / 256;
+  g->charge_uAh = Limit(g->charge_uAh, 0, (int32_t)g->capacity_mAh * 1000);
+}
+
+
+uint16_t GAUGE_SOC(const uint8_t i) {
+  const gauge_t *g = &gauges[i];
+
+  if (!g->is_known) return GAUGE_UNKNOWN;
+  // charge / (capacity / 10000)
+  return (uint16_t)((g->charge_uAh * 10) / g->capacity_mAh);
+}
+
+
+int16_t GAUGE_AverageCurrent(const uint8_t i) {
+  return (int16_t)(gauges[i].average_current / (1L << AVERAGE_FRACTION_BITS));
+}
+
+
+uint16_t GAUGE_Runtime(void) {
+  int32_t charge = 0, current = 0, runtime;
+  bool is_any_known = false;
+  uint8_t i;
+
+  for (i = 0; i < MAX_NUM_GAUGES; i++) {
+    if (!gauges[i].is_known) continue;
+    is_any_known = true;
+    charge += gauges[i].charge_uAh;
+    current += GAUGE_AverageCurrent(i);
+  }
+
+  if (!is_any_known || current < MIN_RUNTIME_CURRENT) return GAUGE_UNKNOWN;
+
+  // [s] = uAh * 3.6 / mA, charge / 10 keeps the product in 32 bits
+  runtime = ((charge / 10) * 36) / current;
+  return (uint16_t)Limit(runtime, 0, MAX_RUNTIME);
+}
+
+//---------------------------Private Function Definitions-----------------------
+static int32_t Limit(const int32_t x, const int32_t low, const int32_t high) {
+  if (x < low) return low;
+  else if (high < x) return high;
+  return x;
+}
@@ -0,0 +1,86 @@
+/*==============================================================================
+File: BatteryGauge.h
+
+Description: This module encapsulates a coulomb-counting state-of-charge
+  estimator per battery.  The measured battery current is integrated into
+  the remaining charge; whenever the battery's own fuel gauge reports its
+  state of charge, the estimate is pulled toward it, so the integrator
+  cannot drift while it still reacts to load changes immediately.
+
+Notes:
+  - integer math only, charge is kept in uAh, so capacities up to 65 Ah fit
+  - currents are in mA, positive when discharging
+  - the gauge reports whole percents and lags under load, so it is treated
+    as a band [p, p + 1)% and only an estimate outside the band is corrected
+  - until the first gauge reading the state of charge is unknown
+  - the runtime estimate divides the remaining charge of all known
+    batteries by their averaged total draw
+==============================================================================*/
+#ifndef BATTERYGAUGE_H
+#define BATTERYGAUGE_H
+//---------------------------Dependencies---------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//---------------------------Macros---------------------------------------------
+#define MAX_NUM_GAUGES        2     // battery A, battery B
+#define GAUGE_UNKNOWN         0xffff
+
+//---------------------------Public Functions-----------------------------------
+// Function: GAUGE_Init
+// Parameters:
+//   uint8_t i,                 the index (0-based) of the gauge
+//   uint16_t capacity_mAh,     the full charge capacity of the battery
+//   uint16_t tick_us,          the time base of GAUGE_Integrate()
+//   uint8_t correction_gain,   the part of the gauge error corrected per
+//                              gauge reading, /256
+//   uint16_t average_s,        time constant [s] of the averaged current used
+//                              for the runtime estimate
+void GAUGE_Init(const uint8_t i, const uint16_t capacity_mAh,
+                const uint16_t tick_us, const uint8_t correction_gain,
+                const uint16_t average_s);
+
+
+// Function: GAUGE_SetCapacity
+// Description: Changes the full charge capacity, keeping the state of
+//   charge.  A capacity of zero (0) is ignored.
+void GAUGE_SetCapacity(const uint8_t i, const uint16_t capacity_mAh);
+
+
+// Function: GAUGE_Integrate
+// Parameters:
+//   uint8_t i,             the index (0-based) of the gauge
+//   int16_t current_mA,    the average current over the elapsed ticks
+//   uint16_t ticks,        the time since the last call, at most 1000 ticks
+//                          and less than a second
+void GAUGE_Integrate(const uint8_t i, const int16_t current_mA,
+                     const uint16_t ticks);
+
+
+// Function: GAUGE_Correct
+// Description: Feeds a state of charge reported by the battery's gauge.
+// Parameters:
+//   uint8_t i,             the index (0-based) of the gauge
+//   uint8_t percent,       the relative state of charge, 0 to 100
+void GAUGE_Correct(const uint8_t i, const uint8_t percent);
+
+
+// Function: GAUGE_SOC
+// Returns:
+//   uint16_t, the state of charge in 0.01%, or GAUGE_UNKNOWN
+uint16_t GAUGE_SOC(const uint8_t i);
+
+
+// Function: GAUGE_AverageCurrent
+// Returns:
+//   int16_t, the averaged current [mA]
+int16_t GAUGE_AverageCurrent(const uint8_t i);
+
+
+// Function: GAUGE_Runtime
+// Returns:
+//   uint16_t, the time [s] until the known batteries are empty at the
+//   averaged draw, or GAUGE_UNKNOWN (no battery known, or hardly any draw)
+uint16_t GAUGE_Runtime(void);
+
+#endif
@@ -0,0 +1,195 @@
+/*==============================================================================
+File: Decimator.c
+Notes:
+  - order N, ratio R, with a differential delay of one output:
+      integrators (every sample):  I1 += x,  I2 += I1
+      combs (every R samples):     C1 = IN - IN[-1],  C2 = C1 - C1[-1]
+    the gain is R^N, i.e. N * log2(R) bits
+  - the output is (gain-scaled sum) >> (N * log2(R) + input_bits -
+    output_bits), rounded to nearest
+
+See also:
+  - E. Hogenauer, "An Economical Class of Digital Filters for Decimation
+    and Interpolation", IEEE Trans. ASSP, 1981
+==============================================================================*/
+//---------------------------Dependencies---------------------------------------
+#include "Decimator.h"
+
+//---------------------------Macros and Definitions-----------------------------
+typedef struct {
+  uint8_t input_bits;
+  uint8_t order;
+  uint8_t log2_ratio;
+  uint8_t output_bits;
+  uint8_t shift;              // from the filter gain to the output resolution
+  uint8_t outputs_to_skip;    // comb stages still filling up
+  uint16_t count;             // samples since the last output
+  uint16_t output;
+  uint32_t integrator[DEC_MAX_ORDER];
+  uint32_t comb_delay[DEC_MAX_ORDER];
+  bool is_primed;
+} decimator_t;
+
+//---------------------------Module Variables-----------------------------------
+static decimator_t decimators[MAX_NUM_DECIMATORS];
+
+//---------------------------Helper Function Prototypes-------------------------
+static uint8_t Limit(const uint8_t x, const uint8_t low, const uint8_t high);
+
+//---------------------------Test Harness---------------------------------------
+#ifdef TEST_DECIMATOR
+#include <stdio.h>
+#include <math.h>
+
+#define N_SAMPLES   20000
+#define LEVEL       512.3     // [counts]
+#define NOISE       6.0       // uniform noise, +/- counts
+
+// a converter reading of LEVEL plus noise, the noise dithers the fraction
+static uint32_t seed = 12345;
+static uint16_t Sample(void) {
+  seed = seed * 1103515245UL + 12345;
+  return (uint16_t)floor(LEVEL + NOISE * ((seed >> 8) / 8388608.0 - 1) + 0.5);
+}
+
+// returns the RMS error of the outputs, in input counts
+static double RunChannel(const uint8_t order, const uint8_t log2_ratio,
+                         const uint8_t output_bits) {
+  double sum_squares = 0, scale = (double)(1 << (output_bits - 10));
+  long n_outputs = 0, k;
+
+  DEC_Init(0, 10, order, log2_ratio, output_bits);
+  for (k = 0; k < N_SAMPLES; k++) {
+    if (DEC_Update(0, Sample())) {
+      double error = DEC_Output(0) / scale - LEVEL;
+      sum_squares += error * error;
+      n_outputs++;
+    }
+  }
+  return sqrt(sum_squares / n_outputs);
+}
+
+int main(void) {
+  double raw = 0, boxcar, cic;
+  int failures = 0, k;
+
+  for (k = 0; k < N_SAMPLES; k++) {
+    double error = Sample() - LEVEL;
+    raw += error * error;
+  }
+  raw = sqrt(raw / N_SAMPLES);
+
+  // 64 samples should divide the noise by about 8
+  boxcar = RunChannel(1, 6, 13);
+  cic = RunChannel(2, 6, 13);
+  printf("rms error: raw %.3f, boxcar/64 %.3f, cic2/64 %.3f counts\n",
+         raw, boxcar, cic);
+  if (raw / boxcar < 6) { printf("FAIL: boxcar reduction\n"); failures++; }
+  if (raw / cic < 6) { printf("FAIL: cic reduction\n"); failures++; }
+
+  // the output resolution is clamped to what the filter can deliver
+  DEC_Init(1, 10, 1, 2, 16);
+  if (DEC_OutputBits(1) != 12) { printf("FAIL: resolution clamp\n"); failures++; }
+
+  // a constant input comes out exactly, at any resolution
+  DEC_Init(2, 10, 2, 3, 16);
+  for (k = 0; k < 64; k++) DEC_Update(2, 1000);
+  if (DEC_OutputAt(2, 10) != 1000 || DEC_Output(2) != (1000 << 6)) {
+    printf("FAIL: dc gain %u\n", DEC_Output(2));
+    failures++;
+  }
+
+  printf(failures ? "FAILED\n" : "passed\n");
+  return failures;
+}
+#endif
+
+//---------------------------Public Function Definitions------------------------
+void DEC_Init(const uint8_t i, const uint8_t input_bits, const uint8_t order,
+              const uint8_t log2_ratio, const uint8_t output_bits) {
+  decimator_t *d = &decimators[i];
+  uint8_t gain_bits;
+
+  d->input_bits = Limit(input_bits, 1, DEC_MAX_OUTPUT_BITS);
+  d->order = Limit(order, 1, DEC_MAX_ORDER);
+  d->log2_ratio = Limit(log2_ratio, 0, DEC_MAX_LOG2_RATIO);
+  gain_bits = d->order * d->log2_ratio;
+  d->output_bits = Limit(output_bits, d->input_bits,
+                         Limit(d->input_bits + gain_bits, 1,
+                               DEC_MAX_OUTPUT_BITS));
+  d->shift = gain_bits + d->input_bits - d->output_bits;
+
+  d->count = 0;
+  d->output = 0;
+  d->outputs_to_skip = d->order;
+  d->is_primed = false;
+  d->integrator[0] = d->integrator[1] = 0;
+  d->comb_delay[0] = d->comb_delay[1] = 0;
+}
+
+
+bool DEC_Update(const uint8_t i, const uint16_t x) {
+  decimator_t *d = &decimators[i];
+  uint32_t y, previous;
+  uint8_t stage;
+
+  if (!d->is_primed) {
+    d->output = x << (d->output_bits - d->input_bits);
+    d->is_primed = true;
+  }
+
+  d->integrator[0] += x;
+  for (stage = 1; stage < d->order; stage++) {
+    d->integrator[stage] += d->integrator[stage - 1];
+  }
+
+  d->count++;
+  if (d->count < (1U << d->log2_ratio)) return false;
+  d->count = 0;
+
+  y = d->integrator[d->order - 1];
+  for (stage = 0; stage < d->order; stage++) {
+    previous = d->comb_delay[stage];
+    d->comb_delay[stage] = y;
+    y -= previous;
+  }
+
+  // the first outputs still see the empty comb history
+  if (d->outputs_to_skip) {
+    d->outputs_to_skip--;
+    return false;
+  }
+
+  if (d->shift) y = (y + (1UL << (d->shift - 1))) >> d->shift;
+  d->output = (uint16_t)y;
+  return true;
+}
+
+
+uint16_t DEC_Output(const uint8_t i) {
+  return decimators[i].output;
+}
+
+
+uint16_t DEC_OutputAt(const uint8_t i, const uint8_t bits) {
+  const decimator_t *d = &decimators[i];
+  uint8_t shift;
+
+  if (bits < d->output_bits) {
+    shift = d->output_bits - bits;
+    return (uint16_t)(((uint32_t)d->output + (1UL << (shift - 1))) >> shift);
+  }
+  return d->output << (bits - d->output_bits);
+}
+
+
+uint8_t DEC_OutputBits(const uint8_t i) {
+  return decimators[i].output_bits;
+}
+
+//---------------------------Private Function Definitions-----------------------
+static uint8_t Limit(const uint8_t x, const uint8_t low, const uint8_t high) {
+  if (x < low) return low;
+  else if (high < x) return high;
+  return x;
+}
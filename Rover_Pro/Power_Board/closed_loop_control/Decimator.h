@@ -0,0 +1,79 @@
+/*==============================================================================
+File: Decimator.h
+
+Description: This module encapsulates a per-channel oversampling/decimation
+  stage for the analog inputs.  Each decimator is a cascaded integrator-comb
+  (CIC) filter: it sums its input at the sample rate and delivers one output
+  every 'ratio' samples.  A first-order CIC is a running-sum boxcar; a second
+  order one rejects more of the noise between outputs at the cost of twice
+  the delay.  Averaging N samples of uncorrelated noise improves the signal
+  to noise ratio by sqrt(N), so slow channels can report more bits than the
+  converter provides.
+
+Notes:
+  - integer math only
+  - ratios are powers of two, so the gain of the filter (ratio^order) is
+    removed with a shift
+  - the integrators are allowed to wrap; a CIC output is still exact as long
+    as the output itself fits in 32 bits
+  - until the combs are filled the output is the first input, scaled to the
+    output resolution, so consumers never read zero after a (re)configure
+  - define TEST_DECIMATOR and build this file alone on a PC to run a check
+    of the noise reduction on synthetic signals:
+      gcc -DTEST_DECIMATOR Decimator.c && ./a.out
+==============================================================================*/
+#ifndef DECIMATOR_H
+#define DECIMATOR_H
+//---------------------------Dependencies---------------------------------------
+#include <stdint.h>
+#include <stdbool.h>
+
+//---------------------------Macros---------------------------------------------
+#define MAX_NUM_DECIMATORS    9
+#define DEC_MAX_ORDER         2
+#define DEC_MAX_LOG2_RATIO    7     // ratio of 128
+#define DEC_MAX_OUTPUT_BITS   16
+
+//---------------------------Public Functions-----------------------------------
+// Function: DEC_Init
+// Description: (Re)configures a decimator and clears its history.  Values
+//   out of range are clamped; the output resolution is limited to what the
+//   filter can actually deliver (input_bits + order * log2_ratio).
+// Parameters:
+//   uint8_t i,             the index (0-based) of the decimator
+//   uint8_t input_bits,    resolution of the samples, e.g. 10 for the A/D
+//   uint8_t order,         1 (boxcar) or 2
+//   uint8_t log2_ratio,    outputs are produced every 2^log2_ratio samples
+//   uint8_t output_bits,   resolution of the output
+void DEC_Init(const uint8_t i, const uint8_t input_bits, const uint8_t order,
+              const uint8_t log2_ratio, const uint8_t output_bits);
+
+
+// Function: DEC_Update
+// Returns:
+//   bool, whether this sample completed a new output
+// Parameters:
+//   uint8_t i,             the index (0-based) of the decimator
+//   uint16_t x,            the newest sample
+bool DEC_Update(const uint8_t i, const uint16_t x);
+
+
+// Function: DEC_Output
+// Returns:
+//   uint16_t, the latest output at the configured output resolution
+uint16_t DEC_Output(const uint8_t i);
+
+
+// Function: DEC_OutputAt
+// Returns:
+//   uint16_t, the latest output rounded to the given resolution, e.g. 10 bits
+//   for code written against the raw A/D counts
+uint16_t DEC_OutputAt(const uint8_t i, const uint8_t bits);
+
+
+// Function: DEC_OutputBits
+// Returns:
+//   uint8_t, the output resolution after clamping by DEC_Init()
+uint8_t DEC_OutputBits(const uint8_t i);
+
+#endif
@@ -0,0 +1,69 @@
+/*==============================================================================
+File: FanCurve.c
+Notes:
+  - the hysteresis is a play operator on the temperature: the held
+    temperature is pushed up by a rising input and dragged down by a falling
+    one only once the input is more than the hysteresis below it, and the
+    curve is looked up at the held temperature
+==============================================================================*/
+//---------------------------Dependencies---------------------------------------
+#include "FanCurve.h"
+
+//---------------------------Module Variables-----------------------------------
+static fan_curve_t fan_curve;
+static int16_t held;
+static uint8_t held_valid = 0;
+
+//---------------------------Helper Function Prototypes-------------------------
+static uint8_t Lookup(const int16_t temperature);
+
+//---------------------------Public Function Definitions------------------------
+uint8_t FAN_CheckCurve(const fan_curve_t *curve) {
+  uint8_t i;
+
+  if (curve->hysteresis < 0) return 0;
+  for (i = 1; i < FAN_CURVE_POINTS; i++) {
+    if (curve->temperature[i] <= curve->temperature[i - 1]) return 0;
+  }
+  return 1;
+}
+
+
+void FAN_SetCurve(const fan_curve_t *curve) {
+  fan_curve = *curve;
+  held_valid = 0;
+}
+
+
+void FAN_GetCurve(fan_curve_t *curve) {
+  *curve = fan_curve;
+}
+
+
+uint8_t FAN_Duty(const int16_t temperature) {
+  if (!held_valid || temperature > held) {
+    held = temperature;
+    held_valid = 1;
+  } else if ((int32_t)temperature < (int32_t)held - fan_curve.hysteresis) {
+    held = temperature + fan_curve.hysteresis;
+  }
+  return Lookup(held);
+}
+
+//---------------------------Private Function Definitions-----------------------
+static uint8_t Lookup(const int16_t temperature) {
+  const fan_curve_t *c = &fan_curve;
+  int32_t span, offset, rise;
+  uint8_t i;
+
+  if (temperature < c->temperature[0]) return 0;
+  for (i = 1; i < FAN_CURVE_POINTS; i++) {
+    if (temperature < c->temperature[i]) {
+      span = (int32_t)c->temperature[i] - c->temperature[i - 1];
+      offset = (int32_t)temperature - c->temperature[i - 1];
+      rise = (int32_t)c->duty[i] - c->duty[i - 1];
+      return (uint8_t)(c->duty[i - 1] + (rise * offset) / span);
+    }
+  }
+  return c->duty[FAN_CURVE_POINTS - 1];
+}
@@ -0,0 +1,56 @@
+/*==============================================================================
+File: FanCurve.h
+
+Description: This module maps a temperature to a fan duty cycle through a
+  piecewise-linear curve.  Below the first point of the curve the fan is
+  off, between points the duty is interpolated, and above the last point it
+  stays at the last duty.  A hysteresis band keeps the fan from hunting: the
+  duty follows a rising temperature right away, but only comes down once the
+  temperature has fallen the hysteresis below where it peaked.
+
+Notes:
+  - integer math only
+  - temperatures are in 0.1 degC, the duty is in the fan controller's units
+  - the temperatures of the curve points must be strictly ascending
+==============================================================================*/
+#ifndef FAN_CURVE_H
+#define FAN_CURVE_H
+//---------------------------Dependencies---------------------------------------
+#include <stdint.h>
+
+//---------------------------Macros---------------------------------------------
+#define FAN_CURVE_POINTS        4
+
+//---------------------------Type Definitions-----------------------------------
+typedef struct {
+  int16_t temperature[FAN_CURVE_POINTS];  // [0.1 degC], ascending
+  uint8_t duty[FAN_CURVE_POINTS];
+  int16_t hysteresis;                     // [0.1 degC], 0 or more
+} fan_curve_t;
+
+//---------------------------Public Functions-----------------------------------
+// Function: FAN_CheckCurve
+// Returns:
+//   uint8_t, 1 if the curve can be used, 0 if not
+uint8_t FAN_CheckCurve(const fan_curve_t *curve);
+
+
+// Function: FAN_SetCurve
+// Description: Copies a curve that passed FAN_CheckCurve() and forgets the
+//   temperature history, so the next duty follows the new curve at once.
+void FAN_SetCurve(const fan_curve_t *curve);
+
+
+// Function: FAN_GetCurve
+// Description: Copies the curve in use.
+void FAN_GetCurve(fan_curve_t *curve);
+
+
+// Function: FAN_Duty
+// Parameters:
+//   int16_t temperature,     the temperature to cool for [0.1 degC]
+// Returns:
+//   uint8_t, the duty of the curve at the temperature, after hysteresis
+uint8_t FAN_Duty(const int16_t temperature);
+
+#endif
@@ -0,0 +1,132 @@
+/*==============================================================================
+File: Observer.c
+Notes:
+  - model:      speed_ss = duty_gain * (duty - duty_offset)
+                accel    = (speed_ss - speed) / time_constant + disturbance
+  - correction: error        = measured - speed
+                speed       += speed_gain * error
+                disturbance += disturbance_gain * error * (1000 / period)
+  - the disturbance is an acceleration, so its correction is scaled by the
+    update rate to keep the gain meaningful per update
+
+See also:
+  - "Observers in Control Systems" by George Ellis
+==============================================================================*/
+//---------------------------Dependencies---------------------------------------
+#include "Observer.h"
+#include <stdlib.h>   // for labs() function
+
+//---------------------------Macros and Definitions-----------------------------
+#define MS_PER_S            1000
+#define GAIN_BITS           8
+#define ONE                 (1L << OBS_FRACTION_BITS)
+#define MAX_SPEED           (4000L * ONE)     // keeps every product in 32 bits
+#define MAX_ACCELERATION    (100000L * ONE)   // [units/s]
+
+typedef struct {
+  observer_model_t model;
+  uint16_t period_ms;
+  int32_t speed;              // with fraction bits
+  int32_t acceleration;       // [units/s], with fraction bits
+  int32_t disturbance;        // [units/s], with fraction bits
+  uint32_t ms_since_edge;
+} observer_t;
+
+//---------------------------Module Variables-----------------------------------
+static observer_t observers[MAX_NUM_OBSERVERS];
+
+//---------------------------Helper Function Prototypes-------------------------
+static int32_t SteadyStateSpeed(const observer_model_t *model,
+                                const int16_t duty);
+static void Correct(observer_t *o, const int32_t measured_speed);
+static int32_t Clamp(const int32_t x, const int32_t limit);
+
+//---------------------------Public Function Definitions------------------------
+void OBS_Init(const uint8_t i, const uint16_t period_ms,
+              const observer_model_t *model) {
+  observers[i].model = *model;
+  if (observers[i].model.duty_gain_den == 0) observers[i].model.duty_gain_den = 1;
+  if (observers[i].model.time_constant_ms == 0) observers[i].model.time_constant_ms = 1;
+  observers[i].period_ms = (period_ms == 0) ? 1 : period_ms;
+  OBS_Reset(i);
+}
+
+
+void OBS_Update(const uint8_t i, const int16_t duty,
+                const uint8_t has_new_edge, const int16_t measured_speed) {
+  observer_t *o = &observers[i];
+  int32_t speed_ss, bound;
+
+  // predict
+  speed_ss = SteadyStateSpeed(&o->model, duty);
+  o->acceleration = Clamp(((speed_ss - o->speed) * MS_PER_S) /
+                          o->model.time_constant_ms, MAX_ACCELERATION);
+  o->acceleration += o->disturbance;
+  o->speed += (o->acceleration / MS_PER_S) * o->period_ms;
+  o->speed = Clamp(o->speed, MAX_SPEED);
+
+  // correct
+  if (has_new_edge) {
+    o->ms_since_edge = 0;
+    Correct(o, (int32_t)measured_speed * ONE);
+    return;
+  }
+
+  // no edge yet -- the motor cannot be faster than one edge per elapsed time
+  o->ms_since_edge += o->period_ms;
+  bound = ((int32_t)o->model.edge_speed_ms * ONE) / o->ms_since_edge;
+  if (bound < labs(o->speed)) {
+    Correct(o, (o->speed < 0) ? -bound : bound);
+  }
+}
+
+
+int16_t OBS_Speed(const uint8_t i) {
+  return (int16_t)(observers[i].speed / ONE);
+}
+
+
+int16_t OBS_Acceleration(const uint8_t i) {
+  return (int16_t)Clamp(observers[i].acceleration / ONE, INT16_MAX);
+}
+
+
+void OBS_Reset(const uint8_t i) {
+  observers[i].speed = 0;
+  observers[i].acceleration = 0;
+  observers[i].disturbance = 0;
+  observers[i].ms_since_edge = 0;
+}
+
+//---------------------------Private Function Definitions-----------------------
+static int32_t SteadyStateSpeed(const observer_model_t *model,
+                                const int16_t duty) {
+  int32_t magnitude = labs(duty) - model->duty_offset;
+  if (magnitude <= 0) return 0;
+
+  magnitude = (magnitude * model->duty_gain_num) / model->duty_gain_den;
+
+  magnitude = Clamp(magnitude * ONE, MAX_SPEED);
+  return (duty < 0) ? -magnitude : magnitude;
+}
+
+
+static void Correct(observer_t *o, const int32_t measured_speed) {
+  int32_t error = Clamp(measured_speed - o->speed, MAX_SPEED);
+  int32_t disturbance_step;
+
+  o->speed += (error >> GAIN_BITS) * o->model.speed_gain;
+  o->speed = Clamp(o->speed, MAX_SPEED);
+
+  disturbance_step = ((error >> GAIN_BITS) * o->model.disturbance_gain /
+                      o->period_ms) * MS_PER_S;
+  o->disturbance += Clamp(disturbance_step, MAX_ACCELERATION);
+  o->disturbance = Clamp(o->disturbance, MAX_ACCELERATION);
+}
+
+
+static int32_t Clamp(const int32_t x, const int32_t limit) {
+  if (limit < x) return limit;
+  else if (x < -limit) return -limit;
+  return x;
+}
@@ -0,0 +1,83 @@
+/*==============================================================================
+File: Observer.h
+
+Description: This module encapsulates a per-motor velocity observer.  A
+  first-order motor model, driven by the applied duty, predicts speed and
+  acceleration every update; tach edges correct the prediction (Luenberger
+  form), and a disturbance term absorbs whatever the model gets wrong (load,
+  slope, friction).  Load is left to the disturbance term rather than
+  modelled from the motor current.  Between tach edges the
+  estimate keeps moving with the model instead of holding the last period.
+
+Notes:
+  - integer math only, speed and acceleration carry OBS_FRACTION_BITS of
+    fraction internally
+  - speeds are in the units returned by DT_speed(), accelerations in
+    speed units/s
+  - at crawl speeds tach edges are far apart; while no edge arrives, the
+    time since the last one bounds how fast the motor can be turning, and
+    the estimate is corrected toward that bound whenever it exceeds it
+  - gains are per update and scaled by 256: a speed_gain of 256 trusts the
+    tach completely, 0 ignores it
+
+Tuning Considerations.
+  - raise speed_gain for less lag, lower it for less tach noise
+  - disturbance_gain should be a small fraction of speed_gain
+==============================================================================*/
+#ifndef OBSERVER_H
+#define OBSERVER_H
+//---------------------------Dependencies---------------------------------------
+#include <stdint.h>   // for intN_t data types
+
+//---------------------------Macros---------------------------------------------
+#define MAX_NUM_OBSERVERS     3
+#define OBS_FRACTION_BITS     8
+
+//---------------------------Type Definitions-----------------------------------
+typedef struct {
+  int16_t duty_gain_num;      // steady-state speed per unit of duty, as a
+  int16_t duty_gain_den;      //   fraction num/den
+  int16_t duty_offset;        // duty needed before the motor turns at all
+  uint16_t time_constant_ms;  // mechanical time constant of the motor
+  uint16_t edge_speed_ms;     // speed * (ms between tach edges), a constant
+  uint8_t speed_gain;         // speed correction per update, /256
+  uint8_t disturbance_gain;   // disturbance correction per update, /256
+} observer_model_t;
+
+//---------------------------Public Functions-----------------------------------
+// Function: OBS_Init
+// Parameters:
+//   uint8_t i,                 the index (0-based) of the observer
+//   uint16_t period_ms,        the rate at which OBS_Update() will be called
+//   observer_model_t *model,   the motor model and observer gains
+void OBS_Init(const uint8_t i, const uint16_t period_ms,
+              const observer_model_t *model);
+
+
+// Function: OBS_Update
+// Parameters:
+//   uint8_t i,               the index (0-based) of the observer
+//   int16_t duty,            the duty applied over the last period (signed)
+//   uint8_t has_new_edge,    whether a tach edge arrived in the last period
+//   int16_t measured_speed,  the speed computed from the last tach period
+void OBS_Update(const uint8_t i, const int16_t duty,
+                const uint8_t has_new_edge, const int16_t measured_speed);
+
+
+// Function: OBS_Speed
+// Returns:
+//   int16_t, the estimated speed
+int16_t OBS_Speed(const uint8_t i);
+
+
+// Function: OBS_Acceleration
+// Returns:
+//   int16_t, the estimated acceleration [speed units/s]
+int16_t OBS_Acceleration(const uint8_t i);
+
+
+// Function: OBS_Reset
+// Description: Forgets the speed, acceleration and disturbance estimates.
+void OBS_Reset(const uint8_t i);
+
+#endif
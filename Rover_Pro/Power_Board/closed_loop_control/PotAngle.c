@@ -0,0 +1,260 @@
+/*==============================================================================
+File: PotAngle.c
+Notes:
+  - a pot reads 13.35 deg at 0 counts and 0.326 deg per count (333.3 deg over
+    1023 counts), kept here in 0.1 deg with 10 bits of fraction
+  - the blend weight of the pot closer to the end of its track is
+    (512 - |reading - 512|) / 512, the other pot gets the rest
+  - the blend works on the difference between the two angles, taken the
+    short way around, so that it cannot average across 0/360 deg
+==============================================================================*/
+//#define TEST_POT_ANGLE
+//---------------------------Dependencies---------------------------------------
+#include "PotAngle.h"
+#include <stdbool.h>
+
+//---------------------------Macros and Definitions-----------------------------
+#define FRACTION_BITS         10
+#define TENTHS_PER_COUNT      3338L     // 3.26 * 1024
+#define ZERO_COUNT_ANGLE      136704L   // 133.5 * 1024
+#define FULL_SCALE_COUNTS     1023
+#define CENTER_COUNTS         512
+#define WEIGHT_BITS           9         // weights are /512
+
+//---------------------------Module Variables-----------------------------------
+static pot_fusion_t fusion = {0, FULL_SCALE_COUNTS, 0, POT_FULL_TURN};
+
+//---------------------------Helper Function Prototypes-------------------------
+static bool IsValid(const uint16_t reading);
+static int32_t PotToAngle(const uint16_t reading);
+static uint16_t Distance(const uint16_t reading);
+
+#ifdef TEST_POT_ANGLE
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define LOW_POT_THRESHOLD 33
+#define HIGH_POT_THRESHOLD 990
+#define FLIPPER_POT_OFFSET -55
+
+// the float routine this module replaces, from device_robot_motor.c
+static unsigned int return_combined_pot_angle(unsigned int pot_1_value, unsigned int pot_2_value)
+{
+  int combined_pot_angle = 0;
+  int pot_angle_1 = 0;
+  int pot_angle_2 = 0;
+  int temp1 = 0;
+  int temp2 = 0;
+  float scale_factor = 0;
+  int temp_pot1_value = 0;
+
+  pot_2_value = 1023-pot_2_value;
+
+  if( ((pot_1_value < LOW_POT_THRESHOLD) || (pot_1_value > HIGH_POT_THRESHOLD)) &&
+      ((pot_2_value < LOW_POT_THRESHOLD) || (pot_2_value > HIGH_POT_THRESHOLD) ))
+  {
+    return 0xffff;
+  }
+  else if( (pot_1_value < LOW_POT_THRESHOLD) || (pot_1_value > HIGH_POT_THRESHOLD) )
+  {
+    combined_pot_angle = pot_2_value*.326+13.35;
+  }
+  else if( (pot_2_value < LOW_POT_THRESHOLD) || (pot_2_value > HIGH_POT_THRESHOLD) )
+  {
+    combined_pot_angle = (int)pot_1_value*.326+13.35+FLIPPER_POT_OFFSET;
+  }
+  else
+  {
+    temp1 = pot_1_value - 512;
+    temp2 = pot_2_value - 512;
+    temp_pot1_value = pot_1_value-168.8;
+    pot_angle_1 = temp_pot1_value*.326+13.35;
+    pot_angle_2 = pot_2_value*.326+13.35;
+    if(pot_angle_1 < 0) pot_angle_1+=360;
+    if(pot_angle_2 < 0) pot_angle_2+=360;
+    if(abs(temp1) > abs(temp2) )
+    {
+      scale_factor = ( 512-abs(temp1) )/ 512.0;
+      combined_pot_angle = pot_angle_1*scale_factor + pot_angle_2*(1-scale_factor);
+    }
+    else
+    {
+      scale_factor = (512-abs(temp2) )/ 512.0;
+      combined_pot_angle = pot_angle_2*scale_factor + pot_angle_1*(1-scale_factor);
+    }
+  }
+
+  if(combined_pot_angle > 360)
+    combined_pot_angle-=360;
+  else if(combined_pot_angle < 0)
+    combined_pot_angle  += 360;
+
+  return (unsigned int)combined_pot_angle;
+}
+
+// the readings of both pots with the flipper at angle [deg], a pot in its
+// dead zone reads 0
+static void Readings(const double angle, uint16_t *pot1, uint16_t *pot2) {
+  double counts;
+
+  counts = fmod(angle + 55 - 13.35 + 360, 360) / .326;
+  *pot1 = (counts <= FULL_SCALE_COUNTS) ? (uint16_t)floor(counts + 0.5) : 0;
+  counts = fmod(angle - 13.35 + 360, 360) / .326;
+  *pot2 = (counts <= FULL_SCALE_COUNTS) ?
+          FULL_SCALE_COUNTS - (uint16_t)floor(counts + 0.5) : FULL_SCALE_COUNTS;
+}
+
+// difference between two angles [0.1 deg] the short way around
+static int32_t AngleError(const int32_t a, const int32_t b) {
+  int32_t error = (a - b) % POT_FULL_TURN;
+  if (POT_FULL_TURN / 2 < error) error -= POT_FULL_TURN;
+  else if (error < -POT_FULL_TURN / 2) error += POT_FULL_TURN;
+  return error;
+}
+
+int main(void) {
+  const pot_fusion_t config = {LOW_POT_THRESHOLD, HIGH_POT_THRESHOLD,
+                               FLIPPER_POT_OFFSET * 10, 50};
+  int32_t worst_truth = 0, worst_legacy = 0, error;
+  int failures = 0, k;
+  uint16_t p1, p2, legacy;
+  pot_angle_t fused;
+
+  POT_Init(&config);
+
+  // the full turn, in 0.1 deg steps
+  for (k = 0; k < POT_FULL_TURN; k++) {
+    Readings(k / 10.0, &p1, &p2);
+    fused = POT_Fuse(p1, p2);
+    legacy = return_combined_pot_angle(p1, p2);
+    if (fused.angle == POT_INVALID_ANGLE || legacy == 0xffff) {
+      printf("FAIL: no angle at %d.%d deg\n", k / 10, k % 10);
+      failures++;
+      continue;
+    }
+    if (fused.confidence < kPotConfidenceSingle) {
+      printf("FAIL: confidence %d at %d.%d deg\n", fused.confidence,
+             k / 10, k % 10);
+      failures++;
+    }
+    error = labs(AngleError(fused.angle, k));
+    if (worst_truth < error) worst_truth = error;
+    error = labs(AngleError(fused.angle, legacy * 10L));
+    if (worst_legacy < error) worst_legacy = error;
+  }
+  printf("worst error: %ld tenths vs. the flipper, %ld tenths vs. the float "
+         "routine\n", (long)worst_truth, (long)worst_legacy);
+  // a count is 3.3 tenths; the float routine truncates to whole degrees,
+  // three times in a row
+  if (5 < worst_truth) { printf("FAIL: accuracy\n"); failures++; }
+  if (30 < worst_legacy) { printf("FAIL: float routine mismatch\n"); failures++; }
+
+  // every combination of readings, the float routine is only trusted where
+  // it does not blend across 0/360 deg
+  worst_legacy = 0;
+  for (p1 = 0; p1 <= FULL_SCALE_COUNTS; p1++) {
+    for (p2 = 0; p2 <= FULL_SCALE_COUNTS; p2++) {
+      fused = POT_Fuse(p1, p2);
+      legacy = return_combined_pot_angle(p1, p2);
+      if ((fused.angle == POT_INVALID_ANGLE) != (legacy == 0xffff)) {
+        printf("FAIL: validity at %u, %u\n", p1, p2);
+        failures++;
+      }
+      if (legacy == 0xffff || fused.confidence == kPotConfidenceDisagree)
+        continue;
+      error = labs(AngleError(fused.angle, legacy * 10L));
+      if (worst_legacy < error) worst_legacy = error;
+    }
+  }
+  printf("worst error vs. the float routine, all readings: %ld tenths\n",
+         (long)worst_legacy);
+  if (30 < worst_legacy) { printf("FAIL: float routine mismatch\n"); failures++; }
+
+  fused = POT_Fuse(0, FULL_SCALE_COUNTS);
+  if (fused.angle != POT_INVALID_ANGLE ||
+      fused.confidence != kPotConfidenceNone) {
+    printf("FAIL: dead zone\n");
+    failures++;
+  }
+
+  printf(failures ? "FAILED\n" : "passed\n");
+  return failures;
+}
+#endif
+
+//---------------------------Public Function Definitions------------------------
+void POT_Init(const pot_fusion_t *config) {
+  fusion = *config;
+}
+
+
+pot_angle_t POT_Fuse(const uint16_t pot1, const uint16_t pot2) {
+  const uint16_t reversed2 = FULL_SCALE_COUNTS - pot2;
+  const bool is_valid1 = IsValid(pot1);
+  const bool is_valid2 = IsValid(reversed2);
+  int32_t angle1, angle2, difference;
+  uint16_t weight;
+  pot_angle_t result;
+
+  angle1 = PotToAngle(pot1) + fusion.pot1_offset;
+  angle2 = PotToAngle(reversed2);
+
+  if (!is_valid1 && !is_valid2) {
+    result.angle = POT_INVALID_ANGLE;
+    result.confidence = kPotConfidenceNone;
+    return result;
+  } else if (!is_valid1) {
+    result.angle = POT_Wrap(angle2);
+    result.confidence = kPotConfidenceSingle;
+    return result;
+  } else if (!is_valid2) {
+    result.angle = POT_Wrap(angle1);
+    result.confidence = kPotConfidenceSingle;
+    return result;
+  }
+
+  difference = (int32_t)POT_Wrap(angle1 - angle2);
+  if (POT_FULL_TURN / 2 < difference) difference -= POT_FULL_TURN;
+
+  if (Distance(reversed2) < Distance(pot1)) {
+    // pot 1 is closer to the end of its track
+    weight = CENTER_COUNTS - Distance(pot1);
+    result.angle = POT_Wrap(angle2 + ((difference * weight) >> WEIGHT_BITS));
+  } else {
+    weight = CENTER_COUNTS - Distance(reversed2);
+    result.angle = POT_Wrap(angle1 - ((difference * weight) >> WEIGHT_BITS));
+  }
+
+  if (difference < 0) difference = -difference;
+  result.confidence = (fusion.agreement < difference) ?
+                      kPotConfidenceDisagree : kPotConfidenceBoth;
+  return result;
+}
+
+
+uint16_t POT_Wrap(const int32_t angle) {
+  int32_t wrapped = angle % POT_FULL_TURN;
+  if (wrapped < 0) wrapped += POT_FULL_TURN;
+  return (uint16_t)wrapped;
+}
+
+//---------------------------Private Function Definitions-----------------------
+static bool IsValid(const uint16_t reading) {
+  return (fusion.low_threshold <= reading) &&
+         (reading <= fusion.high_threshold);
+}
+
+
+// [0.1 deg], rounded
+static int32_t PotToAngle(const uint16_t reading) {
+  return ((int32_t)reading * TENTHS_PER_COUNT + ZERO_COUNT_ANGLE +
+          (1L << (FRACTION_BITS - 1))) >> FRACTION_BITS;
+}
+
+
+// how far the reading is from the middle of the track [counts]
+static uint16_t Distance(const uint16_t reading) {
+  return (reading < CENTER_COUNTS) ? CENTER_COUNTS - reading
+                                   : reading - CENTER_COUNTS;
+}
@@ -0,0 +1,69 @@
+/*==============================================================================
+File: PotAngle.h
+
+Description: This module fuses the two flipper potentiometers into one
+  flipper angle.  Each pot covers about 333 degrees of a turn and has a dead
+  zone over the rest; the pots are mounted at different angles so that
+  there is always at least one of them outside its dead zone.  While both
+  read, the angles are blended, giving less weight to the pot that is
+  closer to the end of its track.
+
+Notes:
+  - integer math only, so it is cheap enough to run at the A/D rate
+  - readings are 10-bit A/D counts, angles are in 0.1 degrees, [0, 3600)
+  - pot 2 turns the opposite direction to pot 1
+  - a reading outside [low_threshold, high_threshold] is in the dead zone
+    (or the pot is disconnected) and is ignored
+==============================================================================*/
+#ifndef POTANGLE_H
+#define POTANGLE_H
+//---------------------------Dependencies---------------------------------------
+#include <stdint.h>
+
+//---------------------------Macros---------------------------------------------
+#define POT_FULL_TURN           3600    // [0.1 deg]
+#define POT_INVALID_ANGLE       0xffff
+
+//---------------------------Type Definitions-----------------------------------
+typedef struct {
+  uint16_t low_threshold;       // [counts] lowest reading outside the dead zone
+  uint16_t high_threshold;      // [counts] highest reading outside the dead zone
+  int16_t pot1_offset;          // [0.1 deg] added to the angle read by pot 1
+  int16_t agreement;            // [0.1 deg] largest pot 1/pot 2 difference
+                                // still called consistent
+} pot_fusion_t;
+
+typedef enum {
+  kPotConfidenceNone = 0,       // both pots in their dead zones, no angle
+  kPotConfidenceDisagree,       // both pots read, but disagree
+  kPotConfidenceSingle,         // one pot in its dead zone
+  kPotConfidenceBoth,           // both pots read and agree
+} kPotConfidence;
+
+typedef struct {
+  uint16_t angle;               // [0.1 deg], or POT_INVALID_ANGLE
+  kPotConfidence confidence;
+} pot_angle_t;
+
+//---------------------------Public Functions-----------------------------------
+// Function: POT_Init
+// Parameters:
+//   pot_fusion_t *config,  the dead zone and mounting of the pots
+void POT_Init(const pot_fusion_t *config);
+
+
+// Function: POT_Fuse
+// Returns:
+//   pot_angle_t, the combined angle and how far to trust it
+// Parameters:
+//   uint16_t pot1,         the reading of pot 1 [counts]
+//   uint16_t pot2,         the reading of pot 2 [counts]
+pot_angle_t POT_Fuse(const uint16_t pot1, const uint16_t pot2);
+
+
+// Function: POT_Wrap
+// Returns:
+//   uint16_t, angle brought into [0, POT_FULL_TURN)
+uint16_t POT_Wrap(const int32_t angle);
+
+#endif
@@ -0,0 +1,90 @@
+/*==============================================================================
+File: Precharge.c
+Notes:
+  - lowest is the lowest bus voltage seen since PRE_Start(), the voltage
+    tests need it below their threshold
+==============================================================================*/
+//---------------------------Dependencies---------------------------------------
+#include "Precharge.h"
+
+//---------------------------Module Variables-----------------------------------
+static precharge_config_t config;
+static uint16_t width;
+static uint16_t pulses;
+static uint16_t last_bus;
+static uint16_t lowest;
+static uint8_t settled;
+
+//---------------------------Helper Function Prototypes-------------------------
+static uint8_t BusReady(const uint16_t bus_mV, const uint16_t source_mV,
+                        const int32_t rise);
+
+//---------------------------Public Function Definitions------------------------
+void PRE_Start(const precharge_config_t *c, const uint16_t bus_mV) {
+  config = *c;
+  if (config.pulse_max < config.pulse_min) config.pulse_max = config.pulse_min;
+  width = config.pulse_start;
+  if (width < config.pulse_min) width = config.pulse_min;
+  if (config.pulse_max < width) width = config.pulse_max;
+  pulses = 0;
+  last_bus = bus_mV;
+  lowest = bus_mV;
+  settled = 0;
+}
+
+
+uint16_t PRE_PulseWidth(void) {
+  return width;
+}
+
+
+uint8_t PRE_Update(const uint16_t bus_mV, const uint16_t source_mV,
+                   const uint16_t peak_mA) {
+  const int32_t rise = (int32_t)bus_mV - last_bus;
+  uint32_t longer;
+
+  pulses++;
+  last_bus = bus_mV;
+  if (bus_mV < lowest) lowest = bus_mV;
+
+  if (peak_mA <= config.inrush_limit) {
+    // left on, the switch would draw what it drew at the end of the pulse
+    if (config.pulse_max <= width) return PRE_DONE;
+    if (BusReady(bus_mV, source_mV, rise)) return PRE_DONE;
+  } else {
+    settled = 0;
+  }
+  if (config.max_pulses <= pulses) return PRE_FAILED;
+
+  if (config.inrush_limit < peak_mA || config.max_step < rise) {
+    width /= 2;
+    if (width < config.pulse_min) width = config.pulse_min;
+  } else if (peak_mA < config.inrush_limit - config.inrush_limit / 4 &&
+             rise < config.max_step / 2) {
+    longer = (uint32_t)width + width / 4 + 1;
+    width = (config.pulse_max < longer) ? config.pulse_max : (uint16_t)longer;
+  }
+  return PRE_RUNNING;
+}
+
+
+uint16_t PRE_Pulses(void) {
+  return pulses;
+}
+
+//---------------------------Private Function Definitions-----------------------
+static uint8_t BusReady(const uint16_t bus_mV, const uint16_t source_mV,
+                        const int32_t rise) {
+  if (source_mV != 0) {
+    return ((int32_t)lowest + config.tolerance < source_mV) &&
+           ((int32_t)source_mV <= (int32_t)bus_mV + config.tolerance);
+  }
+
+  if (lowest < config.min_bus && config.min_bus <= bus_mV &&
+      rise < config.settle_rise) {
+    if (++settled >= config.settle_pulses) return 1;
+  } else {
+    settled = 0;
+  }
+  return 0;
+}
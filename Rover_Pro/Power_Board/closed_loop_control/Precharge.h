@@ -0,0 +1,83 @@
+/*==============================================================================
+File: Precharge.h
+
+Description: This module decides the pulses that soft-start (precharge) a
+  capacitive bus through a switch.  The switch is pulsed on for the pulse
+  width, then left off while the bus voltage and the peak current seen during
+  the pulse are measured, and the measurements are passed to PRE_Update(),
+  which adapts the pulse width to the inrush and says when the switch can be
+  left on:
+    - a pulse whose peak current went over the inrush limit, or that raised
+      the bus by more than the maximum step, halves the width; one well under
+      both (under 3/4 of the limit and half the step) lengthens it by a quarter
+    - the precharge is done once a pulse stays under the inrush limit and
+      either the bus is within the tolerance of the source voltage, or (when
+      the source voltage is not known) the bus has settled above the minimum
+      bus voltage, or the pulse is already the longest allowed
+    - the voltage tests only count if the bus was seen below their threshold,
+      so a bus that reads high from the start is only trusted on its current
+
+Notes:
+  - integer math only
+  - the peak current is whatever the caller sampled during the pulse, the
+    inrush into a stiff capacitance can be over before the next sample, so
+    the voltage step, which is the charge the pulse delivered, bounds it too
+==============================================================================*/
+#ifndef PRECHARGE_H
+#define PRECHARGE_H
+//---------------------------Dependencies---------------------------------------
+#include <stdint.h>
+
+//---------------------------Macros---------------------------------------------
+// PRE_Update() results
+#define PRE_RUNNING             0
+#define PRE_DONE                1
+#define PRE_FAILED              2
+
+//---------------------------Type Definitions-----------------------------------
+typedef struct {
+  uint16_t pulse_min;           // [us]
+  uint16_t pulse_max;           // [us]
+  uint16_t pulse_start;         // [us]
+  uint16_t inrush_limit;        // [mA]
+  uint16_t max_step;            // [mV] of bus rise per pulse
+  uint16_t tolerance;           // [mV] from the source voltage
+  uint16_t min_bus;             // [mV] when the source voltage is not known
+  uint16_t settle_rise;         // [mV] per pulse, when the source is not known
+  uint8_t settle_pulses;        // in a row under settle_rise
+  uint16_t max_pulses;
+} precharge_config_t;
+
+//---------------------------Public Functions-----------------------------------
+// Function: PRE_Start
+// Parameters:
+//   precharge_config_t *config, copied
+//   uint16_t bus_mV,            the bus voltage before the first pulse [mV]
+void PRE_Start(const precharge_config_t *config, const uint16_t bus_mV);
+
+
+// Function: PRE_PulseWidth
+// Returns:
+//   uint16_t, the width of the next pulse [us]
+uint16_t PRE_PulseWidth(void);
+
+
+// Function: PRE_Update
+// Description: Call once after every pulse, when the bus has been measured.
+// Parameters:
+//   uint16_t bus_mV,            the bus voltage after the pulse [mV]
+//   uint16_t source_mV,         the source voltage [mV], 0 if not known
+//   uint16_t peak_mA,           the peak current during the pulse [mA]
+// Returns:
+//   uint8_t, PRE_DONE when the switch can be left on, PRE_FAILED after
+//   max_pulses, PRE_RUNNING otherwise
+uint8_t PRE_Update(const uint16_t bus_mV, const uint16_t source_mV,
+                   const uint16_t peak_mA);
+
+
+// Function: PRE_Pulses
+// Returns:
+//   uint16_t, the pulses since PRE_Start()
+uint16_t PRE_Pulses(void);
+
+#endif
@@ -0,0 +1,81 @@
+/*==============================================================================
+File: SkidSteer.c
+Notes:
+  - left  = v - w*W/2
+    right = v + w*W/2
+  - all intermediate values are 32-bit: 32767 mrad/s * 65535 mm still fits
+==============================================================================*/
+//---------------------------Dependencies---------------------------------------
+#include "SkidSteer.h"
+#include <stdlib.h>   // for labs() function
+
+//---------------------------Macros and Definitions-----------------------------
+#define MRAD_PER_RAD        1000
+
+//---------------------------Module Variables-----------------------------------
+static int32_t track_width = 1;         // [mm]
+static int32_t full_scale_speed = 1;    // [mm/s]
+static int32_t max_wheel = 0;
+static int32_t max_angular = INT16_MAX; // [mrad/s]
+static int32_t max_spin_wheel = 0;
+
+//---------------------------Helper Function Prototypes-------------------------
+static int32_t Clamp(const int32_t x, const int32_t limit);
+
+//---------------------------Public Function Definitions------------------------
+void SKID_Init(const uint16_t track_width_mm, const uint16_t speed_mm_s,
+               const int16_t max_wheel_command) {
+  track_width = (track_width_mm == 0) ? 1 : track_width_mm;
+  full_scale_speed = (speed_mm_s == 0) ? 1 : speed_mm_s;
+  max_wheel = labs(max_wheel_command);
+  max_angular = INT16_MAX;
+  max_spin_wheel = max_wheel;
+}
+
+
+void SKID_SetTurnLimits(const uint16_t max_angular_mrad_s,
+                        const uint16_t max_spin_wheel_command) {
+  if (max_angular_mrad_s != 0) max_angular = max_angular_mrad_s;
+  if (max_spin_wheel_command != 0) {
+    max_spin_wheel = max_spin_wheel_command;
+    if (max_wheel < max_spin_wheel) max_spin_wheel = max_wheel;
+  }
+}
+
+
+void SKID_Mix(const int16_t linear, const int16_t angular,
+              int16_t *left, int16_t *right) {
+  int32_t half_difference, left_wheel, right_wheel, largest, limit;
+
+  // wheel ground speeds [mm/s]
+  half_difference = (Clamp(angular, max_angular) * track_width) /
+                    (2 * MRAD_PER_RAD);
+  left_wheel = (int32_t)linear - half_difference;
+  right_wheel = (int32_t)linear + half_difference;
+
+  // wheel commands
+  left_wheel = (left_wheel * max_wheel) / full_scale_speed;
+  right_wheel = (right_wheel * max_wheel) / full_scale_speed;
+
+  // scale both sides together so the curvature survives saturation
+  limit = max_wheel;
+  if ((left_wheel < 0) != (right_wheel < 0)) limit = max_spin_wheel;
+
+  largest = labs(left_wheel);
+  if (largest < labs(right_wheel)) largest = labs(right_wheel);
+
+  if (limit < largest) {
+    left_wheel = (left_wheel * limit) / largest;
+    right_wheel = (right_wheel * limit) / largest;
+  }
+
+  *left = (int16_t)left_wheel;
+  *right = (int16_t)right_wheel;
+}
+
+//---------------------------Private Function Definitions-----------------------
+static int32_t Clamp(const int32_t x, const int32_t limit) {
+  if (limit < x) return limit;
+  else if (x < -limit) return -limit;
+  return x;
+}
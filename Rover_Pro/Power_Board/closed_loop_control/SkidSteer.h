@@ -0,0 +1,53 @@
+/*==============================================================================
+File: SkidSteer.h
+
+Description: This module mixes a body twist command -- linear velocity v and
+  angular velocity w -- into left and right wheel commands for a skid-steer
+  chassis.  Initialize the mixer with the chassis geometry, then call
+  SKID_Mix() at the control rate.
+
+Notes:
+  - twist units are SI scaled for integer math: v in mm/s, w in mrad/s
+    (counter-clockwise positive, seen from above)
+  - wheel commands are in the same units as REG_MOTOR_VELOCITY
+  - when either wheel would exceed its limit, BOTH wheels are scaled by the
+    same factor so that the commanded curvature (v/w) is preserved
+  - the track width is the EFFECTIVE one, which on a skid-steer chassis is
+    wider than the physical one because the tracks slip while turning
+==============================================================================*/
+#ifndef SKID_STEER_H
+#define SKID_STEER_H
+//---------------------------Dependencies---------------------------------------
+#include <stdint.h>   // for intN_t data types
+
+//---------------------------Public Functions-----------------------------------
+// Function: SKID_Init
+// Parameters:
+//   uint16_t track_width_mm,   effective track width [mm]
+//   uint16_t speed_mm_s,       ground speed at the largest wheel command [mm/s]
+//   int16_t max_wheel_command, largest wheel command magnitude
+void SKID_Init(const uint16_t track_width_mm, const uint16_t speed_mm_s,
+               const int16_t max_wheel_command);
+
+
+// Function: SKID_SetTurnLimits
+// Description: Limits how hard the chassis may turn.  A limit of zero (0)
+//   leaves the corresponding value unchanged.
+// Parameters:
+//   uint16_t max_angular_mrad_s,     largest angular velocity magnitude
+//   uint16_t max_spin_wheel_command, largest wheel command magnitude while
+//                                    the wheels turn in opposite directions
+void SKID_SetTurnLimits(const uint16_t max_angular_mrad_s,
+                        const uint16_t max_spin_wheel_command);
+
+
+// Function: SKID_Mix
+// Parameters:
+//   int16_t linear,            commanded linear velocity [mm/s]
+//   int16_t angular,           commanded angular velocity [mrad/s]
+//   int16_t *left,             resulting left wheel command
+//   int16_t *right,            resulting right wheel command
+void SKID_Mix(const int16_t linear, const int16_t angular,
+              int16_t *left, int16_t *right);
+
+#endif
@@ -0,0 +1,142 @@
+/*==============================================================================
+File: Thermal.c
+Notes:
+  - the state is the normalized rise, theta = rise / max_rise, with
+    THETA_FRACTION_BITS of fraction; the heating input is (I / I_rated)^2 in
+    the same scale, so theta settles at 1 under the rated current
+  - each integration moves theta toward the heating input by
+    (heat - theta) * ticks / tau_ticks, the part of a step that does not
+    amount to a whole count is carried to the next integration, so slow
+    time constants still integrate exactly at a fast rate
+==============================================================================*/
+//---------------------------Dependencies---------------------------------------
+#include "Thermal.h"
+
+//---------------------------Macros and Definitions-----------------------------
+#define US_PER_S                1000000L
+#define THETA_FRACTION_BITS     12
+#define THETA_ONE               (1L << THETA_FRACTION_BITS)
+#define MAX_TICKS               1000
+
+typedef struct {
+  uint16_t rated_mA;
+  int32_t tau_ticks;
+  int16_t max_rise;             // [0.1 degC] at theta = 1
+  int16_t ambient;              // [0.1 degC]
+  int16_t start;                // [0.1 degC]
+  int16_t limit;                // [0.1 degC]
+  uint8_t min_factor;
+} thermal_model_t;
+
+typedef struct {
+  int32_t theta;                // with fraction bits
+  int32_t residual;             // [theta * ticks], less than one step
+} thermal_state_t;
+
+//---------------------------Module Variables-----------------------------------
+static thermal_model_t models[MAX_NUM_THERMAL_MODELS];
+static thermal_state_t states[MAX_NUM_THERMAL_MODELS] = {{0}};
+
+//---------------------------Helper Function Prototypes-------------------------
+static int32_t Limit(const int32_t x, const int32_t low, const int32_t high);
+static int32_t Heat(const uint16_t rated_mA, const int16_t current_mA);
+
+//---------------------------Public Function Definitions------------------------
+void THERM_Init(const uint8_t i, const uint16_t tick_us,
+                const uint16_t rated_mA, const uint16_t tau_s,
+                const int16_t max_rise) {
+  thermal_model_t *m = &models[i];
+  const uint16_t tick = (tick_us == 0) ? 1 : tick_us;
+
+  m->rated_mA = (rated_mA == 0) ? 1 : rated_mA;
+  m->tau_ticks = (int32_t)((tau_s == 0) ? 1 : tau_s) * (US_PER_S / tick);
+  m->max_rise = max_rise;
+  m->ambient = 0;
+  m->start = INT16_MAX;
+  m->limit = INT16_MAX;
+  m->min_factor = THERM_FULL_SCALE - 1;
+  states[i].theta = 0;
+  states[i].residual = 0;
+}
+
+
+void THERM_SetRatedCurrent(const uint8_t i, const uint16_t rated_mA) {
+  if (rated_mA != 0) models[i].rated_mA = rated_mA;
+}
+
+
+void THERM_SetLimits(const uint8_t i, const int16_t ambient,
+                     const int16_t start, const int16_t limit,
+                     const uint8_t min_factor) {
+  thermal_model_t *m = &models[i];
+
+  m->ambient = ambient;
+  m->start = start;
+  m->limit = (limit < start) ? start : limit;
+  m->min_factor = min_factor;
+}
+
+
+void THERM_Integrate(const uint8_t i, const int16_t current_mA,
+                     const uint16_t ticks) {
+  thermal_state_t *s = &states[i];
+  const int32_t tau_ticks = models[i].tau_ticks;
+  int32_t step;
+
+  // |heat - theta| < 64 * THETA_ONE, times MAX_TICKS stays in 32 bits
+  s->residual += (Heat(models[i].rated_mA, current_mA) - s->theta) *
+                 (int32_t)((ticks < MAX_TICKS) ? ticks : MAX_TICKS);
+  step = s->residual / tau_ticks;
+  s->residual -= step * tau_ticks;
+  s->theta += step;
+  if (s->theta < 0) s->theta = 0;
+}
+
+
+int16_t THERM_Temperature(const uint8_t i) {
+  const thermal_model_t *m = &models[i];
+  int32_t rise;
+
+  // theta * max_rise, with 4 of the fraction bits dropped first
+  rise = ((states[i].theta >> 4) * m->max_rise) >>
+         (THETA_FRACTION_BITS - 4);
+  return (int16_t)Limit((int32_t)m->ambient + rise, INT16_MIN, INT16_MAX);
+}
+
+
+uint16_t THERM_Derate(const uint8_t i) {
+  const thermal_model_t *m = &models[i];
+  const int32_t temperature = THERM_Temperature(i);
+  int32_t span;
+
+  if (temperature <= m->start) return THERM_FULL_SCALE;
+  if (m->limit <= temperature) return m->min_factor;
+
+  span = (int32_t)m->limit - m->start;
+  return (uint16_t)(THERM_FULL_SCALE -
+                    ((THERM_FULL_SCALE - m->min_factor) *
+                     (temperature - m->start)) / span);
+}
+
+//---------------------------Private Function Definitions-----------------------
+static int32_t Limit(const int32_t x, const int32_t low, const int32_t high) {
+  if (x < low) return low;
+  else if (high < x) return high;
+  return x;
+}
+
+
+// (I / I_rated)^2 with THETA_FRACTION_BITS of fraction
+static int32_t Heat(const uint16_t rated_mA, const int16_t current_mA) {
+  uint32_t current, squared;
+
+  current = (current_mA < 0) ? -(int32_t)current_mA : current_mA;
+  if ((uint32_t)rated_mA * THERM_MAX_OVERLOAD < current)
+    current = (uint32_t)rated_mA * THERM_MAX_OVERLOAD;
+
+  // I^2 / I_rated is at most 64 * I_rated, then / I_rated again in two
+  // parts so that the fraction bits do not overflow
+  squared = (current * current) / rated_mA;
+  return (int32_t)(((squared / rated_mA) << THETA_FRACTION_BITS) +
+                   (((squared % rated_mA) << THETA_FRACTION_BITS) / rated_mA));
+}
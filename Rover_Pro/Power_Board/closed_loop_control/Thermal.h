@@ -0,0 +1,86 @@
+/*==============================================================================
+File: Thermal.h
+
+Description: This module encapsulates an I^2*t (first-order) thermal model of
+  each motor winding.  The squared motor current heats the model and it
+  cools toward ambient with the winding's thermal time constant, so it
+  predicts the winding temperature without a sensor on it.  As the estimate
+  approaches its limit, a derate factor falls smoothly from full scale so
+  that the caller can back off the motor before it overheats, instead of
+  tripping a hard limit.
+
+Notes:
+  - integer math only
+  - currents are in mA, temperatures in 0.1 degC
+  - the heating is normalized to the rated current: driven at the rated
+    current, the winding settles max_rise above ambient
+  - the current is clamped to THERM_MAX_OVERLOAD times the rated current
+  - the derate factor is 256 (full scale) up to the start temperature, then
+    falls linearly to min_factor at the limit temperature and stays there
+==============================================================================*/
+#ifndef THERMAL_H
+#define THERMAL_H
+//---------------------------Dependencies---------------------------------------
+#include <stdint.h>
+
+//---------------------------Macros---------------------------------------------
+#define MAX_NUM_THERMAL_MODELS  3     // left, right, flipper
+#define THERM_MAX_OVERLOAD      8     // clamp of current / rated current
+#define THERM_FULL_SCALE        256   // derate factor when not derating
+
+//---------------------------Public Functions-----------------------------------
+// Function: THERM_Init
+// Parameters:
+//   uint8_t i,               the index (0-based) of the model
+//   uint16_t tick_us,        the time base of THERM_Integrate()
+//   uint16_t rated_mA,       the continuous current of the motor
+//   uint16_t tau_s,          the thermal time constant of the winding [s]
+//   int16_t max_rise,        the settled rise above ambient at the rated
+//                            current [0.1 degC]
+// Notes:
+//   - the model starts cold, at ambient
+void THERM_Init(const uint8_t i, const uint16_t tick_us,
+                const uint16_t rated_mA, const uint16_t tau_s,
+                const int16_t max_rise);
+
+
+// Function: THERM_SetRatedCurrent
+// Description: Changes the rated current, keeping the temperature.  A
+//   current of zero (0) is ignored.
+void THERM_SetRatedCurrent(const uint8_t i, const uint16_t rated_mA);
+
+
+// Function: THERM_SetLimits
+// Parameters:
+//   uint8_t i,               the index (0-based) of the model
+//   int16_t ambient,         the temperature the winding cools to
+//   int16_t start,           the temperature at which derating starts
+//   int16_t limit,           the temperature at which derating is complete
+//   uint8_t min_factor,      the derate factor from the limit upward, /256
+void THERM_SetLimits(const uint8_t i, const int16_t ambient,
+                     const int16_t start, const int16_t limit,
+                     const uint8_t min_factor);
+
+
+// Function: THERM_Integrate
+// Parameters:
+//   uint8_t i,               the index (0-based) of the model
+//   int16_t current_mA,      the average current over the elapsed ticks,
+//                            either sign heats the winding
+//   uint16_t ticks,          the time since the last call, at most 1000 ticks
+void THERM_Integrate(const uint8_t i, const int16_t current_mA,
+                     const uint16_t ticks);
+
+
+// Function: THERM_Temperature
+// Returns:
+//   int16_t, the estimated winding temperature [0.1 degC]
+int16_t THERM_Temperature(const uint8_t i);
+
+
+// Function: THERM_Derate
+// Returns:
+//   uint16_t, the factor to scale the motor effort by, /256
+uint16_t THERM_Derate(const uint8_t i);
+
+#endif
@@ -0,0 +1,115 @@
+/*==============================================================================
+File: Traction.c
+Notes:
+  - the percentage comparisons are cross-multiplied so that no division is
+    needed:  |a - b| * 100 > tolerance * max(|a|, |b|)
+==============================================================================*/
+//---------------------------Dependencies---------------------------------------
+#include "Traction.h"
+#include <stdlib.h>   // for abs() and labs() functions
+
+//---------------------------Macros and Definitions-----------------------------
+typedef struct {
+  int16_t effort;
+  int16_t speed;
+  uint8_t debounce[kTractNumCounts];
+  uint16_t status;
+  uint16_t counts[kTractNumCounts];
+} traction_monitor_t;
+
+//---------------------------Module Variables-----------------------------------
+static traction_limits_t limits;
+static traction_monitor_t monitors[MAX_NUM_TRACTION_MONITORS] = {{0}};
+
+//---------------------------Helper Function Prototypes-------------------------
+static void Debounce(traction_monitor_t *monitor, const kTractCount which,
+                     const uint16_t flag, const uint8_t is_present);
+static uint8_t Disagree(const int16_t a, const int16_t b,
+                        const int16_t tolerance);
+
+//---------------------------Public Function Definitions------------------------
+void TRACT_Init(const traction_limits_t *new_limits) {
+  limits = *new_limits;
+}
+
+
+uint16_t TRACT_Update(const uint8_t i, const int16_t effort,
+                      const int16_t speed, const int16_t current) {
+  traction_monitor_t *monitor = &monitors[i];
+  uint8_t is_free_spinning, is_stalled;
+
+  monitor->effort = effort;
+  monitor->speed = speed;
+
+  is_free_spinning = (effort != 0) &&
+                     (limits.free_spin_speed < abs(speed)) &&
+                     (current < limits.free_spin_current);
+
+  is_stalled = (limits.stall_effort < abs(effort)) &&
+               (abs(speed) < limits.stall_speed) &&
+               (limits.stall_current < current);
+
+  Debounce(monitor, kTractFreeSpinCount, TRACT_FREE_SPIN, is_free_spinning);
+  Debounce(monitor, kTractStallCount, TRACT_STALL, is_stalled);
+
+  return monitor->status;
+}
+
+
+void TRACT_UpdatePair(const uint8_t left, const uint8_t right) {
+  traction_monitor_t *l = &monitors[left];
+  traction_monitor_t *r = &monitors[right];
+  uint8_t is_straight, is_mismatched;
+
+  // both sides commanded the same way, by about the same amount
+  is_straight = (l->effort != 0) && (r->effort != 0) &&
+                ((l->effort < 0) == (r->effort < 0)) &&
+                !Disagree(l->effort, r->effort, limits.straight_tolerance);
+
+  is_mismatched = is_straight &&
+                  ((limits.mismatch_speed < abs(l->speed)) ||
+                   (limits.mismatch_speed < abs(r->speed))) &&
+                  Disagree(l->speed, r->speed, limits.mismatch_tolerance);
+
+  Debounce(l, kTractMismatchCount, TRACT_MISMATCH, is_mismatched);
+  Debounce(r, kTractMismatchCount, TRACT_MISMATCH, is_mismatched);
+}
+
+
+uint16_t TRACT_Status(const uint8_t i) {
+  return monitors[i].status;
+}
+
+
+uint16_t TRACT_Count(const uint8_t i, const kTractCount count) {
+  return monitors[i].counts[count];
+}
+
+//---------------------------Private Function Definitions-----------------------
+static void Debounce(traction_monitor_t *monitor, const kTractCount which,
+                     const uint16_t flag, const uint8_t is_present) {
+  // count toward the opposite of the current state, reset when it matches
+  if (is_present == ((monitor->status & flag) != 0)) {
+    monitor->debounce[which] = 0;
+    return;
+  }
+
+  if (++monitor->debounce[which] < TRACT_DEBOUNCE_SAMPLES) return;
+
+  monitor->debounce[which] = 0;
+  if (is_present) {
+    monitor->status |= flag;
+    monitor->counts[which]++;
+  } else {
+    monitor->status &= ~flag;
+  }
+}
+
+
+static uint8_t Disagree(const int16_t a, const int16_t b,
+                        const int16_t tolerance) {
+  int32_t largest = abs(a);
+  if (largest < abs(b)) largest = abs(b);
+
+  return (labs((int32_t)a - b) * 100) > ((int32_t)tolerance * largest);
+}
@@ -0,0 +1,92 @@
+/*==============================================================================
+File: Traction.h
+
+Description: This module cross-checks what each drive motor is commanded to
+  do against what its tachometer and current sense report, and flags the
+  combinations that mean the wheel is not doing useful work:
+    - free-spin:  turning fast while drawing little current (no load -- the
+                  track has lost traction, or the robot is lifted)
+    - stall:      commanded hard but barely turning while drawing a lot of
+                  current (blocked, or dug in)
+    - mismatch:   during a straight command, the left and right tach speeds
+                  disagree by more than a set fraction (one side slipping)
+  Call TRACT_Update() for every motor, then TRACT_UpdatePair() for the drive
+  pair, at a consistent rate.
+
+Notes:
+  - integer math only
+  - every condition must persist for TRACT_DEBOUNCE_SAMPLES consecutive
+    updates before it is flagged, and be absent as long before it clears
+  - each flag's event counter increments once per rising edge of the flag
+==============================================================================*/
+#ifndef TRACTION_H
+#define TRACTION_H
+//---------------------------Dependencies---------------------------------------
+#include <stdint.h>   // for uintN_t data types
+
+//---------------------------Macros---------------------------------------------
+#define MAX_NUM_TRACTION_MONITORS 3
+#define TRACT_DEBOUNCE_SAMPLES    20
+
+// status bits
+#define TRACT_FREE_SPIN           0x0001
+#define TRACT_STALL               0x0002
+#define TRACT_MISMATCH            0x0004
+
+//---------------------------Type Definitions-----------------------------------
+typedef struct {
+  int16_t free_spin_speed;      // |speed| above which a light load is suspect
+  int16_t free_spin_current;    // current below which the load is "light"
+  int16_t stall_effort;         // |effort| above which a stall is possible
+  int16_t stall_speed;          // |speed| below which the motor is "stopped"
+  int16_t stall_current;        // current above which the motor is loaded
+  int16_t straight_tolerance;   // [%] effort difference still called straight
+  int16_t mismatch_tolerance;   // [%] speed difference flagged as mismatch
+  int16_t mismatch_speed;       // |speed| below which mismatch is not checked
+} traction_limits_t;
+
+typedef enum {
+  kTractFreeSpinCount = 0,
+  kTractStallCount,
+  kTractMismatchCount,
+  kTractNumCounts,
+} kTractCount;
+
+//---------------------------Public Functions-----------------------------------
+// Function: TRACT_Init
+// Parameters:
+//   traction_limits_t *limits, the thresholds shared by all monitors
+void TRACT_Init(const traction_limits_t *limits);
+
+
+// Function: TRACT_Update
+// Returns:
+//   uint16_t, the status bits of the motor after this update
+// Parameters:
+//   uint8_t i,         the index (0-based) of the motor
+//   int16_t effort,    the commanded effort
+//   int16_t speed,     the measured (signed) tach speed
+//   int16_t current,   the measured current magnitude
+uint16_t TRACT_Update(const uint8_t i, const int16_t effort,
+                      const int16_t speed, const int16_t current);
+
+
+// Function: TRACT_UpdatePair
+// Description: Compares the last samples of two motors on opposite sides of
+//   the chassis, and flags both with TRACT_MISMATCH when they disagree during
+//   a straight command.
+void TRACT_UpdatePair(const uint8_t left, const uint8_t right);
+
+
+// Function: TRACT_Status
+// Returns:
+//   uint16_t, the status bits of the motor
+uint16_t TRACT_Status(const uint8_t i);
+
+
+// Function: TRACT_Count
+// Returns:
+//   uint16_t, the number of times the given flag has been raised (wraps)
+uint16_t TRACT_Count(const uint8_t i, const kTractCount count);
+
+#endif
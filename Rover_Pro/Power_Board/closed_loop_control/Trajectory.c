@@ -0,0 +1,116 @@
+/*==============================================================================
+File: Trajectory.c
+Notes:
+  - each update the generator predicts how much more the velocity will change
+    if it starts bringing the acceleration back to zero right now
+    (a*|a| / 2J).  If that would still fall short of the target, it keeps
+    ramping the acceleration toward the target; otherwise it ramps the
+    acceleration back toward zero.  The result is the classic 7-segment
+    S-curve without needing a square root.
+  - when the velocity step would reach or cross the target, the reference
+    lands exactly on it so that it does not chatter around the target
+
+See also:
+  - "Trapezoidal and S-curve motion profiles", any motion control text
+==============================================================================*/
+//---------------------------Dependencies---------------------------------------
+#include "Trajectory.h"
+#include <stdlib.h>   // for labs() function
+
+//---------------------------Macros and Definitions-----------------------------
+#define MS_PER_S            1000
+#define MAX_VELOCITY_ERROR  (2000L << TRAJ_FRACTION_BITS)
+
+typedef struct {
+  int32_t ticks_per_s;    // update rate
+  int32_t max_accel;      // [units/s], with fraction bits
+  int32_t jerk_step;      // acceleration change per update, with fraction bits
+  int32_t max_jerk;       // [units/s^2], integer
+  uint16_t period_ms;
+} trajectory_t;
+
+typedef struct {
+  int32_t velocity;       // [units], with fraction bits
+  int32_t acceleration;   // [units/s], with fraction bits
+} trajectory_state_t;
+
+//---------------------------Module Variables-----------------------------------
+static trajectory_t trajectories[MAX_NUM_TRAJECTORIES];
+static trajectory_state_t states[MAX_NUM_TRAJECTORIES] = {{0}};
+
+//---------------------------Helper Function Prototypes-------------------------
+static int32_t Clamp(const int32_t x, const int32_t limit);
+
+//---------------------------Public Function Definitions------------------------
+void TRAJ_Init(const uint8_t i, const uint16_t period_ms,
+               const uint16_t max_accel, const uint16_t max_jerk) {
+  trajectories[i].period_ms = (period_ms == 0) ? 1 : period_ms;
+  trajectories[i].ticks_per_s = MS_PER_S / trajectories[i].period_ms;
+  trajectories[i].max_accel = 1;
+  trajectories[i].max_jerk = 1;
+  TRAJ_SetLimits(i, max_accel, max_jerk);
+  TRAJ_Reset(i);
+}
+
+
+void TRAJ_SetLimits(const uint8_t i, const uint16_t max_accel,
+                    const uint16_t max_jerk) {
+  int32_t accel = max_accel;
+
+  if (accel != 0) {
+    if (TRAJ_MAX_ACCEL_LIMIT < accel) accel = TRAJ_MAX_ACCEL_LIMIT;
+    trajectories[i].max_accel = accel << TRAJ_FRACTION_BITS;
+  }
+
+  if (max_jerk != 0) {
+    trajectories[i].max_jerk = max_jerk;
+    trajectories[i].jerk_step = ((int32_t)max_jerk << TRAJ_FRACTION_BITS) /
+                                trajectories[i].ticks_per_s;
+    if (trajectories[i].jerk_step == 0) trajectories[i].jerk_step = 1;
+  }
+}
+
+
+int16_t TRAJ_Update(const uint8_t i, const int16_t target) {
+  trajectory_t *t = &trajectories[i];
+  trajectory_state_t *s = &states[i];
+  int32_t error, accel_units, stopping_change, remaining, velocity_step;
+
+  error = ((int32_t)target << TRAJ_FRACTION_BITS) - s->velocity;
+
+  // velocity change that still happens while the acceleration ramps to zero
+  accel_units = s->acceleration >> TRAJ_FRACTION_BITS;
+  stopping_change = (accel_units * labs(accel_units)) / (2 * t->max_jerk);
+  stopping_change = Clamp(stopping_change, MAX_VELOCITY_ERROR >> TRAJ_FRACTION_BITS);
+  stopping_change <<= TRAJ_FRACTION_BITS;
+
+  remaining = error - stopping_change - (s->acceleration / t->ticks_per_s);
+  if (0 < remaining) s->acceleration += t->jerk_step;
+  else if (remaining < 0) s->acceleration -= t->jerk_step;
+  s->acceleration = Clamp(s->acceleration, t->max_accel);
+
+  velocity_step = s->acceleration / t->ticks_per_s;
+  if (((0 <= error) && (error <= velocity_step)) ||
+      ((error <= 0) && (velocity_step <= error))) {
+    // this step reaches the target -- land on it
+    s->velocity += error;
+    s->acceleration = 0;
+  } else {
+    s->velocity += velocity_step;
+  }
+
+  return (int16_t)(s->velocity >> TRAJ_FRACTION_BITS);
+}
+
+
+void TRAJ_Reset(const uint8_t i) {
+  states[i].velocity = 0;
+  states[i].acceleration = 0;
+}
+
+//---------------------------Private Function Definitions-----------------------
+static int32_t Clamp(const int32_t x, const int32_t limit) {
+  if (limit < x) return limit;
+  else if (x < -limit) return -limit;
+  return x;
+}
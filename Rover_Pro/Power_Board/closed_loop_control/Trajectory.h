@@ -0,0 +1,62 @@
+/*==============================================================================
+File: Trajectory.h
+
+Description: This module encapsulates a jerk-limited (S-curve) velocity
+  trajectory generator.  Each generator slews its velocity reference toward a
+  commanded target without exceeding a maximum acceleration, and changes that
+  acceleration no faster than a maximum jerk.  Initialize a generator with its
+  limits, then call TRAJ_Update() at a consistent rate.
+
+Notes:
+  - integer math only, since the PIC24 has no floating point hardware
+  - velocities are in the same units as REG_MOTOR_VELOCITY (-1000 to 1000),
+    accelerations in units/s and jerks in units/s^2
+  - internally the velocity and acceleration carry TRAJ_FRACTION_BITS of
+    fraction so that small limits still produce motion at fast update rates
+  - acceleration magnitudes are clamped to TRAJ_MAX_ACCEL_LIMIT so that the
+    stopping-distance product a*a stays inside a signed 32-bit integer
+==============================================================================*/
+#ifndef TRAJECTORY_H
+#define TRAJECTORY_H
+//---------------------------Dependencies---------------------------------------
+#include <stdint.h>
+
+//---------------------------Macros---------------------------------------------
+#define MAX_NUM_TRAJECTORIES    3     // left, right, flipper
+#define TRAJ_FRACTION_BITS      8
+#define TRAJ_MAX_ACCEL_LIMIT    40000 // [units/s]
+
+//---------------------------Public Functions-----------------------------------
+// Function: TRAJ_Init
+// Parameters:
+//   uint8_t i,            the index (0-based) of the generator
+//   uint16_t period_ms,   the rate at which TRAJ_Update() will be called
+//   uint16_t max_accel,   maximum acceleration magnitude [units/s]
+//   uint16_t max_jerk,    maximum jerk magnitude [units/s^2]
+void TRAJ_Init(const uint8_t i, const uint16_t period_ms,
+               const uint16_t max_accel, const uint16_t max_jerk);
+
+
+// Function: TRAJ_SetLimits
+// Description: Changes the limits of a running generator without disturbing
+//   its present velocity and acceleration.  A limit of zero (0) leaves the
+//   corresponding value unchanged.
+void TRAJ_SetLimits(const uint8_t i, const uint16_t max_accel,
+                    const uint16_t max_jerk);
+
+
+// Function: TRAJ_Update
+// Returns:
+//   int16_t, the velocity reference for this period
+// Parameters:
+//   uint8_t i,            the index (0-based) of the generator
+//   int16_t target,       the commanded velocity
+int16_t TRAJ_Update(const uint8_t i, const int16_t target);
+
+
+// Function: TRAJ_Reset
+// Description: Forces the velocity and acceleration references to zero (0),
+//   for instance after an overcurrent trip has already stopped the motors.
+void TRAJ_Reset(const uint8_t i);
+
+#endif
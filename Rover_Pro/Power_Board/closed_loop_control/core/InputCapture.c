@@ -54,6 +54,7 @@ static volatile uint32_t timeouts[MAX_NUM_IC_PINS] = {0}; // in units of [ms]
 static volatile uint32_t elapsed_times[MAX_NUM_IC_PINS] = {0};
 static volatile uint16_t periods[MAX_NUM_IC_PINS] = {0};
 static volatile int measuredMotorDirection[2] = {0};
+static volatile uint16_t edge_counts[MAX_NUM_IC_PINS] = {0};
 static volatile uint32_t time = 0;  // running number of timer3 ticks
 
 /*---------------------------Test Harness-------------------------------------*/
@@ -105,6 +106,7 @@ void IC1_ISR(void) {
     if(newvalue==0) newvalue = UINT_MAX;
     periods[0] = newvalue;
     last_value = current_value;
+    edge_counts[0]++;
     
   }
   else if(recentMotorDirReading != measuredMotorDirection[0]){
@@ -140,6 +142,7 @@ void IC2_ISR(void) {
     if (newvalue==0) newvalue = UINT_MAX;
     periods[1] = newvalue;
     last_value = current_value;
+    edge_counts[1]++;
   }
   else if(recentMotorDirReading != measuredMotorDirection[1]){
     protectionTimeout = STALL_PROTECTION_CYCLES;
@@ -293,6 +296,10 @@ unsigned int IC_period(const kICModule module) {
   return periods[module];
 }
 
+uint16_t IC_edge_count(const kICModule module) {
+  return edge_counts[module];
+}
+
 int MotorDirection(int Channel){
   return measuredMotorDirection[Channel];
 }
@@ -1,61 +1,61 @@
-/*********************************************************************
- *
- *   LCD Access Routines header
- *
- *********************************************************************
- * FileName:        LCDBlocking.h
- * Dependencies:    None
- * Processor:       PIC24F
- * Compiler:        MCC30 v2.01 or higher
- * Company:         Microchip Technology, Inc.
- *
- * Software License Agreement
- *
- * Copyright  2002-2007 Microchip Technology Inc.  All rights 
- * reserved.
- *
- * Microchip licenses to you the right to use, modify, copy, and 
- * distribute: 
- * (i)  the Software when embedded on a Microchip microcontroller or 
- *      digital signal controller product (Device) which is 
- *      integrated into Licensees product; or
- * (ii) ONLY the Software driver source files ENC28J60.c and 
- *      ENC28J60.h ported to a non-Microchip device used in 
- *      conjunction with a Microchip ethernet controller for the 
- *      sole purpose of interfacing with the ethernet controller. 
- *
- * You should refer to the license agreement accompanying this 
- * Software for additional information regarding your rights and 
- * obligations.
- *
- * THE SOFTWARE AND DOCUMENTATION ARE PROVIDED AS IS WITHOUT 
- * WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
- * LIMITATION, ANY WARRANTY OF MERCHANTABILITY, FITNESS FOR A 
- * PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL 
- * MICROCHIP BE LIABLE FOR ANY INCIDENTAL, SPECIAL, INDIRECT OR 
- * CONSEQUENTIAL DAMAGES, LOST PROFITS OR LOST DATA, COST OF 
- * PROCUREMENT OF SUBSTITUTE GOODS, TECHNOLOGY OR SERVICES, ANY CLAIMS 
- * BY THIRD PARTIES (INCLUDING BUT NOT LIMITED TO ANY DEFENSE 
- * THEREOF), ANY CLAIMS FOR INDEMNITY OR CONTRIBUTION, OR OTHER 
- * SIMILAR COSTS, WHETHER ASSERTED ON THE BASIS OF CONTRACT, TORT 
- * (INCLUDING NEGLIGENCE), BREACH OF WARRANTY, OR OTHERWISE.
- *
- *
- * Author               Date    Comment
- *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
- * Howard Schlunder     4/03/06		Original 
- ********************************************************************/
-#ifndef __LCDBLOCKING_H
-#define __LCDBLOCKING_H
-
-
-extern BYTE LCDText[16*2+1];
-void LCDInit(void);
-void LCDUpdate(void);
-void LCDErase(void);
-
-
-void LCDWriteLine(WORD number, char *line);
-
-#endif
-
+/*********************************************************************
+ *
+ *   LCD Access Routines header
+ *
+ *********************************************************************
+ * FileName:        LCDBlocking.h
+ * Dependencies:    None
+ * Processor:       PIC24F
+ * Compiler:        MCC30 v2.01 or higher
+ * Company:         Microchip Technology, Inc.
+ *
+ * Software License Agreement
+ *
+ * Copyright  2002-2007 Microchip Technology Inc.  All rights 
+ * reserved.
+ *
+ * Microchip licenses to you the right to use, modify, copy, and 
+ * distribute: 
+ * (i)  the Software when embedded on a Microchip microcontroller or 
+ *      digital signal controller product (Device) which is 
+ *      integrated into Licensees product; or
+ * (ii) ONLY the Software driver source files ENC28J60.c and 
+ *      ENC28J60.h ported to a non-Microchip device used in 
+ *      conjunction with a Microchip ethernet controller for the 
+ *      sole purpose of interfacing with the ethernet controller. 
+ *
+ * You should refer to the license agreement accompanying this 
+ * Software for additional information regarding your rights and 
+ * obligations.
+ *
+ * THE SOFTWARE AND DOCUMENTATION ARE PROVIDED AS IS WITHOUT 
+ * WARRANTY OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT 
+ * LIMITATION, ANY WARRANTY OF MERCHANTABILITY, FITNESS FOR A 
+ * PARTICULAR PURPOSE, TITLE AND NON-INFRINGEMENT. IN NO EVENT SHALL 
+ * MICROCHIP BE LIABLE FOR ANY INCIDENTAL, SPECIAL, INDIRECT OR 
+ * CONSEQUENTIAL DAMAGES, LOST PROFITS OR LOST DATA, COST OF 
+ * PROCUREMENT OF SUBSTITUTE GOODS, TECHNOLOGY OR SERVICES, ANY CLAIMS 
+ * BY THIRD PARTIES (INCLUDING BUT NOT LIMITED TO ANY DEFENSE 
+ * THEREOF), ANY CLAIMS FOR INDEMNITY OR CONTRIBUTION, OR OTHER 
+ * SIMILAR COSTS, WHETHER ASSERTED ON THE BASIS OF CONTRACT, TORT 
+ * (INCLUDING NEGLIGENCE), BREACH OF WARRANTY, OR OTHERWISE.
+ *
+ *
+ * Author               Date    Comment
+ *~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * Howard Schlunder     4/03/06		Original 
+ ********************************************************************/
+#ifndef __LCDBLOCKING_H
+#define __LCDBLOCKING_H
+
+
+extern BYTE LCDText[16*2+1];
+void LCDInit(void);
+void LCDUpdate(void);
+void LCDErase(void);
+
+
+void LCDWriteLine(WORD number, char *line);
+
+#endif
+
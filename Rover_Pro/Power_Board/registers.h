@@ -37,6 +37,41 @@ typedef struct { int32_t left, right, flipper; } MOTOR_DATA_3EL_32BI;
 typedef struct { int8_t  left, right, flipper; } MOTOR_DATA_3EL_8BI;
 typedef struct { float   data[4][3]; } MOTOR_DATA_CTRL;
 typedef struct { int16_t a,b; } BATTERY_DATA_2EL_16BI;
+typedef struct { uint16_t a,b; } BATTERY_DATA_2EL_16BU;
+typedef struct { int16_t linear, angular; } TWIST_DATA_2EL_16BI; // [mm/s], [mrad/s]
+typedef struct { int16_t max_angular, max_spin_speed, spin_speed; } TURN_LIMITS_3EL_16BI;
+typedef struct { uint16_t usb, xbee; } COMM_DATA_2EL_16BU;
+typedef struct { uint32_t usb, xbee; } COMM_DATA_2EL_32BU;
+typedef struct { uint8_t drive, flipper; } COMM_LOSS_ACTION_2EL_8BU;
+typedef struct { uint16_t i2c2, i2c3; } I2C_DATA_2EL_16BU;
+// [mV], [mA], [mA], [0.1K], [%], [mAh], [mAh], count, SBS BatteryStatus, [mV] per cell, BatteryStatus alarm bits since power up, PEC failures
+typedef struct { uint16_t voltage; int16_t current, average_current; uint16_t temperature, relative_soc, remaining_capacity, full_charge_capacity, cycle_count, status, cell[4], alarms, pec_errors; } SMART_BATTERY_DATA;
+typedef struct { uint16_t voltage, current, average_current, temperature, relative_soc, remaining_capacity, full_charge_capacity, cycle_count, status, cells; } SMART_BATTERY_POLL; // [ms], 0 is default
+// see device_robot_motor_power.h, durations in [ms]
+typedef struct { uint16_t state, method, attempts, attempt_result[3], attempt_ms[3], pulse_ms, total_ms; } POWER_BUS_DATA;
+// see device_robot_motor_power.h, the last pulse of the soft start: [us], [mA], [mV], [mV]
+typedef struct { uint16_t result, pulses, pulse_us, peak_current, bus_voltage, pack_voltage; } PRECHARGE_DATA;
+// see device_robot_motor_dock.h, full: bit 0 battery A, bit 1 battery B, charge_s: [s] charged per side since docking
+typedef struct { uint16_t state, side, reason, full, switches, charge_s[2]; } DOCK_CHARGE_DATA;
+typedef struct { uint16_t mode, frames, legacy_frames, crc_errors, framing_errors, bad_messages, rx_overruns, tx_overruns; } XBEE_STATS;
+// see debug_log.h, dropped: records lost to a full ring since power up
+typedef struct { uint16_t sequence, length, dropped; uint8_t data[32]; } DEBUG_LOG_DATA;
+// see device_robot_motor_config.h
+typedef struct { uint16_t version, source, slot, sequence, saves, errors, pending; } CONFIG_STATUS;
+// see DEE Emulation 16-bit.h, flags: DATA_EE_FLAGS
+typedef struct { uint16_t state, queued, writes, packs, errors, flags; } DEE_STATUS;
+// counts since power up, see periph_i2c.h
+typedef struct { uint16_t nacks, timeouts, collisions, recoveries, stuck_sda, stuck_scl; } I2C_BUS_HEALTH;
+typedef struct { uint16_t nacks, timeouts, collisions, recoveries, backoff; } I2C_DEVICE_HEALTH; // backoff in [ms], 0 when healthy
+typedef struct { uint16_t fan_left, fan_right, board_temp, charger; } I2C_POLL_DATA; // [ms]
+// see device_robot_motor_fan.h, temperatures in [0.1C], duty 0-240
+typedef struct { uint16_t command; int16_t temperature[4]; uint16_t duty[4]; int16_t hysteresis; } FAN_CURVE_COMMAND;
+typedef struct { int16_t temperature[4]; uint16_t duty[4]; int16_t hysteresis; } FAN_CURVE_DATA;
+typedef struct { uint16_t duty; int16_t temperature; uint16_t source; } FAN_CONTROL_DATA;
+typedef struct { uint8_t left_current, right_current, flipper_current, pot1, pot2, cell_a_voltage, cell_b_voltage, cell_a_current, cell_b_current; } ADC_DATA_9EL_8BU;
+typedef struct { uint16_t left_current, right_current, flipper_current, pot1, pot2, cell_a_voltage, cell_b_voltage, cell_a_current, cell_b_current; } ADC_DATA_9EL_16BU;
+typedef struct { uint16_t command, channel, value; } ADC_CAL_COMMAND_3EL_16BU;
+typedef struct { uint16_t trip, reset; } CURRENT_LIMIT_2EL_16BU; // [mA]
 typedef struct { uint16_t deg, min, sec; } GPS_VECT;
 typedef struct { GPS_VECT lat, lon; } GPS_DATA;
 typedef struct {uint8_t data[100]; } GPS_MESSAGE;
@@ -180,7 +215,7 @@ REGISTER( REG_CAMERA_FOCUS, DEVICE_READ, DEVICE_PTZ_ROTATION, SYNC, int16_t )
 REGISTER( REG_CAMERA_FOCUS_MANUAL, DEVICE_READ, DEVICE_PTZ_ROTATION, SYNC, uint8_t )
 REGISTER( REG_CAMERA_FOCUS_SET, DEVICE_READ, DEVICE_PTZ_ROTATION, SYNC, uint16_t )
 
-// value ranges from 0 (off) to 240 (100%)
+// minimum fan duty, from 0 (the fan curve alone) to 240 (100%)
 REGISTER( REG_MOTOR_SIDE_FAN_SPEED,   DEVICE_WRITE,  DEVICE_MOTOR,   SYNC,    uint8_t )
 
 REGISTER( REG_OCU_REL_SOC_L,   DEVICE_READ,  DEVICE_OCU,   SYNC,    uint16_t)
@@ -254,6 +289,168 @@ REGISTER( REG_REPEATER_POSITIONS,	DEVICE_READ,	DEVICE_INITIATOR,	SYNC,	uint8_t )
 
 //REG_MOTOR_SLOW_SPEED is 0 for normal drive motor operation, and 1 for slow drive motor operation
 REGISTER( REG_MOTOR_SLOW_SPEED,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	uint8_t )
+
+//speed ramp limits, acceleration in (speed units)/s and jerk in (speed units)/s^2
+//a limit of 0 keeps the firmware default
+REGISTER( REG_MOTOR_ACCEL_LIMIT,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	MOTOR_DATA_3EL_16BI )
+REGISTER( REG_MOTOR_JERK_LIMIT,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	MOTOR_DATA_3EL_16BI )
+
+//REG_MOTOR_TWIST_MODE is 0 to drive from REG_MOTOR_VELOCITY, and 1 to drive from REG_MOTOR_TWIST
+//REG_MOTOR_TWIST is linear velocity in mm/s and angular velocity in mrad/s (counter-clockwise positive)
+//REG_MOTOR_TURN_LIMITS: max_angular [mrad/s], max_spin_speed is the largest wheel speed while
+//spinning (wheels in opposite directions), spin_speed is the closed loop speed used to turn in place
+//a limit of 0 or less keeps the firmware default
+REGISTER( REG_MOTOR_TWIST_MODE,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	uint8_t )
+REGISTER( REG_MOTOR_TWIST,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	TWIST_DATA_2EL_16BI )
+REGISTER( REG_MOTOR_TURN_LIMITS,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	TURN_LIMITS_3EL_16BI )
+
+//traction monitor: status bits are 0x01 free-spin, 0x02 stall, 0x04 left/right mismatch
+//counters count how often each condition was raised
+//REG_MOTOR_SLIP_EFFORT_DROP is the % effort taken off a free-spinning drive motor, 0 disables
+REGISTER( REG_MOTOR_TRACTION_STATUS,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	MOTOR_DATA_3EL_16BI )
+REGISTER( REG_MOTOR_FREE_SPIN_COUNT,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	MOTOR_DATA_3EL_16BI )
+REGISTER( REG_MOTOR_STALL_COUNT,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	MOTOR_DATA_3EL_16BI )
+REGISTER( REG_MOTOR_MISMATCH_COUNT,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	MOTOR_DATA_3EL_16BI )
+REGISTER( REG_MOTOR_SLIP_EFFORT_DROP,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	uint8_t )
+
+//velocity observer estimates for the drive motors, speed in tach units and acceleration in tach units/s
+REGISTER( REG_MOTOR_OBS_SPEED,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	MOTOR_DATA_3EL_16BI )
+REGISTER( REG_MOTOR_OBS_ACCEL,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	MOTOR_DATA_3EL_16BI )
+
+//comm loss supervisor: REG_COMM_TIMEOUTS in ms per link (0 is 333ms), REG_COMM_LOSS_ACTION is
+//0 default, 1 decelerate, 2 hold (speed loop at zero, the flipper brakes) or 3 coast, REG_COMM_DECEL_RATE in (speed units)/s (0 is default)
+//REG_COMM_TIMEOUT_COUNT counts timeouts per link, REG_COMM_TIMEOUT_TIME is the ms since boot of the last one
+REGISTER( REG_COMM_TIMEOUTS,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	COMM_DATA_2EL_16BU )
+REGISTER( REG_COMM_LOSS_ACTION,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	COMM_LOSS_ACTION_2EL_8BU )
+REGISTER( REG_COMM_DECEL_RATE,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	uint16_t )
+REGISTER( REG_COMM_TIMEOUT_COUNT,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	COMM_DATA_2EL_16BU )
+REGISTER( REG_COMM_TIMEOUT_TIME,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	COMM_DATA_2EL_32BU )
+
+//analog input decimators, one entry per input (0 is the firmware default)
+//REG_ADC_FILTER_ORDER is 1 (boxcar) or 2 (CIC), REG_ADC_DECIMATION is the number of
+//A/D frames (750us each) per output, a power of two up to 128, REG_ADC_RESOLUTION
+//is the output resolution in bits (10 to 16), REG_ADC_FILTERED the latest outputs
+REGISTER( REG_ADC_FILTER_ORDER,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	ADC_DATA_9EL_8BU )
+REGISTER( REG_ADC_DECIMATION,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	ADC_DATA_9EL_8BU )
+REGISTER( REG_ADC_RESOLUTION,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	ADC_DATA_9EL_8BU )
+REGISTER( REG_ADC_FILTERED,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	ADC_DATA_9EL_16BU )
+
+//A/D calibration: write REG_ADC_CAL_COMMAND {command, channel (REG_ADC_... order), value}
+//with command 1 (channel reads zero now), 2 (channel reads value mV/mA now), 3 (store
+//in flash, see REG_CONFIG_STATUS) or 4 (nominal values), then read the result in
+//REG_ADC_CAL_STATUS (1 ok, 2 bad command, 3 unusable reading). Offsets are in 1/16 counts,
+//gains in mV or mA per 1024 counts.
+REGISTER( REG_ADC_CAL_COMMAND,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	ADC_CAL_COMMAND_3EL_16BU )
+REGISTER( REG_ADC_CAL_STATUS,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	uint8_t )
+REGISTER( REG_ADC_CAL_OFFSET,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	ADC_DATA_9EL_16BU )
+REGISTER( REG_ADC_CAL_GAIN,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	ADC_DATA_9EL_16BU )
+
+//calibrated readings, and the battery overcurrent limits per cell in mA (0 is default)
+REGISTER( REG_PWR_BAT_VOLTAGE_MV,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	BATTERY_DATA_2EL_16BI )
+REGISTER( REG_PWR_CELL_CURRENT_MA,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	BATTERY_DATA_2EL_16BI )
+REGISTER( REG_PWR_TOTAL_CURRENT_MA,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	uint16_t )
+REGISTER( REG_MOTOR_FB_CURRENT_MA,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	MOTOR_DATA_3EL_16BI )
+REGISTER( REG_PWR_OVERCURRENT_LIMIT,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	CURRENT_LIMIT_2EL_16BU )
+
+//coulomb-counting state of charge per battery in 0.01% (0xffff until the battery has
+//reported its own), remaining runtime in s at the averaged draw (0xffff unknown or idle),
+//battery full charge capacity in mAh (0 is default)
+REGISTER( REG_PWR_SOC,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	BATTERY_DATA_2EL_16BU )
+REGISTER( REG_PWR_RUNTIME,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	uint16_t )
+REGISTER( REG_PWR_BAT_CAPACITY,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	BATTERY_DATA_2EL_16BU )
+
+//I2t thermal model per motor: estimated winding temperature in 0.1C, the factor the
+//motor effort is scaled by (/256, 256 is no derating), continuous current in mA (0 is default)
+REGISTER( REG_MOTOR_THERMAL_TEMP,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	MOTOR_DATA_3EL_16BI )
+REGISTER( REG_MOTOR_THERMAL_DERATE,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	MOTOR_DATA_3EL_16BI )
+REGISTER( REG_MOTOR_RATED_CURRENT,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	MOTOR_DATA_3EL_16BI )
+
+//flipper angle from the fused pots in 0.1 degrees (0xffff if neither pot reads), and how
+//far to trust it: 0 no angle, 1 both pots read but disagree, 2 one pot in its dead zone,
+//3 both pots read and agree
+REGISTER( REG_MOTOR_FLIPPER_ANGLE_TENTHS,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	uint16_t )
+REGISTER( REG_MOTOR_FLIPPER_ANGLE_CONFIDENCE,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	uint8_t )
+
+//I2C transaction queues per bus, over the last second: finished transactions per s,
+//data bytes per s, average and worst ms from queueing to finishing; and the failed
+//transactions since power up (NACK, lost bus or timeout)
+REGISTER( REG_I2C_TRANSACTION_RATE,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	I2C_DATA_2EL_16BU )
+REGISTER( REG_I2C_BYTE_RATE,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	I2C_DATA_2EL_16BU )
+REGISTER( REG_I2C_LATENCY_AVG,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	I2C_DATA_2EL_16BU )
+REGISTER( REG_I2C_LATENCY_MAX,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	I2C_DATA_2EL_16BU )
+REGISTER( REG_I2C_FAILURES,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	I2C_DATA_2EL_16BU )
+
+//Smart Battery Data read from each battery with PEC, see device_robot_motor_smbus.h, and
+//the polling period of each field in ms (0 is default)
+REGISTER( REG_SMART_BATTERY_A,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	SMART_BATTERY_DATA )
+REGISTER( REG_SMART_BATTERY_B,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	SMART_BATTERY_DATA )
+REGISTER( REG_SMART_BATTERY_POLL,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	SMART_BATTERY_POLL )
+
+//power bus bring-up at boot: state, the method used to switch the bus on, and the result
+//and duration of each battery identification attempt
+REGISTER( REG_PWR_BUS_BRINGUP,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	POWER_BUS_DATA )
+
+//I2C bus fault counters per bus (NACKs, timeouts, lost arbitrations, bus recoveries and
+//the stuck lines they found) and per device, with each device's current back-off
+REGISTER( REG_I2C2_HEALTH,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	I2C_BUS_HEALTH )
+REGISTER( REG_I2C3_HEALTH,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	I2C_BUS_HEALTH )
+REGISTER( REG_I2C_FAN_HEALTH,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	I2C_DEVICE_HEALTH )
+REGISTER( REG_I2C_BOARD_TEMP_HEALTH,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	I2C_DEVICE_HEALTH )
+REGISTER( REG_I2C_BATTERY_A_HEALTH,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	I2C_DEVICE_HEALTH )
+REGISTER( REG_I2C_BATTERY_B_HEALTH,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	I2C_DEVICE_HEALTH )
+REGISTER( REG_I2C_CHARGER_HEALTH,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	I2C_DEVICE_HEALTH )
+
+//I2C bus time used over the last second in [0.1%], estimated from the frames clocked, and
+//the current polling interval of each adaptively polled sensor
+REGISTER( REG_I2C_UTILIZATION,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	I2C_DATA_2EL_16BU )
+REGISTER( REG_I2C_POLL_INTERVAL,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	I2C_POLL_DATA )
+
+//fan curve: write REG_FAN_CURVE_COMMAND {command 1 (use), 2 (use and store in flash,
+//see REG_CONFIG_STATUS) or 3 (default curve), the curve}, then read the result in
+//REG_FAN_CURVE_STATUS (1 ok, 2 bad command, 3 bad curve) and the curve in use in REG_FAN_CURVE.
+//REG_FAN_CONTROL is the fan duty, the temperature it was looked up at and its source
+//(0 motor, 1 board, 2 motor load, 3 host minimum, 4 no sensor)
+REGISTER( REG_FAN_CURVE_COMMAND,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	FAN_CURVE_COMMAND )
+REGISTER( REG_FAN_CURVE_STATUS,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	uint8_t )
+REGISTER( REG_FAN_CURVE,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	FAN_CURVE_DATA )
+REGISTER( REG_FAN_CONTROL,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	FAN_CONTROL_DATA )
+
+//power bus soft start: result (1 running, 2 done, 3 failed and fell back to fixed
+//pulses), the pulses so far, and the width, peak cell current, bus voltage and pack
+//voltage of the last one
+REGISTER( REG_PWR_PRECHARGE,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	PRECHARGE_DATA )
+
+//charge balancing on the dock: state (0 undocked, 1 charging, 2 both full), side
+//charging (0 both, 1 A, 2 B), reason for the last choice of side, full batteries,
+//switches since docking, time charged per side
+REGISTER( REG_DOCK_CHARGE,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	DOCK_CHARGE_DATA )
+
+//Xbee link: REG_XBEE_MODE is 0 to detect the protocol (framed starts with a read, see
+//device_robot_motor_xbee.h), 1 legacy only or 2 framed only (COBS and CRC-16),
+//REG_XBEE_STATS the protocol in use (1 legacy, 2 framed), good framed and legacy
+//messages, framed messages dropped for their CRC, their framing or an unknown message,
+//bytes lost to a full receive buffer and replies dropped for a full transmit buffer
+REGISTER( REG_XBEE_MODE,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	uint8_t )
+REGISTER( REG_XBEE_STATS,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	XBEE_STATS )
+
+//register accesses refused by the register service, per transport (see register_service.h)
+REGISTER( REG_REGISTER_DENIED,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	COMM_DATA_2EL_16BU )
+
+//binary debug log: the next bytes of records in REG_DEBUG_LOG, write its sequence to
+//REG_DEBUG_LOG_ACK for the bytes after them (see debug_log.h)
+REGISTER( REG_DEBUG_LOG,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	DEBUG_LOG_DATA )
+REGISTER( REG_DEBUG_LOG_ACK,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	uint16_t )
+
+//config store (see device_robot_motor_config.h): write 1 to REG_CONFIG_COMMAND to save
+//now, 2 to store the defaults; REG_CONFIG_STATUS the layout version, where the settings
+//came from at start up, the slot in use (0xffff none), its sequence, saves, failed
+//saves and whether a change is still to be written
+REGISTER( REG_CONFIG_COMMAND,	DEVICE_WRITE,	DEVICE_MOTOR,	SYNC,	uint8_t )
+REGISTER( REG_CONFIG_STATUS,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	CONFIG_STATUS )
+
+//DEE writes done in the background: the pack step under way (0 none), writes still
+//queued, words programmed, packs, failed or dropped writes and the DEE error flags
+REGISTER( REG_DEE_STATUS,	DEVICE_READ,	DEVICE_MOTOR,	SYNC,	DEE_STATUS )
 
 REGISTER_END()
 
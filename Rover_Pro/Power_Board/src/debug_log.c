@@ -0,0 +1,100 @@
+#include "p24FJ256GB106.h"
+#include "stdhdr.h"
+#include "debug_log.h"
+
+extern unsigned long UptimeCount;
+
+//the main loop writes LogHead, the consumer LogTail
+static unsigned char LogRing[DebugLogRingLength];
+static volatile unsigned int LogHead=0,LogTail=0;
+static int LogToUart=False;
+
+//main loop only
+void debug_log(unsigned char id, unsigned char count, unsigned int a, unsigned int b, unsigned int c)
+{
+	unsigned int head=LogHead;
+	unsigned int time=UptimeCount;
+	unsigned char check;
+
+	if(((LogTail-head-1)&DebugLogRingMask)<6+2*count)
+	{
+		REG_DEBUG_LOG.dropped++;
+		return;
+	}
+
+	LogRing[head]=DebugLogSync;
+	head=(head+1)&DebugLogRingMask;
+	LogRing[head]=id;
+	head=(head+1)&DebugLogRingMask;
+	LogRing[head]=count;
+	head=(head+1)&DebugLogRingMask;
+	LogRing[head]=time;
+	head=(head+1)&DebugLogRingMask;
+	LogRing[head]=time>>8;
+	head=(head+1)&DebugLogRingMask;
+	check=id+count+time+(time>>8);
+	if(count>0)
+	{
+		LogRing[head]=a;
+		head=(head+1)&DebugLogRingMask;
+		LogRing[head]=a>>8;
+		head=(head+1)&DebugLogRingMask;
+		check+=a+(a>>8);
+	}
+	if(count>1)
+	{
+		LogRing[head]=b;
+		head=(head+1)&DebugLogRingMask;
+		LogRing[head]=b>>8;
+		head=(head+1)&DebugLogRingMask;
+		check+=b+(b>>8);
+	}
+	if(count>2)
+	{
+		LogRing[head]=c;
+		head=(head+1)&DebugLogRingMask;
+		LogRing[head]=c>>8;
+		head=(head+1)&DebugLogRingMask;
+		check+=c+(c>>8);
+	}
+	LogRing[head]=-check;
+	head=(head+1)&DebugLogRingMask;
+	//the whole record at once
+	LogHead=head;
+
+	if(LogToUart)
+	{
+		IEC0bits.U1TXIE=1;
+		IFS0bits.U1TXIF=1;
+	}
+}
+
+//the next byte for the consumer, False if there is none
+int debug_log_read(unsigned char *data)
+{
+	if(LogTail==LogHead)
+		return False;
+	*data=LogRing[LogTail];
+	LogTail=(LogTail+1)&DebugLogRingMask;
+	return True;
+}
+
+//from now on the UART1 transmit interrupt reads the log
+void debug_log_to_uart(void)
+{
+	LogToUart=True;
+}
+
+//call every pass of the main loop, hands the log out through REG_DEBUG_LOG
+void debug_log_update(void)
+{
+	unsigned int i;
+
+	if(LogToUart || REG_DEBUG_LOG_ACK!=REG_DEBUG_LOG.sequence)
+		return;
+	for(i=0;i<DebugLogChunk && debug_log_read(&REG_DEBUG_LOG.data[i]);i++);
+	if(i==0)
+		return;
+	REG_DEBUG_LOG.length=i;
+	REG_DEBUG_LOG.sequence++;
+}
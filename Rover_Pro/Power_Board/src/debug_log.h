@@ -0,0 +1,40 @@
+//Binary debug log.  Instead of a formatted string a call site logs the id of its
+//format (debug_log_formats.h), the time and up to DebugLogMaxArgs 16 bit integers;
+//tools/decode_debug_log.py does the formatting on the host.  Records go into a
+//lock-free ring written by the main loop only (not from interrupts) and read by one
+//consumer: the UART1 transmit interrupt once init_debug_uart() has run, otherwise
+//debug_log_update() hands them out through REG_DEBUG_LOG, over USB or the radio.
+//A record that doesn't fit in the ring is dropped and counted.
+//
+//A record is DebugLogSync, the format id, the number of arguments, the time in ms
+//(low 16 bits), the arguments, all low byte first, and a byte that brings the sum of
+//everything after DebugLogSync to 0 (mod 256).
+//
+//REG_DEBUG_LOG holds up to DebugLogChunk bytes of records.  The host reads it, and if
+//its sequence isn't the one it wrote to REG_DEBUG_LOG_ACK last keeps the bytes and
+//writes the sequence to REG_DEBUG_LOG_ACK, after which the next bytes are loaded.
+
+#define DebugLogRingLength 256 //must be a power of two
+#define DebugLogRingMask (DebugLogRingLength-1)
+#define DebugLogSync 0xa5
+#define DebugLogMaxArgs 3
+#define DebugLogMaxRecord (6+2*DebugLogMaxArgs)
+#define DebugLogChunk 32 //REG_DEBUG_LOG.data
+
+#define LOG_FORMAT( id, text ) id,
+enum
+{
+#include "debug_log_formats.h"
+	DebugLogFormatCount
+};
+#undef LOG_FORMAT
+
+#define LOG0(id) debug_log((id),0,0,0,0)
+#define LOG1(id,a) debug_log((id),1,(a),0,0)
+#define LOG2(id,a,b) debug_log((id),2,(a),(b),0)
+#define LOG3(id,a,b,c) debug_log((id),3,(a),(b),(c))
+
+void debug_log(unsigned char id, unsigned char count, unsigned int a, unsigned int b, unsigned int c);
+int debug_log_read(unsigned char *data);
+void debug_log_to_uart(void);
+void debug_log_update(void);
@@ -0,0 +1,15 @@
+//Format table of the binary debug log, see debug_log.h.  A record carries the index
+//of its format in this list, so only ever add formats to the end.
+//tools/decode_debug_log.py reads this file to print the records, the format is
+//Python's % formatting of the arguments: %d is signed, %u and %x unsigned 16 bit.
+//
+//LOG_FORMAT( id, text )
+
+LOG_FORMAT( LogBoot, "boot, RCON 0x%04x" )
+LOG_FORMAT( LogBatteryIdentified, "battery %u in PowerBusBatteries[] identified, method %u" )
+LOG_FORMAT( LogBatteryUnknown, "unknown battery" )
+LOG_FORMAT( LogPrechargeFailed, "precharge failed after %u pulses, bus %u mV" )
+LOG_FORMAT( LogVelocityOutOfBounds, "initial motor velocities out of bounds: %d %d %d" )
+LOG_FORMAT( LogMotorsStopped, "stopping motors forever" )
+LOG_FORMAT( LogBaselineCurrent, "baseline current: A 0x%04x B 0x%04x" )
+LOG_FORMAT( LogCurrentBalance, "current: A 0x%04x B 0x%04x, %u%% apart" )
@@ -1,5 +1 @@
-void init_debug_uart(void);
-void display_register_value(char* description);
-void send_debug_uart_string(char* input_string, unsigned char len);
-void print_loop_number(void);
-void int_to_string(unsigned int input, char* output);
+void init_debug_uart(void);
@@ -75,6 +75,9 @@
 #define Period30000Hz 532
 #define Period50000Hz 319
 
+//PWM period in Timer2 ticks (Fcy/1), 8KHz, OCxR=Duty*2 for Duty 0-1000
+#define PWMPeriod 2000
+
 /*****************************************************************************/
 //*----------------------------------UART1------------------------------------*/
 //based on 32MHz system clock rate
@@ -105,10 +108,12 @@
 
 //constant for timer
 #define SpeedUpdateTimer 5  	//200Hz
+#define TrajectoryTimer 5  	//200Hz, speed ramp update
 //#define SpeedUpdateTimer 2  	//500Hz
 #define CurrentCtrlTimer 1 	//1K
 #define CurrentSurgeRecoverTimer 10 //10ms
 #define USBTimeOutTimer 333 	//3Hz--333ms
+#define XbeeTimeOutTimer 333 	//3Hz--333ms
 #define Xbee_FanSpeedTimer 333	//3Hz--333ms
 //#define USBTimeOutTimer 3333 	//0.3Hz--3333ms
 #define SwitchDirectionTimer 10 	//10ms
@@ -117,14 +122,74 @@
 #define CurrentFBTimer 1 		//1KHz
 #define M3_POSFB_Timer 1 		//1KHz
 #define CurrentProtectionTimer 1  //1KHz
-//#define I2C2Timer 25
-#define I2C2Timer 25
-#define I2C3Timer 25 //4Hz, this is the default sample rate of TMPSensorIC
+//adaptive polling of the I2C2/I2C3 sensors, see device_robot_motor_poll.h: fast,
+//nominal and slow periods in ms
+#define FanTempFastPeriod 100
+#define FanTempPeriod 250
+#define FanTempSlowPeriod 2000
+#define FanTempChange 2 //C
+#define FanTempNear ((int)FAN_START_TEMP-5) //C, fast above this
+#define BoardTempFastPeriod 250 //4Hz, this is the default sample rate of TMPSensorIC
+#define BoardTempPeriod 500
+#define BoardTempSlowPeriod 4000
+#define BoardTempChange 2 //C
+#define BoardTempNear 60 //C, fast above this
+#define ChargerStateFastPeriod 100
+#define ChargerStatePeriod 500
+#define ChargerStateSlowPeriod 4000
+#define I2CBusClock 62000 //Hz, FCY/(I2CxBRG+1+FCY/10000000) with I2CxBRG 0xff
+#define I2CStatsPeriod 1000 //ms, I2C throughput and latency registers
+#define I2CRecoverPulses 9 //SCL pulses to clock a stuck slave off SDA
+#define I2CRecoverHalfBit 10 //us, about 50kHz while clearing a bus
 #define SFREGUpdateTimer 4 	//250Hz
 #define BATVolCheckingTimer 1 	//1KHz
 #define BATRecoveryTimer 100 	//100ms
 #define MotorOffTimer 35 		//35ms motor off if there is a surge
 
+//default speed ramp limits, overridden by REG_MOTOR_ACCEL_LIMIT/REG_MOTOR_JERK_LIMIT
+//acceleration in (speed units)/s, jerk in (speed units)/s^2, full speed is 1000
+#define DRIVE_MAX_ACCEL 2000
+#define DRIVE_MAX_JERK 10000
+#define FLIPPER_MAX_ACCEL 700
+#define FLIPPER_MAX_JERK 3500
+
+//skid-steer geometry used to mix REG_MOTOR_TWIST into wheel speeds
+#define EFFECTIVE_TRACK_WIDTH_MM 420	//wider than the physical track width because of slip
+#define FULL_SCALE_SPEED_MM_S 2000		//ground speed at a wheel speed of 1000
+#define MAX_WHEEL_SPEED 1000
+#define MAX_ANGULAR_MRAD_S 32767		//default turn limits: no angular limit,
+#define MAX_SPIN_WHEEL_SPEED MAX_WHEEL_SPEED	//full wheel speed while spinning
+#define SPIN_SPEED 500					//closed loop wheel speed when turning in place
+
+//traction monitor thresholds: speed as from DT_speed(), current in ADC counts,
+//effort as Robot_Motor_TargetSpeedUSB, tolerances in %
+#define FREE_SPIN_SPEED 300
+#define FREE_SPIN_CURRENT 40
+#define STALL_EFFORT 400
+#define STALL_SPEED 30
+#define STALL_CURRENT 500
+#define STRAIGHT_TOLERANCE 10
+#define MISMATCH_TOLERANCE 25
+#define MISMATCH_SPEED 100
+
+//drive motor velocity observer, speed in DT_speed() units
+#define CLOSED_LOOP_PERIOD_MS 10
+#define OBS_DUTY_GAIN_NUM 10			//steady-state speed = 10/7 * (duty - 7), from the
+#define OBS_DUTY_GAIN_DEN 7				//same data as GetNominalDriveEffort()
+#define OBS_DUTY_OFFSET 7
+#define OBS_TIME_CONSTANT_MS 150
+#define OBS_EDGE_SPEED_MS 1600			//DT_speed() is 100000/(16us ticks), so 1600/speed ms per edge
+#define OBS_SPEED_GAIN 128				//per update, /256
+#define OBS_DISTURBANCE_GAIN 8
+
+//what the motors do when the command link times out (REG_COMM_LOSS_ACTION)
+#define COMM_LOSS_DEFAULT 0
+#define COMM_LOSS_DECEL 1		//ramp to zero at REG_COMM_DECEL_RATE, then brake
+#define COMM_LOSS_HOLD 2		//zero speed target kept by the speed loop with its integrator live (the flipper has no speed feedback, it brakes)
+#define COMM_LOSS_COAST 3		//turn the bridge off and freewheel
+#define DRIVE_COMM_LOSS_ACTION COMM_LOSS_DECEL
+#define FLIPPER_COMM_LOSS_ACTION COMM_LOSS_HOLD	//a raised flipper must not fall
+
 
 //at 16MHz, TMR4 prescale 256:1, its .000016 seconds/ timer count
 //so the math works for motor RPMs works out as follows...
@@ -274,6 +339,24 @@
 
 //#define BATVoltageLimit 650 //11.06V, 3.3V-1024, 430K-100K voltage divider, 1024->17.49V
 #define BATVoltageLimit 800 //11.06V, 3.3V-1024, 430K-100K voltage divider, 1024->17.49V
+//battery overcurrent per cell, used while REG_PWR_OVERCURRENT_LIMIT is 0
+#define BATTripCurrent 15000 //mA, 512 counts at the nominal 34.13 counts/A
+#define BATResetCurrent 10000 //mA, 341 counts
+//state of charge estimation, used while REG_PWR_BAT_CAPACITY is 0
+#define BATCapacity 7500 //mAh per battery, nominal
+#define BATSOCCorrectionGain 64 //part of the gauge error corrected per reading, /256
+#define BATCurrentAverageTime 10 //s, for the runtime estimate
+//I2t thermal model of the motor windings, nominal values; the rated currents
+//are used while REG_MOTOR_RATED_CURRENT is 0, temperatures are in 0.1C
+#define DriveRatedCurrent 5000 //mA continuous
+#define FlipperRatedCurrent 3000 //mA continuous
+#define DriveThermalTimeConstant 600 //s
+#define FlipperThermalTimeConstant 300 //s
+#define MotorThermalRise 800 //settled rise above ambient at the rated current
+#define MotorThermalAmbient 400
+#define MotorDerateStart 1000 //start scaling the motor effort down
+#define MotorDerateLimit 1200 //effort is scaled by MotorDerateMinFactor from here up
+#define MotorDerateMinFactor 64 // /256
 
 //control mode
 #define SpeedControl 0
@@ -285,6 +368,47 @@
 #define SampleLength 4
 #define ShiftBits 2
 
+//analog inputs
+#define AN_RMotorCurrent 1
+#define AN_LMotorCurrent 3
+#define AN_FlipperPot1 8
+#define AN_FlipperPot2 9
+#define AN_CellAVoltage 10
+#define AN_CellBVoltage 11
+#define AN_CellACurrent 12
+#define AN_CellBCurrent 13
+#define AN_FlipperCurrent 15
+#define SlowChannelCount 6
+//position of each slow input in SlowChannel[] and ADCFrame.slow[]
+#define SlowFlipperPot1 0
+#define SlowFlipperPot2 1
+#define SlowCellAVoltage 2
+#define SlowCellBVoltage 3
+#define SlowCellACurrent 4
+#define SlowCellBCurrent 5
+//decimator channels: the motor currents (LMotor, RMotor, Flipper), then the slow inputs
+#define ADCChannelCount (3+SlowChannelCount)
+#define ADCSlowChannel(i) (3+(i))
+#define ADCBits 10
+//one A/D frame every SlowChannelCount PWM periods of 125us
+#define ADCFrameUs 750
+//ms after boot to capture the zero offsets of the motor currents, the
+//decimators have settled and the motors have not been driven yet
+#define ADCZeroTime 300
+//REG_ADC_CAL_COMMAND.command
+#define ADCCalCommandZero 1 //the channel reads zero now
+#define ADCCalCommandReference 2 //the channel reads REG_ADC_CAL_COMMAND.value (mV or mA) now
+#define ADCCalCommandSave 3 //store all channels in DEE
+#define ADCCalCommandDefaults 4 //back to the nominal design values (not stored)
+//REG_ADC_CAL_STATUS
+#define ADCCalStatusOK 1
+#define ADCCalStatusBadCommand 2
+#define ADCCalStatusBadReading 3
+//Timer2 ticks from setting ASAM to the end of sampling (SAMC=15 TAD), and
+//for a whole sample + conversion (15+12 TAD), TAD=2 TCY
+#define ADSampleTicks 30
+#define ADConversionTicks 54
+
 //I2C Device Address
 #define TMPSensorICAddressW 0b10010010
 #define TMPSensorICAddressR 0b10010011
@@ -294,12 +418,22 @@
 #define	BATTERY_ADDRESS				0x0b
 #define EEPROM_ADDRESS            0x50
 #define BATTERY_CHARGER_ADDRESS 0x0c
+#define TMP_SENSOR_ADDRESS 0x49
+
+//I2C registers and SMBus commands
+#define FANCtrlTemp1Reg 0x00
+#define FANCtrlTemp2Reg 0x01
+#define FANCtrlDuty1Reg 0x0b //target duty in manual mode
+#define FANCtrlDuty2Reg 0x0c
+#define FANCtrlConfigReg 0x02
+#define FANCtrlModeReg 0x11
+#define FANCtrlRateReg 0x12 //duty rate of change
+#define FANCtrlReset 0b01011000 //to FANCtrlConfigReg
+#define TMPSensorTempReg 0x00
+#define CHARGER_STATE_COMMAND 0xca
 
 #define FAN_START_TEMP 40.0// 
-#define FAN_MAX_TEMP 50.0
 #define FAN_MAX_DUTY 240 //per datasheet
-#define FAN_LO_DUTY_FACTOR 0.5
-#define FAN_HI_DUTY_FACTOR 1.0
 
 //Subsystem control
 #define Available 0
@@ -310,6 +444,7 @@
 /////variable
 
 extern int16_t Robot_Motor_TargetSpeedUSB[3];
+extern long RealTimeCurrent[3];
 extern int NEW_ROBOT_MOTOR_SPEED_RECEIVED;
 extern int gNewData;
 //PulseWidth[0]-unknown 
@@ -371,6 +506,8 @@ void IniTimer5();
 /*****************************************************************************/
 //*-----------------------------------A/D------------------------------------*/
 void IniAD();
+void IniCurrentSampling(void);
+void ProcessADCFrames(void);
 
 
 /*****************************************************************************/
@@ -407,7 +544,6 @@ void I2C1Ini();
 void I2C2Ini();
 void I2C3Ini();
 void TMPSensorICIni();
-void I2C3Update();
 void FANCtrlIni();
 void Motor_I2C3ResigsterWrite(int8_t ICAddW, int8_t RegAdd, int8_t Data);
 void InterruptIni();
@@ -422,13 +558,12 @@ void Motor_T2Interrupt(void);
 void Motor_T3Interrupt(void);
 void Motor_T4Interrupt(void);
 void Motor_T5Interrupt(void);
+void Motor_OC4Interrupt(void);
 
 void  Motor_ADC1Interrupt(void);
 
 
 //Testing functions
-void Motor_U1TXInterrupt(void);
-void Motor_U1RXInterrupt(void);
 void TestIO(void);
 void TestIC1();
 void TestPWM(void);
@@ -439,4 +574,9 @@ extern int Cell_A_Current[SampleLength];
 extern int Cell_B_Current[SampleLength];
 extern int16_t Xbee_MOTOR_VELOCITY[3];
 extern uint8_t Xbee_SIDE_FAN_SPEED;
-extern uint8_t Xbee_SIDE_FAN_NEW;
\ No newline at end of file
+extern uint8_t Xbee_SIDE_FAN_NEW;
+extern int Xbee_gNewData;
+extern uint8_t Xbee_Low_Speed_mode;
+extern uint8_t Xbee_Calibration;
+extern int Xbee_FanSpeedTimerEnabled;
+extern int Xbee_FanSpeedTimerCount;
\ No newline at end of file
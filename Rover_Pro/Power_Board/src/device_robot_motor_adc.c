@@ -0,0 +1,165 @@
+#include "p24FJ256GB106.h"
+#include "stdhdr.h"
+#include "device_robot_motor.h"
+#include "device_robot_motor_adc.h"
+#include "../closed_loop_control/FanCurve.h"
+#include "device_robot_motor_config.h"
+
+ADCSample ADCRing[ADCRingLength];
+volatile unsigned char ADCRingHead=0;//written by the interrupt only
+volatile unsigned char ADCRingTail=0;//written by the main loop only
+volatile unsigned int ADCOverrunCount=0;
+ADCCalibration ADCCal[ADCChannelCount];
+
+//nominal scales of the board design, used until a board is calibrated
+//cells: 430K-100K divider, 1024 counts = 17.49V; .11 V/A sense, 34.13 counts/A
+//the motor current sense is assumed to share the cell current scale
+const unsigned int ADCCalDefaultGain[ADCChannelCount]={30003,30003,30003,3300,3300,17490,17490,30003,30003};
+
+//called from Motor_ADC1Interrupt()
+void ADCPushSample(const ADCSample *sample)
+{
+	unsigned char next=(ADCRingHead+1)&ADCRingMask;
+
+	//drop the newest sample if the main loop has fallen behind, the frame it
+	//belongs to is thrown away by ADCGetFrame()
+	if(next==ADCRingTail)
+	{
+		ADCOverrunCount++;
+		return;
+	}
+	ADCRing[ADCRingHead]=*sample;
+	//publish the sample only after it has been copied
+	ADCRingHead=next;
+}
+
+//called from the main loop, returns True each time a frame is completed
+//call it until it returns False to drain the ring
+int ADCGetFrame(ADCFrame *frame)
+{
+	static unsigned long current_sum[3]={0,0,0};
+	static unsigned int current_count[3]={0,0,0};
+	static unsigned int slow[SlowChannelCount];
+	static unsigned int slow_seen=0;
+	static unsigned int last_overrun_count=0;
+	const unsigned int all_slow_seen=(1<<SlowChannelCount)-1;
+	ADCSample *sample;
+	int i;
+
+	while(ADCRingTail!=ADCRingHead)
+	{
+		sample=&ADCRing[ADCRingTail];
+
+		//a sample was lost, start over with the next round
+		if(ADCOverrunCount!=last_overrun_count)
+		{
+			last_overrun_count=ADCOverrunCount;
+			slow_seen=0;
+			for(i=LMotor;i<=Flipper;i++)
+			{
+				current_sum[i]=0;
+				current_count[i]=0;
+			}
+		}
+
+		current_sum[sample->motor]+=sample->current;
+		current_count[sample->motor]++;
+		slow[sample->slow_index]=sample->slow;
+		slow_seen|=(1<<sample->slow_index);
+
+		if(sample->slow_index==SlowChannelCount-1 && slow_seen==all_slow_seen)
+		{
+			frame->time=sample->time;
+			for(i=LMotor;i<=Flipper;i++)
+			{
+				//a round of 6 pairs converts each of the 3 motors twice
+				if(current_count[i])
+					frame->current[i]=current_sum[i]/current_count[i];
+				else
+					frame->current[i]=0;
+				current_sum[i]=0;
+				current_count[i]=0;
+			}
+			for(i=0;i<SlowChannelCount;i++)
+			{
+				frame->slow[i]=slow[i];
+			}
+			slow_seen=0;
+			ADCRingTail=(ADCRingTail+1)&ADCRingMask;
+			return True;
+		}
+		ADCRingTail=(ADCRingTail+1)&ADCRingMask;
+	}
+	return False;
+}
+
+//load the calibration stored by ADCCalSave(), ConfigIni() must have run
+void ADCCalInit(void)
+{
+	int i;
+
+	ADCCalDefaults();
+	if(!Config.adc_cal_valid)
+		return;
+	for(i=0;i<ADCChannelCount;i++)
+	{
+		ADCCal[i].offset=Config.adc_offset[i];
+		ADCCal[i].gain=Config.adc_gain[i];
+	}
+}
+
+void ADCCalDefaults(void)
+{
+	int i;
+
+	for(i=0;i<ADCChannelCount;i++)
+	{
+		ADCCal[i].offset=0;
+		ADCCal[i].gain=ADCCalDefaultGain[i];
+	}
+}
+
+long ADCCalToUnits(int channel, unsigned int counts)
+{
+	long difference=(long)counts-ADCCal[channel].offset;
+
+	return (difference*ADCCal[channel].gain)>>ADCCalBits;
+}
+
+//the input of the channel reads counts at zero, returns False if that is not believable
+int ADCCalZero(int channel, unsigned int counts)
+{
+	if(counts>ADCCalMaxOffset)
+		return False;
+	ADCCal[channel].offset=counts;
+	return True;
+}
+
+//the input of the channel reads counts at a known value in units
+int ADCCalReference(int channel, unsigned int counts, unsigned int units)
+{
+	long span=(long)counts-ADCCal[channel].offset;
+	unsigned long gain;
+
+	if(span<ADCCalMinSpan)
+		return False;
+	gain=(((unsigned long)units<<ADCCalBits)+span/2)/span;
+	if(gain==0 || gain>0xffff)
+		return False;
+	ADCCal[channel].gain=gain;
+	return True;
+}
+
+//ConfigUpdate() stores it once the settings stop changing
+void ADCCalSave(void)
+{
+	int i;
+
+	Config.adc_cal_valid=True;
+	for(i=0;i<ADCChannelCount;i++)
+	{
+		Config.adc_offset[i]=ADCCal[i].offset;
+		Config.adc_gain[i]=ADCCal[i].gain;
+	}
+	ConfigChanged();
+}
@@ -0,0 +1,57 @@
+//A/D samples are handed from Motor_ADC1Interrupt() to the main loop through a
+//lock-free ring.  The interrupt is the only writer of the head and the main
+//loop the only writer of the tail, so neither side has to disable interrupts.
+//The main loop turns the samples back into frames that hold every channel.
+
+#define ADCRingLength 32 //must be a power of two
+#define ADCRingMask (ADCRingLength-1)
+
+//one OC4-triggered conversion pair
+typedef struct
+{
+	unsigned int time;//TMR5 when the pair was read, 16us per tick like the tach periods
+	unsigned char motor;//LMotor, RMotor or Flipper
+	unsigned char slow_index;//position in SlowChannel[]
+	unsigned int current;
+	unsigned int slow;
+} ADCSample;
+
+//one full round of the slow inputs (SlowChannelCount pairs), every motor
+//current is the average of the samples taken during that round
+typedef struct
+{
+	unsigned int time;//time of the last pair in the frame
+	unsigned int current[3];
+	unsigned int slow[SlowChannelCount];
+} ADCFrame;
+
+void ADCPushSample(const ADCSample *sample);
+int ADCGetFrame(ADCFrame *frame);
+
+extern volatile unsigned int ADCOverrunCount;
+
+//calibration to engineering units, one entry per decimator channel:
+//currents in mA, voltages in mV (the flipper pots as the voltage at the pin)
+//units = (counts - offset) * gain / 1024, counts and offset carry
+//ADCCalFractionBits of fraction, gain is the units at 1024 counts
+#define ADCCalBits 14
+#define ADCCalFractionBits (ADCCalBits-ADCBits)
+#define ADCCalMaxOffset (64<<ADCCalFractionBits)//largest believable zero current reading
+#define ADCCalMinSpan (64<<ADCCalFractionBits)//smallest reference - offset for a gain
+#define ADCCalDEEAddress 16//where it was stored before the config store, migrated by ConfigIni()
+#define ADCCalDEEMarker 0xCA1B
+
+typedef struct
+{
+	unsigned int offset;
+	unsigned int gain;
+} ADCCalibration;
+
+void ADCCalInit(void);
+void ADCCalDefaults(void);
+long ADCCalToUnits(int channel, unsigned int counts);
+int ADCCalZero(int channel, unsigned int counts);
+int ADCCalReference(int channel, unsigned int counts, unsigned int units);
+void ADCCalSave(void);
+
+extern ADCCalibration ADCCal[ADCChannelCount];
@@ -0,0 +1,299 @@
+#include "p24FJ256GB106.h"
+#include "stdhdr.h"
+#include "device_robot_motor.h"
+#include "device_robot_motor_adc.h"
+#include "device_robot_motor_fan.h"
+#include "DEE Emulation 16-bit.h"
+#include "../closed_loop_control/FanCurve.h"
+#include "device_robot_motor_config.h"
+#include <string.h>
+
+//header words
+#define HeaderMagic 0
+#define HeaderSequence 1
+#define HeaderLength 2
+#define HeaderCRC 3
+
+//the flipper offset as calibrate_flipper_angle_sensor() used to store it
+#define LegacyFlipperMarker 0xaa
+
+ConfigData Config;
+static ConfigData Stored;//what the current slot holds
+static int Slot=-1;//the current slot, -1 for none
+static unsigned int Sequence=0;
+static unsigned int Changes=0,SeenChanges=0;
+static unsigned long ChangeTime;
+
+//a save queued for DEE, it only becomes the current slot once it reads back
+static ConfigData Saving;
+static int SavingSlot=-1;
+static unsigned int SavingErrors;
+
+static void defaults(ConfigData *config);
+static void check_save(void);
+static int load_slot(int slot, ConfigData *config, unsigned int *sequence, unsigned int *version);
+static void migrate(void);
+static unsigned int slot_address(int slot);
+static uint16_t crc16(const uint16_t *words, unsigned int count);
+static void publish(void);
+
+//load the settings, before any module reads Config
+void ConfigIni(void)
+{
+	unsigned int sequence[2],version[2];
+	int good[2];
+
+	DataEEInit();
+	Nop();
+
+	Slot=-1;
+	good[0]=load_slot(0,&Config,&sequence[0],&version[0]);
+	good[1]=load_slot(1,&Config,&sequence[1],&version[1]);
+	//the later of the two, sequence wraps
+	if(good[0] && (!good[1] || (int)(sequence[0]-sequence[1])>0))
+		Slot=0;
+	else if(good[1])
+		Slot=1;
+
+	if(Slot<0)
+	{
+		migrate();
+		publish();
+		return;
+	}
+
+	//load_slot() leaves the slot it read last in Config
+	if(Slot==0 && good[1])
+		load_slot(0,&Config,&sequence[0],&version[0]);
+	Sequence=sequence[Slot];
+	memcpy(&Stored,&Config,sizeof(Config));
+	REG_CONFIG_STATUS.source=(version[Slot]<ConfigVersion)?ConfigSourceOlder:ConfigSourceStored;
+	publish();
+}
+
+//Config was changed, write it once it has been left alone for ConfigFlushDelay
+void ConfigChanged(void)
+{
+	Changes++;
+}
+
+//queue Config for DEE now if it differs from what is stored, DataEEUpdate() writes it
+//and ConfigUpdate() checks it made it before the slot is used
+int ConfigSave(void)
+{
+	uint16_t *words=(uint16_t *)&Config;
+	int slot=(Slot==0)?1:0;
+	unsigned int address=slot_address(slot);
+	unsigned int i;
+	unsigned char error;
+
+	check_save();
+	SeenChanges=Changes;
+	if(Slot>=0 && memcmp(&Config,&Stored,sizeof(Config))==0)
+		return True;
+	//all of it or nothing, try again once the queue has drained and the last save
+	//has been checked
+	if(SavingSlot>=0 || DataEEQueueFree()<ConfigHeaderWords+1+ConfigDataWords)
+	{
+		ConfigChanged();
+		publish();
+		return True;
+	}
+
+	//invalidate first, so an interrupted save is not mistaken for a good one
+	error=DataEEWrite(0,address+HeaderMagic);
+	for(i=0;i<ConfigDataWords;i++)
+		error|=DataEEWrite(words[i],address+ConfigHeaderWords+i);
+	error|=DataEEWrite(Sequence+1,address+HeaderSequence);
+	error|=DataEEWrite(ConfigDataWords,address+HeaderLength);
+	error|=DataEEWrite(crc16(words,ConfigDataWords),address+HeaderCRC);
+	if(error==0)
+		error|=DataEEWrite(ConfigMagic|ConfigVersion,address+HeaderMagic);
+
+	if(error)
+	{
+		REG_CONFIG_STATUS.errors++;
+		publish();
+		return False;
+	}
+	memcpy(&Saving,&Config,sizeof(Config));
+	SavingSlot=slot;
+	SavingErrors=dataEEStatus.errors;
+	publish();
+	return True;
+}
+
+//call from the main loop with the time in ms
+void ConfigUpdate(unsigned long now)
+{
+	check_save();
+
+	if(REG_CONFIG_COMMAND!=0)
+	{
+		switch(REG_CONFIG_COMMAND)
+		{
+			case ConfigCommandSave:
+				ConfigSave();
+			break;
+			case ConfigCommandDefaults:
+				defaults(&Config);
+				ConfigSave();
+			break;
+		}
+		REG_CONFIG_COMMAND=0;
+	}
+
+	if(Changes!=SeenChanges)
+	{
+		//coalesce, the delay starts over with every change
+		SeenChanges=Changes;
+		ChangeTime=now;
+		REG_CONFIG_STATUS.pending=True;
+	}
+	else if(REG_CONFIG_STATUS.pending && now-ChangeTime>=ConfigFlushDelay)
+	{
+		//a failed write is tried again after another ConfigFlushDelay
+		if(!ConfigSave())
+			ChangeTime=now;
+	}
+}
+
+static void defaults(ConfigData *config)
+{
+	memset(config,0,sizeof(*config));
+	config->flipper_offset=0xffff;
+	config->adc_cal_valid=False;
+	config->fan_curve_valid=False;
+}
+
+//once DEE has programmed the queued save, make it the current slot if it reads back
+//as it was queued.  Otherwise the previous slot stays current and the save is tried
+//again after ConfigFlushDelay, into the same slot.
+static void check_save(void)
+{
+	ConfigData config;
+	unsigned int sequence,version;
+
+	if(SavingSlot<0 || dataEEStatus.queued!=0 || dataEEStatus.state!=DATA_EE_IDLE)
+		return;
+
+	if(dataEEStatus.errors==SavingErrors &&
+	   load_slot(SavingSlot,&config,&sequence,&version) &&
+	   sequence==Sequence+1 && memcmp(&config,&Saving,sizeof(config))==0)
+	{
+		Slot=SavingSlot;
+		Sequence=sequence;
+		memcpy(&Stored,&Saving,sizeof(Stored));
+		REG_CONFIG_STATUS.saves++;
+	}
+	else
+	{
+		REG_CONFIG_STATUS.errors++;
+		ConfigChanged();
+	}
+	SavingSlot=-1;
+	publish();
+}
+
+//reads the slot into config, False if it isn't a good one
+static int load_slot(int slot, ConfigData *config, unsigned int *sequence, unsigned int *version)
+{
+	uint16_t *words=(uint16_t *)config;
+	uint16_t stored[ConfigSlotWords-ConfigHeaderWords];
+	unsigned int address=slot_address(slot);
+	unsigned int magic=DataEERead(address+HeaderMagic);
+	unsigned int length=DataEERead(address+HeaderLength);
+	unsigned int i;
+
+	if((magic&0xff00)!=ConfigMagic || (magic&0xff)==0 || (magic&0xff)>ConfigVersion)
+		return False;
+	if(length==0 || length>ConfigSlotWords-ConfigHeaderWords)
+		return False;
+	for(i=0;i<length;i++)
+		stored[i]=DataEERead(address+ConfigHeaderWords+i);
+	if(crc16(stored,length)!=DataEERead(address+HeaderCRC))
+		return False;
+
+	//an older, shorter layout keeps the defaults for the fields it doesn't have
+	defaults(config);
+	for(i=0;i<length && i<ConfigDataWords;i++)
+		words[i]=stored[i];
+	*sequence=DataEERead(address+HeaderSequence);
+	*version=magic&0xff;
+	return True;
+}
+
+//no good slot: take whatever the old fixed addresses hold, and save it
+static void migrate(void)
+{
+	int i;
+	unsigned int marker;
+
+	defaults(&Config);
+	REG_CONFIG_STATUS.source=ConfigSourceDefaults;
+
+	marker=DataEERead(2)&0xff;
+	if(marker==LegacyFlipperMarker)
+	{
+		Config.flipper_offset=((DataEERead(0)&0xff)<<8)|(DataEERead(1)&0xff);
+		REG_CONFIG_STATUS.source=ConfigSourceMigrated;
+	}
+	if(DataEERead(ADCCalDEEAddress)==ADCCalDEEMarker)
+	{
+		Config.adc_cal_valid=True;
+		for(i=0;i<ADCChannelCount;i++)
+		{
+			Config.adc_offset[i]=DataEERead(ADCCalDEEAddress+1+2*i);
+			Config.adc_gain[i]=DataEERead(ADCCalDEEAddress+2+2*i);
+		}
+		REG_CONFIG_STATUS.source=ConfigSourceMigrated;
+	}
+	if(DataEERead(FanCurveDEEAddress)==FanCurveDEEMarker)
+	{
+		Config.fan_curve_valid=True;
+		for(i=0;i<FAN_CURVE_POINTS;i++)
+		{
+			Config.fan_temperature[i]=DataEERead(FanCurveDEEAddress+1+i);
+			Config.fan_duty[i]=DataEERead(FanCurveDEEAddress+1+FAN_CURVE_POINTS+i);
+		}
+		Config.fan_hysteresis=DataEERead(FanCurveDEEAddress+1+2*FAN_CURVE_POINTS);
+		REG_CONFIG_STATUS.source=ConfigSourceMigrated;
+	}
+
+	//only a board that had something stored writes now, a new one waits for a change
+	if(REG_CONFIG_STATUS.source==ConfigSourceMigrated)
+		ConfigSave();
+}
+
+static unsigned int slot_address(int slot)
+{
+	return ConfigDEEAddress+slot*ConfigSlotWords;
+}
+
+//CRC-16/CCITT, 0xffff first, of the words low byte first
+static uint16_t crc16(const uint16_t *words, unsigned int count)
+{
+	uint16_t crc=0xffff;
+	unsigned int i;
+	int bit,byte;
+
+	for(i=0;i<count;i++)
+	{
+		for(byte=0;byte<2;byte++)
+		{
+			crc^=(uint16_t)((byte==0)?(words[i]&0xff):(words[i]>>8))<<8;
+			for(bit=0;bit<8;bit++)
+				crc=(crc&0x8000)?(crc<<1)^0x1021:crc<<1;
+		}
+	}
+	return crc;
+}
+
+static void publish(void)
+{
+	REG_CONFIG_STATUS.version=ConfigVersion;
+	REG_CONFIG_STATUS.slot=Slot;
+	REG_CONFIG_STATUS.sequence=Sequence;
+	REG_CONFIG_STATUS.pending=(Changes!=SeenChanges) || SavingSlot>=0 ||
+		(Slot>=0 && memcmp(&Config,&Stored,sizeof(Config))!=0);
+}
@@ -0,0 +1,59 @@
+//Settings kept in DEE.  Config is the RAM copy the modules read at start up and
+//change; ConfigChanged() marks it changed and ConfigUpdate() writes it
+//ConfigFlushDelay after the last change, so a burst of changes costs one write.
+//The settings changed through registers (flipper calibration, A/D calibration, fan
+//curve) all go this way.  ConfigSave() writes right away (REG_CONFIG_COMMAND, and
+//before a restart), and nothing is written when Config matches what is stored.  Writes go into the DEE queue, DataEEUpdate()
+//programs them in the background; REG_DEE_STATUS shows when they are done.
+//
+//Config is stored in one of two slots of ConfigSlotWords DEE words: a header
+//(ConfigMagic|version, sequence, length in words, CRC-16 of the data) and the
+//data.  A save goes to the other slot, its header last, so a save cut short by a
+//brown-out leaves the previous one in place, and the other slot only becomes the
+//current one once DEE has programmed it and it reads back.  At start up the good slot with the
+//highest sequence is loaded.  Fields are only ever added to the end of ConfigData:
+//a slot of an older version is loaded as far as it goes and the rest keeps the
+//defaults.  Without a good slot the settings stored before this module (flipper
+//offset at DEE 0, A/D calibration at ADCCalDEEAddress, fan curve at
+//FanCurveDEEAddress) are migrated and saved.
+//
+//REG_CONFIG_COMMAND: ConfigCommandSave writes now, ConfigCommandDefaults stores the
+//defaults (used from the next start up).  Published in REG_CONFIG_STATUS.
+
+#define ConfigVersion 1
+#define ConfigMagic 0xC500 //high byte of the first header word
+#define ConfigHeaderWords 4
+#define ConfigSlotWords 48
+#define ConfigDEEAddress 64 //two slots, after the fan curve
+#define ConfigFlushDelay 2000 //ms after the last change
+
+//REG_CONFIG_COMMAND
+#define ConfigCommandSave 1
+#define ConfigCommandDefaults 2
+
+//REG_CONFIG_STATUS.source
+#define ConfigSourceDefaults 0
+#define ConfigSourceStored 1
+#define ConfigSourceMigrated 2 //from the old DEE addresses
+#define ConfigSourceOlder 3 //an older version, the new fields are defaults
+
+typedef struct
+{
+	uint16_t flipper_offset;//whole degrees, 0xffff not calibrated
+	uint16_t adc_cal_valid;
+	uint16_t adc_offset[ADCChannelCount];
+	uint16_t adc_gain[ADCChannelCount];
+	uint16_t fan_curve_valid;
+	int16_t fan_temperature[FAN_CURVE_POINTS];
+	uint16_t fan_duty[FAN_CURVE_POINTS];
+	int16_t fan_hysteresis;
+} ConfigData;
+
+#define ConfigDataWords (sizeof(ConfigData)/2)
+
+extern ConfigData Config;
+
+void ConfigIni(void);
+void ConfigChanged(void);
+int ConfigSave(void);
+void ConfigUpdate(unsigned long now);
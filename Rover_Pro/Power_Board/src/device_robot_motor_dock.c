@@ -0,0 +1,157 @@
+#include "p24FJ256GB106.h"
+#include "stdhdr.h"
+#include "device_robot_motor.h"
+#include "device_robot_motor_dock.h"
+#include "../closed_loop_control/BatteryGauge.h"
+
+static int State=DockUndocked;
+static int Side=DockSideBoth;
+static int Full[2]={False,False};
+static unsigned long SideTime,LastTime;
+static unsigned long ChargeTime[2];
+
+static int choose_side(unsigned long now, int *reason);
+static void update_full(int cell);
+static void connect(int side);
+static void publish(void);
+
+//call every 1ms with the time in ms, once the power bus is up
+void DockUpdate(unsigned long now)
+{
+	int target,reason;
+
+	//robot has left the charger -- turn both cells on
+	if(REG_MOTOR_CHARGER_STATE!=DockChargerDocked)
+	{
+		connect(DockSideBoth);
+		if(State!=DockUndocked)
+		{
+			State=DockUndocked;
+			Side=DockSideBoth;
+			publish();
+		}
+		return;
+	}
+
+	update_full(Cell_A);
+	update_full(Cell_B);
+
+	//if we're on the dock, immediately turn off one side of the power bus
+	if(State==DockUndocked)
+	{
+		REG_DOCK_CHARGE.switches=0;
+		ChargeTime[Cell_A]=ChargeTime[Cell_B]=0;
+		Side=choose_side(now,&reason);
+		REG_DOCK_CHARGE.reason=reason;
+		State=DockCharging;
+		SideTime=LastTime=now;
+	}
+
+	ChargeTime[(Side==DockSideA)?Cell_A:Cell_B]+=now-LastTime;
+	LastTime=now;
+
+	target=choose_side(now,&reason);
+	if(target!=Side)
+	{
+		//make before break, see connect()
+		REG_DOCK_CHARGE.switches++;
+		REG_DOCK_CHARGE.reason=reason;
+		Side=target;
+		SideTime=now;
+	}
+	State=(Full[Cell_A] && Full[Cell_B])?DockBothFull:DockCharging;
+
+	//every time, a bus that something else switched on goes back to one side
+	connect(Side);
+	publish();
+}
+
+//the side that should be charging now
+static int choose_side(unsigned long now, int *reason)
+{
+	unsigned int soc_a=REG_PWR_SOC.a;
+	unsigned int soc_b=REG_PWR_SOC.b;
+	int other=(Side==DockSideA)?DockSideB:DockSideA;
+
+	*reason=REG_DOCK_CHARGE.reason;
+
+	if(Full[Cell_A] && Full[Cell_B])
+	{
+		*reason=DockReasonBothFull;
+		return (Side==DockSideBoth)?DockSideB:Side;
+	}
+	if(Full[Cell_A] || Full[Cell_B])
+	{
+		*reason=DockReasonOtherFull;
+		return Full[Cell_A]?DockSideB:DockSideA;
+	}
+
+	if(soc_a==GAUGE_UNKNOWN || soc_b==GAUGE_UNKNOWN)
+	{
+		if(Side==DockSideBoth)
+		{
+			*reason=DockReasonDocked;
+			return DockSideB;
+		}
+		if(now-SideTime<DockAlternatePeriod)
+			return Side;
+		*reason=DockReasonNoSOC;
+		return other;
+	}
+
+	if(Side==DockSideBoth)
+	{
+		*reason=DockReasonDocked;
+		return (soc_a<soc_b)?DockSideA:DockSideB;
+	}
+	if(now-SideTime<DockMinDwell)
+		return Side;
+	if((Side==DockSideA && soc_a>=soc_b+DockBalanceBand) ||
+	   (Side==DockSideB && soc_b>=soc_a+DockBalanceBand))
+	{
+		*reason=DockReasonEmptier;
+		return other;
+	}
+	return Side;
+}
+
+//full on the battery's word or the estimate, until the estimate drops below DockRestartSOC
+static void update_full(int cell)
+{
+	unsigned int status=(cell==Cell_A)?REG_SMART_BATTERY_A.status:REG_SMART_BATTERY_B.status;
+	unsigned int soc=(cell==Cell_A)?REG_PWR_SOC.a:REG_PWR_SOC.b;
+
+	if((status&DockFullyCharged) || (soc!=GAUGE_UNKNOWN && soc>=DockFullSOC))
+		Full[cell]=True;
+	else if(soc==GAUGE_UNKNOWN || soc<DockRestartSOC)
+		Full[cell]=False;
+}
+
+//the new side goes on before the old one goes off, so the bus is never dropped
+static void connect(int side)
+{
+	if(side==DockSideA)
+	{
+		Cell_Ctrl(Cell_A,Cell_ON);
+		Cell_Ctrl(Cell_B,Cell_OFF);
+	}
+	else if(side==DockSideB)
+	{
+		Cell_Ctrl(Cell_B,Cell_ON);
+		Cell_Ctrl(Cell_A,Cell_OFF);
+	}
+	else
+	{
+		Cell_Ctrl(Cell_A,Cell_ON);
+		Cell_Ctrl(Cell_B,Cell_ON);
+	}
+}
+
+static void publish(void)
+{
+	REG_DOCK_CHARGE.state=State;
+	REG_DOCK_CHARGE.side=Side;
+	REG_DOCK_CHARGE.full=(Full[Cell_A]?1:0)|(Full[Cell_B]?2:0);
+	REG_DOCK_CHARGE.charge_s[Cell_A]=ChargeTime[Cell_A]/1000;
+	REG_DOCK_CHARGE.charge_s[Cell_B]=ChargeTime[Cell_B]/1000;
+}
@@ -0,0 +1,41 @@
+//Charge balancing on the dock.  While docked only one battery is left on the power
+//bus at a time, so one side can't charge the other through it.  DockUpdate(),
+//called every 1ms once the power bus is up, picks the side to charge from the state
+//of charge estimates (REG_PWR_SOC): the emptier battery is charged until it is
+//DockBalanceBand fuller than the other, and no sooner than DockMinDwell after the
+//last switch.  A full battery (SBS FULLY_CHARGED, or DockFullSOC) is left alone
+//until it drops below DockRestartSOC, and once both are full the side is held.
+//While either estimate is unknown the sides alternate every DockAlternatePeriod,
+//as they used to.  A switch connects the new side before disconnecting the old one
+//and doesn't wait for a low current: the charger current flows through the FET of
+//the side being charged, so it only drops once that side is switched off, and the
+//charger has no state that says it has paused.  Decisions are published in
+//REG_DOCK_CHARGE.
+
+#define DockChargerDocked 0xdada //REG_MOTOR_CHARGER_STATE on the dock
+#define DockBalanceBand 300 //0.01%
+#define DockMinDwell 60000 //ms
+#define DockAlternatePeriod 10000 //ms
+#define DockFullSOC 9900 //0.01%
+#define DockRestartSOC 9500 //0.01%
+#define DockFullyCharged 0x0020 //SBS BatteryStatus
+
+//REG_DOCK_CHARGE.state
+#define DockUndocked 0
+#define DockCharging 1
+#define DockBothFull 2
+
+//REG_DOCK_CHARGE.side
+#define DockSideBoth 0
+#define DockSideA 1
+#define DockSideB 2
+
+//REG_DOCK_CHARGE.reason, for the last choice of side
+#define DockReasonNone 0
+#define DockReasonDocked 1 //the emptier side when docking
+#define DockReasonEmptier 2
+#define DockReasonOtherFull 3
+#define DockReasonBothFull 4
+#define DockReasonNoSOC 5 //timed alternation
+
+void DockUpdate(unsigned long now);
@@ -0,0 +1,189 @@
+#include "p24FJ256GB106.h"
+#include "stdhdr.h"
+#include "device_robot_motor.h"
+#include "device_robot_motor_i2c.h"
+#include "device_robot_motor_fan.h"
+#include "../closed_loop_control/Thermal.h"
+#include "../closed_loop_control/FanCurve.h"
+#include "device_robot_motor_config.h"
+
+static const fan_curve_t FanCurveDefault=
+{
+	FanCurveDefaultTemperatures,
+	FanCurveDefaultDuties,
+	FanCurveDefaultHysteresis
+};
+
+static void handle_command(void);
+static int curve_from_command(fan_curve_t *curve);
+static void save_curve(const fan_curve_t *curve);
+static void publish_curve(void);
+
+//load the curve stored by FanCurveCommandSave, ConfigIni() must have run
+void FanIni(void)
+{
+	fan_curve_t curve;
+	int i;
+
+	FAN_SetCurve(&FanCurveDefault);
+	if(Config.fan_curve_valid)
+	{
+		for(i=0;i<FAN_CURVE_POINTS;i++)
+		{
+			curve.temperature[i]=Config.fan_temperature[i];
+			curve.duty[i]=Config.fan_duty[i];
+		}
+		curve.hysteresis=Config.fan_hysteresis;
+		if(FAN_CheckCurve(&curve))
+			FAN_SetCurve(&curve);
+	}
+	publish_curve();
+}
+
+//call from the main loop with the time in ms
+void FanUpdate(unsigned long now)
+{
+	static unsigned long last_time=0;
+	int temperature,t;
+	unsigned int duty,host;
+	int i,source;
+
+	handle_command();
+
+	if(now-last_time<FanControlPeriod)
+		return;
+	last_time=now;
+
+	//the hottest sensor that could be read
+	source=FanSourceFailsafe;
+	temperature=0;
+	if(REG_MOTOR_TEMP_STATUS.left && (source==FanSourceFailsafe || REG_MOTOR_TEMP.left*10>temperature))
+	{
+		temperature=REG_MOTOR_TEMP.left*10;
+		source=FanSourceMotorTemp;
+	}
+	if(REG_MOTOR_TEMP_STATUS.right && (source==FanSourceFailsafe || REG_MOTOR_TEMP.right*10>temperature))
+	{
+		temperature=REG_MOTOR_TEMP.right*10;
+		source=FanSourceMotorTemp;
+	}
+	if(REG_MOTOR_TEMP_STATUS.board && (source==FanSourceFailsafe || REG_MOTOR_TEMP.board*10>temperature))
+	{
+		temperature=REG_MOTOR_TEMP.board*10;
+		source=FanSourceBoardTemp;
+	}
+
+	if(source==FanSourceFailsafe)
+	{
+		duty=FAN_MAX_DUTY;
+	}
+	else
+	{
+		for(i=LMotor;i<=Flipper;i++)
+		{
+			t=THERM_Temperature(i)-FanWindingOffset;
+			if(t>temperature)
+			{
+				temperature=t;
+				source=FanSourceMotorLoad;
+			}
+		}
+		duty=FAN_Duty(temperature);
+	}
+
+	host=REG_MOTOR_SIDE_FAN_SPEED;
+	#ifdef XbeeTest
+		if(Xbee_SIDE_FAN_SPEED>host)
+			host=Xbee_SIDE_FAN_SPEED;
+	#endif
+	if(host>duty)
+	{
+		duty=host;
+		source=FanSourceHost;
+	}
+	if(duty>FAN_MAX_DUTY)
+		duty=FAN_MAX_DUTY;
+
+	I2CFanDuty(duty);
+	REG_FAN_CONTROL.duty=duty;
+	REG_FAN_CONTROL.temperature=temperature;
+	REG_FAN_CONTROL.source=source;
+}
+
+static void handle_command(void)
+{
+	fan_curve_t curve;
+	int result;
+
+	if(REG_FAN_CURVE_COMMAND.command==0)
+		return;
+
+	result=FanCurveStatusOK;
+	switch(REG_FAN_CURVE_COMMAND.command)
+	{
+		case FanCurveCommandApply:
+		case FanCurveCommandSave:
+			if(!curve_from_command(&curve))
+			{
+				result=FanCurveStatusBadCurve;
+				break;
+			}
+			FAN_SetCurve(&curve);
+			if(REG_FAN_CURVE_COMMAND.command==FanCurveCommandSave)
+				save_curve(&curve);
+		break;
+		case FanCurveCommandDefaults:
+			FAN_SetCurve(&FanCurveDefault);
+		break;
+		default:
+			result=FanCurveStatusBadCommand;
+		break;
+	}
+	REG_FAN_CURVE_COMMAND.command=0;
+	REG_FAN_CURVE_STATUS=result;
+	publish_curve();
+}
+
+static int curve_from_command(fan_curve_t *curve)
+{
+	int i;
+
+	for(i=0;i<FAN_CURVE_POINTS;i++)
+	{
+		if(REG_FAN_CURVE_COMMAND.duty[i]>FAN_MAX_DUTY)
+			return False;
+		curve->temperature[i]=REG_FAN_CURVE_COMMAND.temperature[i];
+		curve->duty[i]=REG_FAN_CURVE_COMMAND.duty[i];
+	}
+	curve->hysteresis=REG_FAN_CURVE_COMMAND.hysteresis;
+	return FAN_CheckCurve(curve);
+}
+
+//ConfigUpdate() stores it once the settings stop changing
+static void save_curve(const fan_curve_t *curve)
+{
+	int i;
+
+	Config.fan_curve_valid=True;
+	for(i=0;i<FAN_CURVE_POINTS;i++)
+	{
+		Config.fan_temperature[i]=curve->temperature[i];
+		Config.fan_duty[i]=curve->duty[i];
+	}
+	Config.fan_hysteresis=curve->hysteresis;
+	ConfigChanged();
+}
+
+static void publish_curve(void)
+{
+	fan_curve_t curve;
+	int i;
+
+	FAN_GetCurve(&curve);
+	for(i=0;i<FAN_CURVE_POINTS;i++)
+	{
+		REG_FAN_CURVE.temperature[i]=curve.temperature[i];
+		REG_FAN_CURVE.duty[i]=curve.duty[i];
+	}
+	REG_FAN_CURVE.hysteresis=curve.hysteresis;
+}
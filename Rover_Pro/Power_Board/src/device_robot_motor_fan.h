@@ -0,0 +1,40 @@
+//On-board fan control.  Every FanControlPeriod FanUpdate() takes the hottest of the
+//motor temperatures from the fan controller, the board temperature and the winding
+//temperatures the motor thermal models estimate from the motor current (less
+//FanWindingOffset, so the fans ramp up under load before the case sensors warm up),
+//looks the duty up in the fan curve (closed_loop_control/FanCurve.h) and writes it
+//to both fans.  The host fan speed, REG_MOTOR_SIDE_FAN_SPEED, is a minimum the duty
+//won't go below.  If neither temperature sensor can be read the fans run at
+//FAN_MAX_DUTY.  The curve is set through REG_FAN_CURVE_COMMAND and can be stored in
+//the config store; the duty and what drove it are published in REG_FAN_CONTROL.
+
+#define FanControlPeriod 250 //ms
+#define FanWindingOffset 200 //0.1C
+#define FanCurveDEEAddress 40 //where it was stored before the config store, migrated by ConfigIni()
+#define FanCurveDEEMarker 0xFA4C
+
+//the curve the fans had in the controller's automatic mode: half duty at
+//FAN_START_TEMP, full duty 10C above
+#define FanCurveDefaultTemperatures {350,400,450,500} //0.1C
+#define FanCurveDefaultDuties {60,120,180,240}
+#define FanCurveDefaultHysteresis 30 //0.1C
+
+//REG_FAN_CURVE_COMMAND.command
+#define FanCurveCommandApply 1 //use the curve in the command (not stored)
+#define FanCurveCommandSave 2 //use the curve in the command and store it
+#define FanCurveCommandDefaults 3 //back to the default curve (not stored)
+
+//REG_FAN_CURVE_STATUS
+#define FanCurveStatusOK 1
+#define FanCurveStatusBadCommand 2
+#define FanCurveStatusBadCurve 3 //temperatures not ascending, a duty above FAN_MAX_DUTY or a negative hysteresis
+
+//REG_FAN_CONTROL.source
+#define FanSourceMotorTemp 0
+#define FanSourceBoardTemp 1
+#define FanSourceMotorLoad 2
+#define FanSourceHost 3
+#define FanSourceFailsafe 4
+
+void FanIni(void);
+void FanUpdate(unsigned long now);
@@ -1,789 +1,321 @@
-#include "p24FJ256GB106.h"
-#include "stdhdr.h"
-#include "device_robot_motor.h"
-#include "debug_uart.h"
-#include "device_robot_motor_i2c.h"
-
-int CheckI2C2Idle();
-int CheckI2C3Idle();
-
-int I2C2XmitReset = 0;
-int I2C3XmitReset = 0;
-
-int I2C2TimerExpired = 0;
-int I2C3TimerExpired = 0;
-
-//fan controller, TMP112, battery, EEPROM
-void I2C2Update(void)
-{
-
- 	static int StepNumber=1; 
-	static unsigned char a,b;
- 	//static int TMPHigh,TMPLow;
-
- 	if(I2C2XmitReset==True)
- 	{
- 		I2C2XmitReset=False;//clear the flag
- 		StepNumber=1;//go to step 1, start from the beginning
- 		//assume all the data is good
- 		REG_MOTOR_TEMP_STATUS.left=1;
- 		REG_MOTOR_TEMP_STATUS.right=1;
- 		REG_MOTOR_TEMP_STATUS.board=1;
-
- 	}
- 	switch(StepNumber)
- 	{
- 	 	case 1://make sure the module is idle
-		  	StepNumber = 8; //skip manual fan write control
-			break;
-			/*
- 			if(CheckI2C2Idle()==True)
- 			{
- 				StepNumber++;//run second step
- 				I2C2CONbits.SEN=1;	// initiate Start on SDA and SCL pins
- 			}
- 		 	break;
- 		case 2://wait until start is complete, then transmit data
- 			if(I2C2CONbits.SEN==0)
- 			{
- 				StepNumber++;//run next step
- 				I2C2TRN=FANCtrlAddressW;//transmit data
- 			}
- 			break;
- 		case 3://wait for transmit to complete
- 			if(I2C2STATbits.IWCOL==1)//write collision occurs, go to the first step
- 			{
-				I2C2STATbits.IWCOL=0;
- 			 	REG_MOTOR_TEMP_STATUS.left=0;
- 			}
- 			if(I2C2STATbits.TRSTAT==0)// wait for the transmitting to complete
- 			{
- 				StepNumber++;
- 			}
- 			break;
- 		case 4://make sure the module is idle
- 			if(CheckI2C2Idle()==True)//make sure the module is idle
- 			{
- 				StepNumber++;//run next step
- 			}
- 			break;
- 		case 5://check ACK from slave
- 			if(I2C2STATbits.ACKSTAT==1)//if no ACK, tell the data is bad
- 			{
- 				REG_MOTOR_TEMP_STATUS.left=0;
- 			}
- 			StepNumber++;
- 			break;
- 		case 6://send data
- 			I2C2TRN=0x00;//transmit data
- 			StepNumber++;
- 			break;
- 		case 7://wait for transmit to complete
- 			if(I2C2STATbits.IWCOL==1)//write collision occurs, go to the first step
- 			{
- 			 	REG_MOTOR_TEMP_STATUS.left=0;
- 			}
- 			if(I2C2STATbits.TRSTAT==0)// wait for the transmitting to complete
- 			{
- 				StepNumber++;
- 			}
- 			break;*/
- 		case 8://make sure the module is idle
- 			if(CheckI2C2Idle()==True)//make sure the module is idle
- 			{
- 				StepNumber++;//run next step
- 				I2C2CONbits.SEN=1;	// initiate Start on SDA and SCL pins
- 			}
- 			break;
- 		case 9:
- 			if(I2C2CONbits.SEN==0)
- 			{
- 				StepNumber++;//run next step
- 				I2C2TRN=FANCtrlAddressR;//transmit data
- 			}
- 			break;
- 		case 10:
- 			if(CheckI2C2Idle()==True)
- 			{
- 				StepNumber++;//run second step
- 				I2C2CONbits.RCEN=1;//enable receive model
- 			}
- 			break;
- 		case 11://wait until receive is completed
- 			if(I2C2CONbits.RCEN==0)
- 			{
- 				StepNumber++;
- 				I2C2STATbits.I2COV = 0;
- 				REG_MOTOR_TEMP.left=I2C2RCV;
- 			}
- 			break;
- 		case 12://stop the module
-
- 			I2C2CONbits.PEN=1;	// initiate Stop on SDA and SCL pins
- 			//StepNumber++;  //skip manual fan control
- 			break;
- 	 	case 13://make sure the module is idle
-		  	StepNumber = 20; //skip manual fan control
-			break;
-			/*
- 			if(CheckI2C2Idle()==True)
- 			{
- 				StepNumber++;//run second step
- 				I2C2CONbits.SEN=1;	// initiate Start on SDA and SCL pins
- 			}
- 		 	break;
- 		case 14://wait until start is complete, then transmit data
- 			if(I2C2CONbits.SEN==0)
- 			{
- 				StepNumber++;//run next step
- 				I2C2TRN=FANCtrlAddressW;//transmit data
- 			}
- 			break;
- 		case 15://wait for transmit to complete
- 			if(I2C2STATbits.IWCOL==1)//write collision occurs, go to the first step
- 			{
- 			 	REG_MOTOR_TEMP_STATUS.right=0;
- 			}
- 			if(I2C2STATbits.TRSTAT==0)// wait for the transmitting to complete
- 			{
- 				StepNumber++;
- 			}
- 			break;
- 		case 16://make sure the module is idle
- 			if(CheckI2C2Idle()==True)//make sure the module is idle
- 			{
- 				StepNumber++;//run next step
- 			}
- 			break;
- 		case 17://check ACK from slave
- 			if(I2C2STATbits.ACKSTAT==1)//if no ACK, tell the data is bad
- 			{
- 				REG_MOTOR_TEMP_STATUS.right=0;
- 			}
- 			StepNumber++;
- 			break;
- 		case 18://send data
- 			I2C2TRN=0x01;//transmit register address data
- 			StepNumber++;
- 			break;
- 		case 19://wait for transmit to complete
- 			if(I2C2STATbits.IWCOL==1)//write collision occurs, go to the first step
- 			{
- 			 	REG_MOTOR_TEMP_STATUS.right=0;
- 			}
- 			if(I2C2STATbits.TRSTAT==0)// wait for the transmitting to complete
- 			{
- 				StepNumber++;
- 			}
- 			break;*/
- 		case 20://make sure the module is idle
- 			if(CheckI2C2Idle()==True)//make sure the module is idle
- 			{
- 				StepNumber++;//run next step
- 				I2C2CONbits.SEN=1;	// initiate Start on SDA and SCL pins
- 			}
- 			break;
- 		case 21:
- 			if(I2C2CONbits.SEN==0)
- 			{
- 				StepNumber++;//run next step
- 				I2C2TRN=FANCtrlAddressR;//transmit data
- 			}
- 			break;
- 		case 22:
- 			if(CheckI2C2Idle()==True)
- 			{
- 				StepNumber++;//run second step
- 				I2C2CONbits.RCEN=1;//enable receive model
- 			}
- 			break;
- 		case 23://wait until receive is completed
- 			if(I2C2CONbits.RCEN==0)
- 			{
- 				StepNumber++;
- 				I2C2STATbits.I2COV = 0;
- 				REG_MOTOR_TEMP.right=I2C2RCV;
- 			}
- 			break;
- 		case 24://stop the module
- 			I2C2CONbits.PEN=1;	// initiate Stop on SDA and SCL pins
- 			StepNumber++;
- 			break;
-	 	case 25://make sure the module is idle
- 			if(CheckI2C2Idle()==True)
- 			{
- 				StepNumber++;//run second step
- 				I2C2CONbits.SEN=1;	// initiate Start on SDA and SCL pins
- 			}
- 		 	break;
- 		case 26://wait until start is complete, then transmit data
- 			if(I2C2CONbits.SEN==0)
- 			{
- 				StepNumber++;//run next step
- 				I2C2TRN=BATTERY_ADDRESS<<1;//transmit data
- 			}
- 			break;
- 		case 27://wait for transmit to complete
- 			if(I2C2STATbits.IWCOL==1)//write collision occurs, go to the first step
- 			{
- 			 	//REG_MOTOR_TEMP_STATUS.left=0;
-				I2C2STATbits.IWCOL = 0;
-				//StepNumber = 0;
-				//StepNumber++;
- 			}
- 			if(I2C2STATbits.TRSTAT==0)// wait for the transmitting to complete
- 			{
- 				StepNumber++;
- 			}
- 			break;
- 		case 28://make sure the module is idle
- 			if(CheckI2C2Idle()==True)//make sure the module is idle
- 			{
- 				StepNumber++;//run next step
- 			}
- 			break;
- 		case 29://check ACK from slave
- 			if(I2C2STATbits.ACKSTAT==1)//if no ACK, tell the data is bad
- 			{
- 				//REG_MOTOR_TEMP_STATUS.left=0;
- 			}
- 			StepNumber++;
- 			break;
- 		case 30://send data
- 			I2C2TRN=0x0d;//transmit data
- 			StepNumber++;
- 			break;
- 		case 31://wait for transmit to complete
- 			if(I2C2STATbits.IWCOL==1)//write collision occurs, go to the first step
- 			{
-				I2C2STATbits.IWCOL = 0;
- 			 	//REG_MOTOR_TEMP_STATUS.left==0;
-				//StepNumber++;
- 			}
- 			if(I2C2STATbits.TRSTAT==0)// wait for the transmitting to complete
- 			{
- 				StepNumber++;
- 			}
- 			break;
- 		case 32://make sure the module is idle
- 			if(CheckI2C2Idle()==True)//make sure the module is idle
- 			{
- 				StepNumber++;//run next step
- 				I2C2CONbits.SEN=1;	// initiate Start on SDA and SCL pins
- 			}
- 			break;
- 		case 33:
- 			if(I2C2CONbits.SEN==0)
- 			{
- 				StepNumber++;//run next step
- 				I2C2TRN=(BATTERY_ADDRESS<<1)+1;//transmit data
- 			}
- 			break;
- 		case 34:
- 			if(CheckI2C2Idle()==True)
- 			{
- 				StepNumber++;//run second step
- 				I2C2CONbits.RCEN=1;//enable receive model
- 			}
- 			break;
- 		case 35://wait until receive is completed
- 			if(I2C2CONbits.RCEN==0)
- 			{
- 				StepNumber++;
- 				I2C2STATbits.I2COV = 0;
- 				a=I2C2RCV;
-				I2C2CONbits.ACKDT = 0; //ACK
-				I2C2CONbits.ACKEN = 1;
- 			}
- 			break;
-		case 36:
-		 	if(CheckI2C2Idle()==True)
- 			{
- 				StepNumber++;//run second step
- 				I2C2CONbits.RCEN=1;//enable receive model
- 			}
-		break;
-		case 37:
-		 	if(I2C2CONbits.RCEN==0)
- 			{
- 				StepNumber++;
- 				I2C2STATbits.I2COV = 0;
- 				b=I2C2RCV;
-				REG_ROBOT_REL_SOC_A = a  + (b<<8);
-				I2C2CONbits.ACKDT = 1; //NACK
-				I2C2CONbits.ACKEN = 1;
- 			}
-		break;		
- 		case 38://stop the module
-			I2C2CONbits.ACKDT = 0; //ACK
- 			I2C2CONbits.PEN=1;	// initiate Stop on SDA and SCL pins
- 			StepNumber++;
- 			break;
- 		case 39://Make sure the module is idle
-
- 			if(CheckI2C2Idle()==True)
- 			{
- 				StepNumber++;//run second step
- 				//StepNumber=1;//cycle ends, go to the first step
- 				//I2C2TimerExpired=False;//reset the I2C2 update timer
- 			}
-			//skip manual fan control
-			StepNumber = 1;
- 			break;
-		/*
-		case 40://make sure the module is idle
-			if(CheckI2C2Idle()==True)
-			{
-				StepNumber++;//run second step
-				I2C2CONbits.SEN=1;	// initiate Start on SDA and SCL pins
-			}
-			break;
-		case 41://wait until start is complete, then transmit data
-			if(I2C2CONbits.SEN==0)
-			{
-				StepNumber++;//run next step
-				I2C2TRN=FANCtrlAddressW;//transmit data
-			}
-			break;
-		case 42://wait for transmit to complete
-			if(I2C2STATbits.IWCOL==1)//write collision occurs, go to the first step
-			{
-			 	//REG_MOTOR_TEMP_STATUS.right=0;
-			}
-			if(I2C2STATbits.TRSTAT==0)// wait for the transmitting to complete
-			{
-				StepNumber++;
-			}
-			break;
-		case 43://make sure the module is idle
-			if(CheckI2C2Idle()==True)//make sure the module is idle
-			{
-				StepNumber++;//run next step
-			}
-			break;
-		case 44://check ACK from slave
-			if(I2C2STATbits.ACKSTAT==1)//if no ACK, tell the data is bad
-			{
-				//REG_MOTOR_TEMP_STATUS.right=0;
-			}
-			StepNumber++;
-			break;
-		case 45://wait until start is complete, then transmit data
-			if(I2C2CONbits.SEN==0)
-			{
-				StepNumber++;//run next step
-				I2C2TRN=0x0b;//transmit data
-			}
-			break;
-		case 46://wait for transmit to complete
-			if(I2C2STATbits.IWCOL==1)//write collision occurs, go to the first step
-			{
-			 	//REG_MOTOR_TEMP_STATUS.right=0;
-			}
-			if(I2C2STATbits.TRSTAT==0)// wait for the transmitting to complete
-			{
-				StepNumber++;
-			}
-			break;
-		case 47://make sure the module is idle
-			if(CheckI2C2Idle()==True)//make sure the module is idle
-			{
-				StepNumber++;//run next step
-			}
-			break;
-		case 48://check ACK from slave
-			if(I2C2STATbits.ACKSTAT==1)//if no ACK, tell the data is bad
-			{
-				//REG_MOTOR_TEMP_STATUS.right=0;
-			}
-			StepNumber++;
-			break;
-		case 49://send data
-//			I2C2TRN=REG_MOTOR_SIDE_FAN_SPEED;//transmit register address data
-//			I2C2TRN=240;//transmit register address data
-			// if there is a command
-			if(Xbee_SIDE_FAN_NEW!=0)
-			{
-				I2C2TRN=Xbee_SIDE_FAN_SPEED;
-			} else
-			{
-				// as long as the motor speed is not 0, turn side fan on full speed
-				if((abs(Xbee_MOTOR_VELOCITY[0])+abs(Xbee_MOTOR_VELOCITY[1]))>10)
-				{
-					Xbee_SIDE_FAN_SPEED=240;
-					I2C2TRN=Xbee_SIDE_FAN_SPEED;
-				} else
-				{
-					Xbee_SIDE_FAN_SPEED=0;
-					I2C2TRN=Xbee_SIDE_FAN_SPEED;
-				}
-			}
-			StepNumber++;
-			break;
-		case 50://wait for transmit to complete
-			if(I2C2STATbits.IWCOL==1)//write collision occurs, go to the first step
-			{
-			 	//REG_MOTOR_TEMP_STATUS.right=0;
-			}
-			if(I2C2STATbits.TRSTAT==0)// wait for the transmitting to complete
-			{
-				StepNumber++;
-			}
-			break;
-		case 51://make sure the module is idle
-			if(CheckI2C2Idle()==True)//make sure the module is idle
-			{
-				StepNumber++;//run next step
-				I2C2CONbits.PEN=1;	// initiate Stop on SDA and SCL pins
-			}
-		case 52://check ACK from slave
- 			if(CheckI2C2Idle()==True)
- 			{
- 				StepNumber++;//move to nonexistant step
- 				//StepNumber=1;//cycle ends, go to the first step
- 				I2C2TimerExpired=False;//reset the I2C2 update timer
-
- 			}
-			break;
-		*/
-
- 	}
-
-}
-
-
-
-void I2C3Update(void)
-{
-
- 	static int StepNumber=1; 
-	static unsigned int a,b;
- 	//static int TMPHigh,TMPLow;
-
- 	if(I2C3XmitReset==True)
- 	{
- 		I2C3XmitReset=False;//clear the flag
- 		StepNumber=1;//go to step 1, start from the beginning
- 		//assume all the data is good
-
- 	}
- 	switch(StepNumber)
- 	{
-	 	case 1://make sure the module is idle
- 			if(CheckI2C3Idle()==True)
- 			{
- 				StepNumber++;//run second step
- 				I2C3CONbits.SEN=1;	// initiate Start on SDA and SCL pins
- 			}
- 		 	break;
- 		case 2://wait until start is complete, then transmit data
- 			if(I2C3CONbits.SEN==0)
- 			{
- 				StepNumber++;//run next step
- 				I2C3TRN=BATTERY_ADDRESS<<1;//transmit data
- 			}
- 			break;
- 		case 3://wait for transmit to complete
- 			if(I2C3STATbits.IWCOL==1)//write collision occurs, go to the first step
- 			{
-				I2C3STATbits.IWCOL = 0;
- 			 	//REG_MOTOR_TEMP_STATUS.left=0;
-				//StepNumber = 0;
- 			}
- 			if(I2C3STATbits.TRSTAT==0)// wait for the transmitting to complete
- 			{
- 				StepNumber++;
- 			}
- 			break;
- 		case 4://make sure the module is idle
- 			if(CheckI2C3Idle()==True)//make sure the module is idle
- 			{
- 				StepNumber++;//run next step
- 			}
- 			break;
- 		case 5://check ACK from slave
- 			if(I2C3STATbits.ACKSTAT==1)//if no ACK, tell the data is bad
- 			{
- 				//REG_MOTOR_TEMP_STATUS.left=0;
- 			}
- 			StepNumber++;
- 			break;
- 		case 6://send data
- 			I2C3TRN=0x0d;//transmit data
- 			StepNumber++;
- 			break;
- 		case 7://wait for transmit to complete
- 			if(I2C3STATbits.IWCOL==1)//write collision occurs, go to the first step
- 			{
-				I2C3STATbits.IWCOL = 0;
-				//StepNumber = 0;
- 			 	//REG_MOTOR_TEMP_STATUS.left==0;
- 			}
- 			if(I2C3STATbits.TRSTAT==0)// wait for the transmitting to complete
- 			{
- 				StepNumber++;
- 			}
- 			break;
- 		case 8://make sure the module is idle
- 			if(CheckI2C3Idle()==True)//make sure the module is idle
- 			{
- 				StepNumber++;//run next step
- 				I2C3CONbits.SEN=1;	// initiate Start on SDA and SCL pins
- 			}
- 			break;
-		case 9:
-			 if(I2C3CONbits.SEN==0)
- 			{
- 				StepNumber++;//run next step
- 				I2C3TRN=(BATTERY_ADDRESS<<1)+1;//transmit data
- 			}
- 			break;
- 		case 10:
- 			if(CheckI2C3Idle()==True)
- 			{
- 				StepNumber++;//run second step
- 				I2C3CONbits.RCEN=1;//enable receive model
- 			}
- 			break;
- 		case 11://wait until receive is completed
- 			if(I2C3CONbits.RCEN==0)
- 			{
- 				StepNumber++;
- 				I2C3STATbits.I2COV = 0;
- 				a=I2C3RCV;
-				I2C3CONbits.ACKDT = 0; //ACK
-				I2C3CONbits.ACKEN = 1;
- 			}
- 			break;
-		case 12:
-		 	if(CheckI2C3Idle()==True)
- 			{
- 				StepNumber++;//run second step
- 				I2C3CONbits.RCEN=1;//enable receive model
- 			}
-		break;
-		case 13:
-		 	if(I2C3CONbits.RCEN==0)
- 			{
- 				StepNumber++;
- 				I2C3STATbits.I2COV = 0;
- 				b=I2C3RCV;
-				REG_ROBOT_REL_SOC_B = a  + (b<<8);
-				I2C3CONbits.ACKDT = 1; //NACK
-				I2C3CONbits.ACKEN = 1;
- 			}
-		break;		
- 		case 14://stop the module
-		 	if(CheckI2C3Idle()==True)
- 			{
-	 			I2C3CONbits.PEN=1;	// initiate Stop on SDA and SCL pins
-	 			StepNumber++;
-			}
- 			break;
-		case 15:
- 			if(CheckI2C3Idle()==True)
- 			{
- 				StepNumber++;//run second step
- 				//StepNumber=1;//cycle ends, go to the first step
-
- 			}
-		break;
-	 	case 16://make sure the module is idle
- 			if(CheckI2C3Idle()==True)
- 			{
- 				StepNumber++;//run second step
- 				I2C3CONbits.SEN=1;	// initiate Start on SDA and SCL pins
- 			}
- 		 	break;
- 		case 17://wait until start is complete, then transmit data
- 			if(I2C3CONbits.SEN==0)
- 			{
- 				StepNumber++;//run next step
- 				I2C3TRN=BATTERY_CHARGER_ADDRESS<<1;//transmit data
- 			}
- 			break;
- 		case 18://wait for transmit to complete
- 			if(I2C3STATbits.IWCOL==1)//write collision occurs, go to the first step
- 			{
-				I2C3STATbits.IWCOL = 0;
- 			 	//REG_MOTOR_TEMP_STATUS.left=0;
-				//StepNumber = 0;
- 			}
- 			if(I2C3STATbits.TRSTAT==0)// wait for the transmitting to complete
- 			{
- 				StepNumber++;
- 			}
- 			break;
- 		case 19://make sure the module is idle
- 			if(CheckI2C3Idle()==True)//make sure the module is idle
- 			{
- 				StepNumber++;//run next step
- 			}
- 			break;
- 		case 20://check ACK from slave
- 			if(I2C3STATbits.ACKSTAT==1)//if no ACK, tell the data is bad
- 			{
- 				//REG_MOTOR_TEMP_STATUS.left=0;
- 			}
- 			StepNumber++;
- 			break;
- 		case 21://send data
- 			I2C3TRN=0xca;//transmit data
- 			StepNumber++;
- 			break;
- 		case 22://wait for transmit to complete
- 			if(I2C3STATbits.IWCOL==1)//write collision occurs, go to the first step
- 			{
-				I2C3STATbits.IWCOL = 0;
-				//StepNumber = 0;
- 			 	//REG_MOTOR_TEMP_STATUS.left==0;
- 			}
- 			if(I2C3STATbits.TRSTAT==0)// wait for the transmitting to complete
- 			{
- 				StepNumber++;
- 			}
- 			break;
- 		case 23://make sure the module is idle
- 			if(CheckI2C3Idle()==True)//make sure the module is idle
- 			{
- 				StepNumber++;//run next step
- 				I2C3CONbits.SEN=1;	// initiate Start on SDA and SCL pins
- 			}
- 			break;
-		case 24:
-			 if(I2C3CONbits.SEN==0)
- 			{
- 				StepNumber++;//run next step
- 				I2C3TRN=(BATTERY_CHARGER_ADDRESS<<1)+1;//transmit data
- 			}
- 			break;
- 		case 25:
- 			if(CheckI2C3Idle()==True)
- 			{
- 				StepNumber++;//run second step
- 				I2C3CONbits.RCEN=1;//enable receive model
- 			}
- 			break;
- 		case 26://wait until receive is completed
- 			if(I2C3CONbits.RCEN==0)
- 			{
- 				StepNumber++;
- 				I2C3STATbits.I2COV = 0;
- 				a=I2C3RCV;
-				I2C3CONbits.ACKDT = 0; //ACK
-				I2C3CONbits.ACKEN = 1;
- 			}
- 			break;
-		case 27:
-		 	if(CheckI2C3Idle()==True)
- 			{
- 				StepNumber++;//run second step
- 				I2C3CONbits.RCEN=1;//enable receive model
- 			}
-		break;
-		case 28:
-		 	if(I2C3CONbits.RCEN==0)
- 			{
- 				StepNumber++;
- 				I2C3STATbits.I2COV = 0;
- 				b=I2C3RCV;
-				REG_MOTOR_CHARGER_STATE = a  + (b<<8);
-        		//REG_MOTOR_CHARGER_STATE = b;
-				I2C3CONbits.ACKDT = 1; //NACK
-				I2C3CONbits.ACKEN = 1;
- 			}
-		break;		
- 		case 29://stop the module
-		 	if(CheckI2C3Idle()==True)
- 			{
-	 			I2C3CONbits.PEN=1;	// initiate Stop on SDA and SCL pins
-	 			StepNumber++;
-			}
- 			break;
-		case 30:
- 			if(CheckI2C3Idle()==True)
- 			{
- 				StepNumber++;//run second step
- 				//StepNumber=1;//cycle ends, go to the first step
- 				I2C3TimerExpired=False;//reset the I2C2 update timer
- 			}
-		break;
-    default:
-      StepNumber = 1;
-    break;
-
-	} 
-
-}
-
-//*********************************************//
-//I2C library
-int CheckI2C2Idle()
-{
-
- 	if(I2C2CONbits.SEN||I2C2CONbits.PEN||I2C2CONbits.RCEN||I2C2CONbits.ACKEN||I2C2STATbits.TRSTAT)
- 	{
- 		return False;
- 	}else
- 	{
- 		return True;
- 	}
-}
-
-int CheckI2C3Idle()
-{
-
- 	if(I2C3CONbits.SEN||I2C3CONbits.PEN||I2C3CONbits.RCEN||I2C3CONbits.ACKEN||I2C3STATbits.TRSTAT)
- 	{
- 		return False;
- 	}else
- 	{
- 		return True;
- 	}
-}
-
-void re_init_i2c2(void)
-{
-
-
-  I2C2CON = 0;
-  I2C2STAT = 0;
-
-// New Bren-Tronics battery (or existing device interacting with the new
-// battery ties up the SMBus line (usually
-// seen after the robot is driven for a short time.  The only
-// way I've been able to recover from this is by either removing
-// the SMBus cable between the battery board and the power board,
-// or by changing the i2c pins to outputs when the i2c module is
-// disabled.
-  _TRISF4 = 0;
-  _TRISF5 = 0;
-  _LATF4 = 0;
-  _LATF5 = 0;
-
-	//FCY should be 16M
-	//I2C2BRG = FCY/100000-FCY/10000000-1;	//should be 157.4 (between 9D and 9E)
-	I2C2BRG = 0xff;
-  I2C2CONbits.I2CEN = 1;
-
-
-}
-
-void re_init_i2c3(void)
-{
-
-
-  I2C3CON = 0;
-  I2C3STAT = 0;
- 
-  _TRISE6 = 0;
-  _TRISE7 = 0;
-  _LATE6 = 0;
-  _LATE7 = 0;
-
-	//FCY should be 16M
-	//I2C2BRG = FCY/100000-FCY/10000000-1;	//should be 157.4 (between 9D and 9E)
-	I2C3BRG = 0xff;
-  I2C3CONbits.I2CEN = 1;
- 
-}
+#include "p24FJ256GB106.h"
+#include "stdhdr.h"
+#include "device_robot_motor.h"
+#include "debug_uart.h"
+#include "device_robot_motor_poll.h"
+#include "device_robot_motor_i2c.h"
+
+//counts the state of charge readings of each battery, so the gauges can tell a fresh one
+unsigned int BatterySOCReadings[2] = {0,0};
+
+static void fan_temperature_done(I2C_TRANSACTION *t);
+static void board_temperature_done(I2C_TRANSACTION *t);
+static void charger_state_done(I2C_TRANSACTION *t);
+static void fan_setup(unsigned long now);
+
+//receive buffers
+static unsigned char FanTempLeftData[1];
+static unsigned char FanTempRightData[1];
+static unsigned char BoardTempData[2];
+static unsigned char ChargerStateData[2];
+
+//I2C2: fan controller, TMP112 (the battery is read by device_robot_motor_smbus.c)
+static I2C_TRANSACTION FanTempLeft = {FAN_CONTROLLER_ADDRESS, FANCtrlTemp1Reg, I2C_READ, I2C_PRIORITY_NORMAL,
+	FanTempLeftData, 1, 0, fan_temperature_done};
+static I2C_TRANSACTION FanTempRight = {FAN_CONTROLLER_ADDRESS, FANCtrlTemp2Reg, I2C_READ, I2C_PRIORITY_NORMAL,
+	FanTempRightData, 1, 0, fan_temperature_done};
+static I2C_TRANSACTION BoardTemp = {TMP_SENSOR_ADDRESS, TMPSensorTempReg, I2C_READ, I2C_PRIORITY_LOW,
+	BoardTempData, 2, 0, board_temperature_done};
+
+//fan duty in manual mode, the same for both fans
+static unsigned char FanDutyData[1];
+static I2C_TRANSACTION FanDuty1 = {FAN_CONTROLLER_ADDRESS, FANCtrlDuty1Reg, 0, I2C_PRIORITY_HIGH,
+	FanDutyData, 1, 0, 0};
+static I2C_TRANSACTION FanDuty2 = {FAN_CONTROLLER_ADDRESS, FANCtrlDuty2Reg, 0, I2C_PRIORITY_HIGH,
+	FanDutyData, 1, 0, 0};
+
+//fan controller setup, the same as FANCtrlIni() without the spin at boot
+static unsigned char FanResetData[1] = {FANCtrlReset};
+static unsigned char FanZeroData[1] = {0};
+static I2C_TRANSACTION FanReset = {FAN_CONTROLLER_ADDRESS, FANCtrlConfigReg, 0, I2C_PRIORITY_HIGH,
+	FanResetData, 1, 0, 0};
+static I2C_TRANSACTION FanManual = {FAN_CONTROLLER_ADDRESS, FANCtrlModeReg, 0, I2C_PRIORITY_HIGH,
+	FanZeroData, 1, 0, 0};
+static I2C_TRANSACTION FanRate = {FAN_CONTROLLER_ADDRESS, FANCtrlRateReg, 0, I2C_PRIORITY_HIGH,
+	FanZeroData, 1, 0, 0};
+
+#define FanSetupIdle 0
+#define FanSetupReset 1
+#define FanSetupResetting 2
+#define FanSetupManual 3
+#define FanSetupManualWait 4
+#define FanSetupResetDelay 20 //ms, as FANCtrlIni()
+static int FanSetupStep = FanSetupIdle;
+static unsigned long FanSetupTime;
+
+//I2C3: charger
+static I2C_TRANSACTION ChargerState = {BATTERY_CHARGER_ADDRESS, CHARGER_STATE_COMMAND, I2C_READ, I2C_PRIORITY_NORMAL,
+	ChargerStateData, 2, 0, charger_state_done};
+
+typedef struct
+{
+	unsigned char bus;
+	I2C_TRANSACTION *t;
+	const PollPolicy *policy;
+	volatile int16_t *value;//decoded into by the completion callback
+	PollState poll;
+} I2CSensor;
+
+static const PollPolicy FanTempPolicy = {FanTempFastPeriod, FanTempPeriod, FanTempSlowPeriod,
+	FanTempChange, PollNoLow, FanTempNear};
+static const PollPolicy BoardTempPolicy = {BoardTempFastPeriod, BoardTempPeriod, BoardTempSlowPeriod,
+	BoardTempChange, PollNoLow, BoardTempNear};
+//any change of state
+static const PollPolicy ChargerStatePolicy = {ChargerStateFastPeriod, ChargerStatePeriod, ChargerStateSlowPeriod,
+	1, PollNoLow, PollNoHigh};
+
+//in the order of REG_I2C_POLL_INTERVAL
+static I2CSensor I2CSensors[] =
+{
+	{2, &FanTempLeft, &FanTempPolicy, &REG_MOTOR_TEMP.left},
+	{2, &FanTempRight, &FanTempPolicy, &REG_MOTOR_TEMP.right},
+	{2, &BoardTemp, &BoardTempPolicy, &REG_MOTOR_TEMP.board},
+	{3, &ChargerState, &ChargerStatePolicy, (volatile int16_t *)&REG_MOTOR_CHARGER_STATE},
+};
+#define I2CSensorCount (int)(sizeof(I2CSensors)/sizeof(I2CSensors[0]))
+
+
+//hands I2C2 and I2C3 over to the interrupt driven transaction queues, call once the
+//blocking transfers at startup are done
+void I2CQueueIni(void)
+{
+	int i;
+
+	for(i=0; i<I2CSensorCount; i++)
+		PollIni(&I2CSensors[i].poll);
+
+	registerI2CResetCallback(recover_i2c2, 2);
+	registerI2CResetCallback(recover_i2c3, 3);
+	startI2CQueue(2);
+	startI2CQueue(3);
+}
+
+//call from the main loop with the time in ms.  A finished read reschedules its
+//sensor by its polling policy, and every sensor that has come due is queued; one
+//that is still queued or running isn't, so a slow device can't pile up the queue.
+void I2CUpdate(unsigned long now)
+{
+	uint16_t *interval = (uint16_t *)&REG_I2C_POLL_INTERVAL;
+	I2CSensor *s;
+	I2C_STATUS status;
+	int i;
+
+	for(i=0; i<I2CSensorCount; i++)
+	{
+		s = &I2CSensors[i];
+		status = s->t->status;
+		if(status == I2C_STATUS_QUEUED || status == I2C_STATUS_ACTIVE)
+			continue;
+
+		if(status == I2C_STATUS_DONE)
+			PollReading(&s->poll, s->policy, now, *s->value);
+		else if(status != I2C_STATUS_IDLE)
+			PollFailed(&s->poll, s->policy, now);
+		s->t->status = I2C_STATUS_IDLE;
+		interval[i] = s->poll.interval;
+
+		//a device the driver is backing off counts as a failed read
+		if(PollDue(&s->poll, now) && queueI2C(s->bus, s->t) != 0)
+			PollFailed(&s->poll, s->policy, now);
+	}
+
+	fan_setup(now);
+}
+
+//sets the duty of both fans, only writes it when it changed or the last write failed
+void I2CFanDuty(unsigned char duty)
+{
+	I2C_STATUS status1 = FanDuty1.status, status2 = FanDuty2.status;
+
+	//both share the data, which is copied when a write starts
+	if(status1 == I2C_STATUS_QUEUED || status1 == I2C_STATUS_ACTIVE ||
+	   status2 == I2C_STATUS_QUEUED || status2 == I2C_STATUS_ACTIVE)
+		return;
+	if(duty == FanDutyData[0] && status1 == I2C_STATUS_DONE && status2 == I2C_STATUS_DONE)
+		return;
+
+	FanDutyData[0] = duty;
+	queueI2C(2, &FanDuty1);
+	queueI2C(2, &FanDuty2);
+}
+
+//sets the fan controller up through the queue, for when it wasn't powered during
+//FANCtrlIni().  I2CUpdate() does the steps, and starts over until they succeed.
+void I2CFanIni(void)
+{
+	FanSetupStep = FanSetupReset;
+}
+
+static int busy(const I2C_TRANSACTION *t)
+{
+	return t->status == I2C_STATUS_QUEUED || t->status == I2C_STATUS_ACTIVE;
+}
+
+static void fan_setup(unsigned long now)
+{
+	switch(FanSetupStep)
+	{
+		case FanSetupReset:
+			if(queueI2C(2, &FanReset) == 0)
+				FanSetupStep = FanSetupResetting;
+		break;
+		case FanSetupResetting:
+			if(busy(&FanReset))
+				break;
+			FanSetupStep = (FanReset.status == I2C_STATUS_DONE) ? FanSetupManual : FanSetupReset;
+			FanSetupTime = now;
+		break;
+		case FanSetupManual:
+			if(now - FanSetupTime < FanSetupResetDelay || busy(&FanManual) || busy(&FanRate))
+				break;
+			if(queueI2C(2, &FanManual) != 0 || queueI2C(2, &FanRate) != 0)
+				FanSetupStep = FanSetupReset;
+			else
+				FanSetupStep = FanSetupManualWait;
+		break;
+		case FanSetupManualWait:
+			if(busy(&FanManual) || busy(&FanRate))
+				break;
+			if(FanManual.status != I2C_STATUS_DONE || FanRate.status != I2C_STATUS_DONE)
+			{
+				FanSetupStep = FanSetupReset;
+				break;
+			}
+			//the reset cleared the duty, have I2CFanDuty() write it again
+			FanDuty1.status = I2C_STATUS_IDLE;
+			FanSetupStep = FanSetupIdle;
+		break;
+	}
+}
+
+//*********************************************//
+//completion callbacks, called from the I2C interrupts
+
+static void fan_temperature_done(I2C_TRANSACTION *t)
+{
+	int good = (t->status == I2C_STATUS_DONE);
+
+	if(t == &FanTempLeft)
+	{
+		if(good) REG_MOTOR_TEMP.left = FanTempLeftData[0];
+		REG_MOTOR_TEMP_STATUS.left = good;
+	}
+	else
+	{
+		if(good) REG_MOTOR_TEMP.right = FanTempRightData[0];
+		REG_MOTOR_TEMP_STATUS.right = good;
+	}
+}
+
+//the TMP112 MSB is the temperature in whole degrees C
+static void board_temperature_done(I2C_TRANSACTION *t)
+{
+	int good = (t->status == I2C_STATUS_DONE);
+
+	if(good) REG_MOTOR_TEMP.board = (signed char)BoardTempData[0];
+	REG_MOTOR_TEMP_STATUS.board = good;
+}
+
+//SMBus words are sent LSB first
+static void charger_state_done(I2C_TRANSACTION *t)
+{
+	if(t->status != I2C_STATUS_DONE) return;
+
+	REG_MOTOR_CHARGER_STATE = ChargerStateData[0] + (ChargerStateData[1]<<8);
+}
+
+//*********************************************//
+//bus recovery, called by the I2C driver after a timeout or a lost arbitration
+
+//the bus lines of I2C2 and I2C3, general purpose pins while the module is off
+typedef struct
+{
+	volatile unsigned int *tris;
+	volatile unsigned int *lat;
+	volatile unsigned int *port;
+	unsigned int sda;
+	unsigned int scl;
+	volatile unsigned int *con;
+	volatile unsigned int *stat;
+	volatile unsigned int *brg;
+} I2CBusPins;
+
+static const I2CBusPins I2C2Pins = {&TRISF, &LATF, &PORTF, 1<<4, 1<<5, &I2C2CON, &I2C2STAT, &I2C2BRG};
+static const I2CBusPins I2C3Pins = {&TRISE, &LATE, &PORTE, 1<<7, 1<<6, &I2C3CON, &I2C3STAT, &I2C3BRG};
+
+//Clears a bus a slave is holding, called by the I2C driver after a timeout or a
+//lost arbitration with the module disabled.  A slave that was reset or lost clocks
+//in the middle of a byte keeps SDA low until it has clocked the byte out, so SCL is
+//pulsed (up to 9 times, a byte and its acknowledge) until SDA is released, then a
+//STOP is sent.  Returns the I2C_STUCK_ bits of the lines that were held low.
+static unsigned int recover_bus(const I2CBusPins *bus)
+{
+	unsigned int stuck = 0;
+	int i;
+
+	*bus->con = 0;
+	*bus->stat = 0;
+
+	//open drain: a line is released as an input and pulled low as an output
+	*bus->lat &= ~(bus->sda | bus->scl);
+	*bus->tris |= bus->sda | bus->scl;
+	__delay_us(I2CRecoverHalfBit);
+
+	//nothing on our side can release a clock a slave is stretching
+	if(!(*bus->port & bus->scl))
+		stuck |= I2C_STUCK_SCL;
+
+	if(!(*bus->port & bus->sda))
+	{
+		stuck |= I2C_STUCK_SDA;
+		for(i=0; i<I2CRecoverPulses && !(*bus->port & bus->sda); i++)
+		{
+			*bus->tris &= ~bus->scl;
+			__delay_us(I2CRecoverHalfBit);
+			*bus->tris |= bus->scl;
+			__delay_us(I2CRecoverHalfBit);
+		}
+	}
+
+	//STOP, SDA rising while SCL is high
+	*bus->tris &= ~bus->sda;
+	__delay_us(I2CRecoverHalfBit);
+	*bus->tris |= bus->sda;
+	__delay_us(I2CRecoverHalfBit);
+
+// New Bren-Tronics battery (or existing device interacting with the new
+// battery ties up the SMBus line (usually
+// seen after the robot is driven for a short time.  The only
+// way I've been able to recover from this is by either removing
+// the SMBus cable between the battery board and the power board,
+// or by changing the i2c pins to outputs when the i2c module is
+// disabled.
+	*bus->tris &= ~(bus->sda | bus->scl);
+
+	//FCY should be 16M
+	//I2C2BRG = FCY/100000-FCY/10000000-1;	//should be 157.4 (between 9D and 9E)
+	*bus->brg = 0xff;
+	//the driver enables the module
+	return stuck;
+}
+
+unsigned int recover_i2c2(void)
+{
+	return recover_bus(&I2C2Pins);
+}
+
+unsigned int recover_i2c3(void)
+{
+	return recover_bus(&I2C3Pins);
+}
+
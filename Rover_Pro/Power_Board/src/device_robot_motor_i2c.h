@@ -1,11 +1,10 @@
-void I2C3Update(void);
-void I2C2Update(void);
-
-void re_init_i2c2(void);
-void re_init_i2c3(void);
-
-extern int I2C2TimerExpired;
-extern int I2C3TimerExpired;
-
-extern int I2C2XmitReset;
-extern int I2C3XmitReset;
+void I2CQueueIni(void);
+
+void I2CUpdate(unsigned long now);
+void I2CFanDuty(unsigned char duty);
+void I2CFanIni(void);
+
+unsigned int recover_i2c2(void);
+unsigned int recover_i2c3(void);
+
+extern unsigned int BatterySOCReadings[2];
@@ -1,306 +1,414 @@
-#include "device_robot_motor_loop.h"
-#include "p24FJ256GB106.h"
-#include "stdhdr.h"
-#include "device_robot_motor.h"
-#include <stdbool.h>
-#include "../closed_loop_control/core/InputCapture.h"
-
-// supported motor options
-typedef enum {
-  kMotorLeft = 0,
-  kMotorRight,
-  kMotorFlipper,
-} kMotor;
-
-
-#define M1_TACHO_RPN        12                // RP12   
-#define M2_TACHO_RPN        16         
-
-#define NO                    0
-#define YES                   (!NO)
-
-#include "../closed_loop_control/PID.h"
-
-/*---------------------------Helper Function Prototypes-----------------------*/
-/*---------------------------IC Related---------------------------------------*/
-#define MAX_NUM_IC_PINS 2
-static volatile uint32_t timeouts[MAX_NUM_IC_PINS] = {0};
-
-/*---------------------------PID Related--------------------------------------*/
-/*---------------------------Filter Related-----------------------------------*/
-float IIRFilter(const uint8_t i, const float x, const float alpha,
-                const bool should_reset);
-
-#define ALPHA               0.8
-#define LMOTOR_FILTER       0
-#define RMOTOR_FILTER       1
-/*---------------------------Controller Related-------------------------------*/
-
-// PID controller values
-#define LEFT_CONTROLLER     0
-#define RIGHT_CONTROLLER    1
-
-#define MAX_EFFORT          1.00        // maximum control effort magnitude (can also be -1000)
-#define MIN_EFFORT          -1.00
-#define K_P                 0.0005      // proportional gain
-#define K_I                 0.00003     // integral gain
-#define K_D                 0.000000    // differential gain
-
-// filters
-#define ALPHA               0.8
-#define LMOTOR_FILTER       0
-#define RMOTOR_FILTER       1
-
-#define XbeeTest
-
-// OCU speed filter-related values
-#define MAX_DESIRED_SPEED   900         // [au], caps incoming signal from OCU
-#define MIN_ACHEIVABLE_SPEED 50
-
-float DT_speed(const kMotor motor);
-static float GetNominalDriveEffort(const float desired_speed);
-static int16_t GetDesiredSpeed(const kMotor motor);
-
-
-static float closed_loop_effort[3] = {0,0,0};
-
-static int desired_velocity_left = 0;
-static int desired_velocity_right = 0;
-static int desired_velocity_flipper = 0;
-
-
-void closed_loop_control_init(void)
-{
-  Nop();
-  Nop();
-IC_Init(kIC01, M1_TACHO_RPN, 5000); //1000 was TOO aggressive. If robot was moving slowly, the IC_Updateperiods()
-                                    // function was actually zeroing out speeds while the robot was moving!!!!!
-IC_Init(kIC02, M2_TACHO_RPN, 5000); // same notes....
- 	PID_Init(LEFT_CONTROLLER, MAX_EFFORT, MIN_EFFORT, K_P, K_I, K_D);
- 	PID_Init(RIGHT_CONTROLLER, MAX_EFFORT, MIN_EFFORT, K_P, K_I, K_D);
-
-
-
-
-}
-
-//this runs every 10ms
-void handle_closed_loop_control(unsigned int OverCurrent)
-{
-
-  static unsigned int stop_counter = 0;
-
-  //static float actual_speed_array[100] = {0};
-  
-  /*
-  //toggle pin to test loop rate
-  _TRISB6 = 0;
-  _TRISB7 = 0;
-
-  if(_RB6)
-    _LATB6 = 0;
-  else
-    _LATB6 = 1;
-  */
-
-  //If we have stopped the motors due to overcurrent, don't update speeds
-  if(OverCurrent)
-  {
-    PID_Reset(kMotorLeft);
-    PID_Reset(kMotorRight);
-    return;
-  }
-
-  //Filter drive motor speeds
-  float desired_speed_left = IIRFilter(LMOTOR_FILTER, GetDesiredSpeed(kMotorLeft), ALPHA, NO);
-	//printf("%f|",desired_speed_left);
-  float desired_speed_right = IIRFilter(RMOTOR_FILTER, GetDesiredSpeed(kMotorRight), ALPHA, NO);
-	#ifndef XbeeTest
-  //if the user releases the joystick, come to a relatively quick stop by clearing the integral term
-  if( (abs(REG_MOTOR_VELOCITY.left) < 50) && (abs(REG_MOTOR_VELOCITY.right) < 50 ) )
-  {
-    PID_Reset_Integral(kMotorLeft);
-    PID_Reset_Integral(kMotorRight);
-
-    //If user releases joystick, reset the IIR filter
-    IIRFilter(LMOTOR_FILTER, 0, ALPHA, YES);
-    IIRFilter(RMOTOR_FILTER, 0, ALPHA, YES);
-    desired_speed_left = 0;
-    desired_speed_right = 0;
-
-  }
-	#endif
-
-	#ifdef XbeeTest
-  //if the user releases the joystick, come to a relatively quick stop by clearing the integral term
-  if( (abs(Xbee_MOTOR_VELOCITY[0]) < 50) && (abs(Xbee_MOTOR_VELOCITY[1]) < 50 ) )
-  {
-    PID_Reset_Integral(kMotorLeft);
-    PID_Reset_Integral(kMotorRight);
-
-    //If user releases joystick, reset the IIR filter
-    IIRFilter(LMOTOR_FILTER, 0, ALPHA, YES);
-    IIRFilter(RMOTOR_FILTER, 0, ALPHA, YES);
-    desired_speed_left = 0;
-    desired_speed_right = 0;
-
-  }
-	#endif
-
-  
-
-  // update the flipper
-  float desired_flipper_speed = desired_velocity_flipper / 1200.0;
-  //DT_set_speed(kMotorFlipper, desired_flipper_speed);
-  closed_loop_effort[kMotorFlipper] = desired_flipper_speed;
-
- 
-  // update the left drive motor
-  float nominal_effort_left = GetNominalDriveEffort(desired_speed_left);
-  float actual_speed_left = DT_speed(kMotorLeft);
-  float effort_left = PID_ComputeEffort(LEFT_CONTROLLER, desired_speed_left, actual_speed_left, nominal_effort_left);
-	//printf("%f",effort_left);
-  //DT_set_speed(kMotorLeft, effort_left);
-  closed_loop_effort[kMotorLeft] = effort_left;
-	//printf("%d",closed_loop_effort[kMotorLeft]);
-  //DT_set_speed(kMotorLeft, nominal_effort_left);
-  
-  // update the right drive motor
-  float nominal_effort_right = GetNominalDriveEffort(desired_speed_right);
-  float actual_speed_right = DT_speed(kMotorRight);
-  float effort_right = PID_ComputeEffort(RIGHT_CONTROLLER, desired_speed_right, actual_speed_right, nominal_effort_right);
-  //DT_set_speed(kMotorRight, effort_right);
-  closed_loop_effort[kMotorRight] = effort_right;
-  //DT_set_speed(kMotorRight, nominal_effort_right);
-
-  /*i++;
-  if(i>=100)
-  {
-    i=0;
-  }
-  actual_speed_array[i] = actual_speed_right;*/
-
-  //if the speed inputs are 0, reset controller after 1 second
-  //TODO: fix controller so that we don't get these small offsets
-  if( (desired_velocity_left == 0) && (desired_velocity_right == 0) )
-  {
-    stop_counter++;
-    if(stop_counter > 100)
-    {
-      PID_Reset(kMotorLeft);
-      PID_Reset(kMotorRight);
-      stop_counter = 0;
-    }
-  }
-  else
-    stop_counter = 0;
-
-}
-
-int return_closed_loop_control_effort(unsigned char motor)
-{
-  //if(motor==1) return 300;
-  return (int)(closed_loop_effort[motor]*1000.0);
-  //return 0;
-}
-
-float DT_speed(const kMotor motor) {
-  #define HZ_16US 100000.0
-  
-  float period = 0;
-  switch (motor) {
-    case kMotorLeft: {
-      period = IC_period(kIC01);
-      if (period != 0) {
-        if (M1_DIRO) return -(HZ_16US / period);
-        else return (HZ_16US / period);
-      }
-      break;
-    }
-    case kMotorRight: {
-      period = IC_period(kIC02);
-      if (period != 0) {
-        if (M2_DIRO) return (HZ_16US / period);
-        else return -(HZ_16US / period);
-      }
-      break;
-    }
-    case kMotorFlipper: {
-      period = IC_period(kIC03);
-      if (period != 0) {
-//        if (M3_DIRO) return (HZ_16US / period);
-      if (M3_DIR) return (HZ_16US / period);
-        else return -(HZ_16US / period);
-      }
-      break;
-    }
-  }
-  return 0;
-}
-
-// Description: Returns the approximate steady-state effort required to 
-//   maintain the given desired speed of a drive motor.
-static float GetNominalDriveEffort(const float desired_speed) {
-  // NB: transfer function found empirically (see spreadsheet for data)  
-  if (desired_speed == 0) return 0;
-  
-  if (desired_speed < 0) return ((0.0007 * desired_speed) - 0.0067);
-  else return ((0.0007 * desired_speed) + 0.0067);
-}
-
-// Description: Maps the incoming control data to suitable values
-// Notes:
-//   - special-cases turning in place to higher values to overcome
-//     the additional torque b/c software change has too much overhead right now
-static int16_t GetDesiredSpeed(const kMotor motor) {
-  int16_t temp_left = desired_velocity_left/4;
-  int16_t temp_right = desired_velocity_right/4;
-  
-  switch (motor) {
-    case kMotorLeft:
-      if (abs(temp_left) < MIN_ACHEIVABLE_SPEED) {
-        return 0;
-      }
-      
-      // if we are turning (sign bits do not match AND magnitudes are non-negligible)
-      if (((temp_left >> 15) != (temp_right >> 15)) && 
-           ((200 < abs(temp_left)) && (200 < abs(temp_right)))) {
-        //ClearMotorHistory();
-        if (0 < temp_left) return 500;
-        else return -500;
-      }
-      
-      
-      if (MAX_DESIRED_SPEED < temp_left) return MAX_DESIRED_SPEED;
-      else if (temp_left < -MAX_DESIRED_SPEED) return -MAX_DESIRED_SPEED;
-      else return temp_left;
-    case kMotorRight:
-      if (abs(temp_right) < MIN_ACHEIVABLE_SPEED) {
-        return 0;
-      }
-      
-      if (((temp_left >> 15) != (temp_right >> 15)) &&
-          ((200 < abs(temp_left)) && (200 < abs(temp_right)))) {
-        //ClearMotorHistory();
-        if (0 < temp_right) return 500;
-        else return -500;
-      }
-      
-      if (MAX_DESIRED_SPEED < temp_right) return MAX_DESIRED_SPEED;
-      else if (temp_right < -MAX_DESIRED_SPEED) return -MAX_DESIRED_SPEED;
-      else return temp_right;
-    case kMotorFlipper: return REG_MOTOR_VELOCITY.flipper;
-  }
-  
-  return 0;
-}
-
-void set_desired_velocities(int left, int right, int flipper)
-{
-
-  desired_velocity_left = left;
-  desired_velocity_right = right;
-  desired_velocity_flipper = flipper;
-	//printf("%d,%d,%d",desired_velocity_left,desired_velocity_right,desired_velocity_flipper);
-
-}
+#include "device_robot_motor_loop.h"
+#include "p24FJ256GB106.h"
+#include "stdhdr.h"
+#include "device_robot_motor.h"
+#include <stdbool.h>
+#include "../closed_loop_control/core/InputCapture.h"
+
+// supported motor options
+typedef enum {
+  kMotorLeft = 0,
+  kMotorRight,
+  kMotorFlipper,
+} kMotor;
+
+
+#define M1_TACHO_RPN        12                // RP12   
+#define M2_TACHO_RPN        16         
+
+#define NO                    0
+#define YES                   (!NO)
+
+#include "../closed_loop_control/PID.h"
+#include "../closed_loop_control/Traction.h"
+#include "../closed_loop_control/Observer.h"
+#include "../closed_loop_control/Thermal.h"
+
+/*---------------------------Helper Function Prototypes-----------------------*/
+/*---------------------------IC Related---------------------------------------*/
+#define MAX_NUM_IC_PINS 2
+static volatile uint32_t timeouts[MAX_NUM_IC_PINS] = {0};
+
+/*---------------------------PID Related--------------------------------------*/
+/*---------------------------Filter Related-----------------------------------*/
+float IIRFilter(const uint8_t i, const float x, const float alpha,
+                const bool should_reset);
+
+#define ALPHA               0.8
+#define LMOTOR_FILTER       0
+#define RMOTOR_FILTER       1
+/*---------------------------Controller Related-------------------------------*/
+
+// PID controller values
+#define LEFT_CONTROLLER     0
+#define RIGHT_CONTROLLER    1
+
+#define MAX_EFFORT          1.00        // maximum control effort magnitude (can also be -1000)
+#define MIN_EFFORT          -1.00
+#define K_P                 0.0005      // proportional gain
+#define K_I                 0.00003     // integral gain
+#define K_D                 0.000000    // differential gain
+
+// filters
+#define ALPHA               0.8
+#define LMOTOR_FILTER       0
+#define RMOTOR_FILTER       1
+
+// OCU speed filter-related values
+#define MAX_DESIRED_SPEED   900         // [au], caps incoming signal from OCU
+#define MIN_ACHEIVABLE_SPEED 50
+
+float DT_speed(const kMotor motor);
+static float GetNominalDriveEffort(const float desired_speed);
+static int16_t GetDesiredSpeed(const kMotor motor);
+static int16_t GetSpinSpeed(void);
+static void UpdateSpeedObservers(void);
+
+
+static float closed_loop_effort[3] = {0,0,0};
+
+static int desired_velocity_left = 0;
+static int desired_velocity_right = 0;
+static int desired_velocity_flipper = 0;
+
+//set while the drive motors hold position after the command link is lost
+static int holding = NO;
+
+
+void closed_loop_control_init(void)
+{
+  Nop();
+  Nop();
+IC_Init(kIC01, M1_TACHO_RPN, 5000); //1000 was TOO aggressive. If robot was moving slowly, the IC_Updateperiods()
+                                    // function was actually zeroing out speeds while the robot was moving!!!!!
+IC_Init(kIC02, M2_TACHO_RPN, 5000); // same notes....
+ 	PID_Init(LEFT_CONTROLLER, MAX_EFFORT, MIN_EFFORT, K_P, K_I, K_D);
+ 	PID_Init(RIGHT_CONTROLLER, MAX_EFFORT, MIN_EFFORT, K_P, K_I, K_D);
+
+  traction_limits_t traction_limits = {FREE_SPIN_SPEED, FREE_SPIN_CURRENT,
+    STALL_EFFORT, STALL_SPEED, STALL_CURRENT,
+    STRAIGHT_TOLERANCE, MISMATCH_TOLERANCE, MISMATCH_SPEED};
+  TRACT_Init(&traction_limits);
+
+  observer_model_t drive_model = {OBS_DUTY_GAIN_NUM, OBS_DUTY_GAIN_DEN, OBS_DUTY_OFFSET,
+    OBS_TIME_CONSTANT_MS, OBS_EDGE_SPEED_MS, OBS_SPEED_GAIN, OBS_DISTURBANCE_GAIN};
+  OBS_Init(kMotorLeft, CLOSED_LOOP_PERIOD_MS, &drive_model);
+  OBS_Init(kMotorRight, CLOSED_LOOP_PERIOD_MS, &drive_model);
+
+
+
+}
+
+//this runs every 10ms
+void handle_closed_loop_control(unsigned int OverCurrent)
+{
+
+  static unsigned int stop_counter = 0;
+
+  UpdateSpeedObservers();
+
+  //static float actual_speed_array[100] = {0};
+  
+  /*
+  //toggle pin to test loop rate
+  _TRISB6 = 0;
+  _TRISB7 = 0;
+
+  if(_RB6)
+    _LATB6 = 0;
+  else
+    _LATB6 = 1;
+  */
+
+  //If we have stopped the motors due to overcurrent, don't update speeds
+  if(OverCurrent)
+  {
+    PID_Reset(kMotorLeft);
+    PID_Reset(kMotorRight);
+    return;
+  }
+
+  //Filter drive motor speeds
+  float desired_speed_left = IIRFilter(LMOTOR_FILTER, GetDesiredSpeed(kMotorLeft), ALPHA, NO);
+	//printf("%f|",desired_speed_left);
+  float desired_speed_right = IIRFilter(RMOTOR_FILTER, GetDesiredSpeed(kMotorRight), ALPHA, NO);
+	#ifndef XbeeTest
+  //if the user releases the joystick, come to a relatively quick stop by clearing the integral term
+  if( (abs(REG_MOTOR_VELOCITY.left) < 50) && (abs(REG_MOTOR_VELOCITY.right) < 50 ) )
+  {
+    //unless holding, where the integral is what pushes back against a slope
+    if(!holding)
+    {
+      PID_Reset_Integral(kMotorLeft);
+      PID_Reset_Integral(kMotorRight);
+    }
+
+    //If user releases joystick, reset the IIR filter
+    IIRFilter(LMOTOR_FILTER, 0, ALPHA, YES);
+    IIRFilter(RMOTOR_FILTER, 0, ALPHA, YES);
+    desired_speed_left = 0;
+    desired_speed_right = 0;
+
+  }
+	#endif
+
+	#ifdef XbeeTest
+  //if the user releases the joystick, come to a relatively quick stop by clearing the integral term
+  if( (abs(Xbee_MOTOR_VELOCITY[0]) < 50) && (abs(Xbee_MOTOR_VELOCITY[1]) < 50 ) )
+  {
+    //unless holding, where the integral is what pushes back against a slope
+    if(!holding)
+    {
+      PID_Reset_Integral(kMotorLeft);
+      PID_Reset_Integral(kMotorRight);
+    }
+
+    //If user releases joystick, reset the IIR filter
+    IIRFilter(LMOTOR_FILTER, 0, ALPHA, YES);
+    IIRFilter(RMOTOR_FILTER, 0, ALPHA, YES);
+    desired_speed_left = 0;
+    desired_speed_right = 0;
+
+  }
+	#endif
+
+  
+
+  // update the flipper
+  float desired_flipper_speed = desired_velocity_flipper / 1200.0;
+  //DT_set_speed(kMotorFlipper, desired_flipper_speed);
+  closed_loop_effort[kMotorFlipper] = desired_flipper_speed;
+
+ 
+  // update the left drive motor
+  float nominal_effort_left = GetNominalDriveEffort(desired_speed_left);
+  float actual_speed_left = OBS_Speed(kMotorLeft);
+  float effort_left = PID_ComputeEffort(LEFT_CONTROLLER, desired_speed_left, actual_speed_left, nominal_effort_left);
+	//printf("%f",effort_left);
+  //DT_set_speed(kMotorLeft, effort_left);
+  closed_loop_effort[kMotorLeft] = effort_left;
+	//printf("%d",closed_loop_effort[kMotorLeft]);
+  //DT_set_speed(kMotorLeft, nominal_effort_left);
+  
+  // update the right drive motor
+  float nominal_effort_right = GetNominalDriveEffort(desired_speed_right);
+  float actual_speed_right = OBS_Speed(kMotorRight);
+  float effort_right = PID_ComputeEffort(RIGHT_CONTROLLER, desired_speed_right, actual_speed_right, nominal_effort_right);
+  //DT_set_speed(kMotorRight, effort_right);
+  closed_loop_effort[kMotorRight] = effort_right;
+  //DT_set_speed(kMotorRight, nominal_effort_right);
+
+  /*i++;
+  if(i>=100)
+  {
+    i=0;
+  }
+  actual_speed_array[i] = actual_speed_right;*/
+
+  //if the speed inputs are 0, reset controller after 1 second
+  //TODO: fix controller so that we don't get these small offsets
+  if( (desired_velocity_left == 0) && (desired_velocity_right == 0) && !holding )
+  {
+    stop_counter++;
+    if(stop_counter > 100)
+    {
+      PID_Reset(kMotorLeft);
+      PID_Reset(kMotorRight);
+      stop_counter = 0;
+    }
+  }
+  else
+    stop_counter = 0;
+
+}
+
+//keeps the speed loop integrator live at zero speed, so the drive motors hold against a slope
+//the integrator starts from zero, the load it wound up against before the link was lost is stale
+void set_closed_loop_hold(int hold)
+{
+  if(hold && !holding)
+  {
+    PID_Reset(kMotorLeft);
+    PID_Reset(kMotorRight);
+  }
+  holding = hold;
+}
+
+//the PID effort, cut and derated like the trajectory effort
+int return_closed_loop_control_effort(unsigned char motor)
+{
+  //if(motor==1) return 300;
+  return thermal_limited_effort(motor,
+    traction_limited_effort(motor, (int)(closed_loop_effort[motor]*1000.0)));
+  //return 0;
+}
+
+float DT_speed(const kMotor motor) {
+  #define HZ_16US 100000.0
+  
+  float period = 0;
+  switch (motor) {
+    case kMotorLeft: {
+      period = IC_period(kIC01);
+      if (period != 0) {
+        if (M1_DIRO) return -(HZ_16US / period);
+        else return (HZ_16US / period);
+      }
+      break;
+    }
+    case kMotorRight: {
+      period = IC_period(kIC02);
+      if (period != 0) {
+        if (M2_DIRO) return (HZ_16US / period);
+        else return -(HZ_16US / period);
+      }
+      break;
+    }
+    case kMotorFlipper: {
+      period = IC_period(kIC03);
+      if (period != 0) {
+//        if (M3_DIRO) return (HZ_16US / period);
+      if (M3_DIR) return (HZ_16US / period);
+        else return -(HZ_16US / period);
+      }
+      break;
+    }
+  }
+  return 0;
+}
+
+// Description: Returns the approximate steady-state effort required to 
+//   maintain the given desired speed of a drive motor.
+static float GetNominalDriveEffort(const float desired_speed) {
+  // NB: transfer function found empirically (see spreadsheet for data)  
+  if (desired_speed == 0) return 0;
+  
+  if (desired_speed < 0) return ((0.0007 * desired_speed) - 0.0067);
+  else return ((0.0007 * desired_speed) + 0.0067);
+}
+
+// Description: Maps the incoming control data to suitable values
+// Notes:
+//   - special-cases turning in place to higher values to overcome
+//     the additional torque b/c software change has too much overhead right now
+static int16_t GetDesiredSpeed(const kMotor motor) {
+  int16_t temp_left = desired_velocity_left/4;
+  int16_t temp_right = desired_velocity_right/4;
+  
+  switch (motor) {
+    case kMotorLeft:
+      if (abs(temp_left) < MIN_ACHEIVABLE_SPEED) {
+        return 0;
+      }
+      
+      // if we are turning (sign bits do not match AND magnitudes are non-negligible)
+      if (((temp_left >> 15) != (temp_right >> 15)) && 
+           ((200 < abs(temp_left)) && (200 < abs(temp_right)))) {
+        //ClearMotorHistory();
+        if (0 < temp_left) return GetSpinSpeed();
+        else return -GetSpinSpeed();
+      }
+      
+      
+      if (MAX_DESIRED_SPEED < temp_left) return MAX_DESIRED_SPEED;
+      else if (temp_left < -MAX_DESIRED_SPEED) return -MAX_DESIRED_SPEED;
+      else return temp_left;
+    case kMotorRight:
+      if (abs(temp_right) < MIN_ACHEIVABLE_SPEED) {
+        return 0;
+      }
+      
+      if (((temp_left >> 15) != (temp_right >> 15)) &&
+          ((200 < abs(temp_left)) && (200 < abs(temp_right)))) {
+        //ClearMotorHistory();
+        if (0 < temp_right) return GetSpinSpeed();
+        else return -GetSpinSpeed();
+      }
+      
+      if (MAX_DESIRED_SPEED < temp_right) return MAX_DESIRED_SPEED;
+      else if (temp_right < -MAX_DESIRED_SPEED) return -MAX_DESIRED_SPEED;
+      else return temp_right;
+    case kMotorFlipper: return REG_MOTOR_VELOCITY.flipper;
+  }
+  
+  return 0;
+}
+
+// Description: Runs the drive motor velocity observers on the effort applied
+//   over the last period and any new tach edges.  GetDuty() passes the effort
+//   straight through to the PWM (clipped to MaxDuty), so it stands in for the duty
+static void UpdateSpeedObservers(void) {
+  static uint16_t last_edge_count[2] = {0, 0};
+  uint16_t edge_count;
+  
+  edge_count = IC_edge_count(kIC01);
+  OBS_Update(kMotorLeft, Robot_Motor_TargetSpeedUSB[kMotorLeft],
+             edge_count != last_edge_count[kMotorLeft], (int16_t)DT_speed(kMotorLeft));
+  last_edge_count[kMotorLeft] = edge_count;
+  
+  edge_count = IC_edge_count(kIC02);
+  OBS_Update(kMotorRight, Robot_Motor_TargetSpeedUSB[kMotorRight],
+             edge_count != last_edge_count[kMotorRight], (int16_t)DT_speed(kMotorRight));
+  last_edge_count[kMotorRight] = edge_count;
+  
+  REG_MOTOR_OBS_SPEED.left = OBS_Speed(kMotorLeft);
+  REG_MOTOR_OBS_SPEED.right = OBS_Speed(kMotorRight);
+  REG_MOTOR_OBS_ACCEL.left = OBS_Acceleration(kMotorLeft);
+  REG_MOTOR_OBS_ACCEL.right = OBS_Acceleration(kMotorRight);
+}
+
+// Description: Returns the speed used to turn in place, set by the host
+//   through REG_MOTOR_TURN_LIMITS (0 keeps the default)
+static int16_t GetSpinSpeed(void) {
+  if (REG_MOTOR_TURN_LIMITS.spin_speed <= 0) return SPIN_SPEED;
+  if (MAX_DESIRED_SPEED < REG_MOTOR_TURN_LIMITS.spin_speed) return MAX_DESIRED_SPEED;
+  return REG_MOTOR_TURN_LIMITS.spin_speed;
+}
+
+void set_desired_velocities(int left, int right, int flipper)
+{
+
+  desired_velocity_left = left;
+  desired_velocity_right = right;
+  desired_velocity_flipper = flipper;
+	//printf("%d,%d,%d",desired_velocity_left,desired_velocity_right,desired_velocity_flipper);
+
+}
+
+//this runs every 10ms, alongside handle_closed_loop_control()
+//cross-checks commanded effort, tach speed and current of the drive motors
+void handle_traction_monitor(void)
+{
+  TRACT_Update(kMotorLeft, Robot_Motor_TargetSpeedUSB[kMotorLeft],
+               (int16_t)DT_speed(kMotorLeft), (int16_t)RealTimeCurrent[kMotorLeft]);
+  TRACT_Update(kMotorRight, Robot_Motor_TargetSpeedUSB[kMotorRight],
+               (int16_t)DT_speed(kMotorRight), (int16_t)RealTimeCurrent[kMotorRight]);
+  TRACT_UpdatePair(kMotorLeft, kMotorRight);
+
+  REG_MOTOR_TRACTION_STATUS.left = TRACT_Status(kMotorLeft);
+  REG_MOTOR_TRACTION_STATUS.right = TRACT_Status(kMotorRight);
+  REG_MOTOR_FREE_SPIN_COUNT.left = TRACT_Count(kMotorLeft, kTractFreeSpinCount);
+  REG_MOTOR_FREE_SPIN_COUNT.right = TRACT_Count(kMotorRight, kTractFreeSpinCount);
+  REG_MOTOR_STALL_COUNT.left = TRACT_Count(kMotorLeft, kTractStallCount);
+  REG_MOTOR_STALL_COUNT.right = TRACT_Count(kMotorRight, kTractStallCount);
+  REG_MOTOR_MISMATCH_COUNT.left = TRACT_Count(kMotorLeft, kTractMismatchCount);
+  REG_MOTOR_MISMATCH_COUNT.right = TRACT_Count(kMotorRight, kTractMismatchCount);
+}
+
+//reduces the effort of a free-spinning drive motor by REG_MOTOR_SLIP_EFFORT_DROP percent
+//(0 disables this)
+int traction_limited_effort(unsigned char motor, int effort)
+{
+  if (motor == kMotorFlipper) return effort;
+  if (REG_MOTOR_SLIP_EFFORT_DROP == 0) return effort;
+  if ((TRACT_Status(motor) & TRACT_FREE_SPIN) == 0) return effort;
+
+  if (100 <= REG_MOTOR_SLIP_EFFORT_DROP) return 0;
+  return (int)(((long)effort * (100 - REG_MOTOR_SLIP_EFFORT_DROP)) / 100);
+}
+
+//scales the effort down as the winding temperature estimate nears its limit
+int thermal_limited_effort(unsigned char motor, int effort)
+{
+  return (int)(((long)effort * THERM_Derate(motor)) / THERM_FULL_SCALE);
+}
@@ -1,6 +1,10 @@
-void handle_closed_loop_control(unsigned int OverCurrent);
-void closed_loop_control_init(void);
-int return_closed_loop_control_effort(unsigned char motor);
-void set_desired_velocities(int left, int right, int flipper);
-
-#define MAX_NUM_CONTROLLERS   8
+void handle_closed_loop_control(unsigned int OverCurrent);
+void closed_loop_control_init(void);
+int return_closed_loop_control_effort(unsigned char motor);
+void set_desired_velocities(int left, int right, int flipper);
+void set_closed_loop_hold(int hold);
+void handle_traction_monitor(void);
+int traction_limited_effort(unsigned char motor, int effort);
+int thermal_limited_effort(unsigned char motor, int effort);
+
+#define MAX_NUM_CONTROLLERS   8
@@ -0,0 +1,74 @@
+#include "p24FJ256GB106.h"
+#include "stdhdr.h"
+#include "device_robot_motor_poll.h"
+
+static void back_off(PollState *s, const PollPolicy *p);
+
+//the first read is due right away
+void PollIni(PollState *s)
+{
+	s->due=0;
+	s->interval=0;
+	s->last=0;
+	s->valid=False;
+}
+
+int PollDue(const PollState *s, unsigned long now)
+{
+	return (long)(now-s->due)>=0;
+}
+
+//schedules the next read after a good one, now is when it was seen
+void PollReading(PollState *s, const PollPolicy *p, unsigned long now, int value)
+{
+	long delta=(long)value-s->last;
+
+	if(delta<0)
+		delta=-delta;
+
+	if(value<p->low || value>p->high)
+		s->interval=p->fast;
+	else if(!s->valid)
+		s->interval=p->period;
+	else if(delta>=p->change)
+		s->interval=p->fast;
+	else if(delta==0)
+		back_off(s,p);
+	else
+		s->interval=p->period;
+
+	s->last=value;
+	s->valid=True;
+	s->due=now+s->interval;
+}
+
+//schedules the next read after a failed one
+void PollFailed(PollState *s, const PollPolicy *p, unsigned long now)
+{
+	back_off(s,p);
+	s->due=now+s->interval;
+}
+
+//fast and slow periods around a nominal one, for sensors that only have that
+void PollScale(PollPolicy *p, unsigned int period)
+{
+	unsigned long slow=(unsigned long)period*PollSlowFactor;
+
+	p->period=period;
+	p->fast=period/PollFastDivisor;
+	if(p->fast==0)
+		p->fast=1;
+	p->slow=(slow>0xffff)?0xffff:slow;
+}
+
+//doubles the interval, from the nominal period up to the slow one
+static void back_off(PollState *s, const PollPolicy *p)
+{
+	unsigned long interval=(unsigned long)s->interval*2;
+
+	if(interval<p->period)
+		interval=p->period;
+	if(interval>p->slow)
+		interval=p->slow;
+	s->interval=interval;
+}
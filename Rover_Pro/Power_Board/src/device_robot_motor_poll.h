@@ -0,0 +1,35 @@
+//Adaptive polling of the slow I2C sensors.  Every sensor has a nominal period; a
+//reading that moved by at least change since the last one, or that is beyond one
+//of its thresholds, is followed by the next one after the fast period.
+//A reading that didn't move at all, or a failed read (device absent, backing
+//off), doubles the interval up to the slow period.  Anything else goes back to
+//the nominal period.
+
+#define PollFastDivisor 4 //fast period of a sensor that only has a nominal one
+#define PollSlowFactor 8 //slow period of a sensor that only has a nominal one
+#define PollNoLow (-32767-1) //low threshold that is never reached
+#define PollNoHigh 32767 //high threshold that is never reached
+
+typedef struct
+{
+	unsigned int fast;//ms
+	unsigned int period;//ms, nominal
+	unsigned int slow;//ms, longest back-off
+	int change;//a reading that moved at least this much is polled fast
+	int low;//readings below low, or above high, are polled fast
+	int high;
+} PollPolicy;
+
+typedef struct
+{
+	unsigned long due;//UptimeCount
+	unsigned int interval;//ms, 0 before the first result
+	int last;
+	unsigned char valid;//last holds a reading
+} PollState;
+
+void PollIni(PollState *s);
+int PollDue(const PollState *s, unsigned long now);
+void PollReading(PollState *s, const PollPolicy *p, unsigned long now, int value);
+void PollFailed(PollState *s, const PollPolicy *p, unsigned long now);
+void PollScale(PollPolicy *p, unsigned int period);
@@ -0,0 +1,440 @@
+#include "p24FJ256GB106.h"
+#include "stdhdr.h"
+#include "device_robot_motor.h"
+#include "debug_log.h"
+#include "device_robot_motor_power.h"
+#include "device_robot_motor_adc.h"
+#include "interrupt_switch.h"
+#include "../closed_loop_control/Precharge.h"
+
+//steps of PowerBusUpdate()
+#define StepIdentify 0
+#define StepIdentifyWait 1
+#define StepRetryWait 2
+#define StepPulseOn 3
+#define StepPulseOnWait 4
+#define StepPulseOff 5
+#define StepPrechargeOn 6
+#define StepPrechargeOnWait 7
+#define StepPrechargeOff 8
+
+typedef struct
+{
+	const char *name;
+	unsigned char length;
+	unsigned char method;
+} PowerBusBattery;
+
+//the cells are switched on and off pulses times, then left on.  The on pulse is
+//either on_ms long, or a busy loop of on_loops Nops that grows by i*i/4 with
+//each pulse up to on_loops_max (k=20,000 is about 15ms)
+typedef struct
+{
+	unsigned int pulses;
+	unsigned int on_ms;
+	unsigned int on_loops;
+	unsigned int on_loops_max;
+	unsigned int off_ms;
+} PowerBusPulseMethod;
+
+//method is the fixed pulse pattern used if the closed loop soft start fails,
+//in order of precedence when the batteries differ
+static const PowerBusBattery PowerBusBatteries[]=
+{
+	{"BB-2590",7,PowerBusMethodOld},
+	{"BT-70791B",9,PowerBusMethodNew},
+	{"BT-70791C",9,PowerBusMethodNew},
+	//the low lithium custom Matthew's battery
+	{"ROBOTEX",7,PowerBusMethodOld},
+};
+#define PowerBusBatteryCount (int)(sizeof(PowerBusBatteries)/sizeof(PowerBusBatteries[0]))
+
+//indexed by method-PowerBusMethodOld
+static const PowerBusPulseMethod PowerBusPulseMethods[]=
+{
+	{20,10,0,0,40},//old
+	{300,0,2000,0xffff,10},//new
+	{200,0,2000,20000,40},//hybrid
+};
+
+static unsigned char NameData[2][PowerBusNameLength];
+static I2C_TRANSACTION NameRead[2]=
+{
+	{BATTERY_ADDRESS,PowerBusNameCommand,I2C_READ,I2C_PRIORITY_HIGH,NameData[Cell_A],PowerBusNameLength,0,0},
+	{BATTERY_ADDRESS,PowerBusNameCommand,I2C_READ,I2C_PRIORITY_HIGH,NameData[Cell_B],PowerBusNameLength,0,0},
+};
+
+static int State=PowerBusWaiting;
+static int Step=StepIdentify;
+static unsigned long StartTime,StepTime,PulseTime;
+static const PowerBusPulseMethod *Method;
+static unsigned int Pulse;
+static int Fallback;
+
+static const precharge_config_t PrechargeConfig=
+{
+	PrechargePulseMin,
+	PrechargePulseMax,
+	PrechargePulseStart,
+	PrechargeInrushLimit,
+	PrechargeMaxStep,
+	PrechargeTolerance,
+	PrechargeMinBus,
+	PrechargeSettleRise,
+	PrechargeSettlePulses,
+	PrechargeMaxPulses,
+};
+
+//from PowerBusSample(), the bus voltage of the last A/D frame and the peak of the
+//two cell currents since the start of the pulse
+static unsigned int BusVoltage=0;
+static unsigned int PeakCurrent=0;
+
+//cleared by the Timer4 interrupt that ends a pulse
+static volatile int PulseRunning=False;
+
+static int name_read_pending(int i);
+static int check_string_match(const char *string1, const unsigned char *string2, unsigned char length);
+static void start_precharge(int method, unsigned long now);
+static void start_pulsing(int method, unsigned long now);
+static void publish_precharge(int result);
+static unsigned int pack_voltage(void);
+static unsigned int limit_units(long units);
+static void start_pulse(unsigned long us);
+static void end_pulse(void);
+static void finish(int method);
+
+
+void PowerBusIni(void)
+{
+	State=PowerBusWaiting;
+	Step=StepIdentify;
+
+	//enable outputs for power bus
+	CELL_A_MOS_EN(1);
+	CELL_B_MOS_EN(1);
+
+	//initialize i2c buses
+	I2C2Ini();
+	I2C3Ini();
+
+	// if the power bus is already active (like the bootloader did it)
+	// then nothing to do here.
+	if (Cell_A_MOS && Cell_B_MOS) {
+		RCON = 0;
+		finish(PowerBusMethodAlreadyOn);
+		return;
+	}
+
+	// _POR = "we are powering on from a black or brownout"
+	// _EXTR = "our reset pin was hit"
+	// If the system is "warm", we can just switch the power bus back on.
+	if (!_POR && !_EXTR) {
+		Cell_Ctrl(Cell_A,Cell_ON);
+		Cell_Ctrl(Cell_B,Cell_ON);
+		RCON = 0;
+		finish(PowerBusMethodImmediate);
+		return;
+	}
+}
+
+int PowerBusReady(void)
+{
+	return State==PowerBusOn;
+}
+
+//every A/D frame in raw counts, while the bus isn't up
+void PowerBusSample(unsigned int voltage_a, unsigned int voltage_b, unsigned int current_a, unsigned int current_b)
+{
+	long a,b;
+
+	//both cells switch onto the bus
+	a=ADCCalToUnits(ADCSlowChannel(SlowCellAVoltage),voltage_a<<ADCCalFractionBits);
+	b=ADCCalToUnits(ADCSlowChannel(SlowCellBVoltage),voltage_b<<ADCCalFractionBits);
+	BusVoltage=limit_units((a>b)?a:b);
+
+	a=ADCCalToUnits(ADCSlowChannel(SlowCellACurrent),current_a<<ADCCalFractionBits);
+	b=ADCCalToUnits(ADCSlowChannel(SlowCellBCurrent),current_b<<ADCCalFractionBits);
+	a=limit_units(a)+(long)limit_units(b);
+	if(a>PeakCurrent)
+		PeakCurrent=limit_units(a);
+}
+
+//one step of the bring-up, now is the time in ms
+void PowerBusUpdate(unsigned long now)
+{
+	unsigned int attempt,result,k,j,b,width;
+	int i,match;
+
+	switch(State)
+	{
+		case PowerBusOn:
+			return;
+		case PowerBusWaiting:
+			StartTime=now;
+			REG_PWR_BUS_BRINGUP.state=State=PowerBusIdentifying;
+			Step=StepIdentify;
+			break;
+	}
+	REG_PWR_BUS_BRINGUP.total_ms=now-StartTime;
+
+	switch(Step)
+	{
+		//read "Device Name" from both batteries
+		case StepIdentify:
+			queueI2C(2,&NameRead[Cell_A]);
+			queueI2C(3,&NameRead[Cell_B]);
+			StepTime=now;
+			Step=StepIdentifyWait;
+			break;
+
+		case StepIdentifyWait:
+			if(name_read_pending(Cell_A) || name_read_pending(Cell_B))
+			{
+				if(now-StepTime<PowerBusIdentifyTimeout)
+					break;
+				//a read that hasn't started yet is dropped, a running one is
+				//timed out by the I2C driver and won't be queued twice
+				cancelI2C(2,&NameRead[Cell_A]);
+				cancelI2C(3,&NameRead[Cell_B]);
+				result=PowerBusAttemptTimeout;
+			}
+			else if(NameRead[Cell_A].status!=I2C_STATUS_DONE && NameRead[Cell_B].status!=I2C_STATUS_DONE)
+			{
+				result=PowerBusAttemptNoAnswer;
+			}
+			else
+			{
+				result=PowerBusAttemptUnknown;
+			}
+
+			//the first byte of a block read is its length
+			match=-1;
+			for(i=0;i<PowerBusBatteryCount && match<0;i++)
+			{
+				for(b=Cell_A;b<=Cell_B;b++)
+				{
+					if(NameRead[b].status==I2C_STATUS_DONE &&
+					   check_string_match(PowerBusBatteries[i].name,&NameData[b][1],PowerBusBatteries[i].length))
+						match=i;
+				}
+			}
+			if(match>=0)
+				result=PowerBusAttemptIdentified;
+
+			attempt=REG_PWR_BUS_BRINGUP.attempts++;
+			REG_PWR_BUS_BRINGUP.attempt_result[attempt]=result;
+			REG_PWR_BUS_BRINGUP.attempt_ms[attempt]=now-StepTime;
+
+			if(match>=0)
+			{
+				LOG2(LogBatteryIdentified,match,PowerBusBatteries[match].method);
+				start_precharge(PowerBusBatteries[match].method,now);
+			}
+			else if(REG_PWR_BUS_BRINGUP.attempts<PowerBusIdentifyRetries)
+			{
+				StepTime=now;
+				Step=StepRetryWait;
+			}
+			else
+			{
+				//if we're using an unknown battery
+				LOG0(LogBatteryUnknown);
+				start_precharge(PowerBusMethodHybrid,now);
+			}
+			break;
+
+		case StepRetryWait:
+			if(now-StepTime>=PowerBusRetryDelay)
+				Step=StepIdentify;
+			break;
+
+		case StepPulseOn:
+			if(Method->on_ms)
+			{
+				start_pulse(Method->on_ms*1000UL);
+				Step=StepPulseOnWait;
+				break;
+			}
+			Cell_Ctrl(Cell_A,Cell_ON);
+			Cell_Ctrl(Cell_B,Cell_ON);
+			//the on pulse is too short for the ms tick, this is the only part
+			//that blocks, at most on_loops_max
+			k=Method->on_loops;
+			if(Pulse)
+			{
+				//unsigned int arithmetic, like the loops this replaces
+				j=Pulse-1;
+				k=Method->on_loops+j*j/4;
+				if(k>Method->on_loops_max) k=Method->on_loops_max;
+			}
+			for(j=0;j<k;j++) Nop();
+			Cell_Ctrl(Cell_A,Cell_OFF);
+			Cell_Ctrl(Cell_B,Cell_OFF);
+			StepTime=now;
+			Step=StepPulseOff;
+			break;
+
+		case StepPulseOnWait:
+			if(PulseRunning)
+				break;
+			StepTime=now;
+			Step=StepPulseOff;
+			break;
+
+		case StepPulseOff:
+			if(now-StepTime<Method->off_ms)
+				break;
+			Pulse++;
+			if(Pulse<Method->pulses)
+			{
+				Step=StepPulseOn;
+				break;
+			}
+			Cell_Ctrl(Cell_A,Cell_ON);
+			Cell_Ctrl(Cell_B,Cell_ON);
+			REG_PWR_BUS_BRINGUP.pulse_ms=now-PulseTime;
+			finish(REG_PWR_BUS_BRINGUP.method);
+			break;
+
+		case StepPrechargeOn:
+			PeakCurrent=0;
+			width=PRE_PulseWidth();
+			if(width>PrechargePulseMax)
+				width=PrechargePulseMax;
+			start_pulse(width);
+			Step=StepPrechargeOnWait;
+			break;
+
+		case StepPrechargeOnWait:
+			if(PulseRunning)
+				break;
+			StepTime=now;
+			Step=StepPrechargeOff;
+			break;
+
+		case StepPrechargeOff:
+			if(now-StepTime<PrechargeOffTime)
+				break;
+			result=PRE_Update(BusVoltage,pack_voltage(),PeakCurrent);
+			if(result==PRE_DONE)
+			{
+				publish_precharge(PrechargeDone);
+				Cell_Ctrl(Cell_A,Cell_ON);
+				Cell_Ctrl(Cell_B,Cell_ON);
+				REG_PWR_BUS_BRINGUP.pulse_ms=now-PulseTime;
+				finish(PowerBusMethodPrecharge);
+			}
+			else if(result==PRE_FAILED || now-PulseTime>=PrechargeTimeout)
+			{
+				publish_precharge(PrechargeFailed);
+				LOG2(LogPrechargeFailed,PRE_Pulses(),BusVoltage);
+				start_pulsing(Fallback,now);
+			}
+			else
+			{
+				publish_precharge(PrechargeRunning);
+				Step=StepPrechargeOn;
+			}
+			break;
+	}
+}
+
+static int name_read_pending(int i)
+{
+	return NameRead[i].status==I2C_STATUS_QUEUED || NameRead[i].status==I2C_STATUS_ACTIVE;
+}
+
+static int check_string_match(const char *string1, const unsigned char *string2, unsigned char length)
+{
+	unsigned int i;
+
+	for(i=0;i<length;i++)
+	{
+		if(string1[i] != string2[i])
+			return 0;
+	}
+	return 1;
+}
+
+//closed loop soft start, method is the fallback
+static void start_precharge(int method, unsigned long now)
+{
+	Fallback=method;
+	REG_PWR_BUS_BRINGUP.method=PowerBusMethodPrecharge;
+	REG_PWR_BUS_BRINGUP.state=State=PowerBusPulsing;
+	PulseTime=now;
+	PRE_Start(&PrechargeConfig,BusVoltage);
+	publish_precharge(PrechargeRunning);
+	Step=StepPrechargeOn;
+}
+
+//fixed pulses, REG_PWR_BUS_BRINGUP.pulse_ms keeps counting from start_precharge()
+static void start_pulsing(int method, unsigned long now)
+{
+	REG_PWR_BUS_BRINGUP.method=method;
+	REG_PWR_BUS_BRINGUP.state=State=PowerBusPulsing;
+	Method=&PowerBusPulseMethods[method-PowerBusMethodOld];
+	Pulse=0;
+	Step=StepPulseOn;
+}
+
+static void publish_precharge(int result)
+{
+	REG_PWR_PRECHARGE.result=result;
+	REG_PWR_PRECHARGE.pulses=PRE_Pulses();
+	REG_PWR_PRECHARGE.pulse_us=PRE_PulseWidth();
+	REG_PWR_PRECHARGE.peak_current=PeakCurrent;
+	REG_PWR_PRECHARGE.bus_voltage=BusVoltage;
+	REG_PWR_PRECHARGE.pack_voltage=pack_voltage();
+}
+
+//the higher of the battery voltages read over SMBus, 0 until one has been read
+static unsigned int pack_voltage(void)
+{
+	if(REG_SMART_BATTERY_A.voltage>REG_SMART_BATTERY_B.voltage)
+		return REG_SMART_BATTERY_A.voltage;
+	return REG_SMART_BATTERY_B.voltage;
+}
+
+static unsigned int limit_units(long units)
+{
+	if(units<0)
+		return 0;
+	if(units>0xffff)
+		return 0xffff;
+	return units;
+}
+
+//switch both cells on for us, Timer4 switches them off again however long the
+//main loop pass takes, and the A/D frames keep coming in meanwhile
+static void start_pulse(unsigned long us)
+{
+	T4CON=0x0010;//stops timer4,1:8 prescale,16 bit timer,internal clock (Fosc/2)
+	TMR4=0;
+	PR4=us*PowerBusPulseTicksPerUs-1;
+	T4InterruptUserFunction=end_pulse;
+	IFS1bits.T4IF=0;
+	PulseRunning=True;
+	Cell_Ctrl(Cell_A,Cell_ON);
+	Cell_Ctrl(Cell_B,Cell_ON);
+	IEC1bits.T4IE=1;
+	T4CONbits.TON=1;
+}
+
+//Timer4 interrupt
+static void end_pulse(void)
+{
+	Cell_Ctrl(Cell_A,Cell_OFF);
+	Cell_Ctrl(Cell_B,Cell_OFF);
+	T4CONbits.TON=0;
+	IEC1bits.T4IE=0;
+	IFS1bits.T4IF=0;
+	PulseRunning=False;
+}
+
+static void finish(int method)
+{
+	REG_PWR_BUS_BRINGUP.method=method;
+	REG_PWR_BUS_BRINGUP.state=State=PowerBusOn;
+}
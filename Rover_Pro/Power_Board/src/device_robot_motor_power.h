@@ -0,0 +1,69 @@
+//Power bus bring-up at boot.  PowerBusIni() only handles the cases where the bus
+//can be switched on right away (already on from the bootloader, or a warm reset).
+//Otherwise PowerBusUpdate(), called every 1ms from the main loop, identifies the
+//batteries by their SMBus device names through the I2C transaction queues and
+//then soft-starts the bus, one step per call, so the main loop and USB keep
+//running.  An identification attempt that times out or finds no known battery is
+//retried; after PowerBusIdentifyRetries the battery is taken as unknown.
+//The soft start is closed loop (closed_loop_control/Precharge.h): both cells are
+//pulsed on together while PowerBusSample() watches the bus voltage and the cell
+//currents in every A/D frame, the pulse width follows the inrush, and the cells are
+//left on once the bus is within PrechargeTolerance of the pack voltage read over
+//SMBus (or has settled, while no pack voltage has been read yet).  If that doesn't
+//happen within PrechargeMaxPulses or PrechargeTimeout, the fixed pulse pattern of
+//the battery (the hybrid one for an unknown battery) is used as the fallback.
+//Progress is published in REG_PWR_BUS_BRINGUP and REG_PWR_PRECHARGE.
+
+#define PowerBusIdentifyRetries 3 //same as POWER_BUS_DATA attempt entries
+#define PowerBusIdentifyTimeout 100 //ms per attempt
+#define PowerBusRetryDelay 20 //ms between attempts
+#define PowerBusNameCommand 0x21 //SBS DeviceName, a block read
+#define PowerBusNameLength 10 //the length byte and up to 9 characters
+
+//closed loop soft start, both cells together
+#define PrechargePulseMin 50 //us
+#define PrechargePulseMax 16000 //us, a pulse this long under the inrush limit ends the soft start
+#define PrechargePulseStart 500 //us
+#define PrechargeOffTime 10 //ms after each pulse, to measure the bus
+#define PrechargeInrushLimit 12000 //mA, both cells, well below the pack protection
+#define PrechargeMaxStep 2000 //mV of bus rise per pulse, bounds the charge of inrush too short to sample
+#define PrechargeTolerance 500 //mV from the pack voltage
+#define PrechargeMinBus 11000 //mV, while no pack voltage has been read
+#define PrechargeSettleRise 50 //mV per pulse, while no pack voltage has been read
+#define PrechargeSettlePulses 3
+#define PrechargeMaxPulses 300
+#define PrechargeTimeout 3000 //ms
+#define PowerBusPulseTicksPerUs 2 //TMR4 at Fcy/8, so a pulse can be up to 32ms
+
+//REG_PWR_BUS_BRINGUP.state
+#define PowerBusWaiting 0 //for the I2C queues to start
+#define PowerBusIdentifying 1
+#define PowerBusPulsing 2
+#define PowerBusOn 3
+
+//REG_PWR_BUS_BRINGUP.method
+#define PowerBusMethodNone 0
+#define PowerBusMethodAlreadyOn 1 //by the bootloader
+#define PowerBusMethodImmediate 2 //warm reset
+#define PowerBusMethodOld 3 //BB-2590, ROBOTEX
+#define PowerBusMethodNew 4 //BT-70791B, BT-70791C
+#define PowerBusMethodHybrid 5 //unknown battery, the fallback
+#define PowerBusMethodPrecharge 6 //closed loop, any battery
+
+//REG_PWR_PRECHARGE.result
+#define PrechargeNone 0
+#define PrechargeRunning 1
+#define PrechargeDone 2
+#define PrechargeFailed 3 //fell back to the fixed pulses of the battery
+
+//REG_PWR_BUS_BRINGUP.attempt_result
+#define PowerBusAttemptNone 0
+#define PowerBusAttemptIdentified 1
+#define PowerBusAttemptUnknown 2 //a battery answered with a name we don't know
+#define PowerBusAttemptNoAnswer 3 //no battery answered (NACK or bus timeout)
+#define PowerBusAttemptTimeout 4 //a read was still pending at PowerBusIdentifyTimeout
+
+void PowerBusIni(void);
+void PowerBusUpdate(unsigned long now);
+int PowerBusReady(void);
+void PowerBusSample(unsigned int voltage_a, unsigned int voltage_b, unsigned int current_a, unsigned int current_b);
@@ -0,0 +1,207 @@
+#include "p24FJ256GB106.h"
+#include "stdhdr.h"
+#include "device_robot_motor.h"
+#include "device_robot_motor_i2c.h"
+#include "device_robot_motor_poll.h"
+#include "device_robot_motor_smbus.h"
+
+typedef struct
+{
+	unsigned char command;
+	unsigned char poll;//index into REG_SMART_BATTERY_POLL
+	unsigned int default_period;//ms, nominal
+	int change;//see PollPolicy
+	int low;
+	int high;
+} SBSField;
+
+typedef struct
+{
+	unsigned char bus;
+	unsigned char field;//the field being read
+	unsigned char valid;//set by the completion callback when the PEC matched
+	unsigned char retried;
+	unsigned char data[3];//word, LSB first, then PEC
+	I2C_TRANSACTION t;
+	PollState poll[SBSFieldCount];
+	SMART_BATTERY_DATA *reg;
+} SBSBattery;
+
+static const SBSField SBSFields[SBSFieldCount]=
+{
+	{0x09,0,250,100,PollNoLow,PollNoHigh},//Voltage, mV
+	{0x0a,1,250,500,PollNoLow,PollNoHigh},//Current, mA
+	{0x0b,2,1000,250,PollNoLow,PollNoHigh},//AverageCurrent, mA
+	{0x08,3,2000,10,PollNoLow,3232},//Temperature, 0.1K, fast above 50C
+	{0x0d,4,250,2,15,PollNoHigh},//RelativeStateOfCharge, %
+	{0x0f,5,2000,100,PollNoLow,PollNoHigh},//RemainingCapacity, mAh
+	{0x10,6,10000,50,PollNoLow,PollNoHigh},//FullChargeCapacity, mAh
+	{0x17,7,60000,1,PollNoLow,PollNoHigh},//CycleCount
+	{0x16,8,500,1,PollNoLow,PollNoHigh},//BatteryStatus, any change
+	{0x3f,9,2000,50,3100,PollNoHigh},//CellVoltage1..4, mV, manufacturer commands of the TI gauges
+	{0x3e,9,2000,50,3100,PollNoHigh},
+	{0x3d,9,2000,50,3100,PollNoHigh},
+	{0x3c,9,2000,50,3100,PollNoHigh},
+};
+
+static SBSBattery SBSBatteries[2];
+
+static void sbs_read_done(I2C_TRANSACTION *t);
+static void sbs_policy(PollPolicy *p, int field);
+
+void SBSIni(void)
+{
+	SBSBattery *b;
+	int i,f;
+
+	for(i=Cell_A;i<=Cell_B;i++)
+	{
+		b=&SBSBatteries[i];
+		b->bus=(i==Cell_A)?2:3;
+		b->reg=(i==Cell_A)?&REG_SMART_BATTERY_A:&REG_SMART_BATTERY_B;
+		b->t.addr=SBSAddress;
+		b->t.flags=I2C_READ;
+		b->t.priority=I2C_PRIORITY_NORMAL;
+		b->t.data=b->data;
+		b->t.len=sizeof(b->data);
+		b->t.done=sbs_read_done;
+		//everything is read once right away
+		for(f=0;f<SBSFieldCount;f++)
+			PollIni(&b->poll[f]);
+	}
+}
+
+//call from the main loop with the time in ms
+void SBSUpdate(unsigned long now)
+{
+	unsigned long late,latest;
+	PollPolicy policy;
+	SBSBattery *b;
+	int i,f,field;
+
+	for(i=Cell_A;i<=Cell_B;i++)
+	{
+		b=&SBSBatteries[i];
+		if(b->t.status==I2C_STATUS_QUEUED || b->t.status==I2C_STATUS_ACTIVE)
+			continue;
+
+		//reschedule the field just read; a failed read is tried again right away, once
+		if(b->t.status!=I2C_STATUS_IDLE)
+		{
+			f=b->field;
+			sbs_policy(&policy,f);
+			if(b->valid)
+			{
+				PollReading(&b->poll[f],&policy,now,((int16_t *)b->reg)[f]);
+				b->retried=False;
+			}
+			else if(!b->retried)
+			{
+				b->retried=True;
+				b->poll[f].due=now;
+			}
+			else
+			{
+				PollFailed(&b->poll[f],&policy,now);
+				b->retried=False;
+			}
+		}
+		b->t.status=I2C_STATUS_IDLE;
+
+		//the most overdue field
+		field=-1;
+		latest=0;
+		for(f=0;f<SBSFieldCount;f++)
+		{
+			if(!PollDue(&b->poll[f],now))
+				continue;
+			late=now-b->poll[f].due;
+			if(field<0 || late>latest)
+			{
+				field=f;
+				latest=late;
+			}
+		}
+		if(field<0)
+			continue;
+
+		b->field=field;
+		b->valid=False;
+		b->t.reg=SBSFields[field].command;
+		//a battery the driver is backing off counts as a failed read
+		if(queueI2C(b->bus,&b->t)!=0)
+		{
+			sbs_policy(&policy,field);
+			PollFailed(&b->poll[field],&policy,now);
+		}
+	}
+}
+
+//the polling policy of a field, around its period in REG_SMART_BATTERY_POLL
+static void sbs_policy(PollPolicy *p, int field)
+{
+	uint16_t *period=(uint16_t *)&REG_SMART_BATTERY_POLL;
+	unsigned int nominal=period[SBSFields[field].poll];
+
+	if(nominal==0)
+		nominal=SBSFields[field].default_period;
+	PollScale(p,nominal);
+	p->change=SBSFields[field].change;
+	p->low=SBSFields[field].low;
+	p->high=SBSFields[field].high;
+}
+
+//SMBus packet error code, CRC-8 with the polynomial x^8+x^2+x+1
+unsigned char SBSPEC(unsigned char crc, const unsigned char *data, unsigned int length)
+{
+	int bit;
+
+	while(length--)
+	{
+		crc^=*data++;
+		for(bit=0;bit<8;bit++)
+			crc=(crc&0x80)?(crc<<1)^0x07:(crc<<1);
+	}
+	return crc;
+}
+
+//called from the I2C interrupt
+static void sbs_read_done(I2C_TRANSACTION *t)
+{
+	int i=(t==&SBSBatteries[Cell_A].t)?Cell_A:Cell_B;
+	SBSBattery *b=&SBSBatteries[i];
+	uint16_t *value=(uint16_t *)b->reg;
+	unsigned char header[3];
+	unsigned int word;
+
+	if(t->status!=I2C_STATUS_DONE)
+		return;
+
+	//the PEC covers both address bytes and the command as well as the data
+	header[0]=t->addr<<1;
+	header[1]=t->reg;
+	header[2]=(t->addr<<1)|1;
+	if(SBSPEC(SBSPEC(0,header,3),b->data,2)!=b->data[2])
+	{
+		b->reg->pec_errors++;
+		return;
+	}
+	b->valid=True;
+
+	word=b->data[0]+(b->data[1]<<8);
+	value[b->field]=word;
+
+	switch(b->field)
+	{
+		case SBSBatteryStatus:
+			b->reg->alarms|=word&SBSAlarmMask;
+			break;
+		case SBSRelativeSOC:
+			if(i==Cell_A)
+				REG_ROBOT_REL_SOC_A=word;
+			else
+				REG_ROBOT_REL_SOC_B=word;
+			BatterySOCReadings[i]++;
+			break;
+	}
+}
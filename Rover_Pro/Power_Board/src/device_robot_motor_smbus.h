@@ -0,0 +1,31 @@
+//Smart Battery Data (SBS 1.1) poller for the battery on I2C2 (Cell_A) and the one
+//on I2C3 (Cell_B).  Every field has its own nominal polling period
+//(REG_SMART_BATTERY_POLL, 0 selects the default) that device_robot_motor_poll.h
+//shortens while the field is changing or beyond a threshold and stretches while it
+//is static, and is read as an SMBus read word with PEC through the I2C transaction
+//queue, one read per battery at a time, the most overdue field first.
+//A read whose PEC doesn't match is thrown away, counted, and retried once.
+
+#define SBSAddress BATTERY_ADDRESS
+#define SBSFieldCount 13
+#define SBSCellCount 4
+
+//fields, in the order of the words in SMART_BATTERY_DATA
+#define SBSVoltage 0
+#define SBSCurrent 1
+#define SBSAverageCurrent 2
+#define SBSTemperature 3
+#define SBSRelativeSOC 4
+#define SBSRemainingCapacity 5
+#define SBSFullChargeCapacity 6
+#define SBSCycleCount 7
+#define SBSBatteryStatus 8
+#define SBSCellVoltage1 9 //to SBSCellVoltage1+SBSCellCount-1
+
+//BatteryStatus alarm bits: over charged, terminate charge, over temperature,
+//terminate discharge, remaining capacity, remaining time
+#define SBSAlarmMask 0xdb00
+
+void SBSIni(void);
+void SBSUpdate(unsigned long now);
+unsigned char SBSPEC(unsigned char crc, const unsigned char *data, unsigned int length);
@@ -0,0 +1,444 @@
+#include "p24FJ256GB106.h"
+#include "stdhdr.h"
+#include "device_robot_motor.h"
+#include "device_robot_motor_xbee.h"
+#include "register_service.h"
+#include "DEE Emulation 16-bit.h"
+#include "device_robot_motor_adc.h"
+#include "device_robot_motor_fan.h"
+#include "../closed_loop_control/FanCurve.h"
+#include "device_robot_motor_config.h"
+#include "../closed_loop_control/core/InputCapture.h"
+
+//the largest COBS frame: the payload and its CRC, a code byte for every 254 of
+//them and the code byte in front
+#define XbeeMaxFrame (XbeeMaxPayload+2+(XbeeMaxPayload+2)/254+1)
+
+static const unsigned int BuildNO=10009;
+
+//UART1 rings, the receive interrupt writes RxHead and the main loop RxTail, the
+//main loop writes TxHead and the transmit interrupt TxTail
+static unsigned char RxRing[XbeeRingLength];
+static volatile unsigned int RxHead=0,RxTail=0;
+static unsigned char TxRing[XbeeRingLength];
+static volatile unsigned int TxHead=0,TxTail=0;
+static volatile unsigned int RxOverruns=0;
+
+static unsigned char LegacyBuffer[XbeeLegacyLength];
+static int LegacyCount=-1;//-1 while waiting for XbeeStartByte
+
+static unsigned char FrameBuffer[XbeeMaxFrame];
+static unsigned int FrameLength=0;
+static int FrameOverflow=False;
+static int FramedSeen=False;
+static unsigned long LastFramed;
+
+static int framed_active(unsigned long now);
+static void legacy_byte(unsigned char data);
+static void framed_byte(unsigned char data, unsigned long now);
+static void handle_legacy(const unsigned char *frame);
+static void handle_framed(const unsigned char *payload, unsigned int length);
+static void run_command(unsigned char command, unsigned char parameter);
+static void send_telemetry(const unsigned char *ids, unsigned int count);
+static void send_registers(const unsigned char *request, unsigned int length);
+static void send_frame(const unsigned char *payload, unsigned int length);
+static int queue_tx(const unsigned char *data, unsigned int length);
+static int cobs_decode(const unsigned char *in, unsigned int length, unsigned char *out);
+static unsigned int cobs_encode(const unsigned char *in, unsigned int length, unsigned char *out);
+static unsigned int crc16(const unsigned char *data, unsigned int length);
+static int telemetry(unsigned int id, unsigned int *value);
+
+//call every pass of the main loop with the time in ms
+void XbeeUpdate(unsigned long now)
+{
+	unsigned char data;
+
+	while(RxTail!=RxHead)
+	{
+		data=RxRing[RxTail];
+		RxTail=(RxTail+1)&XbeeRingMask;
+		if(REG_XBEE_MODE!=XbeeModeFramed && !framed_active(now))
+			legacy_byte(data);
+		if(REG_XBEE_MODE!=XbeeModeLegacy)
+			framed_byte(data,now);
+	}
+
+	REG_XBEE_STATS.mode=framed_active(now)?XbeeModeFramed:XbeeModeLegacy;
+	REG_XBEE_STATS.rx_overruns=RxOverruns;
+}
+
+void XbeeRxInterrupt(void)
+{
+	unsigned int next;
+	unsigned char data;
+
+ 	//clear the flag
+ 	IFS0bits.U1RXIF=0;
+	while(U1STAbits.URXDA)
+	{
+		data=U1RXREG;
+		next=(RxHead+1)&XbeeRingMask;
+		if(next==RxTail)
+		{
+			RxOverruns++;
+			continue;
+		}
+		RxRing[RxHead]=data;
+		RxHead=next;
+	}
+	//the UART stops receiving until an overrun is cleared, which also empties its FIFO
+	if(U1STAbits.OERR)
+	{
+		U1STAbits.OERR=0;
+		RxOverruns++;
+	}
+}
+
+void XbeeTxInterrupt(void)
+{
+ 	//clear the flag
+ 	IFS0bits.U1TXIF=0;
+	while(!U1STAbits.UTXBF && TxTail!=TxHead)
+	{
+		U1TXREG=TxRing[TxTail];
+		TxTail=(TxTail+1)&XbeeRingMask;
+	}
+	//queue_tx() turns it back on
+	if(TxTail==TxHead)
+		IEC0bits.U1TXIE=0;
+}
+
+static int framed_active(unsigned long now)
+{
+	if(REG_XBEE_MODE==XbeeModeFramed)
+		return True;
+	if(REG_XBEE_MODE==XbeeModeLegacy)
+		return False;
+	return FramedSeen && now-LastFramed<XbeeFramedHold;
+}
+
+static void legacy_byte(unsigned char data)
+{
+	unsigned int sum;
+	int i;
+
+	if(LegacyCount<0)
+	{
+		if(data==XbeeStartByte)
+			LegacyCount=0;
+		return;
+	}
+	LegacyBuffer[LegacyCount++]=data;
+	if(LegacyCount<XbeeLegacyLength)
+		return;
+	LegacyCount=-1;
+
+	//if all bytes add up together equals 255, it is a good pack, then process
+	sum=0;
+	for(i=0;i<XbeeLegacyLength;i++)
+		sum+=LegacyBuffer[i];
+	if(sum%255==0)
+		handle_legacy(LegacyBuffer);
+}
+
+static void framed_byte(unsigned char data, unsigned long now)
+{
+	unsigned char payload[XbeeMaxFrame];
+	int length;
+	int counted=framed_active(now);
+
+	if(data!=0)
+	{
+		if(FrameLength<XbeeMaxFrame)
+			FrameBuffer[FrameLength++]=data;
+		else
+			FrameOverflow=True;
+		return;
+	}
+
+	//the end of a frame
+	if(FrameLength==0)
+		return;
+	length=FrameOverflow?-1:cobs_decode(FrameBuffer,FrameLength,payload);
+	FrameLength=0;
+	FrameOverflow=False;
+	//while the legacy protocol is in use its bytes often look like broken frames
+	if(length<3)
+	{
+		if(counted)
+			REG_XBEE_STATS.framing_errors++;
+		return;
+	}
+	length-=2;
+	if(crc16(payload,length)!=(((unsigned int)payload[length]<<8)|payload[length+1]))
+	{
+		if(counted)
+			REG_XBEE_STATS.crc_errors++;
+		return;
+	}
+
+	//in auto mode only a read switches to framed, see device_robot_motor_xbee.h
+	if(!counted && payload[0]!=XbeeMsgRead)
+		return;
+	FramedSeen=True;
+	LastFramed=now;
+	REG_XBEE_STATS.frames++;
+	handle_framed(payload,length);
+}
+
+static void handle_legacy(const unsigned char *frame)
+{
+	unsigned char reply[5];
+	unsigned int value=0;
+	int i;
+
+	REG_XBEE_STATS.legacy_frames++;
+	//input data range 0~250, 125 is stop, 0 is backwards full speed, 250 is forward full speed
+	for(i=0;i<3;i++)
+		Xbee_MOTOR_VELOCITY[i]=frame[i]*8-1000;
+	run_command(frame[3],frame[4]);
+
+	if(frame[3]==P1_Read_Register)
+	{
+		telemetry(frame[4]%60,&value);
+		reply[0]=XbeeStartByte;
+		reply[1]=frame[4];
+		reply[2]=value>>8;
+		reply[3]=value;
+		reply[4]=255-(reply[1]+reply[2]+reply[3])%255;
+		queue_tx(reply,sizeof(reply));
+	}
+	Xbee_gNewData=!Xbee_gNewData;
+}
+
+static void handle_framed(const unsigned char *payload, unsigned int length)
+{
+	int speed;
+	int i;
+
+	switch(payload[0])
+	{
+		case XbeeMsgDrive:
+			if(length<7)
+				break;
+			for(i=0;i<3;i++)
+			{
+				speed=(int16_t)(((unsigned int)payload[1+2*i]<<8)|payload[2+2*i]);
+				if(speed>1000)
+					speed=1000;
+				else if(speed<-1000)
+					speed=-1000;
+				Xbee_MOTOR_VELOCITY[i]=speed;
+			}
+			Xbee_gNewData=!Xbee_gNewData;
+			if(length>7)
+				send_telemetry(&payload[7],length-7);
+			return;
+		case XbeeMsgCommand:
+			if(length<3)
+				break;
+			run_command(payload[1],payload[2]);
+			return;
+		case XbeeMsgRead:
+			send_telemetry(&payload[1],length-1);
+			return;
+		case XbeeMsgRegisters:
+			send_registers(&payload[1],length-1);
+			return;
+	}
+	REG_XBEE_STATS.bad_messages++;
+}
+
+static void run_command(unsigned char command, unsigned char parameter)
+{
+	switch(command)
+	{
+		case P1_Fan_Command: //new fan command coming in
+			Xbee_SIDE_FAN_SPEED=parameter;
+			Xbee_SIDE_FAN_NEW=1;
+			//Enable fan speed timer
+			Xbee_FanSpeedTimerEnabled=True;
+			Xbee_FanSpeedTimerCount=0;
+			break;
+		case P1_Low_Speed_Set:
+			Xbee_Low_Speed_mode=parameter;
+			break;
+		case P1_Calibration_Flipper:
+			if(parameter==P1_Calibration_Flipper)
+				Xbee_Calibration=1;
+			break;
+		case P1_Restart:
+			//settings not yet stored, or still queued for DEE, would be lost; the
+			//first flush makes room for the save
+			DataEEFlush();
+			ConfigSave();
+			DataEEFlush();
+			asm volatile("RESET");
+			break;
+	}
+}
+
+static void send_telemetry(const unsigned char *ids, unsigned int count)
+{
+	unsigned char reply[XbeeMaxPayload];
+	unsigned int length=1;
+	unsigned int value;
+	unsigned int i;
+
+	reply[0]=XbeeMsgTelemetry;
+	for(i=0;i<count && length+3<=XbeeMaxPayload;i++)
+	{
+		if(!telemetry(ids[i],&value))
+			continue;
+		reply[length++]=ids[i];
+		reply[length++]=value>>8;
+		reply[length++]=value;
+	}
+	send_frame(reply,length);
+}
+
+//the same requests as USB, see register_service.h
+static void send_registers(const unsigned char *request, unsigned int length)
+{
+	unsigned char reply[XbeeMaxPayload];
+	unsigned int reply_length;
+
+	reply[0]=XbeeMsgRegistersReply;
+	reply_length=RegisterService(RegTransportXbee,request,length,&reply[1],XbeeMaxPayload-1);
+	if(reply_length)
+		send_frame(reply,reply_length+1);
+}
+
+static void send_frame(const unsigned char *payload, unsigned int length)
+{
+	unsigned char data[XbeeMaxPayload+2];
+	unsigned char frame[XbeeMaxFrame+1];
+	unsigned int crc=crc16(payload,length);
+	unsigned int i;
+
+	for(i=0;i<length;i++)
+		data[i]=payload[i];
+	data[length]=crc>>8;
+	data[length+1]=crc;
+	length=cobs_encode(data,length+2,frame);
+	frame[length++]=0;
+	queue_tx(frame,length);
+}
+
+//a frame that doesn't fit is dropped whole, the transmit interrupt is never waited for
+static int queue_tx(const unsigned char *data, unsigned int length)
+{
+	unsigned int i;
+
+	if(((TxTail-TxHead-1)&XbeeRingMask)<length)
+	{
+		REG_XBEE_STATS.tx_overruns++;
+		return False;
+	}
+	for(i=0;i<length;i++)
+	{
+		TxRing[TxHead]=data[i];
+		TxHead=(TxHead+1)&XbeeRingMask;
+	}
+	IEC0bits.U1TXIE=1;
+	IFS0bits.U1TXIF=1;
+	return True;
+}
+
+//returns the decoded length, or -1 if the frame is broken
+static int cobs_decode(const unsigned char *in, unsigned int length, unsigned char *out)
+{
+	unsigned int i=0,o=0;
+	unsigned char code,j;
+
+	while(i<length)
+	{
+		code=in[i++];
+		for(j=1;j<code;j++)
+		{
+			if(i>=length)
+				return -1;
+			out[o++]=in[i++];
+		}
+		if(code<0xff && i<length)
+			out[o++]=0;
+	}
+	return o;
+}
+
+//returns the encoded length, without the 0 that ends the frame
+static unsigned int cobs_encode(const unsigned char *in, unsigned int length, unsigned char *out)
+{
+	unsigned int i,o=1,code_at=0;
+	unsigned char code=1;
+
+	for(i=0;i<length;i++)
+	{
+		if(in[i]!=0)
+		{
+			out[o++]=in[i];
+			code++;
+		}
+		if(in[i]==0 || code==0xff)
+		{
+			out[code_at]=code;
+			code_at=o++;
+			code=1;
+		}
+	}
+	out[code_at]=code;
+	return o;
+}
+
+//CRC-16/CCITT, 0xffff first
+static unsigned int crc16(const unsigned char *data, unsigned int length)
+{
+	uint16_t crc=0xffff;
+	unsigned int i;
+	int bit;
+
+	for(i=0;i<length;i++)
+	{
+		crc^=(unsigned int)data[i]<<8;
+		for(bit=0;bit<8;bit++)
+			crc=(crc&0x8000)?(crc<<1)^0x1021:crc<<1;
+	}
+	return crc;
+}
+
+//the value with a legacy telemetry id, False if there is none
+static int telemetry(unsigned int id, unsigned int *value)
+{
+	switch(id)
+	{
+		case 0: *value=REG_PWR_TOTAL_CURRENT; break;
+		case 2: *value=REG_MOTOR_FB_RPM.left; break;
+		case 4: *value=REG_MOTOR_FB_RPM.right; break;
+		case 6: *value=REG_FLIPPER_FB_POSITION.pot1; break;
+		case 8: *value=REG_FLIPPER_FB_POSITION.pot2; break;
+		case 10: *value=REG_MOTOR_FB_CURRENT.left; break;
+		case 12: *value=REG_MOTOR_FB_CURRENT.right; break;
+		case 14: *value=REG_MOTOR_ENCODER_COUNT.left; break;
+		case 16: *value=REG_MOTOR_ENCODER_COUNT.right; break;
+		case 18: *value=((unsigned int)(unsigned char)REG_MOTOR_FAULT_FLAG.left<<8)|(unsigned char)REG_MOTOR_FAULT_FLAG.right; break;
+		case 20: *value=REG_MOTOR_TEMP.left; break;
+		case 22: *value=REG_MOTOR_TEMP.right; break;
+		case 24: *value=REG_PWR_BAT_VOLTAGE.a; break;
+		case 26: *value=REG_PWR_BAT_VOLTAGE.b; break;
+		//encoder time intervals, 16us per count
+		case 28: *value=IC_period(kIC01); break;
+		case 30: *value=IC_period(kIC02); break;
+		case 32: *value=IC_period(kIC03); break;
+		case 34: *value=REG_ROBOT_REL_SOC_A; break;
+		case 36: *value=REG_ROBOT_REL_SOC_B; break;
+		case 38: *value=REG_MOTOR_CHARGER_STATE; break;
+		case 40: *value=BuildNO; break;
+		case 42: *value=REG_PWR_A_CURRENT; break;
+		case 44: *value=REG_PWR_B_CURRENT; break;
+		case 46: *value=REG_MOTOR_FLIPPER_ANGLE; break;
+		case 48: *value=Xbee_SIDE_FAN_SPEED; break;
+		case 50: *value=Xbee_Low_Speed_mode; break;
+		default: return False;
+	}
+	return True;
+}
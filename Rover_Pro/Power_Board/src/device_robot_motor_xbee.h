@@ -0,0 +1,64 @@
+//Xbee radio link on UART1.  The UART interrupts only move bytes between the UART
+//and two lock-free rings (the interrupt is the only writer of one end, the main
+//loop of the other, like the A/D ring); XbeeUpdate(), called every pass of the main
+//loop, parses what came in and queues the replies.
+//
+//Two protocols share the link:
+//  - legacy, the one the old OCU speaks: XbeeStartByte, then left, right and
+//    flipper speed (0-250, 125 is stop), a command, its parameter and a byte that
+//    brings the sum of the six to a multiple of 255.  P1_Read_Register asks for the
+//    telemetry value with the id in the parameter, which is answered with
+//    XbeeStartByte, the parameter, the value (high byte first) and a checksum.
+//  - framed: payloads of up to XbeeMaxPayload bytes followed by their CRC-16
+//    (CCITT, 0xffff first, high byte first), COBS encoded and ended by a 0 byte.
+//    A host that spoke the legacy protocol first should also send a 0 before its
+//    first frame, to end whatever the legacy bytes left behind.
+//    The first byte of a payload is the message, values are int16 high byte first:
+//      XbeeMsgDrive      left, right, flipper (-1000 to 1000), then any number of
+//                        telemetry ids, answered by one XbeeMsgTelemetry
+//      XbeeMsgCommand    a P1_ command and its parameter
+//      XbeeMsgRead       telemetry ids, answered by one XbeeMsgTelemetry
+//      XbeeMsgRegisters  a register request, byte for byte as over USB (so low byte
+//                        first, see register_service.h), answered by one
+//                        XbeeMsgRegistersReply holding the reply USB would send
+//      XbeeMsgTelemetry  id and value pairs, ids it doesn't know are left out
+//    The telemetry ids are the legacy ones.
+//In XbeeModeAuto (REG_XBEE_MODE 0) both are parsed until a good XbeeMsgRead
+//arrives; legacy frames are then ignored until XbeeFramedHold passes without a good
+//framed message.  Until then every other framed message is dropped: now and then
+//legacy bytes make a frame that passes the CRC, and it must not drive the motors or
+//restart the board.  So a host starts with XbeeMsgRead, and starts over with it
+//after a pause of XbeeFramedHold.
+//Counters are published in REG_XBEE_STATS.
+
+#define XbeeRingLength 256 //must be a power of two
+#define XbeeRingMask (XbeeRingLength-1)
+#define XbeeMaxPayload 96
+#define XbeeFramedHold 2000 //ms
+
+#define XbeeStartByte 253
+#define XbeeLegacyLength 6
+
+//framed messages
+#define XbeeMsgDrive 0x01
+#define XbeeMsgCommand 0x02
+#define XbeeMsgRead 0x03
+#define XbeeMsgRegisters 0x04
+#define XbeeMsgTelemetry 0x81
+#define XbeeMsgRegistersReply 0x84
+
+//REG_XBEE_MODE, and REG_XBEE_STATS.mode for the protocol in use
+#define XbeeModeAuto 0
+#define XbeeModeLegacy 1
+#define XbeeModeFramed 2
+
+//commands, in both protocols
+#define P1_Read_Register 10
+#define P1_Fan_Command 20
+#define P1_Low_Speed_Set 240
+#define P1_Calibration_Flipper 250
+#define P1_Restart 230
+
+void XbeeUpdate(unsigned long now);
+void XbeeRxInterrupt(void);
+void XbeeTxInterrupt(void);
@@ -1,10522 +1,10522 @@
-/*-------------------------------------------------------------------------
- * MPLAB-Cxx  PIC24FJ256GB106 processor header
- *
- * (c) Copyright 1999-2010 Microchip Technology, All rights reserved
- *-------------------------------------------------------------------------*/
-
-#ifndef __PIC24FJ256GB106__
-#error "Include file does not match processor setting"
-#endif
-
-#ifndef __24FJ256GB106_H
-#define __24FJ256GB106_H
-
-extern volatile unsigned int  WREG0 __attribute__((__sfr__,__deprecated__,__unsafe__));
-extern volatile unsigned int  WREG1 __attribute__((__sfr__,__deprecated__,__unsafe__));
-extern volatile unsigned int  WREG2 __attribute__((__sfr__,__deprecated__,__unsafe__));
-extern volatile unsigned int  WREG3 __attribute__((__sfr__,__deprecated__,__unsafe__));
-extern volatile unsigned int  WREG4 __attribute__((__sfr__,__deprecated__,__unsafe__));
-extern volatile unsigned int  WREG5 __attribute__((__sfr__,__deprecated__,__unsafe__));
-extern volatile unsigned int  WREG6 __attribute__((__sfr__,__deprecated__,__unsafe__));
-extern volatile unsigned int  WREG7 __attribute__((__sfr__,__deprecated__,__unsafe__));
-extern volatile unsigned int  WREG8 __attribute__((__sfr__,__deprecated__,__unsafe__));
-extern volatile unsigned int  WREG9 __attribute__((__sfr__,__deprecated__,__unsafe__));
-extern volatile unsigned int  WREG10 __attribute__((__sfr__,__deprecated__,__unsafe__));
-extern volatile unsigned int  WREG11 __attribute__((__sfr__,__deprecated__,__unsafe__));
-extern volatile unsigned int  WREG12 __attribute__((__sfr__,__deprecated__,__unsafe__));
-extern volatile unsigned int  WREG13 __attribute__((__sfr__,__deprecated__,__unsafe__));
-extern volatile unsigned int  WREG14 __attribute__((__sfr__,__deprecated__,__unsafe__));
-extern volatile unsigned int  WREG15 __attribute__((__sfr__,__deprecated__,__unsafe__));
-extern volatile unsigned int  SPLIM __attribute__((__sfr__));
-extern volatile unsigned int  PCL __attribute__((__sfr__));
-extern volatile unsigned int  PCH __attribute__((__sfr__));
-extern volatile unsigned int  TBLPAG __attribute__((__sfr__));
-extern volatile unsigned int  PSVPAG __attribute__((__sfr__));
-extern volatile unsigned int  RCOUNT __attribute__((__sfr__));
-extern volatile unsigned int  SR __attribute__((__sfr__));
-__extension__ typedef struct tagSRBITS {
-  union {
-    struct {
-      unsigned C:1;
-      unsigned Z:1;
-      unsigned OV:1;
-      unsigned N:1;
-      unsigned RA:1;
-      unsigned IPL0:1;
-      unsigned IPL1:1;
-      unsigned IPL2:1;
-      unsigned DC:1;
-    };
-    struct {
-      unsigned :5;
-      unsigned IPL:3;
-    };
-  };
-} SRBITS;
-extern volatile SRBITS SRbits __attribute__((__sfr__));
-
-extern volatile unsigned int  CORCON __attribute__((__sfr__));
-typedef struct tagCORCONBITS {
-  unsigned :2;
-  unsigned PSV:1;
-  unsigned IPL3:1;
-} CORCONBITS;
-extern volatile CORCONBITS CORCONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  DISICNT __attribute__((__sfr__));
-extern volatile unsigned int  CNPD1 __attribute__((__sfr__));
-typedef struct tagCNPD1BITS {
-  unsigned CN0PDE:1;
-  unsigned CN1PDE:1;
-  unsigned CN2PDE:1;
-  unsigned CN3PDE:1;
-  unsigned CN4PDE:1;
-  unsigned CN5PDE:1;
-  unsigned CN6PDE:1;
-  unsigned CN7PDE:1;
-  unsigned CN8PDE:1;
-  unsigned CN9PDE:1;
-  unsigned CN10PDE:1;
-  unsigned CN11PDE:1;
-  unsigned CN12PDE:1;
-  unsigned CN13PDE:1;
-  unsigned CN14PDE:1;
-  unsigned CN15PDE:1;
-} CNPD1BITS;
-extern volatile CNPD1BITS CNPD1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  CNPD2 __attribute__((__sfr__));
-typedef struct tagCNPD2BITS {
-  unsigned CN16PDE:1;
-  unsigned CN17PDE:1;
-  unsigned CN18PDE:1;
-  unsigned :3;
-  unsigned CN22PDE:1;
-  unsigned CN23PDE:1;
-  unsigned CN24PDE:1;
-  unsigned CN25PDE:1;
-  unsigned CN26PDE:1;
-  unsigned CN27PDE:1;
-  unsigned CN28PDE:1;
-  unsigned CN29PDE:1;
-  unsigned CN30PDE:1;
-  unsigned CN31PDE:1;
-} CNPD2BITS;
-extern volatile CNPD2BITS CNPD2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  CNPD3 __attribute__((__sfr__));
-typedef struct tagCNPD3BITS {
-  unsigned CN32PDE:1;
-} CNPD3BITS;
-extern volatile CNPD3BITS CNPD3bits __attribute__((__sfr__));
-
-extern volatile unsigned int  CNPD4 __attribute__((__sfr__));
-typedef struct tagCNPD4BITS {
-  unsigned :1;
-  unsigned CN49PDE:1;
-  unsigned CN50PDE:1;
-  unsigned CN51PDE:1;
-  unsigned CN52PDE:1;
-  unsigned CN53PDE:1;
-  unsigned CN54PDE:1;
-  unsigned CN55PDE:1;
-  unsigned CN56PDE:1;
-  unsigned :1;
-  unsigned CN58PDE:1;
-  unsigned CN59PDE:1;
-  unsigned CN60PDE:1;
-  unsigned CN61PDE:1;
-  unsigned CN62PDE:1;
-  unsigned CN63PDE:1;
-} CNPD4BITS;
-extern volatile CNPD4BITS CNPD4bits __attribute__((__sfr__));
-
-extern volatile unsigned int  CNPD5 __attribute__((__sfr__));
-typedef struct tagCNPD5BITS {
-  unsigned CN64PDE:1;
-  unsigned CN65PDE:1;
-  unsigned :2;
-  unsigned CN68PDE:1;
-  unsigned CN69PDE:1;
-  unsigned :1;
-  unsigned CN71PDE:1;
-} CNPD5BITS;
-extern volatile CNPD5BITS CNPD5bits __attribute__((__sfr__));
-
-extern volatile unsigned int  CNEN1 __attribute__((__sfr__));
-typedef struct tagCNEN1BITS {
-  unsigned CN0IE:1;
-  unsigned CN1IE:1;
-  unsigned CN2IE:1;
-  unsigned CN3IE:1;
-  unsigned CN4IE:1;
-  unsigned CN5IE:1;
-  unsigned CN6IE:1;
-  unsigned CN7IE:1;
-  unsigned CN8IE:1;
-  unsigned CN9IE:1;
-  unsigned CN10IE:1;
-  unsigned CN11IE:1;
-  unsigned CN12IE:1;
-  unsigned CN13IE:1;
-  unsigned CN14IE:1;
-  unsigned CN15IE:1;
-} CNEN1BITS;
-extern volatile CNEN1BITS CNEN1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  CNEN2 __attribute__((__sfr__));
-typedef struct tagCNEN2BITS {
-  unsigned CN16IE:1;
-  unsigned CN17IE:1;
-  unsigned CN18IE:1;
-  unsigned :3;
-  unsigned CN22IE:1;
-  unsigned CN23IE:1;
-  unsigned CN24IE:1;
-  unsigned CN25IE:1;
-  unsigned CN26IE:1;
-  unsigned CN27IE:1;
-  unsigned CN28IE:1;
-  unsigned CN29IE:1;
-  unsigned CN30IE:1;
-  unsigned CN31IE:1;
-} CNEN2BITS;
-extern volatile CNEN2BITS CNEN2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  CNEN3 __attribute__((__sfr__));
-typedef struct tagCNEN3BITS {
-  unsigned CN32IE:1;
-} CNEN3BITS;
-extern volatile CNEN3BITS CNEN3bits __attribute__((__sfr__));
-
-extern volatile unsigned int  CNEN4 __attribute__((__sfr__));
-typedef struct tagCNEN4BITS {
-  unsigned :1;
-  unsigned CN49IE:1;
-  unsigned CN50IE:1;
-  unsigned CN51IE:1;
-  unsigned CN52IE:1;
-  unsigned CN53IE:1;
-  unsigned CN54IE:1;
-  unsigned CN55IE:1;
-  unsigned CN56IE:1;
-  unsigned :1;
-  unsigned CN58IE:1;
-  unsigned CN59IE:1;
-  unsigned CN60IE:1;
-  unsigned CN61IE:1;
-  unsigned CN62IE:1;
-  unsigned CN63IE:1;
-} CNEN4BITS;
-extern volatile CNEN4BITS CNEN4bits __attribute__((__sfr__));
-
-extern volatile unsigned int  CNEN5 __attribute__((__sfr__));
-typedef struct tagCNEN5BITS {
-  unsigned CN64IE:1;
-  unsigned CN65IE:1;
-  unsigned :2;
-  unsigned CN68IE:1;
-  unsigned CN69IE:1;
-  unsigned :1;
-  unsigned CN71IE:1;
-} CNEN5BITS;
-extern volatile CNEN5BITS CNEN5bits __attribute__((__sfr__));
-
-extern volatile unsigned int  CNPU1 __attribute__((__sfr__));
-typedef struct tagCNPU1BITS {
-  unsigned CN0PUE:1;
-  unsigned CN1PUE:1;
-  unsigned CN2PUE:1;
-  unsigned CN3PUE:1;
-  unsigned CN4PUE:1;
-  unsigned CN5PUE:1;
-  unsigned CN6PUE:1;
-  unsigned CN7PUE:1;
-  unsigned CN8PUE:1;
-  unsigned CN9PUE:1;
-  unsigned CN10PUE:1;
-  unsigned CN11PUE:1;
-  unsigned CN12PUE:1;
-  unsigned CN13PUE:1;
-  unsigned CN14PUE:1;
-  unsigned CN15PUE:1;
-} CNPU1BITS;
-extern volatile CNPU1BITS CNPU1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  CNPU2 __attribute__((__sfr__));
-typedef struct tagCNPU2BITS {
-  unsigned CN16PUE:1;
-  unsigned CN17PUE:1;
-  unsigned CN18PUE:1;
-  unsigned :3;
-  unsigned CN22PUE:1;
-  unsigned CN23PUE:1;
-  unsigned CN24PUE:1;
-  unsigned CN25PUE:1;
-  unsigned CN26PUE:1;
-  unsigned CN27PUE:1;
-  unsigned CN28PUE:1;
-  unsigned CN29PUE:1;
-  unsigned CN30PUE:1;
-  unsigned CN31PUE:1;
-} CNPU2BITS;
-extern volatile CNPU2BITS CNPU2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  CNPU3 __attribute__((__sfr__));
-typedef struct tagCNPU3BITS {
-  unsigned CN32PUE:1;
-} CNPU3BITS;
-extern volatile CNPU3BITS CNPU3bits __attribute__((__sfr__));
-
-extern volatile unsigned int  CNPU4 __attribute__((__sfr__));
-typedef struct tagCNPU4BITS {
-  unsigned :1;
-  unsigned CN49PUE:1;
-  unsigned CN50PUE:1;
-  unsigned CN51PUE:1;
-  unsigned CN52PUE:1;
-  unsigned CN53PUE:1;
-  unsigned CN54PUE:1;
-  unsigned CN55PUE:1;
-  unsigned CN56PUE:1;
-  unsigned :1;
-  unsigned CN58PUE:1;
-  unsigned CN59PUE:1;
-  unsigned CN60PUE:1;
-  unsigned CN61PUE:1;
-  unsigned CN62PUE:1;
-  unsigned CN63PUE:1;
-} CNPU4BITS;
-extern volatile CNPU4BITS CNPU4bits __attribute__((__sfr__));
-
-extern volatile unsigned int  CNPU5 __attribute__((__sfr__));
-typedef struct tagCNPU5BITS {
-  unsigned CN64PUE:1;
-  unsigned CN65PUE:1;
-  unsigned :2;
-  unsigned CN68PUE:1;
-  unsigned CN69PUE:1;
-  unsigned :1;
-  unsigned CN71PUE:1;
-} CNPU5BITS;
-extern volatile CNPU5BITS CNPU5bits __attribute__((__sfr__));
-
-extern volatile unsigned int  INTCON1 __attribute__((__sfr__));
-typedef struct tagINTCON1BITS {
-  unsigned :1;
-  unsigned OSCFAIL:1;
-  unsigned STKERR:1;
-  unsigned ADDRERR:1;
-  unsigned MATHERR:1;
-  unsigned :10;
-  unsigned NSTDIS:1;
-} INTCON1BITS;
-extern volatile INTCON1BITS INTCON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  INTCON2 __attribute__((__sfr__));
-typedef struct tagINTCON2BITS {
-  unsigned INT0EP:1;
-  unsigned INT1EP:1;
-  unsigned INT2EP:1;
-  unsigned INT3EP:1;
-  unsigned INT4EP:1;
-  unsigned :9;
-  unsigned DISI:1;
-  unsigned ALTIVT:1;
-} INTCON2BITS;
-extern volatile INTCON2BITS INTCON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IFS0 __attribute__((__sfr__));
-typedef struct tagIFS0BITS {
-  unsigned INT0IF:1;
-  unsigned IC1IF:1;
-  unsigned OC1IF:1;
-  unsigned T1IF:1;
-  unsigned :1;
-  unsigned IC2IF:1;
-  unsigned OC2IF:1;
-  unsigned T2IF:1;
-  unsigned T3IF:1;
-  unsigned SPF1IF:1;
-  unsigned SPI1IF:1;
-  unsigned U1RXIF:1;
-  unsigned U1TXIF:1;
-  unsigned AD1IF:1;
-} IFS0BITS;
-extern volatile IFS0BITS IFS0bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IFS1 __attribute__((__sfr__));
-typedef struct tagIFS1BITS {
-  unsigned SI2C1IF:1;
-  unsigned MI2C1IF:1;
-  unsigned CMIF:1;
-  unsigned CNIF:1;
-  unsigned INT1IF:1;
-  unsigned :1;
-  unsigned IC7IF:1;
-  unsigned IC8IF:1;
-  unsigned :1;
-  unsigned OC3IF:1;
-  unsigned OC4IF:1;
-  unsigned T4IF:1;
-  unsigned T5IF:1;
-  unsigned INT2IF:1;
-  unsigned U2RXIF:1;
-  unsigned U2TXIF:1;
-} IFS1BITS;
-extern volatile IFS1BITS IFS1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IFS2 __attribute__((__sfr__));
-typedef struct tagIFS2BITS {
-  unsigned SPF2IF:1;
-  unsigned SPI2IF:1;
-  unsigned :3;
-  unsigned IC3IF:1;
-  unsigned IC4IF:1;
-  unsigned IC5IF:1;
-  unsigned IC6IF:1;
-  unsigned OC5IF:1;
-  unsigned OC6IF:1;
-  unsigned OC7IF:1;
-  unsigned OC8IF:1;
-  unsigned PMPIF:1;
-} IFS2BITS;
-extern volatile IFS2BITS IFS2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IFS3 __attribute__((__sfr__));
-typedef struct tagIFS3BITS {
-  unsigned :1;
-  unsigned SI2C2IF:1;
-  unsigned MI2C2IF:1;
-  unsigned :2;
-  unsigned INT3IF:1;
-  unsigned INT4IF:1;
-  unsigned :7;
-  unsigned RTCIF:1;
-} IFS3BITS;
-extern volatile IFS3BITS IFS3bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IFS4 __attribute__((__sfr__));
-typedef struct tagIFS4BITS {
-  unsigned :1;
-  unsigned U1ERIF:1;
-  unsigned U2ERIF:1;
-  unsigned CRCIF:1;
-  unsigned :4;
-  unsigned LVDIF:1;
-  unsigned :4;
-  unsigned CTMUIF:1;
-} IFS4BITS;
-extern volatile IFS4BITS IFS4bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IFS5 __attribute__((__sfr__));
-typedef struct tagIFS5BITS {
-  unsigned :1;
-  unsigned U3ERIF:1;
-  unsigned U3RXIF:1;
-  unsigned U3TXIF:1;
-  unsigned SI2C3IF:1;
-  unsigned MI2C3IF:1;
-  unsigned USB1IF:1;
-  unsigned U4ERIF:1;
-  unsigned U4RXIF:1;
-  unsigned U4TXIF:1;
-  unsigned SPF3IF:1;
-  unsigned SPI3IF:1;
-  unsigned OC9IF:1;
-  unsigned IC9IF:1;
-} IFS5BITS;
-extern volatile IFS5BITS IFS5bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IEC0 __attribute__((__sfr__));
-typedef struct tagIEC0BITS {
-  unsigned INT0IE:1;
-  unsigned IC1IE:1;
-  unsigned OC1IE:1;
-  unsigned T1IE:1;
-  unsigned :1;
-  unsigned IC2IE:1;
-  unsigned OC2IE:1;
-  unsigned T2IE:1;
-  unsigned T3IE:1;
-  unsigned SPF1IE:1;
-  unsigned SPI1IE:1;
-  unsigned U1RXIE:1;
-  unsigned U1TXIE:1;
-  unsigned AD1IE:1;
-} IEC0BITS;
-extern volatile IEC0BITS IEC0bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IEC1 __attribute__((__sfr__));
-typedef struct tagIEC1BITS {
-  unsigned SI2C1IE:1;
-  unsigned MI2C1IE:1;
-  unsigned CMIE:1;
-  unsigned CNIE:1;
-  unsigned INT1IE:1;
-  unsigned :1;
-  unsigned IC7IE:1;
-  unsigned IC8IE:1;
-  unsigned :1;
-  unsigned OC3IE:1;
-  unsigned OC4IE:1;
-  unsigned T4IE:1;
-  unsigned T5IE:1;
-  unsigned INT2IE:1;
-  unsigned U2RXIE:1;
-  unsigned U2TXIE:1;
-} IEC1BITS;
-extern volatile IEC1BITS IEC1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IEC2 __attribute__((__sfr__));
-typedef struct tagIEC2BITS {
-  unsigned SPF2IE:1;
-  unsigned SPI2IE:1;
-  unsigned :3;
-  unsigned IC3IE:1;
-  unsigned IC4IE:1;
-  unsigned IC5IE:1;
-  unsigned IC6IE:1;
-  unsigned OC5IE:1;
-  unsigned OC6IE:1;
-  unsigned OC7IE:1;
-  unsigned OC8IE:1;
-  unsigned PMPIE:1;
-} IEC2BITS;
-extern volatile IEC2BITS IEC2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IEC3 __attribute__((__sfr__));
-typedef struct tagIEC3BITS {
-  unsigned :1;
-  unsigned SI2C2IE:1;
-  unsigned MI2C2IE:1;
-  unsigned :2;
-  unsigned INT3IE:1;
-  unsigned INT4IE:1;
-  unsigned :7;
-  unsigned RTCIE:1;
-} IEC3BITS;
-extern volatile IEC3BITS IEC3bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IEC4 __attribute__((__sfr__));
-typedef struct tagIEC4BITS {
-  unsigned :1;
-  unsigned U1ERIE:1;
-  unsigned U2ERIE:1;
-  unsigned CRCIE:1;
-  unsigned :4;
-  unsigned LVDIE:1;
-  unsigned :4;
-  unsigned CTMUIE:1;
-} IEC4BITS;
-extern volatile IEC4BITS IEC4bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IEC5 __attribute__((__sfr__));
-typedef struct tagIEC5BITS {
-  unsigned :1;
-  unsigned U3ERIE:1;
-  unsigned U3RXIE:1;
-  unsigned U3TXIE:1;
-  unsigned SI2C3IE:1;
-  unsigned MI2C3IE:1;
-  unsigned USB1IE:1;
-  unsigned U4ERIE:1;
-  unsigned U4RXIE:1;
-  unsigned U4TXIE:1;
-  unsigned SPF3IE:1;
-  unsigned SPI3IE:1;
-  unsigned OC9IE:1;
-  unsigned IC9IE:1;
-} IEC5BITS;
-extern volatile IEC5BITS IEC5bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC0 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC0BITS {
-  union {
-    struct {
-      unsigned INT0IP0:1;
-      unsigned INT0IP1:1;
-      unsigned INT0IP2:1;
-      unsigned :1;
-      unsigned IC1IP0:1;
-      unsigned IC1IP1:1;
-      unsigned IC1IP2:1;
-      unsigned :1;
-      unsigned OC1IP0:1;
-      unsigned OC1IP1:1;
-      unsigned OC1IP2:1;
-      unsigned :1;
-      unsigned T1IP0:1;
-      unsigned T1IP1:1;
-      unsigned T1IP2:1;
-    };
-    struct {
-      unsigned INT0IP:3;
-      unsigned :1;
-      unsigned IC1IP:3;
-      unsigned :1;
-      unsigned OC1IP:3;
-      unsigned :1;
-      unsigned T1IP:3;
-    };
-  };
-} IPC0BITS;
-extern volatile IPC0BITS IPC0bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC1 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC1BITS {
-  union {
-    struct {
-      unsigned :4;
-      unsigned IC2IP0:1;
-      unsigned IC2IP1:1;
-      unsigned IC2IP2:1;
-      unsigned :1;
-      unsigned OC2IP0:1;
-      unsigned OC2IP1:1;
-      unsigned OC2IP2:1;
-      unsigned :1;
-      unsigned T2IP0:1;
-      unsigned T2IP1:1;
-      unsigned T2IP2:1;
-    };
-    struct {
-      unsigned :4;
-      unsigned IC2IP:3;
-      unsigned :1;
-      unsigned OC2IP:3;
-      unsigned :1;
-      unsigned T2IP:3;
-    };
-  };
-} IPC1BITS;
-extern volatile IPC1BITS IPC1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC2 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC2BITS {
-  union {
-    struct {
-      unsigned T3IP0:1;
-      unsigned T3IP1:1;
-      unsigned T3IP2:1;
-      unsigned :1;
-      unsigned SPF1IP0:1;
-      unsigned SPF1IP1:1;
-      unsigned SPF1IP2:1;
-      unsigned :1;
-      unsigned SPI1IP0:1;
-      unsigned SPI1IP1:1;
-      unsigned SPI1IP2:1;
-      unsigned :1;
-      unsigned U1RXIP0:1;
-      unsigned U1RXIP1:1;
-      unsigned U1RXIP2:1;
-    };
-    struct {
-      unsigned T3IP:3;
-      unsigned :1;
-      unsigned SPF1IP:3;
-      unsigned :1;
-      unsigned SPI1IP:3;
-      unsigned :1;
-      unsigned U1RXIP:3;
-    };
-  };
-} IPC2BITS;
-extern volatile IPC2BITS IPC2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC3 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC3BITS {
-  union {
-    struct {
-      unsigned U1TXIP0:1;
-      unsigned U1TXIP1:1;
-      unsigned U1TXIP2:1;
-      unsigned :1;
-      unsigned AD1IP0:1;
-      unsigned AD1IP1:1;
-      unsigned AD1IP2:1;
-    };
-    struct {
-      unsigned U1TXIP:3;
-      unsigned :1;
-      unsigned AD1IP:3;
-    };
-  };
-} IPC3BITS;
-extern volatile IPC3BITS IPC3bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC4 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC4BITS {
-  union {
-    struct {
-      unsigned SI2C1IP0:1;
-      unsigned SI2C1IP1:1;
-      unsigned SI2C1IP2:1;
-      unsigned :1;
-      unsigned MI2C1IP0:1;
-      unsigned MI2C1IP1:1;
-      unsigned MI2C1IP2:1;
-      unsigned :1;
-      unsigned CMIP0:1;
-      unsigned CMIP1:1;
-      unsigned CMIP2:1;
-      unsigned :1;
-      unsigned CNIP0:1;
-      unsigned CNIP1:1;
-      unsigned CNIP2:1;
-    };
-    struct {
-      unsigned SI2C1IP:3;
-      unsigned :1;
-      unsigned MI2C1IP:3;
-      unsigned :1;
-      unsigned CMIP:3;
-      unsigned :1;
-      unsigned CNIP:3;
-    };
-    struct {
-      unsigned SI2C1P0:1;
-      unsigned SI2C1P1:1;
-      unsigned SI2C1P2:1;
-      unsigned :1;
-      unsigned MI2C1P0:1;
-      unsigned MI2C1P1:1;
-      unsigned MI2C1P2:1;
-    };
-    struct {
-      unsigned SI2C1P:3;
-      unsigned :1;
-      unsigned MI2C1P:3;
-    };
-  };
-} IPC4BITS;
-extern volatile IPC4BITS IPC4bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC5 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC5BITS {
-  union {
-    struct {
-      unsigned INT1IP0:1;
-      unsigned INT1IP1:1;
-      unsigned INT1IP2:1;
-      unsigned :5;
-      unsigned IC7IP0:1;
-      unsigned IC7IP1:1;
-      unsigned IC7IP2:1;
-      unsigned :1;
-      unsigned IC8IP0:1;
-      unsigned IC8IP1:1;
-      unsigned IC8IP2:1;
-    };
-    struct {
-      unsigned INT1IP:3;
-      unsigned :5;
-      unsigned IC7IP:3;
-      unsigned :1;
-      unsigned IC8IP:3;
-    };
-  };
-} IPC5BITS;
-extern volatile IPC5BITS IPC5bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC6 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC6BITS {
-  union {
-    struct {
-      unsigned :4;
-      unsigned OC3IP0:1;
-      unsigned OC3IP1:1;
-      unsigned OC3IP2:1;
-      unsigned :1;
-      unsigned OC4IP0:1;
-      unsigned OC4IP1:1;
-      unsigned OC4IP2:1;
-      unsigned :1;
-      unsigned T4IP0:1;
-      unsigned T4IP1:1;
-      unsigned T4IP2:1;
-    };
-    struct {
-      unsigned :4;
-      unsigned OC3IP:3;
-      unsigned :1;
-      unsigned OC4IP:3;
-      unsigned :1;
-      unsigned T4IP:3;
-    };
-  };
-} IPC6BITS;
-extern volatile IPC6BITS IPC6bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC7 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC7BITS {
-  union {
-    struct {
-      unsigned T5IP0:1;
-      unsigned T5IP1:1;
-      unsigned T5IP2:1;
-      unsigned :1;
-      unsigned INT2IP0:1;
-      unsigned INT2IP1:1;
-      unsigned INT2IP2:1;
-      unsigned :1;
-      unsigned U2RXIP0:1;
-      unsigned U2RXIP1:1;
-      unsigned U2RXIP2:1;
-      unsigned :1;
-      unsigned U2TXIP0:1;
-      unsigned U2TXIP1:1;
-      unsigned U2TXIP2:1;
-    };
-    struct {
-      unsigned T5IP:3;
-      unsigned :1;
-      unsigned INT2IP:3;
-      unsigned :1;
-      unsigned U2RXIP:3;
-      unsigned :1;
-      unsigned U2TXIP:3;
-    };
-  };
-} IPC7BITS;
-extern volatile IPC7BITS IPC7bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC8 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC8BITS {
-  union {
-    struct {
-      unsigned SPF2IP0:1;
-      unsigned SPF2IP1:1;
-      unsigned SPF2IP2:1;
-      unsigned :1;
-      unsigned SPI2IP0:1;
-      unsigned SPI2IP1:1;
-      unsigned SPI2IP2:1;
-    };
-    struct {
-      unsigned SPF2IP:3;
-      unsigned :1;
-      unsigned SPI2IP:3;
-    };
-  };
-} IPC8BITS;
-extern volatile IPC8BITS IPC8bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC9 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC9BITS {
-  union {
-    struct {
-      unsigned :4;
-      unsigned IC3IP0:1;
-      unsigned IC3IP1:1;
-      unsigned IC3IP2:1;
-      unsigned :1;
-      unsigned IC4IP0:1;
-      unsigned IC4IP1:1;
-      unsigned IC4IP2:1;
-      unsigned :1;
-      unsigned IC5IP0:1;
-      unsigned IC5IP1:1;
-      unsigned IC5IP2:1;
-    };
-    struct {
-      unsigned :4;
-      unsigned IC3IP:3;
-      unsigned :1;
-      unsigned IC4IP:3;
-      unsigned :1;
-      unsigned IC5IP:3;
-    };
-  };
-} IPC9BITS;
-extern volatile IPC9BITS IPC9bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC10 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC10BITS {
-  union {
-    struct {
-      unsigned IC6IP0:1;
-      unsigned IC6IP1:1;
-      unsigned IC6IP2:1;
-      unsigned :1;
-      unsigned OC5IP0:1;
-      unsigned OC5IP1:1;
-      unsigned OC5IP2:1;
-      unsigned :1;
-      unsigned OC6IP0:1;
-      unsigned OC6IP1:1;
-      unsigned OC6IP2:1;
-      unsigned :1;
-      unsigned OC7IP0:1;
-      unsigned OC7IP1:1;
-      unsigned OC7IP2:1;
-    };
-    struct {
-      unsigned IC6IP:3;
-      unsigned :1;
-      unsigned OC5IP:3;
-      unsigned :1;
-      unsigned OC6IP:3;
-      unsigned :1;
-      unsigned OC7IP:3;
-    };
-  };
-} IPC10BITS;
-extern volatile IPC10BITS IPC10bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC11 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC11BITS {
-  union {
-    struct {
-      unsigned OC8IP0:1;
-      unsigned OC8IP1:1;
-      unsigned OC8IP2:1;
-      unsigned :1;
-      unsigned PMPIP0:1;
-      unsigned PMPIP1:1;
-      unsigned PMPIP2:1;
-    };
-    struct {
-      unsigned OC8IP:3;
-      unsigned :1;
-      unsigned PMPIP:3;
-    };
-  };
-} IPC11BITS;
-extern volatile IPC11BITS IPC11bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC12 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC12BITS {
-  union {
-    struct {
-      unsigned :4;
-      unsigned SI2C2IP0:1;
-      unsigned SI2C2IP1:1;
-      unsigned SI2C2IP2:1;
-      unsigned :1;
-      unsigned MI2C2IP0:1;
-      unsigned MI2C2IP1:1;
-      unsigned MI2C2IP2:1;
-    };
-    struct {
-      unsigned :4;
-      unsigned SI2C2IP:3;
-      unsigned :1;
-      unsigned MI2C2IP:3;
-    };
-    struct {
-      unsigned :4;
-      unsigned SI2C2P0:1;
-      unsigned SI2C2P1:1;
-      unsigned SI2C2P2:1;
-      unsigned :1;
-      unsigned MI2C2P0:1;
-      unsigned MI2C2P1:1;
-      unsigned MI2C2P2:1;
-    };
-    struct {
-      unsigned :4;
-      unsigned SI2C2P:3;
-      unsigned :1;
-      unsigned MI2C2P:3;
-    };
-  };
-} IPC12BITS;
-extern volatile IPC12BITS IPC12bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC13 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC13BITS {
-  union {
-    struct {
-      unsigned :4;
-      unsigned INT3IP0:1;
-      unsigned INT3IP1:1;
-      unsigned INT3IP2:1;
-      unsigned :1;
-      unsigned INT4IP0:1;
-      unsigned INT4IP1:1;
-      unsigned INT4IP2:1;
-    };
-    struct {
-      unsigned :4;
-      unsigned INT3IP:3;
-      unsigned :1;
-      unsigned INT4IP:3;
-    };
-  };
-} IPC13BITS;
-extern volatile IPC13BITS IPC13bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC15 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC15BITS {
-  union {
-    struct {
-      unsigned :8;
-      unsigned RTCIP0:1;
-      unsigned RTCIP1:1;
-      unsigned RTCIP2:1;
-    };
-    struct {
-      unsigned :8;
-      unsigned RTCIP:3;
-    };
-  };
-} IPC15BITS;
-extern volatile IPC15BITS IPC15bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC16 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC16BITS {
-  union {
-    struct {
-      unsigned :4;
-      unsigned U1ERIP0:1;
-      unsigned U1ERIP1:1;
-      unsigned U1ERIP2:1;
-      unsigned :1;
-      unsigned U2ERIP0:1;
-      unsigned U2ERIP1:1;
-      unsigned U2ERIP2:1;
-      unsigned :1;
-      unsigned CRCIP0:1;
-      unsigned CRCIP1:1;
-      unsigned CRCIP2:1;
-    };
-    struct {
-      unsigned :4;
-      unsigned U1ERIP:3;
-      unsigned :1;
-      unsigned U2ERIP:3;
-      unsigned :1;
-      unsigned CRCIP:3;
-    };
-  };
-} IPC16BITS;
-extern volatile IPC16BITS IPC16bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC18 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC18BITS {
-  union {
-    struct {
-      unsigned LVDIP0:1;
-      unsigned LVDIP1:1;
-      unsigned LVDIP2:1;
-    };
-    struct {
-      unsigned LVDIP:3;
-    };
-  };
-} IPC18BITS;
-extern volatile IPC18BITS IPC18bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC19 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC19BITS {
-  union {
-    struct {
-      unsigned :4;
-      unsigned CTMUIP0:1;
-      unsigned CTMUIP1:1;
-      unsigned CTMUIP2:1;
-    };
-    struct {
-      unsigned :4;
-      unsigned CTMUIP:3;
-    };
-  };
-} IPC19BITS;
-extern volatile IPC19BITS IPC19bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC20 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC20BITS {
-  union {
-    struct {
-      unsigned :4;
-      unsigned U3ERIP0:1;
-      unsigned U3ERIP1:1;
-      unsigned U3ERIP2:1;
-      unsigned :1;
-      unsigned U3RXIP0:1;
-      unsigned U3RXIP1:1;
-      unsigned U3RXIP2:1;
-      unsigned :1;
-      unsigned U3TXIP0:1;
-      unsigned U3TXIP1:1;
-      unsigned U3TXIP2:1;
-    };
-    struct {
-      unsigned :4;
-      unsigned U3ERIP:3;
-      unsigned :1;
-      unsigned U3RXIP:3;
-      unsigned :1;
-      unsigned U3TXIP:3;
-    };
-  };
-} IPC20BITS;
-extern volatile IPC20BITS IPC20bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC21 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC21BITS {
-  union {
-    struct {
-      unsigned SI2C3P0:1;
-      unsigned SI2C3P1:1;
-      unsigned SI2C3P2:1;
-      unsigned :1;
-      unsigned MI2C3P0:1;
-      unsigned MI2C3P1:1;
-      unsigned MI2C3P2:1;
-      unsigned :1;
-      unsigned USB1IP0:1;
-      unsigned USB1IP1:1;
-      unsigned USB1IP2:1;
-      unsigned :1;
-      unsigned U4ERIP0:1;
-      unsigned U4ERIP1:1;
-      unsigned U4ERIP2:1;
-    };
-    struct {
-      unsigned SI2C3P:3;
-      unsigned :1;
-      unsigned MI2C3P:3;
-      unsigned :1;
-      unsigned USB1IP:3;
-      unsigned :1;
-      unsigned U4ERIP:3;
-    };
-  };
-} IPC21BITS;
-extern volatile IPC21BITS IPC21bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC22 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC22BITS {
-  union {
-    struct {
-      unsigned U4RXIP0:1;
-      unsigned U4RXIP1:1;
-      unsigned U4RXIP2:1;
-      unsigned :1;
-      unsigned U4TXIP0:1;
-      unsigned U4TXIP1:1;
-      unsigned U4TXIP2:1;
-      unsigned :1;
-      unsigned SPF3IP0:1;
-      unsigned SPF3IP1:1;
-      unsigned SPF3IP2:1;
-      unsigned :1;
-      unsigned SPI3IP0:1;
-      unsigned SPI3IP1:1;
-      unsigned SPI3IP2:1;
-    };
-    struct {
-      unsigned U4RXIP:3;
-      unsigned :1;
-      unsigned U4TXIP:3;
-      unsigned :1;
-      unsigned SPF3IP:3;
-      unsigned :1;
-      unsigned SPI3IP:3;
-    };
-  };
-} IPC22BITS;
-extern volatile IPC22BITS IPC22bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IPC23 __attribute__((__sfr__));
-__extension__ typedef struct tagIPC23BITS {
-  union {
-    struct {
-      unsigned OC9IP0:1;
-      unsigned OC9IP1:1;
-      unsigned OC9IP2:1;
-      unsigned :1;
-      unsigned IC9IP0:1;
-      unsigned IC9IP1:1;
-      unsigned IC9IP2:1;
-    };
-    struct {
-      unsigned OC9IP:3;
-      unsigned :1;
-      unsigned IC9IP:3;
-    };
-  };
-} IPC23BITS;
-extern volatile IPC23BITS IPC23bits __attribute__((__sfr__));
-
-extern volatile unsigned int  TMR1 __attribute__((__sfr__));
-extern volatile unsigned int  PR1 __attribute__((__sfr__));
-extern volatile unsigned int  T1CON __attribute__((__sfr__));
-__extension__ typedef struct tagT1CONBITS {
-  union {
-    struct {
-      unsigned :1;
-      unsigned TCS:1;
-      unsigned TSYNC:1;
-      unsigned :1;
-      unsigned TCKPS0:1;
-      unsigned TCKPS1:1;
-      unsigned TGATE:1;
-      unsigned :6;
-      unsigned TSIDL:1;
-      unsigned :1;
-      unsigned TON:1;
-    };
-    struct {
-      unsigned :4;
-      unsigned TCKPS:2;
-    };
-  };
-} T1CONBITS;
-extern volatile T1CONBITS T1CONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  TMR2 __attribute__((__sfr__));
-extern volatile unsigned int  TMR3HLD __attribute__((__sfr__));
-extern volatile unsigned int  TMR3 __attribute__((__sfr__));
-extern volatile unsigned int  PR2 __attribute__((__sfr__));
-extern volatile unsigned int  PR3 __attribute__((__sfr__));
-extern volatile unsigned int  T2CON __attribute__((__sfr__));
-__extension__ typedef struct tagT2CONBITS {
-  union {
-    struct {
-      unsigned :1;
-      unsigned TCS:1;
-      unsigned :1;
-      unsigned T32:1;
-      unsigned TCKPS0:1;
-      unsigned TCKPS1:1;
-      unsigned TGATE:1;
-      unsigned :6;
-      unsigned TSIDL:1;
-      unsigned :1;
-      unsigned TON:1;
-    };
-    struct {
-      unsigned :4;
-      unsigned TCKPS:2;
-    };
-  };
-} T2CONBITS;
-extern volatile T2CONBITS T2CONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  T3CON __attribute__((__sfr__));
-__extension__ typedef struct tagT3CONBITS {
-  union {
-    struct {
-      unsigned :1;
-      unsigned TCS:1;
-      unsigned :2;
-      unsigned TCKPS0:1;
-      unsigned TCKPS1:1;
-      unsigned TGATE:1;
-      unsigned :6;
-      unsigned TSIDL:1;
-      unsigned :1;
-      unsigned TON:1;
-    };
-    struct {
-      unsigned :4;
-      unsigned TCKPS:2;
-    };
-  };
-} T3CONBITS;
-extern volatile T3CONBITS T3CONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  TMR4 __attribute__((__sfr__));
-extern volatile unsigned int  TMR5HLD __attribute__((__sfr__));
-extern volatile unsigned int  TMR5 __attribute__((__sfr__));
-extern volatile unsigned int  PR4 __attribute__((__sfr__));
-extern volatile unsigned int  PR5 __attribute__((__sfr__));
-extern volatile unsigned int  T4CON __attribute__((__sfr__));
-__extension__ typedef struct tagT4CONBITS {
-  union {
-    struct {
-      unsigned :1;
-      unsigned TCS:1;
-      unsigned :1;
-      unsigned T32:1;
-      unsigned TCKPS0:1;
-      unsigned TCKPS1:1;
-      unsigned TGATE:1;
-      unsigned :6;
-      unsigned TSIDL:1;
-      unsigned :1;
-      unsigned TON:1;
-    };
-    struct {
-      unsigned :4;
-      unsigned TCKPS:2;
-    };
-  };
-} T4CONBITS;
-extern volatile T4CONBITS T4CONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  T5CON __attribute__((__sfr__));
-__extension__ typedef struct tagT5CONBITS {
-  union {
-    struct {
-      unsigned :1;
-      unsigned TCS:1;
-      unsigned :2;
-      unsigned TCKPS0:1;
-      unsigned TCKPS1:1;
-      unsigned TGATE:1;
-      unsigned :6;
-      unsigned TSIDL:1;
-      unsigned :1;
-      unsigned TON:1;
-    };
-    struct {
-      unsigned :4;
-      unsigned TCKPS:2;
-    };
-  };
-} T5CONBITS;
-extern volatile T5CONBITS T5CONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC1CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagIC1CON1BITS {
-  union {
-    struct {
-      unsigned ICM0:1;
-      unsigned ICM1:1;
-      unsigned ICM2:1;
-      unsigned ICBNE:1;
-      unsigned ICOV:1;
-      unsigned ICI0:1;
-      unsigned ICI1:1;
-      unsigned :3;
-      unsigned ICTSEL0:1;
-      unsigned ICTSEL1:1;
-      unsigned ICTSEL2:1;
-      unsigned ICSIDL:1;
-    };
-    struct {
-      unsigned ICM:3;
-      unsigned :2;
-      unsigned ICI:2;
-      unsigned :3;
-      unsigned ICTSEL:3;
-    };
-  };
-} IC1CON1BITS;
-extern volatile IC1CON1BITS IC1CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC1CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagIC1CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned :1;
-      unsigned TRIGSTAT:1;
-      unsigned ICTRIG:1;
-      unsigned IC32:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-    };
-  };
-} IC1CON2BITS;
-extern volatile IC1CON2BITS IC1CON2bits __attribute__((__sfr__));
-
-
-/* Generic structure of entire SFR area for Input Capture modules */
-typedef struct tagIC {
-        unsigned int icxbuf;
-        unsigned int icxcon;
-} IC, *PIC;
-
-/* SFR blocks for Input Capture modules */
-extern volatile IC IC1 __attribute__((__sfr__));
-extern volatile IC IC2 __attribute__((__sfr__));
-extern volatile IC IC3 __attribute__((__sfr__));
-extern volatile IC IC4 __attribute__((__sfr__));
-extern volatile IC IC5 __attribute__((__sfr__));
-
-extern volatile unsigned int  IC1BUF __attribute__((__sfr__));
-extern volatile unsigned int  IC1TMR __attribute__((__sfr__));
-extern volatile unsigned int  IC2CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagIC2CON1BITS {
-  union {
-    struct {
-      unsigned ICM0:1;
-      unsigned ICM1:1;
-      unsigned ICM2:1;
-      unsigned ICBNE:1;
-      unsigned ICOV:1;
-      unsigned ICI0:1;
-      unsigned ICI1:1;
-      unsigned :3;
-      unsigned ICTSEL0:1;
-      unsigned ICTSEL1:1;
-      unsigned ICTSEL2:1;
-      unsigned ICSIDL:1;
-    };
-    struct {
-      unsigned ICM:3;
-      unsigned :2;
-      unsigned ICI:2;
-      unsigned :3;
-      unsigned ICTSEL:3;
-    };
-  };
-} IC2CON1BITS;
-extern volatile IC2CON1BITS IC2CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC2CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagIC2CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned :1;
-      unsigned TRIGSTAT:1;
-      unsigned ICTRIG:1;
-      unsigned IC32:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-    };
-  };
-} IC2CON2BITS;
-extern volatile IC2CON2BITS IC2CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC2BUF __attribute__((__sfr__));
-extern volatile unsigned int  IC2TMR __attribute__((__sfr__));
-extern volatile unsigned int  IC3CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagIC3CON1BITS {
-  union {
-    struct {
-      unsigned ICM0:1;
-      unsigned ICM1:1;
-      unsigned ICM2:1;
-      unsigned ICBNE:1;
-      unsigned ICOV:1;
-      unsigned ICI0:1;
-      unsigned ICI1:1;
-      unsigned :3;
-      unsigned ICTSEL0:1;
-      unsigned ICTSEL1:1;
-      unsigned ICTSEL2:1;
-      unsigned ICSIDL:1;
-    };
-    struct {
-      unsigned ICM:3;
-      unsigned :2;
-      unsigned ICI:2;
-      unsigned :3;
-      unsigned ICTSEL:3;
-    };
-  };
-} IC3CON1BITS;
-extern volatile IC3CON1BITS IC3CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC3CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagIC3CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned :1;
-      unsigned TRIGSTAT:1;
-      unsigned ICTRIG:1;
-      unsigned IC32:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-    };
-  };
-} IC3CON2BITS;
-extern volatile IC3CON2BITS IC3CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC3BUF __attribute__((__sfr__));
-extern volatile unsigned int  IC3TMR __attribute__((__sfr__));
-extern volatile unsigned int  IC4CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagIC4CON1BITS {
-  union {
-    struct {
-      unsigned ICM0:1;
-      unsigned ICM1:1;
-      unsigned ICM2:1;
-      unsigned ICBNE:1;
-      unsigned ICOV:1;
-      unsigned ICI0:1;
-      unsigned ICI1:1;
-      unsigned :3;
-      unsigned ICTSEL0:1;
-      unsigned ICTSEL1:1;
-      unsigned ICTSEL2:1;
-      unsigned ICSIDL:1;
-    };
-    struct {
-      unsigned ICM:3;
-      unsigned :2;
-      unsigned ICI:2;
-      unsigned :3;
-      unsigned ICTSEL:3;
-    };
-  };
-} IC4CON1BITS;
-extern volatile IC4CON1BITS IC4CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC4CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagIC4CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned :1;
-      unsigned TRIGSTAT:1;
-      unsigned ICTRIG:1;
-      unsigned IC32:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-    };
-  };
-} IC4CON2BITS;
-extern volatile IC4CON2BITS IC4CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC4BUF __attribute__((__sfr__));
-extern volatile unsigned int  IC4TMR __attribute__((__sfr__));
-extern volatile unsigned int  IC5CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagIC5CON1BITS {
-  union {
-    struct {
-      unsigned ICM0:1;
-      unsigned ICM1:1;
-      unsigned ICM2:1;
-      unsigned ICBNE:1;
-      unsigned ICOV:1;
-      unsigned ICI0:1;
-      unsigned ICI1:1;
-      unsigned :3;
-      unsigned ICTSEL0:1;
-      unsigned ICTSEL1:1;
-      unsigned ICTSEL2:1;
-      unsigned ICSIDL:1;
-    };
-    struct {
-      unsigned ICM:3;
-      unsigned :2;
-      unsigned ICI:2;
-      unsigned :3;
-      unsigned ICTSEL:3;
-    };
-  };
-} IC5CON1BITS;
-extern volatile IC5CON1BITS IC5CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC5CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagIC5CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned :1;
-      unsigned TRIGSTAT:1;
-      unsigned ICTRIG:1;
-      unsigned IC32:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-    };
-  };
-} IC5CON2BITS;
-extern volatile IC5CON2BITS IC5CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC5BUF __attribute__((__sfr__));
-extern volatile unsigned int  IC5TMR __attribute__((__sfr__));
-extern volatile unsigned int  IC6CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagIC6CON1BITS {
-  union {
-    struct {
-      unsigned ICM0:1;
-      unsigned ICM1:1;
-      unsigned ICM2:1;
-      unsigned ICBNE:1;
-      unsigned ICOV:1;
-      unsigned ICI0:1;
-      unsigned ICI1:1;
-      unsigned :3;
-      unsigned ICTSEL0:1;
-      unsigned ICTSEL1:1;
-      unsigned ICTSEL2:1;
-      unsigned ICSIDL:1;
-    };
-    struct {
-      unsigned ICM:3;
-      unsigned :2;
-      unsigned ICI:2;
-      unsigned :3;
-      unsigned ICTSEL:3;
-    };
-  };
-} IC6CON1BITS;
-extern volatile IC6CON1BITS IC6CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC6CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagIC6CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned :1;
-      unsigned TRIGSTAT:1;
-      unsigned ICTRIG:1;
-      unsigned IC32:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-    };
-  };
-} IC6CON2BITS;
-extern volatile IC6CON2BITS IC6CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC6BUF __attribute__((__sfr__));
-extern volatile unsigned int  IC6TMR __attribute__((__sfr__));
-extern volatile unsigned int  IC7CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagIC7CON1BITS {
-  union {
-    struct {
-      unsigned ICM0:1;
-      unsigned ICM1:1;
-      unsigned ICM2:1;
-      unsigned ICBNE:1;
-      unsigned ICOV:1;
-      unsigned ICI0:1;
-      unsigned ICI1:1;
-      unsigned :3;
-      unsigned ICTSEL0:1;
-      unsigned ICTSEL1:1;
-      unsigned ICTSEL2:1;
-      unsigned ICSIDL:1;
-    };
-    struct {
-      unsigned ICM:3;
-      unsigned :2;
-      unsigned ICI:2;
-      unsigned :3;
-      unsigned ICTSEL:3;
-    };
-  };
-} IC7CON1BITS;
-extern volatile IC7CON1BITS IC7CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC7CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagIC7CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned :1;
-      unsigned TRIGSTAT:1;
-      unsigned ICTRIG:1;
-      unsigned IC32:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-    };
-  };
-} IC7CON2BITS;
-extern volatile IC7CON2BITS IC7CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC7BUF __attribute__((__sfr__));
-extern volatile unsigned int  IC7TMR __attribute__((__sfr__));
-extern volatile unsigned int  IC8CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagIC8CON1BITS {
-  union {
-    struct {
-      unsigned ICM0:1;
-      unsigned ICM1:1;
-      unsigned ICM2:1;
-      unsigned ICBNE:1;
-      unsigned ICOV:1;
-      unsigned ICI0:1;
-      unsigned ICI1:1;
-      unsigned :3;
-      unsigned ICTSEL0:1;
-      unsigned ICTSEL1:1;
-      unsigned ICTSEL2:1;
-      unsigned ICSIDL:1;
-    };
-    struct {
-      unsigned ICM:3;
-      unsigned :2;
-      unsigned ICI:2;
-      unsigned :3;
-      unsigned ICTSEL:3;
-    };
-  };
-} IC8CON1BITS;
-extern volatile IC8CON1BITS IC8CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC8CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagIC8CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned :1;
-      unsigned TRIGSTAT:1;
-      unsigned ICTRIG:1;
-      unsigned IC32:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-    };
-  };
-} IC8CON2BITS;
-extern volatile IC8CON2BITS IC8CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC8BUF __attribute__((__sfr__));
-extern volatile unsigned int  IC8TMR __attribute__((__sfr__));
-extern volatile unsigned int  IC9CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagIC9CON1BITS {
-  union {
-    struct {
-      unsigned ICM0:1;
-      unsigned ICM1:1;
-      unsigned ICM2:1;
-      unsigned ICBNE:1;
-      unsigned ICOV:1;
-      unsigned ICI0:1;
-      unsigned ICI1:1;
-      unsigned :3;
-      unsigned ICTSEL0:1;
-      unsigned ICTSEL1:1;
-      unsigned ICTSEL2:1;
-      unsigned ICSIDL:1;
-    };
-    struct {
-      unsigned ICM:3;
-      unsigned :2;
-      unsigned ICI:2;
-      unsigned :3;
-      unsigned ICTSEL:3;
-    };
-  };
-} IC9CON1BITS;
-extern volatile IC9CON1BITS IC9CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC9CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagIC9CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned :1;
-      unsigned TRIGSTAT:1;
-      unsigned ICTRIG:1;
-      unsigned IC32:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-    };
-  };
-} IC9CON2BITS;
-extern volatile IC9CON2BITS IC9CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  IC9BUF __attribute__((__sfr__));
-extern volatile unsigned int  IC9TMR __attribute__((__sfr__));
-extern volatile unsigned int  OC1CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagOC1CON1BITS {
-  union {
-    struct {
-      unsigned OCM0:1;
-      unsigned OCM1:1;
-      unsigned OCM2:1;
-      unsigned TRIGMODE:1;
-      unsigned OCFLT0:1;
-      unsigned :2;
-      unsigned ENFLT0:1;
-      unsigned :2;
-      unsigned OCTSEL0:1;
-      unsigned OCTSEL1:1;
-      unsigned OCTSEL2:1;
-      unsigned OCSIDL:1;
-    };
-    struct {
-      unsigned OCM:3;
-      unsigned :1;
-      unsigned OCFLT:1;
-      unsigned :2;
-      unsigned ENFLT:1;
-      unsigned :2;
-      unsigned OCTSEL:3;
-    };
-  };
-} OC1CON1BITS;
-extern volatile OC1CON1BITS OC1CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC1CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagOC1CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned OCTRIS:1;
-      unsigned TRIGSTAT:1;
-      unsigned OCTRIG:1;
-      unsigned OC32:1;
-      unsigned :3;
-      unsigned OCINV:1;
-      unsigned FLTTRIEN:1;
-      unsigned FLTOUT:1;
-      unsigned FLTMODE:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-      unsigned :10;
-      unsigned FLTMD:1;
-    };
-  };
-} OC1CON2BITS;
-extern volatile OC1CON2BITS OC1CON2bits __attribute__((__sfr__));
-
-
-/* Generic structure of entire SFR area for Output Compare modules */
-typedef struct tagOC {
-        unsigned int ocxrs;
-        unsigned int ocxr;
-        unsigned int ocxcon;
-} OC, *POC;
-
-/* SFR blocks for Output Compare modules */
-extern volatile OC OC1 __attribute__((__sfr__));
-extern volatile OC OC2 __attribute__((__sfr__));
-extern volatile OC OC3 __attribute__((__sfr__));
-extern volatile OC OC4 __attribute__((__sfr__));
-extern volatile OC OC5 __attribute__((__sfr__));
-
-extern volatile unsigned int  OC1RS __attribute__((__sfr__));
-extern volatile unsigned int  OC1R __attribute__((__sfr__));
-extern volatile unsigned int  OC1TMR __attribute__((__sfr__));
-extern volatile unsigned int  OC2CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagOC2CON1BITS {
-  union {
-    struct {
-      unsigned OCM0:1;
-      unsigned OCM1:1;
-      unsigned OCM2:1;
-      unsigned TRIGMODE:1;
-      unsigned OCFLT0:1;
-      unsigned :2;
-      unsigned ENFLT0:1;
-      unsigned :2;
-      unsigned OCTSEL0:1;
-      unsigned OCTSEL1:1;
-      unsigned OCTSEL2:1;
-      unsigned OCSIDL:1;
-    };
-    struct {
-      unsigned OCM:3;
-      unsigned :1;
-      unsigned OCFLT:1;
-      unsigned :2;
-      unsigned ENFLT:1;
-      unsigned :2;
-      unsigned OCTSEL:3;
-    };
-  };
-} OC2CON1BITS;
-extern volatile OC2CON1BITS OC2CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC2CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagOC2CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned OCTRIS:1;
-      unsigned TRIGSTAT:1;
-      unsigned OCTRIG:1;
-      unsigned OC32:1;
-      unsigned :3;
-      unsigned OCINV:1;
-      unsigned FLTTRIEN:1;
-      unsigned FLTOUT:1;
-      unsigned FLTMODE:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-      unsigned :10;
-      unsigned FLTMD:1;
-    };
-  };
-} OC2CON2BITS;
-extern volatile OC2CON2BITS OC2CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC2RS __attribute__((__sfr__));
-extern volatile unsigned int  OC2R __attribute__((__sfr__));
-extern volatile unsigned int  OC2TMR __attribute__((__sfr__));
-extern volatile unsigned int  OC3CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagOC3CON1BITS {
-  union {
-    struct {
-      unsigned OCM0:1;
-      unsigned OCM1:1;
-      unsigned OCM2:1;
-      unsigned TRIGMODE:1;
-      unsigned OCFLT0:1;
-      unsigned :2;
-      unsigned ENFLT0:1;
-      unsigned :2;
-      unsigned OCTSEL0:1;
-      unsigned OCTSEL1:1;
-      unsigned OCTSEL2:1;
-      unsigned OCSIDL:1;
-    };
-    struct {
-      unsigned OCM:3;
-      unsigned :1;
-      unsigned OCFLT:1;
-      unsigned :2;
-      unsigned ENFLT:1;
-      unsigned :2;
-      unsigned OCTSEL:3;
-    };
-  };
-} OC3CON1BITS;
-extern volatile OC3CON1BITS OC3CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC3CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagOC3CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned OCTRIS:1;
-      unsigned TRIGSTAT:1;
-      unsigned OCTRIG:1;
-      unsigned OC32:1;
-      unsigned :3;
-      unsigned OCINV:1;
-      unsigned FLTTRIEN:1;
-      unsigned FLTOUT:1;
-      unsigned FLTMODE:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-      unsigned :10;
-      unsigned FLTMD:1;
-    };
-  };
-} OC3CON2BITS;
-extern volatile OC3CON2BITS OC3CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC3RS __attribute__((__sfr__));
-extern volatile unsigned int  OC3R __attribute__((__sfr__));
-extern volatile unsigned int  OC3TMR __attribute__((__sfr__));
-extern volatile unsigned int  OC4CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagOC4CON1BITS {
-  union {
-    struct {
-      unsigned OCM0:1;
-      unsigned OCM1:1;
-      unsigned OCM2:1;
-      unsigned TRIGMODE:1;
-      unsigned OCFLT0:1;
-      unsigned :2;
-      unsigned ENFLT0:1;
-      unsigned :2;
-      unsigned OCTSEL0:1;
-      unsigned OCTSEL1:1;
-      unsigned OCTSEL2:1;
-      unsigned OCSIDL:1;
-    };
-    struct {
-      unsigned OCM:3;
-      unsigned :1;
-      unsigned OCFLT:1;
-      unsigned :2;
-      unsigned ENFLT:1;
-      unsigned :2;
-      unsigned OCTSEL:3;
-    };
-  };
-} OC4CON1BITS;
-extern volatile OC4CON1BITS OC4CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC4CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagOC4CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned OCTRIS:1;
-      unsigned TRIGSTAT:1;
-      unsigned OCTRIG:1;
-      unsigned OC32:1;
-      unsigned :3;
-      unsigned OCINV:1;
-      unsigned FLTTRIEN:1;
-      unsigned FLTOUT:1;
-      unsigned FLTMODE:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-      unsigned :10;
-      unsigned FLTMD:1;
-    };
-  };
-} OC4CON2BITS;
-extern volatile OC4CON2BITS OC4CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC4RS __attribute__((__sfr__));
-extern volatile unsigned int  OC4R __attribute__((__sfr__));
-extern volatile unsigned int  OC4TMR __attribute__((__sfr__));
-extern volatile unsigned int  OC5CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagOC5CON1BITS {
-  union {
-    struct {
-      unsigned OCM0:1;
-      unsigned OCM1:1;
-      unsigned OCM2:1;
-      unsigned TRIGMODE:1;
-      unsigned OCFLT0:1;
-      unsigned :2;
-      unsigned ENFLT0:1;
-      unsigned :2;
-      unsigned OCTSEL0:1;
-      unsigned OCTSEL1:1;
-      unsigned OCTSEL2:1;
-      unsigned OCSIDL:1;
-    };
-    struct {
-      unsigned OCM:3;
-      unsigned :1;
-      unsigned OCFLT:1;
-      unsigned :2;
-      unsigned ENFLT:1;
-      unsigned :2;
-      unsigned OCTSEL:3;
-    };
-  };
-} OC5CON1BITS;
-extern volatile OC5CON1BITS OC5CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC5CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagOC5CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned OCTRIS:1;
-      unsigned TRIGSTAT:1;
-      unsigned OCTRIG:1;
-      unsigned OC32:1;
-      unsigned :3;
-      unsigned OCINV:1;
-      unsigned FLTTRIEN:1;
-      unsigned FLTOUT:1;
-      unsigned FLTMODE:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-      unsigned :10;
-      unsigned FLTMD:1;
-    };
-  };
-} OC5CON2BITS;
-extern volatile OC5CON2BITS OC5CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC5RS __attribute__((__sfr__));
-extern volatile unsigned int  OC5R __attribute__((__sfr__));
-extern volatile unsigned int  OC5TMR __attribute__((__sfr__));
-extern volatile unsigned int  OC6CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagOC6CON1BITS {
-  union {
-    struct {
-      unsigned OCM0:1;
-      unsigned OCM1:1;
-      unsigned OCM2:1;
-      unsigned TRIGMODE:1;
-      unsigned OCFLT0:1;
-      unsigned :2;
-      unsigned ENFLT0:1;
-      unsigned :2;
-      unsigned OCTSEL0:1;
-      unsigned OCTSEL1:1;
-      unsigned OCTSEL2:1;
-      unsigned OCSIDL:1;
-    };
-    struct {
-      unsigned OCM:3;
-      unsigned :1;
-      unsigned OCFLT:1;
-      unsigned :2;
-      unsigned ENFLT:1;
-      unsigned :2;
-      unsigned OCTSEL:3;
-    };
-  };
-} OC6CON1BITS;
-extern volatile OC6CON1BITS OC6CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC6CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagOC6CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned OCTRIS:1;
-      unsigned TRIGSTAT:1;
-      unsigned OCTRIG:1;
-      unsigned OC32:1;
-      unsigned :3;
-      unsigned OCINV:1;
-      unsigned FLTTRIEN:1;
-      unsigned FLTOUT:1;
-      unsigned FLTMODE:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-      unsigned :10;
-      unsigned FLTMD:1;
-    };
-  };
-} OC6CON2BITS;
-extern volatile OC6CON2BITS OC6CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC6RS __attribute__((__sfr__));
-extern volatile unsigned int  OC6R __attribute__((__sfr__));
-extern volatile unsigned int  OC6TMR __attribute__((__sfr__));
-extern volatile unsigned int  OC7CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagOC7CON1BITS {
-  union {
-    struct {
-      unsigned OCM0:1;
-      unsigned OCM1:1;
-      unsigned OCM2:1;
-      unsigned TRIGMODE:1;
-      unsigned OCFLT0:1;
-      unsigned :2;
-      unsigned ENFLT0:1;
-      unsigned :2;
-      unsigned OCTSEL0:1;
-      unsigned OCTSEL1:1;
-      unsigned OCTSEL2:1;
-      unsigned OCSIDL:1;
-    };
-    struct {
-      unsigned OCM:3;
-      unsigned :1;
-      unsigned OCFLT:1;
-      unsigned :2;
-      unsigned ENFLT:1;
-      unsigned :2;
-      unsigned OCTSEL:3;
-    };
-  };
-} OC7CON1BITS;
-extern volatile OC7CON1BITS OC7CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC7CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagOC7CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned OCTRIS:1;
-      unsigned TRIGSTAT:1;
-      unsigned OCTRIG:1;
-      unsigned OC32:1;
-      unsigned :3;
-      unsigned OCINV:1;
-      unsigned FLTTRIEN:1;
-      unsigned FLTOUT:1;
-      unsigned FLTMODE:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-      unsigned :10;
-      unsigned FLTMD:1;
-    };
-  };
-} OC7CON2BITS;
-extern volatile OC7CON2BITS OC7CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC7RS __attribute__((__sfr__));
-extern volatile unsigned int  OC7R __attribute__((__sfr__));
-extern volatile unsigned int  OC7TMR __attribute__((__sfr__));
-extern volatile unsigned int  OC8CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagOC8CON1BITS {
-  union {
-    struct {
-      unsigned OCM0:1;
-      unsigned OCM1:1;
-      unsigned OCM2:1;
-      unsigned TRIGMODE:1;
-      unsigned OCFLT0:1;
-      unsigned :2;
-      unsigned ENFLT0:1;
-      unsigned :2;
-      unsigned OCTSEL0:1;
-      unsigned OCTSEL1:1;
-      unsigned OCTSEL2:1;
-      unsigned OCSIDL:1;
-    };
-    struct {
-      unsigned OCM:3;
-      unsigned :1;
-      unsigned OCFLT:1;
-      unsigned :2;
-      unsigned ENFLT:1;
-      unsigned :2;
-      unsigned OCTSEL:3;
-    };
-  };
-} OC8CON1BITS;
-extern volatile OC8CON1BITS OC8CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC8CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagOC8CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned OCTRIS:1;
-      unsigned TRIGSTAT:1;
-      unsigned OCTRIG:1;
-      unsigned OC32:1;
-      unsigned :3;
-      unsigned OCINV:1;
-      unsigned FLTTRIEN:1;
-      unsigned FLTOUT:1;
-      unsigned FLTMODE:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-      unsigned :10;
-      unsigned FLTMD:1;
-    };
-  };
-} OC8CON2BITS;
-extern volatile OC8CON2BITS OC8CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC8RS __attribute__((__sfr__));
-extern volatile unsigned int  OC8R __attribute__((__sfr__));
-extern volatile unsigned int  OC8TMR __attribute__((__sfr__));
-extern volatile unsigned int  OC9CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagOC9CON1BITS {
-  union {
-    struct {
-      unsigned OCM0:1;
-      unsigned OCM1:1;
-      unsigned OCM2:1;
-      unsigned TRIGMODE:1;
-      unsigned OCFLT0:1;
-      unsigned :2;
-      unsigned ENFLT0:1;
-      unsigned :2;
-      unsigned OCTSEL0:1;
-      unsigned OCTSEL1:1;
-      unsigned OCTSEL2:1;
-      unsigned OCSIDL:1;
-    };
-    struct {
-      unsigned OCM:3;
-      unsigned :1;
-      unsigned OCFLT:1;
-      unsigned :2;
-      unsigned ENFLT:1;
-      unsigned :2;
-      unsigned OCTSEL:3;
-    };
-  };
-} OC9CON1BITS;
-extern volatile OC9CON1BITS OC9CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC9CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagOC9CON2BITS {
-  union {
-    struct {
-      unsigned SYNCSEL0:1;
-      unsigned SYNCSEL1:1;
-      unsigned SYNCSEL2:1;
-      unsigned SYNCSEL3:1;
-      unsigned SYNCSEL4:1;
-      unsigned OCTRIS:1;
-      unsigned TRIGSTAT:1;
-      unsigned OCTRIG:1;
-      unsigned OC32:1;
-      unsigned :3;
-      unsigned OCINV:1;
-      unsigned FLTTRIEN:1;
-      unsigned FLTOUT:1;
-      unsigned FLTMODE:1;
-    };
-    struct {
-      unsigned SYNCSEL:5;
-      unsigned :10;
-      unsigned FLTMD:1;
-    };
-  };
-} OC9CON2BITS;
-extern volatile OC9CON2BITS OC9CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  OC9RS __attribute__((__sfr__));
-extern volatile unsigned int  OC9R __attribute__((__sfr__));
-extern volatile unsigned int  OC9TMR __attribute__((__sfr__));
-extern volatile unsigned int  I2C1RCV __attribute__((__sfr__));
-extern volatile unsigned int  I2C1TRN __attribute__((__sfr__));
-extern volatile unsigned int  I2C1BRG __attribute__((__sfr__));
-extern volatile unsigned int  I2C1CON __attribute__((__sfr__));
-typedef struct tagI2C1CONBITS {
-  unsigned SEN:1;
-  unsigned RSEN:1;
-  unsigned PEN:1;
-  unsigned RCEN:1;
-  unsigned ACKEN:1;
-  unsigned ACKDT:1;
-  unsigned STREN:1;
-  unsigned GCEN:1;
-  unsigned SMEN:1;
-  unsigned DISSLW:1;
-  unsigned A10M:1;
-  unsigned IPMIEN:1;
-  unsigned SCLREL:1;
-  unsigned I2CSIDL:1;
-  unsigned :1;
-  unsigned I2CEN:1;
-} I2C1CONBITS;
-extern volatile I2C1CONBITS I2C1CONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  I2C1STAT __attribute__((__sfr__));
-typedef struct tagI2C1STATBITS {
-  unsigned TBF:1;
-  unsigned RBF:1;
-  unsigned R_W:1;
-  unsigned S:1;
-  unsigned P:1;
-  unsigned D_A:1;
-  unsigned I2COV:1;
-  unsigned IWCOL:1;
-  unsigned ADD10:1;
-  unsigned GCSTAT:1;
-  unsigned BCL:1;
-  unsigned :3;
-  unsigned TRSTAT:1;
-  unsigned ACKSTAT:1;
-} I2C1STATBITS;
-extern volatile I2C1STATBITS I2C1STATbits __attribute__((__sfr__));
-
-extern volatile unsigned int  I2C1ADD __attribute__((__sfr__));
-extern volatile unsigned int  I2C1MSK __attribute__((__sfr__));
-extern volatile unsigned int  I2C2RCV __attribute__((__sfr__));
-extern volatile unsigned int  I2C2TRN __attribute__((__sfr__));
-extern volatile unsigned int  I2C2BRG __attribute__((__sfr__));
-extern volatile unsigned int  I2C2CON __attribute__((__sfr__));
-typedef struct tagI2C2CONBITS {
-  unsigned SEN:1;
-  unsigned RSEN:1;
-  unsigned PEN:1;
-  unsigned RCEN:1;
-  unsigned ACKEN:1;
-  unsigned ACKDT:1;
-  unsigned STREN:1;
-  unsigned GCEN:1;
-  unsigned SMEN:1;
-  unsigned DISSLW:1;
-  unsigned A10M:1;
-  unsigned IPMIEN:1;
-  unsigned SCLREL:1;
-  unsigned I2CSIDL:1;
-  unsigned :1;
-  unsigned I2CEN:1;
-} I2C2CONBITS;
-extern volatile I2C2CONBITS I2C2CONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  I2C2STAT __attribute__((__sfr__));
-typedef struct tagI2C2STATBITS {
-  unsigned TBF:1;
-  unsigned RBF:1;
-  unsigned R_W:1;
-  unsigned S:1;
-  unsigned P:1;
-  unsigned D_A:1;
-  unsigned I2COV:1;
-  unsigned IWCOL:1;
-  unsigned ADD10:1;
-  unsigned GCSTAT:1;
-  unsigned BCL:1;
-  unsigned :3;
-  unsigned TRSTAT:1;
-  unsigned ACKSTAT:1;
-} I2C2STATBITS;
-extern volatile I2C2STATBITS I2C2STATbits __attribute__((__sfr__));
-
-extern volatile unsigned int  I2C2ADD __attribute__((__sfr__));
-extern volatile unsigned int  I2C2MSK __attribute__((__sfr__));
-
-/* Generic structure of entire SFR area for each UART module */
-typedef struct tagUART {
-        unsigned int uxmode;
-        unsigned int uxsta;
-        unsigned int uxtxreg;
-        unsigned int uxrxreg;
-        unsigned int uxbrg;
-} UART, *PUART;
-
-#define UxMODEBITS U1MODEBITS
-#define UxSTABITS U1STABITS
-#define UxTXREGBITS U1TXREGBITS
-#define UxRXREGBITS U1RXREGBITS
-#define UxBRGBITS U1BRGBITS
-
-/* SFR blocks for each UART module */
-extern volatile UART UART1 __attribute__((__sfr__));
-extern volatile UART UART2 __attribute__((__sfr__));
-
-extern volatile unsigned int  U1MODE __attribute__((__sfr__));
-__extension__ typedef struct tagU1MODEBITS {
-  union {
-    struct {
-      unsigned STSEL:1;
-      unsigned PDSEL0:1;
-      unsigned PDSEL1:1;
-      unsigned BRGH:1;
-      unsigned RXINV:1;
-      unsigned ABAUD:1;
-      unsigned LPBACK:1;
-      unsigned WAKE:1;
-      unsigned UEN0:1;
-      unsigned UEN1:1;
-      unsigned :1;
-      unsigned RTSMD:1;
-      unsigned IREN:1;
-      unsigned USIDL:1;
-      unsigned :1;
-      unsigned UARTEN:1;
-    };
-    struct {
-      unsigned :1;
-      unsigned PDSEL:2;
-      unsigned :5;
-      unsigned UEN:2;
-    };
-  };
-} U1MODEBITS;
-extern volatile U1MODEBITS U1MODEbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1STA __attribute__((__sfr__));
-__extension__ typedef struct tagU1STABITS {
-  union {
-    struct {
-      unsigned URXDA:1;
-      unsigned OERR:1;
-      unsigned FERR:1;
-      unsigned PERR:1;
-      unsigned RIDLE:1;
-      unsigned ADDEN:1;
-      unsigned URXISEL0:1;
-      unsigned URXISEL1:1;
-      unsigned TRMT:1;
-      unsigned UTXBF:1;
-      unsigned UTXEN:1;
-      unsigned UTXBRK:1;
-      unsigned :1;
-      unsigned UTXISEL0:1;
-      unsigned UTXINV:1;
-      unsigned UTXISEL1:1;
-    };
-    struct {
-      unsigned :6;
-      unsigned URXISEL:2;
-    };
-  };
-} U1STABITS;
-extern volatile U1STABITS U1STAbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1TXREG __attribute__((__sfr__));
-extern volatile unsigned int  U1RXREG __attribute__((__sfr__));
-extern volatile unsigned int  U1BRG __attribute__((__sfr__));
-extern volatile unsigned int  U2MODE __attribute__((__sfr__));
-__extension__ typedef struct tagU2MODEBITS {
-  union {
-    struct {
-      unsigned STSEL:1;
-      unsigned PDSEL0:1;
-      unsigned PDSEL1:1;
-      unsigned BRGH:1;
-      unsigned RXINV:1;
-      unsigned ABAUD:1;
-      unsigned LPBACK:1;
-      unsigned WAKE:1;
-      unsigned UEN0:1;
-      unsigned UEN1:1;
-      unsigned :1;
-      unsigned RTSMD:1;
-      unsigned IREN:1;
-      unsigned USIDL:1;
-      unsigned :1;
-      unsigned UARTEN:1;
-    };
-    struct {
-      unsigned :1;
-      unsigned PDSEL:2;
-      unsigned :5;
-      unsigned UEN:2;
-    };
-  };
-} U2MODEBITS;
-extern volatile U2MODEBITS U2MODEbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U2STA __attribute__((__sfr__));
-__extension__ typedef struct tagU2STABITS {
-  union {
-    struct {
-      unsigned URXDA:1;
-      unsigned OERR:1;
-      unsigned FERR:1;
-      unsigned PERR:1;
-      unsigned RIDLE:1;
-      unsigned ADDEN:1;
-      unsigned URXISEL0:1;
-      unsigned URXISEL1:1;
-      unsigned TRMT:1;
-      unsigned UTXBF:1;
-      unsigned UTXEN:1;
-      unsigned UTXBRK:1;
-      unsigned :1;
-      unsigned UTXISEL0:1;
-      unsigned UTXINV:1;
-      unsigned UTXISEL1:1;
-    };
-    struct {
-      unsigned :6;
-      unsigned URXISEL:2;
-    };
-  };
-} U2STABITS;
-extern volatile U2STABITS U2STAbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U2TXREG __attribute__((__sfr__));
-extern volatile unsigned int  U2RXREG __attribute__((__sfr__));
-extern volatile unsigned int  U2BRG __attribute__((__sfr__));
-
-/* Generic structure of entire SFR area for each SPI module */
-typedef struct tagSPI {
-        unsigned int spixstat;
-        unsigned int spixcon1;
-        unsigned int spixcon2;
-        unsigned int spixbuf;
-} SPI, *PSPI;
-
-#define SPIxSTATBITS SPI1STATBITS
-#define SPIxCONBITS SPI1CONBITS
-
-/* SFR blocks for each SPI module */
-extern volatile SPI SPI1 __attribute__((__sfr__));
-extern volatile SPI SPI2 __attribute__((__sfr__));
-
-extern volatile unsigned int  SPI1STAT __attribute__((__sfr__));
-__extension__ typedef struct tagSPI1STATBITS {
-  union {
-    struct {
-      unsigned SPIRBF:1;
-      unsigned SPITBF:1;
-      unsigned SISEL0:1;
-      unsigned SISEL1:1;
-      unsigned SISEL2:1;
-      unsigned SRXMPT:1;
-      unsigned SPIROV:1;
-      unsigned SRMPT:1;
-      unsigned SPIBEC0:1;
-      unsigned SPIBEC1:1;
-      unsigned SPIBEC2:1;
-      unsigned :2;
-      unsigned SPISIDL:1;
-      unsigned :1;
-      unsigned SPIEN:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned SISEL:3;
-      unsigned :3;
-      unsigned SPIBEC:3;
-    };
-  };
-} SPI1STATBITS;
-extern volatile SPI1STATBITS SPI1STATbits __attribute__((__sfr__));
-
-extern volatile unsigned int  SPI1CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagSPI1CON1BITS {
-  union {
-    struct {
-      unsigned PPRE0:1;
-      unsigned PPRE1:1;
-      unsigned SPRE0:1;
-      unsigned SPRE1:1;
-      unsigned SPRE2:1;
-      unsigned MSTEN:1;
-      unsigned CKP:1;
-      unsigned SSEN:1;
-      unsigned CKE:1;
-      unsigned SMP:1;
-      unsigned MODE16:1;
-      unsigned DISSDO:1;
-      unsigned DISSCK:1;
-    };
-    struct {
-      unsigned PPRE:2;
-      unsigned SPRE:3;
-    };
-  };
-} SPI1CON1BITS;
-extern volatile SPI1CON1BITS SPI1CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  SPI1CON2 __attribute__((__sfr__));
-typedef struct tagSPI1CON2BITS {
-  unsigned SPIBEN:1;
-  unsigned SPIFE:1;
-  unsigned :11;
-  unsigned SPIFPOL:1;
-  unsigned SPIFSD:1;
-  unsigned FRMEN:1;
-} SPI1CON2BITS;
-extern volatile SPI1CON2BITS SPI1CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  SPI1BUF __attribute__((__sfr__));
-extern volatile unsigned int  U3MODE __attribute__((__sfr__));
-__extension__ typedef struct tagU3MODEBITS {
-  union {
-    struct {
-      unsigned STSEL:1;
-      unsigned PDSEL0:1;
-      unsigned PDSEL1:1;
-      unsigned BRGH:1;
-      unsigned RXINV:1;
-      unsigned ABAUD:1;
-      unsigned LPBACK:1;
-      unsigned WAKE:1;
-      unsigned UEN0:1;
-      unsigned UEN1:1;
-      unsigned :1;
-      unsigned RTSMD:1;
-      unsigned IREN:1;
-      unsigned USIDL:1;
-      unsigned :1;
-      unsigned UARTEN:1;
-    };
-    struct {
-      unsigned :1;
-      unsigned PDSEL:2;
-      unsigned :5;
-      unsigned UEN:2;
-    };
-  };
-} U3MODEBITS;
-extern volatile U3MODEBITS U3MODEbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U3STA __attribute__((__sfr__));
-__extension__ typedef struct tagU3STABITS {
-  union {
-    struct {
-      unsigned URXDA:1;
-      unsigned OERR:1;
-      unsigned FERR:1;
-      unsigned PERR:1;
-      unsigned RIDLE:1;
-      unsigned ADDEN:1;
-      unsigned URXISEL0:1;
-      unsigned URXISEL1:1;
-      unsigned TRMT:1;
-      unsigned UTXBF:1;
-      unsigned UTXEN:1;
-      unsigned UTXBRK:1;
-      unsigned :1;
-      unsigned UTXISEL0:1;
-      unsigned UTXINV:1;
-      unsigned UTXISEL1:1;
-    };
-    struct {
-      unsigned :6;
-      unsigned URXISEL:2;
-    };
-  };
-} U3STABITS;
-extern volatile U3STABITS U3STAbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U3TXREG __attribute__((__sfr__));
-extern volatile unsigned int  U3RXREG __attribute__((__sfr__));
-extern volatile unsigned int  U3BRG __attribute__((__sfr__));
-extern volatile unsigned int  SPI2STAT __attribute__((__sfr__));
-__extension__ typedef struct tagSPI2STATBITS {
-  union {
-    struct {
-      unsigned SPIRBF:1;
-      unsigned SPITBF:1;
-      unsigned SISEL0:1;
-      unsigned SISEL1:1;
-      unsigned SISEL2:1;
-      unsigned SRXMPT:1;
-      unsigned SPIROV:1;
-      unsigned SRMPT:1;
-      unsigned SPIBEC0:1;
-      unsigned SPIBEC1:1;
-      unsigned SPIBEC2:1;
-      unsigned :2;
-      unsigned SPISIDL:1;
-      unsigned :1;
-      unsigned SPIEN:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned SISEL:3;
-      unsigned :3;
-      unsigned SPIBEC:3;
-    };
-  };
-} SPI2STATBITS;
-extern volatile SPI2STATBITS SPI2STATbits __attribute__((__sfr__));
-
-extern volatile unsigned int  SPI2CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagSPI2CON1BITS {
-  union {
-    struct {
-      unsigned PPRE0:1;
-      unsigned PPRE1:1;
-      unsigned SPRE0:1;
-      unsigned SPRE1:1;
-      unsigned SPRE2:1;
-      unsigned MSTEN:1;
-      unsigned CKP:1;
-      unsigned SSEN:1;
-      unsigned CKE:1;
-      unsigned SMP:1;
-      unsigned MODE16:1;
-      unsigned DISSDO:1;
-      unsigned DISSCK:1;
-    };
-    struct {
-      unsigned PPRE:2;
-      unsigned SPRE:3;
-    };
-  };
-} SPI2CON1BITS;
-extern volatile SPI2CON1BITS SPI2CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  SPI2CON2 __attribute__((__sfr__));
-typedef struct tagSPI2CON2BITS {
-  unsigned SPIBEN:1;
-  unsigned SPIFE:1;
-  unsigned :11;
-  unsigned SPIFPOL:1;
-  unsigned SPIFSD:1;
-  unsigned FRMEN:1;
-} SPI2CON2BITS;
-extern volatile SPI2CON2BITS SPI2CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  SPI2BUF __attribute__((__sfr__));
-extern volatile unsigned int  I2C3RCV __attribute__((__sfr__));
-extern volatile unsigned int  I2C3TRN __attribute__((__sfr__));
-extern volatile unsigned int  I2C3BRG __attribute__((__sfr__));
-extern volatile unsigned int  I2C3CON __attribute__((__sfr__));
-typedef struct tagI2C3CONBITS {
-  unsigned SEN:1;
-  unsigned RSEN:1;
-  unsigned PEN:1;
-  unsigned RCEN:1;
-  unsigned ACKEN:1;
-  unsigned ACKDT:1;
-  unsigned STREN:1;
-  unsigned GCEN:1;
-  unsigned SMEN:1;
-  unsigned DISSLW:1;
-  unsigned A10M:1;
-  unsigned IPMIEN:1;
-  unsigned SCLREL:1;
-  unsigned I2CSIDL:1;
-  unsigned :1;
-  unsigned I2CEN:1;
-} I2C3CONBITS;
-extern volatile I2C3CONBITS I2C3CONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  I2C3STAT __attribute__((__sfr__));
-typedef struct tagI2C3STATBITS {
-  unsigned TBF:1;
-  unsigned RBF:1;
-  unsigned R_W:1;
-  unsigned S:1;
-  unsigned P:1;
-  unsigned D_A:1;
-  unsigned I2COV:1;
-  unsigned IWCOL:1;
-  unsigned ADD10:1;
-  unsigned GCSTAT:1;
-  unsigned BCL:1;
-  unsigned :3;
-  unsigned TRSTAT:1;
-  unsigned ACKSTAT:1;
-} I2C3STATBITS;
-extern volatile I2C3STATBITS I2C3STATbits __attribute__((__sfr__));
-
-extern volatile unsigned int  I2C3ADD __attribute__((__sfr__));
-extern volatile unsigned int  I2C3MSK __attribute__((__sfr__));
-extern volatile unsigned int  SPI3STAT __attribute__((__sfr__));
-__extension__ typedef struct tagSPI3STATBITS {
-  union {
-    struct {
-      unsigned SPIRBF:1;
-      unsigned SPITBF:1;
-      unsigned SISEL0:1;
-      unsigned SISEL1:1;
-      unsigned SISEL2:1;
-      unsigned SRXMPT:1;
-      unsigned SPIROV:1;
-      unsigned SRMPT:1;
-      unsigned SPIBEC0:1;
-      unsigned SPIBEC1:1;
-      unsigned SPIBEC2:1;
-      unsigned :2;
-      unsigned SPISIDL:1;
-      unsigned :1;
-      unsigned SPIEN:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned SISEL:3;
-      unsigned :3;
-      unsigned SPIBEC:3;
-    };
-  };
-} SPI3STATBITS;
-extern volatile SPI3STATBITS SPI3STATbits __attribute__((__sfr__));
-
-extern volatile unsigned int  SPI3CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagSPI3CON1BITS {
-  union {
-    struct {
-      unsigned PPRE0:1;
-      unsigned PPRE1:1;
-      unsigned SPRE0:1;
-      unsigned SPRE1:1;
-      unsigned SPRE2:1;
-      unsigned MSTEN:1;
-      unsigned CKP:1;
-      unsigned SSEN:1;
-      unsigned CKE:1;
-      unsigned SMP:1;
-      unsigned MODE16:1;
-      unsigned DISSDO:1;
-      unsigned DISSCK:1;
-    };
-    struct {
-      unsigned PPRE:2;
-      unsigned SPRE:3;
-    };
-  };
-} SPI3CON1BITS;
-extern volatile SPI3CON1BITS SPI3CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  SPI3CON2 __attribute__((__sfr__));
-typedef struct tagSPI3CON2BITS {
-  unsigned SPIBEN:1;
-  unsigned SPIFE:1;
-  unsigned :11;
-  unsigned SPIFPOL:1;
-  unsigned SPIFSD:1;
-  unsigned FRMEN:1;
-} SPI3CON2BITS;
-extern volatile SPI3CON2BITS SPI3CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  SPI3BUF __attribute__((__sfr__));
-extern volatile unsigned int  U4MODE __attribute__((__sfr__));
-__extension__ typedef struct tagU4MODEBITS {
-  union {
-    struct {
-      unsigned STSEL:1;
-      unsigned PDSEL0:1;
-      unsigned PDSEL1:1;
-      unsigned BRGH:1;
-      unsigned RXINV:1;
-      unsigned ABAUD:1;
-      unsigned LPBACK:1;
-      unsigned WAKE:1;
-      unsigned UEN0:1;
-      unsigned UEN1:1;
-      unsigned :1;
-      unsigned RTSMD:1;
-      unsigned IREN:1;
-      unsigned USIDL:1;
-      unsigned :1;
-      unsigned UARTEN:1;
-    };
-    struct {
-      unsigned :1;
-      unsigned PDSEL:2;
-      unsigned :5;
-      unsigned UEN:2;
-    };
-  };
-} U4MODEBITS;
-extern volatile U4MODEBITS U4MODEbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U4STA __attribute__((__sfr__));
-__extension__ typedef struct tagU4STABITS {
-  union {
-    struct {
-      unsigned URXDA:1;
-      unsigned OERR:1;
-      unsigned FERR:1;
-      unsigned PERR:1;
-      unsigned RIDLE:1;
-      unsigned ADDEN:1;
-      unsigned URXISEL0:1;
-      unsigned URXISEL1:1;
-      unsigned TRMT:1;
-      unsigned UTXBF:1;
-      unsigned UTXEN:1;
-      unsigned UTXBRK:1;
-      unsigned :1;
-      unsigned UTXISEL0:1;
-      unsigned UTXINV:1;
-      unsigned UTXISEL1:1;
-    };
-    struct {
-      unsigned :6;
-      unsigned URXISEL:2;
-    };
-  };
-} U4STABITS;
-extern volatile U4STABITS U4STAbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U4TXREG __attribute__((__sfr__));
-extern volatile unsigned int  U4RXREG __attribute__((__sfr__));
-extern volatile unsigned int  U4BRG __attribute__((__sfr__));
-extern volatile unsigned int  TRISB __attribute__((__sfr__));
-typedef struct tagTRISBBITS {
-  unsigned TRISB0:1;
-  unsigned TRISB1:1;
-  unsigned TRISB2:1;
-  unsigned TRISB3:1;
-  unsigned TRISB4:1;
-  unsigned TRISB5:1;
-  unsigned TRISB6:1;
-  unsigned TRISB7:1;
-  unsigned TRISB8:1;
-  unsigned TRISB9:1;
-  unsigned TRISB10:1;
-  unsigned TRISB11:1;
-  unsigned TRISB12:1;
-  unsigned TRISB13:1;
-  unsigned TRISB14:1;
-  unsigned TRISB15:1;
-} TRISBBITS;
-extern volatile TRISBBITS TRISBbits __attribute__((__sfr__));
-
-extern volatile unsigned int  PORTB __attribute__((__sfr__));
-typedef struct tagPORTBBITS {
-  unsigned RB0:1;
-  unsigned RB1:1;
-  unsigned RB2:1;
-  unsigned RB3:1;
-  unsigned RB4:1;
-  unsigned RB5:1;
-  unsigned RB6:1;
-  unsigned RB7:1;
-  unsigned RB8:1;
-  unsigned RB9:1;
-  unsigned RB10:1;
-  unsigned RB11:1;
-  unsigned RB12:1;
-  unsigned RB13:1;
-  unsigned RB14:1;
-  unsigned RB15:1;
-} PORTBBITS;
-extern volatile PORTBBITS PORTBbits __attribute__((__sfr__));
-
-extern volatile unsigned int  LATB __attribute__((__sfr__));
-typedef struct tagLATBBITS {
-  unsigned LATB0:1;
-  unsigned LATB1:1;
-  unsigned LATB2:1;
-  unsigned LATB3:1;
-  unsigned LATB4:1;
-  unsigned LATB5:1;
-  unsigned LATB6:1;
-  unsigned LATB7:1;
-  unsigned LATB8:1;
-  unsigned LATB9:1;
-  unsigned LATB10:1;
-  unsigned LATB11:1;
-  unsigned LATB12:1;
-  unsigned LATB13:1;
-  unsigned LATB14:1;
-  unsigned LATB15:1;
-} LATBBITS;
-extern volatile LATBBITS LATBbits __attribute__((__sfr__));
-
-extern volatile unsigned int  ODCB __attribute__((__sfr__));
-typedef struct tagODCBBITS {
-  unsigned ODB0:1;
-  unsigned ODB1:1;
-  unsigned ODB2:1;
-  unsigned ODB3:1;
-  unsigned ODB4:1;
-  unsigned ODB5:1;
-  unsigned ODB6:1;
-  unsigned ODB7:1;
-  unsigned ODB8:1;
-  unsigned ODB9:1;
-  unsigned ODB10:1;
-  unsigned ODB11:1;
-  unsigned ODB12:1;
-  unsigned ODB13:1;
-  unsigned ODB14:1;
-  unsigned ODB15:1;
-} ODCBBITS;
-extern volatile ODCBBITS ODCBbits __attribute__((__sfr__));
-
-extern volatile unsigned int  TRISC __attribute__((__sfr__));
-typedef struct tagTRISCBITS {
-  unsigned :12;
-  unsigned TRISC12:1;
-  unsigned TRISC13:1;
-  unsigned TRISC14:1;
-  unsigned TRISC15:1;
-} TRISCBITS;
-extern volatile TRISCBITS TRISCbits __attribute__((__sfr__));
-
-extern volatile unsigned int  PORTC __attribute__((__sfr__));
-typedef struct tagPORTCBITS {
-  unsigned :12;
-  unsigned RC12:1;
-  unsigned RC13:1;
-  unsigned RC14:1;
-  unsigned RC15:1;
-} PORTCBITS;
-extern volatile PORTCBITS PORTCbits __attribute__((__sfr__));
-
-extern volatile unsigned int  LATC __attribute__((__sfr__));
-typedef struct tagLATCBITS {
-  unsigned :12;
-  unsigned LATC12:1;
-  unsigned LATC13:1;
-  unsigned LATC14:1;
-  unsigned LATC15:1;
-} LATCBITS;
-extern volatile LATCBITS LATCbits __attribute__((__sfr__));
-
-extern volatile unsigned int  ODCC __attribute__((__sfr__));
-typedef struct tagODCCBITS {
-  unsigned :12;
-  unsigned ODC12:1;
-  unsigned ODC13:1;
-  unsigned ODC14:1;
-  unsigned ODC15:1;
-} ODCCBITS;
-extern volatile ODCCBITS ODCCbits __attribute__((__sfr__));
-
-extern volatile unsigned int  TRISD __attribute__((__sfr__));
-typedef struct tagTRISDBITS {
-  unsigned TRISD0:1;
-  unsigned TRISD1:1;
-  unsigned TRISD2:1;
-  unsigned TRISD3:1;
-  unsigned TRISD4:1;
-  unsigned TRISD5:1;
-  unsigned TRISD6:1;
-  unsigned TRISD7:1;
-  unsigned TRISD8:1;
-  unsigned TRISD9:1;
-  unsigned TRISD10:1;
-  unsigned TRISD11:1;
-} TRISDBITS;
-extern volatile TRISDBITS TRISDbits __attribute__((__sfr__));
-
-extern volatile unsigned int  PORTD __attribute__((__sfr__));
-typedef struct tagPORTDBITS {
-  unsigned RD0:1;
-  unsigned RD1:1;
-  unsigned RD2:1;
-  unsigned RD3:1;
-  unsigned RD4:1;
-  unsigned RD5:1;
-  unsigned RD6:1;
-  unsigned RD7:1;
-  unsigned RD8:1;
-  unsigned RD9:1;
-  unsigned RD10:1;
-  unsigned RD11:1;
-} PORTDBITS;
-extern volatile PORTDBITS PORTDbits __attribute__((__sfr__));
-
-extern volatile unsigned int  LATD __attribute__((__sfr__));
-typedef struct tagLATDBITS {
-  unsigned LATD0:1;
-  unsigned LATD1:1;
-  unsigned LATD2:1;
-  unsigned LATD3:1;
-  unsigned LATD4:1;
-  unsigned LATD5:1;
-  unsigned LATD6:1;
-  unsigned LATD7:1;
-  unsigned LATD8:1;
-  unsigned LATD9:1;
-  unsigned LATD10:1;
-  unsigned LATD11:1;
-} LATDBITS;
-extern volatile LATDBITS LATDbits __attribute__((__sfr__));
-
-extern volatile unsigned int  ODCD __attribute__((__sfr__));
-typedef struct tagODCDBITS {
-  unsigned ODD0:1;
-  unsigned ODD1:1;
-  unsigned ODD2:1;
-  unsigned ODD3:1;
-  unsigned ODD4:1;
-  unsigned ODD5:1;
-  unsigned ODD6:1;
-  unsigned ODD7:1;
-  unsigned ODD8:1;
-  unsigned ODD9:1;
-  unsigned ODD10:1;
-  unsigned ODD11:1;
-} ODCDBITS;
-extern volatile ODCDBITS ODCDbits __attribute__((__sfr__));
-
-extern volatile unsigned int  TRISE __attribute__((__sfr__));
-typedef struct tagTRISEBITS {
-  unsigned TRISE0:1;
-  unsigned TRISE1:1;
-  unsigned TRISE2:1;
-  unsigned TRISE3:1;
-  unsigned TRISE4:1;
-  unsigned TRISE5:1;
-  unsigned TRISE6:1;
-  unsigned TRISE7:1;
-} TRISEBITS;
-extern volatile TRISEBITS TRISEbits __attribute__((__sfr__));
-
-extern volatile unsigned int  PORTE __attribute__((__sfr__));
-typedef struct tagPORTEBITS {
-  unsigned RE0:1;
-  unsigned RE1:1;
-  unsigned RE2:1;
-  unsigned RE3:1;
-  unsigned RE4:1;
-  unsigned RE5:1;
-  unsigned RE6:1;
-  unsigned RE7:1;
-} PORTEBITS;
-extern volatile PORTEBITS PORTEbits __attribute__((__sfr__));
-
-extern volatile unsigned int  LATE __attribute__((__sfr__));
-typedef struct tagLATEBITS {
-  unsigned LATE0:1;
-  unsigned LATE1:1;
-  unsigned LATE2:1;
-  unsigned LATE3:1;
-  unsigned LATE4:1;
-  unsigned LATE5:1;
-  unsigned LATE6:1;
-  unsigned LATE7:1;
-} LATEBITS;
-extern volatile LATEBITS LATEbits __attribute__((__sfr__));
-
-extern volatile unsigned int  ODCE __attribute__((__sfr__));
-typedef struct tagODCEBITS {
-  unsigned ODE0:1;
-  unsigned ODE1:1;
-  unsigned ODE2:1;
-  unsigned ODE3:1;
-  unsigned ODE4:1;
-  unsigned ODE5:1;
-  unsigned ODE6:1;
-  unsigned ODE7:1;
-} ODCEBITS;
-extern volatile ODCEBITS ODCEbits __attribute__((__sfr__));
-
-extern volatile unsigned int  TRISF __attribute__((__sfr__));
-typedef struct tagTRISFBITS {
-  unsigned TRISF0:1;
-  unsigned TRISF1:1;
-  unsigned :1;
-  unsigned TRISF3:1;
-  unsigned TRISF4:1;
-  unsigned TRISF5:1;
-} TRISFBITS;
-extern volatile TRISFBITS TRISFbits __attribute__((__sfr__));
-
-extern volatile unsigned int  PORTF __attribute__((__sfr__));
-typedef struct tagPORTFBITS {
-  unsigned RF0:1;
-  unsigned RF1:1;
-  unsigned :1;
-  unsigned RF3:1;
-  unsigned RF4:1;
-  unsigned RF5:1;
-} PORTFBITS;
-extern volatile PORTFBITS PORTFbits __attribute__((__sfr__));
-
-extern volatile unsigned int  LATF __attribute__((__sfr__));
-typedef struct tagLATFBITS {
-  unsigned LATF0:1;
-  unsigned LATF1:1;
-  unsigned :1;
-  unsigned LATF3:1;
-  unsigned LATF4:1;
-  unsigned LATF5:1;
-} LATFBITS;
-extern volatile LATFBITS LATFbits __attribute__((__sfr__));
-
-extern volatile unsigned int  ODCF __attribute__((__sfr__));
-typedef struct tagODCFBITS {
-  unsigned ODF0:1;
-  unsigned ODF1:1;
-  unsigned :1;
-  unsigned ODF3:1;
-  unsigned ODF4:1;
-  unsigned ODF5:1;
-} ODCFBITS;
-extern volatile ODCFBITS ODCFbits __attribute__((__sfr__));
-
-extern volatile unsigned int  TRISG __attribute__((__sfr__));
-typedef struct tagTRISGBITS {
-  unsigned :2;
-  unsigned TRISG2:1;
-  unsigned TRISG3:1;
-  unsigned :2;
-  unsigned TRISG6:1;
-  unsigned TRISG7:1;
-  unsigned TRISG8:1;
-  unsigned TRISG9:1;
-} TRISGBITS;
-extern volatile TRISGBITS TRISGbits __attribute__((__sfr__));
-
-extern volatile unsigned int  PORTG __attribute__((__sfr__));
-typedef struct tagPORTGBITS {
-  unsigned :2;
-  unsigned RG2:1;
-  unsigned RG3:1;
-  unsigned :2;
-  unsigned RG6:1;
-  unsigned RG7:1;
-  unsigned RG8:1;
-  unsigned RG9:1;
-} PORTGBITS;
-extern volatile PORTGBITS PORTGbits __attribute__((__sfr__));
-
-extern volatile unsigned int  LATG __attribute__((__sfr__));
-typedef struct tagLATGBITS {
-  unsigned :2;
-  unsigned LATG2:1;
-  unsigned LATG3:1;
-  unsigned :2;
-  unsigned LATG6:1;
-  unsigned LATG7:1;
-  unsigned LATG8:1;
-  unsigned LATG9:1;
-} LATGBITS;
-extern volatile LATGBITS LATGbits __attribute__((__sfr__));
-
-extern volatile unsigned int  ODCG __attribute__((__sfr__));
-typedef struct tagODCGBITS {
-  unsigned :2;
-  unsigned ODG2:1;
-  unsigned ODG3:1;
-  unsigned :2;
-  unsigned ODG6:1;
-  unsigned ODG7:1;
-  unsigned ODG8:1;
-  unsigned ODG9:1;
-} ODCGBITS;
-extern volatile ODCGBITS ODCGbits __attribute__((__sfr__));
-
-extern volatile unsigned int  PADCFG1 __attribute__((__sfr__));
-__extension__ typedef struct tagPADCFG1BITS {
-  union {
-    struct {
-      unsigned PMPTTL:1;
-      unsigned RTSECSEL:1;
-    };
-    struct {
-      unsigned :1;
-      unsigned RTSECSEL0:1;
-    };
-  };
-} PADCFG1BITS;
-extern volatile PADCFG1BITS PADCFG1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  ADC1BUF0 __attribute__((__sfr__));
-extern volatile unsigned int  ADC1BUF1 __attribute__((__sfr__));
-extern volatile unsigned int  ADC1BUF2 __attribute__((__sfr__));
-extern volatile unsigned int  ADC1BUF3 __attribute__((__sfr__));
-extern volatile unsigned int  ADC1BUF4 __attribute__((__sfr__));
-extern volatile unsigned int  ADC1BUF5 __attribute__((__sfr__));
-extern volatile unsigned int  ADC1BUF6 __attribute__((__sfr__));
-extern volatile unsigned int  ADC1BUF7 __attribute__((__sfr__));
-extern volatile unsigned int  ADC1BUF8 __attribute__((__sfr__));
-extern volatile unsigned int  ADC1BUF9 __attribute__((__sfr__));
-extern volatile unsigned int  ADC1BUFA __attribute__((__sfr__));
-extern volatile unsigned int  ADC1BUFB __attribute__((__sfr__));
-extern volatile unsigned int  ADC1BUFC __attribute__((__sfr__));
-extern volatile unsigned int  ADC1BUFD __attribute__((__sfr__));
-extern volatile unsigned int  ADC1BUFE __attribute__((__sfr__));
-extern volatile unsigned int  ADC1BUFF __attribute__((__sfr__));
-extern volatile unsigned int  AD1CON1 __attribute__((__sfr__));
-__extension__ typedef struct tagAD1CON1BITS {
-  union {
-    struct {
-      unsigned DONE:1;
-      unsigned SAMP:1;
-      unsigned ASAM:1;
-      unsigned :2;
-      unsigned SSRC0:1;
-      unsigned SSRC1:1;
-      unsigned SSRC2:1;
-      unsigned FORM0:1;
-      unsigned FORM1:1;
-      unsigned :3;
-      unsigned ADSIDL:1;
-      unsigned :1;
-      unsigned ADON:1;
-    };
-    struct {
-      unsigned :5;
-      unsigned SSRC:3;
-      unsigned FORM:2;
-    };
-  };
-} AD1CON1BITS;
-extern volatile AD1CON1BITS AD1CON1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  AD1CON2 __attribute__((__sfr__));
-__extension__ typedef struct tagAD1CON2BITS {
-  union {
-    struct {
-      unsigned ALTS:1;
-      unsigned BUFM:1;
-      unsigned SMPI0:1;
-      unsigned SMPI1:1;
-      unsigned SMPI2:1;
-      unsigned SMPI3:1;
-      unsigned :1;
-      unsigned BUFS:1;
-      unsigned :2;
-      unsigned CSCNA:1;
-      unsigned :1;
-      unsigned OFFCAL:1;
-      unsigned VCFG0:1;
-      unsigned VCFG1:1;
-      unsigned VCFG2:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned SMPI:4;
-      unsigned :7;
-      unsigned VCFG:3;
-    };
-  };
-} AD1CON2BITS;
-extern volatile AD1CON2BITS AD1CON2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  AD1CON3 __attribute__((__sfr__));
-__extension__ typedef struct tagAD1CON3BITS {
-  union {
-    struct {
-      unsigned ADCS0:1;
-      unsigned ADCS1:1;
-      unsigned ADCS2:1;
-      unsigned ADCS3:1;
-      unsigned ADCS4:1;
-      unsigned ADCS5:1;
-      unsigned ADCS6:1;
-      unsigned ADCS7:1;
-      unsigned SAMC0:1;
-      unsigned SAMC1:1;
-      unsigned SAMC2:1;
-      unsigned SAMC3:1;
-      unsigned SAMC4:1;
-      unsigned :2;
-      unsigned ADRC:1;
-    };
-    struct {
-      unsigned ADCS:8;
-      unsigned SAMC:5;
-    };
-  };
-} AD1CON3BITS;
-extern volatile AD1CON3BITS AD1CON3bits __attribute__((__sfr__));
-
-extern volatile unsigned int  AD1CHS __attribute__((__sfr__));
-__extension__ typedef struct tagAD1CHSBITS {
-  union {
-    struct {
-      unsigned CH0SA0:1;
-      unsigned CH0SA1:1;
-      unsigned CH0SA2:1;
-      unsigned CH0SA3:1;
-      unsigned CH0SA4:1;
-      unsigned :2;
-      unsigned CH0NA:1;
-      unsigned CH0SB0:1;
-      unsigned CH0SB1:1;
-      unsigned CH0SB2:1;
-      unsigned CH0SB3:1;
-      unsigned CH0SB4:1;
-      unsigned :2;
-      unsigned CH0NB:1;
-    };
-    struct {
-      unsigned CH0SA:5;
-      unsigned :3;
-      unsigned CH0SB:5;
-    };
-  };
-} AD1CHSBITS;
-extern volatile AD1CHSBITS AD1CHSbits __attribute__((__sfr__));
-
-extern volatile unsigned int  AD1CHS0 __attribute__((__sfr__));
-__extension__ typedef struct tagAD1CHS0BITS {
-  union {
-    struct {
-      unsigned CH0SA0:1;
-      unsigned CH0SA1:1;
-      unsigned CH0SA2:1;
-      unsigned CH0SA3:1;
-      unsigned CH0SA4:1;
-      unsigned :2;
-      unsigned CH0NA:1;
-      unsigned CH0SB0:1;
-      unsigned CH0SB1:1;
-      unsigned CH0SB2:1;
-      unsigned CH0SB3:1;
-      unsigned CH0SB4:1;
-      unsigned :2;
-      unsigned CH0NB:1;
-    };
-    struct {
-      unsigned CH0SA:5;
-      unsigned :3;
-      unsigned CH0SB:5;
-    };
-  };
-} AD1CHS0BITS;
-extern volatile AD1CHS0BITS AD1CHS0bits __attribute__((__sfr__));
-
-extern volatile unsigned int  AD1PCFGH __attribute__((__sfr__));
-typedef struct tagAD1PCFGHBITS {
-  unsigned PCFG16:1;
-  unsigned PCFG17:1;
-} AD1PCFGHBITS;
-extern volatile AD1PCFGHBITS AD1PCFGHbits __attribute__((__sfr__));
-
-extern volatile unsigned int  AD1PCFG __attribute__((__sfr__));
-typedef struct tagAD1PCFGBITS {
-  unsigned PCFG0:1;
-  unsigned PCFG1:1;
-  unsigned PCFG2:1;
-  unsigned PCFG3:1;
-  unsigned PCFG4:1;
-  unsigned PCFG5:1;
-  unsigned PCFG6:1;
-  unsigned PCFG7:1;
-  unsigned PCFG8:1;
-  unsigned PCFG9:1;
-  unsigned PCFG10:1;
-  unsigned PCFG11:1;
-  unsigned PCFG12:1;
-  unsigned PCFG13:1;
-  unsigned PCFG14:1;
-  unsigned PCFG15:1;
-} AD1PCFGBITS;
-extern volatile AD1PCFGBITS AD1PCFGbits __attribute__((__sfr__));
-
-extern volatile unsigned int  AD1PCFGL __attribute__((__sfr__));
-typedef struct tagAD1PCFGLBITS {
-  unsigned PCFG0:1;
-  unsigned PCFG1:1;
-  unsigned PCFG2:1;
-  unsigned PCFG3:1;
-  unsigned PCFG4:1;
-  unsigned PCFG5:1;
-  unsigned PCFG6:1;
-  unsigned PCFG7:1;
-  unsigned PCFG8:1;
-  unsigned PCFG9:1;
-  unsigned PCFG10:1;
-  unsigned PCFG11:1;
-  unsigned PCFG12:1;
-  unsigned PCFG13:1;
-  unsigned PCFG14:1;
-  unsigned PCFG15:1;
-} AD1PCFGLBITS;
-extern volatile AD1PCFGLBITS AD1PCFGLbits __attribute__((__sfr__));
-
-extern volatile unsigned int  AD1CSSL __attribute__((__sfr__));
-typedef struct tagAD1CSSLBITS {
-  unsigned CSSL0:1;
-  unsigned CSSL1:1;
-  unsigned CSSL2:1;
-  unsigned CSSL3:1;
-  unsigned CSSL4:1;
-  unsigned CSSL5:1;
-  unsigned CSSL6:1;
-  unsigned CSSL7:1;
-  unsigned CSSL8:1;
-  unsigned CSSL9:1;
-  unsigned CSSL10:1;
-  unsigned CSSL11:1;
-  unsigned CSSL12:1;
-  unsigned CSSL13:1;
-  unsigned CSSL14:1;
-  unsigned CSSL15:1;
-} AD1CSSLBITS;
-extern volatile AD1CSSLBITS AD1CSSLbits __attribute__((__sfr__));
-
-extern volatile unsigned int  AD1CSSH __attribute__((__sfr__));
-typedef struct tagAD1CSSHBITS {
-  unsigned CSSL16:1;
-  unsigned CSSL17:1;
-} AD1CSSHBITS;
-extern volatile AD1CSSHBITS AD1CSSHbits __attribute__((__sfr__));
-
-extern volatile unsigned int  CTMUCON __attribute__((__sfr__));
-__extension__ typedef struct tagCTMUCONBITS {
-  union {
-    struct {
-      unsigned EDG1STAT:1;
-      unsigned EDG2STAT:1;
-      unsigned EDG1SEL0:1;
-      unsigned EDG1SEL1:1;
-      unsigned EDG1POL:1;
-      unsigned EDG2SEL0:1;
-      unsigned EDG2SEL1:1;
-      unsigned EDG2POL:1;
-      unsigned CTTRIG:1;
-      unsigned IDISSEN:1;
-      unsigned EDGSEQEN:1;
-      unsigned EDGEN:1;
-      unsigned TGEN:1;
-      unsigned CTMUSIDL:1;
-      unsigned :1;
-      unsigned CTMUEN:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EDG1SEL:2;
-      unsigned :1;
-      unsigned EDG2SEL:2;
-    };
-  };
-} CTMUCONBITS;
-extern volatile CTMUCONBITS CTMUCONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  CTMUICON __attribute__((__sfr__));
-__extension__ typedef struct tagCTMUICONBITS {
-  union {
-    struct {
-      unsigned :8;
-      unsigned IRNG0:1;
-      unsigned IRNG1:1;
-      unsigned ITRIM0:1;
-      unsigned ITRIM1:1;
-      unsigned ITRIM2:1;
-      unsigned ITRIM3:1;
-      unsigned ITRIM4:1;
-      unsigned ITRIM5:1;
-    };
-    struct {
-      unsigned :8;
-      unsigned IRNG:2;
-      unsigned ITRIM:6;
-    };
-  };
-} CTMUICONBITS;
-extern volatile CTMUICONBITS CTMUICONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1OTGIR __attribute__((__sfr__));
-typedef struct tagU1OTGIRBITS {
-  unsigned VBUSVDIF:1;
-  unsigned :1;
-  unsigned SESENDIF:1;
-  unsigned SESVDIF:1;
-  unsigned ACTVIF:1;
-  unsigned LSTATEIF:1;
-  unsigned T1MSECIF:1;
-  unsigned IDIF:1;
-} U1OTGIRBITS;
-extern volatile U1OTGIRBITS U1OTGIRbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1OTGIE __attribute__((__sfr__));
-typedef struct tagU1OTGIEBITS {
-  unsigned VBUSVDIE:1;
-  unsigned :1;
-  unsigned SESENDIE:1;
-  unsigned SESVDIE:1;
-  unsigned ACTVIE:1;
-  unsigned LSTATEIE:1;
-  unsigned T1MSECIE:1;
-  unsigned IDIE:1;
-} U1OTGIEBITS;
-extern volatile U1OTGIEBITS U1OTGIEbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1OTGSTAT __attribute__((__sfr__));
-typedef struct tagU1OTGSTATBITS {
-  unsigned VBUSVD:1;
-  unsigned :1;
-  unsigned SESEND:1;
-  unsigned SESVD:1;
-  unsigned :1;
-  unsigned LSTATE:1;
-  unsigned :1;
-  unsigned ID:1;
-} U1OTGSTATBITS;
-extern volatile U1OTGSTATBITS U1OTGSTATbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1OTGCON __attribute__((__sfr__));
-typedef struct tagU1OTGCONBITS {
-  unsigned VBUSDIS:1;
-  unsigned VBUSCHG:1;
-  unsigned OTGEN:1;
-  unsigned VBUSON:1;
-  unsigned DMPULDWN:1;
-  unsigned DPPULDWN:1;
-  unsigned DMPULUP:1;
-  unsigned DPPULUP:1;
-} U1OTGCONBITS;
-extern volatile U1OTGCONBITS U1OTGCONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1PWRC __attribute__((__sfr__));
-__extension__ typedef struct tagU1PWRCBITS {
-  union {
-    struct {
-      unsigned USBPWR:1;
-      unsigned USUSPEND:1;
-      unsigned :2;
-      unsigned USLPGRD:1;
-      unsigned :2;
-      unsigned UACTPND:1;
-    };
-    struct {
-      unsigned :1;
-      unsigned USUSPND:1;
-    };
-  };
-} U1PWRCBITS;
-extern volatile U1PWRCBITS U1PWRCbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1IR __attribute__((__sfr__));
-__extension__ typedef struct tagU1IRBITS {
-  union {
-    struct {
-      unsigned DETACHIF:1;
-      unsigned UERRIF:1;
-      unsigned SOFIF:1;
-      unsigned TRNIF:1;
-      unsigned IDLEIF:1;
-      unsigned RESUMEIF:1;
-      unsigned ATTACHIF:1;
-      unsigned STALLIF:1;
-    };
-    struct {
-      unsigned URSTIF:1;
-    };
-  };
-} U1IRBITS;
-extern volatile U1IRBITS U1IRbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1IE __attribute__((__sfr__));
-__extension__ typedef struct tagU1IEBITS {
-  union {
-    struct {
-      unsigned DETACHIE:1;
-      unsigned UERRIE:1;
-      unsigned SOFIE:1;
-      unsigned TRNIE:1;
-      unsigned IDLEIE:1;
-      unsigned RESUMEIE:1;
-      unsigned ATTACHIE:1;
-      unsigned STALLIE:1;
-    };
-    struct {
-      unsigned URSTIE:1;
-    };
-  };
-} U1IEBITS;
-extern volatile U1IEBITS U1IEbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EIR __attribute__((__sfr__));
-__extension__ typedef struct tagU1EIRBITS {
-  union {
-    struct {
-      unsigned PIDEF:1;
-      unsigned CRC5EF:1;
-      unsigned CRC16EF:1;
-      unsigned DFN8EF:1;
-      unsigned BTOEF:1;
-      unsigned DMAEF:1;
-      unsigned :1;
-      unsigned BTSEF:1;
-    };
-    struct {
-      unsigned :1;
-      unsigned EOFEF:1;
-    };
-  };
-} U1EIRBITS;
-extern volatile U1EIRBITS U1EIRbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EIE __attribute__((__sfr__));
-__extension__ typedef struct tagU1EIEBITS {
-  union {
-    struct {
-      unsigned PIDEE:1;
-      unsigned CRC5EE:1;
-      unsigned CRC16EE:1;
-      unsigned DFN8EE:1;
-      unsigned BTOEE:1;
-      unsigned DMAEE:1;
-      unsigned :1;
-      unsigned BTSEE:1;
-    };
-    struct {
-      unsigned :1;
-      unsigned EOFEE:1;
-    };
-  };
-} U1EIEBITS;
-extern volatile U1EIEBITS U1EIEbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1STAT __attribute__((__sfr__));
-__extension__ typedef struct tagU1STATBITS {
-  union {
-    struct {
-      unsigned :2;
-      unsigned PPBI:1;
-      unsigned DIR:1;
-      unsigned ENDPT0:1;
-      unsigned ENDPT1:1;
-      unsigned ENDPT2:1;
-      unsigned ENDPT3:1;
-    };
-    struct {
-      unsigned :4;
-      unsigned ENDPT:4;
-    };
-  };
-} U1STATBITS;
-extern volatile U1STATBITS U1STATbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1CON __attribute__((__sfr__));
-__extension__ typedef struct tagU1CONBITS {
-  union {
-    struct {
-      unsigned USBEN:1;
-      unsigned PPBRST:1;
-      unsigned RESUME:1;
-      unsigned HOSTEN:1;
-      unsigned USBRST:1;
-      unsigned PKTDIS:1;
-      unsigned SE0:1;
-      unsigned JSTATE:1;
-    };
-    struct {
-      unsigned SOFEN:1;
-      unsigned :4;
-      unsigned TOKBUSY:1;
-    };
-  };
-} U1CONBITS;
-extern volatile U1CONBITS U1CONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1ADDR __attribute__((__sfr__));
-__extension__ typedef struct tagU1ADDRBITS {
-  union {
-    struct {
-      unsigned DEVADDR0:1;
-      unsigned DEVADDR1:1;
-      unsigned DEVADDR2:1;
-      unsigned DEVADDR3:1;
-      unsigned DEVADDR4:1;
-      unsigned DEVADDR5:1;
-      unsigned DEVADDR6:1;
-      unsigned LOWSPDEN:1;
-    };
-    struct {
-      unsigned DEVADDR:7;
-      unsigned LSPDEN:1;
-    };
-  };
-} U1ADDRBITS;
-extern volatile U1ADDRBITS U1ADDRbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1BDTP1 __attribute__((__sfr__));
-typedef struct tagU1BDTP1BITS {
-  unsigned :1;
-  unsigned BDTPTRL:7;
-} U1BDTP1BITS;
-extern volatile U1BDTP1BITS U1BDTP1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1FRML __attribute__((__sfr__));
-typedef struct tagU1FRMLBITS {
-  unsigned FRM0:1;
-  unsigned FRM1:1;
-  unsigned FRM2:1;
-  unsigned FRM3:1;
-  unsigned FRM4:1;
-  unsigned FRM5:1;
-  unsigned FRM6:1;
-  unsigned FRM7:1;
-} U1FRMLBITS;
-extern volatile U1FRMLBITS U1FRMLbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1FRMH __attribute__((__sfr__));
-typedef struct tagU1FRMHBITS {
-  unsigned FRM8:1;
-  unsigned FRM9:1;
-  unsigned FRM10:1;
-} U1FRMHBITS;
-extern volatile U1FRMHBITS U1FRMHbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1TOK __attribute__((__sfr__));
-__extension__ typedef struct tagU1TOKBITS {
-  union {
-    struct {
-      unsigned EP0:1;
-      unsigned EP1:1;
-      unsigned EP2:1;
-      unsigned EP3:1;
-      unsigned PID0:1;
-      unsigned PID1:1;
-      unsigned PID2:1;
-      unsigned PID3:1;
-    };
-    struct {
-      unsigned EP:4;
-      unsigned PID:4;
-    };
-  };
-} U1TOKBITS;
-extern volatile U1TOKBITS U1TOKbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1SOF __attribute__((__sfr__));
-typedef struct tagU1SOFBITS {
-  unsigned CNT:8;
-} U1SOFBITS;
-extern volatile U1SOFBITS U1SOFbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1BDTP2 __attribute__((__sfr__));
-typedef struct tagU1BDTP2BITS {
-  unsigned BDTPTRH:8;
-} U1BDTP2BITS;
-extern volatile U1BDTP2BITS U1BDTP2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1BDTP3 __attribute__((__sfr__));
-typedef struct tagU1BDTP3BITS {
-  unsigned BDTPTRU:8;
-} U1BDTP3BITS;
-extern volatile U1BDTP3BITS U1BDTP3bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1CNFG1 __attribute__((__sfr__));
-__extension__ typedef struct tagU1CNFG1BITS {
-  union {
-    struct {
-      unsigned PPB0:1;
-      unsigned PPB1:1;
-      unsigned :2;
-      unsigned USBSIDL:1;
-      unsigned :1;
-      unsigned UOEMON:1;
-      unsigned UTEYE:1;
-    };
-    struct {
-      unsigned PPB:2;
-    };
-  };
-} U1CNFG1BITS;
-extern volatile U1CNFG1BITS U1CNFG1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1CNFG2 __attribute__((__sfr__));
-typedef struct tagU1CNFG2BITS {
-  unsigned UTRDIS:1;
-  unsigned UVCMPDIS:1;
-  unsigned UVBUSDIS:1;
-  unsigned EXTI2CEN:1;
-} U1CNFG2BITS;
-extern volatile U1CNFG2BITS U1CNFG2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EP0 __attribute__((__sfr__));
-__extension__ typedef struct tagU1EP0BITS {
-  union {
-    struct {
-      unsigned EPHSHK:1;
-      unsigned EPSTALL:1;
-      unsigned EPINEN:1;
-      unsigned EPOUTEN:1;
-      unsigned EPCONDIS:1;
-      unsigned :1;
-      unsigned RETRYDIS:1;
-      unsigned LOWSPD:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EPTXEN:1;
-      unsigned EPRXEN:1;
-      unsigned :3;
-      unsigned LSPD:1;
-    };
-  };
-} U1EP0BITS;
-extern volatile U1EP0BITS U1EP0bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EP1 __attribute__((__sfr__));
-__extension__ typedef struct tagU1EP1BITS {
-  union {
-    struct {
-      unsigned EPHSHK:1;
-      unsigned EPSTALL:1;
-      unsigned EPINEN:1;
-      unsigned EPOUTEN:1;
-      unsigned EPCONDIS:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EPTXEN:1;
-      unsigned EPRXEN:1;
-    };
-  };
-} U1EP1BITS;
-extern volatile U1EP1BITS U1EP1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EP2 __attribute__((__sfr__));
-__extension__ typedef struct tagU1EP2BITS {
-  union {
-    struct {
-      unsigned EPHSHK:1;
-      unsigned EPSTALL:1;
-      unsigned EPINEN:1;
-      unsigned EPOUTEN:1;
-      unsigned EPCONDIS:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EPTXEN:1;
-      unsigned EPRXEN:1;
-    };
-  };
-} U1EP2BITS;
-extern volatile U1EP2BITS U1EP2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EP3 __attribute__((__sfr__));
-__extension__ typedef struct tagU1EP3BITS {
-  union {
-    struct {
-      unsigned EPHSHK:1;
-      unsigned EPSTALL:1;
-      unsigned EPINEN:1;
-      unsigned EPOUTEN:1;
-      unsigned EPCONDIS:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EPTXEN:1;
-      unsigned EPRXEN:1;
-    };
-  };
-} U1EP3BITS;
-extern volatile U1EP3BITS U1EP3bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EP4 __attribute__((__sfr__));
-__extension__ typedef struct tagU1EP4BITS {
-  union {
-    struct {
-      unsigned EPHSHK:1;
-      unsigned EPSTALL:1;
-      unsigned EPINEN:1;
-      unsigned EPOUTEN:1;
-      unsigned EPCONDIS:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EPTXEN:1;
-      unsigned EPRXEN:1;
-    };
-  };
-} U1EP4BITS;
-extern volatile U1EP4BITS U1EP4bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EP5 __attribute__((__sfr__));
-__extension__ typedef struct tagU1EP5BITS {
-  union {
-    struct {
-      unsigned EPHSHK:1;
-      unsigned EPSTALL:1;
-      unsigned EPINEN:1;
-      unsigned EPOUTEN:1;
-      unsigned EPCONDIS:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EPTXEN:1;
-      unsigned EPRXEN:1;
-    };
-  };
-} U1EP5BITS;
-extern volatile U1EP5BITS U1EP5bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EP6 __attribute__((__sfr__));
-__extension__ typedef struct tagU1EP6BITS {
-  union {
-    struct {
-      unsigned EPHSHK:1;
-      unsigned EPSTALL:1;
-      unsigned EPINEN:1;
-      unsigned EPOUTEN:1;
-      unsigned EPCONDIS:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EPTXEN:1;
-      unsigned EPRXEN:1;
-    };
-  };
-} U1EP6BITS;
-extern volatile U1EP6BITS U1EP6bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EP7 __attribute__((__sfr__));
-__extension__ typedef struct tagU1EP7BITS {
-  union {
-    struct {
-      unsigned EPHSHK:1;
-      unsigned EPSTALL:1;
-      unsigned EPINEN:1;
-      unsigned EPOUTEN:1;
-      unsigned EPCONDIS:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EPTXEN:1;
-      unsigned EPRXEN:1;
-    };
-  };
-} U1EP7BITS;
-extern volatile U1EP7BITS U1EP7bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EP8 __attribute__((__sfr__));
-__extension__ typedef struct tagU1EP8BITS {
-  union {
-    struct {
-      unsigned EPHSHK:1;
-      unsigned EPSTALL:1;
-      unsigned EPINEN:1;
-      unsigned EPOUTEN:1;
-      unsigned EPCONDIS:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EPTXEN:1;
-      unsigned EPRXEN:1;
-    };
-  };
-} U1EP8BITS;
-extern volatile U1EP8BITS U1EP8bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EP9 __attribute__((__sfr__));
-__extension__ typedef struct tagU1EP9BITS {
-  union {
-    struct {
-      unsigned EPHSHK:1;
-      unsigned EPSTALL:1;
-      unsigned EPINEN:1;
-      unsigned EPOUTEN:1;
-      unsigned EPCONDIS:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EPTXEN:1;
-      unsigned EPRXEN:1;
-    };
-  };
-} U1EP9BITS;
-extern volatile U1EP9BITS U1EP9bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EP10 __attribute__((__sfr__));
-__extension__ typedef struct tagU1EP10BITS {
-  union {
-    struct {
-      unsigned EPHSHK:1;
-      unsigned EPSTALL:1;
-      unsigned EPINEN:1;
-      unsigned EPOUTEN:1;
-      unsigned EPCONDIS:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EPTXEN:1;
-      unsigned EPRXEN:1;
-    };
-  };
-} U1EP10BITS;
-extern volatile U1EP10BITS U1EP10bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EP11 __attribute__((__sfr__));
-__extension__ typedef struct tagU1EP11BITS {
-  union {
-    struct {
-      unsigned EPHSHK:1;
-      unsigned EPSTALL:1;
-      unsigned EPINEN:1;
-      unsigned EPOUTEN:1;
-      unsigned EPCONDIS:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EPTXEN:1;
-      unsigned EPRXEN:1;
-    };
-  };
-} U1EP11BITS;
-extern volatile U1EP11BITS U1EP11bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EP12 __attribute__((__sfr__));
-__extension__ typedef struct tagU1EP12BITS {
-  union {
-    struct {
-      unsigned EPHSHK:1;
-      unsigned EPSTALL:1;
-      unsigned EPINEN:1;
-      unsigned EPOUTEN:1;
-      unsigned EPCONDIS:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EPTXEN:1;
-      unsigned EPRXEN:1;
-    };
-  };
-} U1EP12BITS;
-extern volatile U1EP12BITS U1EP12bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EP13 __attribute__((__sfr__));
-__extension__ typedef struct tagU1EP13BITS {
-  union {
-    struct {
-      unsigned EPHSHK:1;
-      unsigned EPSTALL:1;
-      unsigned EPINEN:1;
-      unsigned EPOUTEN:1;
-      unsigned EPCONDIS:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EPTXEN:1;
-      unsigned EPRXEN:1;
-    };
-  };
-} U1EP13BITS;
-extern volatile U1EP13BITS U1EP13bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EP14 __attribute__((__sfr__));
-__extension__ typedef struct tagU1EP14BITS {
-  union {
-    struct {
-      unsigned EPHSHK:1;
-      unsigned EPSTALL:1;
-      unsigned EPINEN:1;
-      unsigned EPOUTEN:1;
-      unsigned EPCONDIS:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EPTXEN:1;
-      unsigned EPRXEN:1;
-    };
-  };
-} U1EP14BITS;
-extern volatile U1EP14BITS U1EP14bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1EP15 __attribute__((__sfr__));
-__extension__ typedef struct tagU1EP15BITS {
-  union {
-    struct {
-      unsigned EPHSHK:1;
-      unsigned EPSTALL:1;
-      unsigned EPINEN:1;
-      unsigned EPOUTEN:1;
-      unsigned EPCONDIS:1;
-    };
-    struct {
-      unsigned :2;
-      unsigned EPTXEN:1;
-      unsigned EPRXEN:1;
-    };
-  };
-} U1EP15BITS;
-extern volatile U1EP15BITS U1EP15bits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1PWMRRS __attribute__((__sfr__));
-__extension__ typedef struct tagU1PWMRRSBITS {
-  union {
-    struct {
-      unsigned USBRS0:1;
-      unsigned USBRS1:1;
-      unsigned USBRS2:1;
-      unsigned USBRS3:1;
-      unsigned USBRS4:1;
-      unsigned USBRS5:1;
-      unsigned USBRS6:1;
-      unsigned USBRS7:1;
-      unsigned USBR0:1;
-      unsigned USBR1:1;
-      unsigned USBR2:1;
-      unsigned USBR3:1;
-      unsigned USBR4:1;
-      unsigned USBR5:1;
-      unsigned USBR6:1;
-      unsigned USBR7:1;
-    };
-    struct {
-      unsigned USBRS:8;
-      unsigned USBR:8;
-    };
-    struct {
-      unsigned PER:8;
-      unsigned DC:8;
-    };
-    struct {
-      unsigned PER0:1;
-      unsigned PER1:1;
-      unsigned PER2:1;
-      unsigned PER3:1;
-      unsigned PER4:1;
-      unsigned PER5:1;
-      unsigned PER6:1;
-      unsigned PER7:1;
-      unsigned DC0:1;
-      unsigned DC1:1;
-      unsigned DC2:1;
-      unsigned DC3:1;
-      unsigned DC4:1;
-      unsigned DC5:1;
-      unsigned DC6:1;
-      unsigned DC7:1;
-    };
-  };
-} U1PWMRRSBITS;
-extern volatile U1PWMRRSBITS U1PWMRRSbits __attribute__((__sfr__));
-
-extern volatile unsigned int  U1PWMCON __attribute__((__sfr__));
-__extension__ typedef struct tagU1PWMCONBITS {
-  union {
-    struct {
-      unsigned :8;
-      unsigned CNTEN:1;
-      unsigned PWMPOL:1;
-      unsigned USBTSEL0:1;
-      unsigned USBTSEL1:1;
-      unsigned USBTSEL2:1;
-      unsigned :2;
-      unsigned PWMEN:1;
-    };
-    struct {
-      unsigned :10;
-      unsigned USBTSEL:3;
-    };
-  };
-} U1PWMCONBITS;
-extern volatile U1PWMCONBITS U1PWMCONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  PMCON __attribute__((__sfr__));
-__extension__ typedef struct tagPMCONBITS {
-  union {
-    struct {
-      unsigned RDSP:1;
-      unsigned WRSP:1;
-      unsigned BEP:1;
-      unsigned CS1P:1;
-      unsigned CS2P:1;
-      unsigned ALP:1;
-      unsigned CSF0:1;
-      unsigned CSF1:1;
-      unsigned PTRDEN:1;
-      unsigned PTWREN:1;
-      unsigned PTBEEN:1;
-      unsigned ADRMUX0:1;
-      unsigned ADRMUX1:1;
-      unsigned PSIDL:1;
-      unsigned :1;
-      unsigned PMPEN:1;
-    };
-    struct {
-      unsigned :6;
-      unsigned CSF:2;
-      unsigned :3;
-      unsigned ADRMUX:2;
-    };
-  };
-} PMCONBITS;
-extern volatile PMCONBITS PMCONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  PMMODE __attribute__((__sfr__));
-__extension__ typedef struct tagPMMODEBITS {
-  union {
-    struct {
-      unsigned WAITE0:1;
-      unsigned WAITE1:1;
-      unsigned WAITM0:1;
-      unsigned WAITM1:1;
-      unsigned WAITM2:1;
-      unsigned WAITM3:1;
-      unsigned WAITB0:1;
-      unsigned WAITB1:1;
-      unsigned MODE0:1;
-      unsigned MODE1:1;
-      unsigned MODE16:1;
-      unsigned INCM0:1;
-      unsigned INCM1:1;
-      unsigned IRQM0:1;
-      unsigned IRQM1:1;
-      unsigned BUSY:1;
-    };
-    struct {
-      unsigned WAITE:2;
-      unsigned WAITM:4;
-      unsigned WAITB:2;
-      unsigned MODE:2;
-      unsigned :1;
-      unsigned INCM:2;
-      unsigned IRQM:2;
-    };
-  };
-} PMMODEBITS;
-extern volatile PMMODEBITS PMMODEbits __attribute__((__sfr__));
-
-extern volatile unsigned int  PMADDR __attribute__((__sfr__));
-__extension__ typedef struct tagPMADDRBITS {
-  union {
-    struct {
-      unsigned :14;
-      unsigned CS1:1;
-      unsigned CS2:1;
-    };
-    struct {
-      unsigned ADDR:14;
-      unsigned CS:2;
-    };
-  };
-} PMADDRBITS;
-extern volatile PMADDRBITS PMADDRbits __attribute__((__sfr__));
-
-extern volatile unsigned int  PMDOUT1 __attribute__((__sfr__));
-__extension__ typedef struct tagPMDOUT1BITS {
-  union {
-    struct {
-      unsigned :14;
-      unsigned CS1:1;
-      unsigned CS2:1;
-    };
-    struct {
-      unsigned ADDR:14;
-      unsigned CS:2;
-    };
-  };
-} PMDOUT1BITS;
-extern volatile PMDOUT1BITS PMDOUT1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  PMDOUT2 __attribute__((__sfr__));
-extern volatile unsigned int  PMDIN1 __attribute__((__sfr__));
-extern volatile unsigned int  PMDIN2 __attribute__((__sfr__));
-extern volatile unsigned int  PMAEN __attribute__((__sfr__));
-typedef struct tagPMAENBITS {
-  unsigned PTEN0:1;
-  unsigned PTEN1:1;
-  unsigned PTEN2:1;
-  unsigned PTEN3:1;
-  unsigned PTEN4:1;
-  unsigned PTEN5:1;
-  unsigned PTEN6:1;
-  unsigned PTEN7:1;
-  unsigned PTEN8:1;
-  unsigned PTEN9:1;
-  unsigned PTEN10:1;
-  unsigned PTEN11:1;
-  unsigned PTEN12:1;
-  unsigned PTEN13:1;
-  unsigned PTEN14:1;
-  unsigned PTEN15:1;
-} PMAENBITS;
-extern volatile PMAENBITS PMAENbits __attribute__((__sfr__));
-
-extern volatile unsigned int  PMSTAT __attribute__((__sfr__));
-typedef struct tagPMSTATBITS {
-  unsigned OB0E:1;
-  unsigned OB1E:1;
-  unsigned OB2E:1;
-  unsigned OB3E:1;
-  unsigned :2;
-  unsigned OBUF:1;
-  unsigned OBE:1;
-  unsigned IB0F:1;
-  unsigned IB1F:1;
-  unsigned IB2F:1;
-  unsigned IB3F:1;
-  unsigned :2;
-  unsigned IBOV:1;
-  unsigned IBF:1;
-} PMSTATBITS;
-extern volatile PMSTATBITS PMSTATbits __attribute__((__sfr__));
-
-extern volatile unsigned int  ALRMVAL __attribute__((__sfr__));
-extern volatile unsigned int  ALCFGRPT __attribute__((__sfr__));
-__extension__ typedef struct tagALCFGRPTBITS {
-  union {
-    struct {
-      unsigned ARPT0:1;
-      unsigned ARPT1:1;
-      unsigned ARPT2:1;
-      unsigned ARPT3:1;
-      unsigned ARPT4:1;
-      unsigned ARPT5:1;
-      unsigned ARPT6:1;
-      unsigned ARPT7:1;
-      unsigned ALRMPTR0:1;
-      unsigned ALRMPTR1:1;
-      unsigned AMASK0:1;
-      unsigned AMASK1:1;
-      unsigned AMASK2:1;
-      unsigned AMASK3:1;
-      unsigned CHIME:1;
-      unsigned ALRMEN:1;
-    };
-    struct {
-      unsigned ARPT:8;
-      unsigned ALRMPTR:2;
-      unsigned AMASK:4;
-    };
-  };
-} ALCFGRPTBITS;
-extern volatile ALCFGRPTBITS ALCFGRPTbits __attribute__((__sfr__));
-
-extern volatile unsigned int  RTCVAL __attribute__((__sfr__));
-extern volatile unsigned int  RCFGCAL __attribute__((__sfr__));
-__extension__ typedef struct tagRCFGCALBITS {
-  union {
-    struct {
-      unsigned CAL0:1;
-      unsigned CAL1:1;
-      unsigned CAL2:1;
-      unsigned CAL3:1;
-      unsigned CAL4:1;
-      unsigned CAL5:1;
-      unsigned CAL6:1;
-      unsigned CAL7:1;
-      unsigned RTCPTR0:1;
-      unsigned RTCPTR1:1;
-      unsigned RTCOE:1;
-      unsigned HALFSEC:1;
-      unsigned RTCSYNC:1;
-      unsigned RTCWREN:1;
-      unsigned :1;
-      unsigned RTCEN:1;
-    };
-    struct {
-      unsigned CAL:8;
-      unsigned RTCPTR:2;
-    };
-  };
-} RCFGCALBITS;
-extern volatile RCFGCALBITS RCFGCALbits __attribute__((__sfr__));
-
-extern volatile unsigned int  CMSTAT __attribute__((__sfr__));
-typedef struct tagCMSTATBITS {
-  unsigned C1OUT:1;
-  unsigned C2OUT:1;
-  unsigned C3OUT:1;
-  unsigned C4OUT:1;
-  unsigned C5OUT:1;
-  unsigned C6OUT:1;
-  unsigned :2;
-  unsigned C1EVT:1;
-  unsigned C2EVT:1;
-  unsigned C3EVT:1;
-  unsigned C4EVT:1;
-  unsigned C5EVT:1;
-  unsigned C6EVT:1;
-  unsigned :1;
-  unsigned CMIDL:1;
-} CMSTATBITS;
-extern volatile CMSTATBITS CMSTATbits __attribute__((__sfr__));
-
-extern volatile unsigned int  CVRCON __attribute__((__sfr__));
-__extension__ typedef struct tagCVRCONBITS {
-  union {
-    struct {
-      unsigned CVR0:1;
-      unsigned CVR1:1;
-      unsigned CVR2:1;
-      unsigned CVR3:1;
-      unsigned CVRSS:1;
-      unsigned CVRR:1;
-      unsigned CVROE:1;
-      unsigned CVREN:1;
-    };
-    struct {
-      unsigned CVR:4;
-    };
-  };
-} CVRCONBITS;
-extern volatile CVRCONBITS CVRCONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  CM1CON __attribute__((__sfr__));
-__extension__ typedef struct tagCM1CONBITS {
-  union {
-    struct {
-      unsigned CCH0:1;
-      unsigned CCH1:1;
-      unsigned :2;
-      unsigned CREF:1;
-      unsigned :1;
-      unsigned EVPOL0:1;
-      unsigned EVPOL1:1;
-      unsigned COUT:1;
-      unsigned CEVT:1;
-      unsigned :3;
-      unsigned CPOL:1;
-      unsigned COE:1;
-      unsigned CON:1;
-    };
-    struct {
-      unsigned CCH:2;
-      unsigned :4;
-      unsigned EVPOL:2;
-    };
-    struct {
-      unsigned :15;
-      unsigned CEN:1;
-    };
-  };
-} CM1CONBITS;
-extern volatile CM1CONBITS CM1CONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  CM2CON __attribute__((__sfr__));
-__extension__ typedef struct tagCM2CONBITS {
-  union {
-    struct {
-      unsigned CCH0:1;
-      unsigned CCH1:1;
-      unsigned :2;
-      unsigned CREF:1;
-      unsigned :1;
-      unsigned EVPOL0:1;
-      unsigned EVPOL1:1;
-      unsigned COUT:1;
-      unsigned CEVT:1;
-      unsigned :3;
-      unsigned CPOL:1;
-      unsigned COE:1;
-      unsigned CON:1;
-    };
-    struct {
-      unsigned CCH:2;
-      unsigned :4;
-      unsigned EVPOL:2;
-    };
-    struct {
-      unsigned :15;
-      unsigned CEN:1;
-    };
-  };
-} CM2CONBITS;
-extern volatile CM2CONBITS CM2CONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  CM3CON __attribute__((__sfr__));
-__extension__ typedef struct tagCM3CONBITS {
-  union {
-    struct {
-      unsigned CCH0:1;
-      unsigned CCH1:1;
-      unsigned :2;
-      unsigned CREF:1;
-      unsigned :1;
-      unsigned EVPOL0:1;
-      unsigned EVPOL1:1;
-      unsigned COUT:1;
-      unsigned CEVT:1;
-      unsigned :3;
-      unsigned CPOL:1;
-      unsigned COE:1;
-      unsigned CON:1;
-    };
-    struct {
-      unsigned CCH:2;
-      unsigned :4;
-      unsigned EVPOL:2;
-    };
-    struct {
-      unsigned :15;
-      unsigned CEN:1;
-    };
-  };
-} CM3CONBITS;
-extern volatile CM3CONBITS CM3CONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  CRCCON __attribute__((__sfr__));
-__extension__ typedef struct tagCRCCONBITS {
-  union {
-    struct {
-      unsigned PLEN0:1;
-      unsigned PLEN1:1;
-      unsigned PLEN2:1;
-      unsigned PLEN3:1;
-      unsigned CRCGO:1;
-      unsigned :1;
-      unsigned CRCMPT:1;
-      unsigned CRCFUL:1;
-      unsigned VWORD0:1;
-      unsigned VWORD1:1;
-      unsigned VWORD2:1;
-      unsigned VWORD3:1;
-      unsigned VWORD4:1;
-      unsigned CSIDL:1;
-    };
-    struct {
-      unsigned PLEN:4;
-      unsigned :4;
-      unsigned VWORD:5;
-    };
-  };
-} CRCCONBITS;
-extern volatile CRCCONBITS CRCCONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  CRCXOR __attribute__((__sfr__));
-typedef struct tagCRCXORBITS {
-  unsigned :1;
-  unsigned X1:1;
-  unsigned X2:1;
-  unsigned X3:1;
-  unsigned X4:1;
-  unsigned X5:1;
-  unsigned X6:1;
-  unsigned X7:1;
-  unsigned X8:1;
-  unsigned X9:1;
-  unsigned X10:1;
-  unsigned X11:1;
-  unsigned X12:1;
-  unsigned X13:1;
-  unsigned X14:1;
-  unsigned X15:1;
-} CRCXORBITS;
-extern volatile CRCXORBITS CRCXORbits __attribute__((__sfr__));
-
-extern volatile unsigned int  CRCDAT __attribute__((__sfr__));
-extern volatile unsigned int  CRCWDAT __attribute__((__sfr__));
-extern volatile unsigned int  RPINR0 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR0BITS {
-  union {
-    struct {
-      unsigned :8;
-      unsigned INT1R0:1;
-      unsigned INT1R1:1;
-      unsigned INT1R2:1;
-      unsigned INT1R3:1;
-      unsigned INT1R4:1;
-      unsigned INT1R5:1;
-    };
-    struct {
-      unsigned :8;
-      unsigned INT1R:6;
-    };
-  };
-} RPINR0BITS;
-extern volatile RPINR0BITS RPINR0bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR1 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR1BITS {
-  union {
-    struct {
-      unsigned INT2R0:1;
-      unsigned INT2R1:1;
-      unsigned INT2R2:1;
-      unsigned INT2R3:1;
-      unsigned INT2R4:1;
-      unsigned INT2R5:1;
-      unsigned :2;
-      unsigned INT3R0:1;
-      unsigned INT3R1:1;
-      unsigned INT3R2:1;
-      unsigned INT3R3:1;
-      unsigned INT3R4:1;
-      unsigned INT3R5:1;
-    };
-    struct {
-      unsigned INT2R:6;
-      unsigned :2;
-      unsigned INT3R:6;
-    };
-  };
-} RPINR1BITS;
-extern volatile RPINR1BITS RPINR1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR2 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR2BITS {
-  union {
-    struct {
-      unsigned INT4R0:1;
-      unsigned INT4R1:1;
-      unsigned INT4R2:1;
-      unsigned INT4R3:1;
-      unsigned INT4R4:1;
-      unsigned INT4R5:1;
-      unsigned :2;
-      unsigned T1CKR0:1;
-      unsigned T1CKR1:1;
-      unsigned T1CKR2:1;
-      unsigned T1CKR3:1;
-      unsigned T1CKR4:1;
-      unsigned T1CKR5:1;
-    };
-    struct {
-      unsigned INT4R:6;
-      unsigned :2;
-      unsigned T1CKR:6;
-    };
-  };
-} RPINR2BITS;
-extern volatile RPINR2BITS RPINR2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR3 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR3BITS {
-  union {
-    struct {
-      unsigned T2CKR0:1;
-      unsigned T2CKR1:1;
-      unsigned T2CKR2:1;
-      unsigned T2CKR3:1;
-      unsigned T2CKR4:1;
-      unsigned T2CKR5:1;
-      unsigned :2;
-      unsigned T3CKR0:1;
-      unsigned T3CKR1:1;
-      unsigned T3CKR2:1;
-      unsigned T3CKR3:1;
-      unsigned T3CKR4:1;
-      unsigned T3CKR5:1;
-    };
-    struct {
-      unsigned T2CKR:6;
-      unsigned :2;
-      unsigned T3CKR:6;
-    };
-  };
-} RPINR3BITS;
-extern volatile RPINR3BITS RPINR3bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR4 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR4BITS {
-  union {
-    struct {
-      unsigned T4CKR0:1;
-      unsigned T4CKR1:1;
-      unsigned T4CKR2:1;
-      unsigned T4CKR3:1;
-      unsigned T4CKR4:1;
-      unsigned T4CKR5:1;
-      unsigned :2;
-      unsigned T5CKR0:1;
-      unsigned T5CKR1:1;
-      unsigned T5CKR2:1;
-      unsigned T5CKR3:1;
-      unsigned T5CKR4:1;
-      unsigned T5CKR5:1;
-    };
-    struct {
-      unsigned T4CKR:6;
-      unsigned :2;
-      unsigned T5CKR:6;
-    };
-  };
-} RPINR4BITS;
-extern volatile RPINR4BITS RPINR4bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR7 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR7BITS {
-  union {
-    struct {
-      unsigned IC1R0:1;
-      unsigned IC1R1:1;
-      unsigned IC1R2:1;
-      unsigned IC1R3:1;
-      unsigned IC1R4:1;
-      unsigned IC1R5:1;
-      unsigned :2;
-      unsigned IC2R0:1;
-      unsigned IC2R1:1;
-      unsigned IC2R2:1;
-      unsigned IC2R3:1;
-      unsigned IC2R4:1;
-      unsigned IC2R5:1;
-    };
-    struct {
-      unsigned IC1R:6;
-      unsigned :2;
-      unsigned IC2R:6;
-    };
-  };
-} RPINR7BITS;
-extern volatile RPINR7BITS RPINR7bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR8 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR8BITS {
-  union {
-    struct {
-      unsigned IC3R0:1;
-      unsigned IC3R1:1;
-      unsigned IC3R2:1;
-      unsigned IC3R3:1;
-      unsigned IC3R4:1;
-      unsigned IC3R5:1;
-      unsigned :2;
-      unsigned IC4R0:1;
-      unsigned IC4R1:1;
-      unsigned IC4R2:1;
-      unsigned IC4R3:1;
-      unsigned IC4R4:1;
-      unsigned IC4R5:1;
-    };
-    struct {
-      unsigned IC3R:6;
-      unsigned :2;
-      unsigned IC4R:6;
-    };
-  };
-} RPINR8BITS;
-extern volatile RPINR8BITS RPINR8bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR9 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR9BITS {
-  union {
-    struct {
-      unsigned IC5R0:1;
-      unsigned IC5R1:1;
-      unsigned IC5R2:1;
-      unsigned IC5R3:1;
-      unsigned IC5R4:1;
-      unsigned IC5R5:1;
-      unsigned :2;
-      unsigned IC6R0:1;
-      unsigned IC6R1:1;
-      unsigned IC6R2:1;
-      unsigned IC6R3:1;
-      unsigned IC6R4:1;
-      unsigned IC6R5:1;
-    };
-    struct {
-      unsigned IC5R:6;
-      unsigned :2;
-      unsigned IC6R:6;
-    };
-  };
-} RPINR9BITS;
-extern volatile RPINR9BITS RPINR9bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR10 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR10BITS {
-  union {
-    struct {
-      unsigned IC7R0:1;
-      unsigned IC7R1:1;
-      unsigned IC7R2:1;
-      unsigned IC7R3:1;
-      unsigned IC7R4:1;
-      unsigned IC7R5:1;
-      unsigned :2;
-      unsigned IC8R0:1;
-      unsigned IC8R1:1;
-      unsigned IC8R2:1;
-      unsigned IC8R3:1;
-      unsigned IC8R4:1;
-      unsigned IC8R5:1;
-    };
-    struct {
-      unsigned IC7R:6;
-      unsigned :2;
-      unsigned IC8R:6;
-    };
-  };
-} RPINR10BITS;
-extern volatile RPINR10BITS RPINR10bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR11 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR11BITS {
-  union {
-    struct {
-      unsigned OCFAR0:1;
-      unsigned OCFAR1:1;
-      unsigned OCFAR2:1;
-      unsigned OCFAR3:1;
-      unsigned OCFAR4:1;
-      unsigned OCFAR5:1;
-      unsigned :2;
-      unsigned OCFBR0:1;
-      unsigned OCFBR1:1;
-      unsigned OCFBR2:1;
-      unsigned OCFBR3:1;
-      unsigned OCFBR4:1;
-      unsigned OCFBR5:1;
-    };
-    struct {
-      unsigned OCFAR:6;
-      unsigned :2;
-      unsigned OCFBR:6;
-    };
-  };
-} RPINR11BITS;
-extern volatile RPINR11BITS RPINR11bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR15 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR15BITS {
-  union {
-    struct {
-      unsigned :8;
-      unsigned IC9R0:1;
-      unsigned IC9R1:1;
-      unsigned IC9R2:1;
-      unsigned IC9R3:1;
-      unsigned IC9R4:1;
-      unsigned IC9R5:1;
-    };
-    struct {
-      unsigned :8;
-      unsigned IC9R:6;
-    };
-  };
-} RPINR15BITS;
-extern volatile RPINR15BITS RPINR15bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR17 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR17BITS {
-  union {
-    struct {
-      unsigned :8;
-      unsigned U3RXR0:1;
-      unsigned U3RXR1:1;
-      unsigned U3RXR2:1;
-      unsigned U3RXR3:1;
-      unsigned U3RXR4:1;
-      unsigned U3RXR5:1;
-    };
-    struct {
-      unsigned :8;
-      unsigned U3RXR:6;
-    };
-  };
-} RPINR17BITS;
-extern volatile RPINR17BITS RPINR17bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR18 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR18BITS {
-  union {
-    struct {
-      unsigned U1RXR0:1;
-      unsigned U1RXR1:1;
-      unsigned U1RXR2:1;
-      unsigned U1RXR3:1;
-      unsigned U1RXR4:1;
-      unsigned U1RXR5:1;
-      unsigned :2;
-      unsigned U1CTSR0:1;
-      unsigned U1CTSR1:1;
-      unsigned U1CTSR2:1;
-      unsigned U1CTSR3:1;
-      unsigned U1CTSR4:1;
-      unsigned U1CTSR5:1;
-    };
-    struct {
-      unsigned U1RXR:6;
-      unsigned :2;
-      unsigned U1CTSR:6;
-    };
-  };
-} RPINR18BITS;
-extern volatile RPINR18BITS RPINR18bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR19 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR19BITS {
-  union {
-    struct {
-      unsigned U2RXR0:1;
-      unsigned U2RXR1:1;
-      unsigned U2RXR2:1;
-      unsigned U2RXR3:1;
-      unsigned U2RXR4:1;
-      unsigned U2RXR5:1;
-      unsigned :2;
-      unsigned U2CTSR0:1;
-      unsigned U2CTSR1:1;
-      unsigned U2CTSR2:1;
-      unsigned U2CTSR3:1;
-      unsigned U2CTSR4:1;
-      unsigned U2CTSR5:1;
-    };
-    struct {
-      unsigned U2RXR:6;
-      unsigned :2;
-      unsigned U2CTSR:6;
-    };
-  };
-} RPINR19BITS;
-extern volatile RPINR19BITS RPINR19bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR20 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR20BITS {
-  union {
-    struct {
-      unsigned SDI1R0:1;
-      unsigned SDI1R1:1;
-      unsigned SDI1R2:1;
-      unsigned SDI1R3:1;
-      unsigned SDI1R4:1;
-      unsigned SDI1R5:1;
-      unsigned :2;
-      unsigned SCK1R0:1;
-      unsigned SCK1R1:1;
-      unsigned SCK1R2:1;
-      unsigned SCK1R3:1;
-      unsigned SCK1R4:1;
-      unsigned SCK1R5:1;
-    };
-    struct {
-      unsigned SDI1R:6;
-      unsigned :2;
-      unsigned SCK1R:6;
-    };
-  };
-} RPINR20BITS;
-extern volatile RPINR20BITS RPINR20bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR21 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR21BITS {
-  union {
-    struct {
-      unsigned SS1R0:1;
-      unsigned SS1R1:1;
-      unsigned SS1R2:1;
-      unsigned SS1R3:1;
-      unsigned SS1R4:1;
-      unsigned SS1R5:1;
-      unsigned :2;
-      unsigned U3CTSR0:1;
-      unsigned U3CTSR1:1;
-      unsigned U3CTSR2:1;
-      unsigned U3CTSR3:1;
-      unsigned U3CTSR4:1;
-      unsigned U3CTSR5:1;
-    };
-    struct {
-      unsigned SS1R:6;
-      unsigned :2;
-      unsigned U3CTSR:6;
-    };
-  };
-} RPINR21BITS;
-extern volatile RPINR21BITS RPINR21bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR22 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR22BITS {
-  union {
-    struct {
-      unsigned SDI2R0:1;
-      unsigned SDI2R1:1;
-      unsigned SDI2R2:1;
-      unsigned SDI2R3:1;
-      unsigned SDI2R4:1;
-      unsigned SDI2R5:1;
-      unsigned :2;
-      unsigned SCK2R0:1;
-      unsigned SCK2R1:1;
-      unsigned SCK2R2:1;
-      unsigned SCK2R3:1;
-      unsigned SCK2R4:1;
-      unsigned SCK2R5:1;
-    };
-    struct {
-      unsigned SDI2R:6;
-      unsigned :2;
-      unsigned SCK2R:6;
-    };
-  };
-} RPINR22BITS;
-extern volatile RPINR22BITS RPINR22bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR23 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR23BITS {
-  union {
-    struct {
-      unsigned SS2R0:1;
-      unsigned SS2R1:1;
-      unsigned SS2R2:1;
-      unsigned SS2R3:1;
-      unsigned SS2R4:1;
-      unsigned SS2R5:1;
-    };
-    struct {
-      unsigned SS2R:6;
-    };
-  };
-} RPINR23BITS;
-extern volatile RPINR23BITS RPINR23bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR27 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR27BITS {
-  union {
-    struct {
-      unsigned U4RXR0:1;
-      unsigned U4RXR1:1;
-      unsigned U4RXR2:1;
-      unsigned U4RXR3:1;
-      unsigned U4RXR4:1;
-      unsigned U4RXR5:1;
-      unsigned :2;
-      unsigned U4CTSR0:1;
-      unsigned U4CTSR1:1;
-      unsigned U4CTSR2:1;
-      unsigned U4CTSR3:1;
-      unsigned U4CTSR4:1;
-      unsigned U4CTSR5:1;
-    };
-    struct {
-      unsigned U4RXR:6;
-      unsigned :2;
-      unsigned U4CTSR:6;
-    };
-  };
-} RPINR27BITS;
-extern volatile RPINR27BITS RPINR27bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR28 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR28BITS {
-  union {
-    struct {
-      unsigned SDI3R0:1;
-      unsigned SDI3R1:1;
-      unsigned SDI3R2:1;
-      unsigned SDI3R3:1;
-      unsigned SDI3R4:1;
-      unsigned SDI3R5:1;
-      unsigned :2;
-      unsigned SCK3R0:1;
-      unsigned SCK3R1:1;
-      unsigned SCK3R2:1;
-      unsigned SCK3R3:1;
-      unsigned SCK3R4:1;
-      unsigned SCK3R5:1;
-    };
-    struct {
-      unsigned SDI3R:6;
-      unsigned :2;
-      unsigned SCK3R:6;
-    };
-  };
-} RPINR28BITS;
-extern volatile RPINR28BITS RPINR28bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPINR29 __attribute__((__sfr__));
-__extension__ typedef struct tagRPINR29BITS {
-  union {
-    struct {
-      unsigned SS3R0:1;
-      unsigned SS3R1:1;
-      unsigned SS3R2:1;
-      unsigned SS3R3:1;
-      unsigned SS3R4:1;
-      unsigned SS3R5:1;
-    };
-    struct {
-      unsigned SS3R:6;
-    };
-  };
-} RPINR29BITS;
-extern volatile RPINR29BITS RPINR29bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPOR0 __attribute__((__sfr__));
-__extension__ typedef struct tagRPOR0BITS {
-  union {
-    struct {
-      unsigned RP0R0:1;
-      unsigned RP0R1:1;
-      unsigned RP0R2:1;
-      unsigned RP0R3:1;
-      unsigned RP0R4:1;
-      unsigned RP0R5:1;
-      unsigned :2;
-      unsigned RP1R0:1;
-      unsigned RP1R1:1;
-      unsigned RP1R2:1;
-      unsigned RP1R3:1;
-      unsigned RP1R4:1;
-      unsigned RP1R5:1;
-    };
-    struct {
-      unsigned RP0R:6;
-      unsigned :2;
-      unsigned RP1R:6;
-    };
-  };
-} RPOR0BITS;
-extern volatile RPOR0BITS RPOR0bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPOR1 __attribute__((__sfr__));
-__extension__ typedef struct tagRPOR1BITS {
-  union {
-    struct {
-      unsigned RP2R0:1;
-      unsigned RP2R1:1;
-      unsigned RP2R2:1;
-      unsigned RP2R3:1;
-      unsigned RP2R4:1;
-      unsigned RP2R5:1;
-      unsigned :2;
-      unsigned RP3R0:1;
-      unsigned RP3R1:1;
-      unsigned RP3R2:1;
-      unsigned RP3R3:1;
-      unsigned RP3R4:1;
-      unsigned RP3R5:1;
-    };
-    struct {
-      unsigned RP2R:6;
-      unsigned :2;
-      unsigned RP3R:6;
-    };
-  };
-} RPOR1BITS;
-extern volatile RPOR1BITS RPOR1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPOR2 __attribute__((__sfr__));
-__extension__ typedef struct tagRPOR2BITS {
-  union {
-    struct {
-      unsigned RP4R0:1;
-      unsigned RP4R1:1;
-      unsigned RP4R2:1;
-      unsigned RP4R3:1;
-      unsigned RP4R4:1;
-      unsigned RP4R5:1;
-    };
-    struct {
-      unsigned RP4R:6;
-    };
-  };
-} RPOR2BITS;
-extern volatile RPOR2BITS RPOR2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPOR3 __attribute__((__sfr__));
-__extension__ typedef struct tagRPOR3BITS {
-  union {
-    struct {
-      unsigned RP6R0:1;
-      unsigned RP6R1:1;
-      unsigned RP6R2:1;
-      unsigned RP6R3:1;
-      unsigned RP6R4:1;
-      unsigned RP6R5:1;
-      unsigned :2;
-      unsigned RP7R0:1;
-      unsigned RP7R1:1;
-      unsigned RP7R2:1;
-      unsigned RP7R3:1;
-      unsigned RP7R4:1;
-      unsigned RP7R5:1;
-    };
-    struct {
-      unsigned RP6R:6;
-      unsigned :2;
-      unsigned RP7R:6;
-    };
-  };
-} RPOR3BITS;
-extern volatile RPOR3BITS RPOR3bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPOR4 __attribute__((__sfr__));
-__extension__ typedef struct tagRPOR4BITS {
-  union {
-    struct {
-      unsigned RP8R0:1;
-      unsigned RP8R1:1;
-      unsigned RP8R2:1;
-      unsigned RP8R3:1;
-      unsigned RP8R4:1;
-      unsigned RP8R5:1;
-      unsigned :2;
-      unsigned RP9R0:1;
-      unsigned RP9R1:1;
-      unsigned RP9R2:1;
-      unsigned RP9R3:1;
-      unsigned RP9R4:1;
-      unsigned RP9R5:1;
-    };
-    struct {
-      unsigned RP8R:6;
-      unsigned :2;
-      unsigned RP9R:6;
-    };
-  };
-} RPOR4BITS;
-extern volatile RPOR4BITS RPOR4bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPOR5 __attribute__((__sfr__));
-__extension__ typedef struct tagRPOR5BITS {
-  union {
-    struct {
-      unsigned RP10R0:1;
-      unsigned RP10R1:1;
-      unsigned RP10R2:1;
-      unsigned RP10R3:1;
-      unsigned RP10R4:1;
-      unsigned RP10R5:1;
-      unsigned :2;
-      unsigned RP11R0:1;
-      unsigned RP11R1:1;
-      unsigned RP11R2:1;
-      unsigned RP11R3:1;
-      unsigned RP11R4:1;
-      unsigned RP11R5:1;
-    };
-    struct {
-      unsigned RP10R:6;
-      unsigned :2;
-      unsigned RP11R:6;
-    };
-  };
-} RPOR5BITS;
-extern volatile RPOR5BITS RPOR5bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPOR6 __attribute__((__sfr__));
-__extension__ typedef struct tagRPOR6BITS {
-  union {
-    struct {
-      unsigned RP12R0:1;
-      unsigned RP12R1:1;
-      unsigned RP12R2:1;
-      unsigned RP12R3:1;
-      unsigned RP12R4:1;
-      unsigned RP12R5:1;
-      unsigned :2;
-      unsigned RP13R0:1;
-      unsigned RP13R1:1;
-      unsigned RP13R2:1;
-      unsigned RP13R3:1;
-      unsigned RP13R4:1;
-      unsigned RP13R5:1;
-    };
-    struct {
-      unsigned RP12R:6;
-      unsigned :2;
-      unsigned RP13R:6;
-    };
-  };
-} RPOR6BITS;
-extern volatile RPOR6BITS RPOR6bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPOR7 __attribute__((__sfr__));
-__extension__ typedef struct tagRPOR7BITS {
-  union {
-    struct {
-      unsigned RP14R0:1;
-      unsigned RP14R1:1;
-      unsigned RP14R2:1;
-      unsigned RP14R3:1;
-      unsigned RP14R4:1;
-      unsigned RP14R5:1;
-    };
-    struct {
-      unsigned RP14R:6;
-    };
-  };
-} RPOR7BITS;
-extern volatile RPOR7BITS RPOR7bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPOR8 __attribute__((__sfr__));
-__extension__ typedef struct tagRPOR8BITS {
-  union {
-    struct {
-      unsigned RP16R0:1;
-      unsigned RP16R1:1;
-      unsigned RP16R2:1;
-      unsigned RP16R3:1;
-      unsigned RP16R4:1;
-      unsigned RP16R5:1;
-      unsigned :2;
-      unsigned RP17R0:1;
-      unsigned RP17R1:1;
-      unsigned RP17R2:1;
-      unsigned RP17R3:1;
-      unsigned RP17R4:1;
-      unsigned RP17R5:1;
-    };
-    struct {
-      unsigned RP16R:6;
-      unsigned :2;
-      unsigned RP17R:6;
-    };
-  };
-} RPOR8BITS;
-extern volatile RPOR8BITS RPOR8bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPOR9 __attribute__((__sfr__));
-__extension__ typedef struct tagRPOR9BITS {
-  union {
-    struct {
-      unsigned RP18R0:1;
-      unsigned RP18R1:1;
-      unsigned RP18R2:1;
-      unsigned RP18R3:1;
-      unsigned RP18R4:1;
-      unsigned RP18R5:1;
-      unsigned :2;
-      unsigned RP19R0:1;
-      unsigned RP19R1:1;
-      unsigned RP19R2:1;
-      unsigned RP19R3:1;
-      unsigned RP19R4:1;
-      unsigned RP19R5:1;
-    };
-    struct {
-      unsigned RP18R:6;
-      unsigned :2;
-      unsigned RP19R:6;
-    };
-  };
-} RPOR9BITS;
-extern volatile RPOR9BITS RPOR9bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPOR10 __attribute__((__sfr__));
-__extension__ typedef struct tagRPOR10BITS {
-  union {
-    struct {
-      unsigned RP20R0:1;
-      unsigned RP20R1:1;
-      unsigned RP20R2:1;
-      unsigned RP20R3:1;
-      unsigned RP20R4:1;
-      unsigned RP20R5:1;
-      unsigned :2;
-      unsigned RP21R0:1;
-      unsigned RP21R1:1;
-      unsigned RP21R2:1;
-      unsigned RP21R3:1;
-      unsigned RP21R4:1;
-      unsigned RP21R5:1;
-    };
-    struct {
-      unsigned RP20R:6;
-      unsigned :2;
-      unsigned RP21R:6;
-    };
-  };
-} RPOR10BITS;
-extern volatile RPOR10BITS RPOR10bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPOR11 __attribute__((__sfr__));
-__extension__ typedef struct tagRPOR11BITS {
-  union {
-    struct {
-      unsigned RP22R0:1;
-      unsigned RP22R1:1;
-      unsigned RP22R2:1;
-      unsigned RP22R3:1;
-      unsigned RP22R4:1;
-      unsigned RP22R5:1;
-      unsigned :2;
-      unsigned RP23R0:1;
-      unsigned RP23R1:1;
-      unsigned RP23R2:1;
-      unsigned RP23R3:1;
-      unsigned RP23R4:1;
-      unsigned RP23R5:1;
-    };
-    struct {
-      unsigned RP22R:6;
-      unsigned :2;
-      unsigned RP23R:6;
-    };
-  };
-} RPOR11BITS;
-extern volatile RPOR11BITS RPOR11bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPOR12 __attribute__((__sfr__));
-__extension__ typedef struct tagRPOR12BITS {
-  union {
-    struct {
-      unsigned RP24R0:1;
-      unsigned RP24R1:1;
-      unsigned RP24R2:1;
-      unsigned RP24R3:1;
-      unsigned RP24R4:1;
-      unsigned RP24R5:1;
-      unsigned :2;
-      unsigned RP25R0:1;
-      unsigned RP25R1:1;
-      unsigned RP25R2:1;
-      unsigned RP25R3:1;
-      unsigned RP25R4:1;
-      unsigned RP25R5:1;
-    };
-    struct {
-      unsigned RP24R:6;
-      unsigned :2;
-      unsigned RP25R:6;
-    };
-  };
-} RPOR12BITS;
-extern volatile RPOR12BITS RPOR12bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPOR13 __attribute__((__sfr__));
-__extension__ typedef struct tagRPOR13BITS {
-  union {
-    struct {
-      unsigned RP26R0:1;
-      unsigned RP26R1:1;
-      unsigned RP26R2:1;
-      unsigned RP26R3:1;
-      unsigned RP26R4:1;
-      unsigned RP26R5:1;
-      unsigned :2;
-      unsigned RP27R0:1;
-      unsigned RP27R1:1;
-      unsigned RP27R2:1;
-      unsigned RP27R3:1;
-      unsigned RP27R4:1;
-      unsigned RP27R5:1;
-    };
-    struct {
-      unsigned RP26R:6;
-      unsigned :2;
-      unsigned RP27R:6;
-    };
-  };
-} RPOR13BITS;
-extern volatile RPOR13BITS RPOR13bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPOR14 __attribute__((__sfr__));
-__extension__ typedef struct tagRPOR14BITS {
-  union {
-    struct {
-      unsigned RP28R0:1;
-      unsigned RP28R1:1;
-      unsigned RP28R2:1;
-      unsigned RP28R3:1;
-      unsigned RP28R4:1;
-      unsigned RP28R5:1;
-      unsigned :2;
-      unsigned RP29R0:1;
-      unsigned RP29R1:1;
-      unsigned RP29R2:1;
-      unsigned RP29R3:1;
-      unsigned RP29R4:1;
-      unsigned RP29R5:1;
-    };
-    struct {
-      unsigned RP28R:6;
-      unsigned :2;
-      unsigned RP29R:6;
-    };
-  };
-} RPOR14BITS;
-extern volatile RPOR14BITS RPOR14bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RPOR15 __attribute__((__sfr__));
-__extension__ typedef struct tagRPOR15BITS {
-  union {
-    struct {
-      unsigned RP30R0:1;
-      unsigned RP30R1:1;
-      unsigned RP30R2:1;
-      unsigned RP30R3:1;
-      unsigned RP30R4:1;
-      unsigned RP30R5:1;
-    };
-    struct {
-      unsigned RP30R:6;
-    };
-  };
-} RPOR15BITS;
-extern volatile RPOR15BITS RPOR15bits __attribute__((__sfr__));
-
-extern volatile unsigned int  RCON __attribute__((__sfr__));
-__extension__ typedef struct tagRCONBITS {
-  union {
-    struct {
-      unsigned POR:1;
-      unsigned BOR:1;
-      unsigned IDLE:1;
-      unsigned SLEEP:1;
-      unsigned WDTO:1;
-      unsigned SWDTEN:1;
-      unsigned SWR:1;
-      unsigned EXTR:1;
-      unsigned VREGS:1;
-      unsigned CM:1;
-      unsigned :4;
-      unsigned IOPUWR:1;
-      unsigned TRAPR:1;
-    };
-    struct {
-      unsigned :8;
-      unsigned PMSLP:1;
-    };
-  };
-} RCONBITS;
-extern volatile RCONBITS RCONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  OSCCON __attribute__((__sfr__));
-__extension__ typedef struct tagOSCCONBITS {
-  union {
-    struct {
-      unsigned OSWEN:1;
-      unsigned SOSCEN:1;
-      unsigned POSCEN:1;
-      unsigned CF:1;
-      unsigned :1;
-      unsigned LOCK:1;
-      unsigned IOLOCK:1;
-      unsigned CLKLOCK:1;
-      unsigned NOSC0:1;
-      unsigned NOSC1:1;
-      unsigned NOSC2:1;
-      unsigned :1;
-      unsigned COSC0:1;
-      unsigned COSC1:1;
-      unsigned COSC2:1;
-    };
-    struct {
-      unsigned :8;
-      unsigned NOSC:3;
-      unsigned :1;
-      unsigned COSC:3;
-    };
-    struct {
-      unsigned :1;
-      unsigned LPOSCEN:1;
-    };
-  };
-} OSCCONBITS;
-extern volatile OSCCONBITS OSCCONbits __attribute__((__sfr__));
-
-extern volatile unsigned char OSCCONL __attribute__((__sfr__));
-extern volatile unsigned char OSCCONH __attribute__((__sfr__));
-extern volatile unsigned int  CLKDIV __attribute__((__sfr__));
-__extension__ typedef struct tagCLKDIVBITS {
-  union {
-    struct {
-      unsigned :6;
-      unsigned USBDOZE0:1;
-      unsigned USBDOZE1:1;
-      unsigned RCDIV0:1;
-      unsigned RCDIV1:1;
-      unsigned RCDIV2:1;
-      unsigned DOZEN:1;
-      unsigned DOZE0:1;
-      unsigned DOZE1:1;
-      unsigned DOZE2:1;
-      unsigned ROI:1;
-    };
-    struct {
-      unsigned :6;
-      unsigned USBDOZE:2;
-      unsigned RCDIV:3;
-      unsigned :1;
-      unsigned DOZE:3;
-    };
-    struct {
-      unsigned :6;
-      unsigned CPDIV:2;
-    };
-    struct {
-      unsigned :6;
-      unsigned CPDIV0:1;
-      unsigned CPDIV1:1;
-    };
-  };
-} CLKDIVBITS;
-extern volatile CLKDIVBITS CLKDIVbits __attribute__((__sfr__));
-
-extern volatile unsigned int  OSCTUN __attribute__((__sfr__));
-__extension__ typedef struct tagOSCTUNBITS {
-  union {
-    struct {
-      unsigned TUN0:1;
-      unsigned TUN1:1;
-      unsigned TUN2:1;
-      unsigned TUN3:1;
-      unsigned TUN4:1;
-      unsigned TUN5:1;
-    };
-    struct {
-      unsigned TUN:6;
-    };
-  };
-} OSCTUNBITS;
-extern volatile OSCTUNBITS OSCTUNbits __attribute__((__sfr__));
-
-extern          unsigned int  REFOCON __attribute__((__sfr__));
-__extension__ typedef struct tagREFOCONBITS {
-  union {
-    struct {
-      unsigned :8;
-      unsigned RODIV0:1;
-      unsigned RODIV1:1;
-      unsigned RODIV2:1;
-      unsigned RODIV3:1;
-      unsigned ROSEL:1;
-      unsigned ROSSLP:1;
-      unsigned :1;
-      unsigned ROON:1;
-    };
-    struct {
-      unsigned :8;
-      unsigned RODIV:4;
-    };
-  };
-} REFOCONBITS;
-extern          REFOCONBITS REFOCONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  NVMCON __attribute__((__sfr__));
-__extension__ typedef struct tagNVMCONBITS {
-  union {
-    struct {
-      unsigned NVMOP0:1;
-      unsigned NVMOP1:1;
-      unsigned NVMOP2:1;
-      unsigned NVMOP3:1;
-      unsigned :2;
-      unsigned ERASE:1;
-      unsigned :6;
-      unsigned WRERR:1;
-      unsigned WREN:1;
-      unsigned WR:1;
-    };
-    struct {
-      unsigned NVMOP:4;
-    };
-    struct {
-      unsigned PROGOP:4;
-    };
-    struct {
-      unsigned PROGOP0:1;
-      unsigned PROGOP1:1;
-      unsigned PROGOP2:1;
-      unsigned PROGOP3:1;
-    };
-  };
-} NVMCONBITS;
-extern volatile NVMCONBITS NVMCONbits __attribute__((__sfr__));
-
-extern volatile unsigned int  NVMKEY __attribute__((__sfr__));
-extern volatile unsigned int  PMD1 __attribute__((__sfr__));
-typedef struct tagPMD1BITS {
-  unsigned ADC1MD:1;
-  unsigned :2;
-  unsigned SPI1MD:1;
-  unsigned SPI2MD:1;
-  unsigned U1MD:1;
-  unsigned U2MD:1;
-  unsigned I2C1MD:1;
-  unsigned :3;
-  unsigned T1MD:1;
-  unsigned T2MD:1;
-  unsigned T3MD:1;
-  unsigned T4MD:1;
-  unsigned T5MD:1;
-} PMD1BITS;
-extern volatile PMD1BITS PMD1bits __attribute__((__sfr__));
-
-extern volatile unsigned int  PMD2 __attribute__((__sfr__));
-typedef struct tagPMD2BITS {
-  unsigned OC1MD:1;
-  unsigned OC2MD:1;
-  unsigned OC3MD:1;
-  unsigned OC4MD:1;
-  unsigned OC5MD:1;
-  unsigned OC6MD:1;
-  unsigned OC7MD:1;
-  unsigned OC8MD:1;
-  unsigned IC1MD:1;
-  unsigned IC2MD:1;
-  unsigned IC3MD:1;
-  unsigned IC4MD:1;
-  unsigned IC5MD:1;
-  unsigned IC6MD:1;
-  unsigned IC7MD:1;
-  unsigned IC8MD:1;
-} PMD2BITS;
-extern volatile PMD2BITS PMD2bits __attribute__((__sfr__));
-
-extern volatile unsigned int  PMD3 __attribute__((__sfr__));
-__extension__ typedef struct tagPMD3BITS {
-  union {
-    struct {
-      unsigned :1;
-      unsigned I2C2MD:1;
-      unsigned I2C3MD:1;
-      unsigned U3MD:1;
-      unsigned :3;
-      unsigned CRCPMD:1;
-      unsigned PMPMD:1;
-      unsigned RTCCMD:1;
-      unsigned CMPMD:1;
-    };
-    struct {
-      unsigned :7;
-      unsigned CRCMD:1;
-    };
-  };
-} PMD3BITS;
-extern volatile PMD3BITS PMD3bits __attribute__((__sfr__));
-
-extern volatile unsigned int  PMD4 __attribute__((__sfr__));
-typedef struct tagPMD4BITS {
-  unsigned USB1MD:1;
-  unsigned LVDMD:1;
-  unsigned CTMUMD:1;
-  unsigned REFOMD:1;
-  unsigned :1;
-  unsigned U4MD:1;
-  unsigned UPWMMD:1;
-} PMD4BITS;
-extern volatile PMD4BITS PMD4bits __attribute__((__sfr__));
-
-extern volatile unsigned int  PMD5 __attribute__((__sfr__));
-typedef struct tagPMD5BITS {
-  unsigned OC9MD:1;
-  unsigned :7;
-  unsigned IC9MD:1;
-} PMD5BITS;
-extern volatile PMD5BITS PMD5bits __attribute__((__sfr__));
-
-extern volatile unsigned int  PMD6 __attribute__((__sfr__));
-typedef struct tagPMD6BITS {
-  unsigned SPI3MD:1;
-} PMD6BITS;
-extern volatile PMD6BITS PMD6bits __attribute__((__sfr__));
-
-
-
-/* ---------------------------------------------------------- */
-/* Defines for unique SFR bit names                           */
-/* ---------------------------------------------------------- */
-
-/* SR */
-#define _C SRbits.C
-#define _Z SRbits.Z
-#define _OV SRbits.OV
-#define _N SRbits.N
-#define _RA SRbits.RA
-#define _IPL0 SRbits.IPL0
-#define _IPL1 SRbits.IPL1
-#define _IPL2 SRbits.IPL2
-/* Bitname _DC cannot be defined because it is used by more than one SFR */
-#define _IPL SRbits.IPL
-
-/* CORCON */
-#define _PSV CORCONbits.PSV
-#define _IPL3 CORCONbits.IPL3
-
-/* CNPD1 */
-#define _CN0PDE CNPD1bits.CN0PDE
-#define _CN1PDE CNPD1bits.CN1PDE
-#define _CN2PDE CNPD1bits.CN2PDE
-#define _CN3PDE CNPD1bits.CN3PDE
-#define _CN4PDE CNPD1bits.CN4PDE
-#define _CN5PDE CNPD1bits.CN5PDE
-#define _CN6PDE CNPD1bits.CN6PDE
-#define _CN7PDE CNPD1bits.CN7PDE
-#define _CN8PDE CNPD1bits.CN8PDE
-#define _CN9PDE CNPD1bits.CN9PDE
-#define _CN10PDE CNPD1bits.CN10PDE
-#define _CN11PDE CNPD1bits.CN11PDE
-#define _CN12PDE CNPD1bits.CN12PDE
-#define _CN13PDE CNPD1bits.CN13PDE
-#define _CN14PDE CNPD1bits.CN14PDE
-#define _CN15PDE CNPD1bits.CN15PDE
-
-/* CNPD2 */
-#define _CN16PDE CNPD2bits.CN16PDE
-#define _CN17PDE CNPD2bits.CN17PDE
-#define _CN18PDE CNPD2bits.CN18PDE
-#define _CN22PDE CNPD2bits.CN22PDE
-#define _CN23PDE CNPD2bits.CN23PDE
-#define _CN24PDE CNPD2bits.CN24PDE
-#define _CN25PDE CNPD2bits.CN25PDE
-#define _CN26PDE CNPD2bits.CN26PDE
-#define _CN27PDE CNPD2bits.CN27PDE
-#define _CN28PDE CNPD2bits.CN28PDE
-#define _CN29PDE CNPD2bits.CN29PDE
-#define _CN30PDE CNPD2bits.CN30PDE
-#define _CN31PDE CNPD2bits.CN31PDE
-
-/* CNPD3 */
-#define _CN32PDE CNPD3bits.CN32PDE
-
-/* CNPD4 */
-#define _CN49PDE CNPD4bits.CN49PDE
-#define _CN50PDE CNPD4bits.CN50PDE
-#define _CN51PDE CNPD4bits.CN51PDE
-#define _CN52PDE CNPD4bits.CN52PDE
-#define _CN53PDE CNPD4bits.CN53PDE
-#define _CN54PDE CNPD4bits.CN54PDE
-#define _CN55PDE CNPD4bits.CN55PDE
-#define _CN56PDE CNPD4bits.CN56PDE
-#define _CN58PDE CNPD4bits.CN58PDE
-#define _CN59PDE CNPD4bits.CN59PDE
-#define _CN60PDE CNPD4bits.CN60PDE
-#define _CN61PDE CNPD4bits.CN61PDE
-#define _CN62PDE CNPD4bits.CN62PDE
-#define _CN63PDE CNPD4bits.CN63PDE
-
-/* CNPD5 */
-#define _CN64PDE CNPD5bits.CN64PDE
-#define _CN65PDE CNPD5bits.CN65PDE
-#define _CN68PDE CNPD5bits.CN68PDE
-#define _CN69PDE CNPD5bits.CN69PDE
-#define _CN71PDE CNPD5bits.CN71PDE
-
-/* CNEN1 */
-#define _CN0IE CNEN1bits.CN0IE
-#define _CN1IE CNEN1bits.CN1IE
-#define _CN2IE CNEN1bits.CN2IE
-#define _CN3IE CNEN1bits.CN3IE
-#define _CN4IE CNEN1bits.CN4IE
-#define _CN5IE CNEN1bits.CN5IE
-#define _CN6IE CNEN1bits.CN6IE
-#define _CN7IE CNEN1bits.CN7IE
-#define _CN8IE CNEN1bits.CN8IE
-#define _CN9IE CNEN1bits.CN9IE
-#define _CN10IE CNEN1bits.CN10IE
-#define _CN11IE CNEN1bits.CN11IE
-#define _CN12IE CNEN1bits.CN12IE
-#define _CN13IE CNEN1bits.CN13IE
-#define _CN14IE CNEN1bits.CN14IE
-#define _CN15IE CNEN1bits.CN15IE
-
-/* CNEN2 */
-#define _CN16IE CNEN2bits.CN16IE
-#define _CN17IE CNEN2bits.CN17IE
-#define _CN18IE CNEN2bits.CN18IE
-#define _CN22IE CNEN2bits.CN22IE
-#define _CN23IE CNEN2bits.CN23IE
-#define _CN24IE CNEN2bits.CN24IE
-#define _CN25IE CNEN2bits.CN25IE
-#define _CN26IE CNEN2bits.CN26IE
-#define _CN27IE CNEN2bits.CN27IE
-#define _CN28IE CNEN2bits.CN28IE
-#define _CN29IE CNEN2bits.CN29IE
-#define _CN30IE CNEN2bits.CN30IE
-#define _CN31IE CNEN2bits.CN31IE
-
-/* CNEN3 */
-#define _CN32IE CNEN3bits.CN32IE
-
-/* CNEN4 */
-#define _CN49IE CNEN4bits.CN49IE
-#define _CN50IE CNEN4bits.CN50IE
-#define _CN51IE CNEN4bits.CN51IE
-#define _CN52IE CNEN4bits.CN52IE
-#define _CN53IE CNEN4bits.CN53IE
-#define _CN54IE CNEN4bits.CN54IE
-#define _CN55IE CNEN4bits.CN55IE
-#define _CN56IE CNEN4bits.CN56IE
-#define _CN58IE CNEN4bits.CN58IE
-#define _CN59IE CNEN4bits.CN59IE
-#define _CN60IE CNEN4bits.CN60IE
-#define _CN61IE CNEN4bits.CN61IE
-#define _CN62IE CNEN4bits.CN62IE
-#define _CN63IE CNEN4bits.CN63IE
-
-/* CNEN5 */
-#define _CN64IE CNEN5bits.CN64IE
-#define _CN65IE CNEN5bits.CN65IE
-#define _CN68IE CNEN5bits.CN68IE
-#define _CN69IE CNEN5bits.CN69IE
-#define _CN71IE CNEN5bits.CN71IE
-
-/* CNPU1 */
-#define _CN0PUE CNPU1bits.CN0PUE
-#define _CN1PUE CNPU1bits.CN1PUE
-#define _CN2PUE CNPU1bits.CN2PUE
-#define _CN3PUE CNPU1bits.CN3PUE
-#define _CN4PUE CNPU1bits.CN4PUE
-#define _CN5PUE CNPU1bits.CN5PUE
-#define _CN6PUE CNPU1bits.CN6PUE
-#define _CN7PUE CNPU1bits.CN7PUE
-#define _CN8PUE CNPU1bits.CN8PUE
-#define _CN9PUE CNPU1bits.CN9PUE
-#define _CN10PUE CNPU1bits.CN10PUE
-#define _CN11PUE CNPU1bits.CN11PUE
-#define _CN12PUE CNPU1bits.CN12PUE
-#define _CN13PUE CNPU1bits.CN13PUE
-#define _CN14PUE CNPU1bits.CN14PUE
-#define _CN15PUE CNPU1bits.CN15PUE
-
-/* CNPU2 */
-#define _CN16PUE CNPU2bits.CN16PUE
-#define _CN17PUE CNPU2bits.CN17PUE
-#define _CN18PUE CNPU2bits.CN18PUE
-#define _CN22PUE CNPU2bits.CN22PUE
-#define _CN23PUE CNPU2bits.CN23PUE
-#define _CN24PUE CNPU2bits.CN24PUE
-#define _CN25PUE CNPU2bits.CN25PUE
-#define _CN26PUE CNPU2bits.CN26PUE
-#define _CN27PUE CNPU2bits.CN27PUE
-#define _CN28PUE CNPU2bits.CN28PUE
-#define _CN29PUE CNPU2bits.CN29PUE
-#define _CN30PUE CNPU2bits.CN30PUE
-#define _CN31PUE CNPU2bits.CN31PUE
-
-/* CNPU3 */
-#define _CN32PUE CNPU3bits.CN32PUE
-
-/* CNPU4 */
-#define _CN49PUE CNPU4bits.CN49PUE
-#define _CN50PUE CNPU4bits.CN50PUE
-#define _CN51PUE CNPU4bits.CN51PUE
-#define _CN52PUE CNPU4bits.CN52PUE
-#define _CN53PUE CNPU4bits.CN53PUE
-#define _CN54PUE CNPU4bits.CN54PUE
-#define _CN55PUE CNPU4bits.CN55PUE
-#define _CN56PUE CNPU4bits.CN56PUE
-#define _CN58PUE CNPU4bits.CN58PUE
-#define _CN59PUE CNPU4bits.CN59PUE
-#define _CN60PUE CNPU4bits.CN60PUE
-#define _CN61PUE CNPU4bits.CN61PUE
-#define _CN62PUE CNPU4bits.CN62PUE
-#define _CN63PUE CNPU4bits.CN63PUE
-
-/* CNPU5 */
-#define _CN64PUE CNPU5bits.CN64PUE
-#define _CN65PUE CNPU5bits.CN65PUE
-#define _CN68PUE CNPU5bits.CN68PUE
-#define _CN69PUE CNPU5bits.CN69PUE
-#define _CN71PUE CNPU5bits.CN71PUE
-
-/* INTCON1 */
-#define _OSCFAIL INTCON1bits.OSCFAIL
-#define _STKERR INTCON1bits.STKERR
-#define _ADDRERR INTCON1bits.ADDRERR
-#define _MATHERR INTCON1bits.MATHERR
-#define _NSTDIS INTCON1bits.NSTDIS
-
-/* INTCON2 */
-#define _INT0EP INTCON2bits.INT0EP
-#define _INT1EP INTCON2bits.INT1EP
-#define _INT2EP INTCON2bits.INT2EP
-#define _INT3EP INTCON2bits.INT3EP
-#define _INT4EP INTCON2bits.INT4EP
-#define _DISI INTCON2bits.DISI
-#define _ALTIVT INTCON2bits.ALTIVT
-
-/* IFS0 */
-#define _INT0IF IFS0bits.INT0IF
-#define _IC1IF IFS0bits.IC1IF
-#define _OC1IF IFS0bits.OC1IF
-#define _T1IF IFS0bits.T1IF
-#define _IC2IF IFS0bits.IC2IF
-#define _OC2IF IFS0bits.OC2IF
-#define _T2IF IFS0bits.T2IF
-#define _T3IF IFS0bits.T3IF
-#define _SPF1IF IFS0bits.SPF1IF
-#define _SPI1IF IFS0bits.SPI1IF
-#define _U1RXIF IFS0bits.U1RXIF
-#define _U1TXIF IFS0bits.U1TXIF
-#define _AD1IF IFS0bits.AD1IF
-
-/* IFS1 */
-#define _SI2C1IF IFS1bits.SI2C1IF
-#define _MI2C1IF IFS1bits.MI2C1IF
-#define _CMIF IFS1bits.CMIF
-#define _CNIF IFS1bits.CNIF
-#define _INT1IF IFS1bits.INT1IF
-#define _IC7IF IFS1bits.IC7IF
-#define _IC8IF IFS1bits.IC8IF
-#define _OC3IF IFS1bits.OC3IF
-#define _OC4IF IFS1bits.OC4IF
-#define _T4IF IFS1bits.T4IF
-#define _T5IF IFS1bits.T5IF
-#define _INT2IF IFS1bits.INT2IF
-#define _U2RXIF IFS1bits.U2RXIF
-#define _U2TXIF IFS1bits.U2TXIF
-
-/* IFS2 */
-#define _SPF2IF IFS2bits.SPF2IF
-#define _SPI2IF IFS2bits.SPI2IF
-#define _IC3IF IFS2bits.IC3IF
-#define _IC4IF IFS2bits.IC4IF
-#define _IC5IF IFS2bits.IC5IF
-#define _IC6IF IFS2bits.IC6IF
-#define _OC5IF IFS2bits.OC5IF
-#define _OC6IF IFS2bits.OC6IF
-#define _OC7IF IFS2bits.OC7IF
-#define _OC8IF IFS2bits.OC8IF
-#define _PMPIF IFS2bits.PMPIF
-
-/* IFS3 */
-#define _SI2C2IF IFS3bits.SI2C2IF
-#define _MI2C2IF IFS3bits.MI2C2IF
-#define _INT3IF IFS3bits.INT3IF
-#define _INT4IF IFS3bits.INT4IF
-#define _RTCIF IFS3bits.RTCIF
-
-/* IFS4 */
-#define _U1ERIF IFS4bits.U1ERIF
-#define _U2ERIF IFS4bits.U2ERIF
-#define _CRCIF IFS4bits.CRCIF
-#define _LVDIF IFS4bits.LVDIF
-#define _CTMUIF IFS4bits.CTMUIF
-
-/* IFS5 */
-#define _U3ERIF IFS5bits.U3ERIF
-#define _U3RXIF IFS5bits.U3RXIF
-#define _U3TXIF IFS5bits.U3TXIF
-#define _SI2C3IF IFS5bits.SI2C3IF
-#define _MI2C3IF IFS5bits.MI2C3IF
-#define _USB1IF IFS5bits.USB1IF
-#define _U4ERIF IFS5bits.U4ERIF
-#define _U4RXIF IFS5bits.U4RXIF
-#define _U4TXIF IFS5bits.U4TXIF
-#define _SPF3IF IFS5bits.SPF3IF
-#define _SPI3IF IFS5bits.SPI3IF
-#define _OC9IF IFS5bits.OC9IF
-#define _IC9IF IFS5bits.IC9IF
-
-/* IEC0 */
-#define _INT0IE IEC0bits.INT0IE
-#define _IC1IE IEC0bits.IC1IE
-#define _OC1IE IEC0bits.OC1IE
-#define _T1IE IEC0bits.T1IE
-#define _IC2IE IEC0bits.IC2IE
-#define _OC2IE IEC0bits.OC2IE
-#define _T2IE IEC0bits.T2IE
-#define _T3IE IEC0bits.T3IE
-#define _SPF1IE IEC0bits.SPF1IE
-#define _SPI1IE IEC0bits.SPI1IE
-#define _U1RXIE IEC0bits.U1RXIE
-#define _U1TXIE IEC0bits.U1TXIE
-#define _AD1IE IEC0bits.AD1IE
-
-/* IEC1 */
-#define _SI2C1IE IEC1bits.SI2C1IE
-#define _MI2C1IE IEC1bits.MI2C1IE
-#define _CMIE IEC1bits.CMIE
-#define _CNIE IEC1bits.CNIE
-#define _INT1IE IEC1bits.INT1IE
-#define _IC7IE IEC1bits.IC7IE
-#define _IC8IE IEC1bits.IC8IE
-#define _OC3IE IEC1bits.OC3IE
-#define _OC4IE IEC1bits.OC4IE
-#define _T4IE IEC1bits.T4IE
-#define _T5IE IEC1bits.T5IE
-#define _INT2IE IEC1bits.INT2IE
-#define _U2RXIE IEC1bits.U2RXIE
-#define _U2TXIE IEC1bits.U2TXIE
-
-/* IEC2 */
-#define _SPF2IE IEC2bits.SPF2IE
-#define _SPI2IE IEC2bits.SPI2IE
-#define _IC3IE IEC2bits.IC3IE
-#define _IC4IE IEC2bits.IC4IE
-#define _IC5IE IEC2bits.IC5IE
-#define _IC6IE IEC2bits.IC6IE
-#define _OC5IE IEC2bits.OC5IE
-#define _OC6IE IEC2bits.OC6IE
-#define _OC7IE IEC2bits.OC7IE
-#define _OC8IE IEC2bits.OC8IE
-#define _PMPIE IEC2bits.PMPIE
-
-/* IEC3 */
-#define _SI2C2IE IEC3bits.SI2C2IE
-#define _MI2C2IE IEC3bits.MI2C2IE
-#define _INT3IE IEC3bits.INT3IE
-#define _INT4IE IEC3bits.INT4IE
-#define _RTCIE IEC3bits.RTCIE
-
-/* IEC4 */
-#define _U1ERIE IEC4bits.U1ERIE
-#define _U2ERIE IEC4bits.U2ERIE
-#define _CRCIE IEC4bits.CRCIE
-#define _LVDIE IEC4bits.LVDIE
-#define _CTMUIE IEC4bits.CTMUIE
-
-/* IEC5 */
-#define _U3ERIE IEC5bits.U3ERIE
-#define _U3RXIE IEC5bits.U3RXIE
-#define _U3TXIE IEC5bits.U3TXIE
-#define _SI2C3IE IEC5bits.SI2C3IE
-#define _MI2C3IE IEC5bits.MI2C3IE
-#define _USB1IE IEC5bits.USB1IE
-#define _U4ERIE IEC5bits.U4ERIE
-#define _U4RXIE IEC5bits.U4RXIE
-#define _U4TXIE IEC5bits.U4TXIE
-#define _SPF3IE IEC5bits.SPF3IE
-#define _SPI3IE IEC5bits.SPI3IE
-#define _OC9IE IEC5bits.OC9IE
-#define _IC9IE IEC5bits.IC9IE
-
-/* IPC0 */
-#define _INT0IP0 IPC0bits.INT0IP0
-#define _INT0IP1 IPC0bits.INT0IP1
-#define _INT0IP2 IPC0bits.INT0IP2
-#define _IC1IP0 IPC0bits.IC1IP0
-#define _IC1IP1 IPC0bits.IC1IP1
-#define _IC1IP2 IPC0bits.IC1IP2
-#define _OC1IP0 IPC0bits.OC1IP0
-#define _OC1IP1 IPC0bits.OC1IP1
-#define _OC1IP2 IPC0bits.OC1IP2
-#define _T1IP0 IPC0bits.T1IP0
-#define _T1IP1 IPC0bits.T1IP1
-#define _T1IP2 IPC0bits.T1IP2
-#define _INT0IP IPC0bits.INT0IP
-#define _IC1IP IPC0bits.IC1IP
-#define _OC1IP IPC0bits.OC1IP
-#define _T1IP IPC0bits.T1IP
-
-/* IPC1 */
-#define _IC2IP0 IPC1bits.IC2IP0
-#define _IC2IP1 IPC1bits.IC2IP1
-#define _IC2IP2 IPC1bits.IC2IP2
-#define _OC2IP0 IPC1bits.OC2IP0
-#define _OC2IP1 IPC1bits.OC2IP1
-#define _OC2IP2 IPC1bits.OC2IP2
-#define _T2IP0 IPC1bits.T2IP0
-#define _T2IP1 IPC1bits.T2IP1
-#define _T2IP2 IPC1bits.T2IP2
-#define _IC2IP IPC1bits.IC2IP
-#define _OC2IP IPC1bits.OC2IP
-#define _T2IP IPC1bits.T2IP
-
-/* IPC2 */
-#define _T3IP0 IPC2bits.T3IP0
-#define _T3IP1 IPC2bits.T3IP1
-#define _T3IP2 IPC2bits.T3IP2
-#define _SPF1IP0 IPC2bits.SPF1IP0
-#define _SPF1IP1 IPC2bits.SPF1IP1
-#define _SPF1IP2 IPC2bits.SPF1IP2
-#define _SPI1IP0 IPC2bits.SPI1IP0
-#define _SPI1IP1 IPC2bits.SPI1IP1
-#define _SPI1IP2 IPC2bits.SPI1IP2
-#define _U1RXIP0 IPC2bits.U1RXIP0
-#define _U1RXIP1 IPC2bits.U1RXIP1
-#define _U1RXIP2 IPC2bits.U1RXIP2
-#define _T3IP IPC2bits.T3IP
-#define _SPF1IP IPC2bits.SPF1IP
-#define _SPI1IP IPC2bits.SPI1IP
-#define _U1RXIP IPC2bits.U1RXIP
-
-/* IPC3 */
-#define _U1TXIP0 IPC3bits.U1TXIP0
-#define _U1TXIP1 IPC3bits.U1TXIP1
-#define _U1TXIP2 IPC3bits.U1TXIP2
-#define _AD1IP0 IPC3bits.AD1IP0
-#define _AD1IP1 IPC3bits.AD1IP1
-#define _AD1IP2 IPC3bits.AD1IP2
-#define _U1TXIP IPC3bits.U1TXIP
-#define _AD1IP IPC3bits.AD1IP
-
-/* IPC4 */
-#define _SI2C1IP0 IPC4bits.SI2C1IP0
-#define _SI2C1IP1 IPC4bits.SI2C1IP1
-#define _SI2C1IP2 IPC4bits.SI2C1IP2
-#define _MI2C1IP0 IPC4bits.MI2C1IP0
-#define _MI2C1IP1 IPC4bits.MI2C1IP1
-#define _MI2C1IP2 IPC4bits.MI2C1IP2
-#define _CMIP0 IPC4bits.CMIP0
-#define _CMIP1 IPC4bits.CMIP1
-#define _CMIP2 IPC4bits.CMIP2
-#define _CNIP0 IPC4bits.CNIP0
-#define _CNIP1 IPC4bits.CNIP1
-#define _CNIP2 IPC4bits.CNIP2
-#define _SI2C1IP IPC4bits.SI2C1IP
-#define _MI2C1IP IPC4bits.MI2C1IP
-#define _CMIP IPC4bits.CMIP
-#define _CNIP IPC4bits.CNIP
-#define _SI2C1P0 IPC4bits.SI2C1P0
-#define _SI2C1P1 IPC4bits.SI2C1P1
-#define _SI2C1P2 IPC4bits.SI2C1P2
-#define _MI2C1P0 IPC4bits.MI2C1P0
-#define _MI2C1P1 IPC4bits.MI2C1P1
-#define _MI2C1P2 IPC4bits.MI2C1P2
-#define _SI2C1P IPC4bits.SI2C1P
-#define _MI2C1P IPC4bits.MI2C1P
-
-/* IPC5 */
-#define _INT1IP0 IPC5bits.INT1IP0
-#define _INT1IP1 IPC5bits.INT1IP1
-#define _INT1IP2 IPC5bits.INT1IP2
-#define _IC7IP0 IPC5bits.IC7IP0
-#define _IC7IP1 IPC5bits.IC7IP1
-#define _IC7IP2 IPC5bits.IC7IP2
-#define _IC8IP0 IPC5bits.IC8IP0
-#define _IC8IP1 IPC5bits.IC8IP1
-#define _IC8IP2 IPC5bits.IC8IP2
-#define _INT1IP IPC5bits.INT1IP
-#define _IC7IP IPC5bits.IC7IP
-#define _IC8IP IPC5bits.IC8IP
-
-/* IPC6 */
-#define _OC3IP0 IPC6bits.OC3IP0
-#define _OC3IP1 IPC6bits.OC3IP1
-#define _OC3IP2 IPC6bits.OC3IP2
-#define _OC4IP0 IPC6bits.OC4IP0
-#define _OC4IP1 IPC6bits.OC4IP1
-#define _OC4IP2 IPC6bits.OC4IP2
-#define _T4IP0 IPC6bits.T4IP0
-#define _T4IP1 IPC6bits.T4IP1
-#define _T4IP2 IPC6bits.T4IP2
-#define _OC3IP IPC6bits.OC3IP
-#define _OC4IP IPC6bits.OC4IP
-#define _T4IP IPC6bits.T4IP
-
-/* IPC7 */
-#define _T5IP0 IPC7bits.T5IP0
-#define _T5IP1 IPC7bits.T5IP1
-#define _T5IP2 IPC7bits.T5IP2
-#define _INT2IP0 IPC7bits.INT2IP0
-#define _INT2IP1 IPC7bits.INT2IP1
-#define _INT2IP2 IPC7bits.INT2IP2
-#define _U2RXIP0 IPC7bits.U2RXIP0
-#define _U2RXIP1 IPC7bits.U2RXIP1
-#define _U2RXIP2 IPC7bits.U2RXIP2
-#define _U2TXIP0 IPC7bits.U2TXIP0
-#define _U2TXIP1 IPC7bits.U2TXIP1
-#define _U2TXIP2 IPC7bits.U2TXIP2
-#define _T5IP IPC7bits.T5IP
-#define _INT2IP IPC7bits.INT2IP
-#define _U2RXIP IPC7bits.U2RXIP
-#define _U2TXIP IPC7bits.U2TXIP
-
-/* IPC8 */
-#define _SPF2IP0 IPC8bits.SPF2IP0
-#define _SPF2IP1 IPC8bits.SPF2IP1
-#define _SPF2IP2 IPC8bits.SPF2IP2
-#define _SPI2IP0 IPC8bits.SPI2IP0
-#define _SPI2IP1 IPC8bits.SPI2IP1
-#define _SPI2IP2 IPC8bits.SPI2IP2
-#define _SPF2IP IPC8bits.SPF2IP
-#define _SPI2IP IPC8bits.SPI2IP
-
-/* IPC9 */
-#define _IC3IP0 IPC9bits.IC3IP0
-#define _IC3IP1 IPC9bits.IC3IP1
-#define _IC3IP2 IPC9bits.IC3IP2
-#define _IC4IP0 IPC9bits.IC4IP0
-#define _IC4IP1 IPC9bits.IC4IP1
-#define _IC4IP2 IPC9bits.IC4IP2
-#define _IC5IP0 IPC9bits.IC5IP0
-#define _IC5IP1 IPC9bits.IC5IP1
-#define _IC5IP2 IPC9bits.IC5IP2
-#define _IC3IP IPC9bits.IC3IP
-#define _IC4IP IPC9bits.IC4IP
-#define _IC5IP IPC9bits.IC5IP
-
-/* IPC10 */
-#define _IC6IP0 IPC10bits.IC6IP0
-#define _IC6IP1 IPC10bits.IC6IP1
-#define _IC6IP2 IPC10bits.IC6IP2
-#define _OC5IP0 IPC10bits.OC5IP0
-#define _OC5IP1 IPC10bits.OC5IP1
-#define _OC5IP2 IPC10bits.OC5IP2
-#define _OC6IP0 IPC10bits.OC6IP0
-#define _OC6IP1 IPC10bits.OC6IP1
-#define _OC6IP2 IPC10bits.OC6IP2
-#define _OC7IP0 IPC10bits.OC7IP0
-#define _OC7IP1 IPC10bits.OC7IP1
-#define _OC7IP2 IPC10bits.OC7IP2
-#define _IC6IP IPC10bits.IC6IP
-#define _OC5IP IPC10bits.OC5IP
-#define _OC6IP IPC10bits.OC6IP
-#define _OC7IP IPC10bits.OC7IP
-
-/* IPC11 */
-#define _OC8IP0 IPC11bits.OC8IP0
-#define _OC8IP1 IPC11bits.OC8IP1
-#define _OC8IP2 IPC11bits.OC8IP2
-#define _PMPIP0 IPC11bits.PMPIP0
-#define _PMPIP1 IPC11bits.PMPIP1
-#define _PMPIP2 IPC11bits.PMPIP2
-#define _OC8IP IPC11bits.OC8IP
-#define _PMPIP IPC11bits.PMPIP
-
-/* IPC12 */
-#define _SI2C2IP0 IPC12bits.SI2C2IP0
-#define _SI2C2IP1 IPC12bits.SI2C2IP1
-#define _SI2C2IP2 IPC12bits.SI2C2IP2
-#define _MI2C2IP0 IPC12bits.MI2C2IP0
-#define _MI2C2IP1 IPC12bits.MI2C2IP1
-#define _MI2C2IP2 IPC12bits.MI2C2IP2
-#define _SI2C2IP IPC12bits.SI2C2IP
-#define _MI2C2IP IPC12bits.MI2C2IP
-#define _SI2C2P0 IPC12bits.SI2C2P0
-#define _SI2C2P1 IPC12bits.SI2C2P1
-#define _SI2C2P2 IPC12bits.SI2C2P2
-#define _MI2C2P0 IPC12bits.MI2C2P0
-#define _MI2C2P1 IPC12bits.MI2C2P1
-#define _MI2C2P2 IPC12bits.MI2C2P2
-#define _SI2C2P IPC12bits.SI2C2P
-#define _MI2C2P IPC12bits.MI2C2P
-
-/* IPC13 */
-#define _INT3IP0 IPC13bits.INT3IP0
-#define _INT3IP1 IPC13bits.INT3IP1
-#define _INT3IP2 IPC13bits.INT3IP2
-#define _INT4IP0 IPC13bits.INT4IP0
-#define _INT4IP1 IPC13bits.INT4IP1
-#define _INT4IP2 IPC13bits.INT4IP2
-#define _INT3IP IPC13bits.INT3IP
-#define _INT4IP IPC13bits.INT4IP
-
-/* IPC15 */
-#define _RTCIP0 IPC15bits.RTCIP0
-#define _RTCIP1 IPC15bits.RTCIP1
-#define _RTCIP2 IPC15bits.RTCIP2
-#define _RTCIP IPC15bits.RTCIP
-
-/* IPC16 */
-#define _U1ERIP0 IPC16bits.U1ERIP0
-#define _U1ERIP1 IPC16bits.U1ERIP1
-#define _U1ERIP2 IPC16bits.U1ERIP2
-#define _U2ERIP0 IPC16bits.U2ERIP0
-#define _U2ERIP1 IPC16bits.U2ERIP1
-#define _U2ERIP2 IPC16bits.U2ERIP2
-#define _CRCIP0 IPC16bits.CRCIP0
-#define _CRCIP1 IPC16bits.CRCIP1
-#define _CRCIP2 IPC16bits.CRCIP2
-#define _U1ERIP IPC16bits.U1ERIP
-#define _U2ERIP IPC16bits.U2ERIP
-#define _CRCIP IPC16bits.CRCIP
-
-/* IPC18 */
-#define _LVDIP0 IPC18bits.LVDIP0
-#define _LVDIP1 IPC18bits.LVDIP1
-#define _LVDIP2 IPC18bits.LVDIP2
-#define _LVDIP IPC18bits.LVDIP
-
-/* IPC19 */
-#define _CTMUIP0 IPC19bits.CTMUIP0
-#define _CTMUIP1 IPC19bits.CTMUIP1
-#define _CTMUIP2 IPC19bits.CTMUIP2
-#define _CTMUIP IPC19bits.CTMUIP
-
-/* IPC20 */
-#define _U3ERIP0 IPC20bits.U3ERIP0
-#define _U3ERIP1 IPC20bits.U3ERIP1
-#define _U3ERIP2 IPC20bits.U3ERIP2
-#define _U3RXIP0 IPC20bits.U3RXIP0
-#define _U3RXIP1 IPC20bits.U3RXIP1
-#define _U3RXIP2 IPC20bits.U3RXIP2
-#define _U3TXIP0 IPC20bits.U3TXIP0
-#define _U3TXIP1 IPC20bits.U3TXIP1
-#define _U3TXIP2 IPC20bits.U3TXIP2
-#define _U3ERIP IPC20bits.U3ERIP
-#define _U3RXIP IPC20bits.U3RXIP
-#define _U3TXIP IPC20bits.U3TXIP
-
-/* IPC21 */
-#define _SI2C3P0 IPC21bits.SI2C3P0
-#define _SI2C3P1 IPC21bits.SI2C3P1
-#define _SI2C3P2 IPC21bits.SI2C3P2
-#define _MI2C3P0 IPC21bits.MI2C3P0
-#define _MI2C3P1 IPC21bits.MI2C3P1
-#define _MI2C3P2 IPC21bits.MI2C3P2
-#define _USB1IP0 IPC21bits.USB1IP0
-#define _USB1IP1 IPC21bits.USB1IP1
-#define _USB1IP2 IPC21bits.USB1IP2
-#define _U4ERIP0 IPC21bits.U4ERIP0
-#define _U4ERIP1 IPC21bits.U4ERIP1
-#define _U4ERIP2 IPC21bits.U4ERIP2
-#define _SI2C3P IPC21bits.SI2C3P
-#define _MI2C3P IPC21bits.MI2C3P
-#define _USB1IP IPC21bits.USB1IP
-#define _U4ERIP IPC21bits.U4ERIP
-
-/* IPC22 */
-#define _U4RXIP0 IPC22bits.U4RXIP0
-#define _U4RXIP1 IPC22bits.U4RXIP1
-#define _U4RXIP2 IPC22bits.U4RXIP2
-#define _U4TXIP0 IPC22bits.U4TXIP0
-#define _U4TXIP1 IPC22bits.U4TXIP1
-#define _U4TXIP2 IPC22bits.U4TXIP2
-#define _SPF3IP0 IPC22bits.SPF3IP0
-#define _SPF3IP1 IPC22bits.SPF3IP1
-#define _SPF3IP2 IPC22bits.SPF3IP2
-#define _SPI3IP0 IPC22bits.SPI3IP0
-#define _SPI3IP1 IPC22bits.SPI3IP1
-#define _SPI3IP2 IPC22bits.SPI3IP2
-#define _U4RXIP IPC22bits.U4RXIP
-#define _U4TXIP IPC22bits.U4TXIP
-#define _SPF3IP IPC22bits.SPF3IP
-#define _SPI3IP IPC22bits.SPI3IP
-
-/* IPC23 */
-#define _OC9IP0 IPC23bits.OC9IP0
-#define _OC9IP1 IPC23bits.OC9IP1
-#define _OC9IP2 IPC23bits.OC9IP2
-#define _IC9IP0 IPC23bits.IC9IP0
-#define _IC9IP1 IPC23bits.IC9IP1
-#define _IC9IP2 IPC23bits.IC9IP2
-#define _OC9IP IPC23bits.OC9IP
-#define _IC9IP IPC23bits.IC9IP
-
-/* T1CON */
-#define _TCS T1CONbits.TCS
-#define _TSYNC T1CONbits.TSYNC
-#define _TCKPS0 T1CONbits.TCKPS0
-#define _TCKPS1 T1CONbits.TCKPS1
-#define _TGATE T1CONbits.TGATE
-#define _TSIDL T1CONbits.TSIDL
-#define _TON T1CONbits.TON
-#define _TCKPS T1CONbits.TCKPS
-
-/* T2CON */
-/* Bitname _TCS cannot be defined because it is used by more than one SFR */
-/* Bitname _T32 cannot be defined because it is used by more than one SFR */
-/* Bitname _TCKPS0 cannot be defined because it is used by more than one SFR */
-/* Bitname _TCKPS1 cannot be defined because it is used by more than one SFR */
-/* Bitname _TGATE cannot be defined because it is used by more than one SFR */
-/* Bitname _TSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _TON cannot be defined because it is used by more than one SFR */
-/* Bitname _TCKPS cannot be defined because it is used by more than one SFR */
-
-/* T3CON */
-/* Bitname _TCS cannot be defined because it is used by more than one SFR */
-/* Bitname _TCKPS0 cannot be defined because it is used by more than one SFR */
-/* Bitname _TCKPS1 cannot be defined because it is used by more than one SFR */
-/* Bitname _TGATE cannot be defined because it is used by more than one SFR */
-/* Bitname _TSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _TON cannot be defined because it is used by more than one SFR */
-/* Bitname _TCKPS cannot be defined because it is used by more than one SFR */
-
-/* T4CON */
-/* Bitname _TCS cannot be defined because it is used by more than one SFR */
-/* Bitname _T32 cannot be defined because it is used by more than one SFR */
-/* Bitname _TCKPS0 cannot be defined because it is used by more than one SFR */
-/* Bitname _TCKPS1 cannot be defined because it is used by more than one SFR */
-/* Bitname _TGATE cannot be defined because it is used by more than one SFR */
-/* Bitname _TSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _TON cannot be defined because it is used by more than one SFR */
-/* Bitname _TCKPS cannot be defined because it is used by more than one SFR */
-
-/* T5CON */
-/* Bitname _TCS cannot be defined because it is used by more than one SFR */
-/* Bitname _TCKPS0 cannot be defined because it is used by more than one SFR */
-/* Bitname _TCKPS1 cannot be defined because it is used by more than one SFR */
-/* Bitname _TGATE cannot be defined because it is used by more than one SFR */
-/* Bitname _TSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _TON cannot be defined because it is used by more than one SFR */
-/* Bitname _TCKPS cannot be defined because it is used by more than one SFR */
-
-/* IC1CON1 */
-/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
-/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
-
-/* IC1CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-
-/* IC2CON1 */
-/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
-/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
-
-/* IC2CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-
-/* IC3CON1 */
-/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
-/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
-
-/* IC3CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-
-/* IC4CON1 */
-/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
-/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
-
-/* IC4CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-
-/* IC5CON1 */
-/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
-/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
-
-/* IC5CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-
-/* IC6CON1 */
-/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
-/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
-
-/* IC6CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-
-/* IC7CON1 */
-/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
-/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
-
-/* IC7CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-
-/* IC8CON1 */
-/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
-/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
-
-/* IC8CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-
-/* IC9CON1 */
-/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
-/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _ICM cannot be defined because it is used by more than one SFR */
-/* Bitname _ICI cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
-
-/* IC9CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-
-/* OC1CON1 */
-/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
-
-/* OC1CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
-
-/* OC2CON1 */
-/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
-
-/* OC2CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
-
-/* OC3CON1 */
-/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
-
-/* OC3CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
-
-/* OC4CON1 */
-/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
-
-/* OC4CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
-
-/* OC5CON1 */
-/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
-
-/* OC5CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
-
-/* OC6CON1 */
-/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
-
-/* OC6CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
-
-/* OC7CON1 */
-/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
-
-/* OC7CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
-
-/* OC8CON1 */
-/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
-
-/* OC8CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
-
-/* OC9CON1 */
-/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _OCM cannot be defined because it is used by more than one SFR */
-/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
-
-/* OC9CON2 */
-/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
-/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
-/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
-/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
-/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
-
-/* I2C1CON */
-/* Bitname _SEN cannot be defined because it is used by more than one SFR */
-/* Bitname _RSEN cannot be defined because it is used by more than one SFR */
-/* Bitname _PEN cannot be defined because it is used by more than one SFR */
-/* Bitname _RCEN cannot be defined because it is used by more than one SFR */
-/* Bitname _ACKEN cannot be defined because it is used by more than one SFR */
-/* Bitname _ACKDT cannot be defined because it is used by more than one SFR */
-/* Bitname _STREN cannot be defined because it is used by more than one SFR */
-/* Bitname _GCEN cannot be defined because it is used by more than one SFR */
-/* Bitname _SMEN cannot be defined because it is used by more than one SFR */
-/* Bitname _DISSLW cannot be defined because it is used by more than one SFR */
-/* Bitname _A10M cannot be defined because it is used by more than one SFR */
-/* Bitname _IPMIEN cannot be defined because it is used by more than one SFR */
-/* Bitname _SCLREL cannot be defined because it is used by more than one SFR */
-/* Bitname _I2CSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _I2CEN cannot be defined because it is used by more than one SFR */
-
-/* I2C1STAT */
-/* Bitname _TBF cannot be defined because it is used by more than one SFR */
-/* Bitname _RBF cannot be defined because it is used by more than one SFR */
-/* Bitname _R_W cannot be defined because it is used by more than one SFR */
-/* Bitname _S cannot be defined because it is used by more than one SFR */
-/* Bitname _P cannot be defined because it is used by more than one SFR */
-/* Bitname _D_A cannot be defined because it is used by more than one SFR */
-/* Bitname _I2COV cannot be defined because it is used by more than one SFR */
-/* Bitname _IWCOL cannot be defined because it is used by more than one SFR */
-/* Bitname _ADD10 cannot be defined because it is used by more than one SFR */
-/* Bitname _GCSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _BCL cannot be defined because it is used by more than one SFR */
-/* Bitname _TRSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _ACKSTAT cannot be defined because it is used by more than one SFR */
-
-/* I2C2CON */
-/* Bitname _SEN cannot be defined because it is used by more than one SFR */
-/* Bitname _RSEN cannot be defined because it is used by more than one SFR */
-/* Bitname _PEN cannot be defined because it is used by more than one SFR */
-/* Bitname _RCEN cannot be defined because it is used by more than one SFR */
-/* Bitname _ACKEN cannot be defined because it is used by more than one SFR */
-/* Bitname _ACKDT cannot be defined because it is used by more than one SFR */
-/* Bitname _STREN cannot be defined because it is used by more than one SFR */
-/* Bitname _GCEN cannot be defined because it is used by more than one SFR */
-/* Bitname _SMEN cannot be defined because it is used by more than one SFR */
-/* Bitname _DISSLW cannot be defined because it is used by more than one SFR */
-/* Bitname _A10M cannot be defined because it is used by more than one SFR */
-/* Bitname _IPMIEN cannot be defined because it is used by more than one SFR */
-/* Bitname _SCLREL cannot be defined because it is used by more than one SFR */
-/* Bitname _I2CSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _I2CEN cannot be defined because it is used by more than one SFR */
-
-/* I2C2STAT */
-/* Bitname _TBF cannot be defined because it is used by more than one SFR */
-/* Bitname _RBF cannot be defined because it is used by more than one SFR */
-/* Bitname _R_W cannot be defined because it is used by more than one SFR */
-/* Bitname _S cannot be defined because it is used by more than one SFR */
-/* Bitname _P cannot be defined because it is used by more than one SFR */
-/* Bitname _D_A cannot be defined because it is used by more than one SFR */
-/* Bitname _I2COV cannot be defined because it is used by more than one SFR */
-/* Bitname _IWCOL cannot be defined because it is used by more than one SFR */
-/* Bitname _ADD10 cannot be defined because it is used by more than one SFR */
-/* Bitname _GCSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _BCL cannot be defined because it is used by more than one SFR */
-/* Bitname _TRSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _ACKSTAT cannot be defined because it is used by more than one SFR */
-
-/* U1MODE */
-/* Bitname _STSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _PDSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _PDSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _BRGH cannot be defined because it is used by more than one SFR */
-/* Bitname _RXINV cannot be defined because it is used by more than one SFR */
-/* Bitname _ABAUD cannot be defined because it is used by more than one SFR */
-/* Bitname _LPBACK cannot be defined because it is used by more than one SFR */
-/* Bitname _WAKE cannot be defined because it is used by more than one SFR */
-/* Bitname _UEN0 cannot be defined because it is used by more than one SFR */
-/* Bitname _UEN1 cannot be defined because it is used by more than one SFR */
-/* Bitname _RTSMD cannot be defined because it is used by more than one SFR */
-/* Bitname _IREN cannot be defined because it is used by more than one SFR */
-/* Bitname _USIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _UARTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _PDSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _UEN cannot be defined because it is used by more than one SFR */
-
-/* U1STA */
-/* Bitname _URXDA cannot be defined because it is used by more than one SFR */
-/* Bitname _OERR cannot be defined because it is used by more than one SFR */
-/* Bitname _FERR cannot be defined because it is used by more than one SFR */
-/* Bitname _PERR cannot be defined because it is used by more than one SFR */
-/* Bitname _RIDLE cannot be defined because it is used by more than one SFR */
-/* Bitname _ADDEN cannot be defined because it is used by more than one SFR */
-/* Bitname _URXISEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _URXISEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRMT cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXBF cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXBRK cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXISEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXINV cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXISEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _URXISEL cannot be defined because it is used by more than one SFR */
-
-/* U2MODE */
-/* Bitname _STSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _PDSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _PDSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _BRGH cannot be defined because it is used by more than one SFR */
-/* Bitname _RXINV cannot be defined because it is used by more than one SFR */
-/* Bitname _ABAUD cannot be defined because it is used by more than one SFR */
-/* Bitname _LPBACK cannot be defined because it is used by more than one SFR */
-/* Bitname _WAKE cannot be defined because it is used by more than one SFR */
-/* Bitname _UEN0 cannot be defined because it is used by more than one SFR */
-/* Bitname _UEN1 cannot be defined because it is used by more than one SFR */
-/* Bitname _RTSMD cannot be defined because it is used by more than one SFR */
-/* Bitname _IREN cannot be defined because it is used by more than one SFR */
-/* Bitname _USIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _UARTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _PDSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _UEN cannot be defined because it is used by more than one SFR */
-
-/* U2STA */
-/* Bitname _URXDA cannot be defined because it is used by more than one SFR */
-/* Bitname _OERR cannot be defined because it is used by more than one SFR */
-/* Bitname _FERR cannot be defined because it is used by more than one SFR */
-/* Bitname _PERR cannot be defined because it is used by more than one SFR */
-/* Bitname _RIDLE cannot be defined because it is used by more than one SFR */
-/* Bitname _ADDEN cannot be defined because it is used by more than one SFR */
-/* Bitname _URXISEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _URXISEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRMT cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXBF cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXBRK cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXISEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXINV cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXISEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _URXISEL cannot be defined because it is used by more than one SFR */
-
-/* SPI1STAT */
-/* Bitname _SPIRBF cannot be defined because it is used by more than one SFR */
-/* Bitname _SPITBF cannot be defined because it is used by more than one SFR */
-/* Bitname _SISEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SISEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SISEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SRXMPT cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIROV cannot be defined because it is used by more than one SFR */
-/* Bitname _SRMPT cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIBEC0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIBEC1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIBEC2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPISIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIEN cannot be defined because it is used by more than one SFR */
-/* Bitname _SISEL cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIBEC cannot be defined because it is used by more than one SFR */
-
-/* SPI1CON1 */
-/* Bitname _PPRE0 cannot be defined because it is used by more than one SFR */
-/* Bitname _PPRE1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPRE0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPRE1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPRE2 cannot be defined because it is used by more than one SFR */
-/* Bitname _MSTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _CKP cannot be defined because it is used by more than one SFR */
-/* Bitname _SSEN cannot be defined because it is used by more than one SFR */
-/* Bitname _CKE cannot be defined because it is used by more than one SFR */
-/* Bitname _SMP cannot be defined because it is used by more than one SFR */
-/* Bitname _MODE16 cannot be defined because it is used by more than one SFR */
-/* Bitname _DISSDO cannot be defined because it is used by more than one SFR */
-/* Bitname _DISSCK cannot be defined because it is used by more than one SFR */
-/* Bitname _PPRE cannot be defined because it is used by more than one SFR */
-/* Bitname _SPRE cannot be defined because it is used by more than one SFR */
-
-/* SPI1CON2 */
-/* Bitname _SPIBEN cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIFE cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIFPOL cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIFSD cannot be defined because it is used by more than one SFR */
-/* Bitname _FRMEN cannot be defined because it is used by more than one SFR */
-
-/* U3MODE */
-/* Bitname _STSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _PDSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _PDSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _BRGH cannot be defined because it is used by more than one SFR */
-/* Bitname _RXINV cannot be defined because it is used by more than one SFR */
-/* Bitname _ABAUD cannot be defined because it is used by more than one SFR */
-/* Bitname _LPBACK cannot be defined because it is used by more than one SFR */
-/* Bitname _WAKE cannot be defined because it is used by more than one SFR */
-/* Bitname _UEN0 cannot be defined because it is used by more than one SFR */
-/* Bitname _UEN1 cannot be defined because it is used by more than one SFR */
-/* Bitname _RTSMD cannot be defined because it is used by more than one SFR */
-/* Bitname _IREN cannot be defined because it is used by more than one SFR */
-/* Bitname _USIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _UARTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _PDSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _UEN cannot be defined because it is used by more than one SFR */
-
-/* U3STA */
-/* Bitname _URXDA cannot be defined because it is used by more than one SFR */
-/* Bitname _OERR cannot be defined because it is used by more than one SFR */
-/* Bitname _FERR cannot be defined because it is used by more than one SFR */
-/* Bitname _PERR cannot be defined because it is used by more than one SFR */
-/* Bitname _RIDLE cannot be defined because it is used by more than one SFR */
-/* Bitname _ADDEN cannot be defined because it is used by more than one SFR */
-/* Bitname _URXISEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _URXISEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRMT cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXBF cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXBRK cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXISEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXINV cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXISEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _URXISEL cannot be defined because it is used by more than one SFR */
-
-/* SPI2STAT */
-/* Bitname _SPIRBF cannot be defined because it is used by more than one SFR */
-/* Bitname _SPITBF cannot be defined because it is used by more than one SFR */
-/* Bitname _SISEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SISEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SISEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SRXMPT cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIROV cannot be defined because it is used by more than one SFR */
-/* Bitname _SRMPT cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIBEC0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIBEC1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIBEC2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPISIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIEN cannot be defined because it is used by more than one SFR */
-/* Bitname _SISEL cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIBEC cannot be defined because it is used by more than one SFR */
-
-/* SPI2CON1 */
-/* Bitname _PPRE0 cannot be defined because it is used by more than one SFR */
-/* Bitname _PPRE1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPRE0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPRE1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPRE2 cannot be defined because it is used by more than one SFR */
-/* Bitname _MSTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _CKP cannot be defined because it is used by more than one SFR */
-/* Bitname _SSEN cannot be defined because it is used by more than one SFR */
-/* Bitname _CKE cannot be defined because it is used by more than one SFR */
-/* Bitname _SMP cannot be defined because it is used by more than one SFR */
-/* Bitname _MODE16 cannot be defined because it is used by more than one SFR */
-/* Bitname _DISSDO cannot be defined because it is used by more than one SFR */
-/* Bitname _DISSCK cannot be defined because it is used by more than one SFR */
-/* Bitname _PPRE cannot be defined because it is used by more than one SFR */
-/* Bitname _SPRE cannot be defined because it is used by more than one SFR */
-
-/* SPI2CON2 */
-/* Bitname _SPIBEN cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIFE cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIFPOL cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIFSD cannot be defined because it is used by more than one SFR */
-/* Bitname _FRMEN cannot be defined because it is used by more than one SFR */
-
-/* I2C3CON */
-/* Bitname _SEN cannot be defined because it is used by more than one SFR */
-/* Bitname _RSEN cannot be defined because it is used by more than one SFR */
-/* Bitname _PEN cannot be defined because it is used by more than one SFR */
-/* Bitname _RCEN cannot be defined because it is used by more than one SFR */
-/* Bitname _ACKEN cannot be defined because it is used by more than one SFR */
-/* Bitname _ACKDT cannot be defined because it is used by more than one SFR */
-/* Bitname _STREN cannot be defined because it is used by more than one SFR */
-/* Bitname _GCEN cannot be defined because it is used by more than one SFR */
-/* Bitname _SMEN cannot be defined because it is used by more than one SFR */
-/* Bitname _DISSLW cannot be defined because it is used by more than one SFR */
-/* Bitname _A10M cannot be defined because it is used by more than one SFR */
-/* Bitname _IPMIEN cannot be defined because it is used by more than one SFR */
-/* Bitname _SCLREL cannot be defined because it is used by more than one SFR */
-/* Bitname _I2CSIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _I2CEN cannot be defined because it is used by more than one SFR */
-
-/* I2C3STAT */
-/* Bitname _TBF cannot be defined because it is used by more than one SFR */
-/* Bitname _RBF cannot be defined because it is used by more than one SFR */
-/* Bitname _R_W cannot be defined because it is used by more than one SFR */
-/* Bitname _S cannot be defined because it is used by more than one SFR */
-/* Bitname _P cannot be defined because it is used by more than one SFR */
-/* Bitname _D_A cannot be defined because it is used by more than one SFR */
-/* Bitname _I2COV cannot be defined because it is used by more than one SFR */
-/* Bitname _IWCOL cannot be defined because it is used by more than one SFR */
-/* Bitname _ADD10 cannot be defined because it is used by more than one SFR */
-/* Bitname _GCSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _BCL cannot be defined because it is used by more than one SFR */
-/* Bitname _TRSTAT cannot be defined because it is used by more than one SFR */
-/* Bitname _ACKSTAT cannot be defined because it is used by more than one SFR */
-
-/* SPI3STAT */
-/* Bitname _SPIRBF cannot be defined because it is used by more than one SFR */
-/* Bitname _SPITBF cannot be defined because it is used by more than one SFR */
-/* Bitname _SISEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SISEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SISEL2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SRXMPT cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIROV cannot be defined because it is used by more than one SFR */
-/* Bitname _SRMPT cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIBEC0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIBEC1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIBEC2 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPISIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIEN cannot be defined because it is used by more than one SFR */
-/* Bitname _SISEL cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIBEC cannot be defined because it is used by more than one SFR */
-
-/* SPI3CON1 */
-/* Bitname _PPRE0 cannot be defined because it is used by more than one SFR */
-/* Bitname _PPRE1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPRE0 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPRE1 cannot be defined because it is used by more than one SFR */
-/* Bitname _SPRE2 cannot be defined because it is used by more than one SFR */
-/* Bitname _MSTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _CKP cannot be defined because it is used by more than one SFR */
-/* Bitname _SSEN cannot be defined because it is used by more than one SFR */
-/* Bitname _CKE cannot be defined because it is used by more than one SFR */
-/* Bitname _SMP cannot be defined because it is used by more than one SFR */
-/* Bitname _MODE16 cannot be defined because it is used by more than one SFR */
-/* Bitname _DISSDO cannot be defined because it is used by more than one SFR */
-/* Bitname _DISSCK cannot be defined because it is used by more than one SFR */
-/* Bitname _PPRE cannot be defined because it is used by more than one SFR */
-/* Bitname _SPRE cannot be defined because it is used by more than one SFR */
-
-/* SPI3CON2 */
-/* Bitname _SPIBEN cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIFE cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIFPOL cannot be defined because it is used by more than one SFR */
-/* Bitname _SPIFSD cannot be defined because it is used by more than one SFR */
-/* Bitname _FRMEN cannot be defined because it is used by more than one SFR */
-
-/* U4MODE */
-/* Bitname _STSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _PDSEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _PDSEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _BRGH cannot be defined because it is used by more than one SFR */
-/* Bitname _RXINV cannot be defined because it is used by more than one SFR */
-/* Bitname _ABAUD cannot be defined because it is used by more than one SFR */
-/* Bitname _LPBACK cannot be defined because it is used by more than one SFR */
-/* Bitname _WAKE cannot be defined because it is used by more than one SFR */
-/* Bitname _UEN0 cannot be defined because it is used by more than one SFR */
-/* Bitname _UEN1 cannot be defined because it is used by more than one SFR */
-/* Bitname _RTSMD cannot be defined because it is used by more than one SFR */
-/* Bitname _IREN cannot be defined because it is used by more than one SFR */
-/* Bitname _USIDL cannot be defined because it is used by more than one SFR */
-/* Bitname _UARTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _PDSEL cannot be defined because it is used by more than one SFR */
-/* Bitname _UEN cannot be defined because it is used by more than one SFR */
-
-/* U4STA */
-/* Bitname _URXDA cannot be defined because it is used by more than one SFR */
-/* Bitname _OERR cannot be defined because it is used by more than one SFR */
-/* Bitname _FERR cannot be defined because it is used by more than one SFR */
-/* Bitname _PERR cannot be defined because it is used by more than one SFR */
-/* Bitname _RIDLE cannot be defined because it is used by more than one SFR */
-/* Bitname _ADDEN cannot be defined because it is used by more than one SFR */
-/* Bitname _URXISEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _URXISEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _TRMT cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXBF cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXBRK cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXISEL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXINV cannot be defined because it is used by more than one SFR */
-/* Bitname _UTXISEL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _URXISEL cannot be defined because it is used by more than one SFR */
-
-/* TRISB */
-#define _TRISB0 TRISBbits.TRISB0
-#define _TRISB1 TRISBbits.TRISB1
-#define _TRISB2 TRISBbits.TRISB2
-#define _TRISB3 TRISBbits.TRISB3
-#define _TRISB4 TRISBbits.TRISB4
-#define _TRISB5 TRISBbits.TRISB5
-#define _TRISB6 TRISBbits.TRISB6
-#define _TRISB7 TRISBbits.TRISB7
-#define _TRISB8 TRISBbits.TRISB8
-#define _TRISB9 TRISBbits.TRISB9
-#define _TRISB10 TRISBbits.TRISB10
-#define _TRISB11 TRISBbits.TRISB11
-#define _TRISB12 TRISBbits.TRISB12
-#define _TRISB13 TRISBbits.TRISB13
-#define _TRISB14 TRISBbits.TRISB14
-#define _TRISB15 TRISBbits.TRISB15
-
-/* PORTB */
-#define _RB0 PORTBbits.RB0
-#define _RB1 PORTBbits.RB1
-#define _RB2 PORTBbits.RB2
-#define _RB3 PORTBbits.RB3
-#define _RB4 PORTBbits.RB4
-#define _RB5 PORTBbits.RB5
-#define _RB6 PORTBbits.RB6
-#define _RB7 PORTBbits.RB7
-#define _RB8 PORTBbits.RB8
-#define _RB9 PORTBbits.RB9
-#define _RB10 PORTBbits.RB10
-#define _RB11 PORTBbits.RB11
-#define _RB12 PORTBbits.RB12
-#define _RB13 PORTBbits.RB13
-#define _RB14 PORTBbits.RB14
-#define _RB15 PORTBbits.RB15
-
-/* LATB */
-#define _LATB0 LATBbits.LATB0
-#define _LATB1 LATBbits.LATB1
-#define _LATB2 LATBbits.LATB2
-#define _LATB3 LATBbits.LATB3
-#define _LATB4 LATBbits.LATB4
-#define _LATB5 LATBbits.LATB5
-#define _LATB6 LATBbits.LATB6
-#define _LATB7 LATBbits.LATB7
-#define _LATB8 LATBbits.LATB8
-#define _LATB9 LATBbits.LATB9
-#define _LATB10 LATBbits.LATB10
-#define _LATB11 LATBbits.LATB11
-#define _LATB12 LATBbits.LATB12
-#define _LATB13 LATBbits.LATB13
-#define _LATB14 LATBbits.LATB14
-#define _LATB15 LATBbits.LATB15
-
-/* ODCB */
-#define _ODB0 ODCBbits.ODB0
-#define _ODB1 ODCBbits.ODB1
-#define _ODB2 ODCBbits.ODB2
-#define _ODB3 ODCBbits.ODB3
-#define _ODB4 ODCBbits.ODB4
-#define _ODB5 ODCBbits.ODB5
-#define _ODB6 ODCBbits.ODB6
-#define _ODB7 ODCBbits.ODB7
-#define _ODB8 ODCBbits.ODB8
-#define _ODB9 ODCBbits.ODB9
-#define _ODB10 ODCBbits.ODB10
-#define _ODB11 ODCBbits.ODB11
-#define _ODB12 ODCBbits.ODB12
-#define _ODB13 ODCBbits.ODB13
-#define _ODB14 ODCBbits.ODB14
-#define _ODB15 ODCBbits.ODB15
-
-/* TRISC */
-#define _TRISC12 TRISCbits.TRISC12
-#define _TRISC13 TRISCbits.TRISC13
-#define _TRISC14 TRISCbits.TRISC14
-#define _TRISC15 TRISCbits.TRISC15
-
-/* PORTC */
-#define _RC12 PORTCbits.RC12
-#define _RC13 PORTCbits.RC13
-#define _RC14 PORTCbits.RC14
-#define _RC15 PORTCbits.RC15
-
-/* LATC */
-#define _LATC12 LATCbits.LATC12
-#define _LATC13 LATCbits.LATC13
-#define _LATC14 LATCbits.LATC14
-#define _LATC15 LATCbits.LATC15
-
-/* ODCC */
-#define _ODC12 ODCCbits.ODC12
-#define _ODC13 ODCCbits.ODC13
-#define _ODC14 ODCCbits.ODC14
-#define _ODC15 ODCCbits.ODC15
-
-/* TRISD */
-#define _TRISD0 TRISDbits.TRISD0
-#define _TRISD1 TRISDbits.TRISD1
-#define _TRISD2 TRISDbits.TRISD2
-#define _TRISD3 TRISDbits.TRISD3
-#define _TRISD4 TRISDbits.TRISD4
-#define _TRISD5 TRISDbits.TRISD5
-#define _TRISD6 TRISDbits.TRISD6
-#define _TRISD7 TRISDbits.TRISD7
-#define _TRISD8 TRISDbits.TRISD8
-#define _TRISD9 TRISDbits.TRISD9
-#define _TRISD10 TRISDbits.TRISD10
-#define _TRISD11 TRISDbits.TRISD11
-
-/* PORTD */
-#define _RD0 PORTDbits.RD0
-#define _RD1 PORTDbits.RD1
-#define _RD2 PORTDbits.RD2
-#define _RD3 PORTDbits.RD3
-#define _RD4 PORTDbits.RD4
-#define _RD5 PORTDbits.RD5
-#define _RD6 PORTDbits.RD6
-#define _RD7 PORTDbits.RD7
-#define _RD8 PORTDbits.RD8
-#define _RD9 PORTDbits.RD9
-#define _RD10 PORTDbits.RD10
-#define _RD11 PORTDbits.RD11
-
-/* LATD */
-#define _LATD0 LATDbits.LATD0
-#define _LATD1 LATDbits.LATD1
-#define _LATD2 LATDbits.LATD2
-#define _LATD3 LATDbits.LATD3
-#define _LATD4 LATDbits.LATD4
-#define _LATD5 LATDbits.LATD5
-#define _LATD6 LATDbits.LATD6
-#define _LATD7 LATDbits.LATD7
-#define _LATD8 LATDbits.LATD8
-#define _LATD9 LATDbits.LATD9
-#define _LATD10 LATDbits.LATD10
-#define _LATD11 LATDbits.LATD11
-
-/* ODCD */
-#define _ODD0 ODCDbits.ODD0
-#define _ODD1 ODCDbits.ODD1
-#define _ODD2 ODCDbits.ODD2
-#define _ODD3 ODCDbits.ODD3
-#define _ODD4 ODCDbits.ODD4
-#define _ODD5 ODCDbits.ODD5
-#define _ODD6 ODCDbits.ODD6
-#define _ODD7 ODCDbits.ODD7
-#define _ODD8 ODCDbits.ODD8
-#define _ODD9 ODCDbits.ODD9
-#define _ODD10 ODCDbits.ODD10
-#define _ODD11 ODCDbits.ODD11
-
-/* TRISE */
-#define _TRISE0 TRISEbits.TRISE0
-#define _TRISE1 TRISEbits.TRISE1
-#define _TRISE2 TRISEbits.TRISE2
-#define _TRISE3 TRISEbits.TRISE3
-#define _TRISE4 TRISEbits.TRISE4
-#define _TRISE5 TRISEbits.TRISE5
-#define _TRISE6 TRISEbits.TRISE6
-#define _TRISE7 TRISEbits.TRISE7
-
-/* PORTE */
-#define _RE0 PORTEbits.RE0
-#define _RE1 PORTEbits.RE1
-#define _RE2 PORTEbits.RE2
-#define _RE3 PORTEbits.RE3
-#define _RE4 PORTEbits.RE4
-#define _RE5 PORTEbits.RE5
-#define _RE6 PORTEbits.RE6
-#define _RE7 PORTEbits.RE7
-
-/* LATE */
-#define _LATE0 LATEbits.LATE0
-#define _LATE1 LATEbits.LATE1
-#define _LATE2 LATEbits.LATE2
-#define _LATE3 LATEbits.LATE3
-#define _LATE4 LATEbits.LATE4
-#define _LATE5 LATEbits.LATE5
-#define _LATE6 LATEbits.LATE6
-#define _LATE7 LATEbits.LATE7
-
-/* ODCE */
-#define _ODE0 ODCEbits.ODE0
-#define _ODE1 ODCEbits.ODE1
-#define _ODE2 ODCEbits.ODE2
-#define _ODE3 ODCEbits.ODE3
-#define _ODE4 ODCEbits.ODE4
-#define _ODE5 ODCEbits.ODE5
-#define _ODE6 ODCEbits.ODE6
-#define _ODE7 ODCEbits.ODE7
-
-/* TRISF */
-#define _TRISF0 TRISFbits.TRISF0
-#define _TRISF1 TRISFbits.TRISF1
-#define _TRISF3 TRISFbits.TRISF3
-#define _TRISF4 TRISFbits.TRISF4
-#define _TRISF5 TRISFbits.TRISF5
-
-/* PORTF */
-#define _RF0 PORTFbits.RF0
-#define _RF1 PORTFbits.RF1
-#define _RF3 PORTFbits.RF3
-#define _RF4 PORTFbits.RF4
-#define _RF5 PORTFbits.RF5
-
-/* LATF */
-#define _LATF0 LATFbits.LATF0
-#define _LATF1 LATFbits.LATF1
-#define _LATF3 LATFbits.LATF3
-#define _LATF4 LATFbits.LATF4
-#define _LATF5 LATFbits.LATF5
-
-/* ODCF */
-#define _ODF0 ODCFbits.ODF0
-#define _ODF1 ODCFbits.ODF1
-#define _ODF3 ODCFbits.ODF3
-#define _ODF4 ODCFbits.ODF4
-#define _ODF5 ODCFbits.ODF5
-
-/* TRISG */
-#define _TRISG2 TRISGbits.TRISG2
-#define _TRISG3 TRISGbits.TRISG3
-#define _TRISG6 TRISGbits.TRISG6
-#define _TRISG7 TRISGbits.TRISG7
-#define _TRISG8 TRISGbits.TRISG8
-#define _TRISG9 TRISGbits.TRISG9
-
-/* PORTG */
-#define _RG2 PORTGbits.RG2
-#define _RG3 PORTGbits.RG3
-#define _RG6 PORTGbits.RG6
-#define _RG7 PORTGbits.RG7
-#define _RG8 PORTGbits.RG8
-#define _RG9 PORTGbits.RG9
-
-/* LATG */
-#define _LATG2 LATGbits.LATG2
-#define _LATG3 LATGbits.LATG3
-#define _LATG6 LATGbits.LATG6
-#define _LATG7 LATGbits.LATG7
-#define _LATG8 LATGbits.LATG8
-#define _LATG9 LATGbits.LATG9
-
-/* ODCG */
-#define _ODG2 ODCGbits.ODG2
-#define _ODG3 ODCGbits.ODG3
-#define _ODG6 ODCGbits.ODG6
-#define _ODG7 ODCGbits.ODG7
-#define _ODG8 ODCGbits.ODG8
-#define _ODG9 ODCGbits.ODG9
-
-/* PADCFG1 */
-#define _PMPTTL PADCFG1bits.PMPTTL
-#define _RTSECSEL PADCFG1bits.RTSECSEL
-#define _RTSECSEL0 PADCFG1bits.RTSECSEL0
-
-/* AD1CON1 */
-#define _DONE AD1CON1bits.DONE
-#define _SAMP AD1CON1bits.SAMP
-#define _ASAM AD1CON1bits.ASAM
-#define _SSRC0 AD1CON1bits.SSRC0
-#define _SSRC1 AD1CON1bits.SSRC1
-#define _SSRC2 AD1CON1bits.SSRC2
-#define _FORM0 AD1CON1bits.FORM0
-#define _FORM1 AD1CON1bits.FORM1
-#define _ADSIDL AD1CON1bits.ADSIDL
-#define _ADON AD1CON1bits.ADON
-#define _SSRC AD1CON1bits.SSRC
-#define _FORM AD1CON1bits.FORM
-
-/* AD1CON2 */
-#define _ALTS AD1CON2bits.ALTS
-#define _BUFM AD1CON2bits.BUFM
-#define _SMPI0 AD1CON2bits.SMPI0
-#define _SMPI1 AD1CON2bits.SMPI1
-#define _SMPI2 AD1CON2bits.SMPI2
-#define _SMPI3 AD1CON2bits.SMPI3
-#define _BUFS AD1CON2bits.BUFS
-#define _CSCNA AD1CON2bits.CSCNA
-#define _OFFCAL AD1CON2bits.OFFCAL
-#define _VCFG0 AD1CON2bits.VCFG0
-#define _VCFG1 AD1CON2bits.VCFG1
-#define _VCFG2 AD1CON2bits.VCFG2
-#define _SMPI AD1CON2bits.SMPI
-#define _VCFG AD1CON2bits.VCFG
-
-/* AD1CON3 */
-#define _ADCS0 AD1CON3bits.ADCS0
-#define _ADCS1 AD1CON3bits.ADCS1
-#define _ADCS2 AD1CON3bits.ADCS2
-#define _ADCS3 AD1CON3bits.ADCS3
-#define _ADCS4 AD1CON3bits.ADCS4
-#define _ADCS5 AD1CON3bits.ADCS5
-#define _ADCS6 AD1CON3bits.ADCS6
-#define _ADCS7 AD1CON3bits.ADCS7
-#define _SAMC0 AD1CON3bits.SAMC0
-#define _SAMC1 AD1CON3bits.SAMC1
-#define _SAMC2 AD1CON3bits.SAMC2
-#define _SAMC3 AD1CON3bits.SAMC3
-#define _SAMC4 AD1CON3bits.SAMC4
-#define _ADRC AD1CON3bits.ADRC
-#define _ADCS AD1CON3bits.ADCS
-#define _SAMC AD1CON3bits.SAMC
-
-/* AD1CHS */
-#define _CH0SA0 AD1CHSbits.CH0SA0
-#define _CH0SA1 AD1CHSbits.CH0SA1
-#define _CH0SA2 AD1CHSbits.CH0SA2
-#define _CH0SA3 AD1CHSbits.CH0SA3
-#define _CH0SA4 AD1CHSbits.CH0SA4
-#define _CH0NA AD1CHSbits.CH0NA
-#define _CH0SB0 AD1CHSbits.CH0SB0
-#define _CH0SB1 AD1CHSbits.CH0SB1
-#define _CH0SB2 AD1CHSbits.CH0SB2
-#define _CH0SB3 AD1CHSbits.CH0SB3
-#define _CH0SB4 AD1CHSbits.CH0SB4
-#define _CH0NB AD1CHSbits.CH0NB
-#define _CH0SA AD1CHSbits.CH0SA
-#define _CH0SB AD1CHSbits.CH0SB
-
-/* AD1PCFGH */
-#define _PCFG16 AD1PCFGHbits.PCFG16
-#define _PCFG17 AD1PCFGHbits.PCFG17
-
-/* AD1PCFG */
-#define _PCFG0 AD1PCFGbits.PCFG0
-#define _PCFG1 AD1PCFGbits.PCFG1
-#define _PCFG2 AD1PCFGbits.PCFG2
-#define _PCFG3 AD1PCFGbits.PCFG3
-#define _PCFG4 AD1PCFGbits.PCFG4
-#define _PCFG5 AD1PCFGbits.PCFG5
-#define _PCFG6 AD1PCFGbits.PCFG6
-#define _PCFG7 AD1PCFGbits.PCFG7
-#define _PCFG8 AD1PCFGbits.PCFG8
-#define _PCFG9 AD1PCFGbits.PCFG9
-#define _PCFG10 AD1PCFGbits.PCFG10
-#define _PCFG11 AD1PCFGbits.PCFG11
-#define _PCFG12 AD1PCFGbits.PCFG12
-#define _PCFG13 AD1PCFGbits.PCFG13
-#define _PCFG14 AD1PCFGbits.PCFG14
-#define _PCFG15 AD1PCFGbits.PCFG15
-
-/* AD1CSSL */
-#define _CSSL0 AD1CSSLbits.CSSL0
-#define _CSSL1 AD1CSSLbits.CSSL1
-#define _CSSL2 AD1CSSLbits.CSSL2
-#define _CSSL3 AD1CSSLbits.CSSL3
-#define _CSSL4 AD1CSSLbits.CSSL4
-#define _CSSL5 AD1CSSLbits.CSSL5
-#define _CSSL6 AD1CSSLbits.CSSL6
-#define _CSSL7 AD1CSSLbits.CSSL7
-#define _CSSL8 AD1CSSLbits.CSSL8
-#define _CSSL9 AD1CSSLbits.CSSL9
-#define _CSSL10 AD1CSSLbits.CSSL10
-#define _CSSL11 AD1CSSLbits.CSSL11
-#define _CSSL12 AD1CSSLbits.CSSL12
-#define _CSSL13 AD1CSSLbits.CSSL13
-#define _CSSL14 AD1CSSLbits.CSSL14
-#define _CSSL15 AD1CSSLbits.CSSL15
-
-/* AD1CSSH */
-#define _CSSL16 AD1CSSHbits.CSSL16
-#define _CSSL17 AD1CSSHbits.CSSL17
-
-/* CTMUCON */
-#define _EDG1STAT CTMUCONbits.EDG1STAT
-#define _EDG2STAT CTMUCONbits.EDG2STAT
-#define _EDG1SEL0 CTMUCONbits.EDG1SEL0
-#define _EDG1SEL1 CTMUCONbits.EDG1SEL1
-#define _EDG1POL CTMUCONbits.EDG1POL
-#define _EDG2SEL0 CTMUCONbits.EDG2SEL0
-#define _EDG2SEL1 CTMUCONbits.EDG2SEL1
-#define _EDG2POL CTMUCONbits.EDG2POL
-#define _CTTRIG CTMUCONbits.CTTRIG
-#define _IDISSEN CTMUCONbits.IDISSEN
-#define _EDGSEQEN CTMUCONbits.EDGSEQEN
-#define _EDGEN CTMUCONbits.EDGEN
-#define _TGEN CTMUCONbits.TGEN
-#define _CTMUSIDL CTMUCONbits.CTMUSIDL
-#define _CTMUEN CTMUCONbits.CTMUEN
-#define _EDG1SEL CTMUCONbits.EDG1SEL
-#define _EDG2SEL CTMUCONbits.EDG2SEL
-
-/* CTMUICON */
-#define _IRNG0 CTMUICONbits.IRNG0
-#define _IRNG1 CTMUICONbits.IRNG1
-#define _ITRIM0 CTMUICONbits.ITRIM0
-#define _ITRIM1 CTMUICONbits.ITRIM1
-#define _ITRIM2 CTMUICONbits.ITRIM2
-#define _ITRIM3 CTMUICONbits.ITRIM3
-#define _ITRIM4 CTMUICONbits.ITRIM4
-#define _ITRIM5 CTMUICONbits.ITRIM5
-#define _IRNG CTMUICONbits.IRNG
-#define _ITRIM CTMUICONbits.ITRIM
-
-/* U1OTGIR */
-#define _VBUSVDIF U1OTGIRbits.VBUSVDIF
-#define _SESENDIF U1OTGIRbits.SESENDIF
-#define _SESVDIF U1OTGIRbits.SESVDIF
-#define _ACTVIF U1OTGIRbits.ACTVIF
-#define _LSTATEIF U1OTGIRbits.LSTATEIF
-#define _T1MSECIF U1OTGIRbits.T1MSECIF
-#define _IDIF U1OTGIRbits.IDIF
-
-/* U1OTGIE */
-#define _VBUSVDIE U1OTGIEbits.VBUSVDIE
-#define _SESENDIE U1OTGIEbits.SESENDIE
-#define _SESVDIE U1OTGIEbits.SESVDIE
-#define _ACTVIE U1OTGIEbits.ACTVIE
-#define _LSTATEIE U1OTGIEbits.LSTATEIE
-#define _T1MSECIE U1OTGIEbits.T1MSECIE
-#define _IDIE U1OTGIEbits.IDIE
-
-/* U1OTGSTAT */
-#define _VBUSVD U1OTGSTATbits.VBUSVD
-#define _SESEND U1OTGSTATbits.SESEND
-#define _SESVD U1OTGSTATbits.SESVD
-#define _LSTATE U1OTGSTATbits.LSTATE
-#define _ID U1OTGSTATbits.ID
-
-/* U1OTGCON */
-#define _VBUSDIS U1OTGCONbits.VBUSDIS
-#define _VBUSCHG U1OTGCONbits.VBUSCHG
-#define _OTGEN U1OTGCONbits.OTGEN
-#define _VBUSON U1OTGCONbits.VBUSON
-#define _DMPULDWN U1OTGCONbits.DMPULDWN
-#define _DPPULDWN U1OTGCONbits.DPPULDWN
-#define _DMPULUP U1OTGCONbits.DMPULUP
-#define _DPPULUP U1OTGCONbits.DPPULUP
-
-/* U1PWRC */
-#define _USBPWR U1PWRCbits.USBPWR
-#define _USUSPEND U1PWRCbits.USUSPEND
-#define _USLPGRD U1PWRCbits.USLPGRD
-#define _UACTPND U1PWRCbits.UACTPND
-#define _USUSPND U1PWRCbits.USUSPND
-
-/* U1IR */
-#define _DETACHIF U1IRbits.DETACHIF
-#define _UERRIF U1IRbits.UERRIF
-#define _SOFIF U1IRbits.SOFIF
-#define _TRNIF U1IRbits.TRNIF
-#define _IDLEIF U1IRbits.IDLEIF
-#define _RESUMEIF U1IRbits.RESUMEIF
-#define _ATTACHIF U1IRbits.ATTACHIF
-#define _STALLIF U1IRbits.STALLIF
-#define _URSTIF U1IRbits.URSTIF
-
-/* U1IE */
-#define _DETACHIE U1IEbits.DETACHIE
-#define _UERRIE U1IEbits.UERRIE
-#define _SOFIE U1IEbits.SOFIE
-#define _TRNIE U1IEbits.TRNIE
-#define _IDLEIE U1IEbits.IDLEIE
-#define _RESUMEIE U1IEbits.RESUMEIE
-#define _ATTACHIE U1IEbits.ATTACHIE
-#define _STALLIE U1IEbits.STALLIE
-#define _URSTIE U1IEbits.URSTIE
-
-/* U1EIR */
-#define _PIDEF U1EIRbits.PIDEF
-#define _CRC5EF U1EIRbits.CRC5EF
-#define _CRC16EF U1EIRbits.CRC16EF
-#define _DFN8EF U1EIRbits.DFN8EF
-#define _BTOEF U1EIRbits.BTOEF
-#define _DMAEF U1EIRbits.DMAEF
-#define _BTSEF U1EIRbits.BTSEF
-#define _EOFEF U1EIRbits.EOFEF
-
-/* U1EIE */
-#define _PIDEE U1EIEbits.PIDEE
-#define _CRC5EE U1EIEbits.CRC5EE
-#define _CRC16EE U1EIEbits.CRC16EE
-#define _DFN8EE U1EIEbits.DFN8EE
-#define _BTOEE U1EIEbits.BTOEE
-#define _DMAEE U1EIEbits.DMAEE
-#define _BTSEE U1EIEbits.BTSEE
-#define _EOFEE U1EIEbits.EOFEE
-
-/* U1STAT */
-#define _PPBI U1STATbits.PPBI
-#define _DIR U1STATbits.DIR
-#define _ENDPT0 U1STATbits.ENDPT0
-#define _ENDPT1 U1STATbits.ENDPT1
-#define _ENDPT2 U1STATbits.ENDPT2
-#define _ENDPT3 U1STATbits.ENDPT3
-#define _ENDPT U1STATbits.ENDPT
-
-/* U1CON */
-#define _USBEN U1CONbits.USBEN
-#define _PPBRST U1CONbits.PPBRST
-#define _RESUME U1CONbits.RESUME
-#define _HOSTEN U1CONbits.HOSTEN
-#define _USBRST U1CONbits.USBRST
-#define _PKTDIS U1CONbits.PKTDIS
-#define _SE0 U1CONbits.SE0
-#define _JSTATE U1CONbits.JSTATE
-#define _SOFEN U1CONbits.SOFEN
-#define _TOKBUSY U1CONbits.TOKBUSY
-
-/* U1ADDR */
-#define _DEVADDR0 U1ADDRbits.DEVADDR0
-#define _DEVADDR1 U1ADDRbits.DEVADDR1
-#define _DEVADDR2 U1ADDRbits.DEVADDR2
-#define _DEVADDR3 U1ADDRbits.DEVADDR3
-#define _DEVADDR4 U1ADDRbits.DEVADDR4
-#define _DEVADDR5 U1ADDRbits.DEVADDR5
-#define _DEVADDR6 U1ADDRbits.DEVADDR6
-#define _LOWSPDEN U1ADDRbits.LOWSPDEN
-#define _DEVADDR U1ADDRbits.DEVADDR
-#define _LSPDEN U1ADDRbits.LSPDEN
-
-/* U1BDTP1 */
-#define _BDTPTRL U1BDTP1bits.BDTPTRL
-
-/* U1FRML */
-#define _FRM0 U1FRMLbits.FRM0
-#define _FRM1 U1FRMLbits.FRM1
-#define _FRM2 U1FRMLbits.FRM2
-#define _FRM3 U1FRMLbits.FRM3
-#define _FRM4 U1FRMLbits.FRM4
-#define _FRM5 U1FRMLbits.FRM5
-#define _FRM6 U1FRMLbits.FRM6
-#define _FRM7 U1FRMLbits.FRM7
-
-/* U1FRMH */
-#define _FRM8 U1FRMHbits.FRM8
-#define _FRM9 U1FRMHbits.FRM9
-#define _FRM10 U1FRMHbits.FRM10
-
-/* U1TOK */
-#define _EP0 U1TOKbits.EP0
-#define _EP1 U1TOKbits.EP1
-#define _EP2 U1TOKbits.EP2
-#define _EP3 U1TOKbits.EP3
-#define _PID0 U1TOKbits.PID0
-#define _PID1 U1TOKbits.PID1
-#define _PID2 U1TOKbits.PID2
-#define _PID3 U1TOKbits.PID3
-#define _EP U1TOKbits.EP
-#define _PID U1TOKbits.PID
-
-/* U1SOF */
-#define _CNT U1SOFbits.CNT
-
-/* U1BDTP2 */
-#define _BDTPTRH U1BDTP2bits.BDTPTRH
-
-/* U1BDTP3 */
-#define _BDTPTRU U1BDTP3bits.BDTPTRU
-
-/* U1CNFG1 */
-#define _PPB0 U1CNFG1bits.PPB0
-#define _PPB1 U1CNFG1bits.PPB1
-#define _USBSIDL U1CNFG1bits.USBSIDL
-#define _UOEMON U1CNFG1bits.UOEMON
-#define _UTEYE U1CNFG1bits.UTEYE
-#define _PPB U1CNFG1bits.PPB
-
-/* U1CNFG2 */
-#define _UTRDIS U1CNFG2bits.UTRDIS
-#define _UVCMPDIS U1CNFG2bits.UVCMPDIS
-#define _UVBUSDIS U1CNFG2bits.UVBUSDIS
-#define _EXTI2CEN U1CNFG2bits.EXTI2CEN
-
-/* U1EP0 */
-/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
-/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
-/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
-#define _RETRYDIS U1EP0bits.RETRYDIS
-#define _LOWSPD U1EP0bits.LOWSPD
-/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
-#define _LSPD U1EP0bits.LSPD
-
-/* U1EP1 */
-/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
-/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
-/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
-/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
-
-/* U1EP2 */
-/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
-/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
-/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
-/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
-
-/* U1EP3 */
-/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
-/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
-/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
-/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
-
-/* U1EP4 */
-/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
-/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
-/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
-/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
-
-/* U1EP5 */
-/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
-/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
-/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
-/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
-
-/* U1EP6 */
-/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
-/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
-/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
-/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
-
-/* U1EP7 */
-/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
-/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
-/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
-/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
-
-/* U1EP8 */
-/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
-/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
-/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
-/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
-
-/* U1EP9 */
-/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
-/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
-/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
-/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
-
-/* U1EP10 */
-/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
-/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
-/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
-/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
-
-/* U1EP11 */
-/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
-/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
-/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
-/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
-
-/* U1EP12 */
-/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
-/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
-/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
-/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
-
-/* U1EP13 */
-/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
-/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
-/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
-/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
-
-/* U1EP14 */
-/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
-/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
-/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
-/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
-
-/* U1EP15 */
-/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
-/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
-/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
-/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
-/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
-
-/* U1PWMRRS */
-#define _USBRS0 U1PWMRRSbits.USBRS0
-#define _USBRS1 U1PWMRRSbits.USBRS1
-#define _USBRS2 U1PWMRRSbits.USBRS2
-#define _USBRS3 U1PWMRRSbits.USBRS3
-#define _USBRS4 U1PWMRRSbits.USBRS4
-#define _USBRS5 U1PWMRRSbits.USBRS5
-#define _USBRS6 U1PWMRRSbits.USBRS6
-#define _USBRS7 U1PWMRRSbits.USBRS7
-#define _USBR0 U1PWMRRSbits.USBR0
-#define _USBR1 U1PWMRRSbits.USBR1
-#define _USBR2 U1PWMRRSbits.USBR2
-#define _USBR3 U1PWMRRSbits.USBR3
-#define _USBR4 U1PWMRRSbits.USBR4
-#define _USBR5 U1PWMRRSbits.USBR5
-#define _USBR6 U1PWMRRSbits.USBR6
-#define _USBR7 U1PWMRRSbits.USBR7
-#define _USBRS U1PWMRRSbits.USBRS
-#define _USBR U1PWMRRSbits.USBR
-#define _PER U1PWMRRSbits.PER
-/* Bitname _DC cannot be defined because it is used by more than one SFR */
-#define _PER0 U1PWMRRSbits.PER0
-#define _PER1 U1PWMRRSbits.PER1
-#define _PER2 U1PWMRRSbits.PER2
-#define _PER3 U1PWMRRSbits.PER3
-#define _PER4 U1PWMRRSbits.PER4
-#define _PER5 U1PWMRRSbits.PER5
-#define _PER6 U1PWMRRSbits.PER6
-#define _PER7 U1PWMRRSbits.PER7
-#define _DC0 U1PWMRRSbits.DC0
-#define _DC1 U1PWMRRSbits.DC1
-#define _DC2 U1PWMRRSbits.DC2
-#define _DC3 U1PWMRRSbits.DC3
-#define _DC4 U1PWMRRSbits.DC4
-#define _DC5 U1PWMRRSbits.DC5
-#define _DC6 U1PWMRRSbits.DC6
-#define _DC7 U1PWMRRSbits.DC7
-
-/* U1PWMCON */
-#define _CNTEN U1PWMCONbits.CNTEN
-#define _PWMPOL U1PWMCONbits.PWMPOL
-#define _USBTSEL0 U1PWMCONbits.USBTSEL0
-#define _USBTSEL1 U1PWMCONbits.USBTSEL1
-#define _USBTSEL2 U1PWMCONbits.USBTSEL2
-#define _PWMEN U1PWMCONbits.PWMEN
-#define _USBTSEL U1PWMCONbits.USBTSEL
-
-/* PMCON */
-#define _RDSP PMCONbits.RDSP
-#define _WRSP PMCONbits.WRSP
-#define _BEP PMCONbits.BEP
-#define _CS1P PMCONbits.CS1P
-#define _CS2P PMCONbits.CS2P
-#define _ALP PMCONbits.ALP
-#define _CSF0 PMCONbits.CSF0
-#define _CSF1 PMCONbits.CSF1
-#define _PTRDEN PMCONbits.PTRDEN
-#define _PTWREN PMCONbits.PTWREN
-#define _PTBEEN PMCONbits.PTBEEN
-#define _ADRMUX0 PMCONbits.ADRMUX0
-#define _ADRMUX1 PMCONbits.ADRMUX1
-#define _PSIDL PMCONbits.PSIDL
-#define _PMPEN PMCONbits.PMPEN
-#define _CSF PMCONbits.CSF
-#define _ADRMUX PMCONbits.ADRMUX
-
-/* PMMODE */
-#define _WAITE0 PMMODEbits.WAITE0
-#define _WAITE1 PMMODEbits.WAITE1
-#define _WAITM0 PMMODEbits.WAITM0
-#define _WAITM1 PMMODEbits.WAITM1
-#define _WAITM2 PMMODEbits.WAITM2
-#define _WAITM3 PMMODEbits.WAITM3
-#define _WAITB0 PMMODEbits.WAITB0
-#define _WAITB1 PMMODEbits.WAITB1
-#define _MODE0 PMMODEbits.MODE0
-#define _MODE1 PMMODEbits.MODE1
-/* Bitname _MODE16 cannot be defined because it is used by more than one SFR */
-#define _INCM0 PMMODEbits.INCM0
-#define _INCM1 PMMODEbits.INCM1
-#define _IRQM0 PMMODEbits.IRQM0
-#define _IRQM1 PMMODEbits.IRQM1
-#define _BUSY PMMODEbits.BUSY
-#define _WAITE PMMODEbits.WAITE
-#define _WAITM PMMODEbits.WAITM
-#define _WAITB PMMODEbits.WAITB
-#define _MODE PMMODEbits.MODE
-#define _INCM PMMODEbits.INCM
-#define _IRQM PMMODEbits.IRQM
-
-/* PMADDR */
-#define _CS1 PMADDRbits.CS1
-#define _CS2 PMADDRbits.CS2
-#define _ADDR PMADDRbits.ADDR
-#define _CS PMADDRbits.CS
-
-/* PMAEN */
-#define _PTEN0 PMAENbits.PTEN0
-#define _PTEN1 PMAENbits.PTEN1
-#define _PTEN2 PMAENbits.PTEN2
-#define _PTEN3 PMAENbits.PTEN3
-#define _PTEN4 PMAENbits.PTEN4
-#define _PTEN5 PMAENbits.PTEN5
-#define _PTEN6 PMAENbits.PTEN6
-#define _PTEN7 PMAENbits.PTEN7
-#define _PTEN8 PMAENbits.PTEN8
-#define _PTEN9 PMAENbits.PTEN9
-#define _PTEN10 PMAENbits.PTEN10
-#define _PTEN11 PMAENbits.PTEN11
-#define _PTEN12 PMAENbits.PTEN12
-#define _PTEN13 PMAENbits.PTEN13
-#define _PTEN14 PMAENbits.PTEN14
-#define _PTEN15 PMAENbits.PTEN15
-
-/* PMSTAT */
-#define _OB0E PMSTATbits.OB0E
-#define _OB1E PMSTATbits.OB1E
-#define _OB2E PMSTATbits.OB2E
-#define _OB3E PMSTATbits.OB3E
-#define _OBUF PMSTATbits.OBUF
-#define _OBE PMSTATbits.OBE
-#define _IB0F PMSTATbits.IB0F
-#define _IB1F PMSTATbits.IB1F
-#define _IB2F PMSTATbits.IB2F
-#define _IB3F PMSTATbits.IB3F
-#define _IBOV PMSTATbits.IBOV
-#define _IBF PMSTATbits.IBF
-
-/* ALCFGRPT */
-#define _ARPT0 ALCFGRPTbits.ARPT0
-#define _ARPT1 ALCFGRPTbits.ARPT1
-#define _ARPT2 ALCFGRPTbits.ARPT2
-#define _ARPT3 ALCFGRPTbits.ARPT3
-#define _ARPT4 ALCFGRPTbits.ARPT4
-#define _ARPT5 ALCFGRPTbits.ARPT5
-#define _ARPT6 ALCFGRPTbits.ARPT6
-#define _ARPT7 ALCFGRPTbits.ARPT7
-#define _ALRMPTR0 ALCFGRPTbits.ALRMPTR0
-#define _ALRMPTR1 ALCFGRPTbits.ALRMPTR1
-#define _AMASK0 ALCFGRPTbits.AMASK0
-#define _AMASK1 ALCFGRPTbits.AMASK1
-#define _AMASK2 ALCFGRPTbits.AMASK2
-#define _AMASK3 ALCFGRPTbits.AMASK3
-#define _CHIME ALCFGRPTbits.CHIME
-#define _ALRMEN ALCFGRPTbits.ALRMEN
-#define _ARPT ALCFGRPTbits.ARPT
-#define _ALRMPTR ALCFGRPTbits.ALRMPTR
-#define _AMASK ALCFGRPTbits.AMASK
-
-/* RCFGCAL */
-#define _CAL0 RCFGCALbits.CAL0
-#define _CAL1 RCFGCALbits.CAL1
-#define _CAL2 RCFGCALbits.CAL2
-#define _CAL3 RCFGCALbits.CAL3
-#define _CAL4 RCFGCALbits.CAL4
-#define _CAL5 RCFGCALbits.CAL5
-#define _CAL6 RCFGCALbits.CAL6
-#define _CAL7 RCFGCALbits.CAL7
-#define _RTCPTR0 RCFGCALbits.RTCPTR0
-#define _RTCPTR1 RCFGCALbits.RTCPTR1
-#define _RTCOE RCFGCALbits.RTCOE
-#define _HALFSEC RCFGCALbits.HALFSEC
-#define _RTCSYNC RCFGCALbits.RTCSYNC
-#define _RTCWREN RCFGCALbits.RTCWREN
-#define _RTCEN RCFGCALbits.RTCEN
-#define _CAL RCFGCALbits.CAL
-#define _RTCPTR RCFGCALbits.RTCPTR
-
-/* CMSTAT */
-#define _C1OUT CMSTATbits.C1OUT
-#define _C2OUT CMSTATbits.C2OUT
-#define _C3OUT CMSTATbits.C3OUT
-#define _C4OUT CMSTATbits.C4OUT
-#define _C5OUT CMSTATbits.C5OUT
-#define _C6OUT CMSTATbits.C6OUT
-#define _C1EVT CMSTATbits.C1EVT
-#define _C2EVT CMSTATbits.C2EVT
-#define _C3EVT CMSTATbits.C3EVT
-#define _C4EVT CMSTATbits.C4EVT
-#define _C5EVT CMSTATbits.C5EVT
-#define _C6EVT CMSTATbits.C6EVT
-#define _CMIDL CMSTATbits.CMIDL
-
-/* CVRCON */
-#define _CVR0 CVRCONbits.CVR0
-#define _CVR1 CVRCONbits.CVR1
-#define _CVR2 CVRCONbits.CVR2
-#define _CVR3 CVRCONbits.CVR3
-#define _CVRSS CVRCONbits.CVRSS
-#define _CVRR CVRCONbits.CVRR
-#define _CVROE CVRCONbits.CVROE
-#define _CVREN CVRCONbits.CVREN
-#define _CVR CVRCONbits.CVR
-
-/* CM1CON */
-/* Bitname _CCH0 cannot be defined because it is used by more than one SFR */
-/* Bitname _CCH1 cannot be defined because it is used by more than one SFR */
-/* Bitname _CREF cannot be defined because it is used by more than one SFR */
-/* Bitname _EVPOL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _EVPOL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _COUT cannot be defined because it is used by more than one SFR */
-/* Bitname _CEVT cannot be defined because it is used by more than one SFR */
-/* Bitname _CPOL cannot be defined because it is used by more than one SFR */
-/* Bitname _COE cannot be defined because it is used by more than one SFR */
-/* Bitname _CON cannot be defined because it is used by more than one SFR */
-/* Bitname _CCH cannot be defined because it is used by more than one SFR */
-/* Bitname _EVPOL cannot be defined because it is used by more than one SFR */
-/* Bitname _CEN cannot be defined because it is used by more than one SFR */
-
-/* CM2CON */
-/* Bitname _CCH0 cannot be defined because it is used by more than one SFR */
-/* Bitname _CCH1 cannot be defined because it is used by more than one SFR */
-/* Bitname _CREF cannot be defined because it is used by more than one SFR */
-/* Bitname _EVPOL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _EVPOL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _COUT cannot be defined because it is used by more than one SFR */
-/* Bitname _CEVT cannot be defined because it is used by more than one SFR */
-/* Bitname _CPOL cannot be defined because it is used by more than one SFR */
-/* Bitname _COE cannot be defined because it is used by more than one SFR */
-/* Bitname _CON cannot be defined because it is used by more than one SFR */
-/* Bitname _CCH cannot be defined because it is used by more than one SFR */
-/* Bitname _EVPOL cannot be defined because it is used by more than one SFR */
-/* Bitname _CEN cannot be defined because it is used by more than one SFR */
-
-/* CM3CON */
-/* Bitname _CCH0 cannot be defined because it is used by more than one SFR */
-/* Bitname _CCH1 cannot be defined because it is used by more than one SFR */
-/* Bitname _CREF cannot be defined because it is used by more than one SFR */
-/* Bitname _EVPOL0 cannot be defined because it is used by more than one SFR */
-/* Bitname _EVPOL1 cannot be defined because it is used by more than one SFR */
-/* Bitname _COUT cannot be defined because it is used by more than one SFR */
-/* Bitname _CEVT cannot be defined because it is used by more than one SFR */
-/* Bitname _CPOL cannot be defined because it is used by more than one SFR */
-/* Bitname _COE cannot be defined because it is used by more than one SFR */
-/* Bitname _CON cannot be defined because it is used by more than one SFR */
-/* Bitname _CCH cannot be defined because it is used by more than one SFR */
-/* Bitname _EVPOL cannot be defined because it is used by more than one SFR */
-/* Bitname _CEN cannot be defined because it is used by more than one SFR */
-
-/* CRCCON */
-#define _PLEN0 CRCCONbits.PLEN0
-#define _PLEN1 CRCCONbits.PLEN1
-#define _PLEN2 CRCCONbits.PLEN2
-#define _PLEN3 CRCCONbits.PLEN3
-#define _CRCGO CRCCONbits.CRCGO
-#define _CRCMPT CRCCONbits.CRCMPT
-#define _CRCFUL CRCCONbits.CRCFUL
-#define _VWORD0 CRCCONbits.VWORD0
-#define _VWORD1 CRCCONbits.VWORD1
-#define _VWORD2 CRCCONbits.VWORD2
-#define _VWORD3 CRCCONbits.VWORD3
-#define _VWORD4 CRCCONbits.VWORD4
-#define _CSIDL CRCCONbits.CSIDL
-#define _PLEN CRCCONbits.PLEN
-#define _VWORD CRCCONbits.VWORD
-
-/* CRCXOR */
-#define _X1 CRCXORbits.X1
-#define _X2 CRCXORbits.X2
-#define _X3 CRCXORbits.X3
-#define _X4 CRCXORbits.X4
-#define _X5 CRCXORbits.X5
-#define _X6 CRCXORbits.X6
-#define _X7 CRCXORbits.X7
-#define _X8 CRCXORbits.X8
-#define _X9 CRCXORbits.X9
-#define _X10 CRCXORbits.X10
-#define _X11 CRCXORbits.X11
-#define _X12 CRCXORbits.X12
-#define _X13 CRCXORbits.X13
-#define _X14 CRCXORbits.X14
-#define _X15 CRCXORbits.X15
-
-/* RPINR0 */
-#define _INT1R0 RPINR0bits.INT1R0
-#define _INT1R1 RPINR0bits.INT1R1
-#define _INT1R2 RPINR0bits.INT1R2
-#define _INT1R3 RPINR0bits.INT1R3
-#define _INT1R4 RPINR0bits.INT1R4
-#define _INT1R5 RPINR0bits.INT1R5
-#define _INT1R RPINR0bits.INT1R
-
-/* RPINR1 */
-#define _INT2R0 RPINR1bits.INT2R0
-#define _INT2R1 RPINR1bits.INT2R1
-#define _INT2R2 RPINR1bits.INT2R2
-#define _INT2R3 RPINR1bits.INT2R3
-#define _INT2R4 RPINR1bits.INT2R4
-#define _INT2R5 RPINR1bits.INT2R5
-#define _INT3R0 RPINR1bits.INT3R0
-#define _INT3R1 RPINR1bits.INT3R1
-#define _INT3R2 RPINR1bits.INT3R2
-#define _INT3R3 RPINR1bits.INT3R3
-#define _INT3R4 RPINR1bits.INT3R4
-#define _INT3R5 RPINR1bits.INT3R5
-#define _INT2R RPINR1bits.INT2R
-#define _INT3R RPINR1bits.INT3R
-
-/* RPINR2 */
-#define _INT4R0 RPINR2bits.INT4R0
-#define _INT4R1 RPINR2bits.INT4R1
-#define _INT4R2 RPINR2bits.INT4R2
-#define _INT4R3 RPINR2bits.INT4R3
-#define _INT4R4 RPINR2bits.INT4R4
-#define _INT4R5 RPINR2bits.INT4R5
-#define _T1CKR0 RPINR2bits.T1CKR0
-#define _T1CKR1 RPINR2bits.T1CKR1
-#define _T1CKR2 RPINR2bits.T1CKR2
-#define _T1CKR3 RPINR2bits.T1CKR3
-#define _T1CKR4 RPINR2bits.T1CKR4
-#define _T1CKR5 RPINR2bits.T1CKR5
-#define _INT4R RPINR2bits.INT4R
-#define _T1CKR RPINR2bits.T1CKR
-
-/* RPINR3 */
-#define _T2CKR0 RPINR3bits.T2CKR0
-#define _T2CKR1 RPINR3bits.T2CKR1
-#define _T2CKR2 RPINR3bits.T2CKR2
-#define _T2CKR3 RPINR3bits.T2CKR3
-#define _T2CKR4 RPINR3bits.T2CKR4
-#define _T2CKR5 RPINR3bits.T2CKR5
-#define _T3CKR0 RPINR3bits.T3CKR0
-#define _T3CKR1 RPINR3bits.T3CKR1
-#define _T3CKR2 RPINR3bits.T3CKR2
-#define _T3CKR3 RPINR3bits.T3CKR3
-#define _T3CKR4 RPINR3bits.T3CKR4
-#define _T3CKR5 RPINR3bits.T3CKR5
-#define _T2CKR RPINR3bits.T2CKR
-#define _T3CKR RPINR3bits.T3CKR
-
-/* RPINR4 */
-#define _T4CKR0 RPINR4bits.T4CKR0
-#define _T4CKR1 RPINR4bits.T4CKR1
-#define _T4CKR2 RPINR4bits.T4CKR2
-#define _T4CKR3 RPINR4bits.T4CKR3
-#define _T4CKR4 RPINR4bits.T4CKR4
-#define _T4CKR5 RPINR4bits.T4CKR5
-#define _T5CKR0 RPINR4bits.T5CKR0
-#define _T5CKR1 RPINR4bits.T5CKR1
-#define _T5CKR2 RPINR4bits.T5CKR2
-#define _T5CKR3 RPINR4bits.T5CKR3
-#define _T5CKR4 RPINR4bits.T5CKR4
-#define _T5CKR5 RPINR4bits.T5CKR5
-#define _T4CKR RPINR4bits.T4CKR
-#define _T5CKR RPINR4bits.T5CKR
-
-/* RPINR7 */
-#define _IC1R0 RPINR7bits.IC1R0
-#define _IC1R1 RPINR7bits.IC1R1
-#define _IC1R2 RPINR7bits.IC1R2
-#define _IC1R3 RPINR7bits.IC1R3
-#define _IC1R4 RPINR7bits.IC1R4
-#define _IC1R5 RPINR7bits.IC1R5
-#define _IC2R0 RPINR7bits.IC2R0
-#define _IC2R1 RPINR7bits.IC2R1
-#define _IC2R2 RPINR7bits.IC2R2
-#define _IC2R3 RPINR7bits.IC2R3
-#define _IC2R4 RPINR7bits.IC2R4
-#define _IC2R5 RPINR7bits.IC2R5
-#define _IC1R RPINR7bits.IC1R
-#define _IC2R RPINR7bits.IC2R
-
-/* RPINR8 */
-#define _IC3R0 RPINR8bits.IC3R0
-#define _IC3R1 RPINR8bits.IC3R1
-#define _IC3R2 RPINR8bits.IC3R2
-#define _IC3R3 RPINR8bits.IC3R3
-#define _IC3R4 RPINR8bits.IC3R4
-#define _IC3R5 RPINR8bits.IC3R5
-#define _IC4R0 RPINR8bits.IC4R0
-#define _IC4R1 RPINR8bits.IC4R1
-#define _IC4R2 RPINR8bits.IC4R2
-#define _IC4R3 RPINR8bits.IC4R3
-#define _IC4R4 RPINR8bits.IC4R4
-#define _IC4R5 RPINR8bits.IC4R5
-#define _IC3R RPINR8bits.IC3R
-#define _IC4R RPINR8bits.IC4R
-
-/* RPINR9 */
-#define _IC5R0 RPINR9bits.IC5R0
-#define _IC5R1 RPINR9bits.IC5R1
-#define _IC5R2 RPINR9bits.IC5R2
-#define _IC5R3 RPINR9bits.IC5R3
-#define _IC5R4 RPINR9bits.IC5R4
-#define _IC5R5 RPINR9bits.IC5R5
-#define _IC6R0 RPINR9bits.IC6R0
-#define _IC6R1 RPINR9bits.IC6R1
-#define _IC6R2 RPINR9bits.IC6R2
-#define _IC6R3 RPINR9bits.IC6R3
-#define _IC6R4 RPINR9bits.IC6R4
-#define _IC6R5 RPINR9bits.IC6R5
-#define _IC5R RPINR9bits.IC5R
-#define _IC6R RPINR9bits.IC6R
-
-/* RPINR10 */
-#define _IC7R0 RPINR10bits.IC7R0
-#define _IC7R1 RPINR10bits.IC7R1
-#define _IC7R2 RPINR10bits.IC7R2
-#define _IC7R3 RPINR10bits.IC7R3
-#define _IC7R4 RPINR10bits.IC7R4
-#define _IC7R5 RPINR10bits.IC7R5
-#define _IC8R0 RPINR10bits.IC8R0
-#define _IC8R1 RPINR10bits.IC8R1
-#define _IC8R2 RPINR10bits.IC8R2
-#define _IC8R3 RPINR10bits.IC8R3
-#define _IC8R4 RPINR10bits.IC8R4
-#define _IC8R5 RPINR10bits.IC8R5
-#define _IC7R RPINR10bits.IC7R
-#define _IC8R RPINR10bits.IC8R
-
-/* RPINR11 */
-#define _OCFAR0 RPINR11bits.OCFAR0
-#define _OCFAR1 RPINR11bits.OCFAR1
-#define _OCFAR2 RPINR11bits.OCFAR2
-#define _OCFAR3 RPINR11bits.OCFAR3
-#define _OCFAR4 RPINR11bits.OCFAR4
-#define _OCFAR5 RPINR11bits.OCFAR5
-#define _OCFBR0 RPINR11bits.OCFBR0
-#define _OCFBR1 RPINR11bits.OCFBR1
-#define _OCFBR2 RPINR11bits.OCFBR2
-#define _OCFBR3 RPINR11bits.OCFBR3
-#define _OCFBR4 RPINR11bits.OCFBR4
-#define _OCFBR5 RPINR11bits.OCFBR5
-#define _OCFAR RPINR11bits.OCFAR
-#define _OCFBR RPINR11bits.OCFBR
-
-/* RPINR15 */
-#define _IC9R0 RPINR15bits.IC9R0
-#define _IC9R1 RPINR15bits.IC9R1
-#define _IC9R2 RPINR15bits.IC9R2
-#define _IC9R3 RPINR15bits.IC9R3
-#define _IC9R4 RPINR15bits.IC9R4
-#define _IC9R5 RPINR15bits.IC9R5
-#define _IC9R RPINR15bits.IC9R
-
-/* RPINR17 */
-#define _U3RXR0 RPINR17bits.U3RXR0
-#define _U3RXR1 RPINR17bits.U3RXR1
-#define _U3RXR2 RPINR17bits.U3RXR2
-#define _U3RXR3 RPINR17bits.U3RXR3
-#define _U3RXR4 RPINR17bits.U3RXR4
-#define _U3RXR5 RPINR17bits.U3RXR5
-#define _U3RXR RPINR17bits.U3RXR
-
-/* RPINR18 */
-#define _U1RXR0 RPINR18bits.U1RXR0
-#define _U1RXR1 RPINR18bits.U1RXR1
-#define _U1RXR2 RPINR18bits.U1RXR2
-#define _U1RXR3 RPINR18bits.U1RXR3
-#define _U1RXR4 RPINR18bits.U1RXR4
-#define _U1RXR5 RPINR18bits.U1RXR5
-#define _U1CTSR0 RPINR18bits.U1CTSR0
-#define _U1CTSR1 RPINR18bits.U1CTSR1
-#define _U1CTSR2 RPINR18bits.U1CTSR2
-#define _U1CTSR3 RPINR18bits.U1CTSR3
-#define _U1CTSR4 RPINR18bits.U1CTSR4
-#define _U1CTSR5 RPINR18bits.U1CTSR5
-#define _U1RXR RPINR18bits.U1RXR
-#define _U1CTSR RPINR18bits.U1CTSR
-
-/* RPINR19 */
-#define _U2RXR0 RPINR19bits.U2RXR0
-#define _U2RXR1 RPINR19bits.U2RXR1
-#define _U2RXR2 RPINR19bits.U2RXR2
-#define _U2RXR3 RPINR19bits.U2RXR3
-#define _U2RXR4 RPINR19bits.U2RXR4
-#define _U2RXR5 RPINR19bits.U2RXR5
-#define _U2CTSR0 RPINR19bits.U2CTSR0
-#define _U2CTSR1 RPINR19bits.U2CTSR1
-#define _U2CTSR2 RPINR19bits.U2CTSR2
-#define _U2CTSR3 RPINR19bits.U2CTSR3
-#define _U2CTSR4 RPINR19bits.U2CTSR4
-#define _U2CTSR5 RPINR19bits.U2CTSR5
-#define _U2RXR RPINR19bits.U2RXR
-#define _U2CTSR RPINR19bits.U2CTSR
-
-/* RPINR20 */
-#define _SDI1R0 RPINR20bits.SDI1R0
-#define _SDI1R1 RPINR20bits.SDI1R1
-#define _SDI1R2 RPINR20bits.SDI1R2
-#define _SDI1R3 RPINR20bits.SDI1R3
-#define _SDI1R4 RPINR20bits.SDI1R4
-#define _SDI1R5 RPINR20bits.SDI1R5
-#define _SCK1R0 RPINR20bits.SCK1R0
-#define _SCK1R1 RPINR20bits.SCK1R1
-#define _SCK1R2 RPINR20bits.SCK1R2
-#define _SCK1R3 RPINR20bits.SCK1R3
-#define _SCK1R4 RPINR20bits.SCK1R4
-#define _SCK1R5 RPINR20bits.SCK1R5
-#define _SDI1R RPINR20bits.SDI1R
-#define _SCK1R RPINR20bits.SCK1R
-
-/* RPINR21 */
-#define _SS1R0 RPINR21bits.SS1R0
-#define _SS1R1 RPINR21bits.SS1R1
-#define _SS1R2 RPINR21bits.SS1R2
-#define _SS1R3 RPINR21bits.SS1R3
-#define _SS1R4 RPINR21bits.SS1R4
-#define _SS1R5 RPINR21bits.SS1R5
-#define _U3CTSR0 RPINR21bits.U3CTSR0
-#define _U3CTSR1 RPINR21bits.U3CTSR1
-#define _U3CTSR2 RPINR21bits.U3CTSR2
-#define _U3CTSR3 RPINR21bits.U3CTSR3
-#define _U3CTSR4 RPINR21bits.U3CTSR4
-#define _U3CTSR5 RPINR21bits.U3CTSR5
-#define _SS1R RPINR21bits.SS1R
-#define _U3CTSR RPINR21bits.U3CTSR
-
-/* RPINR22 */
-#define _SDI2R0 RPINR22bits.SDI2R0
-#define _SDI2R1 RPINR22bits.SDI2R1
-#define _SDI2R2 RPINR22bits.SDI2R2
-#define _SDI2R3 RPINR22bits.SDI2R3
-#define _SDI2R4 RPINR22bits.SDI2R4
-#define _SDI2R5 RPINR22bits.SDI2R5
-#define _SCK2R0 RPINR22bits.SCK2R0
-#define _SCK2R1 RPINR22bits.SCK2R1
-#define _SCK2R2 RPINR22bits.SCK2R2
-#define _SCK2R3 RPINR22bits.SCK2R3
-#define _SCK2R4 RPINR22bits.SCK2R4
-#define _SCK2R5 RPINR22bits.SCK2R5
-#define _SDI2R RPINR22bits.SDI2R
-#define _SCK2R RPINR22bits.SCK2R
-
-/* RPINR23 */
-#define _SS2R0 RPINR23bits.SS2R0
-#define _SS2R1 RPINR23bits.SS2R1
-#define _SS2R2 RPINR23bits.SS2R2
-#define _SS2R3 RPINR23bits.SS2R3
-#define _SS2R4 RPINR23bits.SS2R4
-#define _SS2R5 RPINR23bits.SS2R5
-#define _SS2R RPINR23bits.SS2R
-
-/* RPINR27 */
-#define _U4RXR0 RPINR27bits.U4RXR0
-#define _U4RXR1 RPINR27bits.U4RXR1
-#define _U4RXR2 RPINR27bits.U4RXR2
-#define _U4RXR3 RPINR27bits.U4RXR3
-#define _U4RXR4 RPINR27bits.U4RXR4
-#define _U4RXR5 RPINR27bits.U4RXR5
-#define _U4CTSR0 RPINR27bits.U4CTSR0
-#define _U4CTSR1 RPINR27bits.U4CTSR1
-#define _U4CTSR2 RPINR27bits.U4CTSR2
-#define _U4CTSR3 RPINR27bits.U4CTSR3
-#define _U4CTSR4 RPINR27bits.U4CTSR4
-#define _U4CTSR5 RPINR27bits.U4CTSR5
-#define _U4RXR RPINR27bits.U4RXR
-#define _U4CTSR RPINR27bits.U4CTSR
-
-/* RPINR28 */
-#define _SDI3R0 RPINR28bits.SDI3R0
-#define _SDI3R1 RPINR28bits.SDI3R1
-#define _SDI3R2 RPINR28bits.SDI3R2
-#define _SDI3R3 RPINR28bits.SDI3R3
-#define _SDI3R4 RPINR28bits.SDI3R4
-#define _SDI3R5 RPINR28bits.SDI3R5
-#define _SCK3R0 RPINR28bits.SCK3R0
-#define _SCK3R1 RPINR28bits.SCK3R1
-#define _SCK3R2 RPINR28bits.SCK3R2
-#define _SCK3R3 RPINR28bits.SCK3R3
-#define _SCK3R4 RPINR28bits.SCK3R4
-#define _SCK3R5 RPINR28bits.SCK3R5
-#define _SDI3R RPINR28bits.SDI3R
-#define _SCK3R RPINR28bits.SCK3R
-
-/* RPINR29 */
-#define _SS3R0 RPINR29bits.SS3R0
-#define _SS3R1 RPINR29bits.SS3R1
-#define _SS3R2 RPINR29bits.SS3R2
-#define _SS3R3 RPINR29bits.SS3R3
-#define _SS3R4 RPINR29bits.SS3R4
-#define _SS3R5 RPINR29bits.SS3R5
-#define _SS3R RPINR29bits.SS3R
-
-/* RPOR0 */
-#define _RP0R0 RPOR0bits.RP0R0
-#define _RP0R1 RPOR0bits.RP0R1
-#define _RP0R2 RPOR0bits.RP0R2
-#define _RP0R3 RPOR0bits.RP0R3
-#define _RP0R4 RPOR0bits.RP0R4
-#define _RP0R5 RPOR0bits.RP0R5
-#define _RP1R0 RPOR0bits.RP1R0
-#define _RP1R1 RPOR0bits.RP1R1
-#define _RP1R2 RPOR0bits.RP1R2
-#define _RP1R3 RPOR0bits.RP1R3
-#define _RP1R4 RPOR0bits.RP1R4
-#define _RP1R5 RPOR0bits.RP1R5
-#define _RP0R RPOR0bits.RP0R
-#define _RP1R RPOR0bits.RP1R
-
-/* RPOR1 */
-#define _RP2R0 RPOR1bits.RP2R0
-#define _RP2R1 RPOR1bits.RP2R1
-#define _RP2R2 RPOR1bits.RP2R2
-#define _RP2R3 RPOR1bits.RP2R3
-#define _RP2R4 RPOR1bits.RP2R4
-#define _RP2R5 RPOR1bits.RP2R5
-#define _RP3R0 RPOR1bits.RP3R0
-#define _RP3R1 RPOR1bits.RP3R1
-#define _RP3R2 RPOR1bits.RP3R2
-#define _RP3R3 RPOR1bits.RP3R3
-#define _RP3R4 RPOR1bits.RP3R4
-#define _RP3R5 RPOR1bits.RP3R5
-#define _RP2R RPOR1bits.RP2R
-#define _RP3R RPOR1bits.RP3R
-
-/* RPOR2 */
-#define _RP4R0 RPOR2bits.RP4R0
-#define _RP4R1 RPOR2bits.RP4R1
-#define _RP4R2 RPOR2bits.RP4R2
-#define _RP4R3 RPOR2bits.RP4R3
-#define _RP4R4 RPOR2bits.RP4R4
-#define _RP4R5 RPOR2bits.RP4R5
-#define _RP4R RPOR2bits.RP4R
-
-/* RPOR3 */
-#define _RP6R0 RPOR3bits.RP6R0
-#define _RP6R1 RPOR3bits.RP6R1
-#define _RP6R2 RPOR3bits.RP6R2
-#define _RP6R3 RPOR3bits.RP6R3
-#define _RP6R4 RPOR3bits.RP6R4
-#define _RP6R5 RPOR3bits.RP6R5
-#define _RP7R0 RPOR3bits.RP7R0
-#define _RP7R1 RPOR3bits.RP7R1
-#define _RP7R2 RPOR3bits.RP7R2
-#define _RP7R3 RPOR3bits.RP7R3
-#define _RP7R4 RPOR3bits.RP7R4
-#define _RP7R5 RPOR3bits.RP7R5
-#define _RP6R RPOR3bits.RP6R
-#define _RP7R RPOR3bits.RP7R
-
-/* RPOR4 */
-#define _RP8R0 RPOR4bits.RP8R0
-#define _RP8R1 RPOR4bits.RP8R1
-#define _RP8R2 RPOR4bits.RP8R2
-#define _RP8R3 RPOR4bits.RP8R3
-#define _RP8R4 RPOR4bits.RP8R4
-#define _RP8R5 RPOR4bits.RP8R5
-#define _RP9R0 RPOR4bits.RP9R0
-#define _RP9R1 RPOR4bits.RP9R1
-#define _RP9R2 RPOR4bits.RP9R2
-#define _RP9R3 RPOR4bits.RP9R3
-#define _RP9R4 RPOR4bits.RP9R4
-#define _RP9R5 RPOR4bits.RP9R5
-#define _RP8R RPOR4bits.RP8R
-#define _RP9R RPOR4bits.RP9R
-
-/* RPOR5 */
-#define _RP10R0 RPOR5bits.RP10R0
-#define _RP10R1 RPOR5bits.RP10R1
-#define _RP10R2 RPOR5bits.RP10R2
-#define _RP10R3 RPOR5bits.RP10R3
-#define _RP10R4 RPOR5bits.RP10R4
-#define _RP10R5 RPOR5bits.RP10R5
-#define _RP11R0 RPOR5bits.RP11R0
-#define _RP11R1 RPOR5bits.RP11R1
-#define _RP11R2 RPOR5bits.RP11R2
-#define _RP11R3 RPOR5bits.RP11R3
-#define _RP11R4 RPOR5bits.RP11R4
-#define _RP11R5 RPOR5bits.RP11R5
-#define _RP10R RPOR5bits.RP10R
-#define _RP11R RPOR5bits.RP11R
-
-/* RPOR6 */
-#define _RP12R0 RPOR6bits.RP12R0
-#define _RP12R1 RPOR6bits.RP12R1
-#define _RP12R2 RPOR6bits.RP12R2
-#define _RP12R3 RPOR6bits.RP12R3
-#define _RP12R4 RPOR6bits.RP12R4
-#define _RP12R5 RPOR6bits.RP12R5
-#define _RP13R0 RPOR6bits.RP13R0
-#define _RP13R1 RPOR6bits.RP13R1
-#define _RP13R2 RPOR6bits.RP13R2
-#define _RP13R3 RPOR6bits.RP13R3
-#define _RP13R4 RPOR6bits.RP13R4
-#define _RP13R5 RPOR6bits.RP13R5
-#define _RP12R RPOR6bits.RP12R
-#define _RP13R RPOR6bits.RP13R
-
-/* RPOR7 */
-#define _RP14R0 RPOR7bits.RP14R0
-#define _RP14R1 RPOR7bits.RP14R1
-#define _RP14R2 RPOR7bits.RP14R2
-#define _RP14R3 RPOR7bits.RP14R3
-#define _RP14R4 RPOR7bits.RP14R4
-#define _RP14R5 RPOR7bits.RP14R5
-#define _RP14R RPOR7bits.RP14R
-
-/* RPOR8 */
-#define _RP16R0 RPOR8bits.RP16R0
-#define _RP16R1 RPOR8bits.RP16R1
-#define _RP16R2 RPOR8bits.RP16R2
-#define _RP16R3 RPOR8bits.RP16R3
-#define _RP16R4 RPOR8bits.RP16R4
-#define _RP16R5 RPOR8bits.RP16R5
-#define _RP17R0 RPOR8bits.RP17R0
-#define _RP17R1 RPOR8bits.RP17R1
-#define _RP17R2 RPOR8bits.RP17R2
-#define _RP17R3 RPOR8bits.RP17R3
-#define _RP17R4 RPOR8bits.RP17R4
-#define _RP17R5 RPOR8bits.RP17R5
-#define _RP16R RPOR8bits.RP16R
-#define _RP17R RPOR8bits.RP17R
-
-/* RPOR9 */
-#define _RP18R0 RPOR9bits.RP18R0
-#define _RP18R1 RPOR9bits.RP18R1
-#define _RP18R2 RPOR9bits.RP18R2
-#define _RP18R3 RPOR9bits.RP18R3
-#define _RP18R4 RPOR9bits.RP18R4
-#define _RP18R5 RPOR9bits.RP18R5
-#define _RP19R0 RPOR9bits.RP19R0
-#define _RP19R1 RPOR9bits.RP19R1
-#define _RP19R2 RPOR9bits.RP19R2
-#define _RP19R3 RPOR9bits.RP19R3
-#define _RP19R4 RPOR9bits.RP19R4
-#define _RP19R5 RPOR9bits.RP19R5
-#define _RP18R RPOR9bits.RP18R
-#define _RP19R RPOR9bits.RP19R
-
-/* RPOR10 */
-#define _RP20R0 RPOR10bits.RP20R0
-#define _RP20R1 RPOR10bits.RP20R1
-#define _RP20R2 RPOR10bits.RP20R2
-#define _RP20R3 RPOR10bits.RP20R3
-#define _RP20R4 RPOR10bits.RP20R4
-#define _RP20R5 RPOR10bits.RP20R5
-#define _RP21R0 RPOR10bits.RP21R0
-#define _RP21R1 RPOR10bits.RP21R1
-#define _RP21R2 RPOR10bits.RP21R2
-#define _RP21R3 RPOR10bits.RP21R3
-#define _RP21R4 RPOR10bits.RP21R4
-#define _RP21R5 RPOR10bits.RP21R5
-#define _RP20R RPOR10bits.RP20R
-#define _RP21R RPOR10bits.RP21R
-
-/* RPOR11 */
-#define _RP22R0 RPOR11bits.RP22R0
-#define _RP22R1 RPOR11bits.RP22R1
-#define _RP22R2 RPOR11bits.RP22R2
-#define _RP22R3 RPOR11bits.RP22R3
-#define _RP22R4 RPOR11bits.RP22R4
-#define _RP22R5 RPOR11bits.RP22R5
-#define _RP23R0 RPOR11bits.RP23R0
-#define _RP23R1 RPOR11bits.RP23R1
-#define _RP23R2 RPOR11bits.RP23R2
-#define _RP23R3 RPOR11bits.RP23R3
-#define _RP23R4 RPOR11bits.RP23R4
-#define _RP23R5 RPOR11bits.RP23R5
-#define _RP22R RPOR11bits.RP22R
-#define _RP23R RPOR11bits.RP23R
-
-/* RPOR12 */
-#define _RP24R0 RPOR12bits.RP24R0
-#define _RP24R1 RPOR12bits.RP24R1
-#define _RP24R2 RPOR12bits.RP24R2
-#define _RP24R3 RPOR12bits.RP24R3
-#define _RP24R4 RPOR12bits.RP24R4
-#define _RP24R5 RPOR12bits.RP24R5
-#define _RP25R0 RPOR12bits.RP25R0
-#define _RP25R1 RPOR12bits.RP25R1
-#define _RP25R2 RPOR12bits.RP25R2
-#define _RP25R3 RPOR12bits.RP25R3
-#define _RP25R4 RPOR12bits.RP25R4
-#define _RP25R5 RPOR12bits.RP25R5
-#define _RP24R RPOR12bits.RP24R
-#define _RP25R RPOR12bits.RP25R
-
-/* RPOR13 */
-#define _RP26R0 RPOR13bits.RP26R0
-#define _RP26R1 RPOR13bits.RP26R1
-#define _RP26R2 RPOR13bits.RP26R2
-#define _RP26R3 RPOR13bits.RP26R3
-#define _RP26R4 RPOR13bits.RP26R4
-#define _RP26R5 RPOR13bits.RP26R5
-#define _RP27R0 RPOR13bits.RP27R0
-#define _RP27R1 RPOR13bits.RP27R1
-#define _RP27R2 RPOR13bits.RP27R2
-#define _RP27R3 RPOR13bits.RP27R3
-#define _RP27R4 RPOR13bits.RP27R4
-#define _RP27R5 RPOR13bits.RP27R5
-#define _RP26R RPOR13bits.RP26R
-#define _RP27R RPOR13bits.RP27R
-
-/* RPOR14 */
-#define _RP28R0 RPOR14bits.RP28R0
-#define _RP28R1 RPOR14bits.RP28R1
-#define _RP28R2 RPOR14bits.RP28R2
-#define _RP28R3 RPOR14bits.RP28R3
-#define _RP28R4 RPOR14bits.RP28R4
-#define _RP28R5 RPOR14bits.RP28R5
-#define _RP29R0 RPOR14bits.RP29R0
-#define _RP29R1 RPOR14bits.RP29R1
-#define _RP29R2 RPOR14bits.RP29R2
-#define _RP29R3 RPOR14bits.RP29R3
-#define _RP29R4 RPOR14bits.RP29R4
-#define _RP29R5 RPOR14bits.RP29R5
-#define _RP28R RPOR14bits.RP28R
-#define _RP29R RPOR14bits.RP29R
-
-/* RPOR15 */
-#define _RP30R0 RPOR15bits.RP30R0
-#define _RP30R1 RPOR15bits.RP30R1
-#define _RP30R2 RPOR15bits.RP30R2
-#define _RP30R3 RPOR15bits.RP30R3
-#define _RP30R4 RPOR15bits.RP30R4
-#define _RP30R5 RPOR15bits.RP30R5
-#define _RP30R RPOR15bits.RP30R
-
-/* RCON */
-#define _POR RCONbits.POR
-#define _BOR RCONbits.BOR
-#define _IDLE RCONbits.IDLE
-#define _SLEEP RCONbits.SLEEP
-#define _WDTO RCONbits.WDTO
-#define _SWDTEN RCONbits.SWDTEN
-#define _SWR RCONbits.SWR
-#define _EXTR RCONbits.EXTR
-#define _VREGS RCONbits.VREGS
-#define _CM RCONbits.CM
-#define _IOPUWR RCONbits.IOPUWR
-#define _TRAPR RCONbits.TRAPR
-#define _PMSLP RCONbits.PMSLP
-
-/* OSCCON */
-#define _OSWEN OSCCONbits.OSWEN
-#define _SOSCEN OSCCONbits.SOSCEN
-#define _POSCEN OSCCONbits.POSCEN
-#define _CF OSCCONbits.CF
-#define _LOCK OSCCONbits.LOCK
-#define _IOLOCK OSCCONbits.IOLOCK
-#define _CLKLOCK OSCCONbits.CLKLOCK
-#define _NOSC0 OSCCONbits.NOSC0
-#define _NOSC1 OSCCONbits.NOSC1
-#define _NOSC2 OSCCONbits.NOSC2
-#define _COSC0 OSCCONbits.COSC0
-#define _COSC1 OSCCONbits.COSC1
-#define _COSC2 OSCCONbits.COSC2
-#define _NOSC OSCCONbits.NOSC
-#define _COSC OSCCONbits.COSC
-#define _LPOSCEN OSCCONbits.LPOSCEN
-
-/* CLKDIV */
-#define _USBDOZE0 CLKDIVbits.USBDOZE0
-#define _USBDOZE1 CLKDIVbits.USBDOZE1
-#define _RCDIV0 CLKDIVbits.RCDIV0
-#define _RCDIV1 CLKDIVbits.RCDIV1
-#define _RCDIV2 CLKDIVbits.RCDIV2
-#define _DOZEN CLKDIVbits.DOZEN
-#define _DOZE0 CLKDIVbits.DOZE0
-#define _DOZE1 CLKDIVbits.DOZE1
-#define _DOZE2 CLKDIVbits.DOZE2
-#define _ROI CLKDIVbits.ROI
-#define _USBDOZE CLKDIVbits.USBDOZE
-#define _RCDIV CLKDIVbits.RCDIV
-#define _DOZE CLKDIVbits.DOZE
-#define _CPDIV CLKDIVbits.CPDIV
-#define _CPDIV0 CLKDIVbits.CPDIV0
-#define _CPDIV1 CLKDIVbits.CPDIV1
-
-/* OSCTUN */
-#define _TUN0 OSCTUNbits.TUN0
-#define _TUN1 OSCTUNbits.TUN1
-#define _TUN2 OSCTUNbits.TUN2
-#define _TUN3 OSCTUNbits.TUN3
-#define _TUN4 OSCTUNbits.TUN4
-#define _TUN5 OSCTUNbits.TUN5
-#define _TUN OSCTUNbits.TUN
-
-/* REFOCON */
-#define _RODIV0 REFOCONbits.RODIV0
-#define _RODIV1 REFOCONbits.RODIV1
-#define _RODIV2 REFOCONbits.RODIV2
-#define _RODIV3 REFOCONbits.RODIV3
-#define _ROSEL REFOCONbits.ROSEL
-#define _ROSSLP REFOCONbits.ROSSLP
-#define _ROON REFOCONbits.ROON
-#define _RODIV REFOCONbits.RODIV
-
-/* NVMCON */
-#define _NVMOP0 NVMCONbits.NVMOP0
-#define _NVMOP1 NVMCONbits.NVMOP1
-#define _NVMOP2 NVMCONbits.NVMOP2
-#define _NVMOP3 NVMCONbits.NVMOP3
-#define _ERASE NVMCONbits.ERASE
-#define _WRERR NVMCONbits.WRERR
-#define _WREN NVMCONbits.WREN
-#define _WR NVMCONbits.WR
-#define _NVMOP NVMCONbits.NVMOP
-#define _PROGOP NVMCONbits.PROGOP
-#define _PROGOP0 NVMCONbits.PROGOP0
-#define _PROGOP1 NVMCONbits.PROGOP1
-#define _PROGOP2 NVMCONbits.PROGOP2
-#define _PROGOP3 NVMCONbits.PROGOP3
-
-/* PMD1 */
-#define _ADC1MD PMD1bits.ADC1MD
-#define _SPI1MD PMD1bits.SPI1MD
-#define _SPI2MD PMD1bits.SPI2MD
-#define _U1MD PMD1bits.U1MD
-#define _U2MD PMD1bits.U2MD
-#define _I2C1MD PMD1bits.I2C1MD
-#define _T1MD PMD1bits.T1MD
-#define _T2MD PMD1bits.T2MD
-#define _T3MD PMD1bits.T3MD
-#define _T4MD PMD1bits.T4MD
-#define _T5MD PMD1bits.T5MD
-
-/* PMD2 */
-#define _OC1MD PMD2bits.OC1MD
-#define _OC2MD PMD2bits.OC2MD
-#define _OC3MD PMD2bits.OC3MD
-#define _OC4MD PMD2bits.OC4MD
-#define _OC5MD PMD2bits.OC5MD
-#define _OC6MD PMD2bits.OC6MD
-#define _OC7MD PMD2bits.OC7MD
-#define _OC8MD PMD2bits.OC8MD
-#define _IC1MD PMD2bits.IC1MD
-#define _IC2MD PMD2bits.IC2MD
-#define _IC3MD PMD2bits.IC3MD
-#define _IC4MD PMD2bits.IC4MD
-#define _IC5MD PMD2bits.IC5MD
-#define _IC6MD PMD2bits.IC6MD
-#define _IC7MD PMD2bits.IC7MD
-#define _IC8MD PMD2bits.IC8MD
-
-/* PMD3 */
-#define _I2C2MD PMD3bits.I2C2MD
-#define _I2C3MD PMD3bits.I2C3MD
-#define _U3MD PMD3bits.U3MD
-#define _CRCPMD PMD3bits.CRCPMD
-#define _PMPMD PMD3bits.PMPMD
-#define _RTCCMD PMD3bits.RTCCMD
-#define _CMPMD PMD3bits.CMPMD
-#define _CRCMD PMD3bits.CRCMD
-
-/* PMD4 */
-#define _USB1MD PMD4bits.USB1MD
-#define _LVDMD PMD4bits.LVDMD
-#define _CTMUMD PMD4bits.CTMUMD
-#define _REFOMD PMD4bits.REFOMD
-#define _U4MD PMD4bits.U4MD
-#define _UPWMMD PMD4bits.UPWMMD
-
-/* PMD5 */
-#define _OC9MD PMD5bits.OC9MD
-#define _IC9MD PMD5bits.IC9MD
-
-/* PMD6 */
-#define _SPI3MD PMD6bits.SPI3MD
-
-
-/* ---------------------------------------------------------- */
-/* Some useful macros for inline assembler instructions       */
-/* ---------------------------------------------------------- */
-
-#define Nop()    __builtin_nop()
-#define ClrWdt() {__asm__ volatile ("clrwdt");}
-#define Sleep()  {__asm__ volatile ("pwrsav #0");}
-#define Idle()   {__asm__ volatile ("pwrsav #1");}
-
-/*----------------------------------------------------------- */
-/* Some useful macros for allocating data memory              */
-/*----------------------------------------------------------- */
-
-/* The following macros require an argument N that specifies  */
-/* alignment. N must a power of two, minimum value = 2.       */
-/* For example, to declare an uninitialized array that is     */
-/* aligned to a 32 byte address:                              */
-/*                                                            */
-/* int _BSS(32) buf[16];                                      */
-/*                                                            */
-/* To declare an initialized array without special            */
-/* alignment:                                                 */
-/*                                                            */
-/* int _DATA(2) table1[] = {0, 1, 1, 2, 3, 5, 8, 13, 21};     */
-/*                                                            */
-#define _BSS(N)    __attribute__((aligned(N)))
-#define _DATA(N)   __attribute__((aligned(N)))
-
-/* The following macros do not require an argument. They can  */
-/* be used to locate a variable in persistent data memory or  */
-/* in near data memory. For example, to declare two variables */
-/* that retain their values across a device reset:            */
-/*                                                            */
-/* int _PERSISTENT var1,var2;                                 */
-/*                                                            */
-#define _PERSISTENT __attribute__((persistent))
-#define _NEAR       __attribute__((near))
-
-/* ---------------------------------------------------------- */
-/* Some useful macros for declaring functions                 */
-/* ---------------------------------------------------------- */
-
-/* The following macros can be used to declare interrupt      */
-/* service routines (ISRs). For example, to declare an ISR    */
-/* for the timer1 interrupt:                                  */
-/*                                                            */
-/* void _ISR _T1Interrupt(void);                              */
-/*                                                            */
-/* To declare an ISR for the SPI1 interrupt with fast         */
-/* context save:                                              */
-/*                                                            */
-/* void _ISRFAST _SPI1Interrupt(void);                        */
-/*                                                            */
-/* Note: ISRs will be installed into the interrupt vector     */
-/* tables automatically if the reserved names listed in the   */
-/* MPLAB C30 Compiler User's Guide (DS51284) are used.        */
-/*                                                            */
-#define _ISR __attribute__((interrupt))
-#define _ISRFAST __attribute__((interrupt, shadow))
-
-/* ---------------------------------------------------------- */
-/* Some useful macros for changing the CPU IPL                */
-/* ---------------------------------------------------------- */
-
-/* The following macros can be used to modify the current CPU */
-/* IPL. The definition of the macro may vary from device to   */
-/* device.                                                    */
-/*                                                            */
-/* To safely set the CPU IPL, use SET_CPU_IPL(ipl); the       */
-/* valid range of ipl is 0-7, it may be any expression.       */
-/*                                                            */
-/* SET_CPU_IPL(7);                                            */
-/*                                                            */
-/* To preserve the current IPL and save it use                */
-/* SET_AND_SAVE_CPU_IPL(save_to, ipl); the valid range of ipl */
-/* is 0-7 and may be any expression, save_to should denote    */
-/* some temporary storage.                                    */
-/*                                                            */
-/* int old_ipl;                                               */
-/*                                                            */
-/* SET_AND_SAVE_CPU_IPL(old_ipl, 7);                          */
-/*                                                            */
-/* The IPL can be restored with RESTORE_CPU_IPL(saved_to)     */
-/*                                                            */
-/* RESTORE_CPU_IPL(old_ipl);                                  */
-
-#define SET_CPU_IPL(ipl) {       \
-  int DISI_save;                 \
-                                 \
-  DISI_save = DISICNT;           \
-  asm volatile ("disi #0x3FFF"); \
-  SRbits.IPL = ipl;              \
-  DISICNT = DISI_save; } (void) 0;
-
-#define SET_AND_SAVE_CPU_IPL(save_to, ipl) { \
-  save_to = SRbits.IPL; \
-  SET_CPU_IPL(ipl); } (void) 0;
-
-#define RESTORE_CPU_IPL(saved_to) SET_CPU_IPL(saved_to)
-
-
-
-/* -------------------------------------------------------- */
-/* Macros for setting device configuration registers        */
-/* -------------------------------------------------------- */
-
-/* Register CONFIG3 (0x2abfa)                               */
-
-extern __attribute__((space(prog))) int _CONFIG3;
-#define _CONFIG3(x) __attribute__((section("__CONFIG3.sec"),space(prog))) int _CONFIG3 = (x);
-
-/*
-** Only one invocation of CONFIG3 should appear in a project,
-** at the top of a C source file (outside of any function).
-**
-** The following constants can be used to set CONFIG3.
-** Multiple options may be combined, as shown:
-**
-** _CONFIG3( OPT1_ON & OPT2_OFF & OPT3_PLL )
-**
-**   Write Protection Location:
-**     WPEND_WPSTARTMEM     Write Protect from page 0 to WPFP
-**     WPEND_WPENDMEM       Write Protect from WPFP to the last page of memory
-**
-**   Write Protect Configuration Page:
-**     WPCFG_WPCFGEN        Enabled
-**     WPCFG_WPCFGDIS       Disabled
-**
-**   Write Protection Disable:
-**     WPDIS_WPEN           Enabled
-**     WPDIS_WPDIS          Disabled
-**
-**   Write Protection Flash Page:
-**     WPFP_WPFP0           0
-**     WPFP_WPFP1           1
-**     WPFP_WPFP2           2
-**     WPFP_WPFP3           3
-**     WPFP_WPFP4           4
-**     WPFP_WPFP5           5
-**     WPFP_WPFP6           6
-**     WPFP_WPFP7           7
-**     WPFP_WPFP8           8
-**     WPFP_WPFP9           9
-**     WPFP_WPFP10          10
-**     WPFP_WPFP11          11
-**     WPFP_WPFP12          12
-**     WPFP_WPFP13          13
-**     WPFP_WPFP14          14
-**     WPFP_WPFP15          15
-**     WPFP_WPFP16          16
-**     WPFP_WPFP17          17
-**     WPFP_WPFP18          18
-**     WPFP_WPFP19          19
-**     WPFP_WPFP20          20
-**     WPFP_WPFP21          21
-**     WPFP_WPFP22          22
-**     WPFP_WPFP23          23
-**     WPFP_WPFP24          24
-**     WPFP_WPFP25          25
-**     WPFP_WPFP26          26
-**     WPFP_WPFP27          27
-**     WPFP_WPFP28          28
-**     WPFP_WPFP29          29
-**     WPFP_WPFP30          30
-**     WPFP_WPFP31          31
-**     WPFP_WPFP32          32
-**     WPFP_WPFP33          33
-**     WPFP_WPFP34          34
-**     WPFP_WPFP35          35
-**     WPFP_WPFP36          36
-**     WPFP_WPFP37          37
-**     WPFP_WPFP38          38
-**     WPFP_WPFP39          39
-**     WPFP_WPFP40          40
-**     WPFP_WPFP41          41
-**     WPFP_WPFP42          42
-**     WPFP_WPFP43          43
-**     WPFP_WPFP44          44
-**     WPFP_WPFP45          45
-**     WPFP_WPFP46          46
-**     WPFP_WPFP47          47
-**     WPFP_WPFP48          48
-**     WPFP_WPFP49          49
-**     WPFP_WPFP50          50
-**     WPFP_WPFP51          51
-**     WPFP_WPFP52          52
-**     WPFP_WPFP53          53
-**     WPFP_WPFP54          54
-**     WPFP_WPFP55          55
-**     WPFP_WPFP56          56
-**     WPFP_WPFP57          57
-**     WPFP_WPFP58          58
-**     WPFP_WPFP59          59
-**     WPFP_WPFP60          60
-**     WPFP_WPFP61          61
-**     WPFP_WPFP62          62
-**     WPFP_WPFP63          63
-**     WPFP_WPFP64          64
-**     WPFP_WPFP65          65
-**     WPFP_WPFP66          66
-**     WPFP_WPFP67          67
-**     WPFP_WPFP68          68
-**     WPFP_WPFP69          69
-**     WPFP_WPFP70          70
-**     WPFP_WPFP71          71
-**     WPFP_WPFP72          72
-**     WPFP_WPFP73          73
-**     WPFP_WPFP74          74
-**     WPFP_WPFP75          75
-**     WPFP_WPFP76          76
-**     WPFP_WPFP77          77
-**     WPFP_WPFP78          78
-**     WPFP_WPFP79          79
-**     WPFP_WPFP80          80
-**     WPFP_WPFP81          81
-**     WPFP_WPFP82          82
-**     WPFP_WPFP83          83
-**     WPFP_WPFP84          84
-**     WPFP_WPFP85          85
-**     WPFP_WPFP86          86
-**     WPFP_WPFP87          87
-**     WPFP_WPFP88          88
-**     WPFP_WPFP89          89
-**     WPFP_WPFP90          90
-**     WPFP_WPFP91          91
-**     WPFP_WPFP92          92
-**     WPFP_WPFP93          93
-**     WPFP_WPFP94          94
-**     WPFP_WPFP95          95
-**     WPFP_WPFP96          96
-**     WPFP_WPFP97          97
-**     WPFP_WPFP98          98
-**     WPFP_WPFP99          99
-**     WPFP_WPFP100         100
-**     WPFP_WPFP101         101
-**     WPFP_WPFP102         102
-**     WPFP_WPFP103         103
-**     WPFP_WPFP104         104
-**     WPFP_WPFP105         105
-**     WPFP_WPFP106         106
-**     WPFP_WPFP107         107
-**     WPFP_WPFP108         108
-**     WPFP_WPFP109         109
-**     WPFP_WPFP110         110
-**     WPFP_WPFP111         111
-**     WPFP_WPFP112         112
-**     WPFP_WPFP113         113
-**     WPFP_WPFP114         114
-**     WPFP_WPFP115         115
-**     WPFP_WPFP116         116
-**     WPFP_WPFP117         117
-**     WPFP_WPFP118         118
-**     WPFP_WPFP119         119
-**     WPFP_WPFP120         120
-**     WPFP_WPFP121         121
-**     WPFP_WPFP122         122
-**     WPFP_WPFP123         123
-**     WPFP_WPFP124         124
-**     WPFP_WPFP125         125
-**     WPFP_WPFP126         126
-**     WPFP_WPFP127         127
-**     WPFP_WPFP128         128
-**     WPFP_WPFP129         129
-**     WPFP_WPFP130         130
-**     WPFP_WPFP131         131
-**     WPFP_WPFP132         132
-**     WPFP_WPFP133         133
-**     WPFP_WPFP134         134
-**     WPFP_WPFP135         135
-**     WPFP_WPFP136         136
-**     WPFP_WPFP137         137
-**     WPFP_WPFP138         138
-**     WPFP_WPFP139         139
-**     WPFP_WPFP140         140
-**     WPFP_WPFP141         141
-**     WPFP_WPFP142         142
-**     WPFP_WPFP143         143
-**     WPFP_WPFP144         144
-**     WPFP_WPFP145         145
-**     WPFP_WPFP146         146
-**     WPFP_WPFP147         147
-**     WPFP_WPFP148         148
-**     WPFP_WPFP149         149
-**     WPFP_WPFP150         150
-**     WPFP_WPFP151         151
-**     WPFP_WPFP152         152
-**     WPFP_WPFP153         153
-**     WPFP_WPFP154         154
-**     WPFP_WPFP155         155
-**     WPFP_WPFP156         156
-**     WPFP_WPFP157         157
-**     WPFP_WPFP158         158
-**     WPFP_WPFP159         159
-**     WPFP_WPFP160         160
-**     WPFP_WPFP161         161
-**     WPFP_WPFP162         162
-**     WPFP_WPFP163         163
-**     WPFP_WPFP164         164
-**     WPFP_WPFP165         165
-**     WPFP_WPFP166         166
-**     WPFP_WPFP167         167
-**     WPFP_WPFP168         168
-**     WPFP_WPFP169         169
-**     WPFP_WPFP170         170
-**     WPFP_WPFP171         171
-**     WPFP_WPFP172         172
-**     WPFP_WPFP173         173
-**     WPFP_WPFP174         174
-**     WPFP_WPFP175         175
-**     WPFP_WPFP176         176
-**     WPFP_WPFP177         177
-**     WPFP_WPFP178         178
-**     WPFP_WPFP179         179
-**     WPFP_WPFP180         180
-**     WPFP_WPFP181         181
-**     WPFP_WPFP182         182
-**     WPFP_WPFP183         183
-**     WPFP_WPFP184         184
-**     WPFP_WPFP185         185
-**     WPFP_WPFP186         186
-**     WPFP_WPFP187         187
-**     WPFP_WPFP188         188
-**     WPFP_WPFP189         189
-**     WPFP_WPFP190         190
-**     WPFP_WPFP191         191
-**     WPFP_WPFP192         192
-**     WPFP_WPFP193         193
-**     WPFP_WPFP194         194
-**     WPFP_WPFP195         195
-**     WPFP_WPFP196         196
-**     WPFP_WPFP197         197
-**     WPFP_WPFP198         198
-**     WPFP_WPFP199         199
-**     WPFP_WPFP200         200
-**     WPFP_WPFP201         201
-**     WPFP_WPFP202         202
-**     WPFP_WPFP203         203
-**     WPFP_WPFP204         204
-**     WPFP_WPFP205         205
-**     WPFP_WPFP206         206
-**     WPFP_WPFP207         207
-**     WPFP_WPFP208         208
-**     WPFP_WPFP209         209
-**     WPFP_WPFP210         210
-**     WPFP_WPFP211         211
-**     WPFP_WPFP212         212
-**     WPFP_WPFP213         213
-**     WPFP_WPFP214         214
-**     WPFP_WPFP215         215
-**     WPFP_WPFP216         216
-**     WPFP_WPFP217         217
-**     WPFP_WPFP218         218
-**     WPFP_WPFP219         219
-**     WPFP_WPFP220         220
-**     WPFP_WPFP221         221
-**     WPFP_WPFP222         222
-**     WPFP_WPFP223         223
-**     WPFP_WPFP224         224
-**     WPFP_WPFP225         225
-**     WPFP_WPFP226         226
-**     WPFP_WPFP227         227
-**     WPFP_WPFP228         228
-**     WPFP_WPFP229         229
-**     WPFP_WPFP230         230
-**     WPFP_WPFP231         231
-**     WPFP_WPFP232         232
-**     WPFP_WPFP233         233
-**     WPFP_WPFP234         234
-**     WPFP_WPFP235         235
-**     WPFP_WPFP236         236
-**     WPFP_WPFP237         237
-**     WPFP_WPFP238         238
-**     WPFP_WPFP239         239
-**     WPFP_WPFP240         240
-**     WPFP_WPFP241         241
-**     WPFP_WPFP242         242
-**     WPFP_WPFP243         243
-**     WPFP_WPFP244         244
-**     WPFP_WPFP245         245
-**     WPFP_WPFP246         246
-**     WPFP_WPFP247         247
-**     WPFP_WPFP248         248
-**     WPFP_WPFP249         249
-**     WPFP_WPFP250         250
-**     WPFP_WPFP251         251
-**     WPFP_WPFP252         252
-**     WPFP_WPFP253         253
-**     WPFP_WPFP254         254
-**     WPFP_WPFP255         255
-**     WPFP_WPFP256         256
-**     WPFP_WPFP257         257
-**     WPFP_WPFP258         258
-**     WPFP_WPFP259         259
-**     WPFP_WPFP260         260
-**     WPFP_WPFP261         261
-**     WPFP_WPFP262         262
-**     WPFP_WPFP263         263
-**     WPFP_WPFP264         264
-**     WPFP_WPFP265         265
-**     WPFP_WPFP266         266
-**     WPFP_WPFP267         267
-**     WPFP_WPFP268         268
-**     WPFP_WPFP269         269
-**     WPFP_WPFP270         270
-**     WPFP_WPFP271         271
-**     WPFP_WPFP272         272
-**     WPFP_WPFP273         273
-**     WPFP_WPFP274         274
-**     WPFP_WPFP275         275
-**     WPFP_WPFP276         276
-**     WPFP_WPFP277         277
-**     WPFP_WPFP278         278
-**     WPFP_WPFP279         279
-**     WPFP_WPFP280         280
-**     WPFP_WPFP281         281
-**     WPFP_WPFP282         282
-**     WPFP_WPFP283         283
-**     WPFP_WPFP284         284
-**     WPFP_WPFP285         285
-**     WPFP_WPFP286         286
-**     WPFP_WPFP287         287
-**     WPFP_WPFP288         288
-**     WPFP_WPFP289         289
-**     WPFP_WPFP290         290
-**     WPFP_WPFP291         291
-**     WPFP_WPFP292         292
-**     WPFP_WPFP293         293
-**     WPFP_WPFP294         294
-**     WPFP_WPFP295         295
-**     WPFP_WPFP296         296
-**     WPFP_WPFP297         297
-**     WPFP_WPFP298         298
-**     WPFP_WPFP299         299
-**     WPFP_WPFP300         300
-**     WPFP_WPFP301         301
-**     WPFP_WPFP302         302
-**     WPFP_WPFP303         303
-**     WPFP_WPFP304         304
-**     WPFP_WPFP305         305
-**     WPFP_WPFP306         306
-**     WPFP_WPFP307         307
-**     WPFP_WPFP308         308
-**     WPFP_WPFP309         309
-**     WPFP_WPFP310         310
-**     WPFP_WPFP311         311
-**     WPFP_WPFP312         312
-**     WPFP_WPFP313         313
-**     WPFP_WPFP314         314
-**     WPFP_WPFP315         315
-**     WPFP_WPFP316         316
-**     WPFP_WPFP317         317
-**     WPFP_WPFP318         318
-**     WPFP_WPFP319         319
-**     WPFP_WPFP320         320
-**     WPFP_WPFP321         321
-**     WPFP_WPFP322         322
-**     WPFP_WPFP323         323
-**     WPFP_WPFP324         324
-**     WPFP_WPFP325         325
-**     WPFP_WPFP326         326
-**     WPFP_WPFP327         327
-**     WPFP_WPFP328         328
-**     WPFP_WPFP329         329
-**     WPFP_WPFP330         330
-**     WPFP_WPFP331         331
-**     WPFP_WPFP332         332
-**     WPFP_WPFP333         333
-**     WPFP_WPFP334         334
-**     WPFP_WPFP335         335
-**     WPFP_WPFP336         336
-**     WPFP_WPFP337         337
-**     WPFP_WPFP338         338
-**     WPFP_WPFP339         339
-**     WPFP_WPFP340         340
-**     WPFP_WPFP341         341
-**     WPFP_WPFP342         342
-**     WPFP_WPFP343         343
-**     WPFP_WPFP344         344
-**     WPFP_WPFP345         345
-**     WPFP_WPFP346         346
-**     WPFP_WPFP347         347
-**     WPFP_WPFP348         348
-**     WPFP_WPFP349         349
-**     WPFP_WPFP350         350
-**     WPFP_WPFP351         351
-**     WPFP_WPFP352         352
-**     WPFP_WPFP353         353
-**     WPFP_WPFP354         354
-**     WPFP_WPFP355         355
-**     WPFP_WPFP356         356
-**     WPFP_WPFP357         357
-**     WPFP_WPFP358         358
-**     WPFP_WPFP359         359
-**     WPFP_WPFP360         360
-**     WPFP_WPFP361         361
-**     WPFP_WPFP362         362
-**     WPFP_WPFP363         363
-**     WPFP_WPFP364         364
-**     WPFP_WPFP365         365
-**     WPFP_WPFP366         366
-**     WPFP_WPFP367         367
-**     WPFP_WPFP368         368
-**     WPFP_WPFP369         369
-**     WPFP_WPFP370         370
-**     WPFP_WPFP371         371
-**     WPFP_WPFP372         372
-**     WPFP_WPFP373         373
-**     WPFP_WPFP374         374
-**     WPFP_WPFP375         375
-**     WPFP_WPFP376         376
-**     WPFP_WPFP377         377
-**     WPFP_WPFP378         378
-**     WPFP_WPFP379         379
-**     WPFP_WPFP380         380
-**     WPFP_WPFP381         381
-**     WPFP_WPFP382         382
-**     WPFP_WPFP383         383
-**     WPFP_WPFP384         384
-**     WPFP_WPFP385         385
-**     WPFP_WPFP386         386
-**     WPFP_WPFP387         387
-**     WPFP_WPFP388         388
-**     WPFP_WPFP389         389
-**     WPFP_WPFP390         390
-**     WPFP_WPFP391         391
-**     WPFP_WPFP392         392
-**     WPFP_WPFP393         393
-**     WPFP_WPFP394         394
-**     WPFP_WPFP395         395
-**     WPFP_WPFP396         396
-**     WPFP_WPFP397         397
-**     WPFP_WPFP398         398
-**     WPFP_WPFP399         399
-**     WPFP_WPFP400         400
-**     WPFP_WPFP401         401
-**     WPFP_WPFP402         402
-**     WPFP_WPFP403         403
-**     WPFP_WPFP404         404
-**     WPFP_WPFP405         405
-**     WPFP_WPFP406         406
-**     WPFP_WPFP407         407
-**     WPFP_WPFP408         408
-**     WPFP_WPFP409         409
-**     WPFP_WPFP410         410
-**     WPFP_WPFP411         411
-**     WPFP_WPFP412         412
-**     WPFP_WPFP413         413
-**     WPFP_WPFP414         414
-**     WPFP_WPFP415         415
-**     WPFP_WPFP416         416
-**     WPFP_WPFP417         417
-**     WPFP_WPFP418         418
-**     WPFP_WPFP419         419
-**     WPFP_WPFP420         420
-**     WPFP_WPFP421         421
-**     WPFP_WPFP422         422
-**     WPFP_WPFP423         423
-**     WPFP_WPFP424         424
-**     WPFP_WPFP425         425
-**     WPFP_WPFP426         426
-**     WPFP_WPFP427         427
-**     WPFP_WPFP428         428
-**     WPFP_WPFP429         429
-**     WPFP_WPFP430         430
-**     WPFP_WPFP431         431
-**     WPFP_WPFP432         432
-**     WPFP_WPFP433         433
-**     WPFP_WPFP434         434
-**     WPFP_WPFP435         435
-**     WPFP_WPFP436         436
-**     WPFP_WPFP437         437
-**     WPFP_WPFP438         438
-**     WPFP_WPFP439         439
-**     WPFP_WPFP440         440
-**     WPFP_WPFP441         441
-**     WPFP_WPFP442         442
-**     WPFP_WPFP443         443
-**     WPFP_WPFP444         444
-**     WPFP_WPFP445         445
-**     WPFP_WPFP446         446
-**     WPFP_WPFP447         447
-**     WPFP_WPFP448         448
-**     WPFP_WPFP449         449
-**     WPFP_WPFP450         450
-**     WPFP_WPFP451         451
-**     WPFP_WPFP452         452
-**     WPFP_WPFP453         453
-**     WPFP_WPFP454         454
-**     WPFP_WPFP455         455
-**     WPFP_WPFP456         456
-**     WPFP_WPFP457         457
-**     WPFP_WPFP458         458
-**     WPFP_WPFP459         459
-**     WPFP_WPFP460         460
-**     WPFP_WPFP461         461
-**     WPFP_WPFP462         462
-**     WPFP_WPFP463         463
-**     WPFP_WPFP464         464
-**     WPFP_WPFP465         465
-**     WPFP_WPFP466         466
-**     WPFP_WPFP467         467
-**     WPFP_WPFP468         468
-**     WPFP_WPFP469         469
-**     WPFP_WPFP470         470
-**     WPFP_WPFP471         471
-**     WPFP_WPFP472         472
-**     WPFP_WPFP473         473
-**     WPFP_WPFP474         474
-**     WPFP_WPFP475         475
-**     WPFP_WPFP476         476
-**     WPFP_WPFP477         477
-**     WPFP_WPFP478         478
-**     WPFP_WPFP479         479
-**     WPFP_WPFP480         480
-**     WPFP_WPFP481         481
-**     WPFP_WPFP482         482
-**     WPFP_WPFP483         483
-**     WPFP_WPFP484         484
-**     WPFP_WPFP485         485
-**     WPFP_WPFP486         486
-**     WPFP_WPFP487         487
-**     WPFP_WPFP488         488
-**     WPFP_WPFP489         489
-**     WPFP_WPFP490         490
-**     WPFP_WPFP491         491
-**     WPFP_WPFP492         492
-**     WPFP_WPFP493         493
-**     WPFP_WPFP494         494
-**     WPFP_WPFP495         495
-**     WPFP_WPFP496         496
-**     WPFP_WPFP497         497
-**     WPFP_WPFP498         498
-**     WPFP_WPFP499         499
-**     WPFP_WPFP500         500
-**     WPFP_WPFP501         501
-**     WPFP_WPFP502         502
-**     WPFP_WPFP503         503
-**     WPFP_WPFP504         504
-**     WPFP_WPFP505         505
-**     WPFP_WPFP506         506
-**     WPFP_WPFP507         507
-**     WPFP_WPFP508         508
-**     WPFP_WPFP509         509
-**     WPFP_WPFP510         510
-**     WPFP_WPFP511         511
-**
-*/
-
-#define WPEND_WPSTARTMEM     0x7FFF
-#define WPEND_WPENDMEM       0xFFFF
-
-#define WPCFG_WPCFGEN        0xBFFF
-#define WPCFG_WPCFGDIS       0xFFFF
-
-#define WPDIS_WPEN           0xDFFF
-#define WPDIS_WPDIS          0xFFFF
-
-#define WPFP_WPFP0           0xFE00
-#define WPFP_WPFP1           0xFE01
-#define WPFP_WPFP2           0xFE02
-#define WPFP_WPFP3           0xFE03
-#define WPFP_WPFP4           0xFE04
-#define WPFP_WPFP5           0xFE05
-#define WPFP_WPFP6           0xFE06
-#define WPFP_WPFP7           0xFE07
-#define WPFP_WPFP8           0xFE08
-#define WPFP_WPFP9           0xFE09
-#define WPFP_WPFP10          0xFE0A
-#define WPFP_WPFP11          0xFE0B
-#define WPFP_WPFP12          0xFE0C
-#define WPFP_WPFP13          0xFE0D
-#define WPFP_WPFP14          0xFE0E
-#define WPFP_WPFP15          0xFE0F
-#define WPFP_WPFP16          0xFE10
-#define WPFP_WPFP17          0xFE11
-#define WPFP_WPFP18          0xFE12
-#define WPFP_WPFP19          0xFE13
-#define WPFP_WPFP20          0xFE14
-#define WPFP_WPFP21          0xFE15
-#define WPFP_WPFP22          0xFE16
-#define WPFP_WPFP23          0xFE17
-#define WPFP_WPFP24          0xFE18
-#define WPFP_WPFP25          0xFE19
-#define WPFP_WPFP26          0xFE1A
-#define WPFP_WPFP27          0xFE1B
-#define WPFP_WPFP28          0xFE1C
-#define WPFP_WPFP29          0xFE1D
-#define WPFP_WPFP30          0xFE1E
-#define WPFP_WPFP31          0xFE1F
-#define WPFP_WPFP32          0xFE20
-#define WPFP_WPFP33          0xFE21
-#define WPFP_WPFP34          0xFE22
-#define WPFP_WPFP35          0xFE23
-#define WPFP_WPFP36          0xFE24
-#define WPFP_WPFP37          0xFE25
-#define WPFP_WPFP38          0xFE26
-#define WPFP_WPFP39          0xFE27
-#define WPFP_WPFP40          0xFE28
-#define WPFP_WPFP41          0xFE29
-#define WPFP_WPFP42          0xFE2A
-#define WPFP_WPFP43          0xFE2B
-#define WPFP_WPFP44          0xFE2C
-#define WPFP_WPFP45          0xFE2D
-#define WPFP_WPFP46          0xFE2E
-#define WPFP_WPFP47          0xFE2F
-#define WPFP_WPFP48          0xFE30
-#define WPFP_WPFP49          0xFE31
-#define WPFP_WPFP50          0xFE32
-#define WPFP_WPFP51          0xFE33
-#define WPFP_WPFP52          0xFE34
-#define WPFP_WPFP53          0xFE35
-#define WPFP_WPFP54          0xFE36
-#define WPFP_WPFP55          0xFE37
-#define WPFP_WPFP56          0xFE38
-#define WPFP_WPFP57          0xFE39
-#define WPFP_WPFP58          0xFE3A
-#define WPFP_WPFP59          0xFE3B
-#define WPFP_WPFP60          0xFE3C
-#define WPFP_WPFP61          0xFE3D
-#define WPFP_WPFP62          0xFE3E
-#define WPFP_WPFP63          0xFE3F
-#define WPFP_WPFP64          0xFE40
-#define WPFP_WPFP65          0xFE41
-#define WPFP_WPFP66          0xFE42
-#define WPFP_WPFP67          0xFE43
-#define WPFP_WPFP68          0xFE44
-#define WPFP_WPFP69          0xFE45
-#define WPFP_WPFP70          0xFE46
-#define WPFP_WPFP71          0xFE47
-#define WPFP_WPFP72          0xFE48
-#define WPFP_WPFP73          0xFE49
-#define WPFP_WPFP74          0xFE4A
-#define WPFP_WPFP75          0xFE4B
-#define WPFP_WPFP76          0xFE4C
-#define WPFP_WPFP77          0xFE4D
-#define WPFP_WPFP78          0xFE4E
-#define WPFP_WPFP79          0xFE4F
-#define WPFP_WPFP80          0xFE50
-#define WPFP_WPFP81          0xFE51
-#define WPFP_WPFP82          0xFE52
-#define WPFP_WPFP83          0xFE53
-#define WPFP_WPFP84          0xFE54
-#define WPFP_WPFP85          0xFE55
-#define WPFP_WPFP86          0xFE56
-#define WPFP_WPFP87          0xFE57
-#define WPFP_WPFP88          0xFE58
-#define WPFP_WPFP89          0xFE59
-#define WPFP_WPFP90          0xFE5A
-#define WPFP_WPFP91          0xFE5B
-#define WPFP_WPFP92          0xFE5C
-#define WPFP_WPFP93          0xFE5D
-#define WPFP_WPFP94          0xFE5E
-#define WPFP_WPFP95          0xFE5F
-#define WPFP_WPFP96          0xFE60
-#define WPFP_WPFP97          0xFE61
-#define WPFP_WPFP98          0xFE62
-#define WPFP_WPFP99          0xFE63
-#define WPFP_WPFP100         0xFE64
-#define WPFP_WPFP101         0xFE65
-#define WPFP_WPFP102         0xFE66
-#define WPFP_WPFP103         0xFE67
-#define WPFP_WPFP104         0xFE68
-#define WPFP_WPFP105         0xFE69
-#define WPFP_WPFP106         0xFE6A
-#define WPFP_WPFP107         0xFE6B
-#define WPFP_WPFP108         0xFE6C
-#define WPFP_WPFP109         0xFE6D
-#define WPFP_WPFP110         0xFE6E
-#define WPFP_WPFP111         0xFE6F
-#define WPFP_WPFP112         0xFE70
-#define WPFP_WPFP113         0xFE71
-#define WPFP_WPFP114         0xFE72
-#define WPFP_WPFP115         0xFE73
-#define WPFP_WPFP116         0xFE74
-#define WPFP_WPFP117         0xFE75
-#define WPFP_WPFP118         0xFE76
-#define WPFP_WPFP119         0xFE77
-#define WPFP_WPFP120         0xFE78
-#define WPFP_WPFP121         0xFE79
-#define WPFP_WPFP122         0xFE7A
-#define WPFP_WPFP123         0xFE7B
-#define WPFP_WPFP124         0xFE7C
-#define WPFP_WPFP125         0xFE7D
-#define WPFP_WPFP126         0xFE7E
-#define WPFP_WPFP127         0xFE7F
-#define WPFP_WPFP128         0xFE80
-#define WPFP_WPFP129         0xFE81
-#define WPFP_WPFP130         0xFE82
-#define WPFP_WPFP131         0xFE83
-#define WPFP_WPFP132         0xFE84
-#define WPFP_WPFP133         0xFE85
-#define WPFP_WPFP134         0xFE86
-#define WPFP_WPFP135         0xFE87
-#define WPFP_WPFP136         0xFE88
-#define WPFP_WPFP137         0xFE89
-#define WPFP_WPFP138         0xFE8A
-#define WPFP_WPFP139         0xFE8B
-#define WPFP_WPFP140         0xFE8C
-#define WPFP_WPFP141         0xFE8D
-#define WPFP_WPFP142         0xFE8E
-#define WPFP_WPFP143         0xFE8F
-#define WPFP_WPFP144         0xFE90
-#define WPFP_WPFP145         0xFE91
-#define WPFP_WPFP146         0xFE92
-#define WPFP_WPFP147         0xFE93
-#define WPFP_WPFP148         0xFE94
-#define WPFP_WPFP149         0xFE95
-#define WPFP_WPFP150         0xFE96
-#define WPFP_WPFP151         0xFE97
-#define WPFP_WPFP152         0xFE98
-#define WPFP_WPFP153         0xFE99
-#define WPFP_WPFP154         0xFE9A
-#define WPFP_WPFP155         0xFE9B
-#define WPFP_WPFP156         0xFE9C
-#define WPFP_WPFP157         0xFE9D
-#define WPFP_WPFP158         0xFE9E
-#define WPFP_WPFP159         0xFE9F
-#define WPFP_WPFP160         0xFEA0
-#define WPFP_WPFP161         0xFEA1
-#define WPFP_WPFP162         0xFEA2
-#define WPFP_WPFP163         0xFEA3
-#define WPFP_WPFP164         0xFEA4
-#define WPFP_WPFP165         0xFEA5
-#define WPFP_WPFP166         0xFEA6
-#define WPFP_WPFP167         0xFEA7
-#define WPFP_WPFP168         0xFEA8
-#define WPFP_WPFP169         0xFEA9
-#define WPFP_WPFP170         0xFEAA
-#define WPFP_WPFP171         0xFEAB
-#define WPFP_WPFP172         0xFEAC
-#define WPFP_WPFP173         0xFEAD
-#define WPFP_WPFP174         0xFEAE
-#define WPFP_WPFP175         0xFEAF
-#define WPFP_WPFP176         0xFEB0
-#define WPFP_WPFP177         0xFEB1
-#define WPFP_WPFP178         0xFEB2
-#define WPFP_WPFP179         0xFEB3
-#define WPFP_WPFP180         0xFEB4
-#define WPFP_WPFP181         0xFEB5
-#define WPFP_WPFP182         0xFEB6
-#define WPFP_WPFP183         0xFEB7
-#define WPFP_WPFP184         0xFEB8
-#define WPFP_WPFP185         0xFEB9
-#define WPFP_WPFP186         0xFEBA
-#define WPFP_WPFP187         0xFEBB
-#define WPFP_WPFP188         0xFEBC
-#define WPFP_WPFP189         0xFEBD
-#define WPFP_WPFP190         0xFEBE
-#define WPFP_WPFP191         0xFEBF
-#define WPFP_WPFP192         0xFEC0
-#define WPFP_WPFP193         0xFEC1
-#define WPFP_WPFP194         0xFEC2
-#define WPFP_WPFP195         0xFEC3
-#define WPFP_WPFP196         0xFEC4
-#define WPFP_WPFP197         0xFEC5
-#define WPFP_WPFP198         0xFEC6
-#define WPFP_WPFP199         0xFEC7
-#define WPFP_WPFP200         0xFEC8
-#define WPFP_WPFP201         0xFEC9
-#define WPFP_WPFP202         0xFECA
-#define WPFP_WPFP203         0xFECB
-#define WPFP_WPFP204         0xFECC
-#define WPFP_WPFP205         0xFECD
-#define WPFP_WPFP206         0xFECE
-#define WPFP_WPFP207         0xFECF
-#define WPFP_WPFP208         0xFED0
-#define WPFP_WPFP209         0xFED1
-#define WPFP_WPFP210         0xFED2
-#define WPFP_WPFP211         0xFED3
-#define WPFP_WPFP212         0xFED4
-#define WPFP_WPFP213         0xFED5
-#define WPFP_WPFP214         0xFED6
-#define WPFP_WPFP215         0xFED7
-#define WPFP_WPFP216         0xFED8
-#define WPFP_WPFP217         0xFED9
-#define WPFP_WPFP218         0xFEDA
-#define WPFP_WPFP219         0xFEDB
-#define WPFP_WPFP220         0xFEDC
-#define WPFP_WPFP221         0xFEDD
-#define WPFP_WPFP222         0xFEDE
-#define WPFP_WPFP223         0xFEDF
-#define WPFP_WPFP224         0xFEE0
-#define WPFP_WPFP225         0xFEE1
-#define WPFP_WPFP226         0xFEE2
-#define WPFP_WPFP227         0xFEE3
-#define WPFP_WPFP228         0xFEE4
-#define WPFP_WPFP229         0xFEE5
-#define WPFP_WPFP230         0xFEE6
-#define WPFP_WPFP231         0xFEE7
-#define WPFP_WPFP232         0xFEE8
-#define WPFP_WPFP233         0xFEE9
-#define WPFP_WPFP234         0xFEEA
-#define WPFP_WPFP235         0xFEEB
-#define WPFP_WPFP236         0xFEEC
-#define WPFP_WPFP237         0xFEED
-#define WPFP_WPFP238         0xFEEE
-#define WPFP_WPFP239         0xFEEF
-#define WPFP_WPFP240         0xFEF0
-#define WPFP_WPFP241         0xFEF1
-#define WPFP_WPFP242         0xFEF2
-#define WPFP_WPFP243         0xFEF3
-#define WPFP_WPFP244         0xFEF4
-#define WPFP_WPFP245         0xFEF5
-#define WPFP_WPFP246         0xFEF6
-#define WPFP_WPFP247         0xFEF7
-#define WPFP_WPFP248         0xFEF8
-#define WPFP_WPFP249         0xFEF9
-#define WPFP_WPFP250         0xFEFA
-#define WPFP_WPFP251         0xFEFB
-#define WPFP_WPFP252         0xFEFC
-#define WPFP_WPFP253         0xFEFD
-#define WPFP_WPFP254         0xFEFE
-#define WPFP_WPFP255         0xFEFF
-#define WPFP_WPFP256         0xFF00
-#define WPFP_WPFP257         0xFF01
-#define WPFP_WPFP258         0xFF02
-#define WPFP_WPFP259         0xFF03
-#define WPFP_WPFP260         0xFF04
-#define WPFP_WPFP261         0xFF05
-#define WPFP_WPFP262         0xFF06
-#define WPFP_WPFP263         0xFF07
-#define WPFP_WPFP264         0xFF08
-#define WPFP_WPFP265         0xFF09
-#define WPFP_WPFP266         0xFF0A
-#define WPFP_WPFP267         0xFF0B
-#define WPFP_WPFP268         0xFF0C
-#define WPFP_WPFP269         0xFF0D
-#define WPFP_WPFP270         0xFF0E
-#define WPFP_WPFP271         0xFF0F
-#define WPFP_WPFP272         0xFF10
-#define WPFP_WPFP273         0xFF11
-#define WPFP_WPFP274         0xFF12
-#define WPFP_WPFP275         0xFF13
-#define WPFP_WPFP276         0xFF14
-#define WPFP_WPFP277         0xFF15
-#define WPFP_WPFP278         0xFF16
-#define WPFP_WPFP279         0xFF17
-#define WPFP_WPFP280         0xFF18
-#define WPFP_WPFP281         0xFF19
-#define WPFP_WPFP282         0xFF1A
-#define WPFP_WPFP283         0xFF1B
-#define WPFP_WPFP284         0xFF1C
-#define WPFP_WPFP285         0xFF1D
-#define WPFP_WPFP286         0xFF1E
-#define WPFP_WPFP287         0xFF1F
-#define WPFP_WPFP288         0xFF20
-#define WPFP_WPFP289         0xFF21
-#define WPFP_WPFP290         0xFF22
-#define WPFP_WPFP291         0xFF23
-#define WPFP_WPFP292         0xFF24
-#define WPFP_WPFP293         0xFF25
-#define WPFP_WPFP294         0xFF26
-#define WPFP_WPFP295         0xFF27
-#define WPFP_WPFP296         0xFF28
-#define WPFP_WPFP297         0xFF29
-#define WPFP_WPFP298         0xFF2A
-#define WPFP_WPFP299         0xFF2B
-#define WPFP_WPFP300         0xFF2C
-#define WPFP_WPFP301         0xFF2D
-#define WPFP_WPFP302         0xFF2E
-#define WPFP_WPFP303         0xFF2F
-#define WPFP_WPFP304         0xFF30
-#define WPFP_WPFP305         0xFF31
-#define WPFP_WPFP306         0xFF32
-#define WPFP_WPFP307         0xFF33
-#define WPFP_WPFP308         0xFF34
-#define WPFP_WPFP309         0xFF35
-#define WPFP_WPFP310         0xFF36
-#define WPFP_WPFP311         0xFF37
-#define WPFP_WPFP312         0xFF38
-#define WPFP_WPFP313         0xFF39
-#define WPFP_WPFP314         0xFF3A
-#define WPFP_WPFP315         0xFF3B
-#define WPFP_WPFP316         0xFF3C
-#define WPFP_WPFP317         0xFF3D
-#define WPFP_WPFP318         0xFF3E
-#define WPFP_WPFP319         0xFF3F
-#define WPFP_WPFP320         0xFF40
-#define WPFP_WPFP321         0xFF41
-#define WPFP_WPFP322         0xFF42
-#define WPFP_WPFP323         0xFF43
-#define WPFP_WPFP324         0xFF44
-#define WPFP_WPFP325         0xFF45
-#define WPFP_WPFP326         0xFF46
-#define WPFP_WPFP327         0xFF47
-#define WPFP_WPFP328         0xFF48
-#define WPFP_WPFP329         0xFF49
-#define WPFP_WPFP330         0xFF4A
-#define WPFP_WPFP331         0xFF4B
-#define WPFP_WPFP332         0xFF4C
-#define WPFP_WPFP333         0xFF4D
-#define WPFP_WPFP334         0xFF4E
-#define WPFP_WPFP335         0xFF4F
-#define WPFP_WPFP336         0xFF50
-#define WPFP_WPFP337         0xFF51
-#define WPFP_WPFP338         0xFF52
-#define WPFP_WPFP339         0xFF53
-#define WPFP_WPFP340         0xFF54
-#define WPFP_WPFP341         0xFF55
-#define WPFP_WPFP342         0xFF56
-#define WPFP_WPFP343         0xFF57
-#define WPFP_WPFP344         0xFF58
-#define WPFP_WPFP345         0xFF59
-#define WPFP_WPFP346         0xFF5A
-#define WPFP_WPFP347         0xFF5B
-#define WPFP_WPFP348         0xFF5C
-#define WPFP_WPFP349         0xFF5D
-#define WPFP_WPFP350         0xFF5E
-#define WPFP_WPFP351         0xFF5F
-#define WPFP_WPFP352         0xFF60
-#define WPFP_WPFP353         0xFF61
-#define WPFP_WPFP354         0xFF62
-#define WPFP_WPFP355         0xFF63
-#define WPFP_WPFP356         0xFF64
-#define WPFP_WPFP357         0xFF65
-#define WPFP_WPFP358         0xFF66
-#define WPFP_WPFP359         0xFF67
-#define WPFP_WPFP360         0xFF68
-#define WPFP_WPFP361         0xFF69
-#define WPFP_WPFP362         0xFF6A
-#define WPFP_WPFP363         0xFF6B
-#define WPFP_WPFP364         0xFF6C
-#define WPFP_WPFP365         0xFF6D
-#define WPFP_WPFP366         0xFF6E
-#define WPFP_WPFP367         0xFF6F
-#define WPFP_WPFP368         0xFF70
-#define WPFP_WPFP369         0xFF71
-#define WPFP_WPFP370         0xFF72
-#define WPFP_WPFP371         0xFF73
-#define WPFP_WPFP372         0xFF74
-#define WPFP_WPFP373         0xFF75
-#define WPFP_WPFP374         0xFF76
-#define WPFP_WPFP375         0xFF77
-#define WPFP_WPFP376         0xFF78
-#define WPFP_WPFP377         0xFF79
-#define WPFP_WPFP378         0xFF7A
-#define WPFP_WPFP379         0xFF7B
-#define WPFP_WPFP380         0xFF7C
-#define WPFP_WPFP381         0xFF7D
-#define WPFP_WPFP382         0xFF7E
-#define WPFP_WPFP383         0xFF7F
-#define WPFP_WPFP384         0xFF80
-#define WPFP_WPFP385         0xFF81
-#define WPFP_WPFP386         0xFF82
-#define WPFP_WPFP387         0xFF83
-#define WPFP_WPFP388         0xFF84
-#define WPFP_WPFP389         0xFF85
-#define WPFP_WPFP390         0xFF86
-#define WPFP_WPFP391         0xFF87
-#define WPFP_WPFP392         0xFF88
-#define WPFP_WPFP393         0xFF89
-#define WPFP_WPFP394         0xFF8A
-#define WPFP_WPFP395         0xFF8B
-#define WPFP_WPFP396         0xFF8C
-#define WPFP_WPFP397         0xFF8D
-#define WPFP_WPFP398         0xFF8E
-#define WPFP_WPFP399         0xFF8F
-#define WPFP_WPFP400         0xFF90
-#define WPFP_WPFP401         0xFF91
-#define WPFP_WPFP402         0xFF92
-#define WPFP_WPFP403         0xFF93
-#define WPFP_WPFP404         0xFF94
-#define WPFP_WPFP405         0xFF95
-#define WPFP_WPFP406         0xFF96
-#define WPFP_WPFP407         0xFF97
-#define WPFP_WPFP408         0xFF98
-#define WPFP_WPFP409         0xFF99
-#define WPFP_WPFP410         0xFF9A
-#define WPFP_WPFP411         0xFF9B
-#define WPFP_WPFP412         0xFF9C
-#define WPFP_WPFP413         0xFF9D
-#define WPFP_WPFP414         0xFF9E
-#define WPFP_WPFP415         0xFF9F
-#define WPFP_WPFP416         0xFFA0
-#define WPFP_WPFP417         0xFFA1
-#define WPFP_WPFP418         0xFFA2
-#define WPFP_WPFP419         0xFFA3
-#define WPFP_WPFP420         0xFFA4
-#define WPFP_WPFP421         0xFFA5
-#define WPFP_WPFP422         0xFFA6
-#define WPFP_WPFP423         0xFFA7
-#define WPFP_WPFP424         0xFFA8
-#define WPFP_WPFP425         0xFFA9
-#define WPFP_WPFP426         0xFFAA
-#define WPFP_WPFP427         0xFFAB
-#define WPFP_WPFP428         0xFFAC
-#define WPFP_WPFP429         0xFFAD
-#define WPFP_WPFP430         0xFFAE
-#define WPFP_WPFP431         0xFFAF
-#define WPFP_WPFP432         0xFFB0
-#define WPFP_WPFP433         0xFFB1
-#define WPFP_WPFP434         0xFFB2
-#define WPFP_WPFP435         0xFFB3
-#define WPFP_WPFP436         0xFFB4
-#define WPFP_WPFP437         0xFFB5
-#define WPFP_WPFP438         0xFFB6
-#define WPFP_WPFP439         0xFFB7
-#define WPFP_WPFP440         0xFFB8
-#define WPFP_WPFP441         0xFFB9
-#define WPFP_WPFP442         0xFFBA
-#define WPFP_WPFP443         0xFFBB
-#define WPFP_WPFP444         0xFFBC
-#define WPFP_WPFP445         0xFFBD
-#define WPFP_WPFP446         0xFFBE
-#define WPFP_WPFP447         0xFFBF
-#define WPFP_WPFP448         0xFFC0
-#define WPFP_WPFP449         0xFFC1
-#define WPFP_WPFP450         0xFFC2
-#define WPFP_WPFP451         0xFFC3
-#define WPFP_WPFP452         0xFFC4
-#define WPFP_WPFP453         0xFFC5
-#define WPFP_WPFP454         0xFFC6
-#define WPFP_WPFP455         0xFFC7
-#define WPFP_WPFP456         0xFFC8
-#define WPFP_WPFP457         0xFFC9
-#define WPFP_WPFP458         0xFFCA
-#define WPFP_WPFP459         0xFFCB
-#define WPFP_WPFP460         0xFFCC
-#define WPFP_WPFP461         0xFFCD
-#define WPFP_WPFP462         0xFFCE
-#define WPFP_WPFP463         0xFFCF
-#define WPFP_WPFP464         0xFFD0
-#define WPFP_WPFP465         0xFFD1
-#define WPFP_WPFP466         0xFFD2
-#define WPFP_WPFP467         0xFFD3
-#define WPFP_WPFP468         0xFFD4
-#define WPFP_WPFP469         0xFFD5
-#define WPFP_WPFP470         0xFFD6
-#define WPFP_WPFP471         0xFFD7
-#define WPFP_WPFP472         0xFFD8
-#define WPFP_WPFP473         0xFFD9
-#define WPFP_WPFP474         0xFFDA
-#define WPFP_WPFP475         0xFFDB
-#define WPFP_WPFP476         0xFFDC
-#define WPFP_WPFP477         0xFFDD
-#define WPFP_WPFP478         0xFFDE
-#define WPFP_WPFP479         0xFFDF
-#define WPFP_WPFP480         0xFFE0
-#define WPFP_WPFP481         0xFFE1
-#define WPFP_WPFP482         0xFFE2
-#define WPFP_WPFP483         0xFFE3
-#define WPFP_WPFP484         0xFFE4
-#define WPFP_WPFP485         0xFFE5
-#define WPFP_WPFP486         0xFFE6
-#define WPFP_WPFP487         0xFFE7
-#define WPFP_WPFP488         0xFFE8
-#define WPFP_WPFP489         0xFFE9
-#define WPFP_WPFP490         0xFFEA
-#define WPFP_WPFP491         0xFFEB
-#define WPFP_WPFP492         0xFFEC
-#define WPFP_WPFP493         0xFFED
-#define WPFP_WPFP494         0xFFEE
-#define WPFP_WPFP495         0xFFEF
-#define WPFP_WPFP496         0xFFF0
-#define WPFP_WPFP497         0xFFF1
-#define WPFP_WPFP498         0xFFF2
-#define WPFP_WPFP499         0xFFF3
-#define WPFP_WPFP500         0xFFF4
-#define WPFP_WPFP501         0xFFF5
-#define WPFP_WPFP502         0xFFF6
-#define WPFP_WPFP503         0xFFF7
-#define WPFP_WPFP504         0xFFF8
-#define WPFP_WPFP505         0xFFF9
-#define WPFP_WPFP506         0xFFFA
-#define WPFP_WPFP507         0xFFFB
-#define WPFP_WPFP508         0xFFFC
-#define WPFP_WPFP509         0xFFFD
-#define WPFP_WPFP510         0xFFFE
-#define WPFP_WPFP511         0xFFFF
-
-/* Register CONFIG2 (0x2abfc)                               */
-
-extern __attribute__((space(prog))) int _CONFIG2;
-#define _CONFIG2(x) __attribute__((section("__CONFIG2.sec"),space(prog))) int _CONFIG2 = (x);
-
-/*
-** Only one invocation of CONFIG2 should appear in a project,
-** at the top of a C source file (outside of any function).
-**
-** The following constants can be used to set CONFIG2.
-** Multiple options may be combined, as shown:
-**
-** _CONFIG2( OPT1_ON & OPT2_OFF & OPT3_PLL )
-**
-**   Two Speed Start-up:
-**     IESO_OFF             Disabled
-**     IESO_ON              Enabled
-**
-**   96MHz PLL Prescaler:
-**     PLLDIV_NODIV         No Divide (4MHz input)
-**     PLLDIV_DIV2          Divide by 2 (8MHz input)
-**     PLLDIV_DIV3          Divide by 3 (12MHz input)
-**     PLLDIV_DIV4          Divide by 4 (16MHz input)
-**     PLLDIV_DIV5          Divide by 5 (20MHz input)
-**     PLLDIV_DIV6          Divide by 6 (24MHz input)
-**     PLLDIV_DIV10         Divide by 10 (40MHz input)
-**     PLLDIV_DIV12         Divide by 12 (48MHz input)
-**
-**   Disable 96MHz PLL:
-**     PLL_96MHZ_ON         Enabled
-**
-**   Oscillator Selection:
-**     FNOSC_FRC            Fast RC oscillator
-**     FNOSC_FRCPLL         Fast RC oscillator w/ divide and PLL
-**     FNOSC_PRI            Primary oscillator (XT, HS, EC)
-**     FNOSC_PRIPLL         Primary oscillator (XT, HS, EC) w/ PLL
-**     FNOSC_SOSC           Secondary oscillator
-**     FNOSC_LPRC           Low power RC oscillator
-**     FNOSC_FRCDIV         Fast RC oscillator with divide
-**
-**   Clock switching and clock monitor:
-**     FCKSM_CSECME         Both enabled
-**     FCKSM_CSECMD         Only clock switching enabled
-**     FCKSM_CSDCMD         Both disabled
-**
-**   OSCO/RC15 function:
-**     OSCIOFNC_ON          RC15
-**     OSCIOFNC_OFF         OSCO or Fosc/2
-**
-**   RP Register Protection:
-**     IOL1WAY_OFF          Unlimited Writes To RP Registers
-**     IOL1WAY_ON           Write RP Registers Once
-**
-**   Disable Internal USB Voltage Regulator:
-**     DISUVREG_ON          Enabled
-**     DISUVREG_OFF         Disabled
-**
-**   Oscillator Selection:
-**     POSCMOD_EC           External clock
-**     POSCMOD_XT           XT oscillator
-**     POSCMOD_HS           HS oscillator
-**     POSCMOD_NONE         Primary disabled
-**
-*/
-
-#define IESO_OFF             0x77FF
-#define IESO_ON              0xF7FF
-
-#define PLLDIV_NODIV         0x87FF
-#define PLLDIV_DIV2          0x97FF
-#define PLLDIV_DIV3          0xA7FF
-#define PLLDIV_DIV4          0xB7FF
-#define PLLDIV_DIV5          0xC7FF
-#define PLLDIV_DIV6          0xD7FF
-#define PLLDIV_DIV10         0xE7FF
-#define PLLDIV_DIV12         0xF7FF
-
-#define PLL_96MHZ_ON         0xF7FF
-
-#define FNOSC_FRC            0xF0FF
-#define FNOSC_FRCPLL         0xF1FF
-#define FNOSC_PRI            0xF2FF
-#define FNOSC_PRIPLL         0xF3FF
-#define FNOSC_SOSC           0xF4FF
-#define FNOSC_LPRC           0xF5FF
-#define FNOSC_FRCDIV         0xF7FF
-
-#define FCKSM_CSECME         0xF73F
-#define FCKSM_CSECMD         0xF77F
-#define FCKSM_CSDCMD         0xF7BF
-
-#define OSCIOFNC_ON          0xF7DF
-#define OSCIOFNC_OFF         0xF7FF
-
-#define IOL1WAY_OFF          0xF7EF
-#define IOL1WAY_ON           0xF7FF
-
-#define DISUVREG_ON          0xF7F7
-#define DISUVREG_OFF         0xF7FF
-
-#define POSCMOD_EC           0xF7FC
-#define POSCMOD_XT           0xF7FD
-#define POSCMOD_HS           0xF7FE
-#define POSCMOD_NONE         0xF7FF
-
-/* Register CONFIG1 (0x2abfe)                               */
-
-extern __attribute__((space(prog))) int _CONFIG1;
-#define _CONFIG1(x) __attribute__((section("__CONFIG1.sec"),space(prog))) int _CONFIG1 = (x);
-
-/*
-** Only one invocation of CONFIG1 should appear in a project,
-** at the top of a C source file (outside of any function).
-**
-** The following constants can be used to set CONFIG1.
-** Multiple options may be combined, as shown:
-**
-** _CONFIG1( OPT1_ON & OPT2_OFF & OPT3_PLL )
-**
-**   JTAG:
-**     JTAGEN_OFF           Disabled
-**     JTAGEN_ON            Enabled
-**
-**   Code Protect:
-**     GCP_ON               Enabled
-**     GCP_OFF              Disabled
-**
-**   Write Protect:
-**     GWRP_ON              Enabled
-**     GWRP_OFF             Disabled
-**
-**   Background Debugger:
-**     BKBUG_ON             Enabled
-**     BKBUG_OFF            Disabled
-**
-**   Clip-on Emulation mode:
-**     COE_ON               Enabled
-**     COE_OFF              Disabled
-**
-**   ICD pins select:
-**     ICS_PGx3             EMUC/EMUD share PGC3/PGD3
-**     ICS_PGx2             EMUC/EMUD share PGC2/PGD2
-**     ICS_PGx1             EMUC/EMUD share PGC1/PGD1
-**
-**   Watchdog Timer:
-**     FWDTEN_OFF           Disabled
-**     FWDTEN_ON            Enabled
-**
-**   Windowed WDT:
-**     WINDIS_ON            Enabled
-**     WINDIS_OFF           Disabled
-**
-**   Watchdog prescaler:
-**     FWPSA_PR32           1:32
-**     FWPSA_PR128          1:128
-**
-**   Watchdog postscale:
-**     WDTPS_PS1            1:1
-**     WDTPS_PS2            1:2
-**     WDTPS_PS4            1:4
-**     WDTPS_PS8            1:8
-**     WDTPS_PS16           1:16
-**     WDTPS_PS32           1:32
-**     WDTPS_PS64           1:64
-**     WDTPS_PS128          1:128
-**     WDTPS_PS256          1:256
-**     WDTPS_PS512          1:512
-**     WDTPS_PS1024         1:1,024
-**     WDTPS_PS2048         1:2,048
-**     WDTPS_PS4096         1:4,096
-**     WDTPS_PS8192         1:8,192
-**     WDTPS_PS16384        1:16,384
-**     WDTPS_PS32768        1:32,768
-**
-*/
-
-#define JTAGEN_OFF           0x3FFF
-#define JTAGEN_ON            0x7FFF
-
-#define GCP_ON               0x5FFF
-#define GCP_OFF              0x7FFF
-
-#define GWRP_ON              0x6FFF
-#define GWRP_OFF             0x7FFF
-
-#define BKBUG_ON             0x77FF
-#define BKBUG_OFF            0x7FFF
-
-#define COE_ON               0x7BFF
-#define COE_OFF              0x7FFF
-
-#define ICS_PGx3             0x7DFF
-#define ICS_PGx2             0x7EFF
-#define ICS_PGx1             0x7FFF
-
-#define FWDTEN_OFF           0x7F7F
-#define FWDTEN_ON            0x7FFF
-
-#define WINDIS_ON            0x7FBF
-#define WINDIS_OFF           0x7FFF
-
-#define FWPSA_PR32           0x7FEF
-#define FWPSA_PR128          0x7FFF
-
-#define WDTPS_PS1            0x7FF0
-#define WDTPS_PS2            0x7FF1
-#define WDTPS_PS4            0x7FF2
-#define WDTPS_PS8            0x7FF3
-#define WDTPS_PS16           0x7FF4
-#define WDTPS_PS32           0x7FF5
-#define WDTPS_PS64           0x7FF6
-#define WDTPS_PS128          0x7FF7
-#define WDTPS_PS256          0x7FF8
-#define WDTPS_PS512          0x7FF9
-#define WDTPS_PS1024         0x7FFA
-#define WDTPS_PS2048         0x7FFB
-#define WDTPS_PS4096         0x7FFC
-#define WDTPS_PS8192         0x7FFD
-#define WDTPS_PS16384        0x7FFE
-#define WDTPS_PS32768        0x7FFF
-
-
-#endif
+/*-------------------------------------------------------------------------
+ * MPLAB-Cxx  PIC24FJ256GB106 processor header
+ *
+ * (c) Copyright 1999-2010 Microchip Technology, All rights reserved
+ *-------------------------------------------------------------------------*/
+
+#ifndef __PIC24FJ256GB106__
+#error "Include file does not match processor setting"
+#endif
+
+#ifndef __24FJ256GB106_H
+#define __24FJ256GB106_H
+
+extern volatile unsigned int  WREG0 __attribute__((__sfr__,__deprecated__,__unsafe__));
+extern volatile unsigned int  WREG1 __attribute__((__sfr__,__deprecated__,__unsafe__));
+extern volatile unsigned int  WREG2 __attribute__((__sfr__,__deprecated__,__unsafe__));
+extern volatile unsigned int  WREG3 __attribute__((__sfr__,__deprecated__,__unsafe__));
+extern volatile unsigned int  WREG4 __attribute__((__sfr__,__deprecated__,__unsafe__));
+extern volatile unsigned int  WREG5 __attribute__((__sfr__,__deprecated__,__unsafe__));
+extern volatile unsigned int  WREG6 __attribute__((__sfr__,__deprecated__,__unsafe__));
+extern volatile unsigned int  WREG7 __attribute__((__sfr__,__deprecated__,__unsafe__));
+extern volatile unsigned int  WREG8 __attribute__((__sfr__,__deprecated__,__unsafe__));
+extern volatile unsigned int  WREG9 __attribute__((__sfr__,__deprecated__,__unsafe__));
+extern volatile unsigned int  WREG10 __attribute__((__sfr__,__deprecated__,__unsafe__));
+extern volatile unsigned int  WREG11 __attribute__((__sfr__,__deprecated__,__unsafe__));
+extern volatile unsigned int  WREG12 __attribute__((__sfr__,__deprecated__,__unsafe__));
+extern volatile unsigned int  WREG13 __attribute__((__sfr__,__deprecated__,__unsafe__));
+extern volatile unsigned int  WREG14 __attribute__((__sfr__,__deprecated__,__unsafe__));
+extern volatile unsigned int  WREG15 __attribute__((__sfr__,__deprecated__,__unsafe__));
+extern volatile unsigned int  SPLIM __attribute__((__sfr__));
+extern volatile unsigned int  PCL __attribute__((__sfr__));
+extern volatile unsigned int  PCH __attribute__((__sfr__));
+extern volatile unsigned int  TBLPAG __attribute__((__sfr__));
+extern volatile unsigned int  PSVPAG __attribute__((__sfr__));
+extern volatile unsigned int  RCOUNT __attribute__((__sfr__));
+extern volatile unsigned int  SR __attribute__((__sfr__));
+__extension__ typedef struct tagSRBITS {
+  union {
+    struct {
+      unsigned C:1;
+      unsigned Z:1;
+      unsigned OV:1;
+      unsigned N:1;
+      unsigned RA:1;
+      unsigned IPL0:1;
+      unsigned IPL1:1;
+      unsigned IPL2:1;
+      unsigned DC:1;
+    };
+    struct {
+      unsigned :5;
+      unsigned IPL:3;
+    };
+  };
+} SRBITS;
+extern volatile SRBITS SRbits __attribute__((__sfr__));
+
+extern volatile unsigned int  CORCON __attribute__((__sfr__));
+typedef struct tagCORCONBITS {
+  unsigned :2;
+  unsigned PSV:1;
+  unsigned IPL3:1;
+} CORCONBITS;
+extern volatile CORCONBITS CORCONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  DISICNT __attribute__((__sfr__));
+extern volatile unsigned int  CNPD1 __attribute__((__sfr__));
+typedef struct tagCNPD1BITS {
+  unsigned CN0PDE:1;
+  unsigned CN1PDE:1;
+  unsigned CN2PDE:1;
+  unsigned CN3PDE:1;
+  unsigned CN4PDE:1;
+  unsigned CN5PDE:1;
+  unsigned CN6PDE:1;
+  unsigned CN7PDE:1;
+  unsigned CN8PDE:1;
+  unsigned CN9PDE:1;
+  unsigned CN10PDE:1;
+  unsigned CN11PDE:1;
+  unsigned CN12PDE:1;
+  unsigned CN13PDE:1;
+  unsigned CN14PDE:1;
+  unsigned CN15PDE:1;
+} CNPD1BITS;
+extern volatile CNPD1BITS CNPD1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  CNPD2 __attribute__((__sfr__));
+typedef struct tagCNPD2BITS {
+  unsigned CN16PDE:1;
+  unsigned CN17PDE:1;
+  unsigned CN18PDE:1;
+  unsigned :3;
+  unsigned CN22PDE:1;
+  unsigned CN23PDE:1;
+  unsigned CN24PDE:1;
+  unsigned CN25PDE:1;
+  unsigned CN26PDE:1;
+  unsigned CN27PDE:1;
+  unsigned CN28PDE:1;
+  unsigned CN29PDE:1;
+  unsigned CN30PDE:1;
+  unsigned CN31PDE:1;
+} CNPD2BITS;
+extern volatile CNPD2BITS CNPD2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  CNPD3 __attribute__((__sfr__));
+typedef struct tagCNPD3BITS {
+  unsigned CN32PDE:1;
+} CNPD3BITS;
+extern volatile CNPD3BITS CNPD3bits __attribute__((__sfr__));
+
+extern volatile unsigned int  CNPD4 __attribute__((__sfr__));
+typedef struct tagCNPD4BITS {
+  unsigned :1;
+  unsigned CN49PDE:1;
+  unsigned CN50PDE:1;
+  unsigned CN51PDE:1;
+  unsigned CN52PDE:1;
+  unsigned CN53PDE:1;
+  unsigned CN54PDE:1;
+  unsigned CN55PDE:1;
+  unsigned CN56PDE:1;
+  unsigned :1;
+  unsigned CN58PDE:1;
+  unsigned CN59PDE:1;
+  unsigned CN60PDE:1;
+  unsigned CN61PDE:1;
+  unsigned CN62PDE:1;
+  unsigned CN63PDE:1;
+} CNPD4BITS;
+extern volatile CNPD4BITS CNPD4bits __attribute__((__sfr__));
+
+extern volatile unsigned int  CNPD5 __attribute__((__sfr__));
+typedef struct tagCNPD5BITS {
+  unsigned CN64PDE:1;
+  unsigned CN65PDE:1;
+  unsigned :2;
+  unsigned CN68PDE:1;
+  unsigned CN69PDE:1;
+  unsigned :1;
+  unsigned CN71PDE:1;
+} CNPD5BITS;
+extern volatile CNPD5BITS CNPD5bits __attribute__((__sfr__));
+
+extern volatile unsigned int  CNEN1 __attribute__((__sfr__));
+typedef struct tagCNEN1BITS {
+  unsigned CN0IE:1;
+  unsigned CN1IE:1;
+  unsigned CN2IE:1;
+  unsigned CN3IE:1;
+  unsigned CN4IE:1;
+  unsigned CN5IE:1;
+  unsigned CN6IE:1;
+  unsigned CN7IE:1;
+  unsigned CN8IE:1;
+  unsigned CN9IE:1;
+  unsigned CN10IE:1;
+  unsigned CN11IE:1;
+  unsigned CN12IE:1;
+  unsigned CN13IE:1;
+  unsigned CN14IE:1;
+  unsigned CN15IE:1;
+} CNEN1BITS;
+extern volatile CNEN1BITS CNEN1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  CNEN2 __attribute__((__sfr__));
+typedef struct tagCNEN2BITS {
+  unsigned CN16IE:1;
+  unsigned CN17IE:1;
+  unsigned CN18IE:1;
+  unsigned :3;
+  unsigned CN22IE:1;
+  unsigned CN23IE:1;
+  unsigned CN24IE:1;
+  unsigned CN25IE:1;
+  unsigned CN26IE:1;
+  unsigned CN27IE:1;
+  unsigned CN28IE:1;
+  unsigned CN29IE:1;
+  unsigned CN30IE:1;
+  unsigned CN31IE:1;
+} CNEN2BITS;
+extern volatile CNEN2BITS CNEN2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  CNEN3 __attribute__((__sfr__));
+typedef struct tagCNEN3BITS {
+  unsigned CN32IE:1;
+} CNEN3BITS;
+extern volatile CNEN3BITS CNEN3bits __attribute__((__sfr__));
+
+extern volatile unsigned int  CNEN4 __attribute__((__sfr__));
+typedef struct tagCNEN4BITS {
+  unsigned :1;
+  unsigned CN49IE:1;
+  unsigned CN50IE:1;
+  unsigned CN51IE:1;
+  unsigned CN52IE:1;
+  unsigned CN53IE:1;
+  unsigned CN54IE:1;
+  unsigned CN55IE:1;
+  unsigned CN56IE:1;
+  unsigned :1;
+  unsigned CN58IE:1;
+  unsigned CN59IE:1;
+  unsigned CN60IE:1;
+  unsigned CN61IE:1;
+  unsigned CN62IE:1;
+  unsigned CN63IE:1;
+} CNEN4BITS;
+extern volatile CNEN4BITS CNEN4bits __attribute__((__sfr__));
+
+extern volatile unsigned int  CNEN5 __attribute__((__sfr__));
+typedef struct tagCNEN5BITS {
+  unsigned CN64IE:1;
+  unsigned CN65IE:1;
+  unsigned :2;
+  unsigned CN68IE:1;
+  unsigned CN69IE:1;
+  unsigned :1;
+  unsigned CN71IE:1;
+} CNEN5BITS;
+extern volatile CNEN5BITS CNEN5bits __attribute__((__sfr__));
+
+extern volatile unsigned int  CNPU1 __attribute__((__sfr__));
+typedef struct tagCNPU1BITS {
+  unsigned CN0PUE:1;
+  unsigned CN1PUE:1;
+  unsigned CN2PUE:1;
+  unsigned CN3PUE:1;
+  unsigned CN4PUE:1;
+  unsigned CN5PUE:1;
+  unsigned CN6PUE:1;
+  unsigned CN7PUE:1;
+  unsigned CN8PUE:1;
+  unsigned CN9PUE:1;
+  unsigned CN10PUE:1;
+  unsigned CN11PUE:1;
+  unsigned CN12PUE:1;
+  unsigned CN13PUE:1;
+  unsigned CN14PUE:1;
+  unsigned CN15PUE:1;
+} CNPU1BITS;
+extern volatile CNPU1BITS CNPU1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  CNPU2 __attribute__((__sfr__));
+typedef struct tagCNPU2BITS {
+  unsigned CN16PUE:1;
+  unsigned CN17PUE:1;
+  unsigned CN18PUE:1;
+  unsigned :3;
+  unsigned CN22PUE:1;
+  unsigned CN23PUE:1;
+  unsigned CN24PUE:1;
+  unsigned CN25PUE:1;
+  unsigned CN26PUE:1;
+  unsigned CN27PUE:1;
+  unsigned CN28PUE:1;
+  unsigned CN29PUE:1;
+  unsigned CN30PUE:1;
+  unsigned CN31PUE:1;
+} CNPU2BITS;
+extern volatile CNPU2BITS CNPU2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  CNPU3 __attribute__((__sfr__));
+typedef struct tagCNPU3BITS {
+  unsigned CN32PUE:1;
+} CNPU3BITS;
+extern volatile CNPU3BITS CNPU3bits __attribute__((__sfr__));
+
+extern volatile unsigned int  CNPU4 __attribute__((__sfr__));
+typedef struct tagCNPU4BITS {
+  unsigned :1;
+  unsigned CN49PUE:1;
+  unsigned CN50PUE:1;
+  unsigned CN51PUE:1;
+  unsigned CN52PUE:1;
+  unsigned CN53PUE:1;
+  unsigned CN54PUE:1;
+  unsigned CN55PUE:1;
+  unsigned CN56PUE:1;
+  unsigned :1;
+  unsigned CN58PUE:1;
+  unsigned CN59PUE:1;
+  unsigned CN60PUE:1;
+  unsigned CN61PUE:1;
+  unsigned CN62PUE:1;
+  unsigned CN63PUE:1;
+} CNPU4BITS;
+extern volatile CNPU4BITS CNPU4bits __attribute__((__sfr__));
+
+extern volatile unsigned int  CNPU5 __attribute__((__sfr__));
+typedef struct tagCNPU5BITS {
+  unsigned CN64PUE:1;
+  unsigned CN65PUE:1;
+  unsigned :2;
+  unsigned CN68PUE:1;
+  unsigned CN69PUE:1;
+  unsigned :1;
+  unsigned CN71PUE:1;
+} CNPU5BITS;
+extern volatile CNPU5BITS CNPU5bits __attribute__((__sfr__));
+
+extern volatile unsigned int  INTCON1 __attribute__((__sfr__));
+typedef struct tagINTCON1BITS {
+  unsigned :1;
+  unsigned OSCFAIL:1;
+  unsigned STKERR:1;
+  unsigned ADDRERR:1;
+  unsigned MATHERR:1;
+  unsigned :10;
+  unsigned NSTDIS:1;
+} INTCON1BITS;
+extern volatile INTCON1BITS INTCON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  INTCON2 __attribute__((__sfr__));
+typedef struct tagINTCON2BITS {
+  unsigned INT0EP:1;
+  unsigned INT1EP:1;
+  unsigned INT2EP:1;
+  unsigned INT3EP:1;
+  unsigned INT4EP:1;
+  unsigned :9;
+  unsigned DISI:1;
+  unsigned ALTIVT:1;
+} INTCON2BITS;
+extern volatile INTCON2BITS INTCON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IFS0 __attribute__((__sfr__));
+typedef struct tagIFS0BITS {
+  unsigned INT0IF:1;
+  unsigned IC1IF:1;
+  unsigned OC1IF:1;
+  unsigned T1IF:1;
+  unsigned :1;
+  unsigned IC2IF:1;
+  unsigned OC2IF:1;
+  unsigned T2IF:1;
+  unsigned T3IF:1;
+  unsigned SPF1IF:1;
+  unsigned SPI1IF:1;
+  unsigned U1RXIF:1;
+  unsigned U1TXIF:1;
+  unsigned AD1IF:1;
+} IFS0BITS;
+extern volatile IFS0BITS IFS0bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IFS1 __attribute__((__sfr__));
+typedef struct tagIFS1BITS {
+  unsigned SI2C1IF:1;
+  unsigned MI2C1IF:1;
+  unsigned CMIF:1;
+  unsigned CNIF:1;
+  unsigned INT1IF:1;
+  unsigned :1;
+  unsigned IC7IF:1;
+  unsigned IC8IF:1;
+  unsigned :1;
+  unsigned OC3IF:1;
+  unsigned OC4IF:1;
+  unsigned T4IF:1;
+  unsigned T5IF:1;
+  unsigned INT2IF:1;
+  unsigned U2RXIF:1;
+  unsigned U2TXIF:1;
+} IFS1BITS;
+extern volatile IFS1BITS IFS1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IFS2 __attribute__((__sfr__));
+typedef struct tagIFS2BITS {
+  unsigned SPF2IF:1;
+  unsigned SPI2IF:1;
+  unsigned :3;
+  unsigned IC3IF:1;
+  unsigned IC4IF:1;
+  unsigned IC5IF:1;
+  unsigned IC6IF:1;
+  unsigned OC5IF:1;
+  unsigned OC6IF:1;
+  unsigned OC7IF:1;
+  unsigned OC8IF:1;
+  unsigned PMPIF:1;
+} IFS2BITS;
+extern volatile IFS2BITS IFS2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IFS3 __attribute__((__sfr__));
+typedef struct tagIFS3BITS {
+  unsigned :1;
+  unsigned SI2C2IF:1;
+  unsigned MI2C2IF:1;
+  unsigned :2;
+  unsigned INT3IF:1;
+  unsigned INT4IF:1;
+  unsigned :7;
+  unsigned RTCIF:1;
+} IFS3BITS;
+extern volatile IFS3BITS IFS3bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IFS4 __attribute__((__sfr__));
+typedef struct tagIFS4BITS {
+  unsigned :1;
+  unsigned U1ERIF:1;
+  unsigned U2ERIF:1;
+  unsigned CRCIF:1;
+  unsigned :4;
+  unsigned LVDIF:1;
+  unsigned :4;
+  unsigned CTMUIF:1;
+} IFS4BITS;
+extern volatile IFS4BITS IFS4bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IFS5 __attribute__((__sfr__));
+typedef struct tagIFS5BITS {
+  unsigned :1;
+  unsigned U3ERIF:1;
+  unsigned U3RXIF:1;
+  unsigned U3TXIF:1;
+  unsigned SI2C3IF:1;
+  unsigned MI2C3IF:1;
+  unsigned USB1IF:1;
+  unsigned U4ERIF:1;
+  unsigned U4RXIF:1;
+  unsigned U4TXIF:1;
+  unsigned SPF3IF:1;
+  unsigned SPI3IF:1;
+  unsigned OC9IF:1;
+  unsigned IC9IF:1;
+} IFS5BITS;
+extern volatile IFS5BITS IFS5bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IEC0 __attribute__((__sfr__));
+typedef struct tagIEC0BITS {
+  unsigned INT0IE:1;
+  unsigned IC1IE:1;
+  unsigned OC1IE:1;
+  unsigned T1IE:1;
+  unsigned :1;
+  unsigned IC2IE:1;
+  unsigned OC2IE:1;
+  unsigned T2IE:1;
+  unsigned T3IE:1;
+  unsigned SPF1IE:1;
+  unsigned SPI1IE:1;
+  unsigned U1RXIE:1;
+  unsigned U1TXIE:1;
+  unsigned AD1IE:1;
+} IEC0BITS;
+extern volatile IEC0BITS IEC0bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IEC1 __attribute__((__sfr__));
+typedef struct tagIEC1BITS {
+  unsigned SI2C1IE:1;
+  unsigned MI2C1IE:1;
+  unsigned CMIE:1;
+  unsigned CNIE:1;
+  unsigned INT1IE:1;
+  unsigned :1;
+  unsigned IC7IE:1;
+  unsigned IC8IE:1;
+  unsigned :1;
+  unsigned OC3IE:1;
+  unsigned OC4IE:1;
+  unsigned T4IE:1;
+  unsigned T5IE:1;
+  unsigned INT2IE:1;
+  unsigned U2RXIE:1;
+  unsigned U2TXIE:1;
+} IEC1BITS;
+extern volatile IEC1BITS IEC1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IEC2 __attribute__((__sfr__));
+typedef struct tagIEC2BITS {
+  unsigned SPF2IE:1;
+  unsigned SPI2IE:1;
+  unsigned :3;
+  unsigned IC3IE:1;
+  unsigned IC4IE:1;
+  unsigned IC5IE:1;
+  unsigned IC6IE:1;
+  unsigned OC5IE:1;
+  unsigned OC6IE:1;
+  unsigned OC7IE:1;
+  unsigned OC8IE:1;
+  unsigned PMPIE:1;
+} IEC2BITS;
+extern volatile IEC2BITS IEC2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IEC3 __attribute__((__sfr__));
+typedef struct tagIEC3BITS {
+  unsigned :1;
+  unsigned SI2C2IE:1;
+  unsigned MI2C2IE:1;
+  unsigned :2;
+  unsigned INT3IE:1;
+  unsigned INT4IE:1;
+  unsigned :7;
+  unsigned RTCIE:1;
+} IEC3BITS;
+extern volatile IEC3BITS IEC3bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IEC4 __attribute__((__sfr__));
+typedef struct tagIEC4BITS {
+  unsigned :1;
+  unsigned U1ERIE:1;
+  unsigned U2ERIE:1;
+  unsigned CRCIE:1;
+  unsigned :4;
+  unsigned LVDIE:1;
+  unsigned :4;
+  unsigned CTMUIE:1;
+} IEC4BITS;
+extern volatile IEC4BITS IEC4bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IEC5 __attribute__((__sfr__));
+typedef struct tagIEC5BITS {
+  unsigned :1;
+  unsigned U3ERIE:1;
+  unsigned U3RXIE:1;
+  unsigned U3TXIE:1;
+  unsigned SI2C3IE:1;
+  unsigned MI2C3IE:1;
+  unsigned USB1IE:1;
+  unsigned U4ERIE:1;
+  unsigned U4RXIE:1;
+  unsigned U4TXIE:1;
+  unsigned SPF3IE:1;
+  unsigned SPI3IE:1;
+  unsigned OC9IE:1;
+  unsigned IC9IE:1;
+} IEC5BITS;
+extern volatile IEC5BITS IEC5bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC0 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC0BITS {
+  union {
+    struct {
+      unsigned INT0IP0:1;
+      unsigned INT0IP1:1;
+      unsigned INT0IP2:1;
+      unsigned :1;
+      unsigned IC1IP0:1;
+      unsigned IC1IP1:1;
+      unsigned IC1IP2:1;
+      unsigned :1;
+      unsigned OC1IP0:1;
+      unsigned OC1IP1:1;
+      unsigned OC1IP2:1;
+      unsigned :1;
+      unsigned T1IP0:1;
+      unsigned T1IP1:1;
+      unsigned T1IP2:1;
+    };
+    struct {
+      unsigned INT0IP:3;
+      unsigned :1;
+      unsigned IC1IP:3;
+      unsigned :1;
+      unsigned OC1IP:3;
+      unsigned :1;
+      unsigned T1IP:3;
+    };
+  };
+} IPC0BITS;
+extern volatile IPC0BITS IPC0bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC1 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC1BITS {
+  union {
+    struct {
+      unsigned :4;
+      unsigned IC2IP0:1;
+      unsigned IC2IP1:1;
+      unsigned IC2IP2:1;
+      unsigned :1;
+      unsigned OC2IP0:1;
+      unsigned OC2IP1:1;
+      unsigned OC2IP2:1;
+      unsigned :1;
+      unsigned T2IP0:1;
+      unsigned T2IP1:1;
+      unsigned T2IP2:1;
+    };
+    struct {
+      unsigned :4;
+      unsigned IC2IP:3;
+      unsigned :1;
+      unsigned OC2IP:3;
+      unsigned :1;
+      unsigned T2IP:3;
+    };
+  };
+} IPC1BITS;
+extern volatile IPC1BITS IPC1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC2 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC2BITS {
+  union {
+    struct {
+      unsigned T3IP0:1;
+      unsigned T3IP1:1;
+      unsigned T3IP2:1;
+      unsigned :1;
+      unsigned SPF1IP0:1;
+      unsigned SPF1IP1:1;
+      unsigned SPF1IP2:1;
+      unsigned :1;
+      unsigned SPI1IP0:1;
+      unsigned SPI1IP1:1;
+      unsigned SPI1IP2:1;
+      unsigned :1;
+      unsigned U1RXIP0:1;
+      unsigned U1RXIP1:1;
+      unsigned U1RXIP2:1;
+    };
+    struct {
+      unsigned T3IP:3;
+      unsigned :1;
+      unsigned SPF1IP:3;
+      unsigned :1;
+      unsigned SPI1IP:3;
+      unsigned :1;
+      unsigned U1RXIP:3;
+    };
+  };
+} IPC2BITS;
+extern volatile IPC2BITS IPC2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC3 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC3BITS {
+  union {
+    struct {
+      unsigned U1TXIP0:1;
+      unsigned U1TXIP1:1;
+      unsigned U1TXIP2:1;
+      unsigned :1;
+      unsigned AD1IP0:1;
+      unsigned AD1IP1:1;
+      unsigned AD1IP2:1;
+    };
+    struct {
+      unsigned U1TXIP:3;
+      unsigned :1;
+      unsigned AD1IP:3;
+    };
+  };
+} IPC3BITS;
+extern volatile IPC3BITS IPC3bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC4 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC4BITS {
+  union {
+    struct {
+      unsigned SI2C1IP0:1;
+      unsigned SI2C1IP1:1;
+      unsigned SI2C1IP2:1;
+      unsigned :1;
+      unsigned MI2C1IP0:1;
+      unsigned MI2C1IP1:1;
+      unsigned MI2C1IP2:1;
+      unsigned :1;
+      unsigned CMIP0:1;
+      unsigned CMIP1:1;
+      unsigned CMIP2:1;
+      unsigned :1;
+      unsigned CNIP0:1;
+      unsigned CNIP1:1;
+      unsigned CNIP2:1;
+    };
+    struct {
+      unsigned SI2C1IP:3;
+      unsigned :1;
+      unsigned MI2C1IP:3;
+      unsigned :1;
+      unsigned CMIP:3;
+      unsigned :1;
+      unsigned CNIP:3;
+    };
+    struct {
+      unsigned SI2C1P0:1;
+      unsigned SI2C1P1:1;
+      unsigned SI2C1P2:1;
+      unsigned :1;
+      unsigned MI2C1P0:1;
+      unsigned MI2C1P1:1;
+      unsigned MI2C1P2:1;
+    };
+    struct {
+      unsigned SI2C1P:3;
+      unsigned :1;
+      unsigned MI2C1P:3;
+    };
+  };
+} IPC4BITS;
+extern volatile IPC4BITS IPC4bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC5 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC5BITS {
+  union {
+    struct {
+      unsigned INT1IP0:1;
+      unsigned INT1IP1:1;
+      unsigned INT1IP2:1;
+      unsigned :5;
+      unsigned IC7IP0:1;
+      unsigned IC7IP1:1;
+      unsigned IC7IP2:1;
+      unsigned :1;
+      unsigned IC8IP0:1;
+      unsigned IC8IP1:1;
+      unsigned IC8IP2:1;
+    };
+    struct {
+      unsigned INT1IP:3;
+      unsigned :5;
+      unsigned IC7IP:3;
+      unsigned :1;
+      unsigned IC8IP:3;
+    };
+  };
+} IPC5BITS;
+extern volatile IPC5BITS IPC5bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC6 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC6BITS {
+  union {
+    struct {
+      unsigned :4;
+      unsigned OC3IP0:1;
+      unsigned OC3IP1:1;
+      unsigned OC3IP2:1;
+      unsigned :1;
+      unsigned OC4IP0:1;
+      unsigned OC4IP1:1;
+      unsigned OC4IP2:1;
+      unsigned :1;
+      unsigned T4IP0:1;
+      unsigned T4IP1:1;
+      unsigned T4IP2:1;
+    };
+    struct {
+      unsigned :4;
+      unsigned OC3IP:3;
+      unsigned :1;
+      unsigned OC4IP:3;
+      unsigned :1;
+      unsigned T4IP:3;
+    };
+  };
+} IPC6BITS;
+extern volatile IPC6BITS IPC6bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC7 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC7BITS {
+  union {
+    struct {
+      unsigned T5IP0:1;
+      unsigned T5IP1:1;
+      unsigned T5IP2:1;
+      unsigned :1;
+      unsigned INT2IP0:1;
+      unsigned INT2IP1:1;
+      unsigned INT2IP2:1;
+      unsigned :1;
+      unsigned U2RXIP0:1;
+      unsigned U2RXIP1:1;
+      unsigned U2RXIP2:1;
+      unsigned :1;
+      unsigned U2TXIP0:1;
+      unsigned U2TXIP1:1;
+      unsigned U2TXIP2:1;
+    };
+    struct {
+      unsigned T5IP:3;
+      unsigned :1;
+      unsigned INT2IP:3;
+      unsigned :1;
+      unsigned U2RXIP:3;
+      unsigned :1;
+      unsigned U2TXIP:3;
+    };
+  };
+} IPC7BITS;
+extern volatile IPC7BITS IPC7bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC8 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC8BITS {
+  union {
+    struct {
+      unsigned SPF2IP0:1;
+      unsigned SPF2IP1:1;
+      unsigned SPF2IP2:1;
+      unsigned :1;
+      unsigned SPI2IP0:1;
+      unsigned SPI2IP1:1;
+      unsigned SPI2IP2:1;
+    };
+    struct {
+      unsigned SPF2IP:3;
+      unsigned :1;
+      unsigned SPI2IP:3;
+    };
+  };
+} IPC8BITS;
+extern volatile IPC8BITS IPC8bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC9 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC9BITS {
+  union {
+    struct {
+      unsigned :4;
+      unsigned IC3IP0:1;
+      unsigned IC3IP1:1;
+      unsigned IC3IP2:1;
+      unsigned :1;
+      unsigned IC4IP0:1;
+      unsigned IC4IP1:1;
+      unsigned IC4IP2:1;
+      unsigned :1;
+      unsigned IC5IP0:1;
+      unsigned IC5IP1:1;
+      unsigned IC5IP2:1;
+    };
+    struct {
+      unsigned :4;
+      unsigned IC3IP:3;
+      unsigned :1;
+      unsigned IC4IP:3;
+      unsigned :1;
+      unsigned IC5IP:3;
+    };
+  };
+} IPC9BITS;
+extern volatile IPC9BITS IPC9bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC10 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC10BITS {
+  union {
+    struct {
+      unsigned IC6IP0:1;
+      unsigned IC6IP1:1;
+      unsigned IC6IP2:1;
+      unsigned :1;
+      unsigned OC5IP0:1;
+      unsigned OC5IP1:1;
+      unsigned OC5IP2:1;
+      unsigned :1;
+      unsigned OC6IP0:1;
+      unsigned OC6IP1:1;
+      unsigned OC6IP2:1;
+      unsigned :1;
+      unsigned OC7IP0:1;
+      unsigned OC7IP1:1;
+      unsigned OC7IP2:1;
+    };
+    struct {
+      unsigned IC6IP:3;
+      unsigned :1;
+      unsigned OC5IP:3;
+      unsigned :1;
+      unsigned OC6IP:3;
+      unsigned :1;
+      unsigned OC7IP:3;
+    };
+  };
+} IPC10BITS;
+extern volatile IPC10BITS IPC10bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC11 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC11BITS {
+  union {
+    struct {
+      unsigned OC8IP0:1;
+      unsigned OC8IP1:1;
+      unsigned OC8IP2:1;
+      unsigned :1;
+      unsigned PMPIP0:1;
+      unsigned PMPIP1:1;
+      unsigned PMPIP2:1;
+    };
+    struct {
+      unsigned OC8IP:3;
+      unsigned :1;
+      unsigned PMPIP:3;
+    };
+  };
+} IPC11BITS;
+extern volatile IPC11BITS IPC11bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC12 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC12BITS {
+  union {
+    struct {
+      unsigned :4;
+      unsigned SI2C2IP0:1;
+      unsigned SI2C2IP1:1;
+      unsigned SI2C2IP2:1;
+      unsigned :1;
+      unsigned MI2C2IP0:1;
+      unsigned MI2C2IP1:1;
+      unsigned MI2C2IP2:1;
+    };
+    struct {
+      unsigned :4;
+      unsigned SI2C2IP:3;
+      unsigned :1;
+      unsigned MI2C2IP:3;
+    };
+    struct {
+      unsigned :4;
+      unsigned SI2C2P0:1;
+      unsigned SI2C2P1:1;
+      unsigned SI2C2P2:1;
+      unsigned :1;
+      unsigned MI2C2P0:1;
+      unsigned MI2C2P1:1;
+      unsigned MI2C2P2:1;
+    };
+    struct {
+      unsigned :4;
+      unsigned SI2C2P:3;
+      unsigned :1;
+      unsigned MI2C2P:3;
+    };
+  };
+} IPC12BITS;
+extern volatile IPC12BITS IPC12bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC13 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC13BITS {
+  union {
+    struct {
+      unsigned :4;
+      unsigned INT3IP0:1;
+      unsigned INT3IP1:1;
+      unsigned INT3IP2:1;
+      unsigned :1;
+      unsigned INT4IP0:1;
+      unsigned INT4IP1:1;
+      unsigned INT4IP2:1;
+    };
+    struct {
+      unsigned :4;
+      unsigned INT3IP:3;
+      unsigned :1;
+      unsigned INT4IP:3;
+    };
+  };
+} IPC13BITS;
+extern volatile IPC13BITS IPC13bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC15 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC15BITS {
+  union {
+    struct {
+      unsigned :8;
+      unsigned RTCIP0:1;
+      unsigned RTCIP1:1;
+      unsigned RTCIP2:1;
+    };
+    struct {
+      unsigned :8;
+      unsigned RTCIP:3;
+    };
+  };
+} IPC15BITS;
+extern volatile IPC15BITS IPC15bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC16 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC16BITS {
+  union {
+    struct {
+      unsigned :4;
+      unsigned U1ERIP0:1;
+      unsigned U1ERIP1:1;
+      unsigned U1ERIP2:1;
+      unsigned :1;
+      unsigned U2ERIP0:1;
+      unsigned U2ERIP1:1;
+      unsigned U2ERIP2:1;
+      unsigned :1;
+      unsigned CRCIP0:1;
+      unsigned CRCIP1:1;
+      unsigned CRCIP2:1;
+    };
+    struct {
+      unsigned :4;
+      unsigned U1ERIP:3;
+      unsigned :1;
+      unsigned U2ERIP:3;
+      unsigned :1;
+      unsigned CRCIP:3;
+    };
+  };
+} IPC16BITS;
+extern volatile IPC16BITS IPC16bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC18 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC18BITS {
+  union {
+    struct {
+      unsigned LVDIP0:1;
+      unsigned LVDIP1:1;
+      unsigned LVDIP2:1;
+    };
+    struct {
+      unsigned LVDIP:3;
+    };
+  };
+} IPC18BITS;
+extern volatile IPC18BITS IPC18bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC19 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC19BITS {
+  union {
+    struct {
+      unsigned :4;
+      unsigned CTMUIP0:1;
+      unsigned CTMUIP1:1;
+      unsigned CTMUIP2:1;
+    };
+    struct {
+      unsigned :4;
+      unsigned CTMUIP:3;
+    };
+  };
+} IPC19BITS;
+extern volatile IPC19BITS IPC19bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC20 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC20BITS {
+  union {
+    struct {
+      unsigned :4;
+      unsigned U3ERIP0:1;
+      unsigned U3ERIP1:1;
+      unsigned U3ERIP2:1;
+      unsigned :1;
+      unsigned U3RXIP0:1;
+      unsigned U3RXIP1:1;
+      unsigned U3RXIP2:1;
+      unsigned :1;
+      unsigned U3TXIP0:1;
+      unsigned U3TXIP1:1;
+      unsigned U3TXIP2:1;
+    };
+    struct {
+      unsigned :4;
+      unsigned U3ERIP:3;
+      unsigned :1;
+      unsigned U3RXIP:3;
+      unsigned :1;
+      unsigned U3TXIP:3;
+    };
+  };
+} IPC20BITS;
+extern volatile IPC20BITS IPC20bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC21 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC21BITS {
+  union {
+    struct {
+      unsigned SI2C3P0:1;
+      unsigned SI2C3P1:1;
+      unsigned SI2C3P2:1;
+      unsigned :1;
+      unsigned MI2C3P0:1;
+      unsigned MI2C3P1:1;
+      unsigned MI2C3P2:1;
+      unsigned :1;
+      unsigned USB1IP0:1;
+      unsigned USB1IP1:1;
+      unsigned USB1IP2:1;
+      unsigned :1;
+      unsigned U4ERIP0:1;
+      unsigned U4ERIP1:1;
+      unsigned U4ERIP2:1;
+    };
+    struct {
+      unsigned SI2C3P:3;
+      unsigned :1;
+      unsigned MI2C3P:3;
+      unsigned :1;
+      unsigned USB1IP:3;
+      unsigned :1;
+      unsigned U4ERIP:3;
+    };
+  };
+} IPC21BITS;
+extern volatile IPC21BITS IPC21bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC22 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC22BITS {
+  union {
+    struct {
+      unsigned U4RXIP0:1;
+      unsigned U4RXIP1:1;
+      unsigned U4RXIP2:1;
+      unsigned :1;
+      unsigned U4TXIP0:1;
+      unsigned U4TXIP1:1;
+      unsigned U4TXIP2:1;
+      unsigned :1;
+      unsigned SPF3IP0:1;
+      unsigned SPF3IP1:1;
+      unsigned SPF3IP2:1;
+      unsigned :1;
+      unsigned SPI3IP0:1;
+      unsigned SPI3IP1:1;
+      unsigned SPI3IP2:1;
+    };
+    struct {
+      unsigned U4RXIP:3;
+      unsigned :1;
+      unsigned U4TXIP:3;
+      unsigned :1;
+      unsigned SPF3IP:3;
+      unsigned :1;
+      unsigned SPI3IP:3;
+    };
+  };
+} IPC22BITS;
+extern volatile IPC22BITS IPC22bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IPC23 __attribute__((__sfr__));
+__extension__ typedef struct tagIPC23BITS {
+  union {
+    struct {
+      unsigned OC9IP0:1;
+      unsigned OC9IP1:1;
+      unsigned OC9IP2:1;
+      unsigned :1;
+      unsigned IC9IP0:1;
+      unsigned IC9IP1:1;
+      unsigned IC9IP2:1;
+    };
+    struct {
+      unsigned OC9IP:3;
+      unsigned :1;
+      unsigned IC9IP:3;
+    };
+  };
+} IPC23BITS;
+extern volatile IPC23BITS IPC23bits __attribute__((__sfr__));
+
+extern volatile unsigned int  TMR1 __attribute__((__sfr__));
+extern volatile unsigned int  PR1 __attribute__((__sfr__));
+extern volatile unsigned int  T1CON __attribute__((__sfr__));
+__extension__ typedef struct tagT1CONBITS {
+  union {
+    struct {
+      unsigned :1;
+      unsigned TCS:1;
+      unsigned TSYNC:1;
+      unsigned :1;
+      unsigned TCKPS0:1;
+      unsigned TCKPS1:1;
+      unsigned TGATE:1;
+      unsigned :6;
+      unsigned TSIDL:1;
+      unsigned :1;
+      unsigned TON:1;
+    };
+    struct {
+      unsigned :4;
+      unsigned TCKPS:2;
+    };
+  };
+} T1CONBITS;
+extern volatile T1CONBITS T1CONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  TMR2 __attribute__((__sfr__));
+extern volatile unsigned int  TMR3HLD __attribute__((__sfr__));
+extern volatile unsigned int  TMR3 __attribute__((__sfr__));
+extern volatile unsigned int  PR2 __attribute__((__sfr__));
+extern volatile unsigned int  PR3 __attribute__((__sfr__));
+extern volatile unsigned int  T2CON __attribute__((__sfr__));
+__extension__ typedef struct tagT2CONBITS {
+  union {
+    struct {
+      unsigned :1;
+      unsigned TCS:1;
+      unsigned :1;
+      unsigned T32:1;
+      unsigned TCKPS0:1;
+      unsigned TCKPS1:1;
+      unsigned TGATE:1;
+      unsigned :6;
+      unsigned TSIDL:1;
+      unsigned :1;
+      unsigned TON:1;
+    };
+    struct {
+      unsigned :4;
+      unsigned TCKPS:2;
+    };
+  };
+} T2CONBITS;
+extern volatile T2CONBITS T2CONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  T3CON __attribute__((__sfr__));
+__extension__ typedef struct tagT3CONBITS {
+  union {
+    struct {
+      unsigned :1;
+      unsigned TCS:1;
+      unsigned :2;
+      unsigned TCKPS0:1;
+      unsigned TCKPS1:1;
+      unsigned TGATE:1;
+      unsigned :6;
+      unsigned TSIDL:1;
+      unsigned :1;
+      unsigned TON:1;
+    };
+    struct {
+      unsigned :4;
+      unsigned TCKPS:2;
+    };
+  };
+} T3CONBITS;
+extern volatile T3CONBITS T3CONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  TMR4 __attribute__((__sfr__));
+extern volatile unsigned int  TMR5HLD __attribute__((__sfr__));
+extern volatile unsigned int  TMR5 __attribute__((__sfr__));
+extern volatile unsigned int  PR4 __attribute__((__sfr__));
+extern volatile unsigned int  PR5 __attribute__((__sfr__));
+extern volatile unsigned int  T4CON __attribute__((__sfr__));
+__extension__ typedef struct tagT4CONBITS {
+  union {
+    struct {
+      unsigned :1;
+      unsigned TCS:1;
+      unsigned :1;
+      unsigned T32:1;
+      unsigned TCKPS0:1;
+      unsigned TCKPS1:1;
+      unsigned TGATE:1;
+      unsigned :6;
+      unsigned TSIDL:1;
+      unsigned :1;
+      unsigned TON:1;
+    };
+    struct {
+      unsigned :4;
+      unsigned TCKPS:2;
+    };
+  };
+} T4CONBITS;
+extern volatile T4CONBITS T4CONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  T5CON __attribute__((__sfr__));
+__extension__ typedef struct tagT5CONBITS {
+  union {
+    struct {
+      unsigned :1;
+      unsigned TCS:1;
+      unsigned :2;
+      unsigned TCKPS0:1;
+      unsigned TCKPS1:1;
+      unsigned TGATE:1;
+      unsigned :6;
+      unsigned TSIDL:1;
+      unsigned :1;
+      unsigned TON:1;
+    };
+    struct {
+      unsigned :4;
+      unsigned TCKPS:2;
+    };
+  };
+} T5CONBITS;
+extern volatile T5CONBITS T5CONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC1CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagIC1CON1BITS {
+  union {
+    struct {
+      unsigned ICM0:1;
+      unsigned ICM1:1;
+      unsigned ICM2:1;
+      unsigned ICBNE:1;
+      unsigned ICOV:1;
+      unsigned ICI0:1;
+      unsigned ICI1:1;
+      unsigned :3;
+      unsigned ICTSEL0:1;
+      unsigned ICTSEL1:1;
+      unsigned ICTSEL2:1;
+      unsigned ICSIDL:1;
+    };
+    struct {
+      unsigned ICM:3;
+      unsigned :2;
+      unsigned ICI:2;
+      unsigned :3;
+      unsigned ICTSEL:3;
+    };
+  };
+} IC1CON1BITS;
+extern volatile IC1CON1BITS IC1CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC1CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagIC1CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned :1;
+      unsigned TRIGSTAT:1;
+      unsigned ICTRIG:1;
+      unsigned IC32:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+    };
+  };
+} IC1CON2BITS;
+extern volatile IC1CON2BITS IC1CON2bits __attribute__((__sfr__));
+
+
+/* Generic structure of entire SFR area for Input Capture modules */
+typedef struct tagIC {
+        unsigned int icxbuf;
+        unsigned int icxcon;
+} IC, *PIC;
+
+/* SFR blocks for Input Capture modules */
+extern volatile IC IC1 __attribute__((__sfr__));
+extern volatile IC IC2 __attribute__((__sfr__));
+extern volatile IC IC3 __attribute__((__sfr__));
+extern volatile IC IC4 __attribute__((__sfr__));
+extern volatile IC IC5 __attribute__((__sfr__));
+
+extern volatile unsigned int  IC1BUF __attribute__((__sfr__));
+extern volatile unsigned int  IC1TMR __attribute__((__sfr__));
+extern volatile unsigned int  IC2CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagIC2CON1BITS {
+  union {
+    struct {
+      unsigned ICM0:1;
+      unsigned ICM1:1;
+      unsigned ICM2:1;
+      unsigned ICBNE:1;
+      unsigned ICOV:1;
+      unsigned ICI0:1;
+      unsigned ICI1:1;
+      unsigned :3;
+      unsigned ICTSEL0:1;
+      unsigned ICTSEL1:1;
+      unsigned ICTSEL2:1;
+      unsigned ICSIDL:1;
+    };
+    struct {
+      unsigned ICM:3;
+      unsigned :2;
+      unsigned ICI:2;
+      unsigned :3;
+      unsigned ICTSEL:3;
+    };
+  };
+} IC2CON1BITS;
+extern volatile IC2CON1BITS IC2CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC2CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagIC2CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned :1;
+      unsigned TRIGSTAT:1;
+      unsigned ICTRIG:1;
+      unsigned IC32:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+    };
+  };
+} IC2CON2BITS;
+extern volatile IC2CON2BITS IC2CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC2BUF __attribute__((__sfr__));
+extern volatile unsigned int  IC2TMR __attribute__((__sfr__));
+extern volatile unsigned int  IC3CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagIC3CON1BITS {
+  union {
+    struct {
+      unsigned ICM0:1;
+      unsigned ICM1:1;
+      unsigned ICM2:1;
+      unsigned ICBNE:1;
+      unsigned ICOV:1;
+      unsigned ICI0:1;
+      unsigned ICI1:1;
+      unsigned :3;
+      unsigned ICTSEL0:1;
+      unsigned ICTSEL1:1;
+      unsigned ICTSEL2:1;
+      unsigned ICSIDL:1;
+    };
+    struct {
+      unsigned ICM:3;
+      unsigned :2;
+      unsigned ICI:2;
+      unsigned :3;
+      unsigned ICTSEL:3;
+    };
+  };
+} IC3CON1BITS;
+extern volatile IC3CON1BITS IC3CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC3CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagIC3CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned :1;
+      unsigned TRIGSTAT:1;
+      unsigned ICTRIG:1;
+      unsigned IC32:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+    };
+  };
+} IC3CON2BITS;
+extern volatile IC3CON2BITS IC3CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC3BUF __attribute__((__sfr__));
+extern volatile unsigned int  IC3TMR __attribute__((__sfr__));
+extern volatile unsigned int  IC4CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagIC4CON1BITS {
+  union {
+    struct {
+      unsigned ICM0:1;
+      unsigned ICM1:1;
+      unsigned ICM2:1;
+      unsigned ICBNE:1;
+      unsigned ICOV:1;
+      unsigned ICI0:1;
+      unsigned ICI1:1;
+      unsigned :3;
+      unsigned ICTSEL0:1;
+      unsigned ICTSEL1:1;
+      unsigned ICTSEL2:1;
+      unsigned ICSIDL:1;
+    };
+    struct {
+      unsigned ICM:3;
+      unsigned :2;
+      unsigned ICI:2;
+      unsigned :3;
+      unsigned ICTSEL:3;
+    };
+  };
+} IC4CON1BITS;
+extern volatile IC4CON1BITS IC4CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC4CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagIC4CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned :1;
+      unsigned TRIGSTAT:1;
+      unsigned ICTRIG:1;
+      unsigned IC32:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+    };
+  };
+} IC4CON2BITS;
+extern volatile IC4CON2BITS IC4CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC4BUF __attribute__((__sfr__));
+extern volatile unsigned int  IC4TMR __attribute__((__sfr__));
+extern volatile unsigned int  IC5CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagIC5CON1BITS {
+  union {
+    struct {
+      unsigned ICM0:1;
+      unsigned ICM1:1;
+      unsigned ICM2:1;
+      unsigned ICBNE:1;
+      unsigned ICOV:1;
+      unsigned ICI0:1;
+      unsigned ICI1:1;
+      unsigned :3;
+      unsigned ICTSEL0:1;
+      unsigned ICTSEL1:1;
+      unsigned ICTSEL2:1;
+      unsigned ICSIDL:1;
+    };
+    struct {
+      unsigned ICM:3;
+      unsigned :2;
+      unsigned ICI:2;
+      unsigned :3;
+      unsigned ICTSEL:3;
+    };
+  };
+} IC5CON1BITS;
+extern volatile IC5CON1BITS IC5CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC5CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagIC5CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned :1;
+      unsigned TRIGSTAT:1;
+      unsigned ICTRIG:1;
+      unsigned IC32:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+    };
+  };
+} IC5CON2BITS;
+extern volatile IC5CON2BITS IC5CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC5BUF __attribute__((__sfr__));
+extern volatile unsigned int  IC5TMR __attribute__((__sfr__));
+extern volatile unsigned int  IC6CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagIC6CON1BITS {
+  union {
+    struct {
+      unsigned ICM0:1;
+      unsigned ICM1:1;
+      unsigned ICM2:1;
+      unsigned ICBNE:1;
+      unsigned ICOV:1;
+      unsigned ICI0:1;
+      unsigned ICI1:1;
+      unsigned :3;
+      unsigned ICTSEL0:1;
+      unsigned ICTSEL1:1;
+      unsigned ICTSEL2:1;
+      unsigned ICSIDL:1;
+    };
+    struct {
+      unsigned ICM:3;
+      unsigned :2;
+      unsigned ICI:2;
+      unsigned :3;
+      unsigned ICTSEL:3;
+    };
+  };
+} IC6CON1BITS;
+extern volatile IC6CON1BITS IC6CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC6CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagIC6CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned :1;
+      unsigned TRIGSTAT:1;
+      unsigned ICTRIG:1;
+      unsigned IC32:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+    };
+  };
+} IC6CON2BITS;
+extern volatile IC6CON2BITS IC6CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC6BUF __attribute__((__sfr__));
+extern volatile unsigned int  IC6TMR __attribute__((__sfr__));
+extern volatile unsigned int  IC7CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagIC7CON1BITS {
+  union {
+    struct {
+      unsigned ICM0:1;
+      unsigned ICM1:1;
+      unsigned ICM2:1;
+      unsigned ICBNE:1;
+      unsigned ICOV:1;
+      unsigned ICI0:1;
+      unsigned ICI1:1;
+      unsigned :3;
+      unsigned ICTSEL0:1;
+      unsigned ICTSEL1:1;
+      unsigned ICTSEL2:1;
+      unsigned ICSIDL:1;
+    };
+    struct {
+      unsigned ICM:3;
+      unsigned :2;
+      unsigned ICI:2;
+      unsigned :3;
+      unsigned ICTSEL:3;
+    };
+  };
+} IC7CON1BITS;
+extern volatile IC7CON1BITS IC7CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC7CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagIC7CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned :1;
+      unsigned TRIGSTAT:1;
+      unsigned ICTRIG:1;
+      unsigned IC32:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+    };
+  };
+} IC7CON2BITS;
+extern volatile IC7CON2BITS IC7CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC7BUF __attribute__((__sfr__));
+extern volatile unsigned int  IC7TMR __attribute__((__sfr__));
+extern volatile unsigned int  IC8CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagIC8CON1BITS {
+  union {
+    struct {
+      unsigned ICM0:1;
+      unsigned ICM1:1;
+      unsigned ICM2:1;
+      unsigned ICBNE:1;
+      unsigned ICOV:1;
+      unsigned ICI0:1;
+      unsigned ICI1:1;
+      unsigned :3;
+      unsigned ICTSEL0:1;
+      unsigned ICTSEL1:1;
+      unsigned ICTSEL2:1;
+      unsigned ICSIDL:1;
+    };
+    struct {
+      unsigned ICM:3;
+      unsigned :2;
+      unsigned ICI:2;
+      unsigned :3;
+      unsigned ICTSEL:3;
+    };
+  };
+} IC8CON1BITS;
+extern volatile IC8CON1BITS IC8CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC8CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagIC8CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned :1;
+      unsigned TRIGSTAT:1;
+      unsigned ICTRIG:1;
+      unsigned IC32:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+    };
+  };
+} IC8CON2BITS;
+extern volatile IC8CON2BITS IC8CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC8BUF __attribute__((__sfr__));
+extern volatile unsigned int  IC8TMR __attribute__((__sfr__));
+extern volatile unsigned int  IC9CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagIC9CON1BITS {
+  union {
+    struct {
+      unsigned ICM0:1;
+      unsigned ICM1:1;
+      unsigned ICM2:1;
+      unsigned ICBNE:1;
+      unsigned ICOV:1;
+      unsigned ICI0:1;
+      unsigned ICI1:1;
+      unsigned :3;
+      unsigned ICTSEL0:1;
+      unsigned ICTSEL1:1;
+      unsigned ICTSEL2:1;
+      unsigned ICSIDL:1;
+    };
+    struct {
+      unsigned ICM:3;
+      unsigned :2;
+      unsigned ICI:2;
+      unsigned :3;
+      unsigned ICTSEL:3;
+    };
+  };
+} IC9CON1BITS;
+extern volatile IC9CON1BITS IC9CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC9CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagIC9CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned :1;
+      unsigned TRIGSTAT:1;
+      unsigned ICTRIG:1;
+      unsigned IC32:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+    };
+  };
+} IC9CON2BITS;
+extern volatile IC9CON2BITS IC9CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  IC9BUF __attribute__((__sfr__));
+extern volatile unsigned int  IC9TMR __attribute__((__sfr__));
+extern volatile unsigned int  OC1CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagOC1CON1BITS {
+  union {
+    struct {
+      unsigned OCM0:1;
+      unsigned OCM1:1;
+      unsigned OCM2:1;
+      unsigned TRIGMODE:1;
+      unsigned OCFLT0:1;
+      unsigned :2;
+      unsigned ENFLT0:1;
+      unsigned :2;
+      unsigned OCTSEL0:1;
+      unsigned OCTSEL1:1;
+      unsigned OCTSEL2:1;
+      unsigned OCSIDL:1;
+    };
+    struct {
+      unsigned OCM:3;
+      unsigned :1;
+      unsigned OCFLT:1;
+      unsigned :2;
+      unsigned ENFLT:1;
+      unsigned :2;
+      unsigned OCTSEL:3;
+    };
+  };
+} OC1CON1BITS;
+extern volatile OC1CON1BITS OC1CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC1CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagOC1CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned OCTRIS:1;
+      unsigned TRIGSTAT:1;
+      unsigned OCTRIG:1;
+      unsigned OC32:1;
+      unsigned :3;
+      unsigned OCINV:1;
+      unsigned FLTTRIEN:1;
+      unsigned FLTOUT:1;
+      unsigned FLTMODE:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+      unsigned :10;
+      unsigned FLTMD:1;
+    };
+  };
+} OC1CON2BITS;
+extern volatile OC1CON2BITS OC1CON2bits __attribute__((__sfr__));
+
+
+/* Generic structure of entire SFR area for Output Compare modules */
+typedef struct tagOC {
+        unsigned int ocxrs;
+        unsigned int ocxr;
+        unsigned int ocxcon;
+} OC, *POC;
+
+/* SFR blocks for Output Compare modules */
+extern volatile OC OC1 __attribute__((__sfr__));
+extern volatile OC OC2 __attribute__((__sfr__));
+extern volatile OC OC3 __attribute__((__sfr__));
+extern volatile OC OC4 __attribute__((__sfr__));
+extern volatile OC OC5 __attribute__((__sfr__));
+
+extern volatile unsigned int  OC1RS __attribute__((__sfr__));
+extern volatile unsigned int  OC1R __attribute__((__sfr__));
+extern volatile unsigned int  OC1TMR __attribute__((__sfr__));
+extern volatile unsigned int  OC2CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagOC2CON1BITS {
+  union {
+    struct {
+      unsigned OCM0:1;
+      unsigned OCM1:1;
+      unsigned OCM2:1;
+      unsigned TRIGMODE:1;
+      unsigned OCFLT0:1;
+      unsigned :2;
+      unsigned ENFLT0:1;
+      unsigned :2;
+      unsigned OCTSEL0:1;
+      unsigned OCTSEL1:1;
+      unsigned OCTSEL2:1;
+      unsigned OCSIDL:1;
+    };
+    struct {
+      unsigned OCM:3;
+      unsigned :1;
+      unsigned OCFLT:1;
+      unsigned :2;
+      unsigned ENFLT:1;
+      unsigned :2;
+      unsigned OCTSEL:3;
+    };
+  };
+} OC2CON1BITS;
+extern volatile OC2CON1BITS OC2CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC2CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagOC2CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned OCTRIS:1;
+      unsigned TRIGSTAT:1;
+      unsigned OCTRIG:1;
+      unsigned OC32:1;
+      unsigned :3;
+      unsigned OCINV:1;
+      unsigned FLTTRIEN:1;
+      unsigned FLTOUT:1;
+      unsigned FLTMODE:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+      unsigned :10;
+      unsigned FLTMD:1;
+    };
+  };
+} OC2CON2BITS;
+extern volatile OC2CON2BITS OC2CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC2RS __attribute__((__sfr__));
+extern volatile unsigned int  OC2R __attribute__((__sfr__));
+extern volatile unsigned int  OC2TMR __attribute__((__sfr__));
+extern volatile unsigned int  OC3CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagOC3CON1BITS {
+  union {
+    struct {
+      unsigned OCM0:1;
+      unsigned OCM1:1;
+      unsigned OCM2:1;
+      unsigned TRIGMODE:1;
+      unsigned OCFLT0:1;
+      unsigned :2;
+      unsigned ENFLT0:1;
+      unsigned :2;
+      unsigned OCTSEL0:1;
+      unsigned OCTSEL1:1;
+      unsigned OCTSEL2:1;
+      unsigned OCSIDL:1;
+    };
+    struct {
+      unsigned OCM:3;
+      unsigned :1;
+      unsigned OCFLT:1;
+      unsigned :2;
+      unsigned ENFLT:1;
+      unsigned :2;
+      unsigned OCTSEL:3;
+    };
+  };
+} OC3CON1BITS;
+extern volatile OC3CON1BITS OC3CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC3CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagOC3CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned OCTRIS:1;
+      unsigned TRIGSTAT:1;
+      unsigned OCTRIG:1;
+      unsigned OC32:1;
+      unsigned :3;
+      unsigned OCINV:1;
+      unsigned FLTTRIEN:1;
+      unsigned FLTOUT:1;
+      unsigned FLTMODE:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+      unsigned :10;
+      unsigned FLTMD:1;
+    };
+  };
+} OC3CON2BITS;
+extern volatile OC3CON2BITS OC3CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC3RS __attribute__((__sfr__));
+extern volatile unsigned int  OC3R __attribute__((__sfr__));
+extern volatile unsigned int  OC3TMR __attribute__((__sfr__));
+extern volatile unsigned int  OC4CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagOC4CON1BITS {
+  union {
+    struct {
+      unsigned OCM0:1;
+      unsigned OCM1:1;
+      unsigned OCM2:1;
+      unsigned TRIGMODE:1;
+      unsigned OCFLT0:1;
+      unsigned :2;
+      unsigned ENFLT0:1;
+      unsigned :2;
+      unsigned OCTSEL0:1;
+      unsigned OCTSEL1:1;
+      unsigned OCTSEL2:1;
+      unsigned OCSIDL:1;
+    };
+    struct {
+      unsigned OCM:3;
+      unsigned :1;
+      unsigned OCFLT:1;
+      unsigned :2;
+      unsigned ENFLT:1;
+      unsigned :2;
+      unsigned OCTSEL:3;
+    };
+  };
+} OC4CON1BITS;
+extern volatile OC4CON1BITS OC4CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC4CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagOC4CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned OCTRIS:1;
+      unsigned TRIGSTAT:1;
+      unsigned OCTRIG:1;
+      unsigned OC32:1;
+      unsigned :3;
+      unsigned OCINV:1;
+      unsigned FLTTRIEN:1;
+      unsigned FLTOUT:1;
+      unsigned FLTMODE:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+      unsigned :10;
+      unsigned FLTMD:1;
+    };
+  };
+} OC4CON2BITS;
+extern volatile OC4CON2BITS OC4CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC4RS __attribute__((__sfr__));
+extern volatile unsigned int  OC4R __attribute__((__sfr__));
+extern volatile unsigned int  OC4TMR __attribute__((__sfr__));
+extern volatile unsigned int  OC5CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagOC5CON1BITS {
+  union {
+    struct {
+      unsigned OCM0:1;
+      unsigned OCM1:1;
+      unsigned OCM2:1;
+      unsigned TRIGMODE:1;
+      unsigned OCFLT0:1;
+      unsigned :2;
+      unsigned ENFLT0:1;
+      unsigned :2;
+      unsigned OCTSEL0:1;
+      unsigned OCTSEL1:1;
+      unsigned OCTSEL2:1;
+      unsigned OCSIDL:1;
+    };
+    struct {
+      unsigned OCM:3;
+      unsigned :1;
+      unsigned OCFLT:1;
+      unsigned :2;
+      unsigned ENFLT:1;
+      unsigned :2;
+      unsigned OCTSEL:3;
+    };
+  };
+} OC5CON1BITS;
+extern volatile OC5CON1BITS OC5CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC5CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagOC5CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned OCTRIS:1;
+      unsigned TRIGSTAT:1;
+      unsigned OCTRIG:1;
+      unsigned OC32:1;
+      unsigned :3;
+      unsigned OCINV:1;
+      unsigned FLTTRIEN:1;
+      unsigned FLTOUT:1;
+      unsigned FLTMODE:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+      unsigned :10;
+      unsigned FLTMD:1;
+    };
+  };
+} OC5CON2BITS;
+extern volatile OC5CON2BITS OC5CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC5RS __attribute__((__sfr__));
+extern volatile unsigned int  OC5R __attribute__((__sfr__));
+extern volatile unsigned int  OC5TMR __attribute__((__sfr__));
+extern volatile unsigned int  OC6CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagOC6CON1BITS {
+  union {
+    struct {
+      unsigned OCM0:1;
+      unsigned OCM1:1;
+      unsigned OCM2:1;
+      unsigned TRIGMODE:1;
+      unsigned OCFLT0:1;
+      unsigned :2;
+      unsigned ENFLT0:1;
+      unsigned :2;
+      unsigned OCTSEL0:1;
+      unsigned OCTSEL1:1;
+      unsigned OCTSEL2:1;
+      unsigned OCSIDL:1;
+    };
+    struct {
+      unsigned OCM:3;
+      unsigned :1;
+      unsigned OCFLT:1;
+      unsigned :2;
+      unsigned ENFLT:1;
+      unsigned :2;
+      unsigned OCTSEL:3;
+    };
+  };
+} OC6CON1BITS;
+extern volatile OC6CON1BITS OC6CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC6CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagOC6CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned OCTRIS:1;
+      unsigned TRIGSTAT:1;
+      unsigned OCTRIG:1;
+      unsigned OC32:1;
+      unsigned :3;
+      unsigned OCINV:1;
+      unsigned FLTTRIEN:1;
+      unsigned FLTOUT:1;
+      unsigned FLTMODE:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+      unsigned :10;
+      unsigned FLTMD:1;
+    };
+  };
+} OC6CON2BITS;
+extern volatile OC6CON2BITS OC6CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC6RS __attribute__((__sfr__));
+extern volatile unsigned int  OC6R __attribute__((__sfr__));
+extern volatile unsigned int  OC6TMR __attribute__((__sfr__));
+extern volatile unsigned int  OC7CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagOC7CON1BITS {
+  union {
+    struct {
+      unsigned OCM0:1;
+      unsigned OCM1:1;
+      unsigned OCM2:1;
+      unsigned TRIGMODE:1;
+      unsigned OCFLT0:1;
+      unsigned :2;
+      unsigned ENFLT0:1;
+      unsigned :2;
+      unsigned OCTSEL0:1;
+      unsigned OCTSEL1:1;
+      unsigned OCTSEL2:1;
+      unsigned OCSIDL:1;
+    };
+    struct {
+      unsigned OCM:3;
+      unsigned :1;
+      unsigned OCFLT:1;
+      unsigned :2;
+      unsigned ENFLT:1;
+      unsigned :2;
+      unsigned OCTSEL:3;
+    };
+  };
+} OC7CON1BITS;
+extern volatile OC7CON1BITS OC7CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC7CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagOC7CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned OCTRIS:1;
+      unsigned TRIGSTAT:1;
+      unsigned OCTRIG:1;
+      unsigned OC32:1;
+      unsigned :3;
+      unsigned OCINV:1;
+      unsigned FLTTRIEN:1;
+      unsigned FLTOUT:1;
+      unsigned FLTMODE:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+      unsigned :10;
+      unsigned FLTMD:1;
+    };
+  };
+} OC7CON2BITS;
+extern volatile OC7CON2BITS OC7CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC7RS __attribute__((__sfr__));
+extern volatile unsigned int  OC7R __attribute__((__sfr__));
+extern volatile unsigned int  OC7TMR __attribute__((__sfr__));
+extern volatile unsigned int  OC8CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagOC8CON1BITS {
+  union {
+    struct {
+      unsigned OCM0:1;
+      unsigned OCM1:1;
+      unsigned OCM2:1;
+      unsigned TRIGMODE:1;
+      unsigned OCFLT0:1;
+      unsigned :2;
+      unsigned ENFLT0:1;
+      unsigned :2;
+      unsigned OCTSEL0:1;
+      unsigned OCTSEL1:1;
+      unsigned OCTSEL2:1;
+      unsigned OCSIDL:1;
+    };
+    struct {
+      unsigned OCM:3;
+      unsigned :1;
+      unsigned OCFLT:1;
+      unsigned :2;
+      unsigned ENFLT:1;
+      unsigned :2;
+      unsigned OCTSEL:3;
+    };
+  };
+} OC8CON1BITS;
+extern volatile OC8CON1BITS OC8CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC8CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagOC8CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned OCTRIS:1;
+      unsigned TRIGSTAT:1;
+      unsigned OCTRIG:1;
+      unsigned OC32:1;
+      unsigned :3;
+      unsigned OCINV:1;
+      unsigned FLTTRIEN:1;
+      unsigned FLTOUT:1;
+      unsigned FLTMODE:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+      unsigned :10;
+      unsigned FLTMD:1;
+    };
+  };
+} OC8CON2BITS;
+extern volatile OC8CON2BITS OC8CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC8RS __attribute__((__sfr__));
+extern volatile unsigned int  OC8R __attribute__((__sfr__));
+extern volatile unsigned int  OC8TMR __attribute__((__sfr__));
+extern volatile unsigned int  OC9CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagOC9CON1BITS {
+  union {
+    struct {
+      unsigned OCM0:1;
+      unsigned OCM1:1;
+      unsigned OCM2:1;
+      unsigned TRIGMODE:1;
+      unsigned OCFLT0:1;
+      unsigned :2;
+      unsigned ENFLT0:1;
+      unsigned :2;
+      unsigned OCTSEL0:1;
+      unsigned OCTSEL1:1;
+      unsigned OCTSEL2:1;
+      unsigned OCSIDL:1;
+    };
+    struct {
+      unsigned OCM:3;
+      unsigned :1;
+      unsigned OCFLT:1;
+      unsigned :2;
+      unsigned ENFLT:1;
+      unsigned :2;
+      unsigned OCTSEL:3;
+    };
+  };
+} OC9CON1BITS;
+extern volatile OC9CON1BITS OC9CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC9CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagOC9CON2BITS {
+  union {
+    struct {
+      unsigned SYNCSEL0:1;
+      unsigned SYNCSEL1:1;
+      unsigned SYNCSEL2:1;
+      unsigned SYNCSEL3:1;
+      unsigned SYNCSEL4:1;
+      unsigned OCTRIS:1;
+      unsigned TRIGSTAT:1;
+      unsigned OCTRIG:1;
+      unsigned OC32:1;
+      unsigned :3;
+      unsigned OCINV:1;
+      unsigned FLTTRIEN:1;
+      unsigned FLTOUT:1;
+      unsigned FLTMODE:1;
+    };
+    struct {
+      unsigned SYNCSEL:5;
+      unsigned :10;
+      unsigned FLTMD:1;
+    };
+  };
+} OC9CON2BITS;
+extern volatile OC9CON2BITS OC9CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  OC9RS __attribute__((__sfr__));
+extern volatile unsigned int  OC9R __attribute__((__sfr__));
+extern volatile unsigned int  OC9TMR __attribute__((__sfr__));
+extern volatile unsigned int  I2C1RCV __attribute__((__sfr__));
+extern volatile unsigned int  I2C1TRN __attribute__((__sfr__));
+extern volatile unsigned int  I2C1BRG __attribute__((__sfr__));
+extern volatile unsigned int  I2C1CON __attribute__((__sfr__));
+typedef struct tagI2C1CONBITS {
+  unsigned SEN:1;
+  unsigned RSEN:1;
+  unsigned PEN:1;
+  unsigned RCEN:1;
+  unsigned ACKEN:1;
+  unsigned ACKDT:1;
+  unsigned STREN:1;
+  unsigned GCEN:1;
+  unsigned SMEN:1;
+  unsigned DISSLW:1;
+  unsigned A10M:1;
+  unsigned IPMIEN:1;
+  unsigned SCLREL:1;
+  unsigned I2CSIDL:1;
+  unsigned :1;
+  unsigned I2CEN:1;
+} I2C1CONBITS;
+extern volatile I2C1CONBITS I2C1CONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  I2C1STAT __attribute__((__sfr__));
+typedef struct tagI2C1STATBITS {
+  unsigned TBF:1;
+  unsigned RBF:1;
+  unsigned R_W:1;
+  unsigned S:1;
+  unsigned P:1;
+  unsigned D_A:1;
+  unsigned I2COV:1;
+  unsigned IWCOL:1;
+  unsigned ADD10:1;
+  unsigned GCSTAT:1;
+  unsigned BCL:1;
+  unsigned :3;
+  unsigned TRSTAT:1;
+  unsigned ACKSTAT:1;
+} I2C1STATBITS;
+extern volatile I2C1STATBITS I2C1STATbits __attribute__((__sfr__));
+
+extern volatile unsigned int  I2C1ADD __attribute__((__sfr__));
+extern volatile unsigned int  I2C1MSK __attribute__((__sfr__));
+extern volatile unsigned int  I2C2RCV __attribute__((__sfr__));
+extern volatile unsigned int  I2C2TRN __attribute__((__sfr__));
+extern volatile unsigned int  I2C2BRG __attribute__((__sfr__));
+extern volatile unsigned int  I2C2CON __attribute__((__sfr__));
+typedef struct tagI2C2CONBITS {
+  unsigned SEN:1;
+  unsigned RSEN:1;
+  unsigned PEN:1;
+  unsigned RCEN:1;
+  unsigned ACKEN:1;
+  unsigned ACKDT:1;
+  unsigned STREN:1;
+  unsigned GCEN:1;
+  unsigned SMEN:1;
+  unsigned DISSLW:1;
+  unsigned A10M:1;
+  unsigned IPMIEN:1;
+  unsigned SCLREL:1;
+  unsigned I2CSIDL:1;
+  unsigned :1;
+  unsigned I2CEN:1;
+} I2C2CONBITS;
+extern volatile I2C2CONBITS I2C2CONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  I2C2STAT __attribute__((__sfr__));
+typedef struct tagI2C2STATBITS {
+  unsigned TBF:1;
+  unsigned RBF:1;
+  unsigned R_W:1;
+  unsigned S:1;
+  unsigned P:1;
+  unsigned D_A:1;
+  unsigned I2COV:1;
+  unsigned IWCOL:1;
+  unsigned ADD10:1;
+  unsigned GCSTAT:1;
+  unsigned BCL:1;
+  unsigned :3;
+  unsigned TRSTAT:1;
+  unsigned ACKSTAT:1;
+} I2C2STATBITS;
+extern volatile I2C2STATBITS I2C2STATbits __attribute__((__sfr__));
+
+extern volatile unsigned int  I2C2ADD __attribute__((__sfr__));
+extern volatile unsigned int  I2C2MSK __attribute__((__sfr__));
+
+/* Generic structure of entire SFR area for each UART module */
+typedef struct tagUART {
+        unsigned int uxmode;
+        unsigned int uxsta;
+        unsigned int uxtxreg;
+        unsigned int uxrxreg;
+        unsigned int uxbrg;
+} UART, *PUART;
+
+#define UxMODEBITS U1MODEBITS
+#define UxSTABITS U1STABITS
+#define UxTXREGBITS U1TXREGBITS
+#define UxRXREGBITS U1RXREGBITS
+#define UxBRGBITS U1BRGBITS
+
+/* SFR blocks for each UART module */
+extern volatile UART UART1 __attribute__((__sfr__));
+extern volatile UART UART2 __attribute__((__sfr__));
+
+extern volatile unsigned int  U1MODE __attribute__((__sfr__));
+__extension__ typedef struct tagU1MODEBITS {
+  union {
+    struct {
+      unsigned STSEL:1;
+      unsigned PDSEL0:1;
+      unsigned PDSEL1:1;
+      unsigned BRGH:1;
+      unsigned RXINV:1;
+      unsigned ABAUD:1;
+      unsigned LPBACK:1;
+      unsigned WAKE:1;
+      unsigned UEN0:1;
+      unsigned UEN1:1;
+      unsigned :1;
+      unsigned RTSMD:1;
+      unsigned IREN:1;
+      unsigned USIDL:1;
+      unsigned :1;
+      unsigned UARTEN:1;
+    };
+    struct {
+      unsigned :1;
+      unsigned PDSEL:2;
+      unsigned :5;
+      unsigned UEN:2;
+    };
+  };
+} U1MODEBITS;
+extern volatile U1MODEBITS U1MODEbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1STA __attribute__((__sfr__));
+__extension__ typedef struct tagU1STABITS {
+  union {
+    struct {
+      unsigned URXDA:1;
+      unsigned OERR:1;
+      unsigned FERR:1;
+      unsigned PERR:1;
+      unsigned RIDLE:1;
+      unsigned ADDEN:1;
+      unsigned URXISEL0:1;
+      unsigned URXISEL1:1;
+      unsigned TRMT:1;
+      unsigned UTXBF:1;
+      unsigned UTXEN:1;
+      unsigned UTXBRK:1;
+      unsigned :1;
+      unsigned UTXISEL0:1;
+      unsigned UTXINV:1;
+      unsigned UTXISEL1:1;
+    };
+    struct {
+      unsigned :6;
+      unsigned URXISEL:2;
+    };
+  };
+} U1STABITS;
+extern volatile U1STABITS U1STAbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1TXREG __attribute__((__sfr__));
+extern volatile unsigned int  U1RXREG __attribute__((__sfr__));
+extern volatile unsigned int  U1BRG __attribute__((__sfr__));
+extern volatile unsigned int  U2MODE __attribute__((__sfr__));
+__extension__ typedef struct tagU2MODEBITS {
+  union {
+    struct {
+      unsigned STSEL:1;
+      unsigned PDSEL0:1;
+      unsigned PDSEL1:1;
+      unsigned BRGH:1;
+      unsigned RXINV:1;
+      unsigned ABAUD:1;
+      unsigned LPBACK:1;
+      unsigned WAKE:1;
+      unsigned UEN0:1;
+      unsigned UEN1:1;
+      unsigned :1;
+      unsigned RTSMD:1;
+      unsigned IREN:1;
+      unsigned USIDL:1;
+      unsigned :1;
+      unsigned UARTEN:1;
+    };
+    struct {
+      unsigned :1;
+      unsigned PDSEL:2;
+      unsigned :5;
+      unsigned UEN:2;
+    };
+  };
+} U2MODEBITS;
+extern volatile U2MODEBITS U2MODEbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U2STA __attribute__((__sfr__));
+__extension__ typedef struct tagU2STABITS {
+  union {
+    struct {
+      unsigned URXDA:1;
+      unsigned OERR:1;
+      unsigned FERR:1;
+      unsigned PERR:1;
+      unsigned RIDLE:1;
+      unsigned ADDEN:1;
+      unsigned URXISEL0:1;
+      unsigned URXISEL1:1;
+      unsigned TRMT:1;
+      unsigned UTXBF:1;
+      unsigned UTXEN:1;
+      unsigned UTXBRK:1;
+      unsigned :1;
+      unsigned UTXISEL0:1;
+      unsigned UTXINV:1;
+      unsigned UTXISEL1:1;
+    };
+    struct {
+      unsigned :6;
+      unsigned URXISEL:2;
+    };
+  };
+} U2STABITS;
+extern volatile U2STABITS U2STAbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U2TXREG __attribute__((__sfr__));
+extern volatile unsigned int  U2RXREG __attribute__((__sfr__));
+extern volatile unsigned int  U2BRG __attribute__((__sfr__));
+
+/* Generic structure of entire SFR area for each SPI module */
+typedef struct tagSPI {
+        unsigned int spixstat;
+        unsigned int spixcon1;
+        unsigned int spixcon2;
+        unsigned int spixbuf;
+} SPI, *PSPI;
+
+#define SPIxSTATBITS SPI1STATBITS
+#define SPIxCONBITS SPI1CONBITS
+
+/* SFR blocks for each SPI module */
+extern volatile SPI SPI1 __attribute__((__sfr__));
+extern volatile SPI SPI2 __attribute__((__sfr__));
+
+extern volatile unsigned int  SPI1STAT __attribute__((__sfr__));
+__extension__ typedef struct tagSPI1STATBITS {
+  union {
+    struct {
+      unsigned SPIRBF:1;
+      unsigned SPITBF:1;
+      unsigned SISEL0:1;
+      unsigned SISEL1:1;
+      unsigned SISEL2:1;
+      unsigned SRXMPT:1;
+      unsigned SPIROV:1;
+      unsigned SRMPT:1;
+      unsigned SPIBEC0:1;
+      unsigned SPIBEC1:1;
+      unsigned SPIBEC2:1;
+      unsigned :2;
+      unsigned SPISIDL:1;
+      unsigned :1;
+      unsigned SPIEN:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned SISEL:3;
+      unsigned :3;
+      unsigned SPIBEC:3;
+    };
+  };
+} SPI1STATBITS;
+extern volatile SPI1STATBITS SPI1STATbits __attribute__((__sfr__));
+
+extern volatile unsigned int  SPI1CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagSPI1CON1BITS {
+  union {
+    struct {
+      unsigned PPRE0:1;
+      unsigned PPRE1:1;
+      unsigned SPRE0:1;
+      unsigned SPRE1:1;
+      unsigned SPRE2:1;
+      unsigned MSTEN:1;
+      unsigned CKP:1;
+      unsigned SSEN:1;
+      unsigned CKE:1;
+      unsigned SMP:1;
+      unsigned MODE16:1;
+      unsigned DISSDO:1;
+      unsigned DISSCK:1;
+    };
+    struct {
+      unsigned PPRE:2;
+      unsigned SPRE:3;
+    };
+  };
+} SPI1CON1BITS;
+extern volatile SPI1CON1BITS SPI1CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  SPI1CON2 __attribute__((__sfr__));
+typedef struct tagSPI1CON2BITS {
+  unsigned SPIBEN:1;
+  unsigned SPIFE:1;
+  unsigned :11;
+  unsigned SPIFPOL:1;
+  unsigned SPIFSD:1;
+  unsigned FRMEN:1;
+} SPI1CON2BITS;
+extern volatile SPI1CON2BITS SPI1CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  SPI1BUF __attribute__((__sfr__));
+extern volatile unsigned int  U3MODE __attribute__((__sfr__));
+__extension__ typedef struct tagU3MODEBITS {
+  union {
+    struct {
+      unsigned STSEL:1;
+      unsigned PDSEL0:1;
+      unsigned PDSEL1:1;
+      unsigned BRGH:1;
+      unsigned RXINV:1;
+      unsigned ABAUD:1;
+      unsigned LPBACK:1;
+      unsigned WAKE:1;
+      unsigned UEN0:1;
+      unsigned UEN1:1;
+      unsigned :1;
+      unsigned RTSMD:1;
+      unsigned IREN:1;
+      unsigned USIDL:1;
+      unsigned :1;
+      unsigned UARTEN:1;
+    };
+    struct {
+      unsigned :1;
+      unsigned PDSEL:2;
+      unsigned :5;
+      unsigned UEN:2;
+    };
+  };
+} U3MODEBITS;
+extern volatile U3MODEBITS U3MODEbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U3STA __attribute__((__sfr__));
+__extension__ typedef struct tagU3STABITS {
+  union {
+    struct {
+      unsigned URXDA:1;
+      unsigned OERR:1;
+      unsigned FERR:1;
+      unsigned PERR:1;
+      unsigned RIDLE:1;
+      unsigned ADDEN:1;
+      unsigned URXISEL0:1;
+      unsigned URXISEL1:1;
+      unsigned TRMT:1;
+      unsigned UTXBF:1;
+      unsigned UTXEN:1;
+      unsigned UTXBRK:1;
+      unsigned :1;
+      unsigned UTXISEL0:1;
+      unsigned UTXINV:1;
+      unsigned UTXISEL1:1;
+    };
+    struct {
+      unsigned :6;
+      unsigned URXISEL:2;
+    };
+  };
+} U3STABITS;
+extern volatile U3STABITS U3STAbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U3TXREG __attribute__((__sfr__));
+extern volatile unsigned int  U3RXREG __attribute__((__sfr__));
+extern volatile unsigned int  U3BRG __attribute__((__sfr__));
+extern volatile unsigned int  SPI2STAT __attribute__((__sfr__));
+__extension__ typedef struct tagSPI2STATBITS {
+  union {
+    struct {
+      unsigned SPIRBF:1;
+      unsigned SPITBF:1;
+      unsigned SISEL0:1;
+      unsigned SISEL1:1;
+      unsigned SISEL2:1;
+      unsigned SRXMPT:1;
+      unsigned SPIROV:1;
+      unsigned SRMPT:1;
+      unsigned SPIBEC0:1;
+      unsigned SPIBEC1:1;
+      unsigned SPIBEC2:1;
+      unsigned :2;
+      unsigned SPISIDL:1;
+      unsigned :1;
+      unsigned SPIEN:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned SISEL:3;
+      unsigned :3;
+      unsigned SPIBEC:3;
+    };
+  };
+} SPI2STATBITS;
+extern volatile SPI2STATBITS SPI2STATbits __attribute__((__sfr__));
+
+extern volatile unsigned int  SPI2CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagSPI2CON1BITS {
+  union {
+    struct {
+      unsigned PPRE0:1;
+      unsigned PPRE1:1;
+      unsigned SPRE0:1;
+      unsigned SPRE1:1;
+      unsigned SPRE2:1;
+      unsigned MSTEN:1;
+      unsigned CKP:1;
+      unsigned SSEN:1;
+      unsigned CKE:1;
+      unsigned SMP:1;
+      unsigned MODE16:1;
+      unsigned DISSDO:1;
+      unsigned DISSCK:1;
+    };
+    struct {
+      unsigned PPRE:2;
+      unsigned SPRE:3;
+    };
+  };
+} SPI2CON1BITS;
+extern volatile SPI2CON1BITS SPI2CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  SPI2CON2 __attribute__((__sfr__));
+typedef struct tagSPI2CON2BITS {
+  unsigned SPIBEN:1;
+  unsigned SPIFE:1;
+  unsigned :11;
+  unsigned SPIFPOL:1;
+  unsigned SPIFSD:1;
+  unsigned FRMEN:1;
+} SPI2CON2BITS;
+extern volatile SPI2CON2BITS SPI2CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  SPI2BUF __attribute__((__sfr__));
+extern volatile unsigned int  I2C3RCV __attribute__((__sfr__));
+extern volatile unsigned int  I2C3TRN __attribute__((__sfr__));
+extern volatile unsigned int  I2C3BRG __attribute__((__sfr__));
+extern volatile unsigned int  I2C3CON __attribute__((__sfr__));
+typedef struct tagI2C3CONBITS {
+  unsigned SEN:1;
+  unsigned RSEN:1;
+  unsigned PEN:1;
+  unsigned RCEN:1;
+  unsigned ACKEN:1;
+  unsigned ACKDT:1;
+  unsigned STREN:1;
+  unsigned GCEN:1;
+  unsigned SMEN:1;
+  unsigned DISSLW:1;
+  unsigned A10M:1;
+  unsigned IPMIEN:1;
+  unsigned SCLREL:1;
+  unsigned I2CSIDL:1;
+  unsigned :1;
+  unsigned I2CEN:1;
+} I2C3CONBITS;
+extern volatile I2C3CONBITS I2C3CONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  I2C3STAT __attribute__((__sfr__));
+typedef struct tagI2C3STATBITS {
+  unsigned TBF:1;
+  unsigned RBF:1;
+  unsigned R_W:1;
+  unsigned S:1;
+  unsigned P:1;
+  unsigned D_A:1;
+  unsigned I2COV:1;
+  unsigned IWCOL:1;
+  unsigned ADD10:1;
+  unsigned GCSTAT:1;
+  unsigned BCL:1;
+  unsigned :3;
+  unsigned TRSTAT:1;
+  unsigned ACKSTAT:1;
+} I2C3STATBITS;
+extern volatile I2C3STATBITS I2C3STATbits __attribute__((__sfr__));
+
+extern volatile unsigned int  I2C3ADD __attribute__((__sfr__));
+extern volatile unsigned int  I2C3MSK __attribute__((__sfr__));
+extern volatile unsigned int  SPI3STAT __attribute__((__sfr__));
+__extension__ typedef struct tagSPI3STATBITS {
+  union {
+    struct {
+      unsigned SPIRBF:1;
+      unsigned SPITBF:1;
+      unsigned SISEL0:1;
+      unsigned SISEL1:1;
+      unsigned SISEL2:1;
+      unsigned SRXMPT:1;
+      unsigned SPIROV:1;
+      unsigned SRMPT:1;
+      unsigned SPIBEC0:1;
+      unsigned SPIBEC1:1;
+      unsigned SPIBEC2:1;
+      unsigned :2;
+      unsigned SPISIDL:1;
+      unsigned :1;
+      unsigned SPIEN:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned SISEL:3;
+      unsigned :3;
+      unsigned SPIBEC:3;
+    };
+  };
+} SPI3STATBITS;
+extern volatile SPI3STATBITS SPI3STATbits __attribute__((__sfr__));
+
+extern volatile unsigned int  SPI3CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagSPI3CON1BITS {
+  union {
+    struct {
+      unsigned PPRE0:1;
+      unsigned PPRE1:1;
+      unsigned SPRE0:1;
+      unsigned SPRE1:1;
+      unsigned SPRE2:1;
+      unsigned MSTEN:1;
+      unsigned CKP:1;
+      unsigned SSEN:1;
+      unsigned CKE:1;
+      unsigned SMP:1;
+      unsigned MODE16:1;
+      unsigned DISSDO:1;
+      unsigned DISSCK:1;
+    };
+    struct {
+      unsigned PPRE:2;
+      unsigned SPRE:3;
+    };
+  };
+} SPI3CON1BITS;
+extern volatile SPI3CON1BITS SPI3CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  SPI3CON2 __attribute__((__sfr__));
+typedef struct tagSPI3CON2BITS {
+  unsigned SPIBEN:1;
+  unsigned SPIFE:1;
+  unsigned :11;
+  unsigned SPIFPOL:1;
+  unsigned SPIFSD:1;
+  unsigned FRMEN:1;
+} SPI3CON2BITS;
+extern volatile SPI3CON2BITS SPI3CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  SPI3BUF __attribute__((__sfr__));
+extern volatile unsigned int  U4MODE __attribute__((__sfr__));
+__extension__ typedef struct tagU4MODEBITS {
+  union {
+    struct {
+      unsigned STSEL:1;
+      unsigned PDSEL0:1;
+      unsigned PDSEL1:1;
+      unsigned BRGH:1;
+      unsigned RXINV:1;
+      unsigned ABAUD:1;
+      unsigned LPBACK:1;
+      unsigned WAKE:1;
+      unsigned UEN0:1;
+      unsigned UEN1:1;
+      unsigned :1;
+      unsigned RTSMD:1;
+      unsigned IREN:1;
+      unsigned USIDL:1;
+      unsigned :1;
+      unsigned UARTEN:1;
+    };
+    struct {
+      unsigned :1;
+      unsigned PDSEL:2;
+      unsigned :5;
+      unsigned UEN:2;
+    };
+  };
+} U4MODEBITS;
+extern volatile U4MODEBITS U4MODEbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U4STA __attribute__((__sfr__));
+__extension__ typedef struct tagU4STABITS {
+  union {
+    struct {
+      unsigned URXDA:1;
+      unsigned OERR:1;
+      unsigned FERR:1;
+      unsigned PERR:1;
+      unsigned RIDLE:1;
+      unsigned ADDEN:1;
+      unsigned URXISEL0:1;
+      unsigned URXISEL1:1;
+      unsigned TRMT:1;
+      unsigned UTXBF:1;
+      unsigned UTXEN:1;
+      unsigned UTXBRK:1;
+      unsigned :1;
+      unsigned UTXISEL0:1;
+      unsigned UTXINV:1;
+      unsigned UTXISEL1:1;
+    };
+    struct {
+      unsigned :6;
+      unsigned URXISEL:2;
+    };
+  };
+} U4STABITS;
+extern volatile U4STABITS U4STAbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U4TXREG __attribute__((__sfr__));
+extern volatile unsigned int  U4RXREG __attribute__((__sfr__));
+extern volatile unsigned int  U4BRG __attribute__((__sfr__));
+extern volatile unsigned int  TRISB __attribute__((__sfr__));
+typedef struct tagTRISBBITS {
+  unsigned TRISB0:1;
+  unsigned TRISB1:1;
+  unsigned TRISB2:1;
+  unsigned TRISB3:1;
+  unsigned TRISB4:1;
+  unsigned TRISB5:1;
+  unsigned TRISB6:1;
+  unsigned TRISB7:1;
+  unsigned TRISB8:1;
+  unsigned TRISB9:1;
+  unsigned TRISB10:1;
+  unsigned TRISB11:1;
+  unsigned TRISB12:1;
+  unsigned TRISB13:1;
+  unsigned TRISB14:1;
+  unsigned TRISB15:1;
+} TRISBBITS;
+extern volatile TRISBBITS TRISBbits __attribute__((__sfr__));
+
+extern volatile unsigned int  PORTB __attribute__((__sfr__));
+typedef struct tagPORTBBITS {
+  unsigned RB0:1;
+  unsigned RB1:1;
+  unsigned RB2:1;
+  unsigned RB3:1;
+  unsigned RB4:1;
+  unsigned RB5:1;
+  unsigned RB6:1;
+  unsigned RB7:1;
+  unsigned RB8:1;
+  unsigned RB9:1;
+  unsigned RB10:1;
+  unsigned RB11:1;
+  unsigned RB12:1;
+  unsigned RB13:1;
+  unsigned RB14:1;
+  unsigned RB15:1;
+} PORTBBITS;
+extern volatile PORTBBITS PORTBbits __attribute__((__sfr__));
+
+extern volatile unsigned int  LATB __attribute__((__sfr__));
+typedef struct tagLATBBITS {
+  unsigned LATB0:1;
+  unsigned LATB1:1;
+  unsigned LATB2:1;
+  unsigned LATB3:1;
+  unsigned LATB4:1;
+  unsigned LATB5:1;
+  unsigned LATB6:1;
+  unsigned LATB7:1;
+  unsigned LATB8:1;
+  unsigned LATB9:1;
+  unsigned LATB10:1;
+  unsigned LATB11:1;
+  unsigned LATB12:1;
+  unsigned LATB13:1;
+  unsigned LATB14:1;
+  unsigned LATB15:1;
+} LATBBITS;
+extern volatile LATBBITS LATBbits __attribute__((__sfr__));
+
+extern volatile unsigned int  ODCB __attribute__((__sfr__));
+typedef struct tagODCBBITS {
+  unsigned ODB0:1;
+  unsigned ODB1:1;
+  unsigned ODB2:1;
+  unsigned ODB3:1;
+  unsigned ODB4:1;
+  unsigned ODB5:1;
+  unsigned ODB6:1;
+  unsigned ODB7:1;
+  unsigned ODB8:1;
+  unsigned ODB9:1;
+  unsigned ODB10:1;
+  unsigned ODB11:1;
+  unsigned ODB12:1;
+  unsigned ODB13:1;
+  unsigned ODB14:1;
+  unsigned ODB15:1;
+} ODCBBITS;
+extern volatile ODCBBITS ODCBbits __attribute__((__sfr__));
+
+extern volatile unsigned int  TRISC __attribute__((__sfr__));
+typedef struct tagTRISCBITS {
+  unsigned :12;
+  unsigned TRISC12:1;
+  unsigned TRISC13:1;
+  unsigned TRISC14:1;
+  unsigned TRISC15:1;
+} TRISCBITS;
+extern volatile TRISCBITS TRISCbits __attribute__((__sfr__));
+
+extern volatile unsigned int  PORTC __attribute__((__sfr__));
+typedef struct tagPORTCBITS {
+  unsigned :12;
+  unsigned RC12:1;
+  unsigned RC13:1;
+  unsigned RC14:1;
+  unsigned RC15:1;
+} PORTCBITS;
+extern volatile PORTCBITS PORTCbits __attribute__((__sfr__));
+
+extern volatile unsigned int  LATC __attribute__((__sfr__));
+typedef struct tagLATCBITS {
+  unsigned :12;
+  unsigned LATC12:1;
+  unsigned LATC13:1;
+  unsigned LATC14:1;
+  unsigned LATC15:1;
+} LATCBITS;
+extern volatile LATCBITS LATCbits __attribute__((__sfr__));
+
+extern volatile unsigned int  ODCC __attribute__((__sfr__));
+typedef struct tagODCCBITS {
+  unsigned :12;
+  unsigned ODC12:1;
+  unsigned ODC13:1;
+  unsigned ODC14:1;
+  unsigned ODC15:1;
+} ODCCBITS;
+extern volatile ODCCBITS ODCCbits __attribute__((__sfr__));
+
+extern volatile unsigned int  TRISD __attribute__((__sfr__));
+typedef struct tagTRISDBITS {
+  unsigned TRISD0:1;
+  unsigned TRISD1:1;
+  unsigned TRISD2:1;
+  unsigned TRISD3:1;
+  unsigned TRISD4:1;
+  unsigned TRISD5:1;
+  unsigned TRISD6:1;
+  unsigned TRISD7:1;
+  unsigned TRISD8:1;
+  unsigned TRISD9:1;
+  unsigned TRISD10:1;
+  unsigned TRISD11:1;
+} TRISDBITS;
+extern volatile TRISDBITS TRISDbits __attribute__((__sfr__));
+
+extern volatile unsigned int  PORTD __attribute__((__sfr__));
+typedef struct tagPORTDBITS {
+  unsigned RD0:1;
+  unsigned RD1:1;
+  unsigned RD2:1;
+  unsigned RD3:1;
+  unsigned RD4:1;
+  unsigned RD5:1;
+  unsigned RD6:1;
+  unsigned RD7:1;
+  unsigned RD8:1;
+  unsigned RD9:1;
+  unsigned RD10:1;
+  unsigned RD11:1;
+} PORTDBITS;
+extern volatile PORTDBITS PORTDbits __attribute__((__sfr__));
+
+extern volatile unsigned int  LATD __attribute__((__sfr__));
+typedef struct tagLATDBITS {
+  unsigned LATD0:1;
+  unsigned LATD1:1;
+  unsigned LATD2:1;
+  unsigned LATD3:1;
+  unsigned LATD4:1;
+  unsigned LATD5:1;
+  unsigned LATD6:1;
+  unsigned LATD7:1;
+  unsigned LATD8:1;
+  unsigned LATD9:1;
+  unsigned LATD10:1;
+  unsigned LATD11:1;
+} LATDBITS;
+extern volatile LATDBITS LATDbits __attribute__((__sfr__));
+
+extern volatile unsigned int  ODCD __attribute__((__sfr__));
+typedef struct tagODCDBITS {
+  unsigned ODD0:1;
+  unsigned ODD1:1;
+  unsigned ODD2:1;
+  unsigned ODD3:1;
+  unsigned ODD4:1;
+  unsigned ODD5:1;
+  unsigned ODD6:1;
+  unsigned ODD7:1;
+  unsigned ODD8:1;
+  unsigned ODD9:1;
+  unsigned ODD10:1;
+  unsigned ODD11:1;
+} ODCDBITS;
+extern volatile ODCDBITS ODCDbits __attribute__((__sfr__));
+
+extern volatile unsigned int  TRISE __attribute__((__sfr__));
+typedef struct tagTRISEBITS {
+  unsigned TRISE0:1;
+  unsigned TRISE1:1;
+  unsigned TRISE2:1;
+  unsigned TRISE3:1;
+  unsigned TRISE4:1;
+  unsigned TRISE5:1;
+  unsigned TRISE6:1;
+  unsigned TRISE7:1;
+} TRISEBITS;
+extern volatile TRISEBITS TRISEbits __attribute__((__sfr__));
+
+extern volatile unsigned int  PORTE __attribute__((__sfr__));
+typedef struct tagPORTEBITS {
+  unsigned RE0:1;
+  unsigned RE1:1;
+  unsigned RE2:1;
+  unsigned RE3:1;
+  unsigned RE4:1;
+  unsigned RE5:1;
+  unsigned RE6:1;
+  unsigned RE7:1;
+} PORTEBITS;
+extern volatile PORTEBITS PORTEbits __attribute__((__sfr__));
+
+extern volatile unsigned int  LATE __attribute__((__sfr__));
+typedef struct tagLATEBITS {
+  unsigned LATE0:1;
+  unsigned LATE1:1;
+  unsigned LATE2:1;
+  unsigned LATE3:1;
+  unsigned LATE4:1;
+  unsigned LATE5:1;
+  unsigned LATE6:1;
+  unsigned LATE7:1;
+} LATEBITS;
+extern volatile LATEBITS LATEbits __attribute__((__sfr__));
+
+extern volatile unsigned int  ODCE __attribute__((__sfr__));
+typedef struct tagODCEBITS {
+  unsigned ODE0:1;
+  unsigned ODE1:1;
+  unsigned ODE2:1;
+  unsigned ODE3:1;
+  unsigned ODE4:1;
+  unsigned ODE5:1;
+  unsigned ODE6:1;
+  unsigned ODE7:1;
+} ODCEBITS;
+extern volatile ODCEBITS ODCEbits __attribute__((__sfr__));
+
+extern volatile unsigned int  TRISF __attribute__((__sfr__));
+typedef struct tagTRISFBITS {
+  unsigned TRISF0:1;
+  unsigned TRISF1:1;
+  unsigned :1;
+  unsigned TRISF3:1;
+  unsigned TRISF4:1;
+  unsigned TRISF5:1;
+} TRISFBITS;
+extern volatile TRISFBITS TRISFbits __attribute__((__sfr__));
+
+extern volatile unsigned int  PORTF __attribute__((__sfr__));
+typedef struct tagPORTFBITS {
+  unsigned RF0:1;
+  unsigned RF1:1;
+  unsigned :1;
+  unsigned RF3:1;
+  unsigned RF4:1;
+  unsigned RF5:1;
+} PORTFBITS;
+extern volatile PORTFBITS PORTFbits __attribute__((__sfr__));
+
+extern volatile unsigned int  LATF __attribute__((__sfr__));
+typedef struct tagLATFBITS {
+  unsigned LATF0:1;
+  unsigned LATF1:1;
+  unsigned :1;
+  unsigned LATF3:1;
+  unsigned LATF4:1;
+  unsigned LATF5:1;
+} LATFBITS;
+extern volatile LATFBITS LATFbits __attribute__((__sfr__));
+
+extern volatile unsigned int  ODCF __attribute__((__sfr__));
+typedef struct tagODCFBITS {
+  unsigned ODF0:1;
+  unsigned ODF1:1;
+  unsigned :1;
+  unsigned ODF3:1;
+  unsigned ODF4:1;
+  unsigned ODF5:1;
+} ODCFBITS;
+extern volatile ODCFBITS ODCFbits __attribute__((__sfr__));
+
+extern volatile unsigned int  TRISG __attribute__((__sfr__));
+typedef struct tagTRISGBITS {
+  unsigned :2;
+  unsigned TRISG2:1;
+  unsigned TRISG3:1;
+  unsigned :2;
+  unsigned TRISG6:1;
+  unsigned TRISG7:1;
+  unsigned TRISG8:1;
+  unsigned TRISG9:1;
+} TRISGBITS;
+extern volatile TRISGBITS TRISGbits __attribute__((__sfr__));
+
+extern volatile unsigned int  PORTG __attribute__((__sfr__));
+typedef struct tagPORTGBITS {
+  unsigned :2;
+  unsigned RG2:1;
+  unsigned RG3:1;
+  unsigned :2;
+  unsigned RG6:1;
+  unsigned RG7:1;
+  unsigned RG8:1;
+  unsigned RG9:1;
+} PORTGBITS;
+extern volatile PORTGBITS PORTGbits __attribute__((__sfr__));
+
+extern volatile unsigned int  LATG __attribute__((__sfr__));
+typedef struct tagLATGBITS {
+  unsigned :2;
+  unsigned LATG2:1;
+  unsigned LATG3:1;
+  unsigned :2;
+  unsigned LATG6:1;
+  unsigned LATG7:1;
+  unsigned LATG8:1;
+  unsigned LATG9:1;
+} LATGBITS;
+extern volatile LATGBITS LATGbits __attribute__((__sfr__));
+
+extern volatile unsigned int  ODCG __attribute__((__sfr__));
+typedef struct tagODCGBITS {
+  unsigned :2;
+  unsigned ODG2:1;
+  unsigned ODG3:1;
+  unsigned :2;
+  unsigned ODG6:1;
+  unsigned ODG7:1;
+  unsigned ODG8:1;
+  unsigned ODG9:1;
+} ODCGBITS;
+extern volatile ODCGBITS ODCGbits __attribute__((__sfr__));
+
+extern volatile unsigned int  PADCFG1 __attribute__((__sfr__));
+__extension__ typedef struct tagPADCFG1BITS {
+  union {
+    struct {
+      unsigned PMPTTL:1;
+      unsigned RTSECSEL:1;
+    };
+    struct {
+      unsigned :1;
+      unsigned RTSECSEL0:1;
+    };
+  };
+} PADCFG1BITS;
+extern volatile PADCFG1BITS PADCFG1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  ADC1BUF0 __attribute__((__sfr__));
+extern volatile unsigned int  ADC1BUF1 __attribute__((__sfr__));
+extern volatile unsigned int  ADC1BUF2 __attribute__((__sfr__));
+extern volatile unsigned int  ADC1BUF3 __attribute__((__sfr__));
+extern volatile unsigned int  ADC1BUF4 __attribute__((__sfr__));
+extern volatile unsigned int  ADC1BUF5 __attribute__((__sfr__));
+extern volatile unsigned int  ADC1BUF6 __attribute__((__sfr__));
+extern volatile unsigned int  ADC1BUF7 __attribute__((__sfr__));
+extern volatile unsigned int  ADC1BUF8 __attribute__((__sfr__));
+extern volatile unsigned int  ADC1BUF9 __attribute__((__sfr__));
+extern volatile unsigned int  ADC1BUFA __attribute__((__sfr__));
+extern volatile unsigned int  ADC1BUFB __attribute__((__sfr__));
+extern volatile unsigned int  ADC1BUFC __attribute__((__sfr__));
+extern volatile unsigned int  ADC1BUFD __attribute__((__sfr__));
+extern volatile unsigned int  ADC1BUFE __attribute__((__sfr__));
+extern volatile unsigned int  ADC1BUFF __attribute__((__sfr__));
+extern volatile unsigned int  AD1CON1 __attribute__((__sfr__));
+__extension__ typedef struct tagAD1CON1BITS {
+  union {
+    struct {
+      unsigned DONE:1;
+      unsigned SAMP:1;
+      unsigned ASAM:1;
+      unsigned :2;
+      unsigned SSRC0:1;
+      unsigned SSRC1:1;
+      unsigned SSRC2:1;
+      unsigned FORM0:1;
+      unsigned FORM1:1;
+      unsigned :3;
+      unsigned ADSIDL:1;
+      unsigned :1;
+      unsigned ADON:1;
+    };
+    struct {
+      unsigned :5;
+      unsigned SSRC:3;
+      unsigned FORM:2;
+    };
+  };
+} AD1CON1BITS;
+extern volatile AD1CON1BITS AD1CON1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  AD1CON2 __attribute__((__sfr__));
+__extension__ typedef struct tagAD1CON2BITS {
+  union {
+    struct {
+      unsigned ALTS:1;
+      unsigned BUFM:1;
+      unsigned SMPI0:1;
+      unsigned SMPI1:1;
+      unsigned SMPI2:1;
+      unsigned SMPI3:1;
+      unsigned :1;
+      unsigned BUFS:1;
+      unsigned :2;
+      unsigned CSCNA:1;
+      unsigned :1;
+      unsigned OFFCAL:1;
+      unsigned VCFG0:1;
+      unsigned VCFG1:1;
+      unsigned VCFG2:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned SMPI:4;
+      unsigned :7;
+      unsigned VCFG:3;
+    };
+  };
+} AD1CON2BITS;
+extern volatile AD1CON2BITS AD1CON2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  AD1CON3 __attribute__((__sfr__));
+__extension__ typedef struct tagAD1CON3BITS {
+  union {
+    struct {
+      unsigned ADCS0:1;
+      unsigned ADCS1:1;
+      unsigned ADCS2:1;
+      unsigned ADCS3:1;
+      unsigned ADCS4:1;
+      unsigned ADCS5:1;
+      unsigned ADCS6:1;
+      unsigned ADCS7:1;
+      unsigned SAMC0:1;
+      unsigned SAMC1:1;
+      unsigned SAMC2:1;
+      unsigned SAMC3:1;
+      unsigned SAMC4:1;
+      unsigned :2;
+      unsigned ADRC:1;
+    };
+    struct {
+      unsigned ADCS:8;
+      unsigned SAMC:5;
+    };
+  };
+} AD1CON3BITS;
+extern volatile AD1CON3BITS AD1CON3bits __attribute__((__sfr__));
+
+extern volatile unsigned int  AD1CHS __attribute__((__sfr__));
+__extension__ typedef struct tagAD1CHSBITS {
+  union {
+    struct {
+      unsigned CH0SA0:1;
+      unsigned CH0SA1:1;
+      unsigned CH0SA2:1;
+      unsigned CH0SA3:1;
+      unsigned CH0SA4:1;
+      unsigned :2;
+      unsigned CH0NA:1;
+      unsigned CH0SB0:1;
+      unsigned CH0SB1:1;
+      unsigned CH0SB2:1;
+      unsigned CH0SB3:1;
+      unsigned CH0SB4:1;
+      unsigned :2;
+      unsigned CH0NB:1;
+    };
+    struct {
+      unsigned CH0SA:5;
+      unsigned :3;
+      unsigned CH0SB:5;
+    };
+  };
+} AD1CHSBITS;
+extern volatile AD1CHSBITS AD1CHSbits __attribute__((__sfr__));
+
+extern volatile unsigned int  AD1CHS0 __attribute__((__sfr__));
+__extension__ typedef struct tagAD1CHS0BITS {
+  union {
+    struct {
+      unsigned CH0SA0:1;
+      unsigned CH0SA1:1;
+      unsigned CH0SA2:1;
+      unsigned CH0SA3:1;
+      unsigned CH0SA4:1;
+      unsigned :2;
+      unsigned CH0NA:1;
+      unsigned CH0SB0:1;
+      unsigned CH0SB1:1;
+      unsigned CH0SB2:1;
+      unsigned CH0SB3:1;
+      unsigned CH0SB4:1;
+      unsigned :2;
+      unsigned CH0NB:1;
+    };
+    struct {
+      unsigned CH0SA:5;
+      unsigned :3;
+      unsigned CH0SB:5;
+    };
+  };
+} AD1CHS0BITS;
+extern volatile AD1CHS0BITS AD1CHS0bits __attribute__((__sfr__));
+
+extern volatile unsigned int  AD1PCFGH __attribute__((__sfr__));
+typedef struct tagAD1PCFGHBITS {
+  unsigned PCFG16:1;
+  unsigned PCFG17:1;
+} AD1PCFGHBITS;
+extern volatile AD1PCFGHBITS AD1PCFGHbits __attribute__((__sfr__));
+
+extern volatile unsigned int  AD1PCFG __attribute__((__sfr__));
+typedef struct tagAD1PCFGBITS {
+  unsigned PCFG0:1;
+  unsigned PCFG1:1;
+  unsigned PCFG2:1;
+  unsigned PCFG3:1;
+  unsigned PCFG4:1;
+  unsigned PCFG5:1;
+  unsigned PCFG6:1;
+  unsigned PCFG7:1;
+  unsigned PCFG8:1;
+  unsigned PCFG9:1;
+  unsigned PCFG10:1;
+  unsigned PCFG11:1;
+  unsigned PCFG12:1;
+  unsigned PCFG13:1;
+  unsigned PCFG14:1;
+  unsigned PCFG15:1;
+} AD1PCFGBITS;
+extern volatile AD1PCFGBITS AD1PCFGbits __attribute__((__sfr__));
+
+extern volatile unsigned int  AD1PCFGL __attribute__((__sfr__));
+typedef struct tagAD1PCFGLBITS {
+  unsigned PCFG0:1;
+  unsigned PCFG1:1;
+  unsigned PCFG2:1;
+  unsigned PCFG3:1;
+  unsigned PCFG4:1;
+  unsigned PCFG5:1;
+  unsigned PCFG6:1;
+  unsigned PCFG7:1;
+  unsigned PCFG8:1;
+  unsigned PCFG9:1;
+  unsigned PCFG10:1;
+  unsigned PCFG11:1;
+  unsigned PCFG12:1;
+  unsigned PCFG13:1;
+  unsigned PCFG14:1;
+  unsigned PCFG15:1;
+} AD1PCFGLBITS;
+extern volatile AD1PCFGLBITS AD1PCFGLbits __attribute__((__sfr__));
+
+extern volatile unsigned int  AD1CSSL __attribute__((__sfr__));
+typedef struct tagAD1CSSLBITS {
+  unsigned CSSL0:1;
+  unsigned CSSL1:1;
+  unsigned CSSL2:1;
+  unsigned CSSL3:1;
+  unsigned CSSL4:1;
+  unsigned CSSL5:1;
+  unsigned CSSL6:1;
+  unsigned CSSL7:1;
+  unsigned CSSL8:1;
+  unsigned CSSL9:1;
+  unsigned CSSL10:1;
+  unsigned CSSL11:1;
+  unsigned CSSL12:1;
+  unsigned CSSL13:1;
+  unsigned CSSL14:1;
+  unsigned CSSL15:1;
+} AD1CSSLBITS;
+extern volatile AD1CSSLBITS AD1CSSLbits __attribute__((__sfr__));
+
+extern volatile unsigned int  AD1CSSH __attribute__((__sfr__));
+typedef struct tagAD1CSSHBITS {
+  unsigned CSSL16:1;
+  unsigned CSSL17:1;
+} AD1CSSHBITS;
+extern volatile AD1CSSHBITS AD1CSSHbits __attribute__((__sfr__));
+
+extern volatile unsigned int  CTMUCON __attribute__((__sfr__));
+__extension__ typedef struct tagCTMUCONBITS {
+  union {
+    struct {
+      unsigned EDG1STAT:1;
+      unsigned EDG2STAT:1;
+      unsigned EDG1SEL0:1;
+      unsigned EDG1SEL1:1;
+      unsigned EDG1POL:1;
+      unsigned EDG2SEL0:1;
+      unsigned EDG2SEL1:1;
+      unsigned EDG2POL:1;
+      unsigned CTTRIG:1;
+      unsigned IDISSEN:1;
+      unsigned EDGSEQEN:1;
+      unsigned EDGEN:1;
+      unsigned TGEN:1;
+      unsigned CTMUSIDL:1;
+      unsigned :1;
+      unsigned CTMUEN:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EDG1SEL:2;
+      unsigned :1;
+      unsigned EDG2SEL:2;
+    };
+  };
+} CTMUCONBITS;
+extern volatile CTMUCONBITS CTMUCONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  CTMUICON __attribute__((__sfr__));
+__extension__ typedef struct tagCTMUICONBITS {
+  union {
+    struct {
+      unsigned :8;
+      unsigned IRNG0:1;
+      unsigned IRNG1:1;
+      unsigned ITRIM0:1;
+      unsigned ITRIM1:1;
+      unsigned ITRIM2:1;
+      unsigned ITRIM3:1;
+      unsigned ITRIM4:1;
+      unsigned ITRIM5:1;
+    };
+    struct {
+      unsigned :8;
+      unsigned IRNG:2;
+      unsigned ITRIM:6;
+    };
+  };
+} CTMUICONBITS;
+extern volatile CTMUICONBITS CTMUICONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1OTGIR __attribute__((__sfr__));
+typedef struct tagU1OTGIRBITS {
+  unsigned VBUSVDIF:1;
+  unsigned :1;
+  unsigned SESENDIF:1;
+  unsigned SESVDIF:1;
+  unsigned ACTVIF:1;
+  unsigned LSTATEIF:1;
+  unsigned T1MSECIF:1;
+  unsigned IDIF:1;
+} U1OTGIRBITS;
+extern volatile U1OTGIRBITS U1OTGIRbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1OTGIE __attribute__((__sfr__));
+typedef struct tagU1OTGIEBITS {
+  unsigned VBUSVDIE:1;
+  unsigned :1;
+  unsigned SESENDIE:1;
+  unsigned SESVDIE:1;
+  unsigned ACTVIE:1;
+  unsigned LSTATEIE:1;
+  unsigned T1MSECIE:1;
+  unsigned IDIE:1;
+} U1OTGIEBITS;
+extern volatile U1OTGIEBITS U1OTGIEbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1OTGSTAT __attribute__((__sfr__));
+typedef struct tagU1OTGSTATBITS {
+  unsigned VBUSVD:1;
+  unsigned :1;
+  unsigned SESEND:1;
+  unsigned SESVD:1;
+  unsigned :1;
+  unsigned LSTATE:1;
+  unsigned :1;
+  unsigned ID:1;
+} U1OTGSTATBITS;
+extern volatile U1OTGSTATBITS U1OTGSTATbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1OTGCON __attribute__((__sfr__));
+typedef struct tagU1OTGCONBITS {
+  unsigned VBUSDIS:1;
+  unsigned VBUSCHG:1;
+  unsigned OTGEN:1;
+  unsigned VBUSON:1;
+  unsigned DMPULDWN:1;
+  unsigned DPPULDWN:1;
+  unsigned DMPULUP:1;
+  unsigned DPPULUP:1;
+} U1OTGCONBITS;
+extern volatile U1OTGCONBITS U1OTGCONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1PWRC __attribute__((__sfr__));
+__extension__ typedef struct tagU1PWRCBITS {
+  union {
+    struct {
+      unsigned USBPWR:1;
+      unsigned USUSPEND:1;
+      unsigned :2;
+      unsigned USLPGRD:1;
+      unsigned :2;
+      unsigned UACTPND:1;
+    };
+    struct {
+      unsigned :1;
+      unsigned USUSPND:1;
+    };
+  };
+} U1PWRCBITS;
+extern volatile U1PWRCBITS U1PWRCbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1IR __attribute__((__sfr__));
+__extension__ typedef struct tagU1IRBITS {
+  union {
+    struct {
+      unsigned DETACHIF:1;
+      unsigned UERRIF:1;
+      unsigned SOFIF:1;
+      unsigned TRNIF:1;
+      unsigned IDLEIF:1;
+      unsigned RESUMEIF:1;
+      unsigned ATTACHIF:1;
+      unsigned STALLIF:1;
+    };
+    struct {
+      unsigned URSTIF:1;
+    };
+  };
+} U1IRBITS;
+extern volatile U1IRBITS U1IRbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1IE __attribute__((__sfr__));
+__extension__ typedef struct tagU1IEBITS {
+  union {
+    struct {
+      unsigned DETACHIE:1;
+      unsigned UERRIE:1;
+      unsigned SOFIE:1;
+      unsigned TRNIE:1;
+      unsigned IDLEIE:1;
+      unsigned RESUMEIE:1;
+      unsigned ATTACHIE:1;
+      unsigned STALLIE:1;
+    };
+    struct {
+      unsigned URSTIE:1;
+    };
+  };
+} U1IEBITS;
+extern volatile U1IEBITS U1IEbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EIR __attribute__((__sfr__));
+__extension__ typedef struct tagU1EIRBITS {
+  union {
+    struct {
+      unsigned PIDEF:1;
+      unsigned CRC5EF:1;
+      unsigned CRC16EF:1;
+      unsigned DFN8EF:1;
+      unsigned BTOEF:1;
+      unsigned DMAEF:1;
+      unsigned :1;
+      unsigned BTSEF:1;
+    };
+    struct {
+      unsigned :1;
+      unsigned EOFEF:1;
+    };
+  };
+} U1EIRBITS;
+extern volatile U1EIRBITS U1EIRbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EIE __attribute__((__sfr__));
+__extension__ typedef struct tagU1EIEBITS {
+  union {
+    struct {
+      unsigned PIDEE:1;
+      unsigned CRC5EE:1;
+      unsigned CRC16EE:1;
+      unsigned DFN8EE:1;
+      unsigned BTOEE:1;
+      unsigned DMAEE:1;
+      unsigned :1;
+      unsigned BTSEE:1;
+    };
+    struct {
+      unsigned :1;
+      unsigned EOFEE:1;
+    };
+  };
+} U1EIEBITS;
+extern volatile U1EIEBITS U1EIEbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1STAT __attribute__((__sfr__));
+__extension__ typedef struct tagU1STATBITS {
+  union {
+    struct {
+      unsigned :2;
+      unsigned PPBI:1;
+      unsigned DIR:1;
+      unsigned ENDPT0:1;
+      unsigned ENDPT1:1;
+      unsigned ENDPT2:1;
+      unsigned ENDPT3:1;
+    };
+    struct {
+      unsigned :4;
+      unsigned ENDPT:4;
+    };
+  };
+} U1STATBITS;
+extern volatile U1STATBITS U1STATbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1CON __attribute__((__sfr__));
+__extension__ typedef struct tagU1CONBITS {
+  union {
+    struct {
+      unsigned USBEN:1;
+      unsigned PPBRST:1;
+      unsigned RESUME:1;
+      unsigned HOSTEN:1;
+      unsigned USBRST:1;
+      unsigned PKTDIS:1;
+      unsigned SE0:1;
+      unsigned JSTATE:1;
+    };
+    struct {
+      unsigned SOFEN:1;
+      unsigned :4;
+      unsigned TOKBUSY:1;
+    };
+  };
+} U1CONBITS;
+extern volatile U1CONBITS U1CONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1ADDR __attribute__((__sfr__));
+__extension__ typedef struct tagU1ADDRBITS {
+  union {
+    struct {
+      unsigned DEVADDR0:1;
+      unsigned DEVADDR1:1;
+      unsigned DEVADDR2:1;
+      unsigned DEVADDR3:1;
+      unsigned DEVADDR4:1;
+      unsigned DEVADDR5:1;
+      unsigned DEVADDR6:1;
+      unsigned LOWSPDEN:1;
+    };
+    struct {
+      unsigned DEVADDR:7;
+      unsigned LSPDEN:1;
+    };
+  };
+} U1ADDRBITS;
+extern volatile U1ADDRBITS U1ADDRbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1BDTP1 __attribute__((__sfr__));
+typedef struct tagU1BDTP1BITS {
+  unsigned :1;
+  unsigned BDTPTRL:7;
+} U1BDTP1BITS;
+extern volatile U1BDTP1BITS U1BDTP1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1FRML __attribute__((__sfr__));
+typedef struct tagU1FRMLBITS {
+  unsigned FRM0:1;
+  unsigned FRM1:1;
+  unsigned FRM2:1;
+  unsigned FRM3:1;
+  unsigned FRM4:1;
+  unsigned FRM5:1;
+  unsigned FRM6:1;
+  unsigned FRM7:1;
+} U1FRMLBITS;
+extern volatile U1FRMLBITS U1FRMLbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1FRMH __attribute__((__sfr__));
+typedef struct tagU1FRMHBITS {
+  unsigned FRM8:1;
+  unsigned FRM9:1;
+  unsigned FRM10:1;
+} U1FRMHBITS;
+extern volatile U1FRMHBITS U1FRMHbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1TOK __attribute__((__sfr__));
+__extension__ typedef struct tagU1TOKBITS {
+  union {
+    struct {
+      unsigned EP0:1;
+      unsigned EP1:1;
+      unsigned EP2:1;
+      unsigned EP3:1;
+      unsigned PID0:1;
+      unsigned PID1:1;
+      unsigned PID2:1;
+      unsigned PID3:1;
+    };
+    struct {
+      unsigned EP:4;
+      unsigned PID:4;
+    };
+  };
+} U1TOKBITS;
+extern volatile U1TOKBITS U1TOKbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1SOF __attribute__((__sfr__));
+typedef struct tagU1SOFBITS {
+  unsigned CNT:8;
+} U1SOFBITS;
+extern volatile U1SOFBITS U1SOFbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1BDTP2 __attribute__((__sfr__));
+typedef struct tagU1BDTP2BITS {
+  unsigned BDTPTRH:8;
+} U1BDTP2BITS;
+extern volatile U1BDTP2BITS U1BDTP2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1BDTP3 __attribute__((__sfr__));
+typedef struct tagU1BDTP3BITS {
+  unsigned BDTPTRU:8;
+} U1BDTP3BITS;
+extern volatile U1BDTP3BITS U1BDTP3bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1CNFG1 __attribute__((__sfr__));
+__extension__ typedef struct tagU1CNFG1BITS {
+  union {
+    struct {
+      unsigned PPB0:1;
+      unsigned PPB1:1;
+      unsigned :2;
+      unsigned USBSIDL:1;
+      unsigned :1;
+      unsigned UOEMON:1;
+      unsigned UTEYE:1;
+    };
+    struct {
+      unsigned PPB:2;
+    };
+  };
+} U1CNFG1BITS;
+extern volatile U1CNFG1BITS U1CNFG1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1CNFG2 __attribute__((__sfr__));
+typedef struct tagU1CNFG2BITS {
+  unsigned UTRDIS:1;
+  unsigned UVCMPDIS:1;
+  unsigned UVBUSDIS:1;
+  unsigned EXTI2CEN:1;
+} U1CNFG2BITS;
+extern volatile U1CNFG2BITS U1CNFG2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EP0 __attribute__((__sfr__));
+__extension__ typedef struct tagU1EP0BITS {
+  union {
+    struct {
+      unsigned EPHSHK:1;
+      unsigned EPSTALL:1;
+      unsigned EPINEN:1;
+      unsigned EPOUTEN:1;
+      unsigned EPCONDIS:1;
+      unsigned :1;
+      unsigned RETRYDIS:1;
+      unsigned LOWSPD:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EPTXEN:1;
+      unsigned EPRXEN:1;
+      unsigned :3;
+      unsigned LSPD:1;
+    };
+  };
+} U1EP0BITS;
+extern volatile U1EP0BITS U1EP0bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EP1 __attribute__((__sfr__));
+__extension__ typedef struct tagU1EP1BITS {
+  union {
+    struct {
+      unsigned EPHSHK:1;
+      unsigned EPSTALL:1;
+      unsigned EPINEN:1;
+      unsigned EPOUTEN:1;
+      unsigned EPCONDIS:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EPTXEN:1;
+      unsigned EPRXEN:1;
+    };
+  };
+} U1EP1BITS;
+extern volatile U1EP1BITS U1EP1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EP2 __attribute__((__sfr__));
+__extension__ typedef struct tagU1EP2BITS {
+  union {
+    struct {
+      unsigned EPHSHK:1;
+      unsigned EPSTALL:1;
+      unsigned EPINEN:1;
+      unsigned EPOUTEN:1;
+      unsigned EPCONDIS:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EPTXEN:1;
+      unsigned EPRXEN:1;
+    };
+  };
+} U1EP2BITS;
+extern volatile U1EP2BITS U1EP2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EP3 __attribute__((__sfr__));
+__extension__ typedef struct tagU1EP3BITS {
+  union {
+    struct {
+      unsigned EPHSHK:1;
+      unsigned EPSTALL:1;
+      unsigned EPINEN:1;
+      unsigned EPOUTEN:1;
+      unsigned EPCONDIS:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EPTXEN:1;
+      unsigned EPRXEN:1;
+    };
+  };
+} U1EP3BITS;
+extern volatile U1EP3BITS U1EP3bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EP4 __attribute__((__sfr__));
+__extension__ typedef struct tagU1EP4BITS {
+  union {
+    struct {
+      unsigned EPHSHK:1;
+      unsigned EPSTALL:1;
+      unsigned EPINEN:1;
+      unsigned EPOUTEN:1;
+      unsigned EPCONDIS:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EPTXEN:1;
+      unsigned EPRXEN:1;
+    };
+  };
+} U1EP4BITS;
+extern volatile U1EP4BITS U1EP4bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EP5 __attribute__((__sfr__));
+__extension__ typedef struct tagU1EP5BITS {
+  union {
+    struct {
+      unsigned EPHSHK:1;
+      unsigned EPSTALL:1;
+      unsigned EPINEN:1;
+      unsigned EPOUTEN:1;
+      unsigned EPCONDIS:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EPTXEN:1;
+      unsigned EPRXEN:1;
+    };
+  };
+} U1EP5BITS;
+extern volatile U1EP5BITS U1EP5bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EP6 __attribute__((__sfr__));
+__extension__ typedef struct tagU1EP6BITS {
+  union {
+    struct {
+      unsigned EPHSHK:1;
+      unsigned EPSTALL:1;
+      unsigned EPINEN:1;
+      unsigned EPOUTEN:1;
+      unsigned EPCONDIS:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EPTXEN:1;
+      unsigned EPRXEN:1;
+    };
+  };
+} U1EP6BITS;
+extern volatile U1EP6BITS U1EP6bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EP7 __attribute__((__sfr__));
+__extension__ typedef struct tagU1EP7BITS {
+  union {
+    struct {
+      unsigned EPHSHK:1;
+      unsigned EPSTALL:1;
+      unsigned EPINEN:1;
+      unsigned EPOUTEN:1;
+      unsigned EPCONDIS:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EPTXEN:1;
+      unsigned EPRXEN:1;
+    };
+  };
+} U1EP7BITS;
+extern volatile U1EP7BITS U1EP7bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EP8 __attribute__((__sfr__));
+__extension__ typedef struct tagU1EP8BITS {
+  union {
+    struct {
+      unsigned EPHSHK:1;
+      unsigned EPSTALL:1;
+      unsigned EPINEN:1;
+      unsigned EPOUTEN:1;
+      unsigned EPCONDIS:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EPTXEN:1;
+      unsigned EPRXEN:1;
+    };
+  };
+} U1EP8BITS;
+extern volatile U1EP8BITS U1EP8bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EP9 __attribute__((__sfr__));
+__extension__ typedef struct tagU1EP9BITS {
+  union {
+    struct {
+      unsigned EPHSHK:1;
+      unsigned EPSTALL:1;
+      unsigned EPINEN:1;
+      unsigned EPOUTEN:1;
+      unsigned EPCONDIS:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EPTXEN:1;
+      unsigned EPRXEN:1;
+    };
+  };
+} U1EP9BITS;
+extern volatile U1EP9BITS U1EP9bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EP10 __attribute__((__sfr__));
+__extension__ typedef struct tagU1EP10BITS {
+  union {
+    struct {
+      unsigned EPHSHK:1;
+      unsigned EPSTALL:1;
+      unsigned EPINEN:1;
+      unsigned EPOUTEN:1;
+      unsigned EPCONDIS:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EPTXEN:1;
+      unsigned EPRXEN:1;
+    };
+  };
+} U1EP10BITS;
+extern volatile U1EP10BITS U1EP10bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EP11 __attribute__((__sfr__));
+__extension__ typedef struct tagU1EP11BITS {
+  union {
+    struct {
+      unsigned EPHSHK:1;
+      unsigned EPSTALL:1;
+      unsigned EPINEN:1;
+      unsigned EPOUTEN:1;
+      unsigned EPCONDIS:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EPTXEN:1;
+      unsigned EPRXEN:1;
+    };
+  };
+} U1EP11BITS;
+extern volatile U1EP11BITS U1EP11bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EP12 __attribute__((__sfr__));
+__extension__ typedef struct tagU1EP12BITS {
+  union {
+    struct {
+      unsigned EPHSHK:1;
+      unsigned EPSTALL:1;
+      unsigned EPINEN:1;
+      unsigned EPOUTEN:1;
+      unsigned EPCONDIS:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EPTXEN:1;
+      unsigned EPRXEN:1;
+    };
+  };
+} U1EP12BITS;
+extern volatile U1EP12BITS U1EP12bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EP13 __attribute__((__sfr__));
+__extension__ typedef struct tagU1EP13BITS {
+  union {
+    struct {
+      unsigned EPHSHK:1;
+      unsigned EPSTALL:1;
+      unsigned EPINEN:1;
+      unsigned EPOUTEN:1;
+      unsigned EPCONDIS:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EPTXEN:1;
+      unsigned EPRXEN:1;
+    };
+  };
+} U1EP13BITS;
+extern volatile U1EP13BITS U1EP13bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EP14 __attribute__((__sfr__));
+__extension__ typedef struct tagU1EP14BITS {
+  union {
+    struct {
+      unsigned EPHSHK:1;
+      unsigned EPSTALL:1;
+      unsigned EPINEN:1;
+      unsigned EPOUTEN:1;
+      unsigned EPCONDIS:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EPTXEN:1;
+      unsigned EPRXEN:1;
+    };
+  };
+} U1EP14BITS;
+extern volatile U1EP14BITS U1EP14bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1EP15 __attribute__((__sfr__));
+__extension__ typedef struct tagU1EP15BITS {
+  union {
+    struct {
+      unsigned EPHSHK:1;
+      unsigned EPSTALL:1;
+      unsigned EPINEN:1;
+      unsigned EPOUTEN:1;
+      unsigned EPCONDIS:1;
+    };
+    struct {
+      unsigned :2;
+      unsigned EPTXEN:1;
+      unsigned EPRXEN:1;
+    };
+  };
+} U1EP15BITS;
+extern volatile U1EP15BITS U1EP15bits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1PWMRRS __attribute__((__sfr__));
+__extension__ typedef struct tagU1PWMRRSBITS {
+  union {
+    struct {
+      unsigned USBRS0:1;
+      unsigned USBRS1:1;
+      unsigned USBRS2:1;
+      unsigned USBRS3:1;
+      unsigned USBRS4:1;
+      unsigned USBRS5:1;
+      unsigned USBRS6:1;
+      unsigned USBRS7:1;
+      unsigned USBR0:1;
+      unsigned USBR1:1;
+      unsigned USBR2:1;
+      unsigned USBR3:1;
+      unsigned USBR4:1;
+      unsigned USBR5:1;
+      unsigned USBR6:1;
+      unsigned USBR7:1;
+    };
+    struct {
+      unsigned USBRS:8;
+      unsigned USBR:8;
+    };
+    struct {
+      unsigned PER:8;
+      unsigned DC:8;
+    };
+    struct {
+      unsigned PER0:1;
+      unsigned PER1:1;
+      unsigned PER2:1;
+      unsigned PER3:1;
+      unsigned PER4:1;
+      unsigned PER5:1;
+      unsigned PER6:1;
+      unsigned PER7:1;
+      unsigned DC0:1;
+      unsigned DC1:1;
+      unsigned DC2:1;
+      unsigned DC3:1;
+      unsigned DC4:1;
+      unsigned DC5:1;
+      unsigned DC6:1;
+      unsigned DC7:1;
+    };
+  };
+} U1PWMRRSBITS;
+extern volatile U1PWMRRSBITS U1PWMRRSbits __attribute__((__sfr__));
+
+extern volatile unsigned int  U1PWMCON __attribute__((__sfr__));
+__extension__ typedef struct tagU1PWMCONBITS {
+  union {
+    struct {
+      unsigned :8;
+      unsigned CNTEN:1;
+      unsigned PWMPOL:1;
+      unsigned USBTSEL0:1;
+      unsigned USBTSEL1:1;
+      unsigned USBTSEL2:1;
+      unsigned :2;
+      unsigned PWMEN:1;
+    };
+    struct {
+      unsigned :10;
+      unsigned USBTSEL:3;
+    };
+  };
+} U1PWMCONBITS;
+extern volatile U1PWMCONBITS U1PWMCONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  PMCON __attribute__((__sfr__));
+__extension__ typedef struct tagPMCONBITS {
+  union {
+    struct {
+      unsigned RDSP:1;
+      unsigned WRSP:1;
+      unsigned BEP:1;
+      unsigned CS1P:1;
+      unsigned CS2P:1;
+      unsigned ALP:1;
+      unsigned CSF0:1;
+      unsigned CSF1:1;
+      unsigned PTRDEN:1;
+      unsigned PTWREN:1;
+      unsigned PTBEEN:1;
+      unsigned ADRMUX0:1;
+      unsigned ADRMUX1:1;
+      unsigned PSIDL:1;
+      unsigned :1;
+      unsigned PMPEN:1;
+    };
+    struct {
+      unsigned :6;
+      unsigned CSF:2;
+      unsigned :3;
+      unsigned ADRMUX:2;
+    };
+  };
+} PMCONBITS;
+extern volatile PMCONBITS PMCONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  PMMODE __attribute__((__sfr__));
+__extension__ typedef struct tagPMMODEBITS {
+  union {
+    struct {
+      unsigned WAITE0:1;
+      unsigned WAITE1:1;
+      unsigned WAITM0:1;
+      unsigned WAITM1:1;
+      unsigned WAITM2:1;
+      unsigned WAITM3:1;
+      unsigned WAITB0:1;
+      unsigned WAITB1:1;
+      unsigned MODE0:1;
+      unsigned MODE1:1;
+      unsigned MODE16:1;
+      unsigned INCM0:1;
+      unsigned INCM1:1;
+      unsigned IRQM0:1;
+      unsigned IRQM1:1;
+      unsigned BUSY:1;
+    };
+    struct {
+      unsigned WAITE:2;
+      unsigned WAITM:4;
+      unsigned WAITB:2;
+      unsigned MODE:2;
+      unsigned :1;
+      unsigned INCM:2;
+      unsigned IRQM:2;
+    };
+  };
+} PMMODEBITS;
+extern volatile PMMODEBITS PMMODEbits __attribute__((__sfr__));
+
+extern volatile unsigned int  PMADDR __attribute__((__sfr__));
+__extension__ typedef struct tagPMADDRBITS {
+  union {
+    struct {
+      unsigned :14;
+      unsigned CS1:1;
+      unsigned CS2:1;
+    };
+    struct {
+      unsigned ADDR:14;
+      unsigned CS:2;
+    };
+  };
+} PMADDRBITS;
+extern volatile PMADDRBITS PMADDRbits __attribute__((__sfr__));
+
+extern volatile unsigned int  PMDOUT1 __attribute__((__sfr__));
+__extension__ typedef struct tagPMDOUT1BITS {
+  union {
+    struct {
+      unsigned :14;
+      unsigned CS1:1;
+      unsigned CS2:1;
+    };
+    struct {
+      unsigned ADDR:14;
+      unsigned CS:2;
+    };
+  };
+} PMDOUT1BITS;
+extern volatile PMDOUT1BITS PMDOUT1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  PMDOUT2 __attribute__((__sfr__));
+extern volatile unsigned int  PMDIN1 __attribute__((__sfr__));
+extern volatile unsigned int  PMDIN2 __attribute__((__sfr__));
+extern volatile unsigned int  PMAEN __attribute__((__sfr__));
+typedef struct tagPMAENBITS {
+  unsigned PTEN0:1;
+  unsigned PTEN1:1;
+  unsigned PTEN2:1;
+  unsigned PTEN3:1;
+  unsigned PTEN4:1;
+  unsigned PTEN5:1;
+  unsigned PTEN6:1;
+  unsigned PTEN7:1;
+  unsigned PTEN8:1;
+  unsigned PTEN9:1;
+  unsigned PTEN10:1;
+  unsigned PTEN11:1;
+  unsigned PTEN12:1;
+  unsigned PTEN13:1;
+  unsigned PTEN14:1;
+  unsigned PTEN15:1;
+} PMAENBITS;
+extern volatile PMAENBITS PMAENbits __attribute__((__sfr__));
+
+extern volatile unsigned int  PMSTAT __attribute__((__sfr__));
+typedef struct tagPMSTATBITS {
+  unsigned OB0E:1;
+  unsigned OB1E:1;
+  unsigned OB2E:1;
+  unsigned OB3E:1;
+  unsigned :2;
+  unsigned OBUF:1;
+  unsigned OBE:1;
+  unsigned IB0F:1;
+  unsigned IB1F:1;
+  unsigned IB2F:1;
+  unsigned IB3F:1;
+  unsigned :2;
+  unsigned IBOV:1;
+  unsigned IBF:1;
+} PMSTATBITS;
+extern volatile PMSTATBITS PMSTATbits __attribute__((__sfr__));
+
+extern volatile unsigned int  ALRMVAL __attribute__((__sfr__));
+extern volatile unsigned int  ALCFGRPT __attribute__((__sfr__));
+__extension__ typedef struct tagALCFGRPTBITS {
+  union {
+    struct {
+      unsigned ARPT0:1;
+      unsigned ARPT1:1;
+      unsigned ARPT2:1;
+      unsigned ARPT3:1;
+      unsigned ARPT4:1;
+      unsigned ARPT5:1;
+      unsigned ARPT6:1;
+      unsigned ARPT7:1;
+      unsigned ALRMPTR0:1;
+      unsigned ALRMPTR1:1;
+      unsigned AMASK0:1;
+      unsigned AMASK1:1;
+      unsigned AMASK2:1;
+      unsigned AMASK3:1;
+      unsigned CHIME:1;
+      unsigned ALRMEN:1;
+    };
+    struct {
+      unsigned ARPT:8;
+      unsigned ALRMPTR:2;
+      unsigned AMASK:4;
+    };
+  };
+} ALCFGRPTBITS;
+extern volatile ALCFGRPTBITS ALCFGRPTbits __attribute__((__sfr__));
+
+extern volatile unsigned int  RTCVAL __attribute__((__sfr__));
+extern volatile unsigned int  RCFGCAL __attribute__((__sfr__));
+__extension__ typedef struct tagRCFGCALBITS {
+  union {
+    struct {
+      unsigned CAL0:1;
+      unsigned CAL1:1;
+      unsigned CAL2:1;
+      unsigned CAL3:1;
+      unsigned CAL4:1;
+      unsigned CAL5:1;
+      unsigned CAL6:1;
+      unsigned CAL7:1;
+      unsigned RTCPTR0:1;
+      unsigned RTCPTR1:1;
+      unsigned RTCOE:1;
+      unsigned HALFSEC:1;
+      unsigned RTCSYNC:1;
+      unsigned RTCWREN:1;
+      unsigned :1;
+      unsigned RTCEN:1;
+    };
+    struct {
+      unsigned CAL:8;
+      unsigned RTCPTR:2;
+    };
+  };
+} RCFGCALBITS;
+extern volatile RCFGCALBITS RCFGCALbits __attribute__((__sfr__));
+
+extern volatile unsigned int  CMSTAT __attribute__((__sfr__));
+typedef struct tagCMSTATBITS {
+  unsigned C1OUT:1;
+  unsigned C2OUT:1;
+  unsigned C3OUT:1;
+  unsigned C4OUT:1;
+  unsigned C5OUT:1;
+  unsigned C6OUT:1;
+  unsigned :2;
+  unsigned C1EVT:1;
+  unsigned C2EVT:1;
+  unsigned C3EVT:1;
+  unsigned C4EVT:1;
+  unsigned C5EVT:1;
+  unsigned C6EVT:1;
+  unsigned :1;
+  unsigned CMIDL:1;
+} CMSTATBITS;
+extern volatile CMSTATBITS CMSTATbits __attribute__((__sfr__));
+
+extern volatile unsigned int  CVRCON __attribute__((__sfr__));
+__extension__ typedef struct tagCVRCONBITS {
+  union {
+    struct {
+      unsigned CVR0:1;
+      unsigned CVR1:1;
+      unsigned CVR2:1;
+      unsigned CVR3:1;
+      unsigned CVRSS:1;
+      unsigned CVRR:1;
+      unsigned CVROE:1;
+      unsigned CVREN:1;
+    };
+    struct {
+      unsigned CVR:4;
+    };
+  };
+} CVRCONBITS;
+extern volatile CVRCONBITS CVRCONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  CM1CON __attribute__((__sfr__));
+__extension__ typedef struct tagCM1CONBITS {
+  union {
+    struct {
+      unsigned CCH0:1;
+      unsigned CCH1:1;
+      unsigned :2;
+      unsigned CREF:1;
+      unsigned :1;
+      unsigned EVPOL0:1;
+      unsigned EVPOL1:1;
+      unsigned COUT:1;
+      unsigned CEVT:1;
+      unsigned :3;
+      unsigned CPOL:1;
+      unsigned COE:1;
+      unsigned CON:1;
+    };
+    struct {
+      unsigned CCH:2;
+      unsigned :4;
+      unsigned EVPOL:2;
+    };
+    struct {
+      unsigned :15;
+      unsigned CEN:1;
+    };
+  };
+} CM1CONBITS;
+extern volatile CM1CONBITS CM1CONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  CM2CON __attribute__((__sfr__));
+__extension__ typedef struct tagCM2CONBITS {
+  union {
+    struct {
+      unsigned CCH0:1;
+      unsigned CCH1:1;
+      unsigned :2;
+      unsigned CREF:1;
+      unsigned :1;
+      unsigned EVPOL0:1;
+      unsigned EVPOL1:1;
+      unsigned COUT:1;
+      unsigned CEVT:1;
+      unsigned :3;
+      unsigned CPOL:1;
+      unsigned COE:1;
+      unsigned CON:1;
+    };
+    struct {
+      unsigned CCH:2;
+      unsigned :4;
+      unsigned EVPOL:2;
+    };
+    struct {
+      unsigned :15;
+      unsigned CEN:1;
+    };
+  };
+} CM2CONBITS;
+extern volatile CM2CONBITS CM2CONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  CM3CON __attribute__((__sfr__));
+__extension__ typedef struct tagCM3CONBITS {
+  union {
+    struct {
+      unsigned CCH0:1;
+      unsigned CCH1:1;
+      unsigned :2;
+      unsigned CREF:1;
+      unsigned :1;
+      unsigned EVPOL0:1;
+      unsigned EVPOL1:1;
+      unsigned COUT:1;
+      unsigned CEVT:1;
+      unsigned :3;
+      unsigned CPOL:1;
+      unsigned COE:1;
+      unsigned CON:1;
+    };
+    struct {
+      unsigned CCH:2;
+      unsigned :4;
+      unsigned EVPOL:2;
+    };
+    struct {
+      unsigned :15;
+      unsigned CEN:1;
+    };
+  };
+} CM3CONBITS;
+extern volatile CM3CONBITS CM3CONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  CRCCON __attribute__((__sfr__));
+__extension__ typedef struct tagCRCCONBITS {
+  union {
+    struct {
+      unsigned PLEN0:1;
+      unsigned PLEN1:1;
+      unsigned PLEN2:1;
+      unsigned PLEN3:1;
+      unsigned CRCGO:1;
+      unsigned :1;
+      unsigned CRCMPT:1;
+      unsigned CRCFUL:1;
+      unsigned VWORD0:1;
+      unsigned VWORD1:1;
+      unsigned VWORD2:1;
+      unsigned VWORD3:1;
+      unsigned VWORD4:1;
+      unsigned CSIDL:1;
+    };
+    struct {
+      unsigned PLEN:4;
+      unsigned :4;
+      unsigned VWORD:5;
+    };
+  };
+} CRCCONBITS;
+extern volatile CRCCONBITS CRCCONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  CRCXOR __attribute__((__sfr__));
+typedef struct tagCRCXORBITS {
+  unsigned :1;
+  unsigned X1:1;
+  unsigned X2:1;
+  unsigned X3:1;
+  unsigned X4:1;
+  unsigned X5:1;
+  unsigned X6:1;
+  unsigned X7:1;
+  unsigned X8:1;
+  unsigned X9:1;
+  unsigned X10:1;
+  unsigned X11:1;
+  unsigned X12:1;
+  unsigned X13:1;
+  unsigned X14:1;
+  unsigned X15:1;
+} CRCXORBITS;
+extern volatile CRCXORBITS CRCXORbits __attribute__((__sfr__));
+
+extern volatile unsigned int  CRCDAT __attribute__((__sfr__));
+extern volatile unsigned int  CRCWDAT __attribute__((__sfr__));
+extern volatile unsigned int  RPINR0 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR0BITS {
+  union {
+    struct {
+      unsigned :8;
+      unsigned INT1R0:1;
+      unsigned INT1R1:1;
+      unsigned INT1R2:1;
+      unsigned INT1R3:1;
+      unsigned INT1R4:1;
+      unsigned INT1R5:1;
+    };
+    struct {
+      unsigned :8;
+      unsigned INT1R:6;
+    };
+  };
+} RPINR0BITS;
+extern volatile RPINR0BITS RPINR0bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR1 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR1BITS {
+  union {
+    struct {
+      unsigned INT2R0:1;
+      unsigned INT2R1:1;
+      unsigned INT2R2:1;
+      unsigned INT2R3:1;
+      unsigned INT2R4:1;
+      unsigned INT2R5:1;
+      unsigned :2;
+      unsigned INT3R0:1;
+      unsigned INT3R1:1;
+      unsigned INT3R2:1;
+      unsigned INT3R3:1;
+      unsigned INT3R4:1;
+      unsigned INT3R5:1;
+    };
+    struct {
+      unsigned INT2R:6;
+      unsigned :2;
+      unsigned INT3R:6;
+    };
+  };
+} RPINR1BITS;
+extern volatile RPINR1BITS RPINR1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR2 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR2BITS {
+  union {
+    struct {
+      unsigned INT4R0:1;
+      unsigned INT4R1:1;
+      unsigned INT4R2:1;
+      unsigned INT4R3:1;
+      unsigned INT4R4:1;
+      unsigned INT4R5:1;
+      unsigned :2;
+      unsigned T1CKR0:1;
+      unsigned T1CKR1:1;
+      unsigned T1CKR2:1;
+      unsigned T1CKR3:1;
+      unsigned T1CKR4:1;
+      unsigned T1CKR5:1;
+    };
+    struct {
+      unsigned INT4R:6;
+      unsigned :2;
+      unsigned T1CKR:6;
+    };
+  };
+} RPINR2BITS;
+extern volatile RPINR2BITS RPINR2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR3 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR3BITS {
+  union {
+    struct {
+      unsigned T2CKR0:1;
+      unsigned T2CKR1:1;
+      unsigned T2CKR2:1;
+      unsigned T2CKR3:1;
+      unsigned T2CKR4:1;
+      unsigned T2CKR5:1;
+      unsigned :2;
+      unsigned T3CKR0:1;
+      unsigned T3CKR1:1;
+      unsigned T3CKR2:1;
+      unsigned T3CKR3:1;
+      unsigned T3CKR4:1;
+      unsigned T3CKR5:1;
+    };
+    struct {
+      unsigned T2CKR:6;
+      unsigned :2;
+      unsigned T3CKR:6;
+    };
+  };
+} RPINR3BITS;
+extern volatile RPINR3BITS RPINR3bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR4 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR4BITS {
+  union {
+    struct {
+      unsigned T4CKR0:1;
+      unsigned T4CKR1:1;
+      unsigned T4CKR2:1;
+      unsigned T4CKR3:1;
+      unsigned T4CKR4:1;
+      unsigned T4CKR5:1;
+      unsigned :2;
+      unsigned T5CKR0:1;
+      unsigned T5CKR1:1;
+      unsigned T5CKR2:1;
+      unsigned T5CKR3:1;
+      unsigned T5CKR4:1;
+      unsigned T5CKR5:1;
+    };
+    struct {
+      unsigned T4CKR:6;
+      unsigned :2;
+      unsigned T5CKR:6;
+    };
+  };
+} RPINR4BITS;
+extern volatile RPINR4BITS RPINR4bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR7 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR7BITS {
+  union {
+    struct {
+      unsigned IC1R0:1;
+      unsigned IC1R1:1;
+      unsigned IC1R2:1;
+      unsigned IC1R3:1;
+      unsigned IC1R4:1;
+      unsigned IC1R5:1;
+      unsigned :2;
+      unsigned IC2R0:1;
+      unsigned IC2R1:1;
+      unsigned IC2R2:1;
+      unsigned IC2R3:1;
+      unsigned IC2R4:1;
+      unsigned IC2R5:1;
+    };
+    struct {
+      unsigned IC1R:6;
+      unsigned :2;
+      unsigned IC2R:6;
+    };
+  };
+} RPINR7BITS;
+extern volatile RPINR7BITS RPINR7bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR8 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR8BITS {
+  union {
+    struct {
+      unsigned IC3R0:1;
+      unsigned IC3R1:1;
+      unsigned IC3R2:1;
+      unsigned IC3R3:1;
+      unsigned IC3R4:1;
+      unsigned IC3R5:1;
+      unsigned :2;
+      unsigned IC4R0:1;
+      unsigned IC4R1:1;
+      unsigned IC4R2:1;
+      unsigned IC4R3:1;
+      unsigned IC4R4:1;
+      unsigned IC4R5:1;
+    };
+    struct {
+      unsigned IC3R:6;
+      unsigned :2;
+      unsigned IC4R:6;
+    };
+  };
+} RPINR8BITS;
+extern volatile RPINR8BITS RPINR8bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR9 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR9BITS {
+  union {
+    struct {
+      unsigned IC5R0:1;
+      unsigned IC5R1:1;
+      unsigned IC5R2:1;
+      unsigned IC5R3:1;
+      unsigned IC5R4:1;
+      unsigned IC5R5:1;
+      unsigned :2;
+      unsigned IC6R0:1;
+      unsigned IC6R1:1;
+      unsigned IC6R2:1;
+      unsigned IC6R3:1;
+      unsigned IC6R4:1;
+      unsigned IC6R5:1;
+    };
+    struct {
+      unsigned IC5R:6;
+      unsigned :2;
+      unsigned IC6R:6;
+    };
+  };
+} RPINR9BITS;
+extern volatile RPINR9BITS RPINR9bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR10 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR10BITS {
+  union {
+    struct {
+      unsigned IC7R0:1;
+      unsigned IC7R1:1;
+      unsigned IC7R2:1;
+      unsigned IC7R3:1;
+      unsigned IC7R4:1;
+      unsigned IC7R5:1;
+      unsigned :2;
+      unsigned IC8R0:1;
+      unsigned IC8R1:1;
+      unsigned IC8R2:1;
+      unsigned IC8R3:1;
+      unsigned IC8R4:1;
+      unsigned IC8R5:1;
+    };
+    struct {
+      unsigned IC7R:6;
+      unsigned :2;
+      unsigned IC8R:6;
+    };
+  };
+} RPINR10BITS;
+extern volatile RPINR10BITS RPINR10bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR11 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR11BITS {
+  union {
+    struct {
+      unsigned OCFAR0:1;
+      unsigned OCFAR1:1;
+      unsigned OCFAR2:1;
+      unsigned OCFAR3:1;
+      unsigned OCFAR4:1;
+      unsigned OCFAR5:1;
+      unsigned :2;
+      unsigned OCFBR0:1;
+      unsigned OCFBR1:1;
+      unsigned OCFBR2:1;
+      unsigned OCFBR3:1;
+      unsigned OCFBR4:1;
+      unsigned OCFBR5:1;
+    };
+    struct {
+      unsigned OCFAR:6;
+      unsigned :2;
+      unsigned OCFBR:6;
+    };
+  };
+} RPINR11BITS;
+extern volatile RPINR11BITS RPINR11bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR15 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR15BITS {
+  union {
+    struct {
+      unsigned :8;
+      unsigned IC9R0:1;
+      unsigned IC9R1:1;
+      unsigned IC9R2:1;
+      unsigned IC9R3:1;
+      unsigned IC9R4:1;
+      unsigned IC9R5:1;
+    };
+    struct {
+      unsigned :8;
+      unsigned IC9R:6;
+    };
+  };
+} RPINR15BITS;
+extern volatile RPINR15BITS RPINR15bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR17 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR17BITS {
+  union {
+    struct {
+      unsigned :8;
+      unsigned U3RXR0:1;
+      unsigned U3RXR1:1;
+      unsigned U3RXR2:1;
+      unsigned U3RXR3:1;
+      unsigned U3RXR4:1;
+      unsigned U3RXR5:1;
+    };
+    struct {
+      unsigned :8;
+      unsigned U3RXR:6;
+    };
+  };
+} RPINR17BITS;
+extern volatile RPINR17BITS RPINR17bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR18 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR18BITS {
+  union {
+    struct {
+      unsigned U1RXR0:1;
+      unsigned U1RXR1:1;
+      unsigned U1RXR2:1;
+      unsigned U1RXR3:1;
+      unsigned U1RXR4:1;
+      unsigned U1RXR5:1;
+      unsigned :2;
+      unsigned U1CTSR0:1;
+      unsigned U1CTSR1:1;
+      unsigned U1CTSR2:1;
+      unsigned U1CTSR3:1;
+      unsigned U1CTSR4:1;
+      unsigned U1CTSR5:1;
+    };
+    struct {
+      unsigned U1RXR:6;
+      unsigned :2;
+      unsigned U1CTSR:6;
+    };
+  };
+} RPINR18BITS;
+extern volatile RPINR18BITS RPINR18bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR19 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR19BITS {
+  union {
+    struct {
+      unsigned U2RXR0:1;
+      unsigned U2RXR1:1;
+      unsigned U2RXR2:1;
+      unsigned U2RXR3:1;
+      unsigned U2RXR4:1;
+      unsigned U2RXR5:1;
+      unsigned :2;
+      unsigned U2CTSR0:1;
+      unsigned U2CTSR1:1;
+      unsigned U2CTSR2:1;
+      unsigned U2CTSR3:1;
+      unsigned U2CTSR4:1;
+      unsigned U2CTSR5:1;
+    };
+    struct {
+      unsigned U2RXR:6;
+      unsigned :2;
+      unsigned U2CTSR:6;
+    };
+  };
+} RPINR19BITS;
+extern volatile RPINR19BITS RPINR19bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR20 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR20BITS {
+  union {
+    struct {
+      unsigned SDI1R0:1;
+      unsigned SDI1R1:1;
+      unsigned SDI1R2:1;
+      unsigned SDI1R3:1;
+      unsigned SDI1R4:1;
+      unsigned SDI1R5:1;
+      unsigned :2;
+      unsigned SCK1R0:1;
+      unsigned SCK1R1:1;
+      unsigned SCK1R2:1;
+      unsigned SCK1R3:1;
+      unsigned SCK1R4:1;
+      unsigned SCK1R5:1;
+    };
+    struct {
+      unsigned SDI1R:6;
+      unsigned :2;
+      unsigned SCK1R:6;
+    };
+  };
+} RPINR20BITS;
+extern volatile RPINR20BITS RPINR20bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR21 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR21BITS {
+  union {
+    struct {
+      unsigned SS1R0:1;
+      unsigned SS1R1:1;
+      unsigned SS1R2:1;
+      unsigned SS1R3:1;
+      unsigned SS1R4:1;
+      unsigned SS1R5:1;
+      unsigned :2;
+      unsigned U3CTSR0:1;
+      unsigned U3CTSR1:1;
+      unsigned U3CTSR2:1;
+      unsigned U3CTSR3:1;
+      unsigned U3CTSR4:1;
+      unsigned U3CTSR5:1;
+    };
+    struct {
+      unsigned SS1R:6;
+      unsigned :2;
+      unsigned U3CTSR:6;
+    };
+  };
+} RPINR21BITS;
+extern volatile RPINR21BITS RPINR21bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR22 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR22BITS {
+  union {
+    struct {
+      unsigned SDI2R0:1;
+      unsigned SDI2R1:1;
+      unsigned SDI2R2:1;
+      unsigned SDI2R3:1;
+      unsigned SDI2R4:1;
+      unsigned SDI2R5:1;
+      unsigned :2;
+      unsigned SCK2R0:1;
+      unsigned SCK2R1:1;
+      unsigned SCK2R2:1;
+      unsigned SCK2R3:1;
+      unsigned SCK2R4:1;
+      unsigned SCK2R5:1;
+    };
+    struct {
+      unsigned SDI2R:6;
+      unsigned :2;
+      unsigned SCK2R:6;
+    };
+  };
+} RPINR22BITS;
+extern volatile RPINR22BITS RPINR22bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR23 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR23BITS {
+  union {
+    struct {
+      unsigned SS2R0:1;
+      unsigned SS2R1:1;
+      unsigned SS2R2:1;
+      unsigned SS2R3:1;
+      unsigned SS2R4:1;
+      unsigned SS2R5:1;
+    };
+    struct {
+      unsigned SS2R:6;
+    };
+  };
+} RPINR23BITS;
+extern volatile RPINR23BITS RPINR23bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR27 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR27BITS {
+  union {
+    struct {
+      unsigned U4RXR0:1;
+      unsigned U4RXR1:1;
+      unsigned U4RXR2:1;
+      unsigned U4RXR3:1;
+      unsigned U4RXR4:1;
+      unsigned U4RXR5:1;
+      unsigned :2;
+      unsigned U4CTSR0:1;
+      unsigned U4CTSR1:1;
+      unsigned U4CTSR2:1;
+      unsigned U4CTSR3:1;
+      unsigned U4CTSR4:1;
+      unsigned U4CTSR5:1;
+    };
+    struct {
+      unsigned U4RXR:6;
+      unsigned :2;
+      unsigned U4CTSR:6;
+    };
+  };
+} RPINR27BITS;
+extern volatile RPINR27BITS RPINR27bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR28 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR28BITS {
+  union {
+    struct {
+      unsigned SDI3R0:1;
+      unsigned SDI3R1:1;
+      unsigned SDI3R2:1;
+      unsigned SDI3R3:1;
+      unsigned SDI3R4:1;
+      unsigned SDI3R5:1;
+      unsigned :2;
+      unsigned SCK3R0:1;
+      unsigned SCK3R1:1;
+      unsigned SCK3R2:1;
+      unsigned SCK3R3:1;
+      unsigned SCK3R4:1;
+      unsigned SCK3R5:1;
+    };
+    struct {
+      unsigned SDI3R:6;
+      unsigned :2;
+      unsigned SCK3R:6;
+    };
+  };
+} RPINR28BITS;
+extern volatile RPINR28BITS RPINR28bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPINR29 __attribute__((__sfr__));
+__extension__ typedef struct tagRPINR29BITS {
+  union {
+    struct {
+      unsigned SS3R0:1;
+      unsigned SS3R1:1;
+      unsigned SS3R2:1;
+      unsigned SS3R3:1;
+      unsigned SS3R4:1;
+      unsigned SS3R5:1;
+    };
+    struct {
+      unsigned SS3R:6;
+    };
+  };
+} RPINR29BITS;
+extern volatile RPINR29BITS RPINR29bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPOR0 __attribute__((__sfr__));
+__extension__ typedef struct tagRPOR0BITS {
+  union {
+    struct {
+      unsigned RP0R0:1;
+      unsigned RP0R1:1;
+      unsigned RP0R2:1;
+      unsigned RP0R3:1;
+      unsigned RP0R4:1;
+      unsigned RP0R5:1;
+      unsigned :2;
+      unsigned RP1R0:1;
+      unsigned RP1R1:1;
+      unsigned RP1R2:1;
+      unsigned RP1R3:1;
+      unsigned RP1R4:1;
+      unsigned RP1R5:1;
+    };
+    struct {
+      unsigned RP0R:6;
+      unsigned :2;
+      unsigned RP1R:6;
+    };
+  };
+} RPOR0BITS;
+extern volatile RPOR0BITS RPOR0bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPOR1 __attribute__((__sfr__));
+__extension__ typedef struct tagRPOR1BITS {
+  union {
+    struct {
+      unsigned RP2R0:1;
+      unsigned RP2R1:1;
+      unsigned RP2R2:1;
+      unsigned RP2R3:1;
+      unsigned RP2R4:1;
+      unsigned RP2R5:1;
+      unsigned :2;
+      unsigned RP3R0:1;
+      unsigned RP3R1:1;
+      unsigned RP3R2:1;
+      unsigned RP3R3:1;
+      unsigned RP3R4:1;
+      unsigned RP3R5:1;
+    };
+    struct {
+      unsigned RP2R:6;
+      unsigned :2;
+      unsigned RP3R:6;
+    };
+  };
+} RPOR1BITS;
+extern volatile RPOR1BITS RPOR1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPOR2 __attribute__((__sfr__));
+__extension__ typedef struct tagRPOR2BITS {
+  union {
+    struct {
+      unsigned RP4R0:1;
+      unsigned RP4R1:1;
+      unsigned RP4R2:1;
+      unsigned RP4R3:1;
+      unsigned RP4R4:1;
+      unsigned RP4R5:1;
+    };
+    struct {
+      unsigned RP4R:6;
+    };
+  };
+} RPOR2BITS;
+extern volatile RPOR2BITS RPOR2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPOR3 __attribute__((__sfr__));
+__extension__ typedef struct tagRPOR3BITS {
+  union {
+    struct {
+      unsigned RP6R0:1;
+      unsigned RP6R1:1;
+      unsigned RP6R2:1;
+      unsigned RP6R3:1;
+      unsigned RP6R4:1;
+      unsigned RP6R5:1;
+      unsigned :2;
+      unsigned RP7R0:1;
+      unsigned RP7R1:1;
+      unsigned RP7R2:1;
+      unsigned RP7R3:1;
+      unsigned RP7R4:1;
+      unsigned RP7R5:1;
+    };
+    struct {
+      unsigned RP6R:6;
+      unsigned :2;
+      unsigned RP7R:6;
+    };
+  };
+} RPOR3BITS;
+extern volatile RPOR3BITS RPOR3bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPOR4 __attribute__((__sfr__));
+__extension__ typedef struct tagRPOR4BITS {
+  union {
+    struct {
+      unsigned RP8R0:1;
+      unsigned RP8R1:1;
+      unsigned RP8R2:1;
+      unsigned RP8R3:1;
+      unsigned RP8R4:1;
+      unsigned RP8R5:1;
+      unsigned :2;
+      unsigned RP9R0:1;
+      unsigned RP9R1:1;
+      unsigned RP9R2:1;
+      unsigned RP9R3:1;
+      unsigned RP9R4:1;
+      unsigned RP9R5:1;
+    };
+    struct {
+      unsigned RP8R:6;
+      unsigned :2;
+      unsigned RP9R:6;
+    };
+  };
+} RPOR4BITS;
+extern volatile RPOR4BITS RPOR4bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPOR5 __attribute__((__sfr__));
+__extension__ typedef struct tagRPOR5BITS {
+  union {
+    struct {
+      unsigned RP10R0:1;
+      unsigned RP10R1:1;
+      unsigned RP10R2:1;
+      unsigned RP10R3:1;
+      unsigned RP10R4:1;
+      unsigned RP10R5:1;
+      unsigned :2;
+      unsigned RP11R0:1;
+      unsigned RP11R1:1;
+      unsigned RP11R2:1;
+      unsigned RP11R3:1;
+      unsigned RP11R4:1;
+      unsigned RP11R5:1;
+    };
+    struct {
+      unsigned RP10R:6;
+      unsigned :2;
+      unsigned RP11R:6;
+    };
+  };
+} RPOR5BITS;
+extern volatile RPOR5BITS RPOR5bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPOR6 __attribute__((__sfr__));
+__extension__ typedef struct tagRPOR6BITS {
+  union {
+    struct {
+      unsigned RP12R0:1;
+      unsigned RP12R1:1;
+      unsigned RP12R2:1;
+      unsigned RP12R3:1;
+      unsigned RP12R4:1;
+      unsigned RP12R5:1;
+      unsigned :2;
+      unsigned RP13R0:1;
+      unsigned RP13R1:1;
+      unsigned RP13R2:1;
+      unsigned RP13R3:1;
+      unsigned RP13R4:1;
+      unsigned RP13R5:1;
+    };
+    struct {
+      unsigned RP12R:6;
+      unsigned :2;
+      unsigned RP13R:6;
+    };
+  };
+} RPOR6BITS;
+extern volatile RPOR6BITS RPOR6bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPOR7 __attribute__((__sfr__));
+__extension__ typedef struct tagRPOR7BITS {
+  union {
+    struct {
+      unsigned RP14R0:1;
+      unsigned RP14R1:1;
+      unsigned RP14R2:1;
+      unsigned RP14R3:1;
+      unsigned RP14R4:1;
+      unsigned RP14R5:1;
+    };
+    struct {
+      unsigned RP14R:6;
+    };
+  };
+} RPOR7BITS;
+extern volatile RPOR7BITS RPOR7bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPOR8 __attribute__((__sfr__));
+__extension__ typedef struct tagRPOR8BITS {
+  union {
+    struct {
+      unsigned RP16R0:1;
+      unsigned RP16R1:1;
+      unsigned RP16R2:1;
+      unsigned RP16R3:1;
+      unsigned RP16R4:1;
+      unsigned RP16R5:1;
+      unsigned :2;
+      unsigned RP17R0:1;
+      unsigned RP17R1:1;
+      unsigned RP17R2:1;
+      unsigned RP17R3:1;
+      unsigned RP17R4:1;
+      unsigned RP17R5:1;
+    };
+    struct {
+      unsigned RP16R:6;
+      unsigned :2;
+      unsigned RP17R:6;
+    };
+  };
+} RPOR8BITS;
+extern volatile RPOR8BITS RPOR8bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPOR9 __attribute__((__sfr__));
+__extension__ typedef struct tagRPOR9BITS {
+  union {
+    struct {
+      unsigned RP18R0:1;
+      unsigned RP18R1:1;
+      unsigned RP18R2:1;
+      unsigned RP18R3:1;
+      unsigned RP18R4:1;
+      unsigned RP18R5:1;
+      unsigned :2;
+      unsigned RP19R0:1;
+      unsigned RP19R1:1;
+      unsigned RP19R2:1;
+      unsigned RP19R3:1;
+      unsigned RP19R4:1;
+      unsigned RP19R5:1;
+    };
+    struct {
+      unsigned RP18R:6;
+      unsigned :2;
+      unsigned RP19R:6;
+    };
+  };
+} RPOR9BITS;
+extern volatile RPOR9BITS RPOR9bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPOR10 __attribute__((__sfr__));
+__extension__ typedef struct tagRPOR10BITS {
+  union {
+    struct {
+      unsigned RP20R0:1;
+      unsigned RP20R1:1;
+      unsigned RP20R2:1;
+      unsigned RP20R3:1;
+      unsigned RP20R4:1;
+      unsigned RP20R5:1;
+      unsigned :2;
+      unsigned RP21R0:1;
+      unsigned RP21R1:1;
+      unsigned RP21R2:1;
+      unsigned RP21R3:1;
+      unsigned RP21R4:1;
+      unsigned RP21R5:1;
+    };
+    struct {
+      unsigned RP20R:6;
+      unsigned :2;
+      unsigned RP21R:6;
+    };
+  };
+} RPOR10BITS;
+extern volatile RPOR10BITS RPOR10bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPOR11 __attribute__((__sfr__));
+__extension__ typedef struct tagRPOR11BITS {
+  union {
+    struct {
+      unsigned RP22R0:1;
+      unsigned RP22R1:1;
+      unsigned RP22R2:1;
+      unsigned RP22R3:1;
+      unsigned RP22R4:1;
+      unsigned RP22R5:1;
+      unsigned :2;
+      unsigned RP23R0:1;
+      unsigned RP23R1:1;
+      unsigned RP23R2:1;
+      unsigned RP23R3:1;
+      unsigned RP23R4:1;
+      unsigned RP23R5:1;
+    };
+    struct {
+      unsigned RP22R:6;
+      unsigned :2;
+      unsigned RP23R:6;
+    };
+  };
+} RPOR11BITS;
+extern volatile RPOR11BITS RPOR11bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPOR12 __attribute__((__sfr__));
+__extension__ typedef struct tagRPOR12BITS {
+  union {
+    struct {
+      unsigned RP24R0:1;
+      unsigned RP24R1:1;
+      unsigned RP24R2:1;
+      unsigned RP24R3:1;
+      unsigned RP24R4:1;
+      unsigned RP24R5:1;
+      unsigned :2;
+      unsigned RP25R0:1;
+      unsigned RP25R1:1;
+      unsigned RP25R2:1;
+      unsigned RP25R3:1;
+      unsigned RP25R4:1;
+      unsigned RP25R5:1;
+    };
+    struct {
+      unsigned RP24R:6;
+      unsigned :2;
+      unsigned RP25R:6;
+    };
+  };
+} RPOR12BITS;
+extern volatile RPOR12BITS RPOR12bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPOR13 __attribute__((__sfr__));
+__extension__ typedef struct tagRPOR13BITS {
+  union {
+    struct {
+      unsigned RP26R0:1;
+      unsigned RP26R1:1;
+      unsigned RP26R2:1;
+      unsigned RP26R3:1;
+      unsigned RP26R4:1;
+      unsigned RP26R5:1;
+      unsigned :2;
+      unsigned RP27R0:1;
+      unsigned RP27R1:1;
+      unsigned RP27R2:1;
+      unsigned RP27R3:1;
+      unsigned RP27R4:1;
+      unsigned RP27R5:1;
+    };
+    struct {
+      unsigned RP26R:6;
+      unsigned :2;
+      unsigned RP27R:6;
+    };
+  };
+} RPOR13BITS;
+extern volatile RPOR13BITS RPOR13bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPOR14 __attribute__((__sfr__));
+__extension__ typedef struct tagRPOR14BITS {
+  union {
+    struct {
+      unsigned RP28R0:1;
+      unsigned RP28R1:1;
+      unsigned RP28R2:1;
+      unsigned RP28R3:1;
+      unsigned RP28R4:1;
+      unsigned RP28R5:1;
+      unsigned :2;
+      unsigned RP29R0:1;
+      unsigned RP29R1:1;
+      unsigned RP29R2:1;
+      unsigned RP29R3:1;
+      unsigned RP29R4:1;
+      unsigned RP29R5:1;
+    };
+    struct {
+      unsigned RP28R:6;
+      unsigned :2;
+      unsigned RP29R:6;
+    };
+  };
+} RPOR14BITS;
+extern volatile RPOR14BITS RPOR14bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RPOR15 __attribute__((__sfr__));
+__extension__ typedef struct tagRPOR15BITS {
+  union {
+    struct {
+      unsigned RP30R0:1;
+      unsigned RP30R1:1;
+      unsigned RP30R2:1;
+      unsigned RP30R3:1;
+      unsigned RP30R4:1;
+      unsigned RP30R5:1;
+    };
+    struct {
+      unsigned RP30R:6;
+    };
+  };
+} RPOR15BITS;
+extern volatile RPOR15BITS RPOR15bits __attribute__((__sfr__));
+
+extern volatile unsigned int  RCON __attribute__((__sfr__));
+__extension__ typedef struct tagRCONBITS {
+  union {
+    struct {
+      unsigned POR:1;
+      unsigned BOR:1;
+      unsigned IDLE:1;
+      unsigned SLEEP:1;
+      unsigned WDTO:1;
+      unsigned SWDTEN:1;
+      unsigned SWR:1;
+      unsigned EXTR:1;
+      unsigned VREGS:1;
+      unsigned CM:1;
+      unsigned :4;
+      unsigned IOPUWR:1;
+      unsigned TRAPR:1;
+    };
+    struct {
+      unsigned :8;
+      unsigned PMSLP:1;
+    };
+  };
+} RCONBITS;
+extern volatile RCONBITS RCONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  OSCCON __attribute__((__sfr__));
+__extension__ typedef struct tagOSCCONBITS {
+  union {
+    struct {
+      unsigned OSWEN:1;
+      unsigned SOSCEN:1;
+      unsigned POSCEN:1;
+      unsigned CF:1;
+      unsigned :1;
+      unsigned LOCK:1;
+      unsigned IOLOCK:1;
+      unsigned CLKLOCK:1;
+      unsigned NOSC0:1;
+      unsigned NOSC1:1;
+      unsigned NOSC2:1;
+      unsigned :1;
+      unsigned COSC0:1;
+      unsigned COSC1:1;
+      unsigned COSC2:1;
+    };
+    struct {
+      unsigned :8;
+      unsigned NOSC:3;
+      unsigned :1;
+      unsigned COSC:3;
+    };
+    struct {
+      unsigned :1;
+      unsigned LPOSCEN:1;
+    };
+  };
+} OSCCONBITS;
+extern volatile OSCCONBITS OSCCONbits __attribute__((__sfr__));
+
+extern volatile unsigned char OSCCONL __attribute__((__sfr__));
+extern volatile unsigned char OSCCONH __attribute__((__sfr__));
+extern volatile unsigned int  CLKDIV __attribute__((__sfr__));
+__extension__ typedef struct tagCLKDIVBITS {
+  union {
+    struct {
+      unsigned :6;
+      unsigned USBDOZE0:1;
+      unsigned USBDOZE1:1;
+      unsigned RCDIV0:1;
+      unsigned RCDIV1:1;
+      unsigned RCDIV2:1;
+      unsigned DOZEN:1;
+      unsigned DOZE0:1;
+      unsigned DOZE1:1;
+      unsigned DOZE2:1;
+      unsigned ROI:1;
+    };
+    struct {
+      unsigned :6;
+      unsigned USBDOZE:2;
+      unsigned RCDIV:3;
+      unsigned :1;
+      unsigned DOZE:3;
+    };
+    struct {
+      unsigned :6;
+      unsigned CPDIV:2;
+    };
+    struct {
+      unsigned :6;
+      unsigned CPDIV0:1;
+      unsigned CPDIV1:1;
+    };
+  };
+} CLKDIVBITS;
+extern volatile CLKDIVBITS CLKDIVbits __attribute__((__sfr__));
+
+extern volatile unsigned int  OSCTUN __attribute__((__sfr__));
+__extension__ typedef struct tagOSCTUNBITS {
+  union {
+    struct {
+      unsigned TUN0:1;
+      unsigned TUN1:1;
+      unsigned TUN2:1;
+      unsigned TUN3:1;
+      unsigned TUN4:1;
+      unsigned TUN5:1;
+    };
+    struct {
+      unsigned TUN:6;
+    };
+  };
+} OSCTUNBITS;
+extern volatile OSCTUNBITS OSCTUNbits __attribute__((__sfr__));
+
+extern          unsigned int  REFOCON __attribute__((__sfr__));
+__extension__ typedef struct tagREFOCONBITS {
+  union {
+    struct {
+      unsigned :8;
+      unsigned RODIV0:1;
+      unsigned RODIV1:1;
+      unsigned RODIV2:1;
+      unsigned RODIV3:1;
+      unsigned ROSEL:1;
+      unsigned ROSSLP:1;
+      unsigned :1;
+      unsigned ROON:1;
+    };
+    struct {
+      unsigned :8;
+      unsigned RODIV:4;
+    };
+  };
+} REFOCONBITS;
+extern          REFOCONBITS REFOCONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  NVMCON __attribute__((__sfr__));
+__extension__ typedef struct tagNVMCONBITS {
+  union {
+    struct {
+      unsigned NVMOP0:1;
+      unsigned NVMOP1:1;
+      unsigned NVMOP2:1;
+      unsigned NVMOP3:1;
+      unsigned :2;
+      unsigned ERASE:1;
+      unsigned :6;
+      unsigned WRERR:1;
+      unsigned WREN:1;
+      unsigned WR:1;
+    };
+    struct {
+      unsigned NVMOP:4;
+    };
+    struct {
+      unsigned PROGOP:4;
+    };
+    struct {
+      unsigned PROGOP0:1;
+      unsigned PROGOP1:1;
+      unsigned PROGOP2:1;
+      unsigned PROGOP3:1;
+    };
+  };
+} NVMCONBITS;
+extern volatile NVMCONBITS NVMCONbits __attribute__((__sfr__));
+
+extern volatile unsigned int  NVMKEY __attribute__((__sfr__));
+extern volatile unsigned int  PMD1 __attribute__((__sfr__));
+typedef struct tagPMD1BITS {
+  unsigned ADC1MD:1;
+  unsigned :2;
+  unsigned SPI1MD:1;
+  unsigned SPI2MD:1;
+  unsigned U1MD:1;
+  unsigned U2MD:1;
+  unsigned I2C1MD:1;
+  unsigned :3;
+  unsigned T1MD:1;
+  unsigned T2MD:1;
+  unsigned T3MD:1;
+  unsigned T4MD:1;
+  unsigned T5MD:1;
+} PMD1BITS;
+extern volatile PMD1BITS PMD1bits __attribute__((__sfr__));
+
+extern volatile unsigned int  PMD2 __attribute__((__sfr__));
+typedef struct tagPMD2BITS {
+  unsigned OC1MD:1;
+  unsigned OC2MD:1;
+  unsigned OC3MD:1;
+  unsigned OC4MD:1;
+  unsigned OC5MD:1;
+  unsigned OC6MD:1;
+  unsigned OC7MD:1;
+  unsigned OC8MD:1;
+  unsigned IC1MD:1;
+  unsigned IC2MD:1;
+  unsigned IC3MD:1;
+  unsigned IC4MD:1;
+  unsigned IC5MD:1;
+  unsigned IC6MD:1;
+  unsigned IC7MD:1;
+  unsigned IC8MD:1;
+} PMD2BITS;
+extern volatile PMD2BITS PMD2bits __attribute__((__sfr__));
+
+extern volatile unsigned int  PMD3 __attribute__((__sfr__));
+__extension__ typedef struct tagPMD3BITS {
+  union {
+    struct {
+      unsigned :1;
+      unsigned I2C2MD:1;
+      unsigned I2C3MD:1;
+      unsigned U3MD:1;
+      unsigned :3;
+      unsigned CRCPMD:1;
+      unsigned PMPMD:1;
+      unsigned RTCCMD:1;
+      unsigned CMPMD:1;
+    };
+    struct {
+      unsigned :7;
+      unsigned CRCMD:1;
+    };
+  };
+} PMD3BITS;
+extern volatile PMD3BITS PMD3bits __attribute__((__sfr__));
+
+extern volatile unsigned int  PMD4 __attribute__((__sfr__));
+typedef struct tagPMD4BITS {
+  unsigned USB1MD:1;
+  unsigned LVDMD:1;
+  unsigned CTMUMD:1;
+  unsigned REFOMD:1;
+  unsigned :1;
+  unsigned U4MD:1;
+  unsigned UPWMMD:1;
+} PMD4BITS;
+extern volatile PMD4BITS PMD4bits __attribute__((__sfr__));
+
+extern volatile unsigned int  PMD5 __attribute__((__sfr__));
+typedef struct tagPMD5BITS {
+  unsigned OC9MD:1;
+  unsigned :7;
+  unsigned IC9MD:1;
+} PMD5BITS;
+extern volatile PMD5BITS PMD5bits __attribute__((__sfr__));
+
+extern volatile unsigned int  PMD6 __attribute__((__sfr__));
+typedef struct tagPMD6BITS {
+  unsigned SPI3MD:1;
+} PMD6BITS;
+extern volatile PMD6BITS PMD6bits __attribute__((__sfr__));
+
+
+
+/* ---------------------------------------------------------- */
+/* Defines for unique SFR bit names                           */
+/* ---------------------------------------------------------- */
+
+/* SR */
+#define _C SRbits.C
+#define _Z SRbits.Z
+#define _OV SRbits.OV
+#define _N SRbits.N
+#define _RA SRbits.RA
+#define _IPL0 SRbits.IPL0
+#define _IPL1 SRbits.IPL1
+#define _IPL2 SRbits.IPL2
+/* Bitname _DC cannot be defined because it is used by more than one SFR */
+#define _IPL SRbits.IPL
+
+/* CORCON */
+#define _PSV CORCONbits.PSV
+#define _IPL3 CORCONbits.IPL3
+
+/* CNPD1 */
+#define _CN0PDE CNPD1bits.CN0PDE
+#define _CN1PDE CNPD1bits.CN1PDE
+#define _CN2PDE CNPD1bits.CN2PDE
+#define _CN3PDE CNPD1bits.CN3PDE
+#define _CN4PDE CNPD1bits.CN4PDE
+#define _CN5PDE CNPD1bits.CN5PDE
+#define _CN6PDE CNPD1bits.CN6PDE
+#define _CN7PDE CNPD1bits.CN7PDE
+#define _CN8PDE CNPD1bits.CN8PDE
+#define _CN9PDE CNPD1bits.CN9PDE
+#define _CN10PDE CNPD1bits.CN10PDE
+#define _CN11PDE CNPD1bits.CN11PDE
+#define _CN12PDE CNPD1bits.CN12PDE
+#define _CN13PDE CNPD1bits.CN13PDE
+#define _CN14PDE CNPD1bits.CN14PDE
+#define _CN15PDE CNPD1bits.CN15PDE
+
+/* CNPD2 */
+#define _CN16PDE CNPD2bits.CN16PDE
+#define _CN17PDE CNPD2bits.CN17PDE
+#define _CN18PDE CNPD2bits.CN18PDE
+#define _CN22PDE CNPD2bits.CN22PDE
+#define _CN23PDE CNPD2bits.CN23PDE
+#define _CN24PDE CNPD2bits.CN24PDE
+#define _CN25PDE CNPD2bits.CN25PDE
+#define _CN26PDE CNPD2bits.CN26PDE
+#define _CN27PDE CNPD2bits.CN27PDE
+#define _CN28PDE CNPD2bits.CN28PDE
+#define _CN29PDE CNPD2bits.CN29PDE
+#define _CN30PDE CNPD2bits.CN30PDE
+#define _CN31PDE CNPD2bits.CN31PDE
+
+/* CNPD3 */
+#define _CN32PDE CNPD3bits.CN32PDE
+
+/* CNPD4 */
+#define _CN49PDE CNPD4bits.CN49PDE
+#define _CN50PDE CNPD4bits.CN50PDE
+#define _CN51PDE CNPD4bits.CN51PDE
+#define _CN52PDE CNPD4bits.CN52PDE
+#define _CN53PDE CNPD4bits.CN53PDE
+#define _CN54PDE CNPD4bits.CN54PDE
+#define _CN55PDE CNPD4bits.CN55PDE
+#define _CN56PDE CNPD4bits.CN56PDE
+#define _CN58PDE CNPD4bits.CN58PDE
+#define _CN59PDE CNPD4bits.CN59PDE
+#define _CN60PDE CNPD4bits.CN60PDE
+#define _CN61PDE CNPD4bits.CN61PDE
+#define _CN62PDE CNPD4bits.CN62PDE
+#define _CN63PDE CNPD4bits.CN63PDE
+
+/* CNPD5 */
+#define _CN64PDE CNPD5bits.CN64PDE
+#define _CN65PDE CNPD5bits.CN65PDE
+#define _CN68PDE CNPD5bits.CN68PDE
+#define _CN69PDE CNPD5bits.CN69PDE
+#define _CN71PDE CNPD5bits.CN71PDE
+
+/* CNEN1 */
+#define _CN0IE CNEN1bits.CN0IE
+#define _CN1IE CNEN1bits.CN1IE
+#define _CN2IE CNEN1bits.CN2IE
+#define _CN3IE CNEN1bits.CN3IE
+#define _CN4IE CNEN1bits.CN4IE
+#define _CN5IE CNEN1bits.CN5IE
+#define _CN6IE CNEN1bits.CN6IE
+#define _CN7IE CNEN1bits.CN7IE
+#define _CN8IE CNEN1bits.CN8IE
+#define _CN9IE CNEN1bits.CN9IE
+#define _CN10IE CNEN1bits.CN10IE
+#define _CN11IE CNEN1bits.CN11IE
+#define _CN12IE CNEN1bits.CN12IE
+#define _CN13IE CNEN1bits.CN13IE
+#define _CN14IE CNEN1bits.CN14IE
+#define _CN15IE CNEN1bits.CN15IE
+
+/* CNEN2 */
+#define _CN16IE CNEN2bits.CN16IE
+#define _CN17IE CNEN2bits.CN17IE
+#define _CN18IE CNEN2bits.CN18IE
+#define _CN22IE CNEN2bits.CN22IE
+#define _CN23IE CNEN2bits.CN23IE
+#define _CN24IE CNEN2bits.CN24IE
+#define _CN25IE CNEN2bits.CN25IE
+#define _CN26IE CNEN2bits.CN26IE
+#define _CN27IE CNEN2bits.CN27IE
+#define _CN28IE CNEN2bits.CN28IE
+#define _CN29IE CNEN2bits.CN29IE
+#define _CN30IE CNEN2bits.CN30IE
+#define _CN31IE CNEN2bits.CN31IE
+
+/* CNEN3 */
+#define _CN32IE CNEN3bits.CN32IE
+
+/* CNEN4 */
+#define _CN49IE CNEN4bits.CN49IE
+#define _CN50IE CNEN4bits.CN50IE
+#define _CN51IE CNEN4bits.CN51IE
+#define _CN52IE CNEN4bits.CN52IE
+#define _CN53IE CNEN4bits.CN53IE
+#define _CN54IE CNEN4bits.CN54IE
+#define _CN55IE CNEN4bits.CN55IE
+#define _CN56IE CNEN4bits.CN56IE
+#define _CN58IE CNEN4bits.CN58IE
+#define _CN59IE CNEN4bits.CN59IE
+#define _CN60IE CNEN4bits.CN60IE
+#define _CN61IE CNEN4bits.CN61IE
+#define _CN62IE CNEN4bits.CN62IE
+#define _CN63IE CNEN4bits.CN63IE
+
+/* CNEN5 */
+#define _CN64IE CNEN5bits.CN64IE
+#define _CN65IE CNEN5bits.CN65IE
+#define _CN68IE CNEN5bits.CN68IE
+#define _CN69IE CNEN5bits.CN69IE
+#define _CN71IE CNEN5bits.CN71IE
+
+/* CNPU1 */
+#define _CN0PUE CNPU1bits.CN0PUE
+#define _CN1PUE CNPU1bits.CN1PUE
+#define _CN2PUE CNPU1bits.CN2PUE
+#define _CN3PUE CNPU1bits.CN3PUE
+#define _CN4PUE CNPU1bits.CN4PUE
+#define _CN5PUE CNPU1bits.CN5PUE
+#define _CN6PUE CNPU1bits.CN6PUE
+#define _CN7PUE CNPU1bits.CN7PUE
+#define _CN8PUE CNPU1bits.CN8PUE
+#define _CN9PUE CNPU1bits.CN9PUE
+#define _CN10PUE CNPU1bits.CN10PUE
+#define _CN11PUE CNPU1bits.CN11PUE
+#define _CN12PUE CNPU1bits.CN12PUE
+#define _CN13PUE CNPU1bits.CN13PUE
+#define _CN14PUE CNPU1bits.CN14PUE
+#define _CN15PUE CNPU1bits.CN15PUE
+
+/* CNPU2 */
+#define _CN16PUE CNPU2bits.CN16PUE
+#define _CN17PUE CNPU2bits.CN17PUE
+#define _CN18PUE CNPU2bits.CN18PUE
+#define _CN22PUE CNPU2bits.CN22PUE
+#define _CN23PUE CNPU2bits.CN23PUE
+#define _CN24PUE CNPU2bits.CN24PUE
+#define _CN25PUE CNPU2bits.CN25PUE
+#define _CN26PUE CNPU2bits.CN26PUE
+#define _CN27PUE CNPU2bits.CN27PUE
+#define _CN28PUE CNPU2bits.CN28PUE
+#define _CN29PUE CNPU2bits.CN29PUE
+#define _CN30PUE CNPU2bits.CN30PUE
+#define _CN31PUE CNPU2bits.CN31PUE
+
+/* CNPU3 */
+#define _CN32PUE CNPU3bits.CN32PUE
+
+/* CNPU4 */
+#define _CN49PUE CNPU4bits.CN49PUE
+#define _CN50PUE CNPU4bits.CN50PUE
+#define _CN51PUE CNPU4bits.CN51PUE
+#define _CN52PUE CNPU4bits.CN52PUE
+#define _CN53PUE CNPU4bits.CN53PUE
+#define _CN54PUE CNPU4bits.CN54PUE
+#define _CN55PUE CNPU4bits.CN55PUE
+#define _CN56PUE CNPU4bits.CN56PUE
+#define _CN58PUE CNPU4bits.CN58PUE
+#define _CN59PUE CNPU4bits.CN59PUE
+#define _CN60PUE CNPU4bits.CN60PUE
+#define _CN61PUE CNPU4bits.CN61PUE
+#define _CN62PUE CNPU4bits.CN62PUE
+#define _CN63PUE CNPU4bits.CN63PUE
+
+/* CNPU5 */
+#define _CN64PUE CNPU5bits.CN64PUE
+#define _CN65PUE CNPU5bits.CN65PUE
+#define _CN68PUE CNPU5bits.CN68PUE
+#define _CN69PUE CNPU5bits.CN69PUE
+#define _CN71PUE CNPU5bits.CN71PUE
+
+/* INTCON1 */
+#define _OSCFAIL INTCON1bits.OSCFAIL
+#define _STKERR INTCON1bits.STKERR
+#define _ADDRERR INTCON1bits.ADDRERR
+#define _MATHERR INTCON1bits.MATHERR
+#define _NSTDIS INTCON1bits.NSTDIS
+
+/* INTCON2 */
+#define _INT0EP INTCON2bits.INT0EP
+#define _INT1EP INTCON2bits.INT1EP
+#define _INT2EP INTCON2bits.INT2EP
+#define _INT3EP INTCON2bits.INT3EP
+#define _INT4EP INTCON2bits.INT4EP
+#define _DISI INTCON2bits.DISI
+#define _ALTIVT INTCON2bits.ALTIVT
+
+/* IFS0 */
+#define _INT0IF IFS0bits.INT0IF
+#define _IC1IF IFS0bits.IC1IF
+#define _OC1IF IFS0bits.OC1IF
+#define _T1IF IFS0bits.T1IF
+#define _IC2IF IFS0bits.IC2IF
+#define _OC2IF IFS0bits.OC2IF
+#define _T2IF IFS0bits.T2IF
+#define _T3IF IFS0bits.T3IF
+#define _SPF1IF IFS0bits.SPF1IF
+#define _SPI1IF IFS0bits.SPI1IF
+#define _U1RXIF IFS0bits.U1RXIF
+#define _U1TXIF IFS0bits.U1TXIF
+#define _AD1IF IFS0bits.AD1IF
+
+/* IFS1 */
+#define _SI2C1IF IFS1bits.SI2C1IF
+#define _MI2C1IF IFS1bits.MI2C1IF
+#define _CMIF IFS1bits.CMIF
+#define _CNIF IFS1bits.CNIF
+#define _INT1IF IFS1bits.INT1IF
+#define _IC7IF IFS1bits.IC7IF
+#define _IC8IF IFS1bits.IC8IF
+#define _OC3IF IFS1bits.OC3IF
+#define _OC4IF IFS1bits.OC4IF
+#define _T4IF IFS1bits.T4IF
+#define _T5IF IFS1bits.T5IF
+#define _INT2IF IFS1bits.INT2IF
+#define _U2RXIF IFS1bits.U2RXIF
+#define _U2TXIF IFS1bits.U2TXIF
+
+/* IFS2 */
+#define _SPF2IF IFS2bits.SPF2IF
+#define _SPI2IF IFS2bits.SPI2IF
+#define _IC3IF IFS2bits.IC3IF
+#define _IC4IF IFS2bits.IC4IF
+#define _IC5IF IFS2bits.IC5IF
+#define _IC6IF IFS2bits.IC6IF
+#define _OC5IF IFS2bits.OC5IF
+#define _OC6IF IFS2bits.OC6IF
+#define _OC7IF IFS2bits.OC7IF
+#define _OC8IF IFS2bits.OC8IF
+#define _PMPIF IFS2bits.PMPIF
+
+/* IFS3 */
+#define _SI2C2IF IFS3bits.SI2C2IF
+#define _MI2C2IF IFS3bits.MI2C2IF
+#define _INT3IF IFS3bits.INT3IF
+#define _INT4IF IFS3bits.INT4IF
+#define _RTCIF IFS3bits.RTCIF
+
+/* IFS4 */
+#define _U1ERIF IFS4bits.U1ERIF
+#define _U2ERIF IFS4bits.U2ERIF
+#define _CRCIF IFS4bits.CRCIF
+#define _LVDIF IFS4bits.LVDIF
+#define _CTMUIF IFS4bits.CTMUIF
+
+/* IFS5 */
+#define _U3ERIF IFS5bits.U3ERIF
+#define _U3RXIF IFS5bits.U3RXIF
+#define _U3TXIF IFS5bits.U3TXIF
+#define _SI2C3IF IFS5bits.SI2C3IF
+#define _MI2C3IF IFS5bits.MI2C3IF
+#define _USB1IF IFS5bits.USB1IF
+#define _U4ERIF IFS5bits.U4ERIF
+#define _U4RXIF IFS5bits.U4RXIF
+#define _U4TXIF IFS5bits.U4TXIF
+#define _SPF3IF IFS5bits.SPF3IF
+#define _SPI3IF IFS5bits.SPI3IF
+#define _OC9IF IFS5bits.OC9IF
+#define _IC9IF IFS5bits.IC9IF
+
+/* IEC0 */
+#define _INT0IE IEC0bits.INT0IE
+#define _IC1IE IEC0bits.IC1IE
+#define _OC1IE IEC0bits.OC1IE
+#define _T1IE IEC0bits.T1IE
+#define _IC2IE IEC0bits.IC2IE
+#define _OC2IE IEC0bits.OC2IE
+#define _T2IE IEC0bits.T2IE
+#define _T3IE IEC0bits.T3IE
+#define _SPF1IE IEC0bits.SPF1IE
+#define _SPI1IE IEC0bits.SPI1IE
+#define _U1RXIE IEC0bits.U1RXIE
+#define _U1TXIE IEC0bits.U1TXIE
+#define _AD1IE IEC0bits.AD1IE
+
+/* IEC1 */
+#define _SI2C1IE IEC1bits.SI2C1IE
+#define _MI2C1IE IEC1bits.MI2C1IE
+#define _CMIE IEC1bits.CMIE
+#define _CNIE IEC1bits.CNIE
+#define _INT1IE IEC1bits.INT1IE
+#define _IC7IE IEC1bits.IC7IE
+#define _IC8IE IEC1bits.IC8IE
+#define _OC3IE IEC1bits.OC3IE
+#define _OC4IE IEC1bits.OC4IE
+#define _T4IE IEC1bits.T4IE
+#define _T5IE IEC1bits.T5IE
+#define _INT2IE IEC1bits.INT2IE
+#define _U2RXIE IEC1bits.U2RXIE
+#define _U2TXIE IEC1bits.U2TXIE
+
+/* IEC2 */
+#define _SPF2IE IEC2bits.SPF2IE
+#define _SPI2IE IEC2bits.SPI2IE
+#define _IC3IE IEC2bits.IC3IE
+#define _IC4IE IEC2bits.IC4IE
+#define _IC5IE IEC2bits.IC5IE
+#define _IC6IE IEC2bits.IC6IE
+#define _OC5IE IEC2bits.OC5IE
+#define _OC6IE IEC2bits.OC6IE
+#define _OC7IE IEC2bits.OC7IE
+#define _OC8IE IEC2bits.OC8IE
+#define _PMPIE IEC2bits.PMPIE
+
+/* IEC3 */
+#define _SI2C2IE IEC3bits.SI2C2IE
+#define _MI2C2IE IEC3bits.MI2C2IE
+#define _INT3IE IEC3bits.INT3IE
+#define _INT4IE IEC3bits.INT4IE
+#define _RTCIE IEC3bits.RTCIE
+
+/* IEC4 */
+#define _U1ERIE IEC4bits.U1ERIE
+#define _U2ERIE IEC4bits.U2ERIE
+#define _CRCIE IEC4bits.CRCIE
+#define _LVDIE IEC4bits.LVDIE
+#define _CTMUIE IEC4bits.CTMUIE
+
+/* IEC5 */
+#define _U3ERIE IEC5bits.U3ERIE
+#define _U3RXIE IEC5bits.U3RXIE
+#define _U3TXIE IEC5bits.U3TXIE
+#define _SI2C3IE IEC5bits.SI2C3IE
+#define _MI2C3IE IEC5bits.MI2C3IE
+#define _USB1IE IEC5bits.USB1IE
+#define _U4ERIE IEC5bits.U4ERIE
+#define _U4RXIE IEC5bits.U4RXIE
+#define _U4TXIE IEC5bits.U4TXIE
+#define _SPF3IE IEC5bits.SPF3IE
+#define _SPI3IE IEC5bits.SPI3IE
+#define _OC9IE IEC5bits.OC9IE
+#define _IC9IE IEC5bits.IC9IE
+
+/* IPC0 */
+#define _INT0IP0 IPC0bits.INT0IP0
+#define _INT0IP1 IPC0bits.INT0IP1
+#define _INT0IP2 IPC0bits.INT0IP2
+#define _IC1IP0 IPC0bits.IC1IP0
+#define _IC1IP1 IPC0bits.IC1IP1
+#define _IC1IP2 IPC0bits.IC1IP2
+#define _OC1IP0 IPC0bits.OC1IP0
+#define _OC1IP1 IPC0bits.OC1IP1
+#define _OC1IP2 IPC0bits.OC1IP2
+#define _T1IP0 IPC0bits.T1IP0
+#define _T1IP1 IPC0bits.T1IP1
+#define _T1IP2 IPC0bits.T1IP2
+#define _INT0IP IPC0bits.INT0IP
+#define _IC1IP IPC0bits.IC1IP
+#define _OC1IP IPC0bits.OC1IP
+#define _T1IP IPC0bits.T1IP
+
+/* IPC1 */
+#define _IC2IP0 IPC1bits.IC2IP0
+#define _IC2IP1 IPC1bits.IC2IP1
+#define _IC2IP2 IPC1bits.IC2IP2
+#define _OC2IP0 IPC1bits.OC2IP0
+#define _OC2IP1 IPC1bits.OC2IP1
+#define _OC2IP2 IPC1bits.OC2IP2
+#define _T2IP0 IPC1bits.T2IP0
+#define _T2IP1 IPC1bits.T2IP1
+#define _T2IP2 IPC1bits.T2IP2
+#define _IC2IP IPC1bits.IC2IP
+#define _OC2IP IPC1bits.OC2IP
+#define _T2IP IPC1bits.T2IP
+
+/* IPC2 */
+#define _T3IP0 IPC2bits.T3IP0
+#define _T3IP1 IPC2bits.T3IP1
+#define _T3IP2 IPC2bits.T3IP2
+#define _SPF1IP0 IPC2bits.SPF1IP0
+#define _SPF1IP1 IPC2bits.SPF1IP1
+#define _SPF1IP2 IPC2bits.SPF1IP2
+#define _SPI1IP0 IPC2bits.SPI1IP0
+#define _SPI1IP1 IPC2bits.SPI1IP1
+#define _SPI1IP2 IPC2bits.SPI1IP2
+#define _U1RXIP0 IPC2bits.U1RXIP0
+#define _U1RXIP1 IPC2bits.U1RXIP1
+#define _U1RXIP2 IPC2bits.U1RXIP2
+#define _T3IP IPC2bits.T3IP
+#define _SPF1IP IPC2bits.SPF1IP
+#define _SPI1IP IPC2bits.SPI1IP
+#define _U1RXIP IPC2bits.U1RXIP
+
+/* IPC3 */
+#define _U1TXIP0 IPC3bits.U1TXIP0
+#define _U1TXIP1 IPC3bits.U1TXIP1
+#define _U1TXIP2 IPC3bits.U1TXIP2
+#define _AD1IP0 IPC3bits.AD1IP0
+#define _AD1IP1 IPC3bits.AD1IP1
+#define _AD1IP2 IPC3bits.AD1IP2
+#define _U1TXIP IPC3bits.U1TXIP
+#define _AD1IP IPC3bits.AD1IP
+
+/* IPC4 */
+#define _SI2C1IP0 IPC4bits.SI2C1IP0
+#define _SI2C1IP1 IPC4bits.SI2C1IP1
+#define _SI2C1IP2 IPC4bits.SI2C1IP2
+#define _MI2C1IP0 IPC4bits.MI2C1IP0
+#define _MI2C1IP1 IPC4bits.MI2C1IP1
+#define _MI2C1IP2 IPC4bits.MI2C1IP2
+#define _CMIP0 IPC4bits.CMIP0
+#define _CMIP1 IPC4bits.CMIP1
+#define _CMIP2 IPC4bits.CMIP2
+#define _CNIP0 IPC4bits.CNIP0
+#define _CNIP1 IPC4bits.CNIP1
+#define _CNIP2 IPC4bits.CNIP2
+#define _SI2C1IP IPC4bits.SI2C1IP
+#define _MI2C1IP IPC4bits.MI2C1IP
+#define _CMIP IPC4bits.CMIP
+#define _CNIP IPC4bits.CNIP
+#define _SI2C1P0 IPC4bits.SI2C1P0
+#define _SI2C1P1 IPC4bits.SI2C1P1
+#define _SI2C1P2 IPC4bits.SI2C1P2
+#define _MI2C1P0 IPC4bits.MI2C1P0
+#define _MI2C1P1 IPC4bits.MI2C1P1
+#define _MI2C1P2 IPC4bits.MI2C1P2
+#define _SI2C1P IPC4bits.SI2C1P
+#define _MI2C1P IPC4bits.MI2C1P
+
+/* IPC5 */
+#define _INT1IP0 IPC5bits.INT1IP0
+#define _INT1IP1 IPC5bits.INT1IP1
+#define _INT1IP2 IPC5bits.INT1IP2
+#define _IC7IP0 IPC5bits.IC7IP0
+#define _IC7IP1 IPC5bits.IC7IP1
+#define _IC7IP2 IPC5bits.IC7IP2
+#define _IC8IP0 IPC5bits.IC8IP0
+#define _IC8IP1 IPC5bits.IC8IP1
+#define _IC8IP2 IPC5bits.IC8IP2
+#define _INT1IP IPC5bits.INT1IP
+#define _IC7IP IPC5bits.IC7IP
+#define _IC8IP IPC5bits.IC8IP
+
+/* IPC6 */
+#define _OC3IP0 IPC6bits.OC3IP0
+#define _OC3IP1 IPC6bits.OC3IP1
+#define _OC3IP2 IPC6bits.OC3IP2
+#define _OC4IP0 IPC6bits.OC4IP0
+#define _OC4IP1 IPC6bits.OC4IP1
+#define _OC4IP2 IPC6bits.OC4IP2
+#define _T4IP0 IPC6bits.T4IP0
+#define _T4IP1 IPC6bits.T4IP1
+#define _T4IP2 IPC6bits.T4IP2
+#define _OC3IP IPC6bits.OC3IP
+#define _OC4IP IPC6bits.OC4IP
+#define _T4IP IPC6bits.T4IP
+
+/* IPC7 */
+#define _T5IP0 IPC7bits.T5IP0
+#define _T5IP1 IPC7bits.T5IP1
+#define _T5IP2 IPC7bits.T5IP2
+#define _INT2IP0 IPC7bits.INT2IP0
+#define _INT2IP1 IPC7bits.INT2IP1
+#define _INT2IP2 IPC7bits.INT2IP2
+#define _U2RXIP0 IPC7bits.U2RXIP0
+#define _U2RXIP1 IPC7bits.U2RXIP1
+#define _U2RXIP2 IPC7bits.U2RXIP2
+#define _U2TXIP0 IPC7bits.U2TXIP0
+#define _U2TXIP1 IPC7bits.U2TXIP1
+#define _U2TXIP2 IPC7bits.U2TXIP2
+#define _T5IP IPC7bits.T5IP
+#define _INT2IP IPC7bits.INT2IP
+#define _U2RXIP IPC7bits.U2RXIP
+#define _U2TXIP IPC7bits.U2TXIP
+
+/* IPC8 */
+#define _SPF2IP0 IPC8bits.SPF2IP0
+#define _SPF2IP1 IPC8bits.SPF2IP1
+#define _SPF2IP2 IPC8bits.SPF2IP2
+#define _SPI2IP0 IPC8bits.SPI2IP0
+#define _SPI2IP1 IPC8bits.SPI2IP1
+#define _SPI2IP2 IPC8bits.SPI2IP2
+#define _SPF2IP IPC8bits.SPF2IP
+#define _SPI2IP IPC8bits.SPI2IP
+
+/* IPC9 */
+#define _IC3IP0 IPC9bits.IC3IP0
+#define _IC3IP1 IPC9bits.IC3IP1
+#define _IC3IP2 IPC9bits.IC3IP2
+#define _IC4IP0 IPC9bits.IC4IP0
+#define _IC4IP1 IPC9bits.IC4IP1
+#define _IC4IP2 IPC9bits.IC4IP2
+#define _IC5IP0 IPC9bits.IC5IP0
+#define _IC5IP1 IPC9bits.IC5IP1
+#define _IC5IP2 IPC9bits.IC5IP2
+#define _IC3IP IPC9bits.IC3IP
+#define _IC4IP IPC9bits.IC4IP
+#define _IC5IP IPC9bits.IC5IP
+
+/* IPC10 */
+#define _IC6IP0 IPC10bits.IC6IP0
+#define _IC6IP1 IPC10bits.IC6IP1
+#define _IC6IP2 IPC10bits.IC6IP2
+#define _OC5IP0 IPC10bits.OC5IP0
+#define _OC5IP1 IPC10bits.OC5IP1
+#define _OC5IP2 IPC10bits.OC5IP2
+#define _OC6IP0 IPC10bits.OC6IP0
+#define _OC6IP1 IPC10bits.OC6IP1
+#define _OC6IP2 IPC10bits.OC6IP2
+#define _OC7IP0 IPC10bits.OC7IP0
+#define _OC7IP1 IPC10bits.OC7IP1
+#define _OC7IP2 IPC10bits.OC7IP2
+#define _IC6IP IPC10bits.IC6IP
+#define _OC5IP IPC10bits.OC5IP
+#define _OC6IP IPC10bits.OC6IP
+#define _OC7IP IPC10bits.OC7IP
+
+/* IPC11 */
+#define _OC8IP0 IPC11bits.OC8IP0
+#define _OC8IP1 IPC11bits.OC8IP1
+#define _OC8IP2 IPC11bits.OC8IP2
+#define _PMPIP0 IPC11bits.PMPIP0
+#define _PMPIP1 IPC11bits.PMPIP1
+#define _PMPIP2 IPC11bits.PMPIP2
+#define _OC8IP IPC11bits.OC8IP
+#define _PMPIP IPC11bits.PMPIP
+
+/* IPC12 */
+#define _SI2C2IP0 IPC12bits.SI2C2IP0
+#define _SI2C2IP1 IPC12bits.SI2C2IP1
+#define _SI2C2IP2 IPC12bits.SI2C2IP2
+#define _MI2C2IP0 IPC12bits.MI2C2IP0
+#define _MI2C2IP1 IPC12bits.MI2C2IP1
+#define _MI2C2IP2 IPC12bits.MI2C2IP2
+#define _SI2C2IP IPC12bits.SI2C2IP
+#define _MI2C2IP IPC12bits.MI2C2IP
+#define _SI2C2P0 IPC12bits.SI2C2P0
+#define _SI2C2P1 IPC12bits.SI2C2P1
+#define _SI2C2P2 IPC12bits.SI2C2P2
+#define _MI2C2P0 IPC12bits.MI2C2P0
+#define _MI2C2P1 IPC12bits.MI2C2P1
+#define _MI2C2P2 IPC12bits.MI2C2P2
+#define _SI2C2P IPC12bits.SI2C2P
+#define _MI2C2P IPC12bits.MI2C2P
+
+/* IPC13 */
+#define _INT3IP0 IPC13bits.INT3IP0
+#define _INT3IP1 IPC13bits.INT3IP1
+#define _INT3IP2 IPC13bits.INT3IP2
+#define _INT4IP0 IPC13bits.INT4IP0
+#define _INT4IP1 IPC13bits.INT4IP1
+#define _INT4IP2 IPC13bits.INT4IP2
+#define _INT3IP IPC13bits.INT3IP
+#define _INT4IP IPC13bits.INT4IP
+
+/* IPC15 */
+#define _RTCIP0 IPC15bits.RTCIP0
+#define _RTCIP1 IPC15bits.RTCIP1
+#define _RTCIP2 IPC15bits.RTCIP2
+#define _RTCIP IPC15bits.RTCIP
+
+/* IPC16 */
+#define _U1ERIP0 IPC16bits.U1ERIP0
+#define _U1ERIP1 IPC16bits.U1ERIP1
+#define _U1ERIP2 IPC16bits.U1ERIP2
+#define _U2ERIP0 IPC16bits.U2ERIP0
+#define _U2ERIP1 IPC16bits.U2ERIP1
+#define _U2ERIP2 IPC16bits.U2ERIP2
+#define _CRCIP0 IPC16bits.CRCIP0
+#define _CRCIP1 IPC16bits.CRCIP1
+#define _CRCIP2 IPC16bits.CRCIP2
+#define _U1ERIP IPC16bits.U1ERIP
+#define _U2ERIP IPC16bits.U2ERIP
+#define _CRCIP IPC16bits.CRCIP
+
+/* IPC18 */
+#define _LVDIP0 IPC18bits.LVDIP0
+#define _LVDIP1 IPC18bits.LVDIP1
+#define _LVDIP2 IPC18bits.LVDIP2
+#define _LVDIP IPC18bits.LVDIP
+
+/* IPC19 */
+#define _CTMUIP0 IPC19bits.CTMUIP0
+#define _CTMUIP1 IPC19bits.CTMUIP1
+#define _CTMUIP2 IPC19bits.CTMUIP2
+#define _CTMUIP IPC19bits.CTMUIP
+
+/* IPC20 */
+#define _U3ERIP0 IPC20bits.U3ERIP0
+#define _U3ERIP1 IPC20bits.U3ERIP1
+#define _U3ERIP2 IPC20bits.U3ERIP2
+#define _U3RXIP0 IPC20bits.U3RXIP0
+#define _U3RXIP1 IPC20bits.U3RXIP1
+#define _U3RXIP2 IPC20bits.U3RXIP2
+#define _U3TXIP0 IPC20bits.U3TXIP0
+#define _U3TXIP1 IPC20bits.U3TXIP1
+#define _U3TXIP2 IPC20bits.U3TXIP2
+#define _U3ERIP IPC20bits.U3ERIP
+#define _U3RXIP IPC20bits.U3RXIP
+#define _U3TXIP IPC20bits.U3TXIP
+
+/* IPC21 */
+#define _SI2C3P0 IPC21bits.SI2C3P0
+#define _SI2C3P1 IPC21bits.SI2C3P1
+#define _SI2C3P2 IPC21bits.SI2C3P2
+#define _MI2C3P0 IPC21bits.MI2C3P0
+#define _MI2C3P1 IPC21bits.MI2C3P1
+#define _MI2C3P2 IPC21bits.MI2C3P2
+#define _USB1IP0 IPC21bits.USB1IP0
+#define _USB1IP1 IPC21bits.USB1IP1
+#define _USB1IP2 IPC21bits.USB1IP2
+#define _U4ERIP0 IPC21bits.U4ERIP0
+#define _U4ERIP1 IPC21bits.U4ERIP1
+#define _U4ERIP2 IPC21bits.U4ERIP2
+#define _SI2C3P IPC21bits.SI2C3P
+#define _MI2C3P IPC21bits.MI2C3P
+#define _USB1IP IPC21bits.USB1IP
+#define _U4ERIP IPC21bits.U4ERIP
+
+/* IPC22 */
+#define _U4RXIP0 IPC22bits.U4RXIP0
+#define _U4RXIP1 IPC22bits.U4RXIP1
+#define _U4RXIP2 IPC22bits.U4RXIP2
+#define _U4TXIP0 IPC22bits.U4TXIP0
+#define _U4TXIP1 IPC22bits.U4TXIP1
+#define _U4TXIP2 IPC22bits.U4TXIP2
+#define _SPF3IP0 IPC22bits.SPF3IP0
+#define _SPF3IP1 IPC22bits.SPF3IP1
+#define _SPF3IP2 IPC22bits.SPF3IP2
+#define _SPI3IP0 IPC22bits.SPI3IP0
+#define _SPI3IP1 IPC22bits.SPI3IP1
+#define _SPI3IP2 IPC22bits.SPI3IP2
+#define _U4RXIP IPC22bits.U4RXIP
+#define _U4TXIP IPC22bits.U4TXIP
+#define _SPF3IP IPC22bits.SPF3IP
+#define _SPI3IP IPC22bits.SPI3IP
+
+/* IPC23 */
+#define _OC9IP0 IPC23bits.OC9IP0
+#define _OC9IP1 IPC23bits.OC9IP1
+#define _OC9IP2 IPC23bits.OC9IP2
+#define _IC9IP0 IPC23bits.IC9IP0
+#define _IC9IP1 IPC23bits.IC9IP1
+#define _IC9IP2 IPC23bits.IC9IP2
+#define _OC9IP IPC23bits.OC9IP
+#define _IC9IP IPC23bits.IC9IP
+
+/* T1CON */
+#define _TCS T1CONbits.TCS
+#define _TSYNC T1CONbits.TSYNC
+#define _TCKPS0 T1CONbits.TCKPS0
+#define _TCKPS1 T1CONbits.TCKPS1
+#define _TGATE T1CONbits.TGATE
+#define _TSIDL T1CONbits.TSIDL
+#define _TON T1CONbits.TON
+#define _TCKPS T1CONbits.TCKPS
+
+/* T2CON */
+/* Bitname _TCS cannot be defined because it is used by more than one SFR */
+/* Bitname _T32 cannot be defined because it is used by more than one SFR */
+/* Bitname _TCKPS0 cannot be defined because it is used by more than one SFR */
+/* Bitname _TCKPS1 cannot be defined because it is used by more than one SFR */
+/* Bitname _TGATE cannot be defined because it is used by more than one SFR */
+/* Bitname _TSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _TON cannot be defined because it is used by more than one SFR */
+/* Bitname _TCKPS cannot be defined because it is used by more than one SFR */
+
+/* T3CON */
+/* Bitname _TCS cannot be defined because it is used by more than one SFR */
+/* Bitname _TCKPS0 cannot be defined because it is used by more than one SFR */
+/* Bitname _TCKPS1 cannot be defined because it is used by more than one SFR */
+/* Bitname _TGATE cannot be defined because it is used by more than one SFR */
+/* Bitname _TSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _TON cannot be defined because it is used by more than one SFR */
+/* Bitname _TCKPS cannot be defined because it is used by more than one SFR */
+
+/* T4CON */
+/* Bitname _TCS cannot be defined because it is used by more than one SFR */
+/* Bitname _T32 cannot be defined because it is used by more than one SFR */
+/* Bitname _TCKPS0 cannot be defined because it is used by more than one SFR */
+/* Bitname _TCKPS1 cannot be defined because it is used by more than one SFR */
+/* Bitname _TGATE cannot be defined because it is used by more than one SFR */
+/* Bitname _TSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _TON cannot be defined because it is used by more than one SFR */
+/* Bitname _TCKPS cannot be defined because it is used by more than one SFR */
+
+/* T5CON */
+/* Bitname _TCS cannot be defined because it is used by more than one SFR */
+/* Bitname _TCKPS0 cannot be defined because it is used by more than one SFR */
+/* Bitname _TCKPS1 cannot be defined because it is used by more than one SFR */
+/* Bitname _TGATE cannot be defined because it is used by more than one SFR */
+/* Bitname _TSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _TON cannot be defined because it is used by more than one SFR */
+/* Bitname _TCKPS cannot be defined because it is used by more than one SFR */
+
+/* IC1CON1 */
+/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
+/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
+
+/* IC1CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+
+/* IC2CON1 */
+/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
+/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
+
+/* IC2CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+
+/* IC3CON1 */
+/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
+/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
+
+/* IC3CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+
+/* IC4CON1 */
+/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
+/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
+
+/* IC4CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+
+/* IC5CON1 */
+/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
+/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
+
+/* IC5CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+
+/* IC6CON1 */
+/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
+/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
+
+/* IC6CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+
+/* IC7CON1 */
+/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
+/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
+
+/* IC7CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+
+/* IC8CON1 */
+/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
+/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
+
+/* IC8CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+
+/* IC9CON1 */
+/* Bitname _ICM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICBNE cannot be defined because it is used by more than one SFR */
+/* Bitname _ICOV cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _ICSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _ICM cannot be defined because it is used by more than one SFR */
+/* Bitname _ICI cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTSEL cannot be defined because it is used by more than one SFR */
+
+/* IC9CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _ICTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _IC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+
+/* OC1CON1 */
+/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
+
+/* OC1CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
+
+/* OC2CON1 */
+/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
+
+/* OC2CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
+
+/* OC3CON1 */
+/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
+
+/* OC3CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
+
+/* OC4CON1 */
+/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
+
+/* OC4CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
+
+/* OC5CON1 */
+/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
+
+/* OC5CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
+
+/* OC6CON1 */
+/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
+
+/* OC6CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
+
+/* OC7CON1 */
+/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
+
+/* OC7CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
+
+/* OC8CON1 */
+/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
+
+/* OC8CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
+
+/* OC9CON1 */
+/* Bitname _OCM0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM2 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _OCM cannot be defined because it is used by more than one SFR */
+/* Bitname _OCFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _ENFLT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTSEL cannot be defined because it is used by more than one SFR */
+
+/* OC9CON2 */
+/* Bitname _SYNCSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL3 cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL4 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIS cannot be defined because it is used by more than one SFR */
+/* Bitname _TRIGSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _OCTRIG cannot be defined because it is used by more than one SFR */
+/* Bitname _OC32 cannot be defined because it is used by more than one SFR */
+/* Bitname _OCINV cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTTRIEN cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTOUT cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMODE cannot be defined because it is used by more than one SFR */
+/* Bitname _SYNCSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _FLTMD cannot be defined because it is used by more than one SFR */
+
+/* I2C1CON */
+/* Bitname _SEN cannot be defined because it is used by more than one SFR */
+/* Bitname _RSEN cannot be defined because it is used by more than one SFR */
+/* Bitname _PEN cannot be defined because it is used by more than one SFR */
+/* Bitname _RCEN cannot be defined because it is used by more than one SFR */
+/* Bitname _ACKEN cannot be defined because it is used by more than one SFR */
+/* Bitname _ACKDT cannot be defined because it is used by more than one SFR */
+/* Bitname _STREN cannot be defined because it is used by more than one SFR */
+/* Bitname _GCEN cannot be defined because it is used by more than one SFR */
+/* Bitname _SMEN cannot be defined because it is used by more than one SFR */
+/* Bitname _DISSLW cannot be defined because it is used by more than one SFR */
+/* Bitname _A10M cannot be defined because it is used by more than one SFR */
+/* Bitname _IPMIEN cannot be defined because it is used by more than one SFR */
+/* Bitname _SCLREL cannot be defined because it is used by more than one SFR */
+/* Bitname _I2CSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _I2CEN cannot be defined because it is used by more than one SFR */
+
+/* I2C1STAT */
+/* Bitname _TBF cannot be defined because it is used by more than one SFR */
+/* Bitname _RBF cannot be defined because it is used by more than one SFR */
+/* Bitname _R_W cannot be defined because it is used by more than one SFR */
+/* Bitname _S cannot be defined because it is used by more than one SFR */
+/* Bitname _P cannot be defined because it is used by more than one SFR */
+/* Bitname _D_A cannot be defined because it is used by more than one SFR */
+/* Bitname _I2COV cannot be defined because it is used by more than one SFR */
+/* Bitname _IWCOL cannot be defined because it is used by more than one SFR */
+/* Bitname _ADD10 cannot be defined because it is used by more than one SFR */
+/* Bitname _GCSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _BCL cannot be defined because it is used by more than one SFR */
+/* Bitname _TRSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _ACKSTAT cannot be defined because it is used by more than one SFR */
+
+/* I2C2CON */
+/* Bitname _SEN cannot be defined because it is used by more than one SFR */
+/* Bitname _RSEN cannot be defined because it is used by more than one SFR */
+/* Bitname _PEN cannot be defined because it is used by more than one SFR */
+/* Bitname _RCEN cannot be defined because it is used by more than one SFR */
+/* Bitname _ACKEN cannot be defined because it is used by more than one SFR */
+/* Bitname _ACKDT cannot be defined because it is used by more than one SFR */
+/* Bitname _STREN cannot be defined because it is used by more than one SFR */
+/* Bitname _GCEN cannot be defined because it is used by more than one SFR */
+/* Bitname _SMEN cannot be defined because it is used by more than one SFR */
+/* Bitname _DISSLW cannot be defined because it is used by more than one SFR */
+/* Bitname _A10M cannot be defined because it is used by more than one SFR */
+/* Bitname _IPMIEN cannot be defined because it is used by more than one SFR */
+/* Bitname _SCLREL cannot be defined because it is used by more than one SFR */
+/* Bitname _I2CSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _I2CEN cannot be defined because it is used by more than one SFR */
+
+/* I2C2STAT */
+/* Bitname _TBF cannot be defined because it is used by more than one SFR */
+/* Bitname _RBF cannot be defined because it is used by more than one SFR */
+/* Bitname _R_W cannot be defined because it is used by more than one SFR */
+/* Bitname _S cannot be defined because it is used by more than one SFR */
+/* Bitname _P cannot be defined because it is used by more than one SFR */
+/* Bitname _D_A cannot be defined because it is used by more than one SFR */
+/* Bitname _I2COV cannot be defined because it is used by more than one SFR */
+/* Bitname _IWCOL cannot be defined because it is used by more than one SFR */
+/* Bitname _ADD10 cannot be defined because it is used by more than one SFR */
+/* Bitname _GCSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _BCL cannot be defined because it is used by more than one SFR */
+/* Bitname _TRSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _ACKSTAT cannot be defined because it is used by more than one SFR */
+
+/* U1MODE */
+/* Bitname _STSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _PDSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _PDSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _BRGH cannot be defined because it is used by more than one SFR */
+/* Bitname _RXINV cannot be defined because it is used by more than one SFR */
+/* Bitname _ABAUD cannot be defined because it is used by more than one SFR */
+/* Bitname _LPBACK cannot be defined because it is used by more than one SFR */
+/* Bitname _WAKE cannot be defined because it is used by more than one SFR */
+/* Bitname _UEN0 cannot be defined because it is used by more than one SFR */
+/* Bitname _UEN1 cannot be defined because it is used by more than one SFR */
+/* Bitname _RTSMD cannot be defined because it is used by more than one SFR */
+/* Bitname _IREN cannot be defined because it is used by more than one SFR */
+/* Bitname _USIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _UARTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _PDSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _UEN cannot be defined because it is used by more than one SFR */
+
+/* U1STA */
+/* Bitname _URXDA cannot be defined because it is used by more than one SFR */
+/* Bitname _OERR cannot be defined because it is used by more than one SFR */
+/* Bitname _FERR cannot be defined because it is used by more than one SFR */
+/* Bitname _PERR cannot be defined because it is used by more than one SFR */
+/* Bitname _RIDLE cannot be defined because it is used by more than one SFR */
+/* Bitname _ADDEN cannot be defined because it is used by more than one SFR */
+/* Bitname _URXISEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _URXISEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRMT cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXBF cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXBRK cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXISEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXINV cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXISEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _URXISEL cannot be defined because it is used by more than one SFR */
+
+/* U2MODE */
+/* Bitname _STSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _PDSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _PDSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _BRGH cannot be defined because it is used by more than one SFR */
+/* Bitname _RXINV cannot be defined because it is used by more than one SFR */
+/* Bitname _ABAUD cannot be defined because it is used by more than one SFR */
+/* Bitname _LPBACK cannot be defined because it is used by more than one SFR */
+/* Bitname _WAKE cannot be defined because it is used by more than one SFR */
+/* Bitname _UEN0 cannot be defined because it is used by more than one SFR */
+/* Bitname _UEN1 cannot be defined because it is used by more than one SFR */
+/* Bitname _RTSMD cannot be defined because it is used by more than one SFR */
+/* Bitname _IREN cannot be defined because it is used by more than one SFR */
+/* Bitname _USIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _UARTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _PDSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _UEN cannot be defined because it is used by more than one SFR */
+
+/* U2STA */
+/* Bitname _URXDA cannot be defined because it is used by more than one SFR */
+/* Bitname _OERR cannot be defined because it is used by more than one SFR */
+/* Bitname _FERR cannot be defined because it is used by more than one SFR */
+/* Bitname _PERR cannot be defined because it is used by more than one SFR */
+/* Bitname _RIDLE cannot be defined because it is used by more than one SFR */
+/* Bitname _ADDEN cannot be defined because it is used by more than one SFR */
+/* Bitname _URXISEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _URXISEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRMT cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXBF cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXBRK cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXISEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXINV cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXISEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _URXISEL cannot be defined because it is used by more than one SFR */
+
+/* SPI1STAT */
+/* Bitname _SPIRBF cannot be defined because it is used by more than one SFR */
+/* Bitname _SPITBF cannot be defined because it is used by more than one SFR */
+/* Bitname _SISEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SISEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SISEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SRXMPT cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIROV cannot be defined because it is used by more than one SFR */
+/* Bitname _SRMPT cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIBEC0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIBEC1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIBEC2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPISIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIEN cannot be defined because it is used by more than one SFR */
+/* Bitname _SISEL cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIBEC cannot be defined because it is used by more than one SFR */
+
+/* SPI1CON1 */
+/* Bitname _PPRE0 cannot be defined because it is used by more than one SFR */
+/* Bitname _PPRE1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPRE0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPRE1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPRE2 cannot be defined because it is used by more than one SFR */
+/* Bitname _MSTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _CKP cannot be defined because it is used by more than one SFR */
+/* Bitname _SSEN cannot be defined because it is used by more than one SFR */
+/* Bitname _CKE cannot be defined because it is used by more than one SFR */
+/* Bitname _SMP cannot be defined because it is used by more than one SFR */
+/* Bitname _MODE16 cannot be defined because it is used by more than one SFR */
+/* Bitname _DISSDO cannot be defined because it is used by more than one SFR */
+/* Bitname _DISSCK cannot be defined because it is used by more than one SFR */
+/* Bitname _PPRE cannot be defined because it is used by more than one SFR */
+/* Bitname _SPRE cannot be defined because it is used by more than one SFR */
+
+/* SPI1CON2 */
+/* Bitname _SPIBEN cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIFE cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIFPOL cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIFSD cannot be defined because it is used by more than one SFR */
+/* Bitname _FRMEN cannot be defined because it is used by more than one SFR */
+
+/* U3MODE */
+/* Bitname _STSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _PDSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _PDSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _BRGH cannot be defined because it is used by more than one SFR */
+/* Bitname _RXINV cannot be defined because it is used by more than one SFR */
+/* Bitname _ABAUD cannot be defined because it is used by more than one SFR */
+/* Bitname _LPBACK cannot be defined because it is used by more than one SFR */
+/* Bitname _WAKE cannot be defined because it is used by more than one SFR */
+/* Bitname _UEN0 cannot be defined because it is used by more than one SFR */
+/* Bitname _UEN1 cannot be defined because it is used by more than one SFR */
+/* Bitname _RTSMD cannot be defined because it is used by more than one SFR */
+/* Bitname _IREN cannot be defined because it is used by more than one SFR */
+/* Bitname _USIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _UARTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _PDSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _UEN cannot be defined because it is used by more than one SFR */
+
+/* U3STA */
+/* Bitname _URXDA cannot be defined because it is used by more than one SFR */
+/* Bitname _OERR cannot be defined because it is used by more than one SFR */
+/* Bitname _FERR cannot be defined because it is used by more than one SFR */
+/* Bitname _PERR cannot be defined because it is used by more than one SFR */
+/* Bitname _RIDLE cannot be defined because it is used by more than one SFR */
+/* Bitname _ADDEN cannot be defined because it is used by more than one SFR */
+/* Bitname _URXISEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _URXISEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRMT cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXBF cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXBRK cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXISEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXINV cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXISEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _URXISEL cannot be defined because it is used by more than one SFR */
+
+/* SPI2STAT */
+/* Bitname _SPIRBF cannot be defined because it is used by more than one SFR */
+/* Bitname _SPITBF cannot be defined because it is used by more than one SFR */
+/* Bitname _SISEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SISEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SISEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SRXMPT cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIROV cannot be defined because it is used by more than one SFR */
+/* Bitname _SRMPT cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIBEC0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIBEC1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIBEC2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPISIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIEN cannot be defined because it is used by more than one SFR */
+/* Bitname _SISEL cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIBEC cannot be defined because it is used by more than one SFR */
+
+/* SPI2CON1 */
+/* Bitname _PPRE0 cannot be defined because it is used by more than one SFR */
+/* Bitname _PPRE1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPRE0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPRE1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPRE2 cannot be defined because it is used by more than one SFR */
+/* Bitname _MSTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _CKP cannot be defined because it is used by more than one SFR */
+/* Bitname _SSEN cannot be defined because it is used by more than one SFR */
+/* Bitname _CKE cannot be defined because it is used by more than one SFR */
+/* Bitname _SMP cannot be defined because it is used by more than one SFR */
+/* Bitname _MODE16 cannot be defined because it is used by more than one SFR */
+/* Bitname _DISSDO cannot be defined because it is used by more than one SFR */
+/* Bitname _DISSCK cannot be defined because it is used by more than one SFR */
+/* Bitname _PPRE cannot be defined because it is used by more than one SFR */
+/* Bitname _SPRE cannot be defined because it is used by more than one SFR */
+
+/* SPI2CON2 */
+/* Bitname _SPIBEN cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIFE cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIFPOL cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIFSD cannot be defined because it is used by more than one SFR */
+/* Bitname _FRMEN cannot be defined because it is used by more than one SFR */
+
+/* I2C3CON */
+/* Bitname _SEN cannot be defined because it is used by more than one SFR */
+/* Bitname _RSEN cannot be defined because it is used by more than one SFR */
+/* Bitname _PEN cannot be defined because it is used by more than one SFR */
+/* Bitname _RCEN cannot be defined because it is used by more than one SFR */
+/* Bitname _ACKEN cannot be defined because it is used by more than one SFR */
+/* Bitname _ACKDT cannot be defined because it is used by more than one SFR */
+/* Bitname _STREN cannot be defined because it is used by more than one SFR */
+/* Bitname _GCEN cannot be defined because it is used by more than one SFR */
+/* Bitname _SMEN cannot be defined because it is used by more than one SFR */
+/* Bitname _DISSLW cannot be defined because it is used by more than one SFR */
+/* Bitname _A10M cannot be defined because it is used by more than one SFR */
+/* Bitname _IPMIEN cannot be defined because it is used by more than one SFR */
+/* Bitname _SCLREL cannot be defined because it is used by more than one SFR */
+/* Bitname _I2CSIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _I2CEN cannot be defined because it is used by more than one SFR */
+
+/* I2C3STAT */
+/* Bitname _TBF cannot be defined because it is used by more than one SFR */
+/* Bitname _RBF cannot be defined because it is used by more than one SFR */
+/* Bitname _R_W cannot be defined because it is used by more than one SFR */
+/* Bitname _S cannot be defined because it is used by more than one SFR */
+/* Bitname _P cannot be defined because it is used by more than one SFR */
+/* Bitname _D_A cannot be defined because it is used by more than one SFR */
+/* Bitname _I2COV cannot be defined because it is used by more than one SFR */
+/* Bitname _IWCOL cannot be defined because it is used by more than one SFR */
+/* Bitname _ADD10 cannot be defined because it is used by more than one SFR */
+/* Bitname _GCSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _BCL cannot be defined because it is used by more than one SFR */
+/* Bitname _TRSTAT cannot be defined because it is used by more than one SFR */
+/* Bitname _ACKSTAT cannot be defined because it is used by more than one SFR */
+
+/* SPI3STAT */
+/* Bitname _SPIRBF cannot be defined because it is used by more than one SFR */
+/* Bitname _SPITBF cannot be defined because it is used by more than one SFR */
+/* Bitname _SISEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SISEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SISEL2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SRXMPT cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIROV cannot be defined because it is used by more than one SFR */
+/* Bitname _SRMPT cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIBEC0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIBEC1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIBEC2 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPISIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIEN cannot be defined because it is used by more than one SFR */
+/* Bitname _SISEL cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIBEC cannot be defined because it is used by more than one SFR */
+
+/* SPI3CON1 */
+/* Bitname _PPRE0 cannot be defined because it is used by more than one SFR */
+/* Bitname _PPRE1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPRE0 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPRE1 cannot be defined because it is used by more than one SFR */
+/* Bitname _SPRE2 cannot be defined because it is used by more than one SFR */
+/* Bitname _MSTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _CKP cannot be defined because it is used by more than one SFR */
+/* Bitname _SSEN cannot be defined because it is used by more than one SFR */
+/* Bitname _CKE cannot be defined because it is used by more than one SFR */
+/* Bitname _SMP cannot be defined because it is used by more than one SFR */
+/* Bitname _MODE16 cannot be defined because it is used by more than one SFR */
+/* Bitname _DISSDO cannot be defined because it is used by more than one SFR */
+/* Bitname _DISSCK cannot be defined because it is used by more than one SFR */
+/* Bitname _PPRE cannot be defined because it is used by more than one SFR */
+/* Bitname _SPRE cannot be defined because it is used by more than one SFR */
+
+/* SPI3CON2 */
+/* Bitname _SPIBEN cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIFE cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIFPOL cannot be defined because it is used by more than one SFR */
+/* Bitname _SPIFSD cannot be defined because it is used by more than one SFR */
+/* Bitname _FRMEN cannot be defined because it is used by more than one SFR */
+
+/* U4MODE */
+/* Bitname _STSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _PDSEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _PDSEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _BRGH cannot be defined because it is used by more than one SFR */
+/* Bitname _RXINV cannot be defined because it is used by more than one SFR */
+/* Bitname _ABAUD cannot be defined because it is used by more than one SFR */
+/* Bitname _LPBACK cannot be defined because it is used by more than one SFR */
+/* Bitname _WAKE cannot be defined because it is used by more than one SFR */
+/* Bitname _UEN0 cannot be defined because it is used by more than one SFR */
+/* Bitname _UEN1 cannot be defined because it is used by more than one SFR */
+/* Bitname _RTSMD cannot be defined because it is used by more than one SFR */
+/* Bitname _IREN cannot be defined because it is used by more than one SFR */
+/* Bitname _USIDL cannot be defined because it is used by more than one SFR */
+/* Bitname _UARTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _PDSEL cannot be defined because it is used by more than one SFR */
+/* Bitname _UEN cannot be defined because it is used by more than one SFR */
+
+/* U4STA */
+/* Bitname _URXDA cannot be defined because it is used by more than one SFR */
+/* Bitname _OERR cannot be defined because it is used by more than one SFR */
+/* Bitname _FERR cannot be defined because it is used by more than one SFR */
+/* Bitname _PERR cannot be defined because it is used by more than one SFR */
+/* Bitname _RIDLE cannot be defined because it is used by more than one SFR */
+/* Bitname _ADDEN cannot be defined because it is used by more than one SFR */
+/* Bitname _URXISEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _URXISEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _TRMT cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXBF cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXBRK cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXISEL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXINV cannot be defined because it is used by more than one SFR */
+/* Bitname _UTXISEL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _URXISEL cannot be defined because it is used by more than one SFR */
+
+/* TRISB */
+#define _TRISB0 TRISBbits.TRISB0
+#define _TRISB1 TRISBbits.TRISB1
+#define _TRISB2 TRISBbits.TRISB2
+#define _TRISB3 TRISBbits.TRISB3
+#define _TRISB4 TRISBbits.TRISB4
+#define _TRISB5 TRISBbits.TRISB5
+#define _TRISB6 TRISBbits.TRISB6
+#define _TRISB7 TRISBbits.TRISB7
+#define _TRISB8 TRISBbits.TRISB8
+#define _TRISB9 TRISBbits.TRISB9
+#define _TRISB10 TRISBbits.TRISB10
+#define _TRISB11 TRISBbits.TRISB11
+#define _TRISB12 TRISBbits.TRISB12
+#define _TRISB13 TRISBbits.TRISB13
+#define _TRISB14 TRISBbits.TRISB14
+#define _TRISB15 TRISBbits.TRISB15
+
+/* PORTB */
+#define _RB0 PORTBbits.RB0
+#define _RB1 PORTBbits.RB1
+#define _RB2 PORTBbits.RB2
+#define _RB3 PORTBbits.RB3
+#define _RB4 PORTBbits.RB4
+#define _RB5 PORTBbits.RB5
+#define _RB6 PORTBbits.RB6
+#define _RB7 PORTBbits.RB7
+#define _RB8 PORTBbits.RB8
+#define _RB9 PORTBbits.RB9
+#define _RB10 PORTBbits.RB10
+#define _RB11 PORTBbits.RB11
+#define _RB12 PORTBbits.RB12
+#define _RB13 PORTBbits.RB13
+#define _RB14 PORTBbits.RB14
+#define _RB15 PORTBbits.RB15
+
+/* LATB */
+#define _LATB0 LATBbits.LATB0
+#define _LATB1 LATBbits.LATB1
+#define _LATB2 LATBbits.LATB2
+#define _LATB3 LATBbits.LATB3
+#define _LATB4 LATBbits.LATB4
+#define _LATB5 LATBbits.LATB5
+#define _LATB6 LATBbits.LATB6
+#define _LATB7 LATBbits.LATB7
+#define _LATB8 LATBbits.LATB8
+#define _LATB9 LATBbits.LATB9
+#define _LATB10 LATBbits.LATB10
+#define _LATB11 LATBbits.LATB11
+#define _LATB12 LATBbits.LATB12
+#define _LATB13 LATBbits.LATB13
+#define _LATB14 LATBbits.LATB14
+#define _LATB15 LATBbits.LATB15
+
+/* ODCB */
+#define _ODB0 ODCBbits.ODB0
+#define _ODB1 ODCBbits.ODB1
+#define _ODB2 ODCBbits.ODB2
+#define _ODB3 ODCBbits.ODB3
+#define _ODB4 ODCBbits.ODB4
+#define _ODB5 ODCBbits.ODB5
+#define _ODB6 ODCBbits.ODB6
+#define _ODB7 ODCBbits.ODB7
+#define _ODB8 ODCBbits.ODB8
+#define _ODB9 ODCBbits.ODB9
+#define _ODB10 ODCBbits.ODB10
+#define _ODB11 ODCBbits.ODB11
+#define _ODB12 ODCBbits.ODB12
+#define _ODB13 ODCBbits.ODB13
+#define _ODB14 ODCBbits.ODB14
+#define _ODB15 ODCBbits.ODB15
+
+/* TRISC */
+#define _TRISC12 TRISCbits.TRISC12
+#define _TRISC13 TRISCbits.TRISC13
+#define _TRISC14 TRISCbits.TRISC14
+#define _TRISC15 TRISCbits.TRISC15
+
+/* PORTC */
+#define _RC12 PORTCbits.RC12
+#define _RC13 PORTCbits.RC13
+#define _RC14 PORTCbits.RC14
+#define _RC15 PORTCbits.RC15
+
+/* LATC */
+#define _LATC12 LATCbits.LATC12
+#define _LATC13 LATCbits.LATC13
+#define _LATC14 LATCbits.LATC14
+#define _LATC15 LATCbits.LATC15
+
+/* ODCC */
+#define _ODC12 ODCCbits.ODC12
+#define _ODC13 ODCCbits.ODC13
+#define _ODC14 ODCCbits.ODC14
+#define _ODC15 ODCCbits.ODC15
+
+/* TRISD */
+#define _TRISD0 TRISDbits.TRISD0
+#define _TRISD1 TRISDbits.TRISD1
+#define _TRISD2 TRISDbits.TRISD2
+#define _TRISD3 TRISDbits.TRISD3
+#define _TRISD4 TRISDbits.TRISD4
+#define _TRISD5 TRISDbits.TRISD5
+#define _TRISD6 TRISDbits.TRISD6
+#define _TRISD7 TRISDbits.TRISD7
+#define _TRISD8 TRISDbits.TRISD8
+#define _TRISD9 TRISDbits.TRISD9
+#define _TRISD10 TRISDbits.TRISD10
+#define _TRISD11 TRISDbits.TRISD11
+
+/* PORTD */
+#define _RD0 PORTDbits.RD0
+#define _RD1 PORTDbits.RD1
+#define _RD2 PORTDbits.RD2
+#define _RD3 PORTDbits.RD3
+#define _RD4 PORTDbits.RD4
+#define _RD5 PORTDbits.RD5
+#define _RD6 PORTDbits.RD6
+#define _RD7 PORTDbits.RD7
+#define _RD8 PORTDbits.RD8
+#define _RD9 PORTDbits.RD9
+#define _RD10 PORTDbits.RD10
+#define _RD11 PORTDbits.RD11
+
+/* LATD */
+#define _LATD0 LATDbits.LATD0
+#define _LATD1 LATDbits.LATD1
+#define _LATD2 LATDbits.LATD2
+#define _LATD3 LATDbits.LATD3
+#define _LATD4 LATDbits.LATD4
+#define _LATD5 LATDbits.LATD5
+#define _LATD6 LATDbits.LATD6
+#define _LATD7 LATDbits.LATD7
+#define _LATD8 LATDbits.LATD8
+#define _LATD9 LATDbits.LATD9
+#define _LATD10 LATDbits.LATD10
+#define _LATD11 LATDbits.LATD11
+
+/* ODCD */
+#define _ODD0 ODCDbits.ODD0
+#define _ODD1 ODCDbits.ODD1
+#define _ODD2 ODCDbits.ODD2
+#define _ODD3 ODCDbits.ODD3
+#define _ODD4 ODCDbits.ODD4
+#define _ODD5 ODCDbits.ODD5
+#define _ODD6 ODCDbits.ODD6
+#define _ODD7 ODCDbits.ODD7
+#define _ODD8 ODCDbits.ODD8
+#define _ODD9 ODCDbits.ODD9
+#define _ODD10 ODCDbits.ODD10
+#define _ODD11 ODCDbits.ODD11
+
+/* TRISE */
+#define _TRISE0 TRISEbits.TRISE0
+#define _TRISE1 TRISEbits.TRISE1
+#define _TRISE2 TRISEbits.TRISE2
+#define _TRISE3 TRISEbits.TRISE3
+#define _TRISE4 TRISEbits.TRISE4
+#define _TRISE5 TRISEbits.TRISE5
+#define _TRISE6 TRISEbits.TRISE6
+#define _TRISE7 TRISEbits.TRISE7
+
+/* PORTE */
+#define _RE0 PORTEbits.RE0
+#define _RE1 PORTEbits.RE1
+#define _RE2 PORTEbits.RE2
+#define _RE3 PORTEbits.RE3
+#define _RE4 PORTEbits.RE4
+#define _RE5 PORTEbits.RE5
+#define _RE6 PORTEbits.RE6
+#define _RE7 PORTEbits.RE7
+
+/* LATE */
+#define _LATE0 LATEbits.LATE0
+#define _LATE1 LATEbits.LATE1
+#define _LATE2 LATEbits.LATE2
+#define _LATE3 LATEbits.LATE3
+#define _LATE4 LATEbits.LATE4
+#define _LATE5 LATEbits.LATE5
+#define _LATE6 LATEbits.LATE6
+#define _LATE7 LATEbits.LATE7
+
+/* ODCE */
+#define _ODE0 ODCEbits.ODE0
+#define _ODE1 ODCEbits.ODE1
+#define _ODE2 ODCEbits.ODE2
+#define _ODE3 ODCEbits.ODE3
+#define _ODE4 ODCEbits.ODE4
+#define _ODE5 ODCEbits.ODE5
+#define _ODE6 ODCEbits.ODE6
+#define _ODE7 ODCEbits.ODE7
+
+/* TRISF */
+#define _TRISF0 TRISFbits.TRISF0
+#define _TRISF1 TRISFbits.TRISF1
+#define _TRISF3 TRISFbits.TRISF3
+#define _TRISF4 TRISFbits.TRISF4
+#define _TRISF5 TRISFbits.TRISF5
+
+/* PORTF */
+#define _RF0 PORTFbits.RF0
+#define _RF1 PORTFbits.RF1
+#define _RF3 PORTFbits.RF3
+#define _RF4 PORTFbits.RF4
+#define _RF5 PORTFbits.RF5
+
+/* LATF */
+#define _LATF0 LATFbits.LATF0
+#define _LATF1 LATFbits.LATF1
+#define _LATF3 LATFbits.LATF3
+#define _LATF4 LATFbits.LATF4
+#define _LATF5 LATFbits.LATF5
+
+/* ODCF */
+#define _ODF0 ODCFbits.ODF0
+#define _ODF1 ODCFbits.ODF1
+#define _ODF3 ODCFbits.ODF3
+#define _ODF4 ODCFbits.ODF4
+#define _ODF5 ODCFbits.ODF5
+
+/* TRISG */
+#define _TRISG2 TRISGbits.TRISG2
+#define _TRISG3 TRISGbits.TRISG3
+#define _TRISG6 TRISGbits.TRISG6
+#define _TRISG7 TRISGbits.TRISG7
+#define _TRISG8 TRISGbits.TRISG8
+#define _TRISG9 TRISGbits.TRISG9
+
+/* PORTG */
+#define _RG2 PORTGbits.RG2
+#define _RG3 PORTGbits.RG3
+#define _RG6 PORTGbits.RG6
+#define _RG7 PORTGbits.RG7
+#define _RG8 PORTGbits.RG8
+#define _RG9 PORTGbits.RG9
+
+/* LATG */
+#define _LATG2 LATGbits.LATG2
+#define _LATG3 LATGbits.LATG3
+#define _LATG6 LATGbits.LATG6
+#define _LATG7 LATGbits.LATG7
+#define _LATG8 LATGbits.LATG8
+#define _LATG9 LATGbits.LATG9
+
+/* ODCG */
+#define _ODG2 ODCGbits.ODG2
+#define _ODG3 ODCGbits.ODG3
+#define _ODG6 ODCGbits.ODG6
+#define _ODG7 ODCGbits.ODG7
+#define _ODG8 ODCGbits.ODG8
+#define _ODG9 ODCGbits.ODG9
+
+/* PADCFG1 */
+#define _PMPTTL PADCFG1bits.PMPTTL
+#define _RTSECSEL PADCFG1bits.RTSECSEL
+#define _RTSECSEL0 PADCFG1bits.RTSECSEL0
+
+/* AD1CON1 */
+#define _DONE AD1CON1bits.DONE
+#define _SAMP AD1CON1bits.SAMP
+#define _ASAM AD1CON1bits.ASAM
+#define _SSRC0 AD1CON1bits.SSRC0
+#define _SSRC1 AD1CON1bits.SSRC1
+#define _SSRC2 AD1CON1bits.SSRC2
+#define _FORM0 AD1CON1bits.FORM0
+#define _FORM1 AD1CON1bits.FORM1
+#define _ADSIDL AD1CON1bits.ADSIDL
+#define _ADON AD1CON1bits.ADON
+#define _SSRC AD1CON1bits.SSRC
+#define _FORM AD1CON1bits.FORM
+
+/* AD1CON2 */
+#define _ALTS AD1CON2bits.ALTS
+#define _BUFM AD1CON2bits.BUFM
+#define _SMPI0 AD1CON2bits.SMPI0
+#define _SMPI1 AD1CON2bits.SMPI1
+#define _SMPI2 AD1CON2bits.SMPI2
+#define _SMPI3 AD1CON2bits.SMPI3
+#define _BUFS AD1CON2bits.BUFS
+#define _CSCNA AD1CON2bits.CSCNA
+#define _OFFCAL AD1CON2bits.OFFCAL
+#define _VCFG0 AD1CON2bits.VCFG0
+#define _VCFG1 AD1CON2bits.VCFG1
+#define _VCFG2 AD1CON2bits.VCFG2
+#define _SMPI AD1CON2bits.SMPI
+#define _VCFG AD1CON2bits.VCFG
+
+/* AD1CON3 */
+#define _ADCS0 AD1CON3bits.ADCS0
+#define _ADCS1 AD1CON3bits.ADCS1
+#define _ADCS2 AD1CON3bits.ADCS2
+#define _ADCS3 AD1CON3bits.ADCS3
+#define _ADCS4 AD1CON3bits.ADCS4
+#define _ADCS5 AD1CON3bits.ADCS5
+#define _ADCS6 AD1CON3bits.ADCS6
+#define _ADCS7 AD1CON3bits.ADCS7
+#define _SAMC0 AD1CON3bits.SAMC0
+#define _SAMC1 AD1CON3bits.SAMC1
+#define _SAMC2 AD1CON3bits.SAMC2
+#define _SAMC3 AD1CON3bits.SAMC3
+#define _SAMC4 AD1CON3bits.SAMC4
+#define _ADRC AD1CON3bits.ADRC
+#define _ADCS AD1CON3bits.ADCS
+#define _SAMC AD1CON3bits.SAMC
+
+/* AD1CHS */
+#define _CH0SA0 AD1CHSbits.CH0SA0
+#define _CH0SA1 AD1CHSbits.CH0SA1
+#define _CH0SA2 AD1CHSbits.CH0SA2
+#define _CH0SA3 AD1CHSbits.CH0SA3
+#define _CH0SA4 AD1CHSbits.CH0SA4
+#define _CH0NA AD1CHSbits.CH0NA
+#define _CH0SB0 AD1CHSbits.CH0SB0
+#define _CH0SB1 AD1CHSbits.CH0SB1
+#define _CH0SB2 AD1CHSbits.CH0SB2
+#define _CH0SB3 AD1CHSbits.CH0SB3
+#define _CH0SB4 AD1CHSbits.CH0SB4
+#define _CH0NB AD1CHSbits.CH0NB
+#define _CH0SA AD1CHSbits.CH0SA
+#define _CH0SB AD1CHSbits.CH0SB
+
+/* AD1PCFGH */
+#define _PCFG16 AD1PCFGHbits.PCFG16
+#define _PCFG17 AD1PCFGHbits.PCFG17
+
+/* AD1PCFG */
+#define _PCFG0 AD1PCFGbits.PCFG0
+#define _PCFG1 AD1PCFGbits.PCFG1
+#define _PCFG2 AD1PCFGbits.PCFG2
+#define _PCFG3 AD1PCFGbits.PCFG3
+#define _PCFG4 AD1PCFGbits.PCFG4
+#define _PCFG5 AD1PCFGbits.PCFG5
+#define _PCFG6 AD1PCFGbits.PCFG6
+#define _PCFG7 AD1PCFGbits.PCFG7
+#define _PCFG8 AD1PCFGbits.PCFG8
+#define _PCFG9 AD1PCFGbits.PCFG9
+#define _PCFG10 AD1PCFGbits.PCFG10
+#define _PCFG11 AD1PCFGbits.PCFG11
+#define _PCFG12 AD1PCFGbits.PCFG12
+#define _PCFG13 AD1PCFGbits.PCFG13
+#define _PCFG14 AD1PCFGbits.PCFG14
+#define _PCFG15 AD1PCFGbits.PCFG15
+
+/* AD1CSSL */
+#define _CSSL0 AD1CSSLbits.CSSL0
+#define _CSSL1 AD1CSSLbits.CSSL1
+#define _CSSL2 AD1CSSLbits.CSSL2
+#define _CSSL3 AD1CSSLbits.CSSL3
+#define _CSSL4 AD1CSSLbits.CSSL4
+#define _CSSL5 AD1CSSLbits.CSSL5
+#define _CSSL6 AD1CSSLbits.CSSL6
+#define _CSSL7 AD1CSSLbits.CSSL7
+#define _CSSL8 AD1CSSLbits.CSSL8
+#define _CSSL9 AD1CSSLbits.CSSL9
+#define _CSSL10 AD1CSSLbits.CSSL10
+#define _CSSL11 AD1CSSLbits.CSSL11
+#define _CSSL12 AD1CSSLbits.CSSL12
+#define _CSSL13 AD1CSSLbits.CSSL13
+#define _CSSL14 AD1CSSLbits.CSSL14
+#define _CSSL15 AD1CSSLbits.CSSL15
+
+/* AD1CSSH */
+#define _CSSL16 AD1CSSHbits.CSSL16
+#define _CSSL17 AD1CSSHbits.CSSL17
+
+/* CTMUCON */
+#define _EDG1STAT CTMUCONbits.EDG1STAT
+#define _EDG2STAT CTMUCONbits.EDG2STAT
+#define _EDG1SEL0 CTMUCONbits.EDG1SEL0
+#define _EDG1SEL1 CTMUCONbits.EDG1SEL1
+#define _EDG1POL CTMUCONbits.EDG1POL
+#define _EDG2SEL0 CTMUCONbits.EDG2SEL0
+#define _EDG2SEL1 CTMUCONbits.EDG2SEL1
+#define _EDG2POL CTMUCONbits.EDG2POL
+#define _CTTRIG CTMUCONbits.CTTRIG
+#define _IDISSEN CTMUCONbits.IDISSEN
+#define _EDGSEQEN CTMUCONbits.EDGSEQEN
+#define _EDGEN CTMUCONbits.EDGEN
+#define _TGEN CTMUCONbits.TGEN
+#define _CTMUSIDL CTMUCONbits.CTMUSIDL
+#define _CTMUEN CTMUCONbits.CTMUEN
+#define _EDG1SEL CTMUCONbits.EDG1SEL
+#define _EDG2SEL CTMUCONbits.EDG2SEL
+
+/* CTMUICON */
+#define _IRNG0 CTMUICONbits.IRNG0
+#define _IRNG1 CTMUICONbits.IRNG1
+#define _ITRIM0 CTMUICONbits.ITRIM0
+#define _ITRIM1 CTMUICONbits.ITRIM1
+#define _ITRIM2 CTMUICONbits.ITRIM2
+#define _ITRIM3 CTMUICONbits.ITRIM3
+#define _ITRIM4 CTMUICONbits.ITRIM4
+#define _ITRIM5 CTMUICONbits.ITRIM5
+#define _IRNG CTMUICONbits.IRNG
+#define _ITRIM CTMUICONbits.ITRIM
+
+/* U1OTGIR */
+#define _VBUSVDIF U1OTGIRbits.VBUSVDIF
+#define _SESENDIF U1OTGIRbits.SESENDIF
+#define _SESVDIF U1OTGIRbits.SESVDIF
+#define _ACTVIF U1OTGIRbits.ACTVIF
+#define _LSTATEIF U1OTGIRbits.LSTATEIF
+#define _T1MSECIF U1OTGIRbits.T1MSECIF
+#define _IDIF U1OTGIRbits.IDIF
+
+/* U1OTGIE */
+#define _VBUSVDIE U1OTGIEbits.VBUSVDIE
+#define _SESENDIE U1OTGIEbits.SESENDIE
+#define _SESVDIE U1OTGIEbits.SESVDIE
+#define _ACTVIE U1OTGIEbits.ACTVIE
+#define _LSTATEIE U1OTGIEbits.LSTATEIE
+#define _T1MSECIE U1OTGIEbits.T1MSECIE
+#define _IDIE U1OTGIEbits.IDIE
+
+/* U1OTGSTAT */
+#define _VBUSVD U1OTGSTATbits.VBUSVD
+#define _SESEND U1OTGSTATbits.SESEND
+#define _SESVD U1OTGSTATbits.SESVD
+#define _LSTATE U1OTGSTATbits.LSTATE
+#define _ID U1OTGSTATbits.ID
+
+/* U1OTGCON */
+#define _VBUSDIS U1OTGCONbits.VBUSDIS
+#define _VBUSCHG U1OTGCONbits.VBUSCHG
+#define _OTGEN U1OTGCONbits.OTGEN
+#define _VBUSON U1OTGCONbits.VBUSON
+#define _DMPULDWN U1OTGCONbits.DMPULDWN
+#define _DPPULDWN U1OTGCONbits.DPPULDWN
+#define _DMPULUP U1OTGCONbits.DMPULUP
+#define _DPPULUP U1OTGCONbits.DPPULUP
+
+/* U1PWRC */
+#define _USBPWR U1PWRCbits.USBPWR
+#define _USUSPEND U1PWRCbits.USUSPEND
+#define _USLPGRD U1PWRCbits.USLPGRD
+#define _UACTPND U1PWRCbits.UACTPND
+#define _USUSPND U1PWRCbits.USUSPND
+
+/* U1IR */
+#define _DETACHIF U1IRbits.DETACHIF
+#define _UERRIF U1IRbits.UERRIF
+#define _SOFIF U1IRbits.SOFIF
+#define _TRNIF U1IRbits.TRNIF
+#define _IDLEIF U1IRbits.IDLEIF
+#define _RESUMEIF U1IRbits.RESUMEIF
+#define _ATTACHIF U1IRbits.ATTACHIF
+#define _STALLIF U1IRbits.STALLIF
+#define _URSTIF U1IRbits.URSTIF
+
+/* U1IE */
+#define _DETACHIE U1IEbits.DETACHIE
+#define _UERRIE U1IEbits.UERRIE
+#define _SOFIE U1IEbits.SOFIE
+#define _TRNIE U1IEbits.TRNIE
+#define _IDLEIE U1IEbits.IDLEIE
+#define _RESUMEIE U1IEbits.RESUMEIE
+#define _ATTACHIE U1IEbits.ATTACHIE
+#define _STALLIE U1IEbits.STALLIE
+#define _URSTIE U1IEbits.URSTIE
+
+/* U1EIR */
+#define _PIDEF U1EIRbits.PIDEF
+#define _CRC5EF U1EIRbits.CRC5EF
+#define _CRC16EF U1EIRbits.CRC16EF
+#define _DFN8EF U1EIRbits.DFN8EF
+#define _BTOEF U1EIRbits.BTOEF
+#define _DMAEF U1EIRbits.DMAEF
+#define _BTSEF U1EIRbits.BTSEF
+#define _EOFEF U1EIRbits.EOFEF
+
+/* U1EIE */
+#define _PIDEE U1EIEbits.PIDEE
+#define _CRC5EE U1EIEbits.CRC5EE
+#define _CRC16EE U1EIEbits.CRC16EE
+#define _DFN8EE U1EIEbits.DFN8EE
+#define _BTOEE U1EIEbits.BTOEE
+#define _DMAEE U1EIEbits.DMAEE
+#define _BTSEE U1EIEbits.BTSEE
+#define _EOFEE U1EIEbits.EOFEE
+
+/* U1STAT */
+#define _PPBI U1STATbits.PPBI
+#define _DIR U1STATbits.DIR
+#define _ENDPT0 U1STATbits.ENDPT0
+#define _ENDPT1 U1STATbits.ENDPT1
+#define _ENDPT2 U1STATbits.ENDPT2
+#define _ENDPT3 U1STATbits.ENDPT3
+#define _ENDPT U1STATbits.ENDPT
+
+/* U1CON */
+#define _USBEN U1CONbits.USBEN
+#define _PPBRST U1CONbits.PPBRST
+#define _RESUME U1CONbits.RESUME
+#define _HOSTEN U1CONbits.HOSTEN
+#define _USBRST U1CONbits.USBRST
+#define _PKTDIS U1CONbits.PKTDIS
+#define _SE0 U1CONbits.SE0
+#define _JSTATE U1CONbits.JSTATE
+#define _SOFEN U1CONbits.SOFEN
+#define _TOKBUSY U1CONbits.TOKBUSY
+
+/* U1ADDR */
+#define _DEVADDR0 U1ADDRbits.DEVADDR0
+#define _DEVADDR1 U1ADDRbits.DEVADDR1
+#define _DEVADDR2 U1ADDRbits.DEVADDR2
+#define _DEVADDR3 U1ADDRbits.DEVADDR3
+#define _DEVADDR4 U1ADDRbits.DEVADDR4
+#define _DEVADDR5 U1ADDRbits.DEVADDR5
+#define _DEVADDR6 U1ADDRbits.DEVADDR6
+#define _LOWSPDEN U1ADDRbits.LOWSPDEN
+#define _DEVADDR U1ADDRbits.DEVADDR
+#define _LSPDEN U1ADDRbits.LSPDEN
+
+/* U1BDTP1 */
+#define _BDTPTRL U1BDTP1bits.BDTPTRL
+
+/* U1FRML */
+#define _FRM0 U1FRMLbits.FRM0
+#define _FRM1 U1FRMLbits.FRM1
+#define _FRM2 U1FRMLbits.FRM2
+#define _FRM3 U1FRMLbits.FRM3
+#define _FRM4 U1FRMLbits.FRM4
+#define _FRM5 U1FRMLbits.FRM5
+#define _FRM6 U1FRMLbits.FRM6
+#define _FRM7 U1FRMLbits.FRM7
+
+/* U1FRMH */
+#define _FRM8 U1FRMHbits.FRM8
+#define _FRM9 U1FRMHbits.FRM9
+#define _FRM10 U1FRMHbits.FRM10
+
+/* U1TOK */
+#define _EP0 U1TOKbits.EP0
+#define _EP1 U1TOKbits.EP1
+#define _EP2 U1TOKbits.EP2
+#define _EP3 U1TOKbits.EP3
+#define _PID0 U1TOKbits.PID0
+#define _PID1 U1TOKbits.PID1
+#define _PID2 U1TOKbits.PID2
+#define _PID3 U1TOKbits.PID3
+#define _EP U1TOKbits.EP
+#define _PID U1TOKbits.PID
+
+/* U1SOF */
+#define _CNT U1SOFbits.CNT
+
+/* U1BDTP2 */
+#define _BDTPTRH U1BDTP2bits.BDTPTRH
+
+/* U1BDTP3 */
+#define _BDTPTRU U1BDTP3bits.BDTPTRU
+
+/* U1CNFG1 */
+#define _PPB0 U1CNFG1bits.PPB0
+#define _PPB1 U1CNFG1bits.PPB1
+#define _USBSIDL U1CNFG1bits.USBSIDL
+#define _UOEMON U1CNFG1bits.UOEMON
+#define _UTEYE U1CNFG1bits.UTEYE
+#define _PPB U1CNFG1bits.PPB
+
+/* U1CNFG2 */
+#define _UTRDIS U1CNFG2bits.UTRDIS
+#define _UVCMPDIS U1CNFG2bits.UVCMPDIS
+#define _UVBUSDIS U1CNFG2bits.UVBUSDIS
+#define _EXTI2CEN U1CNFG2bits.EXTI2CEN
+
+/* U1EP0 */
+/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
+/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
+/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
+#define _RETRYDIS U1EP0bits.RETRYDIS
+#define _LOWSPD U1EP0bits.LOWSPD
+/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
+#define _LSPD U1EP0bits.LSPD
+
+/* U1EP1 */
+/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
+/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
+/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
+/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
+
+/* U1EP2 */
+/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
+/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
+/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
+/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
+
+/* U1EP3 */
+/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
+/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
+/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
+/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
+
+/* U1EP4 */
+/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
+/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
+/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
+/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
+
+/* U1EP5 */
+/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
+/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
+/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
+/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
+
+/* U1EP6 */
+/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
+/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
+/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
+/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
+
+/* U1EP7 */
+/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
+/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
+/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
+/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
+
+/* U1EP8 */
+/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
+/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
+/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
+/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
+
+/* U1EP9 */
+/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
+/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
+/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
+/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
+
+/* U1EP10 */
+/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
+/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
+/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
+/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
+
+/* U1EP11 */
+/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
+/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
+/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
+/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
+
+/* U1EP12 */
+/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
+/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
+/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
+/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
+
+/* U1EP13 */
+/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
+/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
+/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
+/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
+
+/* U1EP14 */
+/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
+/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
+/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
+/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
+
+/* U1EP15 */
+/* Bitname _EPHSHK cannot be defined because it is used by more than one SFR */
+/* Bitname _EPSTALL cannot be defined because it is used by more than one SFR */
+/* Bitname _EPINEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPOUTEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPCONDIS cannot be defined because it is used by more than one SFR */
+/* Bitname _EPTXEN cannot be defined because it is used by more than one SFR */
+/* Bitname _EPRXEN cannot be defined because it is used by more than one SFR */
+
+/* U1PWMRRS */
+#define _USBRS0 U1PWMRRSbits.USBRS0
+#define _USBRS1 U1PWMRRSbits.USBRS1
+#define _USBRS2 U1PWMRRSbits.USBRS2
+#define _USBRS3 U1PWMRRSbits.USBRS3
+#define _USBRS4 U1PWMRRSbits.USBRS4
+#define _USBRS5 U1PWMRRSbits.USBRS5
+#define _USBRS6 U1PWMRRSbits.USBRS6
+#define _USBRS7 U1PWMRRSbits.USBRS7
+#define _USBR0 U1PWMRRSbits.USBR0
+#define _USBR1 U1PWMRRSbits.USBR1
+#define _USBR2 U1PWMRRSbits.USBR2
+#define _USBR3 U1PWMRRSbits.USBR3
+#define _USBR4 U1PWMRRSbits.USBR4
+#define _USBR5 U1PWMRRSbits.USBR5
+#define _USBR6 U1PWMRRSbits.USBR6
+#define _USBR7 U1PWMRRSbits.USBR7
+#define _USBRS U1PWMRRSbits.USBRS
+#define _USBR U1PWMRRSbits.USBR
+#define _PER U1PWMRRSbits.PER
+/* Bitname _DC cannot be defined because it is used by more than one SFR */
+#define _PER0 U1PWMRRSbits.PER0
+#define _PER1 U1PWMRRSbits.PER1
+#define _PER2 U1PWMRRSbits.PER2
+#define _PER3 U1PWMRRSbits.PER3
+#define _PER4 U1PWMRRSbits.PER4
+#define _PER5 U1PWMRRSbits.PER5
+#define _PER6 U1PWMRRSbits.PER6
+#define _PER7 U1PWMRRSbits.PER7
+#define _DC0 U1PWMRRSbits.DC0
+#define _DC1 U1PWMRRSbits.DC1
+#define _DC2 U1PWMRRSbits.DC2
+#define _DC3 U1PWMRRSbits.DC3
+#define _DC4 U1PWMRRSbits.DC4
+#define _DC5 U1PWMRRSbits.DC5
+#define _DC6 U1PWMRRSbits.DC6
+#define _DC7 U1PWMRRSbits.DC7
+
+/* U1PWMCON */
+#define _CNTEN U1PWMCONbits.CNTEN
+#define _PWMPOL U1PWMCONbits.PWMPOL
+#define _USBTSEL0 U1PWMCONbits.USBTSEL0
+#define _USBTSEL1 U1PWMCONbits.USBTSEL1
+#define _USBTSEL2 U1PWMCONbits.USBTSEL2
+#define _PWMEN U1PWMCONbits.PWMEN
+#define _USBTSEL U1PWMCONbits.USBTSEL
+
+/* PMCON */
+#define _RDSP PMCONbits.RDSP
+#define _WRSP PMCONbits.WRSP
+#define _BEP PMCONbits.BEP
+#define _CS1P PMCONbits.CS1P
+#define _CS2P PMCONbits.CS2P
+#define _ALP PMCONbits.ALP
+#define _CSF0 PMCONbits.CSF0
+#define _CSF1 PMCONbits.CSF1
+#define _PTRDEN PMCONbits.PTRDEN
+#define _PTWREN PMCONbits.PTWREN
+#define _PTBEEN PMCONbits.PTBEEN
+#define _ADRMUX0 PMCONbits.ADRMUX0
+#define _ADRMUX1 PMCONbits.ADRMUX1
+#define _PSIDL PMCONbits.PSIDL
+#define _PMPEN PMCONbits.PMPEN
+#define _CSF PMCONbits.CSF
+#define _ADRMUX PMCONbits.ADRMUX
+
+/* PMMODE */
+#define _WAITE0 PMMODEbits.WAITE0
+#define _WAITE1 PMMODEbits.WAITE1
+#define _WAITM0 PMMODEbits.WAITM0
+#define _WAITM1 PMMODEbits.WAITM1
+#define _WAITM2 PMMODEbits.WAITM2
+#define _WAITM3 PMMODEbits.WAITM3
+#define _WAITB0 PMMODEbits.WAITB0
+#define _WAITB1 PMMODEbits.WAITB1
+#define _MODE0 PMMODEbits.MODE0
+#define _MODE1 PMMODEbits.MODE1
+/* Bitname _MODE16 cannot be defined because it is used by more than one SFR */
+#define _INCM0 PMMODEbits.INCM0
+#define _INCM1 PMMODEbits.INCM1
+#define _IRQM0 PMMODEbits.IRQM0
+#define _IRQM1 PMMODEbits.IRQM1
+#define _BUSY PMMODEbits.BUSY
+#define _WAITE PMMODEbits.WAITE
+#define _WAITM PMMODEbits.WAITM
+#define _WAITB PMMODEbits.WAITB
+#define _MODE PMMODEbits.MODE
+#define _INCM PMMODEbits.INCM
+#define _IRQM PMMODEbits.IRQM
+
+/* PMADDR */
+#define _CS1 PMADDRbits.CS1
+#define _CS2 PMADDRbits.CS2
+#define _ADDR PMADDRbits.ADDR
+#define _CS PMADDRbits.CS
+
+/* PMAEN */
+#define _PTEN0 PMAENbits.PTEN0
+#define _PTEN1 PMAENbits.PTEN1
+#define _PTEN2 PMAENbits.PTEN2
+#define _PTEN3 PMAENbits.PTEN3
+#define _PTEN4 PMAENbits.PTEN4
+#define _PTEN5 PMAENbits.PTEN5
+#define _PTEN6 PMAENbits.PTEN6
+#define _PTEN7 PMAENbits.PTEN7
+#define _PTEN8 PMAENbits.PTEN8
+#define _PTEN9 PMAENbits.PTEN9
+#define _PTEN10 PMAENbits.PTEN10
+#define _PTEN11 PMAENbits.PTEN11
+#define _PTEN12 PMAENbits.PTEN12
+#define _PTEN13 PMAENbits.PTEN13
+#define _PTEN14 PMAENbits.PTEN14
+#define _PTEN15 PMAENbits.PTEN15
+
+/* PMSTAT */
+#define _OB0E PMSTATbits.OB0E
+#define _OB1E PMSTATbits.OB1E
+#define _OB2E PMSTATbits.OB2E
+#define _OB3E PMSTATbits.OB3E
+#define _OBUF PMSTATbits.OBUF
+#define _OBE PMSTATbits.OBE
+#define _IB0F PMSTATbits.IB0F
+#define _IB1F PMSTATbits.IB1F
+#define _IB2F PMSTATbits.IB2F
+#define _IB3F PMSTATbits.IB3F
+#define _IBOV PMSTATbits.IBOV
+#define _IBF PMSTATbits.IBF
+
+/* ALCFGRPT */
+#define _ARPT0 ALCFGRPTbits.ARPT0
+#define _ARPT1 ALCFGRPTbits.ARPT1
+#define _ARPT2 ALCFGRPTbits.ARPT2
+#define _ARPT3 ALCFGRPTbits.ARPT3
+#define _ARPT4 ALCFGRPTbits.ARPT4
+#define _ARPT5 ALCFGRPTbits.ARPT5
+#define _ARPT6 ALCFGRPTbits.ARPT6
+#define _ARPT7 ALCFGRPTbits.ARPT7
+#define _ALRMPTR0 ALCFGRPTbits.ALRMPTR0
+#define _ALRMPTR1 ALCFGRPTbits.ALRMPTR1
+#define _AMASK0 ALCFGRPTbits.AMASK0
+#define _AMASK1 ALCFGRPTbits.AMASK1
+#define _AMASK2 ALCFGRPTbits.AMASK2
+#define _AMASK3 ALCFGRPTbits.AMASK3
+#define _CHIME ALCFGRPTbits.CHIME
+#define _ALRMEN ALCFGRPTbits.ALRMEN
+#define _ARPT ALCFGRPTbits.ARPT
+#define _ALRMPTR ALCFGRPTbits.ALRMPTR
+#define _AMASK ALCFGRPTbits.AMASK
+
+/* RCFGCAL */
+#define _CAL0 RCFGCALbits.CAL0
+#define _CAL1 RCFGCALbits.CAL1
+#define _CAL2 RCFGCALbits.CAL2
+#define _CAL3 RCFGCALbits.CAL3
+#define _CAL4 RCFGCALbits.CAL4
+#define _CAL5 RCFGCALbits.CAL5
+#define _CAL6 RCFGCALbits.CAL6
+#define _CAL7 RCFGCALbits.CAL7
+#define _RTCPTR0 RCFGCALbits.RTCPTR0
+#define _RTCPTR1 RCFGCALbits.RTCPTR1
+#define _RTCOE RCFGCALbits.RTCOE
+#define _HALFSEC RCFGCALbits.HALFSEC
+#define _RTCSYNC RCFGCALbits.RTCSYNC
+#define _RTCWREN RCFGCALbits.RTCWREN
+#define _RTCEN RCFGCALbits.RTCEN
+#define _CAL RCFGCALbits.CAL
+#define _RTCPTR RCFGCALbits.RTCPTR
+
+/* CMSTAT */
+#define _C1OUT CMSTATbits.C1OUT
+#define _C2OUT CMSTATbits.C2OUT
+#define _C3OUT CMSTATbits.C3OUT
+#define _C4OUT CMSTATbits.C4OUT
+#define _C5OUT CMSTATbits.C5OUT
+#define _C6OUT CMSTATbits.C6OUT
+#define _C1EVT CMSTATbits.C1EVT
+#define _C2EVT CMSTATbits.C2EVT
+#define _C3EVT CMSTATbits.C3EVT
+#define _C4EVT CMSTATbits.C4EVT
+#define _C5EVT CMSTATbits.C5EVT
+#define _C6EVT CMSTATbits.C6EVT
+#define _CMIDL CMSTATbits.CMIDL
+
+/* CVRCON */
+#define _CVR0 CVRCONbits.CVR0
+#define _CVR1 CVRCONbits.CVR1
+#define _CVR2 CVRCONbits.CVR2
+#define _CVR3 CVRCONbits.CVR3
+#define _CVRSS CVRCONbits.CVRSS
+#define _CVRR CVRCONbits.CVRR
+#define _CVROE CVRCONbits.CVROE
+#define _CVREN CVRCONbits.CVREN
+#define _CVR CVRCONbits.CVR
+
+/* CM1CON */
+/* Bitname _CCH0 cannot be defined because it is used by more than one SFR */
+/* Bitname _CCH1 cannot be defined because it is used by more than one SFR */
+/* Bitname _CREF cannot be defined because it is used by more than one SFR */
+/* Bitname _EVPOL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _EVPOL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _COUT cannot be defined because it is used by more than one SFR */
+/* Bitname _CEVT cannot be defined because it is used by more than one SFR */
+/* Bitname _CPOL cannot be defined because it is used by more than one SFR */
+/* Bitname _COE cannot be defined because it is used by more than one SFR */
+/* Bitname _CON cannot be defined because it is used by more than one SFR */
+/* Bitname _CCH cannot be defined because it is used by more than one SFR */
+/* Bitname _EVPOL cannot be defined because it is used by more than one SFR */
+/* Bitname _CEN cannot be defined because it is used by more than one SFR */
+
+/* CM2CON */
+/* Bitname _CCH0 cannot be defined because it is used by more than one SFR */
+/* Bitname _CCH1 cannot be defined because it is used by more than one SFR */
+/* Bitname _CREF cannot be defined because it is used by more than one SFR */
+/* Bitname _EVPOL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _EVPOL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _COUT cannot be defined because it is used by more than one SFR */
+/* Bitname _CEVT cannot be defined because it is used by more than one SFR */
+/* Bitname _CPOL cannot be defined because it is used by more than one SFR */
+/* Bitname _COE cannot be defined because it is used by more than one SFR */
+/* Bitname _CON cannot be defined because it is used by more than one SFR */
+/* Bitname _CCH cannot be defined because it is used by more than one SFR */
+/* Bitname _EVPOL cannot be defined because it is used by more than one SFR */
+/* Bitname _CEN cannot be defined because it is used by more than one SFR */
+
+/* CM3CON */
+/* Bitname _CCH0 cannot be defined because it is used by more than one SFR */
+/* Bitname _CCH1 cannot be defined because it is used by more than one SFR */
+/* Bitname _CREF cannot be defined because it is used by more than one SFR */
+/* Bitname _EVPOL0 cannot be defined because it is used by more than one SFR */
+/* Bitname _EVPOL1 cannot be defined because it is used by more than one SFR */
+/* Bitname _COUT cannot be defined because it is used by more than one SFR */
+/* Bitname _CEVT cannot be defined because it is used by more than one SFR */
+/* Bitname _CPOL cannot be defined because it is used by more than one SFR */
+/* Bitname _COE cannot be defined because it is used by more than one SFR */
+/* Bitname _CON cannot be defined because it is used by more than one SFR */
+/* Bitname _CCH cannot be defined because it is used by more than one SFR */
+/* Bitname _EVPOL cannot be defined because it is used by more than one SFR */
+/* Bitname _CEN cannot be defined because it is used by more than one SFR */
+
+/* CRCCON */
+#define _PLEN0 CRCCONbits.PLEN0
+#define _PLEN1 CRCCONbits.PLEN1
+#define _PLEN2 CRCCONbits.PLEN2
+#define _PLEN3 CRCCONbits.PLEN3
+#define _CRCGO CRCCONbits.CRCGO
+#define _CRCMPT CRCCONbits.CRCMPT
+#define _CRCFUL CRCCONbits.CRCFUL
+#define _VWORD0 CRCCONbits.VWORD0
+#define _VWORD1 CRCCONbits.VWORD1
+#define _VWORD2 CRCCONbits.VWORD2
+#define _VWORD3 CRCCONbits.VWORD3
+#define _VWORD4 CRCCONbits.VWORD4
+#define _CSIDL CRCCONbits.CSIDL
+#define _PLEN CRCCONbits.PLEN
+#define _VWORD CRCCONbits.VWORD
+
+/* CRCXOR */
+#define _X1 CRCXORbits.X1
+#define _X2 CRCXORbits.X2
+#define _X3 CRCXORbits.X3
+#define _X4 CRCXORbits.X4
+#define _X5 CRCXORbits.X5
+#define _X6 CRCXORbits.X6
+#define _X7 CRCXORbits.X7
+#define _X8 CRCXORbits.X8
+#define _X9 CRCXORbits.X9
+#define _X10 CRCXORbits.X10
+#define _X11 CRCXORbits.X11
+#define _X12 CRCXORbits.X12
+#define _X13 CRCXORbits.X13
+#define _X14 CRCXORbits.X14
+#define _X15 CRCXORbits.X15
+
+/* RPINR0 */
+#define _INT1R0 RPINR0bits.INT1R0
+#define _INT1R1 RPINR0bits.INT1R1
+#define _INT1R2 RPINR0bits.INT1R2
+#define _INT1R3 RPINR0bits.INT1R3
+#define _INT1R4 RPINR0bits.INT1R4
+#define _INT1R5 RPINR0bits.INT1R5
+#define _INT1R RPINR0bits.INT1R
+
+/* RPINR1 */
+#define _INT2R0 RPINR1bits.INT2R0
+#define _INT2R1 RPINR1bits.INT2R1
+#define _INT2R2 RPINR1bits.INT2R2
+#define _INT2R3 RPINR1bits.INT2R3
+#define _INT2R4 RPINR1bits.INT2R4
+#define _INT2R5 RPINR1bits.INT2R5
+#define _INT3R0 RPINR1bits.INT3R0
+#define _INT3R1 RPINR1bits.INT3R1
+#define _INT3R2 RPINR1bits.INT3R2
+#define _INT3R3 RPINR1bits.INT3R3
+#define _INT3R4 RPINR1bits.INT3R4
+#define _INT3R5 RPINR1bits.INT3R5
+#define _INT2R RPINR1bits.INT2R
+#define _INT3R RPINR1bits.INT3R
+
+/* RPINR2 */
+#define _INT4R0 RPINR2bits.INT4R0
+#define _INT4R1 RPINR2bits.INT4R1
+#define _INT4R2 RPINR2bits.INT4R2
+#define _INT4R3 RPINR2bits.INT4R3
+#define _INT4R4 RPINR2bits.INT4R4
+#define _INT4R5 RPINR2bits.INT4R5
+#define _T1CKR0 RPINR2bits.T1CKR0
+#define _T1CKR1 RPINR2bits.T1CKR1
+#define _T1CKR2 RPINR2bits.T1CKR2
+#define _T1CKR3 RPINR2bits.T1CKR3
+#define _T1CKR4 RPINR2bits.T1CKR4
+#define _T1CKR5 RPINR2bits.T1CKR5
+#define _INT4R RPINR2bits.INT4R
+#define _T1CKR RPINR2bits.T1CKR
+
+/* RPINR3 */
+#define _T2CKR0 RPINR3bits.T2CKR0
+#define _T2CKR1 RPINR3bits.T2CKR1
+#define _T2CKR2 RPINR3bits.T2CKR2
+#define _T2CKR3 RPINR3bits.T2CKR3
+#define _T2CKR4 RPINR3bits.T2CKR4
+#define _T2CKR5 RPINR3bits.T2CKR5
+#define _T3CKR0 RPINR3bits.T3CKR0
+#define _T3CKR1 RPINR3bits.T3CKR1
+#define _T3CKR2 RPINR3bits.T3CKR2
+#define _T3CKR3 RPINR3bits.T3CKR3
+#define _T3CKR4 RPINR3bits.T3CKR4
+#define _T3CKR5 RPINR3bits.T3CKR5
+#define _T2CKR RPINR3bits.T2CKR
+#define _T3CKR RPINR3bits.T3CKR
+
+/* RPINR4 */
+#define _T4CKR0 RPINR4bits.T4CKR0
+#define _T4CKR1 RPINR4bits.T4CKR1
+#define _T4CKR2 RPINR4bits.T4CKR2
+#define _T4CKR3 RPINR4bits.T4CKR3
+#define _T4CKR4 RPINR4bits.T4CKR4
+#define _T4CKR5 RPINR4bits.T4CKR5
+#define _T5CKR0 RPINR4bits.T5CKR0
+#define _T5CKR1 RPINR4bits.T5CKR1
+#define _T5CKR2 RPINR4bits.T5CKR2
+#define _T5CKR3 RPINR4bits.T5CKR3
+#define _T5CKR4 RPINR4bits.T5CKR4
+#define _T5CKR5 RPINR4bits.T5CKR5
+#define _T4CKR RPINR4bits.T4CKR
+#define _T5CKR RPINR4bits.T5CKR
+
+/* RPINR7 */
+#define _IC1R0 RPINR7bits.IC1R0
+#define _IC1R1 RPINR7bits.IC1R1
+#define _IC1R2 RPINR7bits.IC1R2
+#define _IC1R3 RPINR7bits.IC1R3
+#define _IC1R4 RPINR7bits.IC1R4
+#define _IC1R5 RPINR7bits.IC1R5
+#define _IC2R0 RPINR7bits.IC2R0
+#define _IC2R1 RPINR7bits.IC2R1
+#define _IC2R2 RPINR7bits.IC2R2
+#define _IC2R3 RPINR7bits.IC2R3
+#define _IC2R4 RPINR7bits.IC2R4
+#define _IC2R5 RPINR7bits.IC2R5
+#define _IC1R RPINR7bits.IC1R
+#define _IC2R RPINR7bits.IC2R
+
+/* RPINR8 */
+#define _IC3R0 RPINR8bits.IC3R0
+#define _IC3R1 RPINR8bits.IC3R1
+#define _IC3R2 RPINR8bits.IC3R2
+#define _IC3R3 RPINR8bits.IC3R3
+#define _IC3R4 RPINR8bits.IC3R4
+#define _IC3R5 RPINR8bits.IC3R5
+#define _IC4R0 RPINR8bits.IC4R0
+#define _IC4R1 RPINR8bits.IC4R1
+#define _IC4R2 RPINR8bits.IC4R2
+#define _IC4R3 RPINR8bits.IC4R3
+#define _IC4R4 RPINR8bits.IC4R4
+#define _IC4R5 RPINR8bits.IC4R5
+#define _IC3R RPINR8bits.IC3R
+#define _IC4R RPINR8bits.IC4R
+
+/* RPINR9 */
+#define _IC5R0 RPINR9bits.IC5R0
+#define _IC5R1 RPINR9bits.IC5R1
+#define _IC5R2 RPINR9bits.IC5R2
+#define _IC5R3 RPINR9bits.IC5R3
+#define _IC5R4 RPINR9bits.IC5R4
+#define _IC5R5 RPINR9bits.IC5R5
+#define _IC6R0 RPINR9bits.IC6R0
+#define _IC6R1 RPINR9bits.IC6R1
+#define _IC6R2 RPINR9bits.IC6R2
+#define _IC6R3 RPINR9bits.IC6R3
+#define _IC6R4 RPINR9bits.IC6R4
+#define _IC6R5 RPINR9bits.IC6R5
+#define _IC5R RPINR9bits.IC5R
+#define _IC6R RPINR9bits.IC6R
+
+/* RPINR10 */
+#define _IC7R0 RPINR10bits.IC7R0
+#define _IC7R1 RPINR10bits.IC7R1
+#define _IC7R2 RPINR10bits.IC7R2
+#define _IC7R3 RPINR10bits.IC7R3
+#define _IC7R4 RPINR10bits.IC7R4
+#define _IC7R5 RPINR10bits.IC7R5
+#define _IC8R0 RPINR10bits.IC8R0
+#define _IC8R1 RPINR10bits.IC8R1
+#define _IC8R2 RPINR10bits.IC8R2
+#define _IC8R3 RPINR10bits.IC8R3
+#define _IC8R4 RPINR10bits.IC8R4
+#define _IC8R5 RPINR10bits.IC8R5
+#define _IC7R RPINR10bits.IC7R
+#define _IC8R RPINR10bits.IC8R
+
+/* RPINR11 */
+#define _OCFAR0 RPINR11bits.OCFAR0
+#define _OCFAR1 RPINR11bits.OCFAR1
+#define _OCFAR2 RPINR11bits.OCFAR2
+#define _OCFAR3 RPINR11bits.OCFAR3
+#define _OCFAR4 RPINR11bits.OCFAR4
+#define _OCFAR5 RPINR11bits.OCFAR5
+#define _OCFBR0 RPINR11bits.OCFBR0
+#define _OCFBR1 RPINR11bits.OCFBR1
+#define _OCFBR2 RPINR11bits.OCFBR2
+#define _OCFBR3 RPINR11bits.OCFBR3
+#define _OCFBR4 RPINR11bits.OCFBR4
+#define _OCFBR5 RPINR11bits.OCFBR5
+#define _OCFAR RPINR11bits.OCFAR
+#define _OCFBR RPINR11bits.OCFBR
+
+/* RPINR15 */
+#define _IC9R0 RPINR15bits.IC9R0
+#define _IC9R1 RPINR15bits.IC9R1
+#define _IC9R2 RPINR15bits.IC9R2
+#define _IC9R3 RPINR15bits.IC9R3
+#define _IC9R4 RPINR15bits.IC9R4
+#define _IC9R5 RPINR15bits.IC9R5
+#define _IC9R RPINR15bits.IC9R
+
+/* RPINR17 */
+#define _U3RXR0 RPINR17bits.U3RXR0
+#define _U3RXR1 RPINR17bits.U3RXR1
+#define _U3RXR2 RPINR17bits.U3RXR2
+#define _U3RXR3 RPINR17bits.U3RXR3
+#define _U3RXR4 RPINR17bits.U3RXR4
+#define _U3RXR5 RPINR17bits.U3RXR5
+#define _U3RXR RPINR17bits.U3RXR
+
+/* RPINR18 */
+#define _U1RXR0 RPINR18bits.U1RXR0
+#define _U1RXR1 RPINR18bits.U1RXR1
+#define _U1RXR2 RPINR18bits.U1RXR2
+#define _U1RXR3 RPINR18bits.U1RXR3
+#define _U1RXR4 RPINR18bits.U1RXR4
+#define _U1RXR5 RPINR18bits.U1RXR5
+#define _U1CTSR0 RPINR18bits.U1CTSR0
+#define _U1CTSR1 RPINR18bits.U1CTSR1
+#define _U1CTSR2 RPINR18bits.U1CTSR2
+#define _U1CTSR3 RPINR18bits.U1CTSR3
+#define _U1CTSR4 RPINR18bits.U1CTSR4
+#define _U1CTSR5 RPINR18bits.U1CTSR5
+#define _U1RXR RPINR18bits.U1RXR
+#define _U1CTSR RPINR18bits.U1CTSR
+
+/* RPINR19 */
+#define _U2RXR0 RPINR19bits.U2RXR0
+#define _U2RXR1 RPINR19bits.U2RXR1
+#define _U2RXR2 RPINR19bits.U2RXR2
+#define _U2RXR3 RPINR19bits.U2RXR3
+#define _U2RXR4 RPINR19bits.U2RXR4
+#define _U2RXR5 RPINR19bits.U2RXR5
+#define _U2CTSR0 RPINR19bits.U2CTSR0
+#define _U2CTSR1 RPINR19bits.U2CTSR1
+#define _U2CTSR2 RPINR19bits.U2CTSR2
+#define _U2CTSR3 RPINR19bits.U2CTSR3
+#define _U2CTSR4 RPINR19bits.U2CTSR4
+#define _U2CTSR5 RPINR19bits.U2CTSR5
+#define _U2RXR RPINR19bits.U2RXR
+#define _U2CTSR RPINR19bits.U2CTSR
+
+/* RPINR20 */
+#define _SDI1R0 RPINR20bits.SDI1R0
+#define _SDI1R1 RPINR20bits.SDI1R1
+#define _SDI1R2 RPINR20bits.SDI1R2
+#define _SDI1R3 RPINR20bits.SDI1R3
+#define _SDI1R4 RPINR20bits.SDI1R4
+#define _SDI1R5 RPINR20bits.SDI1R5
+#define _SCK1R0 RPINR20bits.SCK1R0
+#define _SCK1R1 RPINR20bits.SCK1R1
+#define _SCK1R2 RPINR20bits.SCK1R2
+#define _SCK1R3 RPINR20bits.SCK1R3
+#define _SCK1R4 RPINR20bits.SCK1R4
+#define _SCK1R5 RPINR20bits.SCK1R5
+#define _SDI1R RPINR20bits.SDI1R
+#define _SCK1R RPINR20bits.SCK1R
+
+/* RPINR21 */
+#define _SS1R0 RPINR21bits.SS1R0
+#define _SS1R1 RPINR21bits.SS1R1
+#define _SS1R2 RPINR21bits.SS1R2
+#define _SS1R3 RPINR21bits.SS1R3
+#define _SS1R4 RPINR21bits.SS1R4
+#define _SS1R5 RPINR21bits.SS1R5
+#define _U3CTSR0 RPINR21bits.U3CTSR0
+#define _U3CTSR1 RPINR21bits.U3CTSR1
+#define _U3CTSR2 RPINR21bits.U3CTSR2
+#define _U3CTSR3 RPINR21bits.U3CTSR3
+#define _U3CTSR4 RPINR21bits.U3CTSR4
+#define _U3CTSR5 RPINR21bits.U3CTSR5
+#define _SS1R RPINR21bits.SS1R
+#define _U3CTSR RPINR21bits.U3CTSR
+
+/* RPINR22 */
+#define _SDI2R0 RPINR22bits.SDI2R0
+#define _SDI2R1 RPINR22bits.SDI2R1
+#define _SDI2R2 RPINR22bits.SDI2R2
+#define _SDI2R3 RPINR22bits.SDI2R3
+#define _SDI2R4 RPINR22bits.SDI2R4
+#define _SDI2R5 RPINR22bits.SDI2R5
+#define _SCK2R0 RPINR22bits.SCK2R0
+#define _SCK2R1 RPINR22bits.SCK2R1
+#define _SCK2R2 RPINR22bits.SCK2R2
+#define _SCK2R3 RPINR22bits.SCK2R3
+#define _SCK2R4 RPINR22bits.SCK2R4
+#define _SCK2R5 RPINR22bits.SCK2R5
+#define _SDI2R RPINR22bits.SDI2R
+#define _SCK2R RPINR22bits.SCK2R
+
+/* RPINR23 */
+#define _SS2R0 RPINR23bits.SS2R0
+#define _SS2R1 RPINR23bits.SS2R1
+#define _SS2R2 RPINR23bits.SS2R2
+#define _SS2R3 RPINR23bits.SS2R3
+#define _SS2R4 RPINR23bits.SS2R4
+#define _SS2R5 RPINR23bits.SS2R5
+#define _SS2R RPINR23bits.SS2R
+
+/* RPINR27 */
+#define _U4RXR0 RPINR27bits.U4RXR0
+#define _U4RXR1 RPINR27bits.U4RXR1
+#define _U4RXR2 RPINR27bits.U4RXR2
+#define _U4RXR3 RPINR27bits.U4RXR3
+#define _U4RXR4 RPINR27bits.U4RXR4
+#define _U4RXR5 RPINR27bits.U4RXR5
+#define _U4CTSR0 RPINR27bits.U4CTSR0
+#define _U4CTSR1 RPINR27bits.U4CTSR1
+#define _U4CTSR2 RPINR27bits.U4CTSR2
+#define _U4CTSR3 RPINR27bits.U4CTSR3
+#define _U4CTSR4 RPINR27bits.U4CTSR4
+#define _U4CTSR5 RPINR27bits.U4CTSR5
+#define _U4RXR RPINR27bits.U4RXR
+#define _U4CTSR RPINR27bits.U4CTSR
+
+/* RPINR28 */
+#define _SDI3R0 RPINR28bits.SDI3R0
+#define _SDI3R1 RPINR28bits.SDI3R1
+#define _SDI3R2 RPINR28bits.SDI3R2
+#define _SDI3R3 RPINR28bits.SDI3R3
+#define _SDI3R4 RPINR28bits.SDI3R4
+#define _SDI3R5 RPINR28bits.SDI3R5
+#define _SCK3R0 RPINR28bits.SCK3R0
+#define _SCK3R1 RPINR28bits.SCK3R1
+#define _SCK3R2 RPINR28bits.SCK3R2
+#define _SCK3R3 RPINR28bits.SCK3R3
+#define _SCK3R4 RPINR28bits.SCK3R4
+#define _SCK3R5 RPINR28bits.SCK3R5
+#define _SDI3R RPINR28bits.SDI3R
+#define _SCK3R RPINR28bits.SCK3R
+
+/* RPINR29 */
+#define _SS3R0 RPINR29bits.SS3R0
+#define _SS3R1 RPINR29bits.SS3R1
+#define _SS3R2 RPINR29bits.SS3R2
+#define _SS3R3 RPINR29bits.SS3R3
+#define _SS3R4 RPINR29bits.SS3R4
+#define _SS3R5 RPINR29bits.SS3R5
+#define _SS3R RPINR29bits.SS3R
+
+/* RPOR0 */
+#define _RP0R0 RPOR0bits.RP0R0
+#define _RP0R1 RPOR0bits.RP0R1
+#define _RP0R2 RPOR0bits.RP0R2
+#define _RP0R3 RPOR0bits.RP0R3
+#define _RP0R4 RPOR0bits.RP0R4
+#define _RP0R5 RPOR0bits.RP0R5
+#define _RP1R0 RPOR0bits.RP1R0
+#define _RP1R1 RPOR0bits.RP1R1
+#define _RP1R2 RPOR0bits.RP1R2
+#define _RP1R3 RPOR0bits.RP1R3
+#define _RP1R4 RPOR0bits.RP1R4
+#define _RP1R5 RPOR0bits.RP1R5
+#define _RP0R RPOR0bits.RP0R
+#define _RP1R RPOR0bits.RP1R
+
+/* RPOR1 */
+#define _RP2R0 RPOR1bits.RP2R0
+#define _RP2R1 RPOR1bits.RP2R1
+#define _RP2R2 RPOR1bits.RP2R2
+#define _RP2R3 RPOR1bits.RP2R3
+#define _RP2R4 RPOR1bits.RP2R4
+#define _RP2R5 RPOR1bits.RP2R5
+#define _RP3R0 RPOR1bits.RP3R0
+#define _RP3R1 RPOR1bits.RP3R1
+#define _RP3R2 RPOR1bits.RP3R2
+#define _RP3R3 RPOR1bits.RP3R3
+#define _RP3R4 RPOR1bits.RP3R4
+#define _RP3R5 RPOR1bits.RP3R5
+#define _RP2R RPOR1bits.RP2R
+#define _RP3R RPOR1bits.RP3R
+
+/* RPOR2 */
+#define _RP4R0 RPOR2bits.RP4R0
+#define _RP4R1 RPOR2bits.RP4R1
+#define _RP4R2 RPOR2bits.RP4R2
+#define _RP4R3 RPOR2bits.RP4R3
+#define _RP4R4 RPOR2bits.RP4R4
+#define _RP4R5 RPOR2bits.RP4R5
+#define _RP4R RPOR2bits.RP4R
+
+/* RPOR3 */
+#define _RP6R0 RPOR3bits.RP6R0
+#define _RP6R1 RPOR3bits.RP6R1
+#define _RP6R2 RPOR3bits.RP6R2
+#define _RP6R3 RPOR3bits.RP6R3
+#define _RP6R4 RPOR3bits.RP6R4
+#define _RP6R5 RPOR3bits.RP6R5
+#define _RP7R0 RPOR3bits.RP7R0
+#define _RP7R1 RPOR3bits.RP7R1
+#define _RP7R2 RPOR3bits.RP7R2
+#define _RP7R3 RPOR3bits.RP7R3
+#define _RP7R4 RPOR3bits.RP7R4
+#define _RP7R5 RPOR3bits.RP7R5
+#define _RP6R RPOR3bits.RP6R
+#define _RP7R RPOR3bits.RP7R
+
+/* RPOR4 */
+#define _RP8R0 RPOR4bits.RP8R0
+#define _RP8R1 RPOR4bits.RP8R1
+#define _RP8R2 RPOR4bits.RP8R2
+#define _RP8R3 RPOR4bits.RP8R3
+#define _RP8R4 RPOR4bits.RP8R4
+#define _RP8R5 RPOR4bits.RP8R5
+#define _RP9R0 RPOR4bits.RP9R0
+#define _RP9R1 RPOR4bits.RP9R1
+#define _RP9R2 RPOR4bits.RP9R2
+#define _RP9R3 RPOR4bits.RP9R3
+#define _RP9R4 RPOR4bits.RP9R4
+#define _RP9R5 RPOR4bits.RP9R5
+#define _RP8R RPOR4bits.RP8R
+#define _RP9R RPOR4bits.RP9R
+
+/* RPOR5 */
+#define _RP10R0 RPOR5bits.RP10R0
+#define _RP10R1 RPOR5bits.RP10R1
+#define _RP10R2 RPOR5bits.RP10R2
+#define _RP10R3 RPOR5bits.RP10R3
+#define _RP10R4 RPOR5bits.RP10R4
+#define _RP10R5 RPOR5bits.RP10R5
+#define _RP11R0 RPOR5bits.RP11R0
+#define _RP11R1 RPOR5bits.RP11R1
+#define _RP11R2 RPOR5bits.RP11R2
+#define _RP11R3 RPOR5bits.RP11R3
+#define _RP11R4 RPOR5bits.RP11R4
+#define _RP11R5 RPOR5bits.RP11R5
+#define _RP10R RPOR5bits.RP10R
+#define _RP11R RPOR5bits.RP11R
+
+/* RPOR6 */
+#define _RP12R0 RPOR6bits.RP12R0
+#define _RP12R1 RPOR6bits.RP12R1
+#define _RP12R2 RPOR6bits.RP12R2
+#define _RP12R3 RPOR6bits.RP12R3
+#define _RP12R4 RPOR6bits.RP12R4
+#define _RP12R5 RPOR6bits.RP12R5
+#define _RP13R0 RPOR6bits.RP13R0
+#define _RP13R1 RPOR6bits.RP13R1
+#define _RP13R2 RPOR6bits.RP13R2
+#define _RP13R3 RPOR6bits.RP13R3
+#define _RP13R4 RPOR6bits.RP13R4
+#define _RP13R5 RPOR6bits.RP13R5
+#define _RP12R RPOR6bits.RP12R
+#define _RP13R RPOR6bits.RP13R
+
+/* RPOR7 */
+#define _RP14R0 RPOR7bits.RP14R0
+#define _RP14R1 RPOR7bits.RP14R1
+#define _RP14R2 RPOR7bits.RP14R2
+#define _RP14R3 RPOR7bits.RP14R3
+#define _RP14R4 RPOR7bits.RP14R4
+#define _RP14R5 RPOR7bits.RP14R5
+#define _RP14R RPOR7bits.RP14R
+
+/* RPOR8 */
+#define _RP16R0 RPOR8bits.RP16R0
+#define _RP16R1 RPOR8bits.RP16R1
+#define _RP16R2 RPOR8bits.RP16R2
+#define _RP16R3 RPOR8bits.RP16R3
+#define _RP16R4 RPOR8bits.RP16R4
+#define _RP16R5 RPOR8bits.RP16R5
+#define _RP17R0 RPOR8bits.RP17R0
+#define _RP17R1 RPOR8bits.RP17R1
+#define _RP17R2 RPOR8bits.RP17R2
+#define _RP17R3 RPOR8bits.RP17R3
+#define _RP17R4 RPOR8bits.RP17R4
+#define _RP17R5 RPOR8bits.RP17R5
+#define _RP16R RPOR8bits.RP16R
+#define _RP17R RPOR8bits.RP17R
+
+/* RPOR9 */
+#define _RP18R0 RPOR9bits.RP18R0
+#define _RP18R1 RPOR9bits.RP18R1
+#define _RP18R2 RPOR9bits.RP18R2
+#define _RP18R3 RPOR9bits.RP18R3
+#define _RP18R4 RPOR9bits.RP18R4
+#define _RP18R5 RPOR9bits.RP18R5
+#define _RP19R0 RPOR9bits.RP19R0
+#define _RP19R1 RPOR9bits.RP19R1
+#define _RP19R2 RPOR9bits.RP19R2
+#define _RP19R3 RPOR9bits.RP19R3
+#define _RP19R4 RPOR9bits.RP19R4
+#define _RP19R5 RPOR9bits.RP19R5
+#define _RP18R RPOR9bits.RP18R
+#define _RP19R RPOR9bits.RP19R
+
+/* RPOR10 */
+#define _RP20R0 RPOR10bits.RP20R0
+#define _RP20R1 RPOR10bits.RP20R1
+#define _RP20R2 RPOR10bits.RP20R2
+#define _RP20R3 RPOR10bits.RP20R3
+#define _RP20R4 RPOR10bits.RP20R4
+#define _RP20R5 RPOR10bits.RP20R5
+#define _RP21R0 RPOR10bits.RP21R0
+#define _RP21R1 RPOR10bits.RP21R1
+#define _RP21R2 RPOR10bits.RP21R2
+#define _RP21R3 RPOR10bits.RP21R3
+#define _RP21R4 RPOR10bits.RP21R4
+#define _RP21R5 RPOR10bits.RP21R5
+#define _RP20R RPOR10bits.RP20R
+#define _RP21R RPOR10bits.RP21R
+
+/* RPOR11 */
+#define _RP22R0 RPOR11bits.RP22R0
+#define _RP22R1 RPOR11bits.RP22R1
+#define _RP22R2 RPOR11bits.RP22R2
+#define _RP22R3 RPOR11bits.RP22R3
+#define _RP22R4 RPOR11bits.RP22R4
+#define _RP22R5 RPOR11bits.RP22R5
+#define _RP23R0 RPOR11bits.RP23R0
+#define _RP23R1 RPOR11bits.RP23R1
+#define _RP23R2 RPOR11bits.RP23R2
+#define _RP23R3 RPOR11bits.RP23R3
+#define _RP23R4 RPOR11bits.RP23R4
+#define _RP23R5 RPOR11bits.RP23R5
+#define _RP22R RPOR11bits.RP22R
+#define _RP23R RPOR11bits.RP23R
+
+/* RPOR12 */
+#define _RP24R0 RPOR12bits.RP24R0
+#define _RP24R1 RPOR12bits.RP24R1
+#define _RP24R2 RPOR12bits.RP24R2
+#define _RP24R3 RPOR12bits.RP24R3
+#define _RP24R4 RPOR12bits.RP24R4
+#define _RP24R5 RPOR12bits.RP24R5
+#define _RP25R0 RPOR12bits.RP25R0
+#define _RP25R1 RPOR12bits.RP25R1
+#define _RP25R2 RPOR12bits.RP25R2
+#define _RP25R3 RPOR12bits.RP25R3
+#define _RP25R4 RPOR12bits.RP25R4
+#define _RP25R5 RPOR12bits.RP25R5
+#define _RP24R RPOR12bits.RP24R
+#define _RP25R RPOR12bits.RP25R
+
+/* RPOR13 */
+#define _RP26R0 RPOR13bits.RP26R0
+#define _RP26R1 RPOR13bits.RP26R1
+#define _RP26R2 RPOR13bits.RP26R2
+#define _RP26R3 RPOR13bits.RP26R3
+#define _RP26R4 RPOR13bits.RP26R4
+#define _RP26R5 RPOR13bits.RP26R5
+#define _RP27R0 RPOR13bits.RP27R0
+#define _RP27R1 RPOR13bits.RP27R1
+#define _RP27R2 RPOR13bits.RP27R2
+#define _RP27R3 RPOR13bits.RP27R3
+#define _RP27R4 RPOR13bits.RP27R4
+#define _RP27R5 RPOR13bits.RP27R5
+#define _RP26R RPOR13bits.RP26R
+#define _RP27R RPOR13bits.RP27R
+
+/* RPOR14 */
+#define _RP28R0 RPOR14bits.RP28R0
+#define _RP28R1 RPOR14bits.RP28R1
+#define _RP28R2 RPOR14bits.RP28R2
+#define _RP28R3 RPOR14bits.RP28R3
+#define _RP28R4 RPOR14bits.RP28R4
+#define _RP28R5 RPOR14bits.RP28R5
+#define _RP29R0 RPOR14bits.RP29R0
+#define _RP29R1 RPOR14bits.RP29R1
+#define _RP29R2 RPOR14bits.RP29R2
+#define _RP29R3 RPOR14bits.RP29R3
+#define _RP29R4 RPOR14bits.RP29R4
+#define _RP29R5 RPOR14bits.RP29R5
+#define _RP28R RPOR14bits.RP28R
+#define _RP29R RPOR14bits.RP29R
+
+/* RPOR15 */
+#define _RP30R0 RPOR15bits.RP30R0
+#define _RP30R1 RPOR15bits.RP30R1
+#define _RP30R2 RPOR15bits.RP30R2
+#define _RP30R3 RPOR15bits.RP30R3
+#define _RP30R4 RPOR15bits.RP30R4
+#define _RP30R5 RPOR15bits.RP30R5
+#define _RP30R RPOR15bits.RP30R
+
+/* RCON */
+#define _POR RCONbits.POR
+#define _BOR RCONbits.BOR
+#define _IDLE RCONbits.IDLE
+#define _SLEEP RCONbits.SLEEP
+#define _WDTO RCONbits.WDTO
+#define _SWDTEN RCONbits.SWDTEN
+#define _SWR RCONbits.SWR
+#define _EXTR RCONbits.EXTR
+#define _VREGS RCONbits.VREGS
+#define _CM RCONbits.CM
+#define _IOPUWR RCONbits.IOPUWR
+#define _TRAPR RCONbits.TRAPR
+#define _PMSLP RCONbits.PMSLP
+
+/* OSCCON */
+#define _OSWEN OSCCONbits.OSWEN
+#define _SOSCEN OSCCONbits.SOSCEN
+#define _POSCEN OSCCONbits.POSCEN
+#define _CF OSCCONbits.CF
+#define _LOCK OSCCONbits.LOCK
+#define _IOLOCK OSCCONbits.IOLOCK
+#define _CLKLOCK OSCCONbits.CLKLOCK
+#define _NOSC0 OSCCONbits.NOSC0
+#define _NOSC1 OSCCONbits.NOSC1
+#define _NOSC2 OSCCONbits.NOSC2
+#define _COSC0 OSCCONbits.COSC0
+#define _COSC1 OSCCONbits.COSC1
+#define _COSC2 OSCCONbits.COSC2
+#define _NOSC OSCCONbits.NOSC
+#define _COSC OSCCONbits.COSC
+#define _LPOSCEN OSCCONbits.LPOSCEN
+
+/* CLKDIV */
+#define _USBDOZE0 CLKDIVbits.USBDOZE0
+#define _USBDOZE1 CLKDIVbits.USBDOZE1
+#define _RCDIV0 CLKDIVbits.RCDIV0
+#define _RCDIV1 CLKDIVbits.RCDIV1
+#define _RCDIV2 CLKDIVbits.RCDIV2
+#define _DOZEN CLKDIVbits.DOZEN
+#define _DOZE0 CLKDIVbits.DOZE0
+#define _DOZE1 CLKDIVbits.DOZE1
+#define _DOZE2 CLKDIVbits.DOZE2
+#define _ROI CLKDIVbits.ROI
+#define _USBDOZE CLKDIVbits.USBDOZE
+#define _RCDIV CLKDIVbits.RCDIV
+#define _DOZE CLKDIVbits.DOZE
+#define _CPDIV CLKDIVbits.CPDIV
+#define _CPDIV0 CLKDIVbits.CPDIV0
+#define _CPDIV1 CLKDIVbits.CPDIV1
+
+/* OSCTUN */
+#define _TUN0 OSCTUNbits.TUN0
+#define _TUN1 OSCTUNbits.TUN1
+#define _TUN2 OSCTUNbits.TUN2
+#define _TUN3 OSCTUNbits.TUN3
+#define _TUN4 OSCTUNbits.TUN4
+#define _TUN5 OSCTUNbits.TUN5
+#define _TUN OSCTUNbits.TUN
+
+/* REFOCON */
+#define _RODIV0 REFOCONbits.RODIV0
+#define _RODIV1 REFOCONbits.RODIV1
+#define _RODIV2 REFOCONbits.RODIV2
+#define _RODIV3 REFOCONbits.RODIV3
+#define _ROSEL REFOCONbits.ROSEL
+#define _ROSSLP REFOCONbits.ROSSLP
+#define _ROON REFOCONbits.ROON
+#define _RODIV REFOCONbits.RODIV
+
+/* NVMCON */
+#define _NVMOP0 NVMCONbits.NVMOP0
+#define _NVMOP1 NVMCONbits.NVMOP1
+#define _NVMOP2 NVMCONbits.NVMOP2
+#define _NVMOP3 NVMCONbits.NVMOP3
+#define _ERASE NVMCONbits.ERASE
+#define _WRERR NVMCONbits.WRERR
+#define _WREN NVMCONbits.WREN
+#define _WR NVMCONbits.WR
+#define _NVMOP NVMCONbits.NVMOP
+#define _PROGOP NVMCONbits.PROGOP
+#define _PROGOP0 NVMCONbits.PROGOP0
+#define _PROGOP1 NVMCONbits.PROGOP1
+#define _PROGOP2 NVMCONbits.PROGOP2
+#define _PROGOP3 NVMCONbits.PROGOP3
+
+/* PMD1 */
+#define _ADC1MD PMD1bits.ADC1MD
+#define _SPI1MD PMD1bits.SPI1MD
+#define _SPI2MD PMD1bits.SPI2MD
+#define _U1MD PMD1bits.U1MD
+#define _U2MD PMD1bits.U2MD
+#define _I2C1MD PMD1bits.I2C1MD
+#define _T1MD PMD1bits.T1MD
+#define _T2MD PMD1bits.T2MD
+#define _T3MD PMD1bits.T3MD
+#define _T4MD PMD1bits.T4MD
+#define _T5MD PMD1bits.T5MD
+
+/* PMD2 */
+#define _OC1MD PMD2bits.OC1MD
+#define _OC2MD PMD2bits.OC2MD
+#define _OC3MD PMD2bits.OC3MD
+#define _OC4MD PMD2bits.OC4MD
+#define _OC5MD PMD2bits.OC5MD
+#define _OC6MD PMD2bits.OC6MD
+#define _OC7MD PMD2bits.OC7MD
+#define _OC8MD PMD2bits.OC8MD
+#define _IC1MD PMD2bits.IC1MD
+#define _IC2MD PMD2bits.IC2MD
+#define _IC3MD PMD2bits.IC3MD
+#define _IC4MD PMD2bits.IC4MD
+#define _IC5MD PMD2bits.IC5MD
+#define _IC6MD PMD2bits.IC6MD
+#define _IC7MD PMD2bits.IC7MD
+#define _IC8MD PMD2bits.IC8MD
+
+/* PMD3 */
+#define _I2C2MD PMD3bits.I2C2MD
+#define _I2C3MD PMD3bits.I2C3MD
+#define _U3MD PMD3bits.U3MD
+#define _CRCPMD PMD3bits.CRCPMD
+#define _PMPMD PMD3bits.PMPMD
+#define _RTCCMD PMD3bits.RTCCMD
+#define _CMPMD PMD3bits.CMPMD
+#define _CRCMD PMD3bits.CRCMD
+
+/* PMD4 */
+#define _USB1MD PMD4bits.USB1MD
+#define _LVDMD PMD4bits.LVDMD
+#define _CTMUMD PMD4bits.CTMUMD
+#define _REFOMD PMD4bits.REFOMD
+#define _U4MD PMD4bits.U4MD
+#define _UPWMMD PMD4bits.UPWMMD
+
+/* PMD5 */
+#define _OC9MD PMD5bits.OC9MD
+#define _IC9MD PMD5bits.IC9MD
+
+/* PMD6 */
+#define _SPI3MD PMD6bits.SPI3MD
+
+
+/* ---------------------------------------------------------- */
+/* Some useful macros for inline assembler instructions       */
+/* ---------------------------------------------------------- */
+
+#define Nop()    __builtin_nop()
+#define ClrWdt() {__asm__ volatile ("clrwdt");}
+#define Sleep()  {__asm__ volatile ("pwrsav #0");}
+#define Idle()   {__asm__ volatile ("pwrsav #1");}
+
+/*----------------------------------------------------------- */
+/* Some useful macros for allocating data memory              */
+/*----------------------------------------------------------- */
+
+/* The following macros require an argument N that specifies  */
+/* alignment. N must a power of two, minimum value = 2.       */
+/* For example, to declare an uninitialized array that is     */
+/* aligned to a 32 byte address:                              */
+/*                                                            */
+/* int _BSS(32) buf[16];                                      */
+/*                                                            */
+/* To declare an initialized array without special            */
+/* alignment:                                                 */
+/*                                                            */
+/* int _DATA(2) table1[] = {0, 1, 1, 2, 3, 5, 8, 13, 21};     */
+/*                                                            */
+#define _BSS(N)    __attribute__((aligned(N)))
+#define _DATA(N)   __attribute__((aligned(N)))
+
+/* The following macros do not require an argument. They can  */
+/* be used to locate a variable in persistent data memory or  */
+/* in near data memory. For example, to declare two variables */
+/* that retain their values across a device reset:            */
+/*                                                            */
+/* int _PERSISTENT var1,var2;                                 */
+/*                                                            */
+#define _PERSISTENT __attribute__((persistent))
+#define _NEAR       __attribute__((near))
+
+/* ---------------------------------------------------------- */
+/* Some useful macros for declaring functions                 */
+/* ---------------------------------------------------------- */
+
+/* The following macros can be used to declare interrupt      */
+/* service routines (ISRs). For example, to declare an ISR    */
+/* for the timer1 interrupt:                                  */
+/*                                                            */
+/* void _ISR _T1Interrupt(void);                              */
+/*                                                            */
+/* To declare an ISR for the SPI1 interrupt with fast         */
+/* context save:                                              */
+/*                                                            */
+/* void _ISRFAST _SPI1Interrupt(void);                        */
+/*                                                            */
+/* Note: ISRs will be installed into the interrupt vector     */
+/* tables automatically if the reserved names listed in the   */
+/* MPLAB C30 Compiler User's Guide (DS51284) are used.        */
+/*                                                            */
+#define _ISR __attribute__((interrupt))
+#define _ISRFAST __attribute__((interrupt, shadow))
+
+/* ---------------------------------------------------------- */
+/* Some useful macros for changing the CPU IPL                */
+/* ---------------------------------------------------------- */
+
+/* The following macros can be used to modify the current CPU */
+/* IPL. The definition of the macro may vary from device to   */
+/* device.                                                    */
+/*                                                            */
+/* To safely set the CPU IPL, use SET_CPU_IPL(ipl); the       */
+/* valid range of ipl is 0-7, it may be any expression.       */
+/*                                                            */
+/* SET_CPU_IPL(7);                                            */
+/*                                                            */
+/* To preserve the current IPL and save it use                */
+/* SET_AND_SAVE_CPU_IPL(save_to, ipl); the valid range of ipl */
+/* is 0-7 and may be any expression, save_to should denote    */
+/* some temporary storage.                                    */
+/*                                                            */
+/* int old_ipl;                                               */
+/*                                                            */
+/* SET_AND_SAVE_CPU_IPL(old_ipl, 7);                          */
+/*                                                            */
+/* The IPL can be restored with RESTORE_CPU_IPL(saved_to)     */
+/*                                                            */
+/* RESTORE_CPU_IPL(old_ipl);                                  */
+
+#define SET_CPU_IPL(ipl) {       \
+  int DISI_save;                 \
+                                 \
+  DISI_save = DISICNT;           \
+  asm volatile ("disi #0x3FFF"); \
+  SRbits.IPL = ipl;              \
+  DISICNT = DISI_save; } (void) 0;
+
+#define SET_AND_SAVE_CPU_IPL(save_to, ipl) { \
+  save_to = SRbits.IPL; \
+  SET_CPU_IPL(ipl); } (void) 0;
+
+#define RESTORE_CPU_IPL(saved_to) SET_CPU_IPL(saved_to)
+
+
+
+/* -------------------------------------------------------- */
+/* Macros for setting device configuration registers        */
+/* -------------------------------------------------------- */
+
+/* Register CONFIG3 (0x2abfa)                               */
+
+extern __attribute__((space(prog))) int _CONFIG3;
+#define _CONFIG3(x) __attribute__((section("__CONFIG3.sec"),space(prog))) int _CONFIG3 = (x);
+
+/*
+** Only one invocation of CONFIG3 should appear in a project,
+** at the top of a C source file (outside of any function).
+**
+** The following constants can be used to set CONFIG3.
+** Multiple options may be combined, as shown:
+**
+** _CONFIG3( OPT1_ON & OPT2_OFF & OPT3_PLL )
+**
+**   Write Protection Location:
+**     WPEND_WPSTARTMEM     Write Protect from page 0 to WPFP
+**     WPEND_WPENDMEM       Write Protect from WPFP to the last page of memory
+**
+**   Write Protect Configuration Page:
+**     WPCFG_WPCFGEN        Enabled
+**     WPCFG_WPCFGDIS       Disabled
+**
+**   Write Protection Disable:
+**     WPDIS_WPEN           Enabled
+**     WPDIS_WPDIS          Disabled
+**
+**   Write Protection Flash Page:
+**     WPFP_WPFP0           0
+**     WPFP_WPFP1           1
+**     WPFP_WPFP2           2
+**     WPFP_WPFP3           3
+**     WPFP_WPFP4           4
+**     WPFP_WPFP5           5
+**     WPFP_WPFP6           6
+**     WPFP_WPFP7           7
+**     WPFP_WPFP8           8
+**     WPFP_WPFP9           9
+**     WPFP_WPFP10          10
+**     WPFP_WPFP11          11
+**     WPFP_WPFP12          12
+**     WPFP_WPFP13          13
+**     WPFP_WPFP14          14
+**     WPFP_WPFP15          15
+**     WPFP_WPFP16          16
+**     WPFP_WPFP17          17
+**     WPFP_WPFP18          18
+**     WPFP_WPFP19          19
+**     WPFP_WPFP20          20
+**     WPFP_WPFP21          21
+**     WPFP_WPFP22          22
+**     WPFP_WPFP23          23
+**     WPFP_WPFP24          24
+**     WPFP_WPFP25          25
+**     WPFP_WPFP26          26
+**     WPFP_WPFP27          27
+**     WPFP_WPFP28          28
+**     WPFP_WPFP29          29
+**     WPFP_WPFP30          30
+**     WPFP_WPFP31          31
+**     WPFP_WPFP32          32
+**     WPFP_WPFP33          33
+**     WPFP_WPFP34          34
+**     WPFP_WPFP35          35
+**     WPFP_WPFP36          36
+**     WPFP_WPFP37          37
+**     WPFP_WPFP38          38
+**     WPFP_WPFP39          39
+**     WPFP_WPFP40          40
+**     WPFP_WPFP41          41
+**     WPFP_WPFP42          42
+**     WPFP_WPFP43          43
+**     WPFP_WPFP44          44
+**     WPFP_WPFP45          45
+**     WPFP_WPFP46          46
+**     WPFP_WPFP47          47
+**     WPFP_WPFP48          48
+**     WPFP_WPFP49          49
+**     WPFP_WPFP50          50
+**     WPFP_WPFP51          51
+**     WPFP_WPFP52          52
+**     WPFP_WPFP53          53
+**     WPFP_WPFP54          54
+**     WPFP_WPFP55          55
+**     WPFP_WPFP56          56
+**     WPFP_WPFP57          57
+**     WPFP_WPFP58          58
+**     WPFP_WPFP59          59
+**     WPFP_WPFP60          60
+**     WPFP_WPFP61          61
+**     WPFP_WPFP62          62
+**     WPFP_WPFP63          63
+**     WPFP_WPFP64          64
+**     WPFP_WPFP65          65
+**     WPFP_WPFP66          66
+**     WPFP_WPFP67          67
+**     WPFP_WPFP68          68
+**     WPFP_WPFP69          69
+**     WPFP_WPFP70          70
+**     WPFP_WPFP71          71
+**     WPFP_WPFP72          72
+**     WPFP_WPFP73          73
+**     WPFP_WPFP74          74
+**     WPFP_WPFP75          75
+**     WPFP_WPFP76          76
+**     WPFP_WPFP77          77
+**     WPFP_WPFP78          78
+**     WPFP_WPFP79          79
+**     WPFP_WPFP80          80
+**     WPFP_WPFP81          81
+**     WPFP_WPFP82          82
+**     WPFP_WPFP83          83
+**     WPFP_WPFP84          84
+**     WPFP_WPFP85          85
+**     WPFP_WPFP86          86
+**     WPFP_WPFP87          87
+**     WPFP_WPFP88          88
+**     WPFP_WPFP89          89
+**     WPFP_WPFP90          90
+**     WPFP_WPFP91          91
+**     WPFP_WPFP92          92
+**     WPFP_WPFP93          93
+**     WPFP_WPFP94          94
+**     WPFP_WPFP95          95
+**     WPFP_WPFP96          96
+**     WPFP_WPFP97          97
+**     WPFP_WPFP98          98
+**     WPFP_WPFP99          99
+**     WPFP_WPFP100         100
+**     WPFP_WPFP101         101
+**     WPFP_WPFP102         102
+**     WPFP_WPFP103         103
+**     WPFP_WPFP104         104
+**     WPFP_WPFP105         105
+**     WPFP_WPFP106         106
+**     WPFP_WPFP107         107
+**     WPFP_WPFP108         108
+**     WPFP_WPFP109         109
+**     WPFP_WPFP110         110
+**     WPFP_WPFP111         111
+**     WPFP_WPFP112         112
+**     WPFP_WPFP113         113
+**     WPFP_WPFP114         114
+**     WPFP_WPFP115         115
+**     WPFP_WPFP116         116
+**     WPFP_WPFP117         117
+**     WPFP_WPFP118         118
+**     WPFP_WPFP119         119
+**     WPFP_WPFP120         120
+**     WPFP_WPFP121         121
+**     WPFP_WPFP122         122
+**     WPFP_WPFP123         123
+**     WPFP_WPFP124         124
+**     WPFP_WPFP125         125
+**     WPFP_WPFP126         126
+**     WPFP_WPFP127         127
+**     WPFP_WPFP128         128
+**     WPFP_WPFP129         129
+**     WPFP_WPFP130         130
+**     WPFP_WPFP131         131
+**     WPFP_WPFP132         132
+**     WPFP_WPFP133         133
+**     WPFP_WPFP134         134
+**     WPFP_WPFP135         135
+**     WPFP_WPFP136         136
+**     WPFP_WPFP137         137
+**     WPFP_WPFP138         138
+**     WPFP_WPFP139         139
+**     WPFP_WPFP140         140
+**     WPFP_WPFP141         141
+**     WPFP_WPFP142         142
+**     WPFP_WPFP143         143
+**     WPFP_WPFP144         144
+**     WPFP_WPFP145         145
+**     WPFP_WPFP146         146
+**     WPFP_WPFP147         147
+**     WPFP_WPFP148         148
+**     WPFP_WPFP149         149
+**     WPFP_WPFP150         150
+**     WPFP_WPFP151         151
+**     WPFP_WPFP152         152
+**     WPFP_WPFP153         153
+**     WPFP_WPFP154         154
+**     WPFP_WPFP155         155
+**     WPFP_WPFP156         156
+**     WPFP_WPFP157         157
+**     WPFP_WPFP158         158
+**     WPFP_WPFP159         159
+**     WPFP_WPFP160         160
+**     WPFP_WPFP161         161
+**     WPFP_WPFP162         162
+**     WPFP_WPFP163         163
+**     WPFP_WPFP164         164
+**     WPFP_WPFP165         165
+**     WPFP_WPFP166         166
+**     WPFP_WPFP167         167
+**     WPFP_WPFP168         168
+**     WPFP_WPFP169         169
+**     WPFP_WPFP170         170
+**     WPFP_WPFP171         171
+**     WPFP_WPFP172         172
+**     WPFP_WPFP173         173
+**     WPFP_WPFP174         174
+**     WPFP_WPFP175         175
+**     WPFP_WPFP176         176
+**     WPFP_WPFP177         177
+**     WPFP_WPFP178         178
+**     WPFP_WPFP179         179
+**     WPFP_WPFP180         180
+**     WPFP_WPFP181         181
+**     WPFP_WPFP182         182
+**     WPFP_WPFP183         183
+**     WPFP_WPFP184         184
+**     WPFP_WPFP185         185
+**     WPFP_WPFP186         186
+**     WPFP_WPFP187         187
+**     WPFP_WPFP188         188
+**     WPFP_WPFP189         189
+**     WPFP_WPFP190         190
+**     WPFP_WPFP191         191
+**     WPFP_WPFP192         192
+**     WPFP_WPFP193         193
+**     WPFP_WPFP194         194
+**     WPFP_WPFP195         195
+**     WPFP_WPFP196         196
+**     WPFP_WPFP197         197
+**     WPFP_WPFP198         198
+**     WPFP_WPFP199         199
+**     WPFP_WPFP200         200
+**     WPFP_WPFP201         201
+**     WPFP_WPFP202         202
+**     WPFP_WPFP203         203
+**     WPFP_WPFP204         204
+**     WPFP_WPFP205         205
+**     WPFP_WPFP206         206
+**     WPFP_WPFP207         207
+**     WPFP_WPFP208         208
+**     WPFP_WPFP209         209
+**     WPFP_WPFP210         210
+**     WPFP_WPFP211         211
+**     WPFP_WPFP212         212
+**     WPFP_WPFP213         213
+**     WPFP_WPFP214         214
+**     WPFP_WPFP215         215
+**     WPFP_WPFP216         216
+**     WPFP_WPFP217         217
+**     WPFP_WPFP218         218
+**     WPFP_WPFP219         219
+**     WPFP_WPFP220         220
+**     WPFP_WPFP221         221
+**     WPFP_WPFP222         222
+**     WPFP_WPFP223         223
+**     WPFP_WPFP224         224
+**     WPFP_WPFP225         225
+**     WPFP_WPFP226         226
+**     WPFP_WPFP227         227
+**     WPFP_WPFP228         228
+**     WPFP_WPFP229         229
+**     WPFP_WPFP230         230
+**     WPFP_WPFP231         231
+**     WPFP_WPFP232         232
+**     WPFP_WPFP233         233
+**     WPFP_WPFP234         234
+**     WPFP_WPFP235         235
+**     WPFP_WPFP236         236
+**     WPFP_WPFP237         237
+**     WPFP_WPFP238         238
+**     WPFP_WPFP239         239
+**     WPFP_WPFP240         240
+**     WPFP_WPFP241         241
+**     WPFP_WPFP242         242
+**     WPFP_WPFP243         243
+**     WPFP_WPFP244         244
+**     WPFP_WPFP245         245
+**     WPFP_WPFP246         246
+**     WPFP_WPFP247         247
+**     WPFP_WPFP248         248
+**     WPFP_WPFP249         249
+**     WPFP_WPFP250         250
+**     WPFP_WPFP251         251
+**     WPFP_WPFP252         252
+**     WPFP_WPFP253         253
+**     WPFP_WPFP254         254
+**     WPFP_WPFP255         255
+**     WPFP_WPFP256         256
+**     WPFP_WPFP257         257
+**     WPFP_WPFP258         258
+**     WPFP_WPFP259         259
+**     WPFP_WPFP260         260
+**     WPFP_WPFP261         261
+**     WPFP_WPFP262         262
+**     WPFP_WPFP263         263
+**     WPFP_WPFP264         264
+**     WPFP_WPFP265         265
+**     WPFP_WPFP266         266
+**     WPFP_WPFP267         267
+**     WPFP_WPFP268         268
+**     WPFP_WPFP269         269
+**     WPFP_WPFP270         270
+**     WPFP_WPFP271         271
+**     WPFP_WPFP272         272
+**     WPFP_WPFP273         273
+**     WPFP_WPFP274         274
+**     WPFP_WPFP275         275
+**     WPFP_WPFP276         276
+**     WPFP_WPFP277         277
+**     WPFP_WPFP278         278
+**     WPFP_WPFP279         279
+**     WPFP_WPFP280         280
+**     WPFP_WPFP281         281
+**     WPFP_WPFP282         282
+**     WPFP_WPFP283         283
+**     WPFP_WPFP284         284
+**     WPFP_WPFP285         285
+**     WPFP_WPFP286         286
+**     WPFP_WPFP287         287
+**     WPFP_WPFP288         288
+**     WPFP_WPFP289         289
+**     WPFP_WPFP290         290
+**     WPFP_WPFP291         291
+**     WPFP_WPFP292         292
+**     WPFP_WPFP293         293
+**     WPFP_WPFP294         294
+**     WPFP_WPFP295         295
+**     WPFP_WPFP296         296
+**     WPFP_WPFP297         297
+**     WPFP_WPFP298         298
+**     WPFP_WPFP299         299
+**     WPFP_WPFP300         300
+**     WPFP_WPFP301         301
+**     WPFP_WPFP302         302
+**     WPFP_WPFP303         303
+**     WPFP_WPFP304         304
+**     WPFP_WPFP305         305
+**     WPFP_WPFP306         306
+**     WPFP_WPFP307         307
+**     WPFP_WPFP308         308
+**     WPFP_WPFP309         309
+**     WPFP_WPFP310         310
+**     WPFP_WPFP311         311
+**     WPFP_WPFP312         312
+**     WPFP_WPFP313         313
+**     WPFP_WPFP314         314
+**     WPFP_WPFP315         315
+**     WPFP_WPFP316         316
+**     WPFP_WPFP317         317
+**     WPFP_WPFP318         318
+**     WPFP_WPFP319         319
+**     WPFP_WPFP320         320
+**     WPFP_WPFP321         321
+**     WPFP_WPFP322         322
+**     WPFP_WPFP323         323
+**     WPFP_WPFP324         324
+**     WPFP_WPFP325         325
+**     WPFP_WPFP326         326
+**     WPFP_WPFP327         327
+**     WPFP_WPFP328         328
+**     WPFP_WPFP329         329
+**     WPFP_WPFP330         330
+**     WPFP_WPFP331         331
+**     WPFP_WPFP332         332
+**     WPFP_WPFP333         333
+**     WPFP_WPFP334         334
+**     WPFP_WPFP335         335
+**     WPFP_WPFP336         336
+**     WPFP_WPFP337         337
+**     WPFP_WPFP338         338
+**     WPFP_WPFP339         339
+**     WPFP_WPFP340         340
+**     WPFP_WPFP341         341
+**     WPFP_WPFP342         342
+**     WPFP_WPFP343         343
+**     WPFP_WPFP344         344
+**     WPFP_WPFP345         345
+**     WPFP_WPFP346         346
+**     WPFP_WPFP347         347
+**     WPFP_WPFP348         348
+**     WPFP_WPFP349         349
+**     WPFP_WPFP350         350
+**     WPFP_WPFP351         351
+**     WPFP_WPFP352         352
+**     WPFP_WPFP353         353
+**     WPFP_WPFP354         354
+**     WPFP_WPFP355         355
+**     WPFP_WPFP356         356
+**     WPFP_WPFP357         357
+**     WPFP_WPFP358         358
+**     WPFP_WPFP359         359
+**     WPFP_WPFP360         360
+**     WPFP_WPFP361         361
+**     WPFP_WPFP362         362
+**     WPFP_WPFP363         363
+**     WPFP_WPFP364         364
+**     WPFP_WPFP365         365
+**     WPFP_WPFP366         366
+**     WPFP_WPFP367         367
+**     WPFP_WPFP368         368
+**     WPFP_WPFP369         369
+**     WPFP_WPFP370         370
+**     WPFP_WPFP371         371
+**     WPFP_WPFP372         372
+**     WPFP_WPFP373         373
+**     WPFP_WPFP374         374
+**     WPFP_WPFP375         375
+**     WPFP_WPFP376         376
+**     WPFP_WPFP377         377
+**     WPFP_WPFP378         378
+**     WPFP_WPFP379         379
+**     WPFP_WPFP380         380
+**     WPFP_WPFP381         381
+**     WPFP_WPFP382         382
+**     WPFP_WPFP383         383
+**     WPFP_WPFP384         384
+**     WPFP_WPFP385         385
+**     WPFP_WPFP386         386
+**     WPFP_WPFP387         387
+**     WPFP_WPFP388         388
+**     WPFP_WPFP389         389
+**     WPFP_WPFP390         390
+**     WPFP_WPFP391         391
+**     WPFP_WPFP392         392
+**     WPFP_WPFP393         393
+**     WPFP_WPFP394         394
+**     WPFP_WPFP395         395
+**     WPFP_WPFP396         396
+**     WPFP_WPFP397         397
+**     WPFP_WPFP398         398
+**     WPFP_WPFP399         399
+**     WPFP_WPFP400         400
+**     WPFP_WPFP401         401
+**     WPFP_WPFP402         402
+**     WPFP_WPFP403         403
+**     WPFP_WPFP404         404
+**     WPFP_WPFP405         405
+**     WPFP_WPFP406         406
+**     WPFP_WPFP407         407
+**     WPFP_WPFP408         408
+**     WPFP_WPFP409         409
+**     WPFP_WPFP410         410
+**     WPFP_WPFP411         411
+**     WPFP_WPFP412         412
+**     WPFP_WPFP413         413
+**     WPFP_WPFP414         414
+**     WPFP_WPFP415         415
+**     WPFP_WPFP416         416
+**     WPFP_WPFP417         417
+**     WPFP_WPFP418         418
+**     WPFP_WPFP419         419
+**     WPFP_WPFP420         420
+**     WPFP_WPFP421         421
+**     WPFP_WPFP422         422
+**     WPFP_WPFP423         423
+**     WPFP_WPFP424         424
+**     WPFP_WPFP425         425
+**     WPFP_WPFP426         426
+**     WPFP_WPFP427         427
+**     WPFP_WPFP428         428
+**     WPFP_WPFP429         429
+**     WPFP_WPFP430         430
+**     WPFP_WPFP431         431
+**     WPFP_WPFP432         432
+**     WPFP_WPFP433         433
+**     WPFP_WPFP434         434
+**     WPFP_WPFP435         435
+**     WPFP_WPFP436         436
+**     WPFP_WPFP437         437
+**     WPFP_WPFP438         438
+**     WPFP_WPFP439         439
+**     WPFP_WPFP440         440
+**     WPFP_WPFP441         441
+**     WPFP_WPFP442         442
+**     WPFP_WPFP443         443
+**     WPFP_WPFP444         444
+**     WPFP_WPFP445         445
+**     WPFP_WPFP446         446
+**     WPFP_WPFP447         447
+**     WPFP_WPFP448         448
+**     WPFP_WPFP449         449
+**     WPFP_WPFP450         450
+**     WPFP_WPFP451         451
+**     WPFP_WPFP452         452
+**     WPFP_WPFP453         453
+**     WPFP_WPFP454         454
+**     WPFP_WPFP455         455
+**     WPFP_WPFP456         456
+**     WPFP_WPFP457         457
+**     WPFP_WPFP458         458
+**     WPFP_WPFP459         459
+**     WPFP_WPFP460         460
+**     WPFP_WPFP461         461
+**     WPFP_WPFP462         462
+**     WPFP_WPFP463         463
+**     WPFP_WPFP464         464
+**     WPFP_WPFP465         465
+**     WPFP_WPFP466         466
+**     WPFP_WPFP467         467
+**     WPFP_WPFP468         468
+**     WPFP_WPFP469         469
+**     WPFP_WPFP470         470
+**     WPFP_WPFP471         471
+**     WPFP_WPFP472         472
+**     WPFP_WPFP473         473
+**     WPFP_WPFP474         474
+**     WPFP_WPFP475         475
+**     WPFP_WPFP476         476
+**     WPFP_WPFP477         477
+**     WPFP_WPFP478         478
+**     WPFP_WPFP479         479
+**     WPFP_WPFP480         480
+**     WPFP_WPFP481         481
+**     WPFP_WPFP482         482
+**     WPFP_WPFP483         483
+**     WPFP_WPFP484         484
+**     WPFP_WPFP485         485
+**     WPFP_WPFP486         486
+**     WPFP_WPFP487         487
+**     WPFP_WPFP488         488
+**     WPFP_WPFP489         489
+**     WPFP_WPFP490         490
+**     WPFP_WPFP491         491
+**     WPFP_WPFP492         492
+**     WPFP_WPFP493         493
+**     WPFP_WPFP494         494
+**     WPFP_WPFP495         495
+**     WPFP_WPFP496         496
+**     WPFP_WPFP497         497
+**     WPFP_WPFP498         498
+**     WPFP_WPFP499         499
+**     WPFP_WPFP500         500
+**     WPFP_WPFP501         501
+**     WPFP_WPFP502         502
+**     WPFP_WPFP503         503
+**     WPFP_WPFP504         504
+**     WPFP_WPFP505         505
+**     WPFP_WPFP506         506
+**     WPFP_WPFP507         507
+**     WPFP_WPFP508         508
+**     WPFP_WPFP509         509
+**     WPFP_WPFP510         510
+**     WPFP_WPFP511         511
+**
+*/
+
+#define WPEND_WPSTARTMEM     0x7FFF
+#define WPEND_WPENDMEM       0xFFFF
+
+#define WPCFG_WPCFGEN        0xBFFF
+#define WPCFG_WPCFGDIS       0xFFFF
+
+#define WPDIS_WPEN           0xDFFF
+#define WPDIS_WPDIS          0xFFFF
+
+#define WPFP_WPFP0           0xFE00
+#define WPFP_WPFP1           0xFE01
+#define WPFP_WPFP2           0xFE02
+#define WPFP_WPFP3           0xFE03
+#define WPFP_WPFP4           0xFE04
+#define WPFP_WPFP5           0xFE05
+#define WPFP_WPFP6           0xFE06
+#define WPFP_WPFP7           0xFE07
+#define WPFP_WPFP8           0xFE08
+#define WPFP_WPFP9           0xFE09
+#define WPFP_WPFP10          0xFE0A
+#define WPFP_WPFP11          0xFE0B
+#define WPFP_WPFP12          0xFE0C
+#define WPFP_WPFP13          0xFE0D
+#define WPFP_WPFP14          0xFE0E
+#define WPFP_WPFP15          0xFE0F
+#define WPFP_WPFP16          0xFE10
+#define WPFP_WPFP17          0xFE11
+#define WPFP_WPFP18          0xFE12
+#define WPFP_WPFP19          0xFE13
+#define WPFP_WPFP20          0xFE14
+#define WPFP_WPFP21          0xFE15
+#define WPFP_WPFP22          0xFE16
+#define WPFP_WPFP23          0xFE17
+#define WPFP_WPFP24          0xFE18
+#define WPFP_WPFP25          0xFE19
+#define WPFP_WPFP26          0xFE1A
+#define WPFP_WPFP27          0xFE1B
+#define WPFP_WPFP28          0xFE1C
+#define WPFP_WPFP29          0xFE1D
+#define WPFP_WPFP30          0xFE1E
+#define WPFP_WPFP31          0xFE1F
+#define WPFP_WPFP32          0xFE20
+#define WPFP_WPFP33          0xFE21
+#define WPFP_WPFP34          0xFE22
+#define WPFP_WPFP35          0xFE23
+#define WPFP_WPFP36          0xFE24
+#define WPFP_WPFP37          0xFE25
+#define WPFP_WPFP38          0xFE26
+#define WPFP_WPFP39          0xFE27
+#define WPFP_WPFP40          0xFE28
+#define WPFP_WPFP41          0xFE29
+#define WPFP_WPFP42          0xFE2A
+#define WPFP_WPFP43          0xFE2B
+#define WPFP_WPFP44          0xFE2C
+#define WPFP_WPFP45          0xFE2D
+#define WPFP_WPFP46          0xFE2E
+#define WPFP_WPFP47          0xFE2F
+#define WPFP_WPFP48          0xFE30
+#define WPFP_WPFP49          0xFE31
+#define WPFP_WPFP50          0xFE32
+#define WPFP_WPFP51          0xFE33
+#define WPFP_WPFP52          0xFE34
+#define WPFP_WPFP53          0xFE35
+#define WPFP_WPFP54          0xFE36
+#define WPFP_WPFP55          0xFE37
+#define WPFP_WPFP56          0xFE38
+#define WPFP_WPFP57          0xFE39
+#define WPFP_WPFP58          0xFE3A
+#define WPFP_WPFP59          0xFE3B
+#define WPFP_WPFP60          0xFE3C
+#define WPFP_WPFP61          0xFE3D
+#define WPFP_WPFP62          0xFE3E
+#define WPFP_WPFP63          0xFE3F
+#define WPFP_WPFP64          0xFE40
+#define WPFP_WPFP65          0xFE41
+#define WPFP_WPFP66          0xFE42
+#define WPFP_WPFP67          0xFE43
+#define WPFP_WPFP68          0xFE44
+#define WPFP_WPFP69          0xFE45
+#define WPFP_WPFP70          0xFE46
+#define WPFP_WPFP71          0xFE47
+#define WPFP_WPFP72          0xFE48
+#define WPFP_WPFP73          0xFE49
+#define WPFP_WPFP74          0xFE4A
+#define WPFP_WPFP75          0xFE4B
+#define WPFP_WPFP76          0xFE4C
+#define WPFP_WPFP77          0xFE4D
+#define WPFP_WPFP78          0xFE4E
+#define WPFP_WPFP79          0xFE4F
+#define WPFP_WPFP80          0xFE50
+#define WPFP_WPFP81          0xFE51
+#define WPFP_WPFP82          0xFE52
+#define WPFP_WPFP83          0xFE53
+#define WPFP_WPFP84          0xFE54
+#define WPFP_WPFP85          0xFE55
+#define WPFP_WPFP86          0xFE56
+#define WPFP_WPFP87          0xFE57
+#define WPFP_WPFP88          0xFE58
+#define WPFP_WPFP89          0xFE59
+#define WPFP_WPFP90          0xFE5A
+#define WPFP_WPFP91          0xFE5B
+#define WPFP_WPFP92          0xFE5C
+#define WPFP_WPFP93          0xFE5D
+#define WPFP_WPFP94          0xFE5E
+#define WPFP_WPFP95          0xFE5F
+#define WPFP_WPFP96          0xFE60
+#define WPFP_WPFP97          0xFE61
+#define WPFP_WPFP98          0xFE62
+#define WPFP_WPFP99          0xFE63
+#define WPFP_WPFP100         0xFE64
+#define WPFP_WPFP101         0xFE65
+#define WPFP_WPFP102         0xFE66
+#define WPFP_WPFP103         0xFE67
+#define WPFP_WPFP104         0xFE68
+#define WPFP_WPFP105         0xFE69
+#define WPFP_WPFP106         0xFE6A
+#define WPFP_WPFP107         0xFE6B
+#define WPFP_WPFP108         0xFE6C
+#define WPFP_WPFP109         0xFE6D
+#define WPFP_WPFP110         0xFE6E
+#define WPFP_WPFP111         0xFE6F
+#define WPFP_WPFP112         0xFE70
+#define WPFP_WPFP113         0xFE71
+#define WPFP_WPFP114         0xFE72
+#define WPFP_WPFP115         0xFE73
+#define WPFP_WPFP116         0xFE74
+#define WPFP_WPFP117         0xFE75
+#define WPFP_WPFP118         0xFE76
+#define WPFP_WPFP119         0xFE77
+#define WPFP_WPFP120         0xFE78
+#define WPFP_WPFP121         0xFE79
+#define WPFP_WPFP122         0xFE7A
+#define WPFP_WPFP123         0xFE7B
+#define WPFP_WPFP124         0xFE7C
+#define WPFP_WPFP125         0xFE7D
+#define WPFP_WPFP126         0xFE7E
+#define WPFP_WPFP127         0xFE7F
+#define WPFP_WPFP128         0xFE80
+#define WPFP_WPFP129         0xFE81
+#define WPFP_WPFP130         0xFE82
+#define WPFP_WPFP131         0xFE83
+#define WPFP_WPFP132         0xFE84
+#define WPFP_WPFP133         0xFE85
+#define WPFP_WPFP134         0xFE86
+#define WPFP_WPFP135         0xFE87
+#define WPFP_WPFP136         0xFE88
+#define WPFP_WPFP137         0xFE89
+#define WPFP_WPFP138         0xFE8A
+#define WPFP_WPFP139         0xFE8B
+#define WPFP_WPFP140         0xFE8C
+#define WPFP_WPFP141         0xFE8D
+#define WPFP_WPFP142         0xFE8E
+#define WPFP_WPFP143         0xFE8F
+#define WPFP_WPFP144         0xFE90
+#define WPFP_WPFP145         0xFE91
+#define WPFP_WPFP146         0xFE92
+#define WPFP_WPFP147         0xFE93
+#define WPFP_WPFP148         0xFE94
+#define WPFP_WPFP149         0xFE95
+#define WPFP_WPFP150         0xFE96
+#define WPFP_WPFP151         0xFE97
+#define WPFP_WPFP152         0xFE98
+#define WPFP_WPFP153         0xFE99
+#define WPFP_WPFP154         0xFE9A
+#define WPFP_WPFP155         0xFE9B
+#define WPFP_WPFP156         0xFE9C
+#define WPFP_WPFP157         0xFE9D
+#define WPFP_WPFP158         0xFE9E
+#define WPFP_WPFP159         0xFE9F
+#define WPFP_WPFP160         0xFEA0
+#define WPFP_WPFP161         0xFEA1
+#define WPFP_WPFP162         0xFEA2
+#define WPFP_WPFP163         0xFEA3
+#define WPFP_WPFP164         0xFEA4
+#define WPFP_WPFP165         0xFEA5
+#define WPFP_WPFP166         0xFEA6
+#define WPFP_WPFP167         0xFEA7
+#define WPFP_WPFP168         0xFEA8
+#define WPFP_WPFP169         0xFEA9
+#define WPFP_WPFP170         0xFEAA
+#define WPFP_WPFP171         0xFEAB
+#define WPFP_WPFP172         0xFEAC
+#define WPFP_WPFP173         0xFEAD
+#define WPFP_WPFP174         0xFEAE
+#define WPFP_WPFP175         0xFEAF
+#define WPFP_WPFP176         0xFEB0
+#define WPFP_WPFP177         0xFEB1
+#define WPFP_WPFP178         0xFEB2
+#define WPFP_WPFP179         0xFEB3
+#define WPFP_WPFP180         0xFEB4
+#define WPFP_WPFP181         0xFEB5
+#define WPFP_WPFP182         0xFEB6
+#define WPFP_WPFP183         0xFEB7
+#define WPFP_WPFP184         0xFEB8
+#define WPFP_WPFP185         0xFEB9
+#define WPFP_WPFP186         0xFEBA
+#define WPFP_WPFP187         0xFEBB
+#define WPFP_WPFP188         0xFEBC
+#define WPFP_WPFP189         0xFEBD
+#define WPFP_WPFP190         0xFEBE
+#define WPFP_WPFP191         0xFEBF
+#define WPFP_WPFP192         0xFEC0
+#define WPFP_WPFP193         0xFEC1
+#define WPFP_WPFP194         0xFEC2
+#define WPFP_WPFP195         0xFEC3
+#define WPFP_WPFP196         0xFEC4
+#define WPFP_WPFP197         0xFEC5
+#define WPFP_WPFP198         0xFEC6
+#define WPFP_WPFP199         0xFEC7
+#define WPFP_WPFP200         0xFEC8
+#define WPFP_WPFP201         0xFEC9
+#define WPFP_WPFP202         0xFECA
+#define WPFP_WPFP203         0xFECB
+#define WPFP_WPFP204         0xFECC
+#define WPFP_WPFP205         0xFECD
+#define WPFP_WPFP206         0xFECE
+#define WPFP_WPFP207         0xFECF
+#define WPFP_WPFP208         0xFED0
+#define WPFP_WPFP209         0xFED1
+#define WPFP_WPFP210         0xFED2
+#define WPFP_WPFP211         0xFED3
+#define WPFP_WPFP212         0xFED4
+#define WPFP_WPFP213         0xFED5
+#define WPFP_WPFP214         0xFED6
+#define WPFP_WPFP215         0xFED7
+#define WPFP_WPFP216         0xFED8
+#define WPFP_WPFP217         0xFED9
+#define WPFP_WPFP218         0xFEDA
+#define WPFP_WPFP219         0xFEDB
+#define WPFP_WPFP220         0xFEDC
+#define WPFP_WPFP221         0xFEDD
+#define WPFP_WPFP222         0xFEDE
+#define WPFP_WPFP223         0xFEDF
+#define WPFP_WPFP224         0xFEE0
+#define WPFP_WPFP225         0xFEE1
+#define WPFP_WPFP226         0xFEE2
+#define WPFP_WPFP227         0xFEE3
+#define WPFP_WPFP228         0xFEE4
+#define WPFP_WPFP229         0xFEE5
+#define WPFP_WPFP230         0xFEE6
+#define WPFP_WPFP231         0xFEE7
+#define WPFP_WPFP232         0xFEE8
+#define WPFP_WPFP233         0xFEE9
+#define WPFP_WPFP234         0xFEEA
+#define WPFP_WPFP235         0xFEEB
+#define WPFP_WPFP236         0xFEEC
+#define WPFP_WPFP237         0xFEED
+#define WPFP_WPFP238         0xFEEE
+#define WPFP_WPFP239         0xFEEF
+#define WPFP_WPFP240         0xFEF0
+#define WPFP_WPFP241         0xFEF1
+#define WPFP_WPFP242         0xFEF2
+#define WPFP_WPFP243         0xFEF3
+#define WPFP_WPFP244         0xFEF4
+#define WPFP_WPFP245         0xFEF5
+#define WPFP_WPFP246         0xFEF6
+#define WPFP_WPFP247         0xFEF7
+#define WPFP_WPFP248         0xFEF8
+#define WPFP_WPFP249         0xFEF9
+#define WPFP_WPFP250         0xFEFA
+#define WPFP_WPFP251         0xFEFB
+#define WPFP_WPFP252         0xFEFC
+#define WPFP_WPFP253         0xFEFD
+#define WPFP_WPFP254         0xFEFE
+#define WPFP_WPFP255         0xFEFF
+#define WPFP_WPFP256         0xFF00
+#define WPFP_WPFP257         0xFF01
+#define WPFP_WPFP258         0xFF02
+#define WPFP_WPFP259         0xFF03
+#define WPFP_WPFP260         0xFF04
+#define WPFP_WPFP261         0xFF05
+#define WPFP_WPFP262         0xFF06
+#define WPFP_WPFP263         0xFF07
+#define WPFP_WPFP264         0xFF08
+#define WPFP_WPFP265         0xFF09
+#define WPFP_WPFP266         0xFF0A
+#define WPFP_WPFP267         0xFF0B
+#define WPFP_WPFP268         0xFF0C
+#define WPFP_WPFP269         0xFF0D
+#define WPFP_WPFP270         0xFF0E
+#define WPFP_WPFP271         0xFF0F
+#define WPFP_WPFP272         0xFF10
+#define WPFP_WPFP273         0xFF11
+#define WPFP_WPFP274         0xFF12
+#define WPFP_WPFP275         0xFF13
+#define WPFP_WPFP276         0xFF14
+#define WPFP_WPFP277         0xFF15
+#define WPFP_WPFP278         0xFF16
+#define WPFP_WPFP279         0xFF17
+#define WPFP_WPFP280         0xFF18
+#define WPFP_WPFP281         0xFF19
+#define WPFP_WPFP282         0xFF1A
+#define WPFP_WPFP283         0xFF1B
+#define WPFP_WPFP284         0xFF1C
+#define WPFP_WPFP285         0xFF1D
+#define WPFP_WPFP286         0xFF1E
+#define WPFP_WPFP287         0xFF1F
+#define WPFP_WPFP288         0xFF20
+#define WPFP_WPFP289         0xFF21
+#define WPFP_WPFP290         0xFF22
+#define WPFP_WPFP291         0xFF23
+#define WPFP_WPFP292         0xFF24
+#define WPFP_WPFP293         0xFF25
+#define WPFP_WPFP294         0xFF26
+#define WPFP_WPFP295         0xFF27
+#define WPFP_WPFP296         0xFF28
+#define WPFP_WPFP297         0xFF29
+#define WPFP_WPFP298         0xFF2A
+#define WPFP_WPFP299         0xFF2B
+#define WPFP_WPFP300         0xFF2C
+#define WPFP_WPFP301         0xFF2D
+#define WPFP_WPFP302         0xFF2E
+#define WPFP_WPFP303         0xFF2F
+#define WPFP_WPFP304         0xFF30
+#define WPFP_WPFP305         0xFF31
+#define WPFP_WPFP306         0xFF32
+#define WPFP_WPFP307         0xFF33
+#define WPFP_WPFP308         0xFF34
+#define WPFP_WPFP309         0xFF35
+#define WPFP_WPFP310         0xFF36
+#define WPFP_WPFP311         0xFF37
+#define WPFP_WPFP312         0xFF38
+#define WPFP_WPFP313         0xFF39
+#define WPFP_WPFP314         0xFF3A
+#define WPFP_WPFP315         0xFF3B
+#define WPFP_WPFP316         0xFF3C
+#define WPFP_WPFP317         0xFF3D
+#define WPFP_WPFP318         0xFF3E
+#define WPFP_WPFP319         0xFF3F
+#define WPFP_WPFP320         0xFF40
+#define WPFP_WPFP321         0xFF41
+#define WPFP_WPFP322         0xFF42
+#define WPFP_WPFP323         0xFF43
+#define WPFP_WPFP324         0xFF44
+#define WPFP_WPFP325         0xFF45
+#define WPFP_WPFP326         0xFF46
+#define WPFP_WPFP327         0xFF47
+#define WPFP_WPFP328         0xFF48
+#define WPFP_WPFP329         0xFF49
+#define WPFP_WPFP330         0xFF4A
+#define WPFP_WPFP331         0xFF4B
+#define WPFP_WPFP332         0xFF4C
+#define WPFP_WPFP333         0xFF4D
+#define WPFP_WPFP334         0xFF4E
+#define WPFP_WPFP335         0xFF4F
+#define WPFP_WPFP336         0xFF50
+#define WPFP_WPFP337         0xFF51
+#define WPFP_WPFP338         0xFF52
+#define WPFP_WPFP339         0xFF53
+#define WPFP_WPFP340         0xFF54
+#define WPFP_WPFP341         0xFF55
+#define WPFP_WPFP342         0xFF56
+#define WPFP_WPFP343         0xFF57
+#define WPFP_WPFP344         0xFF58
+#define WPFP_WPFP345         0xFF59
+#define WPFP_WPFP346         0xFF5A
+#define WPFP_WPFP347         0xFF5B
+#define WPFP_WPFP348         0xFF5C
+#define WPFP_WPFP349         0xFF5D
+#define WPFP_WPFP350         0xFF5E
+#define WPFP_WPFP351         0xFF5F
+#define WPFP_WPFP352         0xFF60
+#define WPFP_WPFP353         0xFF61
+#define WPFP_WPFP354         0xFF62
+#define WPFP_WPFP355         0xFF63
+#define WPFP_WPFP356         0xFF64
+#define WPFP_WPFP357         0xFF65
+#define WPFP_WPFP358         0xFF66
+#define WPFP_WPFP359         0xFF67
+#define WPFP_WPFP360         0xFF68
+#define WPFP_WPFP361         0xFF69
+#define WPFP_WPFP362         0xFF6A
+#define WPFP_WPFP363         0xFF6B
+#define WPFP_WPFP364         0xFF6C
+#define WPFP_WPFP365         0xFF6D
+#define WPFP_WPFP366         0xFF6E
+#define WPFP_WPFP367         0xFF6F
+#define WPFP_WPFP368         0xFF70
+#define WPFP_WPFP369         0xFF71
+#define WPFP_WPFP370         0xFF72
+#define WPFP_WPFP371         0xFF73
+#define WPFP_WPFP372         0xFF74
+#define WPFP_WPFP373         0xFF75
+#define WPFP_WPFP374         0xFF76
+#define WPFP_WPFP375         0xFF77
+#define WPFP_WPFP376         0xFF78
+#define WPFP_WPFP377         0xFF79
+#define WPFP_WPFP378         0xFF7A
+#define WPFP_WPFP379         0xFF7B
+#define WPFP_WPFP380         0xFF7C
+#define WPFP_WPFP381         0xFF7D
+#define WPFP_WPFP382         0xFF7E
+#define WPFP_WPFP383         0xFF7F
+#define WPFP_WPFP384         0xFF80
+#define WPFP_WPFP385         0xFF81
+#define WPFP_WPFP386         0xFF82
+#define WPFP_WPFP387         0xFF83
+#define WPFP_WPFP388         0xFF84
+#define WPFP_WPFP389         0xFF85
+#define WPFP_WPFP390         0xFF86
+#define WPFP_WPFP391         0xFF87
+#define WPFP_WPFP392         0xFF88
+#define WPFP_WPFP393         0xFF89
+#define WPFP_WPFP394         0xFF8A
+#define WPFP_WPFP395         0xFF8B
+#define WPFP_WPFP396         0xFF8C
+#define WPFP_WPFP397         0xFF8D
+#define WPFP_WPFP398         0xFF8E
+#define WPFP_WPFP399         0xFF8F
+#define WPFP_WPFP400         0xFF90
+#define WPFP_WPFP401         0xFF91
+#define WPFP_WPFP402         0xFF92
+#define WPFP_WPFP403         0xFF93
+#define WPFP_WPFP404         0xFF94
+#define WPFP_WPFP405         0xFF95
+#define WPFP_WPFP406         0xFF96
+#define WPFP_WPFP407         0xFF97
+#define WPFP_WPFP408         0xFF98
+#define WPFP_WPFP409         0xFF99
+#define WPFP_WPFP410         0xFF9A
+#define WPFP_WPFP411         0xFF9B
+#define WPFP_WPFP412         0xFF9C
+#define WPFP_WPFP413         0xFF9D
+#define WPFP_WPFP414         0xFF9E
+#define WPFP_WPFP415         0xFF9F
+#define WPFP_WPFP416         0xFFA0
+#define WPFP_WPFP417         0xFFA1
+#define WPFP_WPFP418         0xFFA2
+#define WPFP_WPFP419         0xFFA3
+#define WPFP_WPFP420         0xFFA4
+#define WPFP_WPFP421         0xFFA5
+#define WPFP_WPFP422         0xFFA6
+#define WPFP_WPFP423         0xFFA7
+#define WPFP_WPFP424         0xFFA8
+#define WPFP_WPFP425         0xFFA9
+#define WPFP_WPFP426         0xFFAA
+#define WPFP_WPFP427         0xFFAB
+#define WPFP_WPFP428         0xFFAC
+#define WPFP_WPFP429         0xFFAD
+#define WPFP_WPFP430         0xFFAE
+#define WPFP_WPFP431         0xFFAF
+#define WPFP_WPFP432         0xFFB0
+#define WPFP_WPFP433         0xFFB1
+#define WPFP_WPFP434         0xFFB2
+#define WPFP_WPFP435         0xFFB3
+#define WPFP_WPFP436         0xFFB4
+#define WPFP_WPFP437         0xFFB5
+#define WPFP_WPFP438         0xFFB6
+#define WPFP_WPFP439         0xFFB7
+#define WPFP_WPFP440         0xFFB8
+#define WPFP_WPFP441         0xFFB9
+#define WPFP_WPFP442         0xFFBA
+#define WPFP_WPFP443         0xFFBB
+#define WPFP_WPFP444         0xFFBC
+#define WPFP_WPFP445         0xFFBD
+#define WPFP_WPFP446         0xFFBE
+#define WPFP_WPFP447         0xFFBF
+#define WPFP_WPFP448         0xFFC0
+#define WPFP_WPFP449         0xFFC1
+#define WPFP_WPFP450         0xFFC2
+#define WPFP_WPFP451         0xFFC3
+#define WPFP_WPFP452         0xFFC4
+#define WPFP_WPFP453         0xFFC5
+#define WPFP_WPFP454         0xFFC6
+#define WPFP_WPFP455         0xFFC7
+#define WPFP_WPFP456         0xFFC8
+#define WPFP_WPFP457         0xFFC9
+#define WPFP_WPFP458         0xFFCA
+#define WPFP_WPFP459         0xFFCB
+#define WPFP_WPFP460         0xFFCC
+#define WPFP_WPFP461         0xFFCD
+#define WPFP_WPFP462         0xFFCE
+#define WPFP_WPFP463         0xFFCF
+#define WPFP_WPFP464         0xFFD0
+#define WPFP_WPFP465         0xFFD1
+#define WPFP_WPFP466         0xFFD2
+#define WPFP_WPFP467         0xFFD3
+#define WPFP_WPFP468         0xFFD4
+#define WPFP_WPFP469         0xFFD5
+#define WPFP_WPFP470         0xFFD6
+#define WPFP_WPFP471         0xFFD7
+#define WPFP_WPFP472         0xFFD8
+#define WPFP_WPFP473         0xFFD9
+#define WPFP_WPFP474         0xFFDA
+#define WPFP_WPFP475         0xFFDB
+#define WPFP_WPFP476         0xFFDC
+#define WPFP_WPFP477         0xFFDD
+#define WPFP_WPFP478         0xFFDE
+#define WPFP_WPFP479         0xFFDF
+#define WPFP_WPFP480         0xFFE0
+#define WPFP_WPFP481         0xFFE1
+#define WPFP_WPFP482         0xFFE2
+#define WPFP_WPFP483         0xFFE3
+#define WPFP_WPFP484         0xFFE4
+#define WPFP_WPFP485         0xFFE5
+#define WPFP_WPFP486         0xFFE6
+#define WPFP_WPFP487         0xFFE7
+#define WPFP_WPFP488         0xFFE8
+#define WPFP_WPFP489         0xFFE9
+#define WPFP_WPFP490         0xFFEA
+#define WPFP_WPFP491         0xFFEB
+#define WPFP_WPFP492         0xFFEC
+#define WPFP_WPFP493         0xFFED
+#define WPFP_WPFP494         0xFFEE
+#define WPFP_WPFP495         0xFFEF
+#define WPFP_WPFP496         0xFFF0
+#define WPFP_WPFP497         0xFFF1
+#define WPFP_WPFP498         0xFFF2
+#define WPFP_WPFP499         0xFFF3
+#define WPFP_WPFP500         0xFFF4
+#define WPFP_WPFP501         0xFFF5
+#define WPFP_WPFP502         0xFFF6
+#define WPFP_WPFP503         0xFFF7
+#define WPFP_WPFP504         0xFFF8
+#define WPFP_WPFP505         0xFFF9
+#define WPFP_WPFP506         0xFFFA
+#define WPFP_WPFP507         0xFFFB
+#define WPFP_WPFP508         0xFFFC
+#define WPFP_WPFP509         0xFFFD
+#define WPFP_WPFP510         0xFFFE
+#define WPFP_WPFP511         0xFFFF
+
+/* Register CONFIG2 (0x2abfc)                               */
+
+extern __attribute__((space(prog))) int _CONFIG2;
+#define _CONFIG2(x) __attribute__((section("__CONFIG2.sec"),space(prog))) int _CONFIG2 = (x);
+
+/*
+** Only one invocation of CONFIG2 should appear in a project,
+** at the top of a C source file (outside of any function).
+**
+** The following constants can be used to set CONFIG2.
+** Multiple options may be combined, as shown:
+**
+** _CONFIG2( OPT1_ON & OPT2_OFF & OPT3_PLL )
+**
+**   Two Speed Start-up:
+**     IESO_OFF             Disabled
+**     IESO_ON              Enabled
+**
+**   96MHz PLL Prescaler:
+**     PLLDIV_NODIV         No Divide (4MHz input)
+**     PLLDIV_DIV2          Divide by 2 (8MHz input)
+**     PLLDIV_DIV3          Divide by 3 (12MHz input)
+**     PLLDIV_DIV4          Divide by 4 (16MHz input)
+**     PLLDIV_DIV5          Divide by 5 (20MHz input)
+**     PLLDIV_DIV6          Divide by 6 (24MHz input)
+**     PLLDIV_DIV10         Divide by 10 (40MHz input)
+**     PLLDIV_DIV12         Divide by 12 (48MHz input)
+**
+**   Disable 96MHz PLL:
+**     PLL_96MHZ_ON         Enabled
+**
+**   Oscillator Selection:
+**     FNOSC_FRC            Fast RC oscillator
+**     FNOSC_FRCPLL         Fast RC oscillator w/ divide and PLL
+**     FNOSC_PRI            Primary oscillator (XT, HS, EC)
+**     FNOSC_PRIPLL         Primary oscillator (XT, HS, EC) w/ PLL
+**     FNOSC_SOSC           Secondary oscillator
+**     FNOSC_LPRC           Low power RC oscillator
+**     FNOSC_FRCDIV         Fast RC oscillator with divide
+**
+**   Clock switching and clock monitor:
+**     FCKSM_CSECME         Both enabled
+**     FCKSM_CSECMD         Only clock switching enabled
+**     FCKSM_CSDCMD         Both disabled
+**
+**   OSCO/RC15 function:
+**     OSCIOFNC_ON          RC15
+**     OSCIOFNC_OFF         OSCO or Fosc/2
+**
+**   RP Register Protection:
+**     IOL1WAY_OFF          Unlimited Writes To RP Registers
+**     IOL1WAY_ON           Write RP Registers Once
+**
+**   Disable Internal USB Voltage Regulator:
+**     DISUVREG_ON          Enabled
+**     DISUVREG_OFF         Disabled
+**
+**   Oscillator Selection:
+**     POSCMOD_EC           External clock
+**     POSCMOD_XT           XT oscillator
+**     POSCMOD_HS           HS oscillator
+**     POSCMOD_NONE         Primary disabled
+**
+*/
+
+#define IESO_OFF             0x77FF
+#define IESO_ON              0xF7FF
+
+#define PLLDIV_NODIV         0x87FF
+#define PLLDIV_DIV2          0x97FF
+#define PLLDIV_DIV3          0xA7FF
+#define PLLDIV_DIV4          0xB7FF
+#define PLLDIV_DIV5          0xC7FF
+#define PLLDIV_DIV6          0xD7FF
+#define PLLDIV_DIV10         0xE7FF
+#define PLLDIV_DIV12         0xF7FF
+
+#define PLL_96MHZ_ON         0xF7FF
+
+#define FNOSC_FRC            0xF0FF
+#define FNOSC_FRCPLL         0xF1FF
+#define FNOSC_PRI            0xF2FF
+#define FNOSC_PRIPLL         0xF3FF
+#define FNOSC_SOSC           0xF4FF
+#define FNOSC_LPRC           0xF5FF
+#define FNOSC_FRCDIV         0xF7FF
+
+#define FCKSM_CSECME         0xF73F
+#define FCKSM_CSECMD         0xF77F
+#define FCKSM_CSDCMD         0xF7BF
+
+#define OSCIOFNC_ON          0xF7DF
+#define OSCIOFNC_OFF         0xF7FF
+
+#define IOL1WAY_OFF          0xF7EF
+#define IOL1WAY_ON           0xF7FF
+
+#define DISUVREG_ON          0xF7F7
+#define DISUVREG_OFF         0xF7FF
+
+#define POSCMOD_EC           0xF7FC
+#define POSCMOD_XT           0xF7FD
+#define POSCMOD_HS           0xF7FE
+#define POSCMOD_NONE         0xF7FF
+
+/* Register CONFIG1 (0x2abfe)                               */
+
+extern __attribute__((space(prog))) int _CONFIG1;
+#define _CONFIG1(x) __attribute__((section("__CONFIG1.sec"),space(prog))) int _CONFIG1 = (x);
+
+/*
+** Only one invocation of CONFIG1 should appear in a project,
+** at the top of a C source file (outside of any function).
+**
+** The following constants can be used to set CONFIG1.
+** Multiple options may be combined, as shown:
+**
+** _CONFIG1( OPT1_ON & OPT2_OFF & OPT3_PLL )
+**
+**   JTAG:
+**     JTAGEN_OFF           Disabled
+**     JTAGEN_ON            Enabled
+**
+**   Code Protect:
+**     GCP_ON               Enabled
+**     GCP_OFF              Disabled
+**
+**   Write Protect:
+**     GWRP_ON              Enabled
+**     GWRP_OFF             Disabled
+**
+**   Background Debugger:
+**     BKBUG_ON             Enabled
+**     BKBUG_OFF            Disabled
+**
+**   Clip-on Emulation mode:
+**     COE_ON               Enabled
+**     COE_OFF              Disabled
+**
+**   ICD pins select:
+**     ICS_PGx3             EMUC/EMUD share PGC3/PGD3
+**     ICS_PGx2             EMUC/EMUD share PGC2/PGD2
+**     ICS_PGx1             EMUC/EMUD share PGC1/PGD1
+**
+**   Watchdog Timer:
+**     FWDTEN_OFF           Disabled
+**     FWDTEN_ON            Enabled
+**
+**   Windowed WDT:
+**     WINDIS_ON            Enabled
+**     WINDIS_OFF           Disabled
+**
+**   Watchdog prescaler:
+**     FWPSA_PR32           1:32
+**     FWPSA_PR128          1:128
+**
+**   Watchdog postscale:
+**     WDTPS_PS1            1:1
+**     WDTPS_PS2            1:2
+**     WDTPS_PS4            1:4
+**     WDTPS_PS8            1:8
+**     WDTPS_PS16           1:16
+**     WDTPS_PS32           1:32
+**     WDTPS_PS64           1:64
+**     WDTPS_PS128          1:128
+**     WDTPS_PS256          1:256
+**     WDTPS_PS512          1:512
+**     WDTPS_PS1024         1:1,024
+**     WDTPS_PS2048         1:2,048
+**     WDTPS_PS4096         1:4,096
+**     WDTPS_PS8192         1:8,192
+**     WDTPS_PS16384        1:16,384
+**     WDTPS_PS32768        1:32,768
+**
+*/
+
+#define JTAGEN_OFF           0x3FFF
+#define JTAGEN_ON            0x7FFF
+
+#define GCP_ON               0x5FFF
+#define GCP_OFF              0x7FFF
+
+#define GWRP_ON              0x6FFF
+#define GWRP_OFF             0x7FFF
+
+#define BKBUG_ON             0x77FF
+#define BKBUG_OFF            0x7FFF
+
+#define COE_ON               0x7BFF
+#define COE_OFF              0x7FFF
+
+#define ICS_PGx3             0x7DFF
+#define ICS_PGx2             0x7EFF
+#define ICS_PGx1             0x7FFF
+
+#define FWDTEN_OFF           0x7F7F
+#define FWDTEN_ON            0x7FFF
+
+#define WINDIS_ON            0x7FBF
+#define WINDIS_OFF           0x7FFF
+
+#define FWPSA_PR32           0x7FEF
+#define FWPSA_PR128          0x7FFF
+
+#define WDTPS_PS1            0x7FF0
+#define WDTPS_PS2            0x7FF1
+#define WDTPS_PS4            0x7FF2
+#define WDTPS_PS8            0x7FF3
+#define WDTPS_PS16           0x7FF4
+#define WDTPS_PS32           0x7FF5
+#define WDTPS_PS64           0x7FF6
+#define WDTPS_PS128          0x7FF7
+#define WDTPS_PS256          0x7FF8
+#define WDTPS_PS512          0x7FF9
+#define WDTPS_PS1024         0x7FFA
+#define WDTPS_PS2048         0x7FFB
+#define WDTPS_PS4096         0x7FFC
+#define WDTPS_PS8192         0x7FFD
+#define WDTPS_PS16384        0x7FFE
+#define WDTPS_PS32768        0x7FFF
+
+
+#endif
@@ -0,0 +1,103 @@
+#include "stdhdr.h"
+#include "register_service.h"
+#include <string.h>
+
+extern int gRegisterCount;
+
+static const unsigned int TransportAccess[RegTransportCount]=
+{
+	RegAccessRead|RegAccessWriteAll, //RegTransportUSB
+	RegAccessRead|RegAccessWriteListed //RegTransportXbee
+};
+
+//all a transport with RegAccessWriteListed may write: driving, the flipper and what
+//a query needs.  Everything else (limits, protection, the comm loss watchdog,
+//calibration, flash) belongs to the host.
+static void * const RadioWritable[]=
+{
+	&REG_MOTOR_VELOCITY,
+	&REG_MOTOR_TWIST_MODE,
+	&REG_MOTOR_TWIST,
+	&REG_MOTOR_SLOW_SPEED,//as P1_Low_Speed_Set
+	&REG_MOTOR_SIDE_FAN_SPEED,//as P1_Fan_Command
+	&REG_DEBUG_LOG_ACK,//reading the log
+};
+
+static int allowed(int transport, unsigned int index, int write);
+
+//returns the length of the reply, 0 if there was no room for it
+unsigned int RegisterService(int transport, const uint8_t *request, unsigned int request_length, uint8_t *reply, unsigned int reply_size)
+{
+	unsigned int n=0,i=0;
+	uint16_t cur_word,reg_index,reg_size;
+
+	while(n+2<=request_length)
+	{
+		cur_word=request[n]+(request[n+1]<<8); // get register value
+		n+=2;
+		if(cur_word==PACKET_TERMINATOR)
+			break; // end of list
+
+		reg_index=cur_word&~DEVICE_READ;
+		if(reg_index>=gRegisterCount)
+			break; // bad packet
+		reg_size=registers[reg_index].size;
+
+		if((cur_word&DEVICE_READ)==DEVICE_READ)
+		{
+			if(!allowed(transport,reg_index,False))
+				continue;
+			if(i+2+reg_size>reply_size)
+				break; // overflow
+			reply[i]=reg_index&0xff;
+			reply[i+1]=reg_index>>8;
+			i+=2;
+			memcpy(reply+i,registers[reg_index].ptr,reg_size);
+			i+=reg_size;
+		}
+		else
+		{
+			if(n+reg_size>request_length)
+				break; // overflow
+			if(allowed(transport,reg_index,True))
+				memcpy(registers[reg_index].ptr,request+n,reg_size);
+			n+=reg_size;
+		}
+	}
+
+	if(i+2>reply_size)
+		return 0;
+	reply[i]=PACKET_TERMINATOR&0xff;
+	reply[i+1]=PACKET_TERMINATOR>>8;
+	return i+2;
+}
+
+static int allowed(int transport, unsigned int index, int write)
+{
+	unsigned int access=TransportAccess[transport];
+	unsigned int k;
+
+	if(!write)
+	{
+		if(access&RegAccessRead)
+			return True;
+	}
+	else if(access&RegAccessWriteAll)
+	{
+		return True;
+	}
+	else if(access&RegAccessWriteListed)
+	{
+		for(k=0;k<sizeof(RadioWritable)/sizeof(RadioWritable[0]);k++)
+		{
+			if(registers[index].ptr==RadioWritable[k])
+				return True;
+		}
+	}
+
+	if(transport==RegTransportUSB)
+		REG_REGISTER_DENIED.usb++;
+	else
+		REG_REGISTER_DENIED.xbee++;
+	return False;
+}
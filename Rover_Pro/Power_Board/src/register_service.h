@@ -0,0 +1,23 @@
+//Register requests, parsed once for every transport: the USB generic endpoint
+//(ProcessIO()) and the Xbee link (XbeeMsgRegisters).  A request is a list of
+//register words, low byte first, ended by PACKET_TERMINATOR or the end of the
+//request.  The word is the register's index in registers[]; with DEVICE_READ set the
+//register is read, without it the register's new value follows.  The reply holds the
+//index and value of every register read, then PACKET_TERMINATOR, the way USB always
+//answered.  A bad index ends the request.
+//
+//Each transport has its own access: USB reads and writes anything, as it always
+//could; the radio reads anything but only writes the drive, flipper and query
+//registers listed in the .c, so it can't change limits, protection, the comm loss
+//watchdog or flash.  Denied accesses are skipped and counted in REG_REGISTER_DENIED.
+
+#define RegTransportUSB 0
+#define RegTransportXbee 1
+#define RegTransportCount 2
+
+//access per transport
+#define RegAccessRead 0x01
+#define RegAccessWriteListed 0x02 //the registers in RadioWritable[]
+#define RegAccessWriteAll 0x04
+
+unsigned int RegisterService(int transport, const uint8_t *request, unsigned int request_length, uint8_t *reply, unsigned int reply_size);
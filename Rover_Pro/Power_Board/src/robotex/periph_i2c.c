@@ -1,533 +1,1018 @@
-/**
- * @file periph_i2c.h
- * @author J. Brinton
- * @author Robotex, Inc.
- *
- * I2C bus firmware driver for Microchip PIC24F
- *
- *
- * Method writeI2CBus() sets the driver state to begin a process of I2C
- * transfers. If the driver is busy it returns -1. Each control sequence
- * sets the drivers state and returns immediately waiting for the hardware
- * interrupt to trigger the next control sequence:
- *
- * writeI2CBus()         : 1) check if device is free
- *                         2) initiate master START
- *                         3) set state to I2C_WRITE_START
- *                         4) return
- * _MI2C1Interrupt()     : 1) confirm master START
- *                         2) initiate master address WRITE
- *                         3) set state to I2C_WRITE_ADDR
- *                         4) return
- * _MI2C1Interrupt()     : 1) confirm master WRITE
- *                         2) initiate master data WRITE
- *                         3) set state to I2C_WRITE_DATA
- *                         4) return
- * _MI2C1Interrupt()     : 1) confirm master WRITE
- *                         2) initiate master data WRITE
- *                         3) set state to I2C_WRITE_DATA
- *                         4) return
- * _MI2C1Interrupt()     : 1) confirm master WRITE
- *                         2) initiate master STOP
- *                         3) set state to I2C_STOP
- *                         4) return
- * _MI2C1Interrupt()     : 1) confirm I2C STOP
- *                         2) set state to I2C_IDLE
- *                         3) return
- *
- */
-
-#include <string.h>
-#include "p24Fxxxx.h"
-
-#include "periph_i2c.h"
-
-// max number of I2C bus callbacks
-#define I2C_MAX_CALLBACKS 10 /*functions*/
-#define I2C_BUS_BUFFER 256 /*bytes*/
-
-// I2C callback vector
-struct I2C_CALLBACKS
-{
-   I2C_FUNC func;
-   unsigned char bus;
-   unsigned char addr;
-} __i2c_read_callbacks[I2C_MAX_CALLBACKS] = { { 0 } },
-  __i2c_write_callbacks[I2C_MAX_CALLBACKS] = { { 0 } };
-
-unsigned int __i2c_read_callback_pos = 0;
-unsigned int __i2c_write_callback_pos = 0;
-
-
-// I2C driver state
-typedef enum I2C_STATES_T
-{
-   I2C_IDLE = 0,
-
-   I2C_WRITE_START,
-   I2C_WRITE_ADDR,
-   I2C_WRITE_DATA,
-   I2C_WRITE_STOP,
-
-   I2C_READ_START,
-   I2C_READ_ADDR,
-   I2C_READ_DATA,
-   I2C_READ_NACK,
-   I2C_READ_ACK,
-   I2C_READ_STOP,
-
-   I2C_READREG_START,
-   I2C_READREG_ADDR,
-   I2C_READREG_WRITE,
-   I2C_READREG_RESTART,
-} I2C_STATES;
-
-// ****************************************************************************
-// DRIVER
-// ****************************************************************************
-
-// I2C bus driver
-struct I2C_DRIVER
-{
-   I2C_STATES state;
-   unsigned int  pos;
-   unsigned int  len;
-   unsigned char addr;
-   unsigned char reg;
-   unsigned char buf[I2C_BUS_BUFFER];
-} __i2c_driver[3] = { { 0 } };
-
-
-// ****************************************************************************
-// FUNCTIONS
-// ****************************************************************************
-
-I2C1CONBITS* __i2c_get_hardware_cntl(unsigned int bus)
-{
-   switch (bus)
-   {
-      case 1:
-         return (I2C1CONBITS*)&I2C1CONbits;
-      case 2:
-         return (I2C1CONBITS*)&I2C2CONbits;
-      case 3:
-         return (I2C1CONBITS*)&I2C3CONbits;
-   }
-   return 0;
-}
-
-// find callback to handle incoming packet
-void __i2c_read_callback(struct I2C_DRIVER *driver, unsigned char mbus,
-                         unsigned char reg)
-{
-   int i;
-   I2C_FUNC func = 0;
-
-   for (i = 0; i < I2C_MAX_CALLBACKS; i++)
-   {
-      if ((mbus         == __i2c_read_callbacks[i].bus) &&
-          (driver->addr == __i2c_read_callbacks[i].addr))
-      {
-         func = __i2c_read_callbacks[i].func;
-      }
-   }
-
-   if( func != 0 )
-   {
-      func(driver->addr, mbus, reg, driver->buf, driver->len);
-   }
-}
-
-// find callback to handle completion of outgoing
-void __i2c_write_callback(struct I2C_DRIVER *driver, unsigned char mbus,
-                         unsigned char reg)
-{
-   int i;
-   I2C_FUNC func = 0;
-
-   for (i = 0; i < I2C_MAX_CALLBACKS; i++)
-   {
-      if ((mbus         == __i2c_write_callbacks[i].bus) &&
-          (driver->addr == __i2c_write_callbacks[i].addr))
-      {
-         func = __i2c_write_callbacks[i].func;
-      }
-   }
-
-   if( func != 0 )
-   {
-      func(driver->addr, mbus, reg, driver->buf, driver->len);
-   }
-}
-
-// handles generic i2c hardware routines
-void __i2c_routine(struct I2C_DRIVER *driver, volatile I2C1CONBITS *I2CCONbits,
-                   volatile unsigned int *I2CTRN, volatile unsigned int *I2CRCV,
-                   unsigned char bus)
-{
-   switch (driver->state)
-   {
-      // after START interrupt TRANSMIT address
-      case I2C_WRITE_START:
-         driver->state = I2C_WRITE_ADDR;
-         *I2CTRN = (driver->addr << 1) & ~0x01;
-         break;
-
-      case I2C_WRITE_ADDR:
-      case I2C_WRITE_DATA:
-         if( driver->pos >= driver->len ) {  // no more data to send
-            driver->state = I2C_WRITE_STOP;
-            I2CCONbits->PEN = 1; }
-         else {  // data left in buffer
-            driver->state = I2C_WRITE_DATA;
-            *I2CTRN = driver->buf[driver->pos];
-            driver->pos++; }
-         break;
-
-      case I2C_WRITE_STOP:
-         driver->state = I2C_IDLE;
-		__i2c_write_callback(driver, bus, driver->reg);
-         break;
-
-
-      // after START interrupt TRANSMIT address
-      case I2C_READ_START:
-         *I2CTRN = (driver->addr << 1) | 0x01;
-         driver->state = I2C_READ_ADDR;
-         break;
-
-      // after address TRANSMIT acknowledgement RECEIVE data
-      case I2C_READ_ADDR:
-         driver->state = I2C_READ_DATA;
-         I2CCONbits->RCEN = 1; // receive enable
-         break;
-
-      case I2C_READ_DATA:
-         driver->buf[driver->pos] = *I2CRCV;
-         driver->pos++;
-         if( driver->pos < driver->len ) { // receive more data
-            I2CCONbits->ACKDT = 0; // ACK vs. NACK
-            I2CCONbits->ACKEN = 1; // send ACK
-            driver->state = I2C_READ_ACK; }
-         else { // done, send NACK and STOP
-            I2CCONbits->ACKDT = 1; // NACK vs. ACK
-            I2CCONbits->ACKEN = 1; // send ACK
-            driver->state = I2C_READ_NACK; }
-         break;
-
-      case I2C_READ_ACK:
-         driver->state = I2C_READ_DATA;
-         I2CCONbits->RCEN = 1; // receive enable
-         break;
-
-      case I2C_READ_NACK:
-         I2CCONbits->PEN = 1; // STOP
-         driver->state = I2C_READ_STOP;
-         break;
-
-      case I2C_READ_STOP:
-         driver->state = I2C_IDLE;
-		__i2c_read_callback(driver, bus, driver->reg);
-         break;
-
-
-      // after START interrupt TRANSMIT address
-      case I2C_READREG_START:
-         *I2CTRN = (driver->addr << 1) & ~0x01;
-         driver->state = I2C_READREG_ADDR;
-         break;
-
-      // after address TRANSMIT acknowledgement TRANSMIT reg
-      case I2C_READREG_ADDR:
-         driver->state = I2C_READREG_WRITE;
-         *I2CTRN = driver->reg;
-         break;
-
-      case I2C_READREG_WRITE:
-         driver->state = I2C_READREG_RESTART;
-         I2CCONbits->RSEN = 1; // repeat start
-         break;
-
-      case I2C_READREG_RESTART:
-         driver->state = I2C_READ_ADDR;
-         *I2CTRN = (driver->addr << 1) | 0x01;
-         break;
-
-
-      default:
-         return;
-   }
-   return;
-}
-
-
-// Master I2C interupt 1
-void _ISR __attribute__((auto_psv)) _MI2C1Interrupt(void)
-{
-   _MI2C1IF=0;
-   __i2c_routine(&__i2c_driver[0], (I2C1CONBITS*)&I2C1CONbits,
-                 &I2C1TRN, &I2C1RCV, 1);
-}
-
-
-// Master I2C interrupt 2
-void _ISR __attribute__((auto_psv)) _MI2C2Interrupt(void)
-{
-   _MI2C2IF=0;
-   __i2c_routine(&__i2c_driver[1], (I2C1CONBITS*)&I2C2CONbits,
-                 &I2C2TRN, &I2C2RCV, 2);
-}
-
-
-// Master I2C interrupt 3
-void _ISR __attribute__((auto_psv)) _MI2C3Interrupt(void)
-{
-   _MI2C3IF=0;
-   __i2c_routine(&__i2c_driver[2], (I2C1CONBITS*)&I2C3CONbits,
-                 &I2C3TRN, &I2C3RCV, 3);
-}
-
-
-// ****************************************************************************
-// API DEFINITIONS
-// ****************************************************************************
-
-
-// registers data handler for i2c messages
-int registerI2CReadCallback(I2C_FUNC func, unsigned char bus, unsigned char addr)
-{
-   if (__i2c_read_callback_pos >= I2C_MAX_CALLBACKS) return -1;
-
-   __i2c_read_callbacks[__i2c_read_callback_pos].func = func;
-   __i2c_read_callbacks[__i2c_read_callback_pos].bus  = bus;
-   __i2c_read_callbacks[__i2c_read_callback_pos].addr = addr;
-
-   __i2c_read_callback_pos++;
-
-   return 0;
-}
-
-// registers data handler for i2c messages
-int registerI2CWriteCallback(I2C_FUNC func, unsigned char bus, unsigned char addr)
-{
-   if (__i2c_write_callback_pos >= I2C_MAX_CALLBACKS) return -1;
-
-   __i2c_write_callbacks[__i2c_write_callback_pos].func = func;
-   __i2c_write_callbacks[__i2c_write_callback_pos].bus  = bus;
-   __i2c_write_callbacks[__i2c_write_callback_pos].addr = addr;
-
-   __i2c_write_callback_pos++;
-
-   return 0;
-}
-
-// returns 1 if I2C bus busy otherwise returns 0
-int isBusyI2C(unsigned char bus)
-{
-   if( __i2c_driver[bus-1].state != I2C_IDLE ) return 1;
-   else return 0;
-};
-
-// asyncronous I2C bus write, returns -1 if busy, -2 invalid, 0 if successful
-int writeI2C(unsigned char bus,
-             unsigned char addr,
-             unsigned char *data,
-             unsigned int len)
-{
-   if( isBusyI2C(bus) ) return -1; // busy
-
-   if (len == 0) return -2;
-   if (len > I2C_BUS_BUFFER) return -2;
-   if ((bus > 3) || (bus < 1)) return -2;
-
-   memcpy(__i2c_driver[bus-1].buf, data, len);
-   __i2c_driver[bus-1].pos   = 0;
-   __i2c_driver[bus-1].len   = len;
-   __i2c_driver[bus-1].addr  = addr;
-   __i2c_driver[bus-1].state = I2C_WRITE_START;
-   // Best estimate for most devices. Only used in read callback.
-   __i2c_driver[bus-1].reg   = data[0] + len - 1;
-   __i2c_get_hardware_cntl(bus)->SEN = 1; // send start condition
-
-   return 0;
-}
-
-// syncronous I2C bus write, returns -1 if busy, -2 invalid, 0 if successful
-int writeI2CBlocking(unsigned char bus,
-                     unsigned char addr,
-                     unsigned char *data,
-                     unsigned int  len)
-{
-   int r;
-
-   r = writeI2C(bus, addr, data, len);
-
-   while( isBusyI2C(bus) ) { }
-
-   return r;
-}
-
-// asyncronous I2C bus write, returns -1 if busy, -2 invalid, 0 if successful
-int writeRegI2C(unsigned char bus,
-                unsigned char addr,
-                unsigned char reg,
-                unsigned char *data,
-                unsigned int len)
-{
-   if( isBusyI2C(bus) ) return -1; // busy
-
-   if (len == 0) return -2;
-   if (len + 1 > I2C_BUS_BUFFER) return -2;
-   if ((bus > 3) || (bus < 1)) return -2;
-
-   memcpy(__i2c_driver[bus-1].buf + 1, data, len);
-   __i2c_driver[bus-1].buf[0] = reg;
-   __i2c_driver[bus-1].pos   = 0;
-   __i2c_driver[bus-1].len   = len + 1;
-   __i2c_driver[bus-1].addr  = addr;
-   __i2c_driver[bus-1].state = I2C_WRITE_START;
-   // Best estimate for most devices. Only used in read callback.
-   __i2c_driver[bus-1].reg   = reg + len - 1;
-   __i2c_get_hardware_cntl(bus)->SEN = 1; // send start condition
-
-   return 0;
-}
-
-// syncronous I2C bus write, returns -1 if busy, -2 invalid, 0 if successful
-int writeRegI2CBlocking(unsigned char bus,
-                        unsigned char addr,
-                        unsigned char reg,
-                        unsigned char *data,
-                        unsigned int  len)
-{
-   int r;
-
-   r = writeRegI2C(bus, addr, reg, data, len);
-
-   while( isBusyI2C(bus) ) { }
-
-   return r;
-}
-
-// asyncronous I2C bus write, returns -1 if busy, -2 invalid, 0 if successful
-int writeRegByteI2C(unsigned char bus,
-                unsigned char addr,
-                unsigned char reg,
-                unsigned char data)
-{
-   if( isBusyI2C(bus) ) return -1; // busy
-
-   if ((bus > 3) || (bus < 1)) return -2;
-
-   __i2c_driver[bus-1].buf[0] = reg;
-   __i2c_driver[bus-1].buf[1] = data;
-   __i2c_driver[bus-1].pos   = 0;
-   __i2c_driver[bus-1].len   = 2;
-   __i2c_driver[bus-1].addr  = addr;
-   __i2c_driver[bus-1].state = I2C_WRITE_START;
-   // Best estimate for most devices. Only used in read callback.
-   __i2c_driver[bus-1].reg   = reg;
-   __i2c_get_hardware_cntl(bus)->SEN = 1; // send start condition
-
-   return 0;
-}
-
-// syncronous I2C bus write, returns -1 if busy, -2 invalid, 0 if successful
-int writeRegByteI2CBlocking(unsigned char bus,
-                            unsigned char addr,
-                            unsigned char reg,
-                            unsigned char data)
-{
-   int r;
-
-   r = writeRegByteI2C(bus, addr, reg, data);
-
-   while( isBusyI2C(bus) ) { }
-
-   return r;
-}
-
-/* asyncronous I2C bus READ, returns -1 if busy, -2 invalid, 0 if successful.
-   Callback is called once all data is read. */
-int readI2C(unsigned char bus,
-            unsigned char addr,
-            unsigned int len)
-{
-   if( isBusyI2C(bus) ) return -1; // busy
-
-   if (len == 0) return -2;
-   if (len > I2C_BUS_BUFFER) return -2;
-   if ((bus > 3) || (bus < 1)) return -2;
-
-   __i2c_driver[bus-1].pos   = 0;
-   __i2c_driver[bus-1].len   = len;
-   __i2c_driver[bus-1].addr  = addr;
-   __i2c_driver[bus-1].state = I2C_READ_START;
-   __i2c_get_hardware_cntl(bus)->SEN = 1; // send start condition
-
-   return 0;
-}
-
-
-/* syncronous I2C bus READ, returns pointer to packet data
-   Callback is called once all data is read. */
-unsigned char *readI2CBlocking(unsigned char bus,
-                               unsigned char addr,
-                               unsigned int len)
-{
-   int r;
-
-   if( isBusyI2C(bus) ) return 0;
-
-   r = readI2C(bus, addr, len);
-
-   if( r < 0 ) return 0;
-
-   while( isBusyI2C(bus) ) { };
-
-   return __i2c_driver[bus-1].buf;
-}
-
-
-/* asyncronous I2C bus READ, returns -1 if busy, -2 invalid, 0 if successful.
-   Callback is called once all data is read. */
-int readRegI2C(unsigned char bus,
-               unsigned char addr,
-               unsigned char reg,
-               unsigned int len)
-{
-   if( isBusyI2C(bus) ) return -1; // busy
-
-   if (len == 0) return -2;
-   if (len > I2C_BUS_BUFFER) return -2;
-   if ((bus > 3) || (bus < 1)) return -2;
-
-   __i2c_driver[bus-1].pos   = 0;
-   __i2c_driver[bus-1].len   = len;
-   __i2c_driver[bus-1].addr  = addr;
-   __i2c_driver[bus-1].reg   = reg;
-   __i2c_driver[bus-1].state = I2C_READREG_START;
-   __i2c_get_hardware_cntl(bus)->SEN = 1; // send start condition
-
-   return 0;
-}
-
-/* syncronous I2C bus READ, returns pointer to packet data
-   Callback is called once all data is read. */
-unsigned char *readRegI2CBlocking(unsigned char bus,
-                                  unsigned char addr,
-                                  unsigned char reg,
-                                  unsigned int len)
-{
-   int r;
-
-   if( isBusyI2C(bus) ) return 0;
-
-   r = readRegI2C(bus, addr, reg, len);
-
-   if( r < 0 ) return 0;
-
-   while( isBusyI2C(bus) ) { };
-
-   return __i2c_driver[bus-1].buf;
-}
+/**
+ * @file periph_i2c.h
+ * @author J. Brinton
+ * @author Robotex, Inc.
+ *
+ * I2C bus firmware driver for Microchip PIC24F
+ *
+ *
+ * Method writeI2CBus() sets the driver state to begin a process of I2C
+ * transfers. If the driver is busy it returns -1. Each control sequence
+ * sets the drivers state and returns immediately waiting for the hardware
+ * interrupt to trigger the next control sequence:
+ *
+ * writeI2CBus()         : 1) check if device is free
+ *                         2) initiate master START
+ *                         3) set state to I2C_WRITE_START
+ *                         4) return
+ * _MI2C1Interrupt()     : 1) confirm master START
+ *                         2) initiate master address WRITE
+ *                         3) set state to I2C_WRITE_ADDR
+ *                         4) return
+ * _MI2C1Interrupt()     : 1) confirm master WRITE
+ *                         2) initiate master data WRITE
+ *                         3) set state to I2C_WRITE_DATA
+ *                         4) return
+ * _MI2C1Interrupt()     : 1) confirm master WRITE
+ *                         2) initiate master data WRITE
+ *                         3) set state to I2C_WRITE_DATA
+ *                         4) return
+ * _MI2C1Interrupt()     : 1) confirm master WRITE
+ *                         2) initiate master STOP
+ *                         3) set state to I2C_STOP
+ *                         4) return
+ * _MI2C1Interrupt()     : 1) confirm I2C STOP
+ *                         2) set state to I2C_IDLE
+ *                         3) return
+ *
+ */
+
+#include <string.h>
+#include "p24Fxxxx.h"
+
+#include "periph_i2c.h"
+
+// max number of I2C bus callbacks
+#define I2C_MAX_CALLBACKS 10 /*functions*/
+#define I2C_BUS_BUFFER 256 /*bytes*/
+// max number of slave addresses tracked per bus
+#define I2C_MAX_DEVICES 6 /*addresses*/
+
+// I2C callback vector
+struct I2C_CALLBACKS
+{
+   I2C_FUNC func;
+   unsigned char bus;
+   unsigned char addr;
+} __i2c_read_callbacks[I2C_MAX_CALLBACKS] = { { 0 } },
+  __i2c_write_callbacks[I2C_MAX_CALLBACKS] = { { 0 } };
+
+unsigned int __i2c_read_callback_pos = 0;
+unsigned int __i2c_write_callback_pos = 0;
+
+
+// I2C driver state
+typedef enum I2C_STATES_T
+{
+   I2C_IDLE = 0,
+
+   I2C_WRITE_START,
+   I2C_WRITE_ADDR,
+   I2C_WRITE_DATA,
+   I2C_WRITE_STOP,
+
+   I2C_READ_START,
+   I2C_READ_ADDR,
+   I2C_READ_DATA,
+   I2C_READ_NACK,
+   I2C_READ_ACK,
+   I2C_READ_STOP,
+
+   I2C_READREG_START,
+   I2C_READREG_ADDR,
+   I2C_READREG_WRITE,
+   I2C_READREG_RESTART,
+
+   I2C_ERROR_STOP,
+} I2C_STATES;
+
+// ****************************************************************************
+// DRIVER
+// ****************************************************************************
+
+// I2C bus driver
+struct I2C_DRIVER
+{
+   I2C_STATES state;
+   unsigned int  pos;
+   unsigned int  len;
+   unsigned char addr;
+   unsigned char reg;
+   unsigned char buf[I2C_BUS_BUFFER];
+
+   // transaction queue
+   unsigned char    running;
+   I2C_STATUS       error;   // status to finish with after an ERROR_STOP
+   I2C_TRANSACTION *active;
+   I2C_TRANSACTION *queue;   // by priority, first in first out within one
+   I2C_STATS        stats;
+   unsigned int (*reset)(void);
+
+   // bus fault recovery
+   unsigned char    recover;       // run the recovery before the next start
+   unsigned char    recover_addr;  // the device whose transaction failed
+   I2C_DEVICE_STATS devices[I2C_MAX_DEVICES];
+   unsigned int     device_count;
+} __i2c_driver[3] = { { 0 } };
+
+// millisecond clock, advanced by tickI2C()
+volatile unsigned int __i2c_ms = 0;
+
+
+// ****************************************************************************
+// FUNCTIONS
+// ****************************************************************************
+
+I2C1CONBITS* __i2c_get_hardware_cntl(unsigned int bus)
+{
+   switch (bus)
+   {
+      case 1:
+         return (I2C1CONBITS*)&I2C1CONbits;
+      case 2:
+         return (I2C1CONBITS*)&I2C2CONbits;
+      case 3:
+         return (I2C1CONBITS*)&I2C3CONbits;
+   }
+   return 0;
+}
+
+I2C1STATBITS* __i2c_get_hardware_stat(unsigned int bus)
+{
+   switch (bus)
+   {
+      case 1:
+         return (I2C1STATBITS*)&I2C1STATbits;
+      case 2:
+         return (I2C1STATBITS*)&I2C2STATbits;
+      case 3:
+         return (I2C1STATBITS*)&I2C3STATbits;
+   }
+   return 0;
+}
+
+// masks the master interrupt of a bus, returns whether it was enabled
+unsigned int __i2c_disable_interrupt(unsigned char bus)
+{
+   unsigned int enabled = 0;
+
+   switch (bus)
+   {
+      case 1:
+         enabled = _MI2C1IE; _MI2C1IE = 0; break;
+      case 2:
+         enabled = _MI2C2IE; _MI2C2IE = 0; break;
+      case 3:
+         enabled = _MI2C3IE; _MI2C3IE = 0; break;
+   }
+   return enabled;
+}
+
+void __i2c_restore_interrupt(unsigned char bus, unsigned int enabled)
+{
+   switch (bus)
+   {
+      case 1:
+         _MI2C1IE = enabled; break;
+      case 2:
+         _MI2C2IE = enabled; break;
+      case 3:
+         _MI2C3IE = enabled; break;
+   }
+}
+
+void __i2c_clear_interrupt_flag(unsigned char bus)
+{
+   switch (bus)
+   {
+      case 1:
+         _MI2C1IF = 0; break;
+      case 2:
+         _MI2C2IF = 0; break;
+      case 3:
+         _MI2C3IF = 0; break;
+   }
+}
+
+// find callback to handle incoming packet
+void __i2c_read_callback(struct I2C_DRIVER *driver, unsigned char mbus,
+                         unsigned char reg)
+{
+   int i;
+   I2C_FUNC func = 0;
+
+   for (i = 0; i < I2C_MAX_CALLBACKS; i++)
+   {
+      if ((mbus         == __i2c_read_callbacks[i].bus) &&
+          (driver->addr == __i2c_read_callbacks[i].addr))
+      {
+         func = __i2c_read_callbacks[i].func;
+      }
+   }
+
+   if( func != 0 )
+   {
+      func(driver->addr, mbus, reg, driver->buf, driver->len);
+   }
+}
+
+// find callback to handle completion of outgoing
+void __i2c_write_callback(struct I2C_DRIVER *driver, unsigned char mbus,
+                         unsigned char reg)
+{
+   int i;
+   I2C_FUNC func = 0;
+
+   for (i = 0; i < I2C_MAX_CALLBACKS; i++)
+   {
+      if ((mbus         == __i2c_write_callbacks[i].bus) &&
+          (driver->addr == __i2c_write_callbacks[i].addr))
+      {
+         func = __i2c_write_callbacks[i].func;
+      }
+   }
+
+   if( func != 0 )
+   {
+      func(driver->addr, mbus, reg, driver->buf, driver->len);
+   }
+}
+
+// finds the statistics of a device, adding it if asked and there is room,
+// or 0
+I2C_DEVICE_STATS *__i2c_device(struct I2C_DRIVER *driver, unsigned char addr,
+                               unsigned char add)
+{
+   unsigned int i;
+
+   for (i = 0; i < driver->device_count; i++)
+   {
+      if( driver->devices[i].addr == addr ) return &driver->devices[i];
+   }
+   if( !add || (driver->device_count >= I2C_MAX_DEVICES) ) return 0;
+
+   driver->devices[i].addr = addr;
+   driver->device_count++;
+   return &driver->devices[i];
+}
+
+// counts the outcome of a transaction against its device and backs the
+// device off exponentially while it keeps failing
+void __i2c_device_result(struct I2C_DRIVER *driver, unsigned char addr,
+                         I2C_STATUS status)
+{
+   I2C_DEVICE_STATS *device = __i2c_device(driver, addr, 1);
+   unsigned int backoff, i;
+
+   if( device == 0 ) return;
+
+   switch (status)
+   {
+      case I2C_STATUS_DONE:
+         device->failures = 0;
+         device->backoff  = 0;
+         return;
+      case I2C_STATUS_NACK:
+         device->nacks++; break;
+      case I2C_STATUS_COLLISION:
+         device->collisions++; break;
+      case I2C_STATUS_TIMEOUT:
+         device->timeouts++; break;
+      default:
+         return;
+   }
+
+   // I2C_BACKOFF_MIN after the first failure, doubling after each one
+   if( device->failures < 0xff ) device->failures++;
+   backoff = I2C_BACKOFF_MIN;
+   for (i = 1; (i < device->failures) && (backoff < I2C_BACKOFF_MAX); i++)
+      backoff <<= 1;
+   if( backoff > I2C_BACKOFF_MAX ) backoff = I2C_BACKOFF_MAX;
+
+   device->backoff      = backoff;
+   device->backoff_from = __i2c_ms;
+}
+
+// starts the next queued transaction if the bus is free
+void __i2c_start_next(struct I2C_DRIVER *driver, unsigned char bus)
+{
+   I2C_TRANSACTION *t = driver->queue;
+
+   if( !driver->running || driver->recover || (driver->active != 0) ||
+       (t == 0) ) return;
+
+   driver->queue = t->next;
+   t->next       = 0;
+   t->status     = I2C_STATUS_ACTIVE;
+   t->started_at = __i2c_ms;
+   driver->active = t;
+
+   driver->pos  = 0;
+   driver->addr = t->addr;
+   driver->reg  = t->reg;
+   if( t->flags & I2C_READ ) {
+      driver->len   = t->len;
+      driver->state = (t->flags & I2C_NO_REG) ? I2C_READ_START
+                                              : I2C_READREG_START; }
+   else if( t->flags & I2C_NO_REG ) {
+      memcpy(driver->buf, t->data, t->len);
+      driver->len   = t->len;
+      driver->state = I2C_WRITE_START; }
+   else {
+      driver->buf[0] = t->reg;
+      memcpy(driver->buf + 1, t->data, t->len);
+      driver->len   = t->len + 1;
+      driver->state = I2C_WRITE_START; }
+   __i2c_get_hardware_cntl(bus)->SEN = 1; // send start condition
+}
+
+// ends the active transaction, hands it back and starts the next one
+void __i2c_finish(struct I2C_DRIVER *driver, unsigned char bus,
+                  I2C_STATUS status)
+{
+   I2C_TRANSACTION *t = driver->active;
+   unsigned int latency, frames, bits;
+
+   driver->state = I2C_IDLE;
+   if( t == 0 ) return;
+   driver->active = 0;
+
+   if( (status == I2C_STATUS_DONE) && (t->flags & I2C_READ) )
+      memcpy(t->data, driver->buf, t->len);
+
+   latency = __i2c_ms - t->queued_at;
+   driver->stats.transactions++;
+   driver->stats.latency_total += latency;
+   if( latency > driver->stats.latency_max )
+      driver->stats.latency_max = latency;
+   if( status == I2C_STATUS_DONE ) driver->stats.bytes += t->len;
+   else driver->stats.failures++;
+
+   // 9 bits a frame (address, register and data bytes) plus START and STOP,
+   // and a repeated START and the address again to read a register; a
+   // failed transaction up to where it stopped
+   bits = 2;
+   if( status == I2C_STATUS_DONE )
+   {
+      frames = 1 + t->len;
+      if( !(t->flags & I2C_NO_REG) ) frames++;
+      if( (t->flags & (I2C_READ | I2C_NO_REG)) == I2C_READ ) {
+         frames++;
+         bits++; }
+   }
+   else frames = 1 + driver->pos;
+   driver->stats.bits += frames * 9 + bits;
+
+   switch (status)
+   {
+      case I2C_STATUS_NACK:
+         driver->stats.nacks++; break;
+      case I2C_STATUS_COLLISION:
+         driver->stats.collisions++; break;
+      case I2C_STATUS_TIMEOUT:
+         driver->stats.timeouts++; break;
+      default:
+         break;
+   }
+   __i2c_device_result(driver, t->addr, status);
+
+   // a lost or hung bus is cleared before anything else is started
+   if( (status == I2C_STATUS_COLLISION) || (status == I2C_STATUS_TIMEOUT) )
+   {
+      driver->recover      = 1;
+      driver->recover_addr = t->addr;
+   }
+
+   t->status = status;
+   if( t->done != 0 ) t->done(t);
+
+   __i2c_start_next(driver, bus);
+}
+
+// checks the slave's acknowledge of the last byte sent, on a NACK
+// sends STOP and returns 1
+int __i2c_nack(struct I2C_DRIVER *driver, volatile I2C1CONBITS *I2CCONbits,
+               volatile I2C1STATBITS *I2CSTATbits)
+{
+   if( !I2CSTATbits->ACKSTAT ) return 0;
+
+   driver->error = I2C_STATUS_NACK;
+   driver->state = I2C_ERROR_STOP;
+   I2CCONbits->PEN = 1;
+   return 1;
+}
+
+// handles generic i2c hardware routines
+void __i2c_routine(struct I2C_DRIVER *driver, volatile I2C1CONBITS *I2CCONbits,
+                   volatile I2C1STATBITS *I2CSTATbits,
+                   volatile unsigned int *I2CTRN, volatile unsigned int *I2CRCV,
+                   unsigned char bus)
+{
+   // lost the bus, the module has already let go of it so there is
+   // nothing to STOP
+   if( I2CSTATbits->BCL || I2CSTATbits->IWCOL )
+   {
+      I2CSTATbits->BCL   = 0;
+      I2CSTATbits->IWCOL = 0;
+      if( driver->state != I2C_IDLE )
+         __i2c_finish(driver, bus, I2C_STATUS_COLLISION);
+      return;
+   }
+
+   switch (driver->state)
+   {
+      // after START interrupt TRANSMIT address
+      case I2C_WRITE_START:
+         driver->state = I2C_WRITE_ADDR;
+         *I2CTRN = (driver->addr << 1) & ~0x01;
+         break;
+
+      case I2C_WRITE_ADDR:
+      case I2C_WRITE_DATA:
+         if( __i2c_nack(driver, I2CCONbits, I2CSTATbits) ) break;
+         if( driver->pos >= driver->len ) {  // no more data to send
+            driver->state = I2C_WRITE_STOP;
+            I2CCONbits->PEN = 1; }
+         else {  // data left in buffer
+            driver->state = I2C_WRITE_DATA;
+            *I2CTRN = driver->buf[driver->pos];
+            driver->pos++; }
+         break;
+
+      case I2C_WRITE_STOP:
+         if( driver->active != 0 ) {
+            __i2c_finish(driver, bus, I2C_STATUS_DONE);
+            break; }
+         driver->state = I2C_IDLE;
+		__i2c_write_callback(driver, bus, driver->reg);
+         break;
+
+
+      // after START interrupt TRANSMIT address
+      case I2C_READ_START:
+         *I2CTRN = (driver->addr << 1) | 0x01;
+         driver->state = I2C_READ_ADDR;
+         break;
+
+      // after address TRANSMIT acknowledgement RECEIVE data
+      case I2C_READ_ADDR:
+         if( __i2c_nack(driver, I2CCONbits, I2CSTATbits) ) break;
+         driver->state = I2C_READ_DATA;
+         I2CCONbits->RCEN = 1; // receive enable
+         break;
+
+      case I2C_READ_DATA:
+         driver->buf[driver->pos] = *I2CRCV;
+         driver->pos++;
+         if( driver->pos < driver->len ) { // receive more data
+            I2CCONbits->ACKDT = 0; // ACK vs. NACK
+            I2CCONbits->ACKEN = 1; // send ACK
+            driver->state = I2C_READ_ACK; }
+         else { // done, send NACK and STOP
+            I2CCONbits->ACKDT = 1; // NACK vs. ACK
+            I2CCONbits->ACKEN = 1; // send ACK
+            driver->state = I2C_READ_NACK; }
+         break;
+
+      case I2C_READ_ACK:
+         driver->state = I2C_READ_DATA;
+         I2CCONbits->RCEN = 1; // receive enable
+         break;
+
+      case I2C_READ_NACK:
+         I2CCONbits->PEN = 1; // STOP
+         driver->state = I2C_READ_STOP;
+         break;
+
+      case I2C_READ_STOP:
+         if( driver->active != 0 ) {
+            __i2c_finish(driver, bus, I2C_STATUS_DONE);
+            break; }
+         driver->state = I2C_IDLE;
+		__i2c_read_callback(driver, bus, driver->reg);
+         break;
+
+
+      // after START interrupt TRANSMIT address
+      case I2C_READREG_START:
+         *I2CTRN = (driver->addr << 1) & ~0x01;
+         driver->state = I2C_READREG_ADDR;
+         break;
+
+      // after address TRANSMIT acknowledgement TRANSMIT reg
+      case I2C_READREG_ADDR:
+         if( __i2c_nack(driver, I2CCONbits, I2CSTATbits) ) break;
+         driver->state = I2C_READREG_WRITE;
+         *I2CTRN = driver->reg;
+         break;
+
+      case I2C_READREG_WRITE:
+         if( __i2c_nack(driver, I2CCONbits, I2CSTATbits) ) break;
+         driver->state = I2C_READREG_RESTART;
+         I2CCONbits->RSEN = 1; // repeat start
+         break;
+
+      case I2C_READREG_RESTART:
+         driver->state = I2C_READ_ADDR;
+         *I2CTRN = (driver->addr << 1) | 0x01;
+         break;
+
+
+      // STOP after a NACK is complete
+      case I2C_ERROR_STOP:
+         __i2c_finish(driver, bus, driver->error);
+         break;
+
+
+      default:
+         return;
+   }
+   return;
+}
+
+// takes the module off the bus, has the reset callback (or a plain module
+// reset) clear the bus lines, counts the result and restarts the queue
+void __i2c_recover(struct I2C_DRIVER *driver, unsigned char bus)
+{
+   I2C_DEVICE_STATS *device;
+   unsigned int stuck = 0;
+
+   driver->recover = 0;
+   driver->state   = I2C_IDLE;
+
+   __i2c_get_hardware_cntl(bus)->I2CEN = 0;
+   if( driver->reset != 0 ) stuck = driver->reset();
+   __i2c_get_hardware_cntl(bus)->I2CEN = 1;
+   __i2c_clear_interrupt_flag(bus);
+
+   driver->stats.recoveries++;
+   if( stuck & I2C_STUCK_SDA ) driver->stats.stuck_sda++;
+   if( stuck & I2C_STUCK_SCL ) driver->stats.stuck_scl++;
+   device = __i2c_device(driver, driver->recover_addr, 1);
+   if( device != 0 ) device->recoveries++;
+
+   __i2c_start_next(driver, bus);
+}
+
+
+// Master I2C interupt 1
+void _ISR __attribute__((auto_psv)) _MI2C1Interrupt(void)
+{
+   _MI2C1IF=0;
+   __i2c_routine(&__i2c_driver[0], (I2C1CONBITS*)&I2C1CONbits,
+                 (I2C1STATBITS*)&I2C1STATbits, &I2C1TRN, &I2C1RCV, 1);
+}
+
+
+// Master I2C interrupt 2
+void _ISR __attribute__((auto_psv)) _MI2C2Interrupt(void)
+{
+   _MI2C2IF=0;
+   __i2c_routine(&__i2c_driver[1], (I2C1CONBITS*)&I2C2CONbits,
+                 (I2C1STATBITS*)&I2C2STATbits, &I2C2TRN, &I2C2RCV, 2);
+}
+
+
+// Master I2C interrupt 3
+void _ISR __attribute__((auto_psv)) _MI2C3Interrupt(void)
+{
+   _MI2C3IF=0;
+   __i2c_routine(&__i2c_driver[2], (I2C1CONBITS*)&I2C3CONbits,
+                 (I2C1STATBITS*)&I2C3STATbits, &I2C3TRN, &I2C3RCV, 3);
+}
+
+
+// ****************************************************************************
+// API DEFINITIONS
+// ****************************************************************************
+
+
+// registers data handler for i2c messages
+int registerI2CReadCallback(I2C_FUNC func, unsigned char bus, unsigned char addr)
+{
+   if (__i2c_read_callback_pos >= I2C_MAX_CALLBACKS) return -1;
+
+   __i2c_read_callbacks[__i2c_read_callback_pos].func = func;
+   __i2c_read_callbacks[__i2c_read_callback_pos].bus  = bus;
+   __i2c_read_callbacks[__i2c_read_callback_pos].addr = addr;
+
+   __i2c_read_callback_pos++;
+
+   return 0;
+}
+
+// registers data handler for i2c messages
+int registerI2CWriteCallback(I2C_FUNC func, unsigned char bus, unsigned char addr)
+{
+   if (__i2c_write_callback_pos >= I2C_MAX_CALLBACKS) return -1;
+
+   __i2c_write_callbacks[__i2c_write_callback_pos].func = func;
+   __i2c_write_callbacks[__i2c_write_callback_pos].bus  = bus;
+   __i2c_write_callbacks[__i2c_write_callback_pos].addr = addr;
+
+   __i2c_write_callback_pos++;
+
+   return 0;
+}
+
+// returns 1 if I2C bus busy otherwise returns 0
+int isBusyI2C(unsigned char bus)
+{
+   if( __i2c_driver[bus-1].state != I2C_IDLE ) return 1;
+   else if( __i2c_driver[bus-1].active != 0 ) return 1;
+   else return 0;
+};
+
+// asyncronous I2C bus write, returns -1 if busy, -2 invalid, 0 if successful
+int writeI2C(unsigned char bus,
+             unsigned char addr,
+             unsigned char *data,
+             unsigned int len)
+{
+   if( isBusyI2C(bus) ) return -1; // busy
+
+   if (len == 0) return -2;
+   if (len > I2C_BUS_BUFFER) return -2;
+   if ((bus > 3) || (bus < 1)) return -2;
+
+   memcpy(__i2c_driver[bus-1].buf, data, len);
+   __i2c_driver[bus-1].pos   = 0;
+   __i2c_driver[bus-1].len   = len;
+   __i2c_driver[bus-1].addr  = addr;
+   __i2c_driver[bus-1].state = I2C_WRITE_START;
+   // Best estimate for most devices. Only used in read callback.
+   __i2c_driver[bus-1].reg   = data[0] + len - 1;
+   __i2c_get_hardware_cntl(bus)->SEN = 1; // send start condition
+
+   return 0;
+}
+
+// syncronous I2C bus write, returns -1 if busy, -2 invalid, 0 if successful
+int writeI2CBlocking(unsigned char bus,
+                     unsigned char addr,
+                     unsigned char *data,
+                     unsigned int  len)
+{
+   int r;
+
+   r = writeI2C(bus, addr, data, len);
+
+   while( isBusyI2C(bus) ) { }
+
+   return r;
+}
+
+// asyncronous I2C bus write, returns -1 if busy, -2 invalid, 0 if successful
+int writeRegI2C(unsigned char bus,
+                unsigned char addr,
+                unsigned char reg,
+                unsigned char *data,
+                unsigned int len)
+{
+   if( isBusyI2C(bus) ) return -1; // busy
+
+   if (len == 0) return -2;
+   if (len + 1 > I2C_BUS_BUFFER) return -2;
+   if ((bus > 3) || (bus < 1)) return -2;
+
+   memcpy(__i2c_driver[bus-1].buf + 1, data, len);
+   __i2c_driver[bus-1].buf[0] = reg;
+   __i2c_driver[bus-1].pos   = 0;
+   __i2c_driver[bus-1].len   = len + 1;
+   __i2c_driver[bus-1].addr  = addr;
+   __i2c_driver[bus-1].state = I2C_WRITE_START;
+   // Best estimate for most devices. Only used in read callback.
+   __i2c_driver[bus-1].reg   = reg + len - 1;
+   __i2c_get_hardware_cntl(bus)->SEN = 1; // send start condition
+
+   return 0;
+}
+
+// syncronous I2C bus write, returns -1 if busy, -2 invalid, 0 if successful
+int writeRegI2CBlocking(unsigned char bus,
+                        unsigned char addr,
+                        unsigned char reg,
+                        unsigned char *data,
+                        unsigned int  len)
+{
+   int r;
+
+   r = writeRegI2C(bus, addr, reg, data, len);
+
+   while( isBusyI2C(bus) ) { }
+
+   return r;
+}
+
+// asyncronous I2C bus write, returns -1 if busy, -2 invalid, 0 if successful
+int writeRegByteI2C(unsigned char bus,
+                unsigned char addr,
+                unsigned char reg,
+                unsigned char data)
+{
+   if( isBusyI2C(bus) ) return -1; // busy
+
+   if ((bus > 3) || (bus < 1)) return -2;
+
+   __i2c_driver[bus-1].buf[0] = reg;
+   __i2c_driver[bus-1].buf[1] = data;
+   __i2c_driver[bus-1].pos   = 0;
+   __i2c_driver[bus-1].len   = 2;
+   __i2c_driver[bus-1].addr  = addr;
+   __i2c_driver[bus-1].state = I2C_WRITE_START;
+   // Best estimate for most devices. Only used in read callback.
+   __i2c_driver[bus-1].reg   = reg;
+   __i2c_get_hardware_cntl(bus)->SEN = 1; // send start condition
+
+   return 0;
+}
+
+// syncronous I2C bus write, returns -1 if busy, -2 invalid, 0 if successful
+int writeRegByteI2CBlocking(unsigned char bus,
+                            unsigned char addr,
+                            unsigned char reg,
+                            unsigned char data)
+{
+   int r;
+
+   r = writeRegByteI2C(bus, addr, reg, data);
+
+   while( isBusyI2C(bus) ) { }
+
+   return r;
+}
+
+/* asyncronous I2C bus READ, returns -1 if busy, -2 invalid, 0 if successful.
+   Callback is called once all data is read. */
+int readI2C(unsigned char bus,
+            unsigned char addr,
+            unsigned int len)
+{
+   if( isBusyI2C(bus) ) return -1; // busy
+
+   if (len == 0) return -2;
+   if (len > I2C_BUS_BUFFER) return -2;
+   if ((bus > 3) || (bus < 1)) return -2;
+
+   __i2c_driver[bus-1].pos   = 0;
+   __i2c_driver[bus-1].len   = len;
+   __i2c_driver[bus-1].addr  = addr;
+   __i2c_driver[bus-1].state = I2C_READ_START;
+   __i2c_get_hardware_cntl(bus)->SEN = 1; // send start condition
+
+   return 0;
+}
+
+
+/* syncronous I2C bus READ, returns pointer to packet data
+   Callback is called once all data is read. */
+unsigned char *readI2CBlocking(unsigned char bus,
+                               unsigned char addr,
+                               unsigned int len)
+{
+   int r;
+
+   if( isBusyI2C(bus) ) return 0;
+
+   r = readI2C(bus, addr, len);
+
+   if( r < 0 ) return 0;
+
+   while( isBusyI2C(bus) ) { };
+
+   return __i2c_driver[bus-1].buf;
+}
+
+
+/* asyncronous I2C bus READ, returns -1 if busy, -2 invalid, 0 if successful.
+   Callback is called once all data is read. */
+int readRegI2C(unsigned char bus,
+               unsigned char addr,
+               unsigned char reg,
+               unsigned int len)
+{
+   if( isBusyI2C(bus) ) return -1; // busy
+
+   if (len == 0) return -2;
+   if (len > I2C_BUS_BUFFER) return -2;
+   if ((bus > 3) || (bus < 1)) return -2;
+
+   __i2c_driver[bus-1].pos   = 0;
+   __i2c_driver[bus-1].len   = len;
+   __i2c_driver[bus-1].addr  = addr;
+   __i2c_driver[bus-1].reg   = reg;
+   __i2c_driver[bus-1].state = I2C_READREG_START;
+   __i2c_get_hardware_cntl(bus)->SEN = 1; // send start condition
+
+   return 0;
+}
+
+/* syncronous I2C bus READ, returns pointer to packet data
+   Callback is called once all data is read. */
+unsigned char *readRegI2CBlocking(unsigned char bus,
+                                  unsigned char addr,
+                                  unsigned char reg,
+                                  unsigned int len)
+{
+   int r;
+
+   if( isBusyI2C(bus) ) return 0;
+
+   r = readRegI2C(bus, addr, reg, len);
+
+   if( r < 0 ) return 0;
+
+   while( isBusyI2C(bus) ) { };
+
+   return __i2c_driver[bus-1].buf;
+}
+
+
+// ****************************************************************************
+// TRANSACTION QUEUE
+// ****************************************************************************
+
+
+// starts running the transaction queue of a bus from its interrupt
+void startI2CQueue(unsigned char bus)
+{
+   if ((bus > 3) || (bus < 1)) return;
+
+   __i2c_disable_interrupt(bus);
+   __i2c_driver[bus-1].running = 1;
+   __i2c_clear_interrupt_flag(bus);
+   __i2c_start_next(&__i2c_driver[bus-1], bus);
+   __i2c_restore_interrupt(bus, 1);
+}
+
+// queues a transaction, returns -1 if it is still queued or active, -2 if
+// invalid, -3 if its device is backing off, 0 if successful
+int queueI2C(unsigned char bus, I2C_TRANSACTION *t)
+{
+   struct I2C_DRIVER *driver;
+   I2C_DEVICE_STATS *device;
+   I2C_TRANSACTION **p;
+   unsigned int enabled;
+
+   if ((bus > 3) || (bus < 1)) return -2;
+   if ((t->len == 0) || (t->len >= I2C_BUS_BUFFER) || (t->data == 0))
+      return -2;
+
+   driver  = &__i2c_driver[bus-1];
+   enabled = __i2c_disable_interrupt(bus);
+
+   if( (t->status == I2C_STATUS_QUEUED) || (t->status == I2C_STATUS_ACTIVE) )
+   {
+      __i2c_restore_interrupt(bus, enabled);
+      return -1;
+   }
+
+   device = __i2c_device(driver, t->addr, 0);
+   if( (device != 0) && (device->backoff != 0) &&
+       ((unsigned int)(__i2c_ms - device->backoff_from) < device->backoff) )
+   {
+      __i2c_restore_interrupt(bus, enabled);
+      return -3;
+   }
+
+   t->status    = I2C_STATUS_QUEUED;
+   t->queued_at = __i2c_ms;
+
+   // behind every transaction of the same or a higher priority
+   p = &driver->queue;
+   while( (*p != 0) && ((*p)->priority <= t->priority) ) p = &(*p)->next;
+   t->next = *p;
+   *p = t;
+
+   __i2c_start_next(driver, bus);
+   __i2c_restore_interrupt(bus, enabled);
+
+   return 0;
+}
+
+// removes a transaction that has not started yet, returns -1 if active
+int cancelI2C(unsigned char bus, I2C_TRANSACTION *t)
+{
+   I2C_TRANSACTION **p;
+   unsigned int enabled;
+   int r = 0;
+
+   if ((bus > 3) || (bus < 1)) return -2;
+
+   enabled = __i2c_disable_interrupt(bus);
+
+   if( t->status == I2C_STATUS_ACTIVE ) r = -1;
+   else if( t->status == I2C_STATUS_QUEUED )
+   {
+      for( p = &__i2c_driver[bus-1].queue; *p != 0; p = &(*p)->next )
+      {
+         if( *p == t ) { *p = t->next; break; }
+      }
+      t->next   = 0;
+      t->status = I2C_STATUS_IDLE;
+   }
+
+   __i2c_restore_interrupt(bus, enabled);
+
+   return r;
+}
+
+// the number of transactions queued or active on a bus
+unsigned int pendingI2C(unsigned char bus)
+{
+   I2C_TRANSACTION *t;
+   unsigned int enabled, n = 0;
+
+   if ((bus > 3) || (bus < 1)) return 0;
+
+   enabled = __i2c_disable_interrupt(bus);
+   if( __i2c_driver[bus-1].active != 0 ) n++;
+   for( t = __i2c_driver[bus-1].queue; t != 0; t = t->next ) n++;
+   __i2c_restore_interrupt(bus, enabled);
+
+   return n;
+}
+
+// advances the millisecond clock, times out hung transactions and recovers
+// the bus after a timeout or a lost arbitration
+void tickI2C(void)
+{
+   struct I2C_DRIVER *driver;
+   I2C_TRANSACTION *t;
+   unsigned int enabled, timeout;
+   unsigned char bus;
+
+   __i2c_ms++;
+
+   for( bus = 1; bus <= 3; bus++ )
+   {
+      driver  = &__i2c_driver[bus-1];
+      enabled = __i2c_disable_interrupt(bus);
+
+      t = driver->active;
+      if( t != 0 )
+      {
+         timeout = (t->timeout == 0) ? I2C_DEFAULT_TIMEOUT : t->timeout;
+         if( (unsigned int)(__i2c_ms - t->started_at) > timeout )
+         {
+            // stop the module so the hung transfer can't interrupt again,
+            // the recovery below turns it back on
+            __i2c_get_hardware_cntl(bus)->I2CEN = 0;
+            __i2c_clear_interrupt_flag(bus);
+            __i2c_finish(driver, bus, I2C_STATUS_TIMEOUT);
+         }
+      }
+
+      if( driver->recover && (driver->active == 0) )
+         __i2c_recover(driver, bus);
+
+      __i2c_restore_interrupt(bus, enabled);
+   }
+}
+
+// the driver's millisecond clock
+unsigned int nowI2C(void)
+{
+   return __i2c_ms;
+}
+
+// copies the statistics of a bus and starts a new latency_max window
+void getI2CStats(unsigned char bus, I2C_STATS *stats)
+{
+   unsigned int enabled;
+
+   if ((bus > 3) || (bus < 1)) return;
+
+   enabled = __i2c_disable_interrupt(bus);
+   *stats = __i2c_driver[bus-1].stats;
+   __i2c_driver[bus-1].stats.latency_max = 0;
+   __i2c_restore_interrupt(bus, enabled);
+}
+
+// copies the statistics of a device, returns -2 if it was never addressed
+int getI2CDeviceStats(unsigned char bus, unsigned char addr,
+                      I2C_DEVICE_STATS *stats)
+{
+   I2C_DEVICE_STATS *device;
+   unsigned int enabled;
+   int r = -2;
+
+   if ((bus > 3) || (bus < 1)) return -2;
+
+   enabled = __i2c_disable_interrupt(bus);
+   device = __i2c_device(&__i2c_driver[bus-1], addr, 0);
+   if( device != 0 ) { *stats = *device; r = 0; }
+   __i2c_restore_interrupt(bus, enabled);
+
+   return r;
+}
+
+// registers a function that clears a hung bus after a timeout
+int registerI2CResetCallback(unsigned int (*func)(void), unsigned char bus)
+{
+   if ((bus > 3) || (bus < 1)) return -2;
+
+   __i2c_driver[bus-1].reset = func;
+
+   return 0;
+}
@@ -1,102 +1,240 @@
-/**
- * @file periph_i2c.h
- * @author J. Brinton
- * @author Robotex, Inc.
- *
- * API for I2C devices
- *
- *
- *
- * Firmware MUST configure/enable it's I2C hardware AND enable interrupts
- */
-
-
-// callback prototype
-typedef void (*I2C_FUNC)(unsigned char addr,
-                         unsigned char bus, /* 1-indexed Microchip I2C bus */
-                         unsigned char reg, /* zero if I2C read_current_adr */
-                         unsigned char *data,
-                         unsigned int  len);
-
-// registers callback for I2C read operations
-int registerI2CReadCallback(I2C_FUNC, unsigned char bus, unsigned char addr);
-
-// registers callback for I2C write operations
-int registerI2CWriteCallback(I2C_FUNC, unsigned char bus, unsigned char addr);
-
-
-
-// asyncronous I2C bus write returns -1 if busy, -2 invalid, 0 successful
-int writeI2C(unsigned char bus,  /* 1-indexed Microchip I2C bus */
-             unsigned char addr, /* I2C device address */
-             unsigned char *data,
-             unsigned int  len);
-
-// syncronous I2C bus write returns -1 if busy, -2 invalid, 0 successful
-int writeI2CBlocking(unsigned char bus,  /* 1-indexed Microchip I2C bus */
-                     unsigned char addr, /* I2C device address */
-                     unsigned char *data,
-                     unsigned int  len);
-
-// asyncronous I2C bus write returns -1 if busy, -2 invalid, 0 successful
-int writeRegI2C(unsigned char bus,  /* 1-indexed Microchip I2C bus */
-                unsigned char addr, /* I2C device address */
-                unsigned char reg,
-                unsigned char *data,
-                unsigned int  len);
-
-// syncronous I2C bus write returns -1 if busy, -2 invalid, 0 successful
-int writeRegI2CBlocking(unsigned char bus,  /* 1-indexed Microchip I2C bus */
-                        unsigned char addr, /* I2C device address */
-                        unsigned char reg,
-                        unsigned char *data,
-                        unsigned int  len);
-
-// asyncronous I2C bus write returns -1 if busy, -2 invalid, 0 successful
-int writeRegByteI2C(unsigned char bus,
-                    unsigned char addr,
-                    unsigned char reg,
-                    unsigned char data);
-
-// syncronous I2C bus write, returns -1 if busy, -2 invalid, 0 if successful
-int writeRegByteI2CBlocking(unsigned char bus,
-                            unsigned char addr,
-                            unsigned char reg,
-                            unsigned char data);
-
-
-
-
-
-/* asyncronous I2C bus read - calls message handler
- returns -1 if busy, -2 invalid, 0 successful */
-int readI2C(unsigned char bus,  /* 1-indexed Microchip I2C bus */
-            unsigned char addr, /* I2C device address */
-            unsigned int  len);
-
-// syncronous version of the function above returns pointer to packet data
-unsigned char *readI2CBlocking(unsigned char bus,
-                               unsigned char addr,
-                               unsigned int  len);
-
-/* asyncronous I2C bus read - calls message handler
-   returns -1 if busy, -2 invalid, 0 successful */
-int readRegI2C(unsigned char bus,  /* 1-indexed Microchip I2C bus */
-               unsigned char addr, /* I2C device address */
-               unsigned char reg,  /* I2C device register */
-               unsigned int  len);
-
-// syncronous version of the function above returns pointer to packet data
-unsigned char *readRegI2CBlocking(unsigned char bus,
-                                  unsigned char addr,
-                                  unsigned char reg,
-                                  unsigned int  len);
-
-
-
-
-
-
-
-// returns 1 if I2C bus busy otherwise returns 0
-int isBusyI2C(unsigned char bus); /* 1-index Microchip I2C bus */
+/**
+ * @file periph_i2c.h
+ * @author J. Brinton
+ * @author Robotex, Inc.
+ *
+ * API for I2C devices
+ *
+ *
+ *
+ * Firmware MUST configure/enable it's I2C hardware AND enable interrupts
+ */
+
+
+// callback prototype
+typedef void (*I2C_FUNC)(unsigned char addr,
+                         unsigned char bus, /* 1-indexed Microchip I2C bus */
+                         unsigned char reg, /* zero if I2C read_current_adr */
+                         unsigned char *data,
+                         unsigned int  len);
+
+// registers callback for I2C read operations
+int registerI2CReadCallback(I2C_FUNC, unsigned char bus, unsigned char addr);
+
+// registers callback for I2C write operations
+int registerI2CWriteCallback(I2C_FUNC, unsigned char bus, unsigned char addr);
+
+
+
+// asyncronous I2C bus write returns -1 if busy, -2 invalid, 0 successful
+int writeI2C(unsigned char bus,  /* 1-indexed Microchip I2C bus */
+             unsigned char addr, /* I2C device address */
+             unsigned char *data,
+             unsigned int  len);
+
+// syncronous I2C bus write returns -1 if busy, -2 invalid, 0 successful
+int writeI2CBlocking(unsigned char bus,  /* 1-indexed Microchip I2C bus */
+                     unsigned char addr, /* I2C device address */
+                     unsigned char *data,
+                     unsigned int  len);
+
+// asyncronous I2C bus write returns -1 if busy, -2 invalid, 0 successful
+int writeRegI2C(unsigned char bus,  /* 1-indexed Microchip I2C bus */
+                unsigned char addr, /* I2C device address */
+                unsigned char reg,
+                unsigned char *data,
+                unsigned int  len);
+
+// syncronous I2C bus write returns -1 if busy, -2 invalid, 0 successful
+int writeRegI2CBlocking(unsigned char bus,  /* 1-indexed Microchip I2C bus */
+                        unsigned char addr, /* I2C device address */
+                        unsigned char reg,
+                        unsigned char *data,
+                        unsigned int  len);
+
+// asyncronous I2C bus write returns -1 if busy, -2 invalid, 0 successful
+int writeRegByteI2C(unsigned char bus,
+                    unsigned char addr,
+                    unsigned char reg,
+                    unsigned char data);
+
+// syncronous I2C bus write, returns -1 if busy, -2 invalid, 0 if successful
+int writeRegByteI2CBlocking(unsigned char bus,
+                            unsigned char addr,
+                            unsigned char reg,
+                            unsigned char data);
+
+
+
+
+
+/* asyncronous I2C bus read - calls message handler
+ returns -1 if busy, -2 invalid, 0 successful */
+int readI2C(unsigned char bus,  /* 1-indexed Microchip I2C bus */
+            unsigned char addr, /* I2C device address */
+            unsigned int  len);
+
+// syncronous version of the function above returns pointer to packet data
+unsigned char *readI2CBlocking(unsigned char bus,
+                               unsigned char addr,
+                               unsigned int  len);
+
+/* asyncronous I2C bus read - calls message handler
+   returns -1 if busy, -2 invalid, 0 successful */
+int readRegI2C(unsigned char bus,  /* 1-indexed Microchip I2C bus */
+               unsigned char addr, /* I2C device address */
+               unsigned char reg,  /* I2C device register */
+               unsigned int  len);
+
+// syncronous version of the function above returns pointer to packet data
+unsigned char *readRegI2CBlocking(unsigned char bus,
+                                  unsigned char addr,
+                                  unsigned char reg,
+                                  unsigned int  len);
+
+
+
+
+
+
+
+// returns 1 if I2C bus busy otherwise returns 0
+int isBusyI2C(unsigned char bus); /* 1-index Microchip I2C bus */
+
+
+
+// ****************************************************************************
+// TRANSACTION QUEUE
+// ****************************************************************************
+//
+// Each bus runs a queue of transactions from its master interrupt. The
+// caller owns the transaction (static storage), fills in the request part
+// and queues it; the interrupt starts the next transaction as soon as the
+// previous one is finished, highest priority first, and calls the
+// transaction's completion function from the interrupt. Call tickI2C()
+// once per millisecond to time out transactions that hang the bus.
+//
+// A timeout or a lost arbitration holds the queue until tickI2C() has
+// recovered the bus through the reset callback. A device that NACKs, times
+// out or loses the bus is backed off: queueI2C() refuses its transactions
+// for I2C_BACKOFF_MIN ms, doubling with every further failure up to
+// I2C_BACKOFF_MAX, until one of them succeeds.
+
+// transaction flags
+#define I2C_READ        0x01   // read len bytes into data, else write them
+#define I2C_NO_REG      0x02   // no register/command byte before the data
+
+// transaction priorities, lower runs first
+#define I2C_PRIORITY_HIGH   0
+#define I2C_PRIORITY_NORMAL 1
+#define I2C_PRIORITY_LOW    2
+
+#define I2C_DEFAULT_TIMEOUT 10 /*ms*/
+#define I2C_BACKOFF_MIN     8 /*ms*/
+#define I2C_BACKOFF_MAX     2000 /*ms*/
+
+// bus lines the reset callback found held low
+#define I2C_STUCK_SDA 0x01
+#define I2C_STUCK_SCL 0x02
+
+// transaction status
+typedef enum I2C_STATUS_T
+{
+   I2C_STATUS_IDLE = 0,   // never queued
+   I2C_STATUS_QUEUED,
+   I2C_STATUS_ACTIVE,
+   I2C_STATUS_DONE,
+   I2C_STATUS_NACK,       // the slave did not acknowledge
+   I2C_STATUS_COLLISION,  // lost the bus (bus collision or write collision)
+   I2C_STATUS_TIMEOUT,    // did not finish within its timeout
+} I2C_STATUS;
+
+struct I2C_TRANSACTION_T;
+
+// completion prototype, called from the I2C interrupt (or from tickI2C()
+// for a timeout) with the transaction's status set
+typedef void (*I2C_DONE_FUNC)(struct I2C_TRANSACTION_T *t);
+
+typedef struct I2C_TRANSACTION_T
+{
+   // filled in by the caller
+   unsigned char addr;       // 7-bit device address
+   unsigned char reg;        // register or SMBus command, see I2C_NO_REG
+   unsigned char flags;
+   unsigned char priority;
+   unsigned char *data;
+   unsigned int  len;        // 1 to 255 bytes
+   unsigned int  timeout;    // ms once started, 0 for I2C_DEFAULT_TIMEOUT
+   I2C_DONE_FUNC done;       // may be 0
+
+   // owned by the driver
+   volatile I2C_STATUS status;
+   unsigned int  queued_at;  // ms
+   unsigned int  started_at; // ms
+   struct I2C_TRANSACTION_T *next;
+} I2C_TRANSACTION;
+
+// per bus statistics, counted since startI2CQueue()
+typedef struct I2C_STATS_T
+{
+   unsigned long transactions;   // finished, successful or not
+   unsigned long failures;       // finished with an error status
+   unsigned long bytes;          // data bytes of successful transactions
+   unsigned long bits;           // bit times on the bus, estimated from the
+                                 // frames each transaction clocked
+   unsigned long latency_total;  // ms from queueing to finishing
+   unsigned int  latency_max;    // ms, since the last getI2CStats()
+   unsigned long nacks;
+   unsigned long timeouts;
+   unsigned long collisions;     // lost arbitration or write collision
+   unsigned long recoveries;     // bus resets after a timeout or collision
+   unsigned long stuck_sda;      // recoveries that found SDA held low
+   unsigned long stuck_scl;      // recoveries that found SCL held low
+} I2C_STATS;
+
+// per device statistics and back-off, counted since startI2CQueue()
+typedef struct I2C_DEVICE_STATS_T
+{
+   unsigned char addr;
+   unsigned int  nacks;
+   unsigned int  timeouts;
+   unsigned int  collisions;
+   unsigned int  recoveries;     // bus resets its transactions caused
+   unsigned int  failures;       // in a row
+   unsigned int  backoff;        // ms, 0 if not backing off
+   unsigned int  backoff_from;   // ms
+} I2C_DEVICE_STATS;
+
+// starts running the transaction queue of a bus from its interrupt; the
+// blocking and single transfer functions above must not be used on the
+// bus afterwards
+void startI2CQueue(unsigned char bus);
+
+// queues a transaction, returns -1 if it is still queued or active, -2 if
+// invalid, -3 if its device is backing off, 0 if successful
+int queueI2C(unsigned char bus, I2C_TRANSACTION *t);
+
+// removes a transaction that has not started yet, returns -1 if active
+int cancelI2C(unsigned char bus, I2C_TRANSACTION *t);
+
+// the number of transactions queued or active on a bus
+unsigned int pendingI2C(unsigned char bus);
+
+// advances the driver's millisecond clock, times out hung transactions and
+// recovers the bus, call once per millisecond from the main loop
+void tickI2C(void);
+
+// the driver's millisecond clock
+unsigned int nowI2C(void);
+
+// copies the statistics of a bus and starts a new latency_max window
+void getI2CStats(unsigned char bus, I2C_STATS *stats);
+
+// copies the statistics of a device, returns -2 if it was never addressed
+int getI2CDeviceStats(unsigned char bus, unsigned char addr,
+                      I2C_DEVICE_STATS *stats);
+
+// registers a function that clears a hung bus after a timeout or a lost
+// arbitration, called with the I2C module disabled; returns the
+// I2C_STUCK_ bits of the lines it found held low
+int registerI2CResetCallback(unsigned int (*func)(void), unsigned char bus);
@@ -1,2 +1,2 @@
-void motor_stress_test(void);
-void test_function(void);
+void motor_stress_test(void);
+void test_function(void);
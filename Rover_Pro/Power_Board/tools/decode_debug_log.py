@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+"""Decode the power board's binary debug log.
+
+Reads the bytes the board logged (a capture of the debug UART, or the data of
+successive REG_DEBUG_LOG reads put end to end) from a file or stdin, and prints
+one line per record.  The format table is read from src/debug_log_formats.h, so
+it always matches the firmware built from the same tree.  See src/debug_log.h for
+the record layout.
+
+usage: decode_debug_log.py [capture] [--formats path/to/debug_log_formats.h]
+"""
+
+import argparse
+import os
+import re
+import sys
+
+SYNC = 0xA5
+MAX_ARGS = 3
+
+DEFAULT_FORMATS = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                               '..', 'src', 'debug_log_formats.h')
+
+
+def read_formats(path):
+    """The (id, text) of every LOG_FORMAT line, in order."""
+    pattern = re.compile(r'^\s*LOG_FORMAT\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)')
+    formats = []
+    with open(path) as f:
+        for line in f:
+            match = pattern.match(line)
+            if match:
+                formats.append((match.group(1), match.group(2).encode().decode('unicode_escape')))
+    return formats
+
+
+def format_args(text, args):
+    """Python % formatting, with %d signed and everything else unsigned 16 bit."""
+    conversions = re.findall(r'%[-#0 +]*\d*(?:\.\d+)?([a-zA-Z%])', text)
+    values = []
+    for conversion in conversions:
+        if conversion == '%':
+            continue
+        if not args:
+            break
+        value = args.pop(0)
+        if conversion in 'di' and value >= 0x8000:
+            value -= 0x10000
+        values.append(value)
+    try:
+        return text % tuple(values)
+    except (TypeError, ValueError):
+        return '%s %s' % (text, values)
+
+
+def records(data):
+    """(time, id, args) of every good record, skipping anything that isn't one."""
+    i = 0
+    while i < len(data):
+        if data[i] != SYNC:
+            i += 1
+            continue
+        if i + 6 > len(data):
+            break
+        count = data[i + 2]
+        length = 6 + 2 * count
+        if count > MAX_ARGS:
+            i += 1
+            continue
+        if i + length > len(data):
+            break
+        body = data[i + 1:i + length]
+        if sum(body) & 0xff:
+            i += 1
+            continue
+        time = body[2] | (body[3] << 8)
+        args = [body[4 + 2 * k] | (body[5 + 2 * k] << 8) for k in range(count)]
+        yield time, body[0], args
+        i += length
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n')[0])
+    parser.add_argument('capture', nargs='?', help='raw log bytes, stdin if left out')
+    parser.add_argument('--formats', default=DEFAULT_FORMATS, help='debug_log_formats.h')
+    options = parser.parse_args()
+
+    formats = read_formats(options.formats)
+    if options.capture:
+        with open(options.capture, 'rb') as f:
+            data = f.read()
+    else:
+        data = sys.stdin.buffer.read()
+
+    #the board keeps the low 16 bits of its ms counter, unwrap them
+    base = 0
+    last = None
+    for time, format_id, args in records(data):
+        if last is not None and time < last:
+            base += 0x10000
+        last = time
+        if format_id < len(formats):
+            name, text = formats[format_id]
+            line = format_args(text, list(args))
+        else:
+            name, line = 'format %d' % format_id, ' '.join('0x%04x' % a for a in args)
+        print('%10.3f  %-24s %s' % ((base + time) / 1000.0, name, line))
+
+
+if __name__ == '__main__':
+    main()